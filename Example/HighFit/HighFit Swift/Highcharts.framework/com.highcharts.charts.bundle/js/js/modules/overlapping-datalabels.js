@@ -5,7 +5,9 @@
 
  License: www.highcharts.com/license
 */
-(function(d){"object"===typeof module&&module.exports?module.exports=d:d(Highcharts)})(function(d){(function(f){var d=f.Chart,k=f.each,m=f.objectEach,q=f.pick,r=f.addEvent;d.prototype.callbacks.push(function(c){r(c,"render",function(){var g=[];k(c.labelCollectors||[],function(a){g=g.concat(a())});k(c.yAxis||[],function(a){a.options.stackLabels&&!a.options.stackLabels.allowOverlap&&m(a.stacks,function(a){m(a,function(a){g.push(a.label)})})});k(c.series||[],function(a){var c=a.options.dataLabels,b=
-a.dataLabelCollections||["dataLabel"];(c.enabled||a._hasPointLabels)&&!c.allowOverlap&&a.visible&&k(b,function(b){k(a.points,function(a){a[b]&&(a[b].labelrank=q(a.labelrank,a.shapeArgs&&a.shapeArgs.height),g.push(a[b]))})})});c.hideOverlappingLabels(g)})});d.prototype.hideOverlappingLabels=function(c){var g=c.length,a,h,b,e,d,f,n,p,l,m=function(a,b,c,d,e,f,g,h){return!(e>a+c||e+g<a||f>b+d||f+h<b)};for(h=0;h<g;h++)if(a=c[h])a.oldOpacity=a.opacity,a.newOpacity=1,a.width||(b=a.getBBox(),a.width=b.width,
-a.height=b.height);c.sort(function(a,b){return(b.labelrank||0)-(a.labelrank||0)});for(h=0;h<g;h++)for(b=c[h],a=h+1;a<g;++a)if(e=c[a],b&&e&&b!==e&&b.placed&&e.placed&&0!==b.newOpacity&&0!==e.newOpacity&&(d=b.alignAttr,f=e.alignAttr,n=b.parentGroup,p=e.parentGroup,l=2*(b.box?0:b.padding||0),d=m(d.x+n.translateX,d.y+n.translateY,b.width-l,b.height-l,f.x+p.translateX,f.y+p.translateY,e.width-l,e.height-l)))(b.labelrank<e.labelrank?b:e).newOpacity=0;k(c,function(a){var b,c;a&&(c=a.newOpacity,a.oldOpacity!==
-c&&a.placed&&(c?a.show(!0):b=function(){a.hide()},a.alignAttr.opacity=c,a[a.isOld?"animate":"attr"](a.alignAttr,null,b)),a.isOld=!0)})}})(d)});
+(function(a){if(typeof module==='object'&&module.exports){module.exports=a;}else{a(Highcharts);}}(function(a){(function(b){var a=b.each,e=b.Chart;var d=4;function f(a,c,g,e,b,d,h,f){return!(b>a+g||b+h<a||d>c+e||d+f<c);}function g(a,b){var c=a.padding;return f(a.x,a.y,a.width-c,a.height-c,b.x,b.y,b.width-c,b.height-c);}function c(j){var g=Infinity,h=Infinity,c=-Infinity,e=-Infinity,i=0,b=0,f;a(j,function(a){if(a.bounded){g=Math.min(g,a.x);h=Math.min(h,a.y);c=Math.max(c,a.x+a.width);e=Math.max(e,a.y+a.height);
+i+=(a.width+a.height)/2;b++;}});this.x=b?g:0;this.y=b?h:0;this.cellSize=Math.max(1,b?i/b:1);this.columns=Math.max(1,Math.ceil((c-this.x)/this.cellSize)||1);this.rows=Math.max(1,Math.ceil((e-this.y)/this.cellSize)||1);f=this.columns*this.rows;if(f>d*b+16){this.cellSize*=Math.sqrt(f/(d*b+16));this.columns=Math.max(1,Math.ceil((c-this.x)/this.cellSize));this.rows=Math.max(1,Math.ceil((e-this.y)/this.cellSize));}this.cells=[];}c.prototype={eachCell:function(b,h){var a=this,c=function(b,a){return Math.min(a-1,
+Math.max(0,b));},f=c(Math.floor((b.x-a.x)/a.cellSize),a.columns),g=c(Math.floor((b.x+b.width-a.x)/a.cellSize),a.columns),i=c(Math.floor((b.y-a.y)/a.cellSize),a.rows),j=c(Math.floor((b.y+b.height-a.y)/a.cellSize),a.rows),d,e;for(e=i;e<=j;e++){for(d=f;d<=g;d++){h(e*a.columns+d);}}},insert:function(a){var b=this.cells;this.eachCell(a,function(c){(b[c]||(b[c]=[])).push(a);});},find:function(c,b,e){var d=this.cells,a;this.eachCell(c,function(h){var g=d[h],f,c;if(a||!g){return;}for(f=0;f<g.length;f++){c=g[f];
+if(c.stamp!==b){c.stamp=b;if(e(c)){a=c;return;}}}});return a;}};e.prototype.hideOverlappingLabels=function(e){var n=e.length,f=[],l=[],m=[],i,b,h,k,j,d;for(d=0;d<n;d++){b=e[d];if(b){b.oldOpacity=b.opacity;b.newOpacity=1;if(!b.width){h=b.getBBox();b.width=h.width;b.height=h.height;}}}e.sort(function(a,b){return(b.labelrank||0)-(a.labelrank||0);});for(d=0;d<n;d++){b=e[d];if(b&&b.placed){k=b.alignAttr;j=b.parentGroup;f.push({label:b,x:k.x+j.translateX,y:k.y+j.translateY,width:b.width,height:b.height,
+padding:2*(b.box?0:b.padding||0),stamp:-1});}}a(f,function(a){a.bounded=isFinite(a.x)&&isFinite(a.y)&&isFinite(a.width)&&isFinite(a.height);});i=new c(f);a(f,function(a,e){var c=a.label,d=function(b){var d=b.label;if(b.visible&&d!==c&&g(b,a)){if(d.labelrank<c.labelrank){d.newOpacity=0;b.visible=false;return false;}c.newOpacity=0;return true;}return false;},b;if(c.newOpacity===0){return;}if(a.bounded){b=0;while(b<l.length&&!d(l[b])){b++;}if(c.newOpacity!==0){i.find(a,e,d);}}else{b=0;while(b<m.length&&!d(m[b])){b++;
+}}a.visible=c.newOpacity!==0;if(a.visible){m.push(a);if(a.bounded){i.insert(a);}else{l.push(a);}}});a(e,function(a){var c,b;if(a){b=a.newOpacity;if(a.oldOpacity!==b&&a.placed){if(b){a.show(true);}else{c=function(){a.hide();};}a.alignAttr.opacity=b;a[a.isOld?'animate':'attr'](a.alignAttr,null,c);}a.isOld=true;}});};}(a));}));
@@ -6,28 +6,32 @@
 
  License: www.highcharts.com/license
 */
-(function(u){"object"===typeof module&&module.exports?module.exports=u:u(Highcharts)})(function(u){var E=function(d){var u=d.each,x=d.extend,m=d.pick;return{getColor:function(t,p){var D=p.index,l=p.levelMap,g=p.parentColor,u=p.parentColorIndex,w=p.series,q=p.colors,x=p.siblings,f=w.points,r,B,y;if(t){f=f[t.i];t=l[t.levelDynamic]||{};(r=f&&("boolean"===typeof t.colorByPoint?t.colorByPoint:!!w.options.colorByPoint))&&(B=q[f.index%q.length]);q=f&&f.options.color;r=t&&t.color;if(l=g)l=(l=t&&t.colorVariation)&&
-"brightness"===l.key?d.color(g).brighten(D/x*l.to).get():g;r=m(q,r,B,l,w.color);y=m(f&&f.options.colorIndex,t&&t.colorIndex,u,p.colorIndex)}return{color:r,colorIndex:y}},setTreeValues:function p(d,l){var g=l.before,z=l.idRoot,w=l.mapIdToNode[z],q=l.points[d.i],A=q&&q.options||{},f=0,r=[];x(d,{levelDynamic:d.level-(("boolean"===typeof l.levelIsConstant?l.levelIsConstant:1)?0:w.level),name:m(q&&q.name,""),visible:z===d.id||("boolean"===typeof l.visible?l.visible:!1)});"function"===typeof g&&(d=g(d,
-l));u(d.children,function(g,m){var q=x({},l);x(q,{index:m,siblings:d.children.length,visible:d.visible});g=p(g,q);r.push(g);g.visible&&(f+=g.val)});d.visible=0<f||d.visible;g=m(A.value,f);x(d,{children:r,childrenTotal:f,isLeaf:d.visible&&!f,val:g});return d}}}(u);(function(d,u){var x=d.seriesType,m=d.seriesTypes,t=d.map,p=d.merge,D=d.extend,l=d.noop,g=d.each,z=u.getColor,w=d.grep,q=d.isNumber,A=d.isString,f=d.pick,r=d.Series,B=d.stableSort,y=d.Color,E=function(a,b,c){c=c||this;d.objectEach(a,function(k,
-e){b.call(c,k,e,a)})},F=d.reduce,C=function(a,b,c){c=c||this;a=b.call(c,a);!1!==a&&C(a,b,c)};x("treemap","scatter",{showInLegend:!1,marker:!1,dataLabels:{enabled:!0,defer:!1,verticalAlign:"middle",formatter:function(){return this.point.name||this.point.id},inside:!0},tooltip:{headerFormat:"",pointFormat:"\x3cb\x3e{point.name}\x3c/b\x3e: {point.value}\x3cbr/\x3e"},ignoreHiddenPoint:!0,layoutAlgorithm:"sliceAndDice",layoutStartingDirection:"vertical",alternateStartingDirection:!1,levelIsConstant:!0,
-drillUpButton:{position:{align:"right",x:-10,y:10}},borderColor:"#e6e6e6",borderWidth:1,opacity:.15,states:{hover:{borderColor:"#999999",brightness:m.heatmap?0:.1,halo:!1,opacity:.75,shadow:!1}}},{pointArrayMap:["value"],axisTypes:m.heatmap?["xAxis","yAxis","colorAxis"]:["xAxis","yAxis"],directTouch:!0,optionalAxis:"colorAxis",getSymbol:l,parallelArrays:["x","y","value","colorValue"],colorKey:"colorValue",translateColors:m.heatmap&&m.heatmap.prototype.translateColors,colorAttribs:m.heatmap&&m.heatmap.prototype.colorAttribs,
-trackerGroups:["group","dataLabelsGroup"],getListOfParents:function(a,b){a=F(a||[],function(a,b,e){b=f(b.parent,"");void 0===a[b]&&(a[b]=[]);a[b].push(e);return a},{});E(a,function(a,k,e){""!==k&&-1===d.inArray(k,b)&&(g(a,function(a){e[""].push(a)}),delete e[k])});return a},getTree:function(){var a=t(this.data,function(a){return a.id}),a=this.getListOfParents(this.data,a);this.nodeMap=[];return this.buildNode("",-1,0,a,null)},init:function(a,b){r.prototype.init.call(this,a,b);this.options.allowDrillToNode&&
-d.addEvent(this,"click",this.onClickDrillToNode)},buildNode:function(a,b,c,k,e){var n=this,d=[],h=n.points[b],G=0,H;g(k[a]||[],function(b){H=n.buildNode(n.points[b].id,b,c+1,k,a);G=Math.max(H.height+1,G);d.push(H)});b={id:a,i:b,children:d,height:G,level:c,parent:e,visible:!1};n.nodeMap[b.id]=b;h&&(h.node=b);return b},setTreeValues:function(a){var b=this,c=b.options,k=b.nodeMap[b.rootNode],c="boolean"===typeof c.levelIsConstant?c.levelIsConstant:!0,e=0,n=[],d,h=b.points[a.i];g(a.children,function(a){a=
-b.setTreeValues(a);n.push(a);a.ignore||(e+=a.val)});B(n,function(a,b){return a.sortIndex-b.sortIndex});d=f(h&&h.options.value,e);h&&(h.value=d);D(a,{children:n,childrenTotal:e,ignore:!(f(h&&h.visible,!0)&&0<d),isLeaf:a.visible&&!e,levelDynamic:a.level-(c?0:k.level),name:f(h&&h.name,""),sortIndex:f(h&&h.sortIndex,-d),val:d});return a},calculateChildrenAreas:function(a,b){var c=this,k=c.options,e=this.levelMap[a.levelDynamic+1],n=f(c[e&&e.layoutAlgorithm]&&e.layoutAlgorithm,k.layoutAlgorithm),d=k.alternateStartingDirection,
-h=[];a=w(a.children,function(a){return!a.ignore});e&&e.layoutStartingDirection&&(b.direction="vertical"===e.layoutStartingDirection?0:1);h=c[n](b,a);g(a,function(a,e){e=h[e];a.values=p(e,{val:a.childrenTotal,direction:d?1-b.direction:b.direction});a.pointValues=p(e,{x:e.x/c.axisRatio,width:e.width/c.axisRatio});a.children.length&&c.calculateChildrenAreas(a,a.values)})},setPointValues:function(){var a=this,b=a.xAxis,c=a.yAxis;g(a.points,function(k){var e=k.node,n=e.pointValues,d,h,g;g=(a.pointAttribs(k)["stroke-width"]||
-0)%2/2;n&&e.visible?(e=Math.round(b.translate(n.x,0,0,0,1))-g,d=Math.round(b.translate(n.x+n.width,0,0,0,1))-g,h=Math.round(c.translate(n.y,0,0,0,1))-g,n=Math.round(c.translate(n.y+n.height,0,0,0,1))-g,k.shapeType="rect",k.shapeArgs={x:Math.min(e,d),y:Math.min(h,n),width:Math.abs(d-e),height:Math.abs(n-h)},k.plotX=k.shapeArgs.x+k.shapeArgs.width/2,k.plotY=k.shapeArgs.y+k.shapeArgs.height/2):(delete k.plotX,delete k.plotY)})},setColorRecursive:function(a,b,c,k,e){var d=this,f=d&&d.chart,f=f&&f.options&&
-f.options.colors,h;if(a){h=z(a,{colors:f,index:k,levelMap:d.levelMap,parentColor:b,parentColorIndex:c,series:d,siblings:e});if(b=d.points[a.i])b.color=h.color,b.colorIndex=h.colorIndex;g(a.children||[],function(b,c){d.setColorRecursive(b,h.color,h.colorIndex,c,a.children.length)})}},algorithmGroup:function(a,b,c,d){this.height=a;this.width=b;this.plot=d;this.startDirection=this.direction=c;this.lH=this.nH=this.lW=this.nW=this.total=0;this.elArr=[];this.lP={total:0,lH:0,nH:0,lW:0,nW:0,nR:0,lR:0,aspectRatio:function(a,
-b){return Math.max(a/b,b/a)}};this.addElement=function(a){this.lP.total=this.elArr[this.elArr.length-1];this.total+=a;0===this.direction?(this.lW=this.nW,this.lP.lH=this.lP.total/this.lW,this.lP.lR=this.lP.aspectRatio(this.lW,this.lP.lH),this.nW=this.total/this.height,this.lP.nH=this.lP.total/this.nW,this.lP.nR=this.lP.aspectRatio(this.nW,this.lP.nH)):(this.lH=this.nH,this.lP.lW=this.lP.total/this.lH,this.lP.lR=this.lP.aspectRatio(this.lP.lW,this.lH),this.nH=this.total/this.width,this.lP.nW=this.lP.total/
-this.nH,this.lP.nR=this.lP.aspectRatio(this.lP.nW,this.nH));this.elArr.push(a)};this.reset=function(){this.lW=this.nW=0;this.elArr=[];this.total=0}},algorithmCalcPoints:function(a,b,c,d){var e,k,f,h,l=c.lW,m=c.lH,v=c.plot,p,r=0,t=c.elArr.length-1;b?(l=c.nW,m=c.nH):p=c.elArr[c.elArr.length-1];g(c.elArr,function(a){if(b||r<t)0===c.direction?(e=v.x,k=v.y,f=l,h=a/f):(e=v.x,k=v.y,h=m,f=a/h),d.push({x:e,y:k,width:f,height:h}),0===c.direction?v.y+=h:v.x+=f;r+=1});c.reset();0===c.direction?c.width-=l:c.height-=
-m;v.y=v.parent.y+(v.parent.height-c.height);v.x=v.parent.x+(v.parent.width-c.width);a&&(c.direction=1-c.direction);b||c.addElement(p)},algorithmLowAspectRatio:function(a,b,c){var d=[],e=this,n,f={x:b.x,y:b.y,parent:b},h=0,l=c.length-1,m=new this.algorithmGroup(b.height,b.width,b.direction,f);g(c,function(c){n=c.val/b.val*b.height*b.width;m.addElement(n);m.lP.nR>m.lP.lR&&e.algorithmCalcPoints(a,!1,m,d,f);h===l&&e.algorithmCalcPoints(a,!0,m,d,f);h+=1});return d},algorithmFill:function(a,b,c){var d=
-[],e,f=b.direction,l=b.x,h=b.y,m=b.width,p=b.height,r,t,q,u;g(c,function(c){e=c.val/b.val*b.height*b.width;r=l;t=h;0===f?(u=p,q=e/u,m-=q,l+=q):(q=m,u=e/q,p-=u,h+=u);d.push({x:r,y:t,width:q,height:u});a&&(f=1-f)});return d},strip:function(a,b){return this.algorithmLowAspectRatio(!1,a,b)},squarified:function(a,b){return this.algorithmLowAspectRatio(!0,a,b)},sliceAndDice:function(a,b){return this.algorithmFill(!0,a,b)},stripes:function(a,b){return this.algorithmFill(!1,a,b)},translate:function(){var a=
-this,b=a.rootNode=f(a.rootNode,a.options.rootId,""),c,d;r.prototype.translate.call(a);a.levelMap=F(a.options.levels||[],function(a,b){a[b.level]=b;return a},{});d=a.tree=a.getTree();c=a.nodeMap[b];""===b||c&&c.children.length||(a.drillToNode("",!1),b=a.rootNode,c=a.nodeMap[b]);C(a.nodeMap[a.rootNode],function(b){var c=!1,d=b.parent;b.visible=!0;if(d||""===d)c=a.nodeMap[d];return c});C(a.nodeMap[a.rootNode].children,function(a){var b=!1;g(a,function(a){a.visible=!0;a.children.length&&(b=(b||[]).concat(a.children))});
-return b});a.setTreeValues(d);a.axisRatio=a.xAxis.len/a.yAxis.len;a.nodeMap[""].pointValues=b={x:0,y:0,width:100,height:100};a.nodeMap[""].values=b=p(b,{width:b.width*a.axisRatio,direction:"vertical"===a.options.layoutStartingDirection?0:1,val:d.val});a.calculateChildrenAreas(d,b);a.colorAxis?a.translateColors():a.options.colorByPoint||a.setColorRecursive(a.tree);a.options.allowDrillToNode&&(c=c.pointValues,a.xAxis.setExtremes(c.x,c.x+c.width,!1),a.yAxis.setExtremes(c.y,c.y+c.height,!1),a.xAxis.setScale(),
-a.yAxis.setScale());a.setPointValues()},drawDataLabels:function(){var a=this,b=w(a.points,function(a){return a.node.visible}),c,d;g(b,function(b){d=a.levelMap[b.node.levelDynamic];c={style:{}};b.node.isLeaf||(c.enabled=!1);d&&d.dataLabels&&(c=p(c,d.dataLabels),a._hasPointLabels=!0);b.shapeArgs&&(c.style.width=b.shapeArgs.width,b.dataLabel&&b.dataLabel.css({width:b.shapeArgs.width+"px"}));b.dlOptions=p(c,b.options.dataLabels)});r.prototype.drawDataLabels.call(this)},alignDataLabel:function(a){m.column.prototype.alignDataLabel.apply(this,
-arguments);a.dataLabel&&a.dataLabel.attr({zIndex:(a.node.zIndex||0)+1})},pointAttribs:function(a,b){var c=a&&this.levelMap[a.node.levelDynamic]||{},d=this.options,e=b&&d.states[b]||{},g=a&&a.getClassName()||"";a={stroke:a&&a.borderColor||c.borderColor||e.borderColor||d.borderColor,"stroke-width":f(a&&a.borderWidth,c.borderWidth,e.borderWidth,d.borderWidth),dashstyle:a&&a.borderDashStyle||c.borderDashStyle||e.borderDashStyle||d.borderDashStyle,fill:a&&a.color||this.color};-1!==g.indexOf("highcharts-above-level")?
-(a.fill="none",a["stroke-width"]=0):-1!==g.indexOf("highcharts-internal-node-interactive")?(b=f(e.opacity,d.opacity),a.fill=y(a.fill).setOpacity(b).get(),a.cursor="pointer"):-1!==g.indexOf("highcharts-internal-node")?a.fill="none":b&&(a.fill=y(a.fill).brighten(e.brightness).get());return a},drawPoints:function(){var a=this,b=w(a.points,function(a){return a.node.visible});g(b,function(b){var c="level-group-"+b.node.levelDynamic;a[c]||(a[c]=a.chart.renderer.g(c).attr({zIndex:1E3-b.node.levelDynamic}).add(a.group));
-b.group=a[c]});m.column.prototype.drawPoints.call(this);a.options.allowDrillToNode&&g(b,function(b){b.graphic&&(b.drillId=a.options.interactByLeaf?a.drillToByLeaf(b):a.drillToByGroup(b))})},onClickDrillToNode:function(a){var b=(a=a.point)&&a.drillId;A(b)&&(a.setState(""),this.drillToNode(b))},drillToByGroup:function(a){var b=!1;1!==a.node.level-this.nodeMap[this.rootNode].level||a.node.isLeaf||(b=a.id);return b},drillToByLeaf:function(a){var b=!1;if(a.node.parent!==this.rootNode&&a.node.isLeaf)for(a=
-a.node;!b;)a=this.nodeMap[a.parent],a.parent===this.rootNode&&(b=a.id);return b},drillUp:function(){var a=this.nodeMap[this.rootNode];a&&A(a.parent)&&this.drillToNode(a.parent)},drillToNode:function(a,b){var c=this.nodeMap[a];this.idPreviousRoot=this.rootNode;this.rootNode=a;""===a?this.drillUpButton=this.drillUpButton.destroy():this.showDrillUpButton(c&&c.name||a);this.isDirty=!0;f(b,!0)&&this.chart.redraw()},showDrillUpButton:function(a){var b=this;a=a||"\x3c Back";var c=b.options.drillUpButton,
-d,e;c.text&&(a=c.text);this.drillUpButton?this.drillUpButton.attr({text:a}).align():(e=(d=c.theme)&&d.states,this.drillUpButton=this.chart.renderer.button(a,null,null,function(){b.drillUp()},d,e&&e.hover,e&&e.select).attr({align:c.position.align,zIndex:7}).add().align(c.position,!1,c.relativeTo||"plotBox"))},buildKDTree:l,drawLegendSymbol:d.LegendSymbolMixin.drawRectangle,getExtremes:function(){r.prototype.getExtremes.call(this,this.colorValueData);this.valueMin=this.dataMin;this.valueMax=this.dataMax;
-r.prototype.getExtremes.call(this)},getExtremesFromAll:!0,bindAxes:function(){var a={endOnTick:!1,gridLineWidth:0,lineWidth:0,min:0,dataMin:0,minPadding:0,max:100,dataMax:100,maxPadding:0,startOnTick:!1,title:null,tickPositions:[]};r.prototype.bindAxes.call(this);d.extend(this.yAxis.options,a);d.extend(this.xAxis.options,a)},utils:{recursive:C,reduce:F}},{getClassName:function(){var a=d.Point.prototype.getClassName.call(this),b=this.series,c=b.options;this.node.level<=b.nodeMap[b.rootNode].level?
-a+=" highcharts-above-level":this.node.isLeaf||f(c.interactByLeaf,!c.allowDrillToNode)?this.node.isLeaf||(a+=" highcharts-internal-node"):a+=" highcharts-internal-node-interactive";return a},isValid:function(){return this.id||q(this.value)},setState:function(a){d.Point.prototype.setState.call(this,a);this.graphic&&this.graphic.attr({zIndex:"hover"===a?1:0})},setVisible:m.pie.prototype.pointClass.prototype.setVisible})})(u,E)});
+(function(a){if(typeof module==='object'&&module.exports){module.exports=a;}else{a(Highcharts);}}(function(a){var b=(function(a){var e=a.each,b=a.extend,d=function(a){return typeof a==='boolean';},g=function(a){return typeof a==='function';},c=a.pick;var f=function u(g,e){var o=e.index,p=e.levelMap,n=e.parentColor,q=e.parentColorIndex,h=e.series,l=e.colors,s=e.siblings,r=h.points,m,f,b,j,i,k;var t=function(d){var c=b&&b.colorVariation;if(c&&c.key==='brightness'){return a.color(d).brighten(o/s*c.to).get();
+}return d;};if(g){f=r[g.i];b=p[g.levelDynamic]||{};m=f&&(d(b.colorByPoint)?b.colorByPoint:!!h.options.colorByPoint);if(m){j=l[f.index%l.length];}i=c(f&&f.options.color,b&&b.color,j,n&&t(n),h.color);k=c(f&&f.options.colorIndex,b&&b.colorIndex,q,e.colorIndex);}return{color:i,colorIndex:k};};var h=function s(a,f){var j=f.before,l=f.idRoot,o=f.mapIdToNode,p=o[l],n=(d(f.levelIsConstant)?f.levelIsConstant:true),r=f.points,i=r[a.i],q=(i&&i.options)||{},h=0,k=[],m;b(a,{levelDynamic:a.level-(n?0:p.level),
+name:c(i&&i.name,''),visible:(l===a.id||(d(f.visible)?f.visible:false))});if(g(j)){a=j(a,f);}e(a.children,function(c,e){var d=b({},f);b(d,{index:e,siblings:a.children.length,visible:a.visible});c=s(c,d);k.push(c);if(c.visible){h+=c.val;}});a.visible=h>0||a.visible;m=c(q.value,h);b(a,{children:k,childrenTotal:h,isLeaf:a.visible&&!h,val:m});return a;};return{getColor:f,setTreeValues:h};}(a));(function(a,t){var u=a.seriesType,d=a.seriesTypes,n=a.map,f=a.merge,h=a.extend,o=a.noop,b=a.each,q=t.getColor,
+i=a.grep,r=a.isNumber,j=a.isString,c=a.pick,e=a.Series,v=a.stableSort,m=a.Color,p=function(c,d,b){b=b||this;a.objectEach(c,function(e,a){d.call(b,e,a,c);});},l=a.reduce,g=function(d,c,a){var b;a=a||this;b=c.call(a,d);if(b!==false){g(b,c,a);}},k;function s(a,b){if(a===b){return a!==0||1/a===1/b;}return a!==a&&b!==b;}u('treemap','scatter',{showInLegend:false,marker:false,dataLabels:{enabled:true,defer:false,verticalAlign:'middle',formatter:function(){return this.point.name||this.point.id;},inside:true},
+tooltip:{headerFormat:'',pointFormat:'<b>{point.name}</b>: {point.value}<br/>'},ignoreHiddenPoint:true,layoutAlgorithm:'sliceAndDice',layoutStartingDirection:'vertical',alternateStartingDirection:false,levelIsConstant:true,drillUpButton:{position:{align:'right',x:-10,y:10}},borderColor:'#e6e6e6',borderWidth:1,opacity:0.15,states:{hover:{borderColor:'#999999',brightness:d.heatmap?0:0.1,halo:false,opacity:0.75,shadow:false}}},{pointArrayMap:['value'],axisTypes:d.heatmap?['xAxis','yAxis','colorAxis']:['xAxis',
+'yAxis'],directTouch:true,optionalAxis:'colorAxis',getSymbol:o,parallelArrays:['x','y','value','colorValue'],colorKey:'colorValue',translateColors:(d.heatmap&&d.heatmap.prototype.translateColors),colorAttribs:(d.heatmap&&d.heatmap.prototype.colorAttribs),trackerGroups:['group','dataLabelsGroup'],getListOfParents:function(e,f){var d=l(e||[],function(a,d,e){var b=c(d.parent,'');if(a[b]===undefined){a[b]=[];}a[b].push(e);return a;},{}),a={};b(f,function(b){if(j(b)){a['#'+b]=true;}});p(d,function(e,
+c,d){if(c!==''&&!a['#'+c]){b(e,function(a){d[''].push(a);});delete d[c];}});return d;},getTree:function(){var c=this,a=c.data,d=c.treeIndex,f=d&&d.ids.length===a.length,e,b;for(b=0;f&&b<a.length;b++){f=(a[b].id===d.ids[b]&&a[b].parent===d.parents[b]);}if(!f){e=n(a,function(a){return a.id;});d=c.treeIndex={ids:e,parents:n(a,function(a){return a.parent;}),listOfParents:c.getListOfParents(a,e)};c.childrenAreas={};}c.nodeMap=[];return c.buildNode('',-1,0,d.listOfParents,null);},init:function(c,d){var b=this;
+e.prototype.init.call(b,c,d);if(b.options.allowDrillToNode){a.addEvent(b,'click',b.onClickDrillToNode);}},buildNode:function(f,h,i,j,l){var c=this,g=[],k=c.points[h],e=0,a,d;b((j[f]||[]),function(a){d=c.buildNode(c.points[a].id,a,(i+1),j,f);e=Math.max(d.height+1,e);g.push(d);});a={id:f,i:h,children:g,height:e,level:i,parent:l,visible:false};c.nodeMap[a.id]=a;if(k){k.node=a;}return a;},setTreeValues:function(d){var e=this,j=e.options,k=e.rootNode,m=e.nodeMap,n=m[k],l=(typeof j.levelIsConstant==='boolean'?j.levelIsConstant:true),
+g=0,i=[],f,a=e.points[d.i];b(d.children,function(a){a=e.setTreeValues(a);i.push(a);if(!a.ignore){g+=a.val;}});v(i,function(a,b){return a.sortIndex-b.sortIndex;});f=c(a&&a.options.value,g);if(a){a.value=f;}h(d,{children:i,childrenTotal:g,ignore:!(c(a&&a.visible,true)&&(f>0)),isLeaf:d.visible&&!g,levelDynamic:(d.level-(l?0:n.level)),name:c(a&&a.name,''),sortIndex:c(a&&a.sortIndex,-f),val:f});return d;},calculateChildrenAreas:function(o,d){var e=this,t=e.options,j=this.levelMap[o.levelDynamic+1],n=c((e[j&&j.layoutAlgorithm]&&j.layoutAlgorithm),
+t.layoutAlgorithm),p=t.alternateStartingDirection,q=e.childrenAreas||(e.childrenAreas={}),a=q[o.i],r=[],l,g,m;l=i(o.children,function(a){return!a.ignore;});if(j&&j.layoutStartingDirection){d.direction=(j.layoutStartingDirection==='vertical'?0:1);}g=[n,p,e.axisRatio,d.x,d.y,d.width,d.height,d.direction,d.val];b(l,function(a){g.push(a.i,a.val,a.childrenTotal);});if(a&&a.inputs.length!==g.length){a=false;}for(m=0;a&&m<g.length;m++){if(!s(a.inputs[m],g[m])){a=false;}}if(!a){a={inputs:g,values:[],pointValues:[]};
+r=e[n](d,l);b(l,function(c,g){var b=r[g];a.values.push(f(b,{val:c.childrenTotal,direction:(p?1-d.direction:d.direction)}));a.pointValues.push(f(b,{x:(b.x/e.axisRatio),width:(b.width/e.axisRatio)}));});if(e[n]===k[n]){q[o.i]=a;}}b(l,function(b,c){b.values=h({},a.values[c]);b.pointValues=h({},a.pointValues[c]);if(b.children.length&&b.visible){e.calculateChildrenAreas(b,b.values);}});},setPointValues:function(){var a=this,c=a.xAxis,d=a.yAxis;b(a.points,function(b){var k=b.node,e=k.pointValues,g,h,i,
+j,f;if(e&&k.visible){f=((a.pointAttribs(b)['stroke-width']||0)%2)/2;g=Math.round(c.translate(e.x,0,0,0,1))-f;h=Math.round(c.translate(e.x+e.width,0,0,0,1))-f;i=Math.round(d.translate(e.y,0,0,0,1))-f;j=Math.round(d.translate(e.y+e.height,0,0,0,1))-f;b.shapeType='rect';b.shapeArgs={x:Math.min(g,h),y:Math.min(i,j),width:Math.abs(h-g),height:Math.abs(j-i)};b.plotX=(b.shapeArgs.x+(b.shapeArgs.width/2));b.plotY=(b.shapeArgs.y+(b.shapeArgs.height/2));}else{delete b.plotX;delete b.plotY;}});},setColorRecursive:function(d,
+j,g,i,k){var a=this,f=a&&a.chart,h=f&&f.options&&f.options.colors,c,e;if(d){c=q(d,{colors:h,index:i,levelMap:a.levelMap,parentColor:j,parentColorIndex:g,series:a,siblings:k});e=a.points[d.i];if(e){e.color=c.color;e.colorIndex=c.colorIndex;}b(d.children||[],function(b,e){a.setColorRecursive(b,c.color,c.colorIndex,e,d.children.length);});}},algorithmGroup:function(b,d,a,c){this.height=b;this.width=d;this.plot=c;this.direction=a;this.startDirection=a;this.total=0;this.nW=0;this.lW=0;this.nH=0;this.lH=0;
+this.elArr=[];this.lP={total:0,lH:0,nH:0,lW:0,nW:0,nR:0,lR:0,aspectRatio:function(b,a){return Math.max((b/a),(a/b));}};this.addElement=function(a){this.lP.total=this.elArr[this.elArr.length-1];this.total=this.total+a;if(this.direction===0){this.lW=this.nW;this.lP.lH=this.lP.total/this.lW;this.lP.lR=this.lP.aspectRatio(this.lW,this.lP.lH);this.nW=this.total/this.height;this.lP.nH=this.lP.total/this.nW;this.lP.nR=this.lP.aspectRatio(this.nW,this.lP.nH);}else{this.lH=this.nH;this.lP.lW=this.lP.total/this.lH;
+this.lP.lR=this.lP.aspectRatio(this.lP.lW,this.lH);this.nH=this.total/this.width;this.lP.nW=this.lP.total/this.nH;this.lP.nR=this.lP.aspectRatio(this.lP.nW,this.nH);}this.elArr.push(a);};this.reset=function(){this.nW=0;this.lW=0;this.elArr=[];this.total=0;};},algorithmCalcPoints:function(n,i,a,m){var j,k,e,d,g=a.lW,f=a.lH,c=a.plot,l,h=0,o=a.elArr.length-1;if(i){g=a.nW;f=a.nH;}else{l=a.elArr[a.elArr.length-1];}b(a.elArr,function(b){if(i||(h<o)){if(a.direction===0){j=c.x;k=c.y;e=g;d=b/e;}else{j=c.x;
+k=c.y;d=f;e=b/d;}m.push({x:j,y:k,width:e,height:d});if(a.direction===0){c.y=c.y+d;}else{c.x=c.x+e;}}h=h+1;});a.reset();if(a.direction===0){a.width=a.width-g;}else{a.height=a.height-f;}c.y=c.parent.y+(c.parent.height-a.height);c.x=c.parent.x+(c.parent.width-a.width);if(n){a.direction=1-a.direction;}if(!i){a.addElement(l);}},algorithmLowAspectRatio:function(h,a,g){var d=[],j=this,i,f={x:a.x,y:a.y,parent:a},k=a.direction,e=0,l=g.length-1,c=new this.algorithmGroup(a.height,a.width,k,f);b(g,function(b){i=b.val/a.val*a.height*a.width;
+c.addElement(i);if(c.lP.nR>c.lP.lR){j.algorithmCalcPoints(h,false,c,d,f);}if(e===l){j.algorithmCalcPoints(h,true,c,d,f);}e=e+1;});return d;},algorithmFill:function(o,a,n){var k=[],g,e=a.direction,i=a.x,j=a.y,h=a.width,f=a.height,l,m,d,c;b(n,function(b){g=b.val/a.val*a.height*a.width;l=i;m=j;if(e===0){c=f;d=g/c;h=h-d;i=i+d;}else{d=h;c=g/d;f=f-c;j=j+c;}k.push({x:l,y:m,width:d,height:c});if(o){e=1-e;}});return k;},strip:function(b,a){return this.algorithmLowAspectRatio(false,b,a);},squarified:function(b,
+a){return this.algorithmLowAspectRatio(true,b,a);},sliceAndDice:function(b,a){return this.algorithmFill(true,b,a);},stripes:function(b,a){return this.algorithmFill(false,b,a);},translate:function(){var a=this,i=a.rootNode=c(a.rootNode,a.options.rootId,''),h,k,m,j,d;e.prototype.translate.call(a);a.levelMap=l(a.options.levels||[],function(a,b){a[b.level]=b;return a;},{});j=a.tree=a.getTree();h=a.nodeMap[i];if(i!==''&&(!h||!h.children.length)){a.drillToNode('',false);i=a.rootNode;h=a.nodeMap[i];}g(a.nodeMap[a.rootNode],
+function(d){var c=false,b=d.parent;d.visible=true;if(b||b===''){c=a.nodeMap[b];}return c;});g(a.nodeMap[a.rootNode].children,function(c){var a=false;b(c,function(b){var c;b.visible=true;if(b.children.length){a=a||[];for(c=0;c<b.children.length;c++){a.push(b.children[c]);}}});return a;});a.setTreeValues(j);a.axisRatio=(a.xAxis.len/a.yAxis.len);a.nodeMap[''].pointValues=k={x:0,y:0,width:100,height:100};a.nodeMap[''].values=m=f(k,{width:(k.width*a.axisRatio),direction:(a.options.layoutStartingDirection==='vertical'?0:1),
+val:j.val});a.calculateChildrenAreas(j,m);if(a.colorAxis){a.translateColors();}else if(!a.options.colorByPoint){a.setColorRecursive(a.tree);}if(a.options.allowDrillToNode){d=h.pointValues;a.xAxis.setExtremes(d.x,d.x+d.width,false);a.yAxis.setExtremes(d.y,d.y+d.height,false);a.xAxis.setScale();a.yAxis.setScale();}a.setPointValues();},drawDataLabels:function(){var d=this,g=i(d.points,function(a){return a.node.visible;}),a,c;b(g,function(b){c=d.levelMap[b.node.levelDynamic];a={style:{}};if(!b.node.isLeaf){a.enabled=false;
+}if(c&&c.dataLabels){a=f(a,c.dataLabels);d._hasPointLabels=true;}if(b.shapeArgs){a.style.width=b.shapeArgs.width;if(b.dataLabel){b.dataLabel.css({width:b.shapeArgs.width+'px'});}}b.dlOptions=f(a,b.options.dataLabels);});e.prototype.drawDataLabels.call(this);},alignDataLabel:function(a){d.column.prototype.alignDataLabel.apply(this,arguments);if(a.dataLabel){a.dataLabel.attr({zIndex:(a.node.zIndex||0)+1});}},pointAttribs:function(a,h){var g=(a&&this.levelMap[a.node.levelDynamic])||{},d=this.options,
+b,e=(h&&d.states[h])||{},f=(a&&a.getClassName())||'',i;b={'stroke':(a&&a.borderColor)||g.borderColor||e.borderColor||d.borderColor,'stroke-width':c(a&&a.borderWidth,g.borderWidth,e.borderWidth,d.borderWidth),'dashstyle':(a&&a.borderDashStyle)||g.borderDashStyle||e.borderDashStyle||d.borderDashStyle,'fill':(a&&a.color)||this.color};if(f.indexOf('highcharts-above-level')!==-1){b.fill='none';b['stroke-width']=0;}else if(f.indexOf('highcharts-internal-node-interactive')!==-1){i=c(e.opacity,d.opacity);
+b.fill=m(b.fill).setOpacity(i).get();b.cursor='pointer';}else if(f.indexOf('highcharts-internal-node')!==-1){b.fill='none';}else if(h){b.fill=m(b.fill).brighten(e.brightness).get();}return b;},drawPoints:function(){var a=this,c=i(a.points,function(a){return a.node.visible;});b(c,function(c){var b='level-group-'+c.node.levelDynamic;if(!a[b]){a[b]=a.chart.renderer.g(b).attr({zIndex:1000-c.node.levelDynamic}).add(a.group);}c.group=a[b];});d.column.prototype.drawPoints.call(this);if(a.options.allowDrillToNode){b(c,
+function(b){if(b.graphic){b.drillId=a.options.interactByLeaf?a.drillToByLeaf(b):a.drillToByGroup(b);}});}},onClickDrillToNode:function(c){var d=this,a=c.point,b=a&&a.drillId;if(j(b)){a.setState('');d.drillToNode(b);}},drillToByGroup:function(a){var c=this,b=false;if((a.node.level-c.nodeMap[c.rootNode].level)===1&&!a.node.isLeaf){b=a.id;}return b;},drillToByLeaf:function(c){var d=this,b=false,a;if((c.node.parent!==d.rootNode)&&c.node.isLeaf){a=c.node;while(!b){a=d.nodeMap[a.parent];if(a.parent===d.rootNode){b=a.id;
+}}}return b;},drillUp:function(){var b=this,a=b.nodeMap[b.rootNode];if(a&&j(a.parent)){b.drillToNode(a.parent);}},drillToNode:function(b,f){var a=this,e=a.nodeMap,d=e[b];a.idPreviousRoot=a.rootNode;a.rootNode=b;if(b===''){a.drillUpButton=a.drillUpButton.destroy();}else{a.showDrillUpButton((d&&d.name||b));}this.isDirty=true;if(c(f,true)){this.chart.redraw();}},showDrillUpButton:function(f){var e=this,d=(f||'< Back'),a=e.options.drillUpButton,c,b;if(a.text){d=a.text;}if(!this.drillUpButton){c=a.theme;
+b=c&&c.states;this.drillUpButton=this.chart.renderer.button(d,null,null,function(){e.drillUp();},c,b&&b.hover,b&&b.select).attr({align:a.position.align,zIndex:7}).add().align(a.position,false,a.relativeTo||'plotBox');}else{this.drillUpButton.attr({text:d}).align();}},buildKDTree:o,drawLegendSymbol:a.LegendSymbolMixin.drawRectangle,getExtremes:function(){e.prototype.getExtremes.call(this,this.colorValueData);this.valueMin=this.dataMin;this.valueMax=this.dataMax;e.prototype.getExtremes.call(this);
+},getExtremesFromAll:true,bindAxes:function(){var b={endOnTick:false,gridLineWidth:0,lineWidth:0,min:0,dataMin:0,minPadding:0,max:100,dataMax:100,maxPadding:0,startOnTick:false,title:null,tickPositions:[]};e.prototype.bindAxes.call(this);a.extend(this.yAxis.options,b);a.extend(this.xAxis.options,b);},utils:{recursive:g,reduce:l}},{getClassName:function(){var b=a.Point.prototype.getClassName.call(this),d=this.series,e=d.options;if(this.node.level<=d.nodeMap[d.rootNode].level){b+=' highcharts-above-level';
+}else if(!this.node.isLeaf&&!c(e.interactByLeaf,!e.allowDrillToNode)){b+=' highcharts-internal-node-interactive';}else if(!this.node.isLeaf){b+=' highcharts-internal-node';}return b;},isValid:function(){return this.id||r(this.value);},setState:function(b){a.Point.prototype.setState.call(this,b);if(this.graphic){this.graphic.attr({zIndex:b==='hover'?1:0});}},setVisible:d.pie.prototype.pointClass.prototype.setVisible});k={};b(['sliceAndDice','stripes','squarified','strip'],function(a){k[a]=d.treemap.prototype[a];
+});}(a,b));}));
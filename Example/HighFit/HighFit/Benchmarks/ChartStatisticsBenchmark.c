@@ -0,0 +1,163 @@
+//
+//  ChartStatisticsBenchmark.c
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+//  Times the statistics over a column against plain loops and qsort, and checks that they agree.
+//  Not part of the app target, build it on its own, on Linux or macOS:
+//
+//    cc -O2 -I../HighFit ChartStatisticsBenchmark.c ../HighFit/ChartStatistics.c -o benchmark -lm
+//    ./benchmark [values]
+//
+//  Add -DCHART_STATISTICS_NO_SIMD to time the portable paths.
+//
+
+#include "ChartStatistics.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double BenchmarkNow(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static unsigned long BenchmarkRandom(unsigned long *state)
+{
+    *state = *state * 6364136223846793005UL + 1442695040888963407UL;
+    return *state >> 33;
+}
+
+static void BenchmarkReport(const char *name, size_t count, double seconds, size_t mismatches)
+{
+    printf("%-28s %8.1f ms %8.1f M values/s", name, seconds * 1e3, (double)count / seconds / 1e6);
+    if (mismatches != (size_t)-1) {
+        printf("  %zu mismatches", mismatches);
+    }
+    printf("\n");
+}
+
+// Sums of the same values in another order agree to a few units in the last place
+static size_t BenchmarkDiffers(double a, double b)
+{
+    return fabs(a - b) <= 1e-12 * fmax(1, fmax(fabs(a), fabs(b))) ? 0 : 1;
+}
+
+static int BenchmarkCompare(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return x < y ? -1 : x > y;
+}
+
+static double BenchmarkQuantile(const double *sorted, size_t count, double p)
+{
+    double position = (double)(count - 1) * p;
+    size_t rank = (size_t)floor(position);
+    return rank + 1 < count ?
+        sorted[rank] + (position - (double)rank) * (sorted[rank + 1] - sorted[rank]) :
+        sorted[rank];
+}
+
+int main(int argc, char **argv)
+{
+    size_t count = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 10000000;
+    double *values = malloc(count * sizeof(double));
+    double *sorted = malloc(count * sizeof(double));
+    unsigned long state = 42;
+    ChartStatsSummary summary, expected = { 0, 0, INFINITY, -INFINITY };
+    ChartHistogramBins bins;
+    ChartStatsBox box;
+    size_t *counts, i, numbers = 0, mismatches;
+    double start, mean, deviation, squares = 0;
+
+    if (!values || !sorted || !count) {
+        return 1;
+    }
+#if defined(CHART_STATISTICS_NO_SIMD)
+    printf("%zu values, portable paths\n", count);
+#else
+    printf("%zu values\n", count);
+#endif
+
+    // Roughly normal values from sums of uniform ones, with a few empty cells
+    for (i = 0; i < count; i++) {
+        double sum = 0;
+        int k;
+        for (k = 0; k < 4; k++) {
+            sum += (double)BenchmarkRandom(&state) / 2147483648.0;
+        }
+        values[i] = BenchmarkRandom(&state) % 100 == 0 ? NAN : (sum - 2) * 250 + 1000;
+    }
+
+    start = BenchmarkNow();
+    for (i = 0; i < count; i++) {
+        if (!isnan(values[i])) {
+            expected.count++;
+            expected.sum += values[i];
+            expected.min = fmin(expected.min, values[i]);
+            expected.max = fmax(expected.max, values[i]);
+        }
+    }
+    BenchmarkReport("loop summary", count, BenchmarkNow() - start, (size_t)-1);
+
+    start = BenchmarkNow();
+    summary = ChartStatsSummarize(values, count);
+    BenchmarkReport("ChartStatsSummarize", count, BenchmarkNow() - start,
+                    (summary.count != expected.count) + BenchmarkDiffers(summary.sum, expected.sum) +
+                    (summary.min != expected.min) + (summary.max != expected.max));
+
+    mean = summary.sum / (double)summary.count;
+    start = BenchmarkNow();
+    for (i = 0; i < count; i++) {
+        if (!isnan(values[i])) {
+            squares += (values[i] - mean) * (values[i] - mean);
+            numbers++;
+        }
+    }
+    BenchmarkReport("loop deviation", count, BenchmarkNow() - start, (size_t)-1);
+
+    start = BenchmarkNow();
+    deviation = ChartStatsStandardDeviation(values, count, mean);
+    BenchmarkReport("ChartStatsStandardDeviation", count, BenchmarkNow() - start,
+                    BenchmarkDiffers(deviation, sqrt(squares / (double)(numbers - 1))));
+
+    ChartStatsHistogramBins(summary, ChartStatsBinsNumber(ChartBinsRuleSturges, count), 0, &bins);
+    counts = malloc(bins.count * sizeof(size_t));
+    start = BenchmarkNow();
+    ChartStatsHistogramCount(values, count, bins, counts);
+    numbers = 0;
+    for (i = 0; i < bins.count; i++) {
+        numbers += counts[i];
+    }
+    BenchmarkReport("ChartStatsHistogramCount", count, BenchmarkNow() - start, numbers != summary.count);
+    free(counts);
+
+    start = BenchmarkNow();
+    ChartStatsBoxplot(values, count, &box);
+    BenchmarkReport("ChartStatsBoxplot", count, BenchmarkNow() - start, (size_t)-1);
+
+    numbers = 0;
+    for (i = 0; i < count; i++) {
+        if (!isnan(values[i])) {
+            sorted[numbers++] = values[i];
+        }
+    }
+    start = BenchmarkNow();
+    qsort(sorted, numbers, sizeof(double), BenchmarkCompare);
+    mismatches = (box.low != sorted[0]) + (box.high != sorted[numbers - 1]) +
+        (box.q1 != BenchmarkQuantile(sorted, numbers, 0.25)) +
+        (box.median != BenchmarkQuantile(sorted, numbers, 0.5)) +
+        (box.q3 != BenchmarkQuantile(sorted, numbers, 0.75));
+    BenchmarkReport("qsort quartiles", count, BenchmarkNow() - start, mismatches);
+
+    free(values);
+    free(sorted);
+    return 0;
+}
@@ -0,0 +1,241 @@
+//
+//  ChartValueParserBenchmark.c
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+//  Times the number and date parsers against strtod and sscanf, and checks that they agree.
+//  Not part of the app target, build it on its own, on Linux or macOS:
+//
+//    cc -O2 -I../HighFit ChartValueParserBenchmark.c ../HighFit/ChartValueParser.c -o benchmark -lm
+//    ./benchmark [cells]
+//
+//  Add -DCHART_VALUE_PARSER_NO_SIMD to time the portable paths.
+//
+
+#include "ChartValueParser.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+typedef struct {
+    char *bytes;
+    const char **cells;
+    size_t *lengths;
+    double *expected;
+    size_t count;
+} BenchmarkColumn;
+
+static double BenchmarkNow(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static unsigned long BenchmarkRandom(unsigned long *state)
+{
+    *state = *state * 6364136223846793005UL + 1442695040888963407UL;
+    return *state >> 33;
+}
+
+static void BenchmarkColumnInit(BenchmarkColumn *column, size_t count, size_t width)
+{
+    column->bytes = malloc(count * width);
+    column->cells = malloc(count * sizeof(char *));
+    column->lengths = malloc(count * sizeof(size_t));
+    column->expected = malloc(count * sizeof(double));
+    column->count = count;
+}
+
+static void BenchmarkColumnFree(BenchmarkColumn *column)
+{
+    free(column->bytes);
+    free(column->cells);
+    free(column->lengths);
+    free(column->expected);
+}
+
+// Numbers shaped like exported measurements, with decimalPoint as separator
+static void BenchmarkNumbers(BenchmarkColumn *column, size_t count, char decimalPoint)
+{
+    unsigned long state = 42;
+    size_t i;
+
+    BenchmarkColumnInit(column, count, 32);
+    for (i = 0; i < count; i++) {
+        char *cell = column->bytes + i * 32;
+        long integer = (long)(BenchmarkRandom(&state) % 1000000) - 500000;
+        unsigned long fraction = BenchmarkRandom(&state) % 10000;
+        int length;
+
+        if (i % 4 == 0) {
+            length = snprintf(cell, 32, "%ld", integer);
+        }
+        else {
+            length = snprintf(cell, 32, "%ld%c%04lu", integer, decimalPoint, fraction);
+        }
+        column->cells[i] = cell;
+        column->lengths[i] = (size_t)length;
+
+        char reference[32];
+        memcpy(reference, cell, (size_t)length + 1);
+        char *separator = strchr(reference, decimalPoint);
+        if (separator) {
+            *separator = '.';
+        }
+        column->expected[i] = strtod(reference, NULL);
+    }
+}
+
+static void BenchmarkDates(BenchmarkColumn *column, size_t count, ChartDateFormat format)
+{
+    unsigned long state = 7;
+    size_t i;
+
+    BenchmarkColumnInit(column, count, 16);
+    for (i = 0; i < count; i++) {
+        char *cell = column->bytes + i * 16;
+        long year = 2000 + (long)(BenchmarkRandom(&state) % 17);
+        long month = 1 + (long)(BenchmarkRandom(&state) % 12);
+        long day = 1 + (long)(BenchmarkRandom(&state) % 28);
+        int length = 0;
+
+        switch (format) {
+            case ChartDateFormatYYYYmmdd:
+                length = snprintf(cell, 16, "%04ld-%02ld-%02ld", year, month, day);
+                break;
+            case ChartDateFormatddmmYYYY:
+                length = snprintf(cell, 16, "%02ld/%02ld/%04ld", day, month, year);
+                break;
+            case ChartDateFormatmmddYYYY:
+                length = snprintf(cell, 16, "%02ld/%02ld/%04ld", month, day, year);
+                break;
+            case ChartDateFormatddmmYY:
+                length = snprintf(cell, 16, "%02ld/%02ld/%02ld", day, month, year % 100);
+                break;
+            case ChartDateFormatmmddYY:
+                length = snprintf(cell, 16, "%02ld/%02ld/%02ld", month, day, year % 100);
+                break;
+            default:
+                break;
+        }
+        column->cells[i] = cell;
+        column->lengths[i] = (size_t)length;
+        column->expected[i] = ChartDateUTC(year, month - 1, day);
+    }
+}
+
+static size_t BenchmarkMismatches(const BenchmarkColumn *column, const double *values)
+{
+    size_t mismatches = 0;
+    size_t i;
+
+    for (i = 0; i < column->count; i++) {
+        if (values[i] != column->expected[i]) {
+            if (mismatches < 3) {
+                fprintf(stderr, "  %.*s: %.17g, expected %.17g\n", (int)column->lengths[i], column->cells[i], values[i], column->expected[i]);
+            }
+            mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+static void BenchmarkReport(const char *name, size_t count, double seconds, size_t mismatches)
+{
+    printf("%-28s %8.1f ms %8.1f M cells/s", name, seconds * 1e3, (double)count / seconds / 1e6);
+    if (mismatches != (size_t)-1) {
+        printf("  %zu mismatches", mismatches);
+    }
+    printf("\n");
+}
+
+static void BenchmarkNumberColumn(size_t count, char decimalPoint)
+{
+    BenchmarkColumn column;
+    double *values = malloc(count * sizeof(double));
+    char name[32];
+    double start;
+    size_t i;
+
+    BenchmarkNumbers(&column, count, decimalPoint);
+
+    start = BenchmarkNow();
+    ChartParseNumbers(column.cells, column.lengths, count, decimalPoint, values);
+    snprintf(name, sizeof(name), "ChartParseNumbers '%c'", decimalPoint);
+    BenchmarkReport(name, count, BenchmarkNow() - start, BenchmarkMismatches(&column, values));
+
+    if (decimalPoint == '.') {
+        start = BenchmarkNow();
+        for (i = 0; i < count; i++) {
+            values[i] = strtod(column.cells[i], NULL);
+        }
+        BenchmarkReport("strtod", count, BenchmarkNow() - start, (size_t)-1);
+    }
+
+    free(values);
+    BenchmarkColumnFree(&column);
+}
+
+static void BenchmarkDateColumn(size_t count, ChartDateFormat format, const char *formatName)
+{
+    BenchmarkColumn column;
+    double *values = malloc(count * sizeof(double));
+    char name[32];
+    double start;
+    size_t i;
+
+    BenchmarkDates(&column, count, format);
+
+    start = BenchmarkNow();
+    ChartParseDates(column.cells, column.lengths, count, format, values);
+    snprintf(name, sizeof(name), "ChartParseDates %s", formatName);
+    // Two digit years depend on the current year, so only the others are compared
+    BenchmarkReport(name, count, BenchmarkNow() - start,
+                    format == ChartDateFormatddmmYY ? (size_t)-1 : BenchmarkMismatches(&column, values));
+
+    if (format == ChartDateFormatYYYYmmdd) {
+        start = BenchmarkNow();
+        for (i = 0; i < count; i++) {
+            int year, month, day;
+            sscanf(column.cells[i], "%d-%d-%d", &year, &month, &day);
+            values[i] = ChartDateUTC(year, month - 1, day);
+        }
+        BenchmarkReport("sscanf", count, BenchmarkNow() - start, (size_t)-1);
+
+        start = BenchmarkNow();
+        ChartDateFormat whole = ChartDetectDateFormat(column.cells, column.lengths, count);
+        BenchmarkReport("detect, whole column", count, BenchmarkNow() - start, (size_t)-1);
+
+        start = BenchmarkNow();
+        ChartDateFormat sampled = ChartDetectColumnDateFormat(column.cells, column.lengths, count, 256);
+        BenchmarkReport("detect, 256 cell sample", count, BenchmarkNow() - start, whole == sampled ? 0 : 1);
+    }
+
+    free(values);
+    BenchmarkColumnFree(&column);
+}
+
+int main(int argc, char **argv)
+{
+    size_t count = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 2000000;
+
+#if defined(CHART_VALUE_PARSER_NO_SIMD)
+    printf("%zu cells, portable paths\n", count);
+#else
+    printf("%zu cells\n", count);
+#endif
+    BenchmarkNumberColumn(count, '.');
+    BenchmarkNumberColumn(count, ',');
+    BenchmarkDateColumn(count, ChartDateFormatYYYYmmdd, "YYYY-mm-dd");
+    BenchmarkDateColumn(count, ChartDateFormatddmmYYYY, "dd/mm/YYYY");
+    BenchmarkDateColumn(count, ChartDateFormatmmddYYYY, "mm/dd/YYYY");
+    BenchmarkDateColumn(count, ChartDateFormatddmmYY, "dd/mm/YY");
+    BenchmarkDateColumn(count, ChartDateFormatmmddYY, "mm/dd/YY");
+    return 0;
+}
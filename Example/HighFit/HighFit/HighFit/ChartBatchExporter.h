@@ -0,0 +1,118 @@
+//
+//  ChartBatchExporter.h
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+#import <Highcharts/Highcharts.h>
+#import "HIChartView+Export.h"
+
+/**
+ *  A chart to render and the file to write it to.
+ */
+@interface ChartExportJob : NSObject
+
+- (instancetype)initWithOptions:(HIOptions*)options size:(CGSize)size format:(ChartImageFormat)format URL:(NSURL*)url;
+- (instancetype)initWithParams:(NSDictionary*)params size:(CGSize)size format:(ChartImageFormat)format URL:(NSURL*)url;
+
+/**
+ *  Reads the jobs of a manifest, the JSON file Tools/chart-batch-export.js renders off the device:
+ *
+ *    { "plugins": ["exporting"],
+ *      "jobs": [{ "options": {...}, "width": 600, "height": 400, "format": "pdf", "scale": 2, "output": "a.pdf" }] }
+ *
+ *  Formats are png, jpeg, pdf and svg, and outputs are relative to the manifest. The plugins of
+ *  the manifest are returned in plugins, which may be NULL.
+ */
++ (NSArray<ChartExportJob*>*)jobsWithManifestURL:(NSURL*)url plugins:(NSArray<NSString*>**)plugins error:(NSError**)error;
+
+/**
+ *  The serialized options, functions given as HIFunction or as strings of their source.
+ */
+@property (strong, nonatomic, readonly) NSDictionary *params;
+@property (assign, nonatomic, readonly) CGSize size;
+@property (assign, nonatomic, readonly) ChartImageFormat format;
+@property (strong, nonatomic, readonly) NSURL *URL;
+
+/**
+ *  Pixels per point of PNG and JPEG output. Defaults to 2.
+ */
+@property (assign, nonatomic) CGFloat scale;
+
+@end
+
+/**
+ *  Throughput of a batch.
+ */
+@interface ChartBatchMetrics : NSObject
+
+@property (assign, nonatomic, readonly) NSUInteger exportedCount;
+@property (assign, nonatomic, readonly) NSUInteger failedCount;
+@property (assign, nonatomic, readonly) NSUInteger pageCount;
+
+/**
+ *  From the start of the batch to its last file.
+ */
+@property (assign, nonatomic, readonly) NSTimeInterval elapsedTime;
+@property (assign, nonatomic, readonly) double chartsPerSecond;
+
+/**
+ *  Mean time a page takes to build a chart and return its SVG.
+ */
+@property (assign, nonatomic, readonly) NSTimeInterval averageRenderTime;
+
+/**
+ *  Mean time to rasterize or encode and write a file, off the main queue.
+ */
+@property (assign, nonatomic, readonly) NSTimeInterval averageEncodeTime;
+
+@property (assign, nonatomic, readonly) unsigned long long outputBytes;
+
+@end
+
+/**
+ *  Renders charts to files without showing them. A small pool of chart pages is loaded once and
+ *  every page renders one job after another: a job replaces the chart of the page by script
+ *  instead of reloading it, and the SVG the page returns is encoded with ChartSVGRenderer on a
+ *  background queue while the page moves on to the next job. The pages live in an off-screen
+ *  window, so no view controller has to host them.
+ *  Methods are called on the main queue.
+ */
+@interface ChartBatchExporter : NSObject
+
+/**
+ *  Creates an exporter with pageCount pages, which render concurrently. 2 to 4 pages keep the
+ *  encoding queue busy without loading too many web processes.
+ */
+- (instancetype)initWithPageCount:(NSUInteger)pageCount;
+
+@property (assign, nonatomic, readonly) NSUInteger pageCount;
+
+/**
+ *  Modules the pages load, as the plugins of a chart view. Pages load with the first batch, so
+ *  set them before exporting.
+ */
+@property (strong, nonatomic) NSArray<NSString*> *plugins;
+
+/**
+ *  How long a page may take to load or render a job before the job fails and the page is
+ *  reloaded. Defaults to 30 seconds.
+ */
+@property (assign, nonatomic) NSTimeInterval timeout;
+
+/**
+ *  Queues jobs as one batch, after the batches queued before it. The returned progress counts
+ *  finished jobs and cancels the jobs not yet started. Completion is called on the main queue
+ *  with the metrics of the batch and the errors of its failed jobs by output URL.
+ */
+- (NSProgress*)exportJobs:(NSArray<ChartExportJob*>*)jobs completion:(void (^)(ChartBatchMetrics *metrics, NSDictionary<NSURL*, NSError*> *errors))completion;
+
+/**
+ *  Releases the pages, they are loaded again by the next batch.
+ */
+- (void)unloadPages;
+
+@end
@@ -0,0 +1,608 @@
+//
+//  ChartBatchExporter.m
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import "ChartBatchExporter.h"
+#import "ChartSVGRenderer.h"
+
+// Replaces the chart of the page and returns its SVG, like the export of HIChartView (Export)
+static NSString * const ChartBatchRenderScript =
+@"(function (options, width, height) {"
+"    var H = window.Highcharts, container = document.getElementById('container'), chart;"
+"    if (!H || !container) { return null; }"
+"    H.each(H.charts.slice(), function (c) { if (c) { c.destroy(); } });"
+"    container.style.width = width + 'px';"
+"    container.style.height = height + 'px';"
+"    options.chart = options.chart || {};"
+"    options.chart.animation = false;"
+"    options.plotOptions = options.plotOptions || {};"
+"    options.plotOptions.series = options.plotOptions.series || {};"
+"    options.plotOptions.series.animation = false;"
+"    chart = window.chart = new H.Chart(container, options);"
+"    if (chart.getSVG) {"
+"        return chart.getSVG(chart.options.exporting && chart.options.exporting.chartOptions);"
+"    }"
+"    return new XMLSerializer().serializeToString(chart.container.querySelector('svg'));"
+"}(%@, %g, %g))";
+
+static const CGFloat ChartBatchJPEGQuality = 0.9;
+
+#pragma mark - Options
+
+static BOOL ChartBatchIsFunctionSource(NSString *string)
+{
+    NSString *trimmed = [string stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceAndNewlineCharacterSet]];
+    return [trimmed hasPrefix:@"function"] && [trimmed rangeOfString:@"("].location != NSNotFound;
+}
+
+static void ChartBatchAppendString(NSMutableString *script, NSString *string)
+{
+    NSData *json = [NSJSONSerialization dataWithJSONObject:@[ string ] options:0 error:nil];
+    NSString *array = [[NSString alloc] initWithData:json encoding:NSUTF8StringEncoding];
+    [script appendString:[array substringWithRange:NSMakeRange(1, array.length - 2)]];
+}
+
+/**
+ *  Writes params as a script literal. Unlike JSON, functions are written as their source, as the
+ *  chart view does when it fills the page template.
+ */
+static void ChartBatchAppendScript(NSMutableString *script, id value)
+{
+    if ([value isKindOfClass:[NSDictionary class]]) {
+        [script appendString:@"{"];
+        __block BOOL first = YES;
+        [value enumerateKeysAndObjectsUsingBlock:^(id key, id item, BOOL *stop) {
+            if (!first) {
+                [script appendString:@","];
+            }
+            first = NO;
+            ChartBatchAppendString(script, [key description]);
+            [script appendString:@":"];
+            ChartBatchAppendScript(script, item);
+        }];
+        [script appendString:@"}"];
+    }
+    else if ([value isKindOfClass:[NSArray class]]) {
+        [script appendString:@"["];
+        for (NSUInteger i = 0; i < [value count]; i++) {
+            if (i) {
+                [script appendString:@","];
+            }
+            ChartBatchAppendScript(script, value[i]);
+        }
+        [script appendString:@"]"];
+    }
+    else if ([value isKindOfClass:[NSString class]]) {
+        if (ChartBatchIsFunctionSource(value)) {
+            [script appendString:value];
+        }
+        else {
+            ChartBatchAppendString(script, value);
+        }
+    }
+    else if ([value isKindOfClass:[NSNumber class]]) {
+        if (CFGetTypeID((__bridge CFTypeRef)value) == CFBooleanGetTypeID()) {
+            [script appendString:[value boolValue] ? @"true" : @"false"];
+        }
+        else {
+            double number = [value doubleValue];
+            [script appendString:isfinite(number) ? [NSString stringWithFormat:@"%.17g", number] : @"null"];
+        }
+    }
+    else if ([value isKindOfClass:[HIFunction class]]) {
+        [script appendString:[(HIFunction*)value function] ?: @"null"];
+    }
+    else if ([value respondsToSelector:@selector(getParams)]) {
+        ChartBatchAppendScript(script, [value getParams]);
+    }
+    else if ([value respondsToSelector:@selector(getData)]) {
+        ChartBatchAppendScript(script, [value getData]);
+    }
+    else {
+        [script appendString:@"null"];
+    }
+}
+
+#pragma mark - Jobs
+
+@interface ChartExportJob ()
+@property (strong, nonatomic, readwrite) NSDictionary *params;
+@property (assign, nonatomic, readwrite) CGSize size;
+@property (assign, nonatomic, readwrite) ChartImageFormat format;
+@property (strong, nonatomic, readwrite) NSURL *URL;
+@end
+
+@implementation ChartExportJob
+
+- (instancetype)initWithOptions:(HIOptions*)options size:(CGSize)size format:(ChartImageFormat)format URL:(NSURL*)url
+{
+    return [self initWithParams:[options getParams] size:size format:format URL:url];
+}
+
+- (instancetype)initWithParams:(NSDictionary*)params size:(CGSize)size format:(ChartImageFormat)format URL:(NSURL*)url
+{
+    self = [super init];
+    if (self) {
+        self.params = params ?: @{};
+        self.size = size;
+        self.format = format;
+        self.URL = url;
+        self.scale = 2;
+    }
+    return self;
+}
+
++ (NSArray<ChartExportJob*>*)jobsWithManifestURL:(NSURL*)url plugins:(NSArray<NSString*>**)plugins error:(NSError**)error
+{
+    NSData *data = [NSData dataWithContentsOfURL:url options:0 error:error];
+    if (!data) {
+        return nil;
+    }
+    NSDictionary *manifest = [NSJSONSerialization JSONObjectWithData:data options:kNilOptions error:error];
+    if (![manifest isKindOfClass:[NSDictionary class]] || ![manifest[@"jobs"] isKindOfClass:[NSArray class]]) {
+        if (error && manifest) {
+            *error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileReadCorruptFileError
+                                     userInfo:@{ NSLocalizedDescriptionKey: @"The manifest has no jobs." }];
+        }
+        return nil;
+    }
+
+    NSDictionary *formats = @{ @"png": @(ChartImageFormatPNG), @"jpeg": @(ChartImageFormatJPEG), @"jpg": @(ChartImageFormatJPEG),
+                               @"pdf": @(ChartImageFormatPDF), @"svg": @(ChartImageFormatSVG) };
+    NSURL *directory = [url URLByDeletingLastPathComponent];
+    NSMutableArray *jobs = [NSMutableArray array];
+
+    for (NSDictionary *item in manifest[@"jobs"]) {
+        NSString *output = [item isKindOfClass:[NSDictionary class]] ? item[@"output"] : nil;
+        NSNumber *format = formats[[item[@"format"] ?: @"png" lowercaseString]];
+        if (![output isKindOfClass:[NSString class]] || !format) {
+            if (error) {
+                *error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileReadCorruptFileError
+                                         userInfo:@{ NSLocalizedDescriptionKey: [NSString stringWithFormat:@"Job %lu has no output or an unknown format.", (unsigned long)jobs.count] }];
+            }
+            return nil;
+        }
+        NSURL *outputURL = [output hasPrefix:@"/"] ? [NSURL fileURLWithPath:output] : [directory URLByAppendingPathComponent:output];
+        CGSize size = CGSizeMake([item[@"width"] doubleValue] ?: 600, [item[@"height"] doubleValue] ?: 400);
+        NSDictionary *params = [item[@"options"] isKindOfClass:[NSDictionary class]] ? item[@"options"] : @{};
+        ChartExportJob *job = [[ChartExportJob alloc] initWithParams:params size:size format:format.integerValue URL:outputURL];
+        if (item[@"scale"]) {
+            job.scale = [item[@"scale"] doubleValue];
+        }
+        [jobs addObject:job];
+    }
+    if (plugins) {
+        *plugins = [manifest[@"plugins"] isKindOfClass:[NSArray class]] ? manifest[@"plugins"] : @[];
+    }
+    return jobs;
+}
+
+@end
+
+#pragma mark - Metrics
+
+@interface ChartBatchMetrics ()
+@property (assign, nonatomic, readwrite) NSUInteger exportedCount;
+@property (assign, nonatomic, readwrite) NSUInteger failedCount;
+@property (assign, nonatomic, readwrite) NSUInteger pageCount;
+@property (assign, nonatomic, readwrite) NSTimeInterval elapsedTime;
+@property (assign, nonatomic, readwrite) double chartsPerSecond;
+@property (assign, nonatomic, readwrite) NSTimeInterval averageRenderTime;
+@property (assign, nonatomic, readwrite) NSTimeInterval averageEncodeTime;
+@property (assign, nonatomic, readwrite) unsigned long long outputBytes;
+@end
+
+@implementation ChartBatchMetrics
+
+- (NSString*)description
+{
+    return [NSString stringWithFormat:@"<%@: %lu exported, %lu failed, %lu pages, %.2f s, %.1f charts/s, render %.0f ms, encode %.0f ms, %llu bytes>",
+            NSStringFromClass([self class]), (unsigned long)self.exportedCount, (unsigned long)self.failedCount,
+            (unsigned long)self.pageCount, self.elapsedTime, self.chartsPerSecond,
+            self.averageRenderTime * 1000, self.averageEncodeTime * 1000, self.outputBytes];
+}
+
+@end
+
+#pragma mark - Batches
+
+@interface ChartBatch : NSObject
+@property (strong, nonatomic) NSArray<ChartExportJob*> *jobs;
+@property (assign, nonatomic) NSUInteger nextJob;
+@property (assign, nonatomic) NSUInteger finishedCount;
+@property (assign, nonatomic) NSUInteger exportedCount;
+@property (strong, nonatomic) NSMutableDictionary<NSURL*, NSError*> *errors;
+@property (strong, nonatomic) NSProgress *progress;
+@property (assign, nonatomic) CFAbsoluteTime startTime;
+@property (assign, nonatomic) NSTimeInterval renderTime;
+@property (assign, nonatomic) NSTimeInterval encodeTime;
+@property (assign, nonatomic) unsigned long long outputBytes;
+@property (copy, nonatomic) void (^completion)(ChartBatchMetrics *metrics, NSDictionary<NSURL*, NSError*> *errors);
+@end
+
+@implementation ChartBatch
+@end
+
+#pragma mark - Pages
+
+@interface ChartBatchPage : NSObject <HIChartViewDelegate>
+@property (strong, nonatomic) HIChartView *chartView;
+@property (assign, nonatomic, getter=isLoaded) BOOL loaded;
+@property (assign, nonatomic, getter=isBusy) BOOL busy;
+/**
+ *  Increases whenever the page finishes, fails or reloads, so late callbacks are ignored.
+ */
+@property (assign, nonatomic) NSUInteger generation;
+@property (strong, nonatomic) ChartExportJob *job;
+@property (strong, nonatomic) ChartBatch *batch;
+@property (copy, nonatomic) void (^didLoad)(ChartBatchPage *page);
+@end
+
+@implementation ChartBatchPage
+
+- (void)chartViewDidLoad:(HIChartView *)chart
+{
+    if (chart != self.chartView || self.loaded) {
+        return;
+    }
+    self.loaded = YES;
+    self.generation++;
+    if (self.didLoad) {
+        self.didLoad(self);
+    }
+}
+
+@end
+
+#pragma mark - Exporter
+
+@interface ChartBatchExporter ()
+@property (assign, nonatomic, readwrite) NSUInteger pageCount;
+@property (strong, nonatomic) UIWindow *window;
+@property (strong, nonatomic) NSMutableArray<ChartBatchPage*> *pages;
+@property (strong, nonatomic) NSMutableArray<ChartBatch*> *batches;
+@end
+
+@implementation ChartBatchExporter
+
+- (instancetype)initWithPageCount:(NSUInteger)pageCount
+{
+    self = [super init];
+    if (self) {
+        self.pageCount = MAX(pageCount, 1);
+        self.timeout = 30;
+        self.pages = [NSMutableArray array];
+        self.batches = [NSMutableArray array];
+    }
+    return self;
+}
+
+- (instancetype)init
+{
+    return [self initWithPageCount:2];
+}
+
+- (void)dealloc
+{
+    for (ChartBatchPage *page in _pages) {
+        page.chartView.delegate = nil;
+    }
+}
+
+- (NSProgress*)exportJobs:(NSArray<ChartExportJob*>*)jobs completion:(void (^)(ChartBatchMetrics *metrics, NSDictionary<NSURL*, NSError*> *errors))completion
+{
+    ChartBatch *batch = [[ChartBatch alloc] init];
+    batch.jobs = [jobs copy];
+    batch.errors = [NSMutableDictionary dictionary];
+    batch.progress = [NSProgress progressWithTotalUnitCount:(int64_t)jobs.count];
+    batch.startTime = CFAbsoluteTimeGetCurrent();
+    batch.completion = completion;
+
+    __weak ChartBatchExporter *weakSelf = self;
+    __weak ChartBatch *weakBatch = batch;
+    batch.progress.cancellationHandler = ^{
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [weakSelf cancelBatch:weakBatch];
+        });
+    };
+
+    [self.batches addObject:batch];
+    if (!jobs.count) {
+        [self finishBatchIfDone:batch];
+    }
+    [self pump];
+    return batch.progress;
+}
+
+- (void)unloadPages
+{
+    for (ChartBatchPage *page in self.pages) {
+        if (page.busy) {
+            // The late result of the page is ignored, so its job fails now
+            [self failJobOfPage:page error:[NSError errorWithDomain:NSCocoaErrorDomain code:NSUserCancelledError userInfo:nil]];
+        }
+        page.generation++;
+        page.chartView.delegate = nil;
+        [page.chartView removeFromSuperview];
+    }
+    [self.pages removeAllObjects];
+    self.window.hidden = YES;
+    self.window = nil;
+}
+
+#pragma mark - Pages
+
+- (void)loadPagesIfNeeded
+{
+    if (!self.window) {
+        // Off screen, but in a window so the pages run like visible ones
+        CGRect bounds = [UIScreen mainScreen].bounds;
+        self.window = [[UIWindow alloc] initWithFrame:CGRectOffset(bounds, bounds.size.width * 2, 0)];
+        self.window.windowLevel = UIWindowLevelNormal - 1;
+        self.window.userInteractionEnabled = NO;
+        self.window.rootViewController = [[UIViewController alloc] init];
+        self.window.hidden = NO;
+    }
+    while (self.pages.count < self.pageCount) {
+        ChartBatchPage *page = [[ChartBatchPage alloc] init];
+        [self.pages addObject:page];
+        [self loadPage:page];
+    }
+}
+
+- (void)loadPage:(ChartBatchPage*)page
+{
+    [page.chartView removeFromSuperview];
+    page.chartView.delegate = nil;
+    page.loaded = NO;
+    page.busy = NO;
+    NSUInteger generation = ++page.generation;
+
+    __weak ChartBatchExporter *weakSelf = self;
+    page.didLoad = ^(ChartBatchPage *loadedPage) {
+        [weakSelf pump];
+    };
+
+    UIView *host = self.window.rootViewController.view;
+    HIChartView *chartView = [[HIChartView alloc] initWithFrame:host.bounds];
+    chartView.delegate = page;
+    chartView.viewController = self.window.rootViewController;
+    chartView.plugins = [self pagePlugins];
+    // An empty chart brings up the page, jobs replace it by script
+    chartView.options = [[HIOptions alloc] init];
+    [host addSubview:chartView];
+    page.chartView = chartView;
+
+    __weak ChartBatchPage *weakPage = page;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.timeout * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+        ChartBatchPage *strongPage = weakPage;
+        if (!strongPage || strongPage.loaded || strongPage.generation != generation) {
+            return;
+        }
+        // A page that does not load fails a job, so a broken bundle cannot stall the batches
+        [weakSelf failNextJobWithError:[NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorTimedOut userInfo:nil]];
+        [weakSelf loadPage:strongPage];
+    });
+}
+
+/**
+ *  The plugins with the exporting modules, so a page serializes the chart it has just built
+ *  instead of having the exporting module build a copy.
+ */
+- (NSArray<NSString*>*)pagePlugins
+{
+    NSMutableArray *plugins = [NSMutableArray arrayWithArray:self.plugins ?: @[]];
+    for (NSString *plugin in @[ @"exporting", @"exporting-live" ]) {
+        if (![plugins containsObject:plugin]) {
+            [plugins addObject:plugin];
+        }
+    }
+    return plugins;
+}
+
+#pragma mark - Scheduling
+
+- (ChartBatch*)nextBatch
+{
+    for (ChartBatch *batch in self.batches) {
+        if (batch.nextJob < batch.jobs.count) {
+            return batch;
+        }
+    }
+    return nil;
+}
+
+- (void)pump
+{
+    if (![self nextBatch]) {
+        return;
+    }
+    [self loadPagesIfNeeded];
+    for (ChartBatchPage *page in [self.pages copy]) {
+        ChartBatch *batch = [self nextBatch];
+        if (!batch) {
+            return;
+        }
+        if (page.loaded && !page.busy) {
+            ChartExportJob *job = batch.jobs[batch.nextJob++];
+            [self renderJob:job batch:batch page:page];
+        }
+    }
+}
+
+- (void)renderJob:(ChartExportJob*)job batch:(ChartBatch*)batch page:(ChartBatchPage*)page
+{
+    page.busy = YES;
+    page.job = job;
+    page.batch = batch;
+    NSUInteger generation = ++page.generation;
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+
+    NSMutableString *options = [NSMutableString string];
+    ChartBatchAppendScript(options, job.params);
+    NSString *script = [NSString stringWithFormat:ChartBatchRenderScript, options, job.size.width, job.size.height];
+
+    __weak ChartBatchExporter *weakSelf = self;
+    __weak ChartBatchPage *weakPage = page;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.timeout * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+        ChartBatchPage *strongPage = weakPage;
+        if (!strongPage || strongPage.generation != generation) {
+            return;
+        }
+        [weakSelf failJobOfPage:strongPage error:[NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorTimedOut userInfo:nil]];
+        [weakSelf loadPage:strongPage];
+    });
+
+    [page.chartView evaluateChartScript:script completion:^(id result) {
+        ChartBatchPage *strongPage = weakPage;
+        if (!strongPage || strongPage.generation != generation) {
+            return;
+        }
+        strongPage.busy = NO;
+        strongPage.job = nil;
+        strongPage.batch = nil;
+        strongPage.generation++;
+        batch.renderTime += CFAbsoluteTimeGetCurrent() - start;
+
+        NSString *svg = [result isKindOfClass:[NSString class]] && [result length] ? result : nil;
+        if (svg) {
+            [weakSelf encodeSVG:svg job:job batch:batch];
+        }
+        else {
+            NSError *error = [NSError errorWithDomain:ChartExportErrorDomain code:ChartExportErrorNoChart
+                                             userInfo:@{ NSLocalizedDescriptionKey: @"The page returned no SVG." }];
+            [weakSelf finishJob:job batch:batch outputBytes:0 error:error encodeTime:0];
+        }
+        [weakSelf pump];
+    }];
+}
+
+- (void)encodeSVG:(NSString*)svg job:(ChartExportJob*)job batch:(ChartBatch*)batch
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+        unsigned long long outputBytes = 0;
+        BOOL written = NO;
+        NSError *error = nil;
+        @autoreleasepool {
+            [[NSFileManager defaultManager] createDirectoryAtURL:[job.URL URLByDeletingLastPathComponent]
+                                     withIntermediateDirectories:YES attributes:nil error:nil];
+            ChartSVGRenderer *renderer = job.format == ChartImageFormatSVG ? nil : [[ChartSVGRenderer alloc] initWithSVG:svg];
+            NSData *data = nil;
+            switch (job.format) {
+                case ChartImageFormatSVG:
+                    data = [svg dataUsingEncoding:NSUTF8StringEncoding];
+                    break;
+                case ChartImageFormatPNG:
+                    // Streamed to the file in strips, large scales never hold the whole image
+                    written = [renderer writePNGWithScale:job.scale toURL:job.URL error:&error];
+                    if (written) {
+                        NSNumber *size = nil;
+                        [job.URL getResourceValue:&size forKey:NSURLFileSizeKey error:nil];
+                        outputBytes = size.unsignedLongLongValue;
+                    }
+                    break;
+                case ChartImageFormatJPEG:
+                    data = [renderer JPEGDataWithScale:job.scale quality:ChartBatchJPEGQuality];
+                    break;
+                default:
+                    data = [renderer PDFData];
+                    break;
+            }
+            if (job.format != ChartImageFormatPNG) {
+                written = data && [data writeToURL:job.URL options:NSDataWritingAtomic error:&error];
+                outputBytes = written ? data.length : 0;
+            }
+            if (!written && !error) {
+                error = [NSError errorWithDomain:ChartExportErrorDomain code:ChartExportErrorRender
+                                        userInfo:@{ NSLocalizedDescriptionKey: @"The chart could not be drawn." }];
+            }
+        }
+        NSTimeInterval encodeTime = CFAbsoluteTimeGetCurrent() - start;
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [self finishJob:job batch:batch outputBytes:outputBytes error:error encodeTime:encodeTime];
+        });
+    });
+}
+
+#pragma mark - Completion
+
+- (void)finishJob:(ChartExportJob*)job batch:(ChartBatch*)batch outputBytes:(unsigned long long)outputBytes error:(NSError*)error encodeTime:(NSTimeInterval)encodeTime
+{
+    batch.finishedCount++;
+    batch.encodeTime += encodeTime;
+    if (!error) {
+        batch.exportedCount++;
+        batch.outputBytes += outputBytes;
+    }
+    else if (job.URL) {
+        batch.errors[job.URL] = error;
+    }
+    batch.progress.completedUnitCount = (int64_t)batch.finishedCount;
+    [self finishBatchIfDone:batch];
+}
+
+- (void)failJobOfPage:(ChartBatchPage*)page error:(NSError*)error
+{
+    ChartExportJob *job = page.job;
+    ChartBatch *batch = page.batch;
+    page.busy = NO;
+    page.job = nil;
+    page.batch = nil;
+    page.generation++;
+    if (job) {
+        [self finishJob:job batch:batch outputBytes:0 error:error encodeTime:0];
+    }
+}
+
+- (void)failNextJobWithError:(NSError*)error
+{
+    ChartBatch *batch = [self nextBatch];
+    if (!batch) {
+        return;
+    }
+    ChartExportJob *job = batch.jobs[batch.nextJob++];
+    [self finishJob:job batch:batch outputBytes:0 error:error encodeTime:0];
+}
+
+- (void)cancelBatch:(ChartBatch*)batch
+{
+    if (!batch || ![self.batches containsObject:batch]) {
+        return;
+    }
+    NSError *error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSUserCancelledError userInfo:nil];
+    // Jobs on a page or being encoded finish on their own
+    while (batch.nextJob < batch.jobs.count) {
+        ChartExportJob *job = batch.jobs[batch.nextJob++];
+        [self finishJob:job batch:batch outputBytes:0 error:error encodeTime:0];
+    }
+}
+
+- (void)finishBatchIfDone:(ChartBatch*)batch
+{
+    if (batch.finishedCount < batch.jobs.count || ![self.batches containsObject:batch]) {
+        return;
+    }
+    [self.batches removeObject:batch];
+
+    ChartBatchMetrics *metrics = [[ChartBatchMetrics alloc] init];
+    NSUInteger rendered = MAX(batch.exportedCount, 1);
+    metrics.exportedCount = batch.exportedCount;
+    metrics.failedCount = batch.jobs.count - batch.exportedCount;
+    metrics.pageCount = self.pageCount;
+    metrics.elapsedTime = CFAbsoluteTimeGetCurrent() - batch.startTime;
+    metrics.chartsPerSecond = metrics.elapsedTime > 0 ? batch.exportedCount / metrics.elapsedTime : 0;
+    metrics.averageRenderTime = batch.renderTime / rendered;
+    metrics.averageEncodeTime = batch.encodeTime / rendered;
+    metrics.outputBytes = batch.outputBytes;
+
+    if (batch.completion) {
+        batch.completion(metrics, [batch.errors copy]);
+    }
+}
+
+@end
@@ -0,0 +1,464 @@
+//
+//  ChartCSV.c
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#include "ChartCSV.h"
+#include "ChartValueParser.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// The data module guesses the delimiters from the first 14 lines
+#define ChartCSVGuessLines 14
+
+typedef struct {
+    char *bytes;
+    size_t length;
+    size_t capacity;
+} ChartCSVBuffer;
+
+struct ChartCSVParser {
+    ChartCSVOptions options;
+    ChartCSVCellCallback callback;
+    void *context;
+
+    char itemDelimiter;
+    char decimalPoint;
+    const char *lineDelimiter;
+    size_t lineDelimiterLength;
+
+    ChartCSVBuffer line;
+    ChartCSVBuffer cell;
+    int pendingReturn;
+    int done;
+    long lineIndex;
+    long skippedLines;
+
+    // Lines held back until the item delimiter is guessed
+    ChartCSVBuffer held;
+    size_t heldEnds[ChartCSVGuessLines];
+    long heldRows[ChartCSVGuessLines];
+    size_t heldCount;
+};
+
+static int ChartCSVBufferReserve(ChartCSVBuffer *buffer, size_t length)
+{
+    if (length <= buffer->capacity) {
+        return 0;
+    }
+    size_t capacity = buffer->capacity ? buffer->capacity : 256;
+    while (capacity < length) {
+        capacity *= 2;
+    }
+    char *bytes = realloc(buffer->bytes, capacity);
+    if (!bytes) {
+        return -1;
+    }
+    buffer->bytes = bytes;
+    buffer->capacity = capacity;
+    return 0;
+}
+
+static int ChartCSVBufferAppend(ChartCSVBuffer *buffer, const char *bytes, size_t length)
+{
+    if (ChartCSVBufferReserve(buffer, buffer->length + length) != 0) {
+        return -1;
+    }
+    memcpy(buffer->bytes + buffer->length, bytes, length);
+    buffer->length += length;
+    return 0;
+}
+
+static int ChartCSVIsSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+void ChartCSVOptionsInit(ChartCSVOptions *options)
+{
+    memset(options, 0, sizeof(*options));
+}
+
+ChartCSVParser *ChartCSVParserCreate(const ChartCSVOptions *options, ChartCSVCellCallback callback, void *context)
+{
+    ChartCSVParser *parser = calloc(1, sizeof(ChartCSVParser));
+    if (!parser) {
+        return NULL;
+    }
+    if (options) {
+        parser->options = *options;
+    }
+    parser->callback = callback;
+    parser->context = context;
+    parser->itemDelimiter = parser->options.itemDelimiter;
+    parser->lineDelimiter = parser->options.lineDelimiter && parser->options.lineDelimiter[0] ? parser->options.lineDelimiter : "\n";
+    parser->lineDelimiterLength = strlen(parser->lineDelimiter);
+    if (parser->options.startRow < 0) {
+        parser->options.startRow = 0;
+    }
+    if (parser->options.startColumn < 0) {
+        parser->options.startColumn = 0;
+    }
+    return parser;
+}
+
+void ChartCSVParserDestroy(ChartCSVParser *parser)
+{
+    if (!parser) {
+        return;
+    }
+    free(parser->line.bytes);
+    free(parser->cell.bytes);
+    free(parser->held.bytes);
+    free(parser);
+}
+
+char ChartCSVParserItemDelimiter(const ChartCSVParser *parser)
+{
+    return parser->itemDelimiter;
+}
+
+char ChartCSVParserGuessedDecimalPoint(const ChartCSVParser *parser)
+{
+    return parser->decimalPoint;
+}
+
+#pragma mark - Lines
+
+static int ChartCSVPushCell(ChartCSVParser *parser, size_t row, long *column, size_t *kept)
+{
+    long endColumn = parser->options.endColumn;
+
+    if (*column >= parser->options.startColumn && (endColumn <= 0 || *column <= endColumn)) {
+        // Terminated so callbacks may hand the bytes to strtod and friends
+        if (ChartCSVBufferReserve(&parser->cell, parser->cell.length + 1) != 0) {
+            return -1;
+        }
+        parser->cell.bytes[parser->cell.length] = '\0';
+        if (parser->callback) {
+            parser->callback(parser->context, row, *kept, parser->cell.bytes, parser->cell.length);
+        }
+        (*kept)++;
+    }
+    (*column)++;
+    parser->cell.length = 0;
+    return 0;
+}
+
+static int ChartCSVParseLine(ChartCSVParser *parser, const char *line, size_t length, size_t row)
+{
+    const char *start = line;
+    const char *end = line + length;
+    long column = 0;
+    size_t kept = 0;
+    size_t i;
+
+    while (start < end && ChartCSVIsSpace(*start)) {
+        start++;
+    }
+    // Blank lines and indented comments still take up a row, but have no cells
+    if (start == end || *start == '#') {
+        return 0;
+    }
+
+    parser->cell.length = 0;
+    for (i = 0; i < length; i++) {
+        char c = line[i];
+        if (c == '#') {
+            break;
+        }
+        if (c == '"') {
+            // Quoted cells run to the next lone quote, doubled quotes stand for one
+            for (i++; i < length; i++) {
+                if (line[i] == '"') {
+                    if (i + 1 < length && line[i + 1] == '"') {
+                        i++;
+                    }
+                    else {
+                        break;
+                    }
+                }
+                if (ChartCSVBufferAppend(&parser->cell, line + i, 1) != 0) {
+                    return -1;
+                }
+            }
+        }
+        else if (c == parser->itemDelimiter) {
+            if (ChartCSVPushCell(parser, row, &column, &kept) != 0) {
+                return -1;
+            }
+        }
+        else {
+            // Copy the run up to the next special character in one go
+            size_t run = i + 1;
+            while (run < length && line[run] != '#' && line[run] != '"' && line[run] != parser->itemDelimiter) {
+                run++;
+            }
+            if (ChartCSVBufferAppend(&parser->cell, line + i, run - i) != 0) {
+                return -1;
+            }
+            i = run - 1;
+        }
+    }
+    return ChartCSVPushCell(parser, row, &column, &kept);
+}
+
+static int ChartCSVIsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+// Whether JavaScript reads the trimmed string as a finite number, like isFinite(g) in the data module
+static int ChartCSVIsFiniteNumber(const char *bytes, size_t length)
+{
+    size_t i = 0, digits = 0;
+
+    if (length > 2 && bytes[0] == '0' && strchr("xXoObB", bytes[1])) {
+        int base = bytes[1] == 'x' || bytes[1] == 'X' ? 16 : bytes[1] == 'o' || bytes[1] == 'O' ? 8 : 2;
+        for (i = 2; i < length; i++) {
+            char c = bytes[i];
+            int digit = ChartCSVIsDigit(c) ? c - '0' : (c >= 'a' && c <= 'f') ? c - 'a' + 10 : (c >= 'A' && c <= 'F') ? c - 'A' + 10 : 99;
+            if (digit >= base) {
+                return 0;
+            }
+        }
+        return 1;
+    }
+    if (i < length && (bytes[i] == '+' || bytes[i] == '-')) {
+        i++;
+    }
+    for (; i < length && ChartCSVIsDigit(bytes[i]); i++) {
+        digits++;
+    }
+    if (i < length && bytes[i] == '.') {
+        for (i++; i < length && ChartCSVIsDigit(bytes[i]); i++) {
+            digits++;
+        }
+    }
+    if (!digits) {
+        return 0;
+    }
+    if (i < length && (bytes[i] == 'e' || bytes[i] == 'E')) {
+        i++;
+        if (i < length && (bytes[i] == '+' || bytes[i] == '-')) {
+            i++;
+        }
+        if (i == length || !ChartCSVIsDigit(bytes[i])) {
+            return 0;
+        }
+        while (i < length && ChartCSVIsDigit(bytes[i])) {
+            i++;
+        }
+    }
+    return i == length;
+}
+
+// Numbers that Date.parse also reads, the ISO years YYYY and +YYYYYY or -YYYYYY
+static int ChartCSVIsYear(const char *bytes, size_t length)
+{
+    size_t i;
+
+    if (length == 7 && (bytes[0] == '+' || bytes[0] == '-')) {
+        bytes++;
+        length--;
+    }
+    else if (length != 4) {
+        return 0;
+    }
+    for (i = 0; i < length; i++) {
+        if (!ChartCSVIsDigit(bytes[i])) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Stands in for the data module's isNaN(Date.parse(g)) ? (isFinite(g) || count) : count test:
+// dates count like strings, only numbers and empty cells do not
+static int ChartCSVCountsDelimiter(const char *bytes, size_t length)
+{
+    while (length && ChartCSVIsSpace(*bytes)) {
+        bytes++;
+        length--;
+    }
+    while (length && ChartCSVIsSpace(bytes[length - 1])) {
+        length--;
+    }
+    if (length == 0) {
+        return 0;
+    }
+    return ChartCSVIsYear(bytes, length) || !ChartCSVIsFiniteNumber(bytes, length);
+}
+
+// Counts the delimiters following cells that are not numbers, dates included, like the data module
+static void ChartCSVGuessDelimiters(ChartCSVParser *parser)
+{
+    size_t semicolons = 0, commas = 0, dots = 0, decimalCommas = 0;
+    size_t start = 0;
+    size_t l, i;
+
+    for (l = 0; l < parser->heldCount; l++) {
+        const char *line = parser->held.bytes + start;
+        size_t length = parser->heldEnds[l] - start;
+        char token[64];
+        size_t tokenLength = 0;
+        int quoted = 0;
+
+        for (i = 0; i < length; i++) {
+            char c = line[i];
+            if (c == '#') {
+                break;
+            }
+            if (c == '"') {
+                if (!quoted) {
+                    quoted = 1;
+                }
+                else if ((i == 0 || line[i - 1] != '"') && (i + 1 >= length || line[i + 1] != '"')) {
+                    size_t next = i + 1;
+                    while (next < length && line[next] == ' ') {
+                        next++;
+                    }
+                    if (next < length) {
+                        semicolons += line[next] == ';';
+                        commas += line[next] == ',';
+                    }
+                    i = next;
+                    quoted = 0;
+                }
+            }
+            else if (c == ',' || c == ';' || c == '\t') {
+                if (tokenLength > sizeof(token) || ChartCSVCountsDelimiter(token, tokenLength)) {
+                    semicolons += c == ';';
+                    commas += c == ',';
+                }
+                tokenLength = 0;
+            }
+            else {
+                // Quotes are left out of the token, longer tokens are never numbers or dates
+                if (tokenLength < sizeof(token)) {
+                    token[tokenLength] = c;
+                }
+                tokenLength++;
+            }
+            dots += c == '.';
+            decimalCommas += c == ',';
+        }
+        start = parser->heldEnds[l];
+    }
+
+    parser->itemDelimiter = semicolons > commas ? ';' : ',';
+    parser->decimalPoint = dots > decimalCommas ? '.' : ',';
+}
+
+static int ChartCSVFlushHeld(ChartCSVParser *parser)
+{
+    size_t start = 0;
+    size_t l;
+
+    ChartCSVGuessDelimiters(parser);
+    for (l = 0; l < parser->heldCount; l++) {
+        if (ChartCSVParseLine(parser, parser->held.bytes + start, parser->heldEnds[l] - start, (size_t)parser->heldRows[l]) != 0) {
+            return -1;
+        }
+        start = parser->heldEnds[l];
+    }
+    parser->heldCount = 0;
+    free(parser->held.bytes);
+    memset(&parser->held, 0, sizeof(parser->held));
+    return 0;
+}
+
+static int ChartCSVCompleteLine(ChartCSVParser *parser)
+{
+    const char *line = parser->line.bytes;
+    size_t length = parser->line.length;
+    long index = parser->lineIndex++;
+    long row;
+
+    parser->line.length = 0;
+    if (index < parser->options.startRow) {
+        return 0;
+    }
+    if (parser->options.endRow > 0 && index > parser->options.endRow) {
+        parser->done = 1;
+        return 0;
+    }
+    // Comment lines do not take up a row
+    if (length && line[0] == '#') {
+        parser->skippedLines++;
+        return 0;
+    }
+    row = index - parser->options.startRow - parser->skippedLines;
+
+    if (!parser->itemDelimiter) {
+        if (ChartCSVBufferAppend(&parser->held, line, length) != 0) {
+            return -1;
+        }
+        parser->heldEnds[parser->heldCount] = parser->held.length;
+        parser->heldRows[parser->heldCount] = row;
+        parser->heldCount++;
+        return parser->heldCount == ChartCSVGuessLines ? ChartCSVFlushHeld(parser) : 0;
+    }
+    return ChartCSVParseLine(parser, line, length, (size_t)row);
+}
+
+#pragma mark - Feeding
+
+int ChartCSVParserFeed(ChartCSVParser *parser, const char *bytes, size_t length)
+{
+    const char *delimiter = parser->lineDelimiter;
+    size_t delimiterLength = parser->lineDelimiterLength;
+    char last = delimiter[delimiterLength - 1];
+    size_t i;
+
+    if (parser->done) {
+        return 0;
+    }
+    if (ChartCSVBufferReserve(&parser->line, parser->line.length + length) != 0) {
+        return -1;
+    }
+
+    for (i = 0; i < length && !parser->done; i++) {
+        char c = bytes[i];
+
+        // "\r\n" and lone "\r" both become "\n"
+        if (parser->pendingReturn) {
+            parser->pendingReturn = 0;
+            if (c == '\n') {
+                continue;
+            }
+        }
+        if (c == '\r') {
+            parser->pendingReturn = 1;
+            c = '\n';
+        }
+        parser->line.bytes[parser->line.length++] = c;
+
+        if (c == last && parser->line.length >= delimiterLength &&
+            memcmp(parser->line.bytes + parser->line.length - delimiterLength, delimiter, delimiterLength) == 0) {
+            parser->line.length -= delimiterLength;
+            if (ChartCSVCompleteLine(parser) != 0) {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+int ChartCSVParserFinish(ChartCSVParser *parser)
+{
+    if (!parser->done && parser->line.length) {
+        if (ChartCSVCompleteLine(parser) != 0) {
+            return -1;
+        }
+    }
+    parser->done = 1;
+    if (!parser->itemDelimiter || parser->heldCount) {
+        return ChartCSVFlushHeld(parser);
+    }
+    return 0;
+}
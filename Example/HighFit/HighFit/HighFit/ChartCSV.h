@@ -0,0 +1,84 @@
+//
+//  ChartCSV.h
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#ifndef ChartCSV_h
+#define ChartCSV_h
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  Splitting options, named after the data module options they mirror.
+ */
+typedef struct {
+    /**
+     *  Separates the cells of a line. 0 guesses ',' or ';' from the first lines, like the data module.
+     */
+    char itemDelimiter;
+
+    /**
+     *  Separates lines, "\n" when NULL. Carriage returns are turned into "\n" before splitting.
+     */
+    const char *lineDelimiter;
+
+    /**
+     *  Inclusive line and column ranges. A negative or 0 end, and a negative start, means no limit.
+     */
+    long startRow;
+    long endRow;
+    long startColumn;
+    long endColumn;
+} ChartCSVOptions;
+
+/**
+ *  Called for every kept cell with its row and column relative to startRow and startColumn.
+ *  The bytes are unquoted but not trimmed, and are only valid during the call.
+ */
+typedef void (*ChartCSVCellCallback)(void *context, size_t row, size_t column, const char *bytes, size_t length);
+
+typedef struct ChartCSVParser ChartCSVParser;
+
+void ChartCSVOptionsInit(ChartCSVOptions *options);
+
+/**
+ *  Creates a parser fed with chunks of any size, so a file is never held in memory as a whole.
+ *  Lines are split like the data module's parseCSV: lines starting with '#' are skipped, '#'
+ *  ends a line, and '"' quotes cells. Returns NULL when out of memory.
+ */
+ChartCSVParser *ChartCSVParserCreate(const ChartCSVOptions *options, ChartCSVCellCallback callback, void *context);
+
+/**
+ *  Parses a chunk. Returns 0 on success and -1 when out of memory.
+ */
+int ChartCSVParserFeed(ChartCSVParser *parser, const char *bytes, size_t length);
+
+/**
+ *  Parses the last line, which has no line delimiter. Returns 0 on success and -1 when out of memory.
+ */
+int ChartCSVParserFinish(ChartCSVParser *parser);
+
+/**
+ *  The item delimiter in use, 0 while it is still being guessed.
+ */
+char ChartCSVParserItemDelimiter(const ChartCSVParser *parser);
+
+/**
+ *  The decimal point guessed from the first lines, as the data module does when decimalPoint is not set.
+ */
+char ChartCSVParserGuessedDecimalPoint(const ChartCSVParser *parser);
+
+void ChartCSVParserDestroy(ChartCSVParser *parser);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ChartCSV_h */
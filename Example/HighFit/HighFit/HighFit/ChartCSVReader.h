@@ -0,0 +1,53 @@
+//
+//  ChartCSVReader.h
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <Highcharts/Highcharts.h>
+#import "ChartDataColumn.h"
+
+/**
+ *  Reads CSV from a file or stream in chunks into typed columns, instead of passing the whole
+ *  file to the data module as HIData.csv. Cells are split and typed like the data module does:
+ *  the first column is the x column, read as numbers, dates or categories, and the others are
+ *  read as numbers.
+ */
+@interface ChartCSVReader : NSObject
+
+/**
+ *  Creates a reader using the parsing options of data. The csv, rows and columns are ignored.
+ */
+- (instancetype)initWithData:(HIData*)data;
+
+@property (strong, nonatomic) NSString *itemDelimiter;
+@property (strong, nonatomic) NSString *lineDelimiter;
+@property (strong, nonatomic) NSString *decimalPoint;
+@property (strong, nonatomic) NSString *dateFormat;
+@property (strong, nonatomic) NSNumber *startRow;
+@property (strong, nonatomic) NSNumber *endRow;
+@property (strong, nonatomic) NSNumber *startColumn;
+@property (strong, nonatomic) NSNumber *endColumn;
+@property (strong, nonatomic) NSNumber /* Bool */ *firstRowAsNames;
+@property (strong, nonatomic) NSNumber /* Bool */ *switchRowsAndColumns;
+
+/**
+ *  Bytes read at a time. Defaults to 64 KB.
+ */
+@property (assign, nonatomic) NSUInteger chunkSize;
+
+/**
+ *  Reads the columns synchronously. Returns nil and sets error when the stream fails.
+ */
+- (NSArray<ChartDataColumn*>*)columnsFromStream:(NSInputStream*)stream error:(NSError**)error;
+- (NSArray<ChartDataColumn*>*)columnsFromURL:(NSURL*)url error:(NSError**)error;
+
+/**
+ *  Reads the columns on a background queue and calls completion on the main queue.
+ */
+- (void)readColumnsFromURL:(NSURL*)url completion:(void (^)(NSArray<ChartDataColumn*> *columns, NSError *error))completion;
+
+@end
@@ -0,0 +1,324 @@
+//
+//  ChartCSVReader.m
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import "ChartCSVReader.h"
+#import "ChartCSV.h"
+#import "ChartValueParser.h"
+
+// Dates of the x column read before the format is deduced
+static const NSUInteger ChartCSVReaderDateSampleSize = 64;
+
+// The data module reads numbers above a year in milliseconds as dates
+static const double ChartCSVReaderDatetimeThreshold = 31536e6;
+
+@interface ChartCSVColumnBuilder : NSObject
+@property (strong, nonatomic) NSString *name;
+@property (strong, nonatomic) NSMutableData *values;
+@property (strong, nonatomic) NSMutableDictionary *strings;
+@property (strong, nonatomic) NSMutableArray *pendingDates;
+@property (assign, nonatomic) BOOL datetime;
+@end
+
+@implementation ChartCSVColumnBuilder
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        self.values = [NSMutableData data];
+        self.strings = [NSMutableDictionary dictionary];
+        self.pendingDates = [NSMutableArray array];
+    }
+    return self;
+}
+
+- (void)setValue:(double)value atIndex:(NSUInteger)index
+{
+    NSUInteger count = self.values.length / sizeof(double);
+    if (index >= count) {
+        // Cells missing from short lines stay empty
+        self.values.length = (index + 1) * sizeof(double);
+        double *values = self.values.mutableBytes;
+        for (NSUInteger i = count; i < index; i++) {
+            values[i] = NAN;
+        }
+    }
+    ((double *)self.values.mutableBytes)[index] = value;
+}
+
+@end
+
+@interface ChartCSVReader ()
+@property (strong, nonatomic) NSMutableArray *builders;
+@property (assign, nonatomic) ChartCSVParser *parser;
+@property (assign, nonatomic) char decimal;
+@property (assign, nonatomic) ChartDateFormat format;
+@end
+
+@implementation ChartCSVReader
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        self.chunkSize = 64 * 1024;
+    }
+    return self;
+}
+
+- (instancetype)initWithData:(HIData*)data
+{
+    self = [self init];
+    if (self) {
+        self.itemDelimiter = data.itemDelimiter;
+        self.lineDelimiter = data.lineDelimiter;
+        self.decimalPoint = data.decimalPoint;
+        self.dateFormat = data.dateFormat;
+        self.startRow = data.startRow;
+        self.endRow = data.endRow;
+        self.startColumn = data.startColumn;
+        self.endColumn = data.endColumn;
+        self.firstRowAsNames = data.firstRowAsNames;
+        self.switchRowsAndColumns = data.switchRowsAndColumns;
+    }
+    return self;
+}
+
+#pragma mark - Cells
+
+static void ChartCSVReaderCell(void *context, size_t row, size_t column, const char *bytes, size_t length)
+{
+    ChartCSVReader *reader = (__bridge ChartCSVReader *)context;
+    [reader addCell:bytes length:length row:row column:column];
+}
+
+- (NSString*)stringWithBytes:(const char *)bytes length:(size_t)length
+{
+    NSString *string = [[NSString alloc] initWithBytes:bytes length:length encoding:NSUTF8StringEncoding];
+    // Not every export is UTF-8
+    string = string ?: [[NSString alloc] initWithBytes:bytes length:length encoding:NSISOLatin1StringEncoding];
+    return [string stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceAndNewlineCharacterSet]];
+}
+
+- (void)addCell:(const char *)bytes length:(size_t)length row:(size_t)row column:(size_t)column
+{
+    if ([self.switchRowsAndColumns boolValue]) {
+        size_t swap = row;
+        row = column;
+        column = swap;
+    }
+    while (self.builders.count <= column) {
+        [self.builders addObject:[[ChartCSVColumnBuilder alloc] init]];
+    }
+    ChartCSVColumnBuilder *builder = self.builders[column];
+
+    BOOL firstRowAsNames = !self.firstRowAsNames || [self.firstRowAsNames boolValue];
+    if (firstRowAsNames && row == 0) {
+        builder.name = [self stringWithBytes:bytes length:length];
+        return;
+    }
+    NSUInteger index = row - (firstRowAsNames ? 1 : 0);
+
+    if (!self.decimal) {
+        // Known once the parser has guessed the delimiters
+        char guessed = ChartCSVParserGuessedDecimalPoint(self.parser);
+        self.decimal = self.decimalPoint.length ? (char)[self.decimalPoint characterAtIndex:0] : (guessed ?: '.');
+    }
+
+    double value;
+    if (ChartParseNumber(bytes, length, self.decimal, &value)) {
+        [builder setValue:value atIndex:index];
+        if (column == 0 && value > ChartCSVReaderDatetimeThreshold) {
+            builder.datetime = YES;
+        }
+        return;
+    }
+    [builder setValue:NAN atIndex:index];
+
+    if (column == 0) {
+        if (self.format == ChartDateFormatNone) {
+            [builder.pendingDates addObject:@[ @(index), [self stringWithBytes:bytes length:length] ]];
+            if (builder.pendingDates.count == ChartCSVReaderDateSampleSize) {
+                [self resolvePendingDates:builder];
+            }
+            return;
+        }
+        if (ChartParseDate(bytes, length, self.format, &value)) {
+            [builder setValue:value atIndex:index];
+            builder.datetime = YES;
+            return;
+        }
+    }
+
+    NSString *string = [self stringWithBytes:bytes length:length];
+    if (string.length) {
+        builder.strings[@(index)] = string;
+    }
+}
+
+- (void)resolvePendingDates:(ChartCSVColumnBuilder*)builder
+{
+    NSUInteger count = builder.pendingDates.count;
+    if (self.format == ChartDateFormatNone) {
+        const char **cells = malloc(MAX(count, 1) * sizeof(char *));
+        size_t *lengths = malloc(MAX(count, 1) * sizeof(size_t));
+        for (NSUInteger i = 0; i < count; i++) {
+            cells[i] = [builder.pendingDates[i][1] UTF8String];
+            lengths[i] = strlen(cells[i]);
+        }
+        self.format = ChartDetectDateFormat(cells, lengths, count);
+        free(cells);
+        free(lengths);
+    }
+
+    for (NSArray *pending in builder.pendingDates) {
+        NSUInteger index = [pending[0] unsignedIntegerValue];
+        NSString *string = pending[1];
+        const char *bytes = string.UTF8String;
+        double value;
+        if (ChartParseDate(bytes, strlen(bytes), self.format, &value)) {
+            [builder setValue:value atIndex:index];
+            builder.datetime = YES;
+        }
+        else if (string.length) {
+            builder.strings[@(index)] = string;
+        }
+    }
+    [builder.pendingDates removeAllObjects];
+}
+
+#pragma mark - Columns
+
+- (NSArray<ChartDataColumn*>*)finishColumns
+{
+    NSMutableArray *columns = [NSMutableArray arrayWithCapacity:self.builders.count];
+    NSUInteger count = 0;
+
+    for (ChartCSVColumnBuilder *builder in self.builders) {
+        if (builder.pendingDates.count) {
+            [self resolvePendingDates:builder];
+        }
+        count = MAX(count, builder.values.length / sizeof(double));
+    }
+
+    [self.builders enumerateObjectsUsingBlock:^(ChartCSVColumnBuilder *builder, NSUInteger i, BOOL *stop) {
+        NSUInteger length = builder.values.length / sizeof(double);
+        if (length < count) {
+            [builder setValue:NAN atIndex:count - 1];
+        }
+
+        // Text in the x column makes it a category column, elsewhere it is left out like in the data module
+        if (i == 0 && builder.strings.count) {
+            NSMutableArray *strings = [NSMutableArray arrayWithCapacity:count];
+            const double *values = builder.values.bytes;
+            for (NSUInteger j = 0; j < count; j++) {
+                NSString *string = builder.strings[@(j)];
+                if (!string && !isnan(values[j])) {
+                    string = [NSString stringWithFormat:@"%.15g", values[j]];
+                }
+                [strings addObject:string ?: [NSNull null]];
+            }
+            [columns addObject:[[ChartDataColumn alloc] initWithName:builder.name strings:strings]];
+        }
+        else {
+            ChartDataColumnType type = i == 0 && builder.datetime ? ChartDataColumnTypeDatetime : ChartDataColumnTypeNumber;
+            [columns addObject:[[ChartDataColumn alloc] initWithName:builder.name type:type values:builder.values]];
+        }
+    }];
+    return columns;
+}
+
+- (ChartCSVOptions)parserOptions
+{
+    ChartCSVOptions options;
+    ChartCSVOptionsInit(&options);
+    options.itemDelimiter = self.itemDelimiter.length ? (char)[self.itemDelimiter characterAtIndex:0] : 0;
+    options.lineDelimiter = self.lineDelimiter.length ? self.lineDelimiter.UTF8String : NULL;
+    options.startRow = [self.startRow longValue];
+    options.endRow = [self.endRow longValue];
+    options.startColumn = [self.startColumn longValue];
+    options.endColumn = [self.endColumn longValue];
+    return options;
+}
+
+- (NSArray<ChartDataColumn*>*)columnsFromStream:(NSInputStream*)stream error:(NSError**)error
+{
+    ChartCSVOptions options = [self parserOptions];
+    self.builders = [NSMutableArray array];
+    self.format = ChartDateFormatFromString(self.dateFormat.UTF8String);
+    self.decimal = 0;
+    self.parser = ChartCSVParserCreate(&options, ChartCSVReaderCell, (__bridge void *)self);
+
+    NSUInteger chunkSize = MAX(self.chunkSize, 1);
+    uint8_t *buffer = malloc(chunkSize);
+    NSError *failure = nil;
+
+    if (!self.parser || !buffer) {
+        failure = [NSError errorWithDomain:NSPOSIXErrorDomain code:ENOMEM userInfo:nil];
+    }
+    else {
+        [stream open];
+        while (YES) {
+            NSInteger length = [stream read:buffer maxLength:chunkSize];
+            if (length < 0) {
+                failure = stream.streamError ?: [NSError errorWithDomain:NSPOSIXErrorDomain code:EIO userInfo:nil];
+                break;
+            }
+            if (length == 0) {
+                break;
+            }
+            if (ChartCSVParserFeed(self.parser, (const char *)buffer, (size_t)length) != 0) {
+                failure = [NSError errorWithDomain:NSPOSIXErrorDomain code:ENOMEM userInfo:nil];
+                break;
+            }
+        }
+        [stream close];
+
+        if (!failure && ChartCSVParserFinish(self.parser) != 0) {
+            failure = [NSError errorWithDomain:NSPOSIXErrorDomain code:ENOMEM userInfo:nil];
+        }
+    }
+
+    free(buffer);
+    ChartCSVParserDestroy(self.parser);
+    self.parser = NULL;
+
+    NSArray *columns = failure ? nil : [self finishColumns];
+    self.builders = nil;
+    if (failure && error) {
+        *error = failure;
+    }
+    return columns;
+}
+
+- (NSArray<ChartDataColumn*>*)columnsFromURL:(NSURL*)url error:(NSError**)error
+{
+    NSInputStream *stream = [NSInputStream inputStreamWithURL:url];
+    if (!stream) {
+        if (error) {
+            *error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileReadNoSuchFileError userInfo:@{ NSURLErrorKey: url ?: [NSNull null] }];
+        }
+        return nil;
+    }
+    return [self columnsFromStream:stream error:error];
+}
+
+- (void)readColumnsFromURL:(NSURL*)url completion:(void (^)(NSArray<ChartDataColumn*> *columns, NSError *error))completion
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSError *error = nil;
+        NSArray *columns = [self columnsFromURL:url error:&error];
+        if (completion) {
+            dispatch_async(dispatch_get_main_queue(), ^{
+                completion(columns, error);
+            });
+        }
+    });
+}
+
+@end
@@ -0,0 +1,544 @@
+//
+//  ChartColumnFile.c
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#include "ChartColumnFile.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char ChartColumnFileMagic[8] = { 'H', 'C', 'C', 'O', 'L', 'S', '\r', '\n' };
+
+#define ChartColumnFileHeaderSize 24
+#define ChartColumnFileEntrySize 32
+
+typedef struct {
+    uint64_t nameOffset;
+    uint32_t nameLength;
+    uint32_t columnCount;
+    uint64_t rowCount;
+    uint64_t columnsOffset;
+} ChartColumnFileTableEntry;
+
+typedef struct {
+    uint64_t nameOffset;
+    uint32_t nameLength;
+    uint32_t type;
+    uint64_t dataOffset;
+    uint64_t dataLength;
+} ChartColumnFileColumnEntry;
+
+struct ChartColumnFile {
+    const uint8_t *bytes;
+    size_t length;
+    uint32_t tableCount;
+    const ChartColumnFileTableEntry *tables;
+};
+
+static uint64_t ChartColumnFileAlign(uint64_t offset)
+{
+    return (offset + 7) & ~(uint64_t)7;
+}
+
+static int ChartColumnFileIsLittleEndian(void)
+{
+    const uint16_t probe = 1;
+    return *(const uint8_t *)&probe == 1;
+}
+
+// True when length bytes from offset lie inside the file
+static int ChartColumnFileContains(const ChartColumnFile *file, uint64_t offset, uint64_t length)
+{
+    return offset <= file->length && length <= file->length - offset;
+}
+
+#pragma mark - Reading
+
+static const ChartColumnFileColumnEntry *ChartColumnFileColumns(const ChartColumnFile *file, size_t table)
+{
+    return (const ChartColumnFileColumnEntry *)(file->bytes + file->tables[table].columnsOffset);
+}
+
+static const ChartColumnFileColumnEntry *ChartColumnFileColumnEntryAt(const ChartColumnFile *file, size_t table, size_t column)
+{
+    if (table >= file->tableCount || column >= file->tables[table].columnCount) {
+        return NULL;
+    }
+    return ChartColumnFileColumns(file, table) + column;
+}
+
+static ChartColumnFileError ChartColumnFileValidate(ChartColumnFile *file)
+{
+    uint32_t version;
+    uint64_t tablesOffset;
+    size_t t, c;
+
+    if (file->length < ChartColumnFileHeaderSize || memcmp(file->bytes, ChartColumnFileMagic, sizeof(ChartColumnFileMagic)) != 0) {
+        return ChartColumnFileErrorFormat;
+    }
+    memcpy(&version, file->bytes + 8, sizeof(version));
+    memcpy(&file->tableCount, file->bytes + 12, sizeof(file->tableCount));
+    memcpy(&tablesOffset, file->bytes + 16, sizeof(tablesOffset));
+    if (version != ChartColumnFileVersion) {
+        return ChartColumnFileErrorVersion;
+    }
+    if (tablesOffset % 8 || !ChartColumnFileContains(file, tablesOffset, (uint64_t)file->tableCount * ChartColumnFileEntrySize)) {
+        return ChartColumnFileErrorFormat;
+    }
+    file->tables = (const ChartColumnFileTableEntry *)(file->bytes + tablesOffset);
+
+    // Every offset is checked once here, so the accessors can trust them
+    for (t = 0; t < file->tableCount; t++) {
+        const ChartColumnFileTableEntry *table = &file->tables[t];
+        if (!ChartColumnFileContains(file, table->nameOffset, table->nameLength) || table->columnsOffset % 8 ||
+            !ChartColumnFileContains(file, table->columnsOffset, (uint64_t)table->columnCount * ChartColumnFileEntrySize)) {
+            return ChartColumnFileErrorFormat;
+        }
+        for (c = 0; c < table->columnCount; c++) {
+            const ChartColumnFileColumnEntry *column = ChartColumnFileColumns(file, t) + c;
+            if (!ChartColumnFileContains(file, column->nameOffset, column->nameLength) || column->dataOffset % 8 ||
+                !ChartColumnFileContains(file, column->dataOffset, column->dataLength)) {
+                return ChartColumnFileErrorFormat;
+            }
+            if (column->type == ChartColumnFileTypeString) {
+                const uint64_t *offsets = (const uint64_t *)(file->bytes + column->dataOffset);
+                uint64_t header = (table->rowCount + 1) * sizeof(uint64_t);
+                if (table->rowCount > column->dataLength / sizeof(uint64_t) || column->dataLength < header ||
+                    offsets[table->rowCount] > column->dataLength - header) {
+                    return ChartColumnFileErrorFormat;
+                }
+            }
+            else if (column->type > ChartColumnFileTypeString || column->dataLength / sizeof(double) < table->rowCount) {
+                return ChartColumnFileErrorFormat;
+            }
+        }
+    }
+    return ChartColumnFileOK;
+}
+
+ChartColumnFile *ChartColumnFileOpen(const char *path, ChartColumnFileError *error)
+{
+    ChartColumnFileError failure = ChartColumnFileOK;
+    ChartColumnFile *file = NULL;
+    struct stat status;
+    void *bytes = MAP_FAILED;
+    int descriptor;
+
+    if (!ChartColumnFileIsLittleEndian()) {
+        failure = ChartColumnFileErrorFormat;
+        goto done;
+    }
+    descriptor = open(path, O_RDONLY);
+    if (descriptor < 0) {
+        failure = ChartColumnFileErrorIO;
+        goto done;
+    }
+    if (fstat(descriptor, &status) == 0 && status.st_size > 0) {
+        bytes = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    }
+    // The mapping keeps the file alive without the descriptor
+    close(descriptor);
+    if (bytes == MAP_FAILED) {
+        failure = status.st_size > 0 ? ChartColumnFileErrorIO : ChartColumnFileErrorFormat;
+        goto done;
+    }
+
+    file = calloc(1, sizeof(ChartColumnFile));
+    if (!file) {
+        munmap(bytes, (size_t)status.st_size);
+        failure = ChartColumnFileErrorMemory;
+        goto done;
+    }
+    file->bytes = bytes;
+    file->length = (size_t)status.st_size;
+
+    failure = ChartColumnFileValidate(file);
+    if (failure != ChartColumnFileOK) {
+        ChartColumnFileClose(file);
+        file = NULL;
+    }
+
+done:
+    if (error) {
+        *error = failure;
+    }
+    return file;
+}
+
+void ChartColumnFileClose(ChartColumnFile *file)
+{
+    if (!file) {
+        return;
+    }
+    munmap((void *)file->bytes, file->length);
+    free(file);
+}
+
+size_t ChartColumnFileTableCount(const ChartColumnFile *file)
+{
+    return file->tableCount;
+}
+
+long ChartColumnFileTableIndex(const ChartColumnFile *file, const char *name)
+{
+    size_t length = strlen(name);
+    size_t t;
+
+    for (t = 0; t < file->tableCount; t++) {
+        const ChartColumnFileTableEntry *table = &file->tables[t];
+        if (table->nameLength == length && memcmp(file->bytes + table->nameOffset, name, length) == 0) {
+            return (long)t;
+        }
+    }
+    return -1;
+}
+
+const char *ChartColumnFileTableName(const ChartColumnFile *file, size_t table, size_t *length)
+{
+    if (table >= file->tableCount) {
+        return NULL;
+    }
+    if (length) {
+        *length = file->tables[table].nameLength;
+    }
+    return (const char *)(file->bytes + file->tables[table].nameOffset);
+}
+
+uint64_t ChartColumnFileRowCount(const ChartColumnFile *file, size_t table)
+{
+    return table < file->tableCount ? file->tables[table].rowCount : 0;
+}
+
+size_t ChartColumnFileColumnCount(const ChartColumnFile *file, size_t table)
+{
+    return table < file->tableCount ? file->tables[table].columnCount : 0;
+}
+
+const char *ChartColumnFileColumnName(const ChartColumnFile *file, size_t table, size_t column, size_t *length)
+{
+    const ChartColumnFileColumnEntry *entry = ChartColumnFileColumnEntryAt(file, table, column);
+    if (!entry) {
+        return NULL;
+    }
+    if (length) {
+        *length = entry->nameLength;
+    }
+    return (const char *)(file->bytes + entry->nameOffset);
+}
+
+ChartColumnFileType ChartColumnFileColumnType(const ChartColumnFile *file, size_t table, size_t column)
+{
+    const ChartColumnFileColumnEntry *entry = ChartColumnFileColumnEntryAt(file, table, column);
+    return entry ? (ChartColumnFileType)entry->type : ChartColumnFileTypeNumber;
+}
+
+const double *ChartColumnFileValues(const ChartColumnFile *file, size_t table, size_t column)
+{
+    const ChartColumnFileColumnEntry *entry = ChartColumnFileColumnEntryAt(file, table, column);
+    if (!entry || entry->type == ChartColumnFileTypeString) {
+        return NULL;
+    }
+    return (const double *)(file->bytes + entry->dataOffset);
+}
+
+const char *ChartColumnFileString(const ChartColumnFile *file, size_t table, size_t column, uint64_t row, size_t *length)
+{
+    const ChartColumnFileColumnEntry *entry = ChartColumnFileColumnEntryAt(file, table, column);
+    if (!entry || entry->type != ChartColumnFileTypeString || row >= file->tables[table].rowCount) {
+        return NULL;
+    }
+    const uint64_t *offsets = (const uint64_t *)(file->bytes + entry->dataOffset);
+    const char *strings = (const char *)(offsets + file->tables[table].rowCount + 1);
+    uint64_t start = offsets[row];
+    uint64_t end = offsets[row + 1];
+    if (start > end || end > offsets[file->tables[table].rowCount]) {
+        return NULL;
+    }
+    if (length) {
+        *length = (size_t)(end - start);
+    }
+    return strings + start;
+}
+
+#pragma mark - Writing
+
+typedef struct {
+    char *name;
+    ChartColumnFileType type;
+    uint8_t *data;
+    uint64_t length;
+} ChartColumnFileWriterColumn;
+
+typedef struct {
+    char *name;
+    uint64_t rowCount;
+    ChartColumnFileWriterColumn *columns;
+    size_t columnCount;
+} ChartColumnFileWriterTable;
+
+struct ChartColumnFileWriter {
+    ChartColumnFileWriterTable *tables;
+    size_t tableCount;
+};
+
+ChartColumnFileWriter *ChartColumnFileWriterCreate(void)
+{
+    return calloc(1, sizeof(ChartColumnFileWriter));
+}
+
+void ChartColumnFileWriterDestroy(ChartColumnFileWriter *writer)
+{
+    size_t t, c;
+
+    if (!writer) {
+        return;
+    }
+    for (t = 0; t < writer->tableCount; t++) {
+        ChartColumnFileWriterTable *table = &writer->tables[t];
+        for (c = 0; c < table->columnCount; c++) {
+            free(table->columns[c].name);
+            free(table->columns[c].data);
+        }
+        free(table->columns);
+        free(table->name);
+    }
+    free(writer->tables);
+    free(writer);
+}
+
+long ChartColumnFileWriterAddTable(ChartColumnFileWriter *writer, const char *name, uint64_t rowCount)
+{
+    ChartColumnFileWriterTable *tables = realloc(writer->tables, (writer->tableCount + 1) * sizeof(ChartColumnFileWriterTable));
+    if (!tables) {
+        return -1;
+    }
+    writer->tables = tables;
+
+    ChartColumnFileWriterTable *table = &tables[writer->tableCount];
+    memset(table, 0, sizeof(*table));
+    table->name = strdup(name ? name : "");
+    table->rowCount = rowCount;
+    if (!table->name) {
+        return -1;
+    }
+    return (long)writer->tableCount++;
+}
+
+static ChartColumnFileWriterColumn *ChartColumnFileWriterAddColumn(ChartColumnFileWriter *writer, long table, const char *name, ChartColumnFileType type, uint64_t length)
+{
+    if (table < 0 || (size_t)table >= writer->tableCount) {
+        return NULL;
+    }
+    ChartColumnFileWriterTable *entry = &writer->tables[table];
+    ChartColumnFileWriterColumn *columns = realloc(entry->columns, (entry->columnCount + 1) * sizeof(ChartColumnFileWriterColumn));
+    if (!columns) {
+        return NULL;
+    }
+    entry->columns = columns;
+
+    ChartColumnFileWriterColumn *column = &columns[entry->columnCount];
+    column->name = strdup(name ? name : "");
+    column->type = type;
+    column->length = length;
+    column->data = malloc(length ? (size_t)length : 1);
+    if (!column->name || !column->data) {
+        free(column->name);
+        free(column->data);
+        return NULL;
+    }
+    entry->columnCount++;
+    return column;
+}
+
+int ChartColumnFileWriterAddValues(ChartColumnFileWriter *writer, long table, const char *name, ChartColumnFileType type, const double *values)
+{
+    if (table < 0 || (size_t)table >= writer->tableCount || type == ChartColumnFileTypeString) {
+        return -1;
+    }
+    uint64_t length = writer->tables[table].rowCount * sizeof(double);
+    ChartColumnFileWriterColumn *column = ChartColumnFileWriterAddColumn(writer, table, name, type, length);
+    if (!column) {
+        return -1;
+    }
+    memcpy(column->data, values, (size_t)length);
+    return 0;
+}
+
+int ChartColumnFileWriterAddStrings(ChartColumnFileWriter *writer, long table, const char *name, const char *const *strings, const size_t *lengths)
+{
+    uint64_t rowCount, bytes = 0, row;
+
+    if (table < 0 || (size_t)table >= writer->tableCount) {
+        return -1;
+    }
+    rowCount = writer->tables[table].rowCount;
+    for (row = 0; row < rowCount; row++) {
+        bytes += strings[row] ? lengths[row] : 0;
+    }
+
+    uint64_t header = (rowCount + 1) * sizeof(uint64_t);
+    ChartColumnFileWriterColumn *column = ChartColumnFileWriterAddColumn(writer, table, name, ChartColumnFileTypeString, header + bytes);
+    if (!column) {
+        return -1;
+    }
+    uint64_t *offsets = (uint64_t *)column->data;
+    char *characters = (char *)(column->data + header);
+    uint64_t offset = 0;
+    for (row = 0; row < rowCount; row++) {
+        size_t length = strings[row] ? lengths[row] : 0;
+        offsets[row] = offset;
+        if (length) {
+            memcpy(characters + offset, strings[row], length);
+        }
+        offset += length;
+    }
+    offsets[rowCount] = offset;
+    return 0;
+}
+
+static int ChartColumnFileWritePadded(FILE *stream, const void *bytes, uint64_t length, uint64_t *offset)
+{
+    static const uint8_t zeros[8] = { 0 };
+    uint64_t padding = ChartColumnFileAlign(*offset + length) - (*offset + length);
+
+    if (length && fwrite(bytes, 1, (size_t)length, stream) != length) {
+        return -1;
+    }
+    if (padding && fwrite(zeros, 1, (size_t)padding, stream) != padding) {
+        return -1;
+    }
+    *offset += length + padding;
+    return 0;
+}
+
+ChartColumnFileError ChartColumnFileWriterWrite(ChartColumnFileWriter *writer, const char *path)
+{
+    ChartColumnFileTableEntry *tables = NULL;
+    ChartColumnFileColumnEntry *columns = NULL;
+    size_t columnCount = 0, t, c, index;
+    uint64_t offset, names;
+    char *temporary = NULL;
+    FILE *stream = NULL;
+    ChartColumnFileError failure = ChartColumnFileErrorMemory;
+
+    if (!ChartColumnFileIsLittleEndian()) {
+        return ChartColumnFileErrorFormat;
+    }
+    for (t = 0; t < writer->tableCount; t++) {
+        columnCount += writer->tables[t].columnCount;
+    }
+    tables = calloc(writer->tableCount ? writer->tableCount : 1, sizeof(ChartColumnFileTableEntry));
+    columns = calloc(columnCount ? columnCount : 1, sizeof(ChartColumnFileColumnEntry));
+    temporary = malloc(strlen(path) + 5);
+    if (!tables || !columns || !temporary) {
+        goto done;
+    }
+
+    // Directories first, then the names, then the column data
+    offset = ChartColumnFileHeaderSize + (uint64_t)writer->tableCount * ChartColumnFileEntrySize;
+    for (t = 0, index = 0; t < writer->tableCount; t++) {
+        tables[t].columnsOffset = offset + (uint64_t)index * ChartColumnFileEntrySize;
+        index += writer->tables[t].columnCount;
+    }
+    names = offset + (uint64_t)columnCount * ChartColumnFileEntrySize;
+    offset = names;
+    for (t = 0, index = 0; t < writer->tableCount; t++) {
+        ChartColumnFileWriterTable *table = &writer->tables[t];
+        tables[t].nameOffset = offset;
+        tables[t].nameLength = (uint32_t)strlen(table->name);
+        tables[t].columnCount = (uint32_t)table->columnCount;
+        tables[t].rowCount = table->rowCount;
+        offset += tables[t].nameLength;
+        for (c = 0; c < table->columnCount; c++, index++) {
+            columns[index].nameOffset = offset;
+            columns[index].nameLength = (uint32_t)strlen(table->columns[c].name);
+            columns[index].type = table->columns[c].type;
+            offset += columns[index].nameLength;
+        }
+    }
+    offset = ChartColumnFileAlign(offset);
+    for (t = 0, index = 0; t < writer->tableCount; t++) {
+        for (c = 0; c < writer->tables[t].columnCount; c++, index++) {
+            columns[index].dataOffset = offset;
+            columns[index].dataLength = writer->tables[t].columns[c].length;
+            offset = ChartColumnFileAlign(offset + columns[index].dataLength);
+        }
+    }
+
+    sprintf(temporary, "%s.tmp", path);
+    stream = fopen(temporary, "wb");
+    failure = ChartColumnFileErrorIO;
+    if (!stream) {
+        goto done;
+    }
+
+    uint8_t header[ChartColumnFileHeaderSize];
+    uint32_t version = ChartColumnFileVersion;
+    uint32_t tableCount = (uint32_t)writer->tableCount;
+    uint64_t tablesOffset = ChartColumnFileHeaderSize;
+    memcpy(header, ChartColumnFileMagic, sizeof(ChartColumnFileMagic));
+    memcpy(header + 8, &version, sizeof(version));
+    memcpy(header + 12, &tableCount, sizeof(tableCount));
+    memcpy(header + 16, &tablesOffset, sizeof(tablesOffset));
+
+    offset = 0;
+    if (ChartColumnFileWritePadded(stream, header, sizeof(header), &offset) != 0 ||
+        ChartColumnFileWritePadded(stream, tables, (uint64_t)writer->tableCount * ChartColumnFileEntrySize, &offset) != 0 ||
+        ChartColumnFileWritePadded(stream, columns, (uint64_t)columnCount * ChartColumnFileEntrySize, &offset) != 0) {
+        goto done;
+    }
+    for (t = 0; t < writer->tableCount; t++) {
+        ChartColumnFileWriterTable *table = &writer->tables[t];
+        if (fwrite(table->name, 1, strlen(table->name), stream) != strlen(table->name)) {
+            goto done;
+        }
+        offset += strlen(table->name);
+        for (c = 0; c < table->columnCount; c++) {
+            size_t length = strlen(table->columns[c].name);
+            if (fwrite(table->columns[c].name, 1, length, stream) != length) {
+                goto done;
+            }
+            offset += length;
+        }
+    }
+    if (ChartColumnFileWritePadded(stream, NULL, 0, &offset) != 0) {
+        goto done;
+    }
+    for (t = 0; t < writer->tableCount; t++) {
+        for (c = 0; c < writer->tables[t].columnCount; c++) {
+            ChartColumnFileWriterColumn *column = &writer->tables[t].columns[c];
+            if (ChartColumnFileWritePadded(stream, column->data, column->length, &offset) != 0) {
+                goto done;
+            }
+        }
+    }
+    if (fclose(stream) != 0) {
+        stream = NULL;
+        goto done;
+    }
+    stream = NULL;
+    if (rename(temporary, path) == 0) {
+        failure = ChartColumnFileOK;
+    }
+
+done:
+    if (stream) {
+        fclose(stream);
+    }
+    if (failure != ChartColumnFileOK && temporary) {
+        remove(temporary);
+    }
+    free(temporary);
+    free(tables);
+    free(columns);
+    return failure;
+}
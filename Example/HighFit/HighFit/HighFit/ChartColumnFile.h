@@ -0,0 +1,115 @@
+//
+//  ChartColumnFile.h
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#ifndef ChartColumnFile_h
+#define ChartColumnFile_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A column file holds named tables of typed columns, laid out so that a memory mapped file can be
+// read in place. All integers are little endian and every block starts on an 8 byte boundary:
+//
+//   header    magic "HCCOLS\r\n", uint32 version, uint32 table count, uint64 table directory offset
+//   tables    per table: uint64 name offset, uint32 name length, uint32 column count,
+//             uint64 row count, uint64 column directory offset
+//   columns   per column: uint64 name offset, uint32 name length, uint32 type,
+//             uint64 data offset, uint64 data length
+//   data      number and datetime columns: row count doubles, NaN for empty cells
+//             string columns: row count + 1 uint64 offsets into the UTF-8 bytes that follow them,
+//             an empty string stands for an empty cell
+
+#define ChartColumnFileVersion 1
+
+typedef enum {
+    ChartColumnFileTypeNumber = 0,
+    ChartColumnFileTypeDatetime = 1,
+    ChartColumnFileTypeString = 2
+} ChartColumnFileType;
+
+typedef enum {
+    ChartColumnFileOK = 0,
+    ChartColumnFileErrorIO,
+    ChartColumnFileErrorFormat,
+    ChartColumnFileErrorVersion,
+    ChartColumnFileErrorMemory
+} ChartColumnFileError;
+
+#pragma mark - Reading
+
+typedef struct ChartColumnFile ChartColumnFile;
+
+/**
+ *  Maps the file at path read only and checks its directories. Returns NULL and sets error on failure.
+ */
+ChartColumnFile *ChartColumnFileOpen(const char *path, ChartColumnFileError *error);
+void ChartColumnFileClose(ChartColumnFile *file);
+
+size_t ChartColumnFileTableCount(const ChartColumnFile *file);
+
+/**
+ *  The index of the table named name, -1 when there is none.
+ */
+long ChartColumnFileTableIndex(const ChartColumnFile *file, const char *name);
+
+/**
+ *  Names point into the mapping and are not terminated.
+ */
+const char *ChartColumnFileTableName(const ChartColumnFile *file, size_t table, size_t *length);
+uint64_t ChartColumnFileRowCount(const ChartColumnFile *file, size_t table);
+size_t ChartColumnFileColumnCount(const ChartColumnFile *file, size_t table);
+const char *ChartColumnFileColumnName(const ChartColumnFile *file, size_t table, size_t column, size_t *length);
+ChartColumnFileType ChartColumnFileColumnType(const ChartColumnFile *file, size_t table, size_t column);
+
+/**
+ *  The doubles of a number or datetime column inside the mapping, NULL for string columns.
+ *  Valid until the file is closed.
+ */
+const double *ChartColumnFileValues(const ChartColumnFile *file, size_t table, size_t column);
+
+/**
+ *  A cell of a string column inside the mapping, NULL for other columns.
+ */
+const char *ChartColumnFileString(const ChartColumnFile *file, size_t table, size_t column, uint64_t row, size_t *length);
+
+#pragma mark - Writing
+
+typedef struct ChartColumnFileWriter ChartColumnFileWriter;
+
+ChartColumnFileWriter *ChartColumnFileWriterCreate(void);
+void ChartColumnFileWriterDestroy(ChartColumnFileWriter *writer);
+
+/**
+ *  Adds a table and returns its index, or -1 when out of memory.
+ */
+long ChartColumnFileWriterAddTable(ChartColumnFileWriter *writer, const char *name, uint64_t rowCount);
+
+/**
+ *  Copies a column of rowCount values into the table. Returns 0 or -1 when out of memory.
+ */
+int ChartColumnFileWriterAddValues(ChartColumnFileWriter *writer, long table, const char *name, ChartColumnFileType type, const double *values);
+
+/**
+ *  Copies a column of rowCount strings into the table, NULL strings are empty cells.
+ */
+int ChartColumnFileWriterAddStrings(ChartColumnFileWriter *writer, long table, const char *name, const char *const *strings, const size_t *lengths);
+
+/**
+ *  Writes the file next to path and moves it into place, so readers never map half a file.
+ */
+ChartColumnFileError ChartColumnFileWriterWrite(ChartColumnFileWriter *writer, const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ChartColumnFile_h */
@@ -0,0 +1,40 @@
+//
+//  ChartColumnStore.h
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "ChartDataColumn.h"
+
+/**
+ *  Errors use the ChartColumnFileError codes.
+ */
+extern NSString * const ChartColumnStoreErrorDomain;
+
+/**
+ *  Memory maps a column file written by the chartcolumns tool (Tools/ChartColumnConvert.c).
+ *  Number and datetime columns are handed out as views into the mapping, so opening a store
+ *  costs no parsing and pages are only read in when a column is used.
+ */
+@interface ChartColumnStore : NSObject
+
+/**
+ *  Maps the file at url. Returns nil and sets error when it cannot be read or is not a column file.
+ */
+- (instancetype)initWithURL:(NSURL*)url error:(NSError**)error;
+
+@property (strong, nonatomic, readonly) NSArray<NSString*> *tableNames;
+
+- (NSUInteger)rowCountOfTable:(NSString*)table;
+
+/**
+ *  The columns of table in file order, nil when there is no such table.
+ */
+- (NSArray<ChartDataColumn*>*)columnsOfTable:(NSString*)table;
+
+- (ChartDataColumn*)column:(NSString*)name ofTable:(NSString*)table;
+
+@end
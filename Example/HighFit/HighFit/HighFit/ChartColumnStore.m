@@ -0,0 +1,136 @@
+//
+//  ChartColumnStore.m
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import "ChartColumnStore.h"
+#import "ChartColumnFile.h"
+
+NSString * const ChartColumnStoreErrorDomain = @"ChartColumnStoreErrorDomain";
+
+// Owns the mapping, which stays until the store and every column handed out are gone
+@interface ChartColumnFileMapping : NSObject
+@property (assign, nonatomic) ChartColumnFile *file;
+@end
+
+@implementation ChartColumnFileMapping
+
+- (void)dealloc
+{
+    ChartColumnFileClose(self.file);
+}
+
+@end
+
+@interface ChartColumnStore ()
+@property (strong, nonatomic) ChartColumnFileMapping *mapping;
+@property (strong, nonatomic, readwrite) NSArray<NSString*> *tableNames;
+@end
+
+@implementation ChartColumnStore
+
+static NSString *ChartColumnStoreString(const char *bytes, size_t length)
+{
+    return [[NSString alloc] initWithBytes:bytes length:length encoding:NSUTF8StringEncoding] ?: @"";
+}
+
+- (instancetype)initWithURL:(NSURL*)url error:(NSError**)error
+{
+    self = [super init];
+    if (self) {
+        ChartColumnFileError failure = ChartColumnFileErrorIO;
+        ChartColumnFile *file = url.isFileURL ? ChartColumnFileOpen(url.fileSystemRepresentation, &failure) : NULL;
+        if (!file) {
+            if (error) {
+                *error = [NSError errorWithDomain:ChartColumnStoreErrorDomain code:failure userInfo:@{ NSURLErrorKey: url ?: [NSNull null] }];
+            }
+            return nil;
+        }
+        self.mapping = [[ChartColumnFileMapping alloc] init];
+        self.mapping.file = file;
+
+        NSMutableArray *names = [NSMutableArray array];
+        for (size_t table = 0; table < ChartColumnFileTableCount(file); table++) {
+            size_t length = 0;
+            const char *name = ChartColumnFileTableName(file, table, &length);
+            [names addObject:ChartColumnStoreString(name, length)];
+        }
+        self.tableNames = names;
+    }
+    return self;
+}
+
+- (long)indexOfTable:(NSString*)table
+{
+    NSUInteger index = [self.tableNames indexOfObject:table];
+    return index == NSNotFound ? -1 : (long)index;
+}
+
+- (NSUInteger)rowCountOfTable:(NSString*)table
+{
+    long index = [self indexOfTable:table];
+    return index < 0 ? 0 : (NSUInteger)ChartColumnFileRowCount(self.mapping.file, (size_t)index);
+}
+
+- (ChartDataColumn*)columnAtIndex:(size_t)column ofTableAtIndex:(size_t)table
+{
+    ChartColumnFile *file = self.mapping.file;
+    NSUInteger rows = (NSUInteger)ChartColumnFileRowCount(file, table);
+    size_t length = 0;
+    const char *bytes = ChartColumnFileColumnName(file, table, column, &length);
+    NSString *name = ChartColumnStoreString(bytes, length);
+
+    const double *values = ChartColumnFileValues(file, table, column);
+    if (values) {
+        ChartColumnFileMapping *mapping = self.mapping;
+        NSData *data = [[NSData alloc] initWithBytesNoCopy:(void *)values length:rows * sizeof(double) deallocator:^(void *valueBytes, NSUInteger valueLength) {
+            (void)mapping;
+        }];
+        ChartDataColumnType type = ChartColumnFileColumnType(file, table, column) == ChartColumnFileTypeDatetime ? ChartDataColumnTypeDatetime : ChartDataColumnTypeNumber;
+        return [[ChartDataColumn alloc] initWithName:name type:type values:data];
+    }
+
+    // Strings are boxed once, they are rarely the large columns
+    NSMutableArray *strings = [NSMutableArray arrayWithCapacity:rows];
+    for (NSUInteger row = 0; row < rows; row++) {
+        const char *cell = ChartColumnFileString(file, table, column, row, &length);
+        [strings addObject:cell && length ? ChartColumnStoreString(cell, length) : [NSNull null]];
+    }
+    return [[ChartDataColumn alloc] initWithName:name strings:strings];
+}
+
+- (NSArray<ChartDataColumn*>*)columnsOfTable:(NSString*)table
+{
+    long index = [self indexOfTable:table];
+    if (index < 0) {
+        return nil;
+    }
+    size_t count = ChartColumnFileColumnCount(self.mapping.file, (size_t)index);
+    NSMutableArray *columns = [NSMutableArray arrayWithCapacity:count];
+    for (size_t column = 0; column < count; column++) {
+        [columns addObject:[self columnAtIndex:column ofTableAtIndex:(size_t)index]];
+    }
+    return columns;
+}
+
+- (ChartDataColumn*)column:(NSString*)name ofTable:(NSString*)table
+{
+    long index = [self indexOfTable:table];
+    if (index < 0) {
+        return nil;
+    }
+    size_t count = ChartColumnFileColumnCount(self.mapping.file, (size_t)index);
+    for (size_t column = 0; column < count; column++) {
+        size_t length = 0;
+        const char *bytes = ChartColumnFileColumnName(self.mapping.file, (size_t)index, column, &length);
+        if ([ChartColumnStoreString(bytes, length) isEqualToString:name]) {
+            return [self columnAtIndex:column ofTableAtIndex:(size_t)index];
+        }
+    }
+    return nil;
+}
+
+@end
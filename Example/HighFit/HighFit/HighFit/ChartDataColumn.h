@@ -0,0 +1,73 @@
+//
+//  ChartDataColumn.h
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <Highcharts/Highcharts.h>
+
+typedef NS_ENUM(NSInteger, ChartDataColumnType) {
+    ChartDataColumnTypeNumber,
+    ChartDataColumnTypeDatetime,
+    ChartDataColumnTypeString
+};
+
+/**
+ *  A typed column of a data table. Numbers and dates, in milliseconds since 1970, are stored
+ *  unboxed as doubles, with NaN for empty cells.
+ */
+@interface ChartDataColumn : NSObject
+
+/**
+ *  Creates a number or datetime column from a buffer of doubles.
+ */
+- (instancetype)initWithName:(NSString*)name type:(ChartDataColumnType)type values:(NSData*)values;
+
+/**
+ *  Creates a string column, with NSNull for empty cells.
+ */
+- (instancetype)initWithName:(NSString*)name strings:(NSArray*)strings;
+
+@property (strong, nonatomic, readonly) NSString *name;
+@property (assign, nonatomic, readonly) ChartDataColumnType type;
+@property (assign, nonatomic, readonly) NSUInteger count;
+
+/**
+ *  The doubles of a number or datetime column, nil for string columns.
+ */
+@property (strong, nonatomic, readonly) NSData *values;
+
+/**
+ *  The cells of a string column, nil for number and datetime columns.
+ */
+@property (strong, nonatomic, readonly) NSArray *strings;
+
+/**
+ *  NaN for empty cells and string columns.
+ */
+- (double)valueAtIndex:(NSUInteger)index;
+
+/**
+ *  An NSNumber, NSString or NSNull, ready for the data of a series.
+ */
+- (id)objectAtIndex:(NSUInteger)index;
+
+/**
+ *  The rows in range. Number and datetime slices share the storage of the receiver without copying.
+ */
+- (ChartDataColumn*)columnWithRange:(NSRange)range;
+
+/**
+ *  One series per column after the x column, named after the column.
+ */
++ (NSArray<HISeries*>*)seriesWithColumns:(NSArray<ChartDataColumn*>*)columns type:(NSString*)type;
+
+/**
+ *  Sets the series of options from columns, and the type of the first x axis from the x column.
+ */
++ (void)applyColumns:(NSArray<ChartDataColumn*>*)columns toOptions:(HIOptions*)options type:(NSString*)type;
+
+@end
@@ -0,0 +1,133 @@
+//
+//  ChartDataColumn.m
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import "ChartDataColumn.h"
+
+@interface ChartDataColumn ()
+@property (strong, nonatomic, readwrite) NSString *name;
+@property (assign, nonatomic, readwrite) ChartDataColumnType type;
+@property (strong, nonatomic, readwrite) NSData *values;
+@property (strong, nonatomic, readwrite) NSArray *strings;
+@end
+
+@implementation ChartDataColumn
+
+- (instancetype)initWithName:(NSString*)name type:(ChartDataColumnType)type values:(NSData*)values
+{
+    self = [super init];
+    if (self) {
+        self.name = name;
+        self.type = type == ChartDataColumnTypeString ? ChartDataColumnTypeNumber : type;
+        self.values = values ?: [NSData data];
+    }
+    return self;
+}
+
+- (instancetype)initWithName:(NSString*)name strings:(NSArray*)strings
+{
+    self = [super init];
+    if (self) {
+        self.name = name;
+        self.type = ChartDataColumnTypeString;
+        self.strings = strings ?: @[];
+    }
+    return self;
+}
+
+- (NSUInteger)count
+{
+    return self.strings ? self.strings.count : self.values.length / sizeof(double);
+}
+
+- (double)valueAtIndex:(NSUInteger)index
+{
+    if (!self.values || index >= self.count) {
+        return NAN;
+    }
+    return ((const double *)self.values.bytes)[index];
+}
+
+- (id)objectAtIndex:(NSUInteger)index
+{
+    if (self.strings) {
+        return index < self.strings.count ? self.strings[index] : [NSNull null];
+    }
+    double value = [self valueAtIndex:index];
+    return isnan(value) ? [NSNull null] : @(value);
+}
+
+- (ChartDataColumn*)columnWithRange:(NSRange)range
+{
+    range = NSIntersectionRange(range, NSMakeRange(0, self.count));
+    if (self.strings) {
+        return [[ChartDataColumn alloc] initWithName:self.name strings:[self.strings subarrayWithRange:range]];
+    }
+
+    NSData *values = self.values;
+    void *bytes = (void *)((const double *)values.bytes + range.location);
+    NSData *slice = [[NSData alloc] initWithBytesNoCopy:bytes length:range.length * sizeof(double) deallocator:^(void *sliceBytes, NSUInteger length) {
+        // The slice keeps the buffer it points into alive
+        (void)values;
+    }];
+    return [[ChartDataColumn alloc] initWithName:self.name type:self.type values:slice];
+}
+
+#pragma mark - Series
+
++ (NSArray<HISeries*>*)seriesWithColumns:(NSArray<ChartDataColumn*>*)columns type:(NSString*)type
+{
+    ChartDataColumn *x = columns.count > 1 ? columns.firstObject : nil;
+    NSArray *yColumns = x ? [columns subarrayWithRange:NSMakeRange(1, columns.count - 1)] : columns;
+    NSMutableArray *series = [NSMutableArray arrayWithCapacity:yColumns.count];
+
+    for (ChartDataColumn *column in yColumns) {
+        NSMutableArray *data = [NSMutableArray arrayWithCapacity:column.count];
+        for (NSUInteger i = 0; i < column.count; i++) {
+            double value = [column valueAtIndex:i];
+            id y = isnan(value) ? [NSNull null] : @(value);
+            [data addObject:x ? @[ [x objectAtIndex:i], y ] : y];
+        }
+
+        HISeries *item = [[HISeries alloc] init];
+        item.type = type;
+        item.name = column.name;
+        item.data = data;
+        if (x.type == ChartDataColumnTypeString) {
+            // The turbo path only takes numeric x values, so long category series must skip it
+            item.turboThreshold = @0;
+        }
+        [series addObject:item];
+    }
+    return series;
+}
+
++ (void)applyColumns:(NSArray<ChartDataColumn*>*)columns toOptions:(HIOptions*)options type:(NSString*)type
+{
+    options.series = [self seriesWithColumns:columns type:type];
+    if (columns.count < 2) {
+        return;
+    }
+
+    HIXAxis *xAxis = options.xAxis.firstObject;
+    if (!xAxis) {
+        xAxis = [[HIXAxis alloc] init];
+        options.xAxis = @[ xAxis ];
+    }
+    switch (columns.firstObject.type) {
+        case ChartDataColumnTypeDatetime:
+            xAxis.type = @"datetime";
+            break;
+        case ChartDataColumnTypeString:
+            xAxis.type = @"category";
+            break;
+        default:
+            break;
+    }
+}
+
+@end
@@ -0,0 +1,79 @@
+//
+//  ChartDataExporter.h
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <Highcharts/Highcharts.h>
+#import "ChartDataColumn.h"
+
+typedef NS_ENUM(NSInteger, ChartDataExportFormat) {
+    ChartDataExportFormatCSV,
+    ChartDataExportFormatXLS
+};
+
+/**
+ *  Writes columns as the export-data module's downloadCSV and downloadXLS do for the chart
+ *  applyColumns:toOptions:type: builds from them, without a web view and without the whole file
+ *  in memory. Rows are formatted a chunk at a time and written to a stream, so large tables can
+ *  be exported on a background queue while the chart stays responsive.
+ */
+@interface ChartDataExporter : NSObject
+
+/**
+ *  Creates an exporter for columns, x column first, using the csv options of exporting, the
+ *  title of the first x axis and the names of the series in options. Options may be nil.
+ */
+- (instancetype)initWithColumns:(NSArray<ChartDataColumn*>*)columns options:(HIOptions*)options;
+
+@property (strong, nonatomic, readonly) NSArray<ChartDataColumn*> *columns;
+
+/**
+ *  Default to the exporting.csv defaults: ",", "\n" and "%Y-%m-%d %H:%M:%S".
+ */
+@property (strong, nonatomic) NSString *itemDelimiter;
+@property (strong, nonatomic) NSString *lineDelimiter;
+@property (strong, nonatomic) NSString *dateFormat;
+
+/**
+ *  The header of the x column. Defaults to the axis title, else "DateTime" or "Category".
+ */
+@property (strong, nonatomic) NSString *xTitle;
+
+/**
+ *  The headers of the other columns. Default to the series names, else the column names.
+ */
+@property (strong, nonatomic) NSArray<NSString*> *seriesNames;
+
+/**
+ *  Whether dates are formatted in UTC, like the useUTC global option. Defaults to YES.
+ */
+@property (assign, nonatomic) BOOL useUTC;
+
+/**
+ *  The decimal point of numbers. Defaults to "," when the current locale uses it, as the
+ *  downloads do, else ".".
+ */
+@property (strong, nonatomic) NSString *decimalPoint;
+
+/**
+ *  Rows formatted between writes and progress updates. Defaults to 4096.
+ */
+@property (assign, nonatomic) NSUInteger rowsPerChunk;
+
+/**
+ *  Writes the file synchronously to an open stream, counting rows in progress, which may be nil.
+ *  Returns NO and sets error when the stream fails or progress is cancelled.
+ */
+- (BOOL)writeFormat:(ChartDataExportFormat)format toStream:(NSOutputStream*)stream progress:(NSProgress*)progress error:(NSError**)error;
+
+/**
+ *  Writes the file to url on a background queue and calls completion on the main queue. The
+ *  returned progress counts rows and cancels the export, which removes the partial file.
+ */
+- (NSProgress*)exportFormat:(ChartDataExportFormat)format toURL:(NSURL*)url completion:(void (^)(NSError *error))completion;
+
+@end
@@ -0,0 +1,384 @@
+//
+//  ChartDataExporter.m
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import "ChartDataExporter.h"
+#import "ChartValueFormatter.h"
+
+// The page downloadXLS wraps the table in, copied from export-data
+static const char ChartDataExporterXLSHead[] =
+    "<html xmlns:o=\"urn:schemas-microsoft-com:office:office\" xmlns:x=\"urn:schemas-microsoft-com:office:excel\" xmlns=\"http://www.w3.org/TR/REC-html40\">"
+    "<head><!--[if gte mso 9]><xml><x:ExcelWorkbook><x:ExcelWorksheets><x:ExcelWorksheet><x:Name>Ark1</x:Name><x:WorksheetOptions><x:DisplayGridlines/>"
+    "</x:WorksheetOptions></x:ExcelWorksheet></x:ExcelWorksheets></x:ExcelWorkbook></xml><![endif]-->"
+    "<style>td{border:none;font-family: Calibri, sans-serif;} .number{mso-number-format:\"0.00\";} .text{ mso-number-format:\"@\";}</style>"
+    "<meta name=ProgId content=Excel.Sheet><meta charset=UTF-8></head><body>";
+
+static const char ChartDataExporterXLSTail[] = "</body></html>";
+
+// downloadCSV puts a byte order mark in front so spreadsheets read the file as UTF-8
+static const char ChartDataExporterByteOrderMark[] = "\xEF\xBB\xBF";
+
+typedef struct {
+    double x;
+    NSUInteger index;
+} ChartDataExporterRow;
+
+static int ChartDataExporterCompareRows(const void *a, const void *b)
+{
+    const ChartDataExporterRow *left = a, *right = b;
+    if (left->x != right->x) {
+        return left->x < right->x ? -1 : 1;
+    }
+    // Keeps the sort stable, like the one getDataRows runs
+    return left->index < right->index ? -1 : (left->index > right->index ? 1 : 0);
+}
+
+@interface ChartDataExporter ()
+@property (strong, nonatomic, readwrite) NSArray<ChartDataColumn*> *columns;
+@property (assign, nonatomic) char decimal;
+@end
+
+@implementation ChartDataExporter
+
+- (instancetype)initWithColumns:(NSArray<ChartDataColumn*>*)columns options:(HIOptions*)options
+{
+    self = [super init];
+    if (self) {
+        self.columns = columns ?: @[];
+        HICsv *csv = options.exporting.csv;
+        self.itemDelimiter = csv.itemDelimiter ?: @",";
+        self.lineDelimiter = csv.lineDelimiter ?: @"\n";
+        self.dateFormat = csv.dateFormat ?: @"%Y-%m-%d %H:%M:%S";
+        self.xTitle = options.xAxis.firstObject.title.text;
+        self.useUTC = YES;
+        self.rowsPerChunk = 4096;
+        // (1.1).toLocaleString()[1] in the page
+        self.decimalPoint = [[[NSLocale currentLocale] objectForKey:NSLocaleDecimalSeparator] isEqualToString:@","] ? @"," : @".";
+
+        NSMutableArray *names = [NSMutableArray array];
+        for (HISeries *series in options.series) {
+            [names addObject:series.name ?: [NSNull null]];
+        }
+        self.seriesNames = names;
+    }
+    return self;
+}
+
+#pragma mark - Rows
+
+- (ChartDataColumn*)xColumn
+{
+    return self.columns.count > 1 ? self.columns.firstObject : nil;
+}
+
+- (NSArray<ChartDataColumn*>*)yColumns
+{
+    return self.columns.count > 1 ? [self.columns subarrayWithRange:NSMakeRange(1, self.columns.count - 1)] : self.columns;
+}
+
+- (NSUInteger)rowCount
+{
+    NSUInteger count = 0;
+    for (ChartDataColumn *column in self.columns) {
+        count = MAX(count, column.count);
+    }
+    return count;
+}
+
+/**
+ *  The table rows to write, in order. getDataRows keys rows by x, so series that require sorting
+ *  keep one row per x value, holding the values of the last point with it, and sorts them by x.
+ *  Categories are the unique names in the order they first appear.
+ */
+- (NSData*)rowOrder
+{
+    ChartDataColumn *x = [self xColumn];
+    NSUInteger count = [self rowCount];
+    NSMutableData *order = [NSMutableData dataWithLength:count * sizeof(NSUInteger)];
+    NSUInteger *indexes = order.mutableBytes;
+    NSUInteger written = 0;
+
+    if (!x) {
+        for (NSUInteger i = 0; i < count; i++) {
+            indexes[i] = i;
+        }
+        return order;
+    }
+
+    if (x.type == ChartDataColumnTypeString) {
+        NSMutableDictionary<NSString*, NSNumber*> *positions = [NSMutableDictionary dictionary];
+        for (NSUInteger i = 0; i < count; i++) {
+            id name = [x objectAtIndex:i];
+            NSNumber *position = [name isKindOfClass:[NSString class]] ? positions[name] : nil;
+            if (position) {
+                indexes[position.unsignedIntegerValue] = i;
+                continue;
+            }
+            if ([name isKindOfClass:[NSString class]]) {
+                positions[name] = @(written);
+            }
+            indexes[written++] = i;
+        }
+        order.length = written * sizeof(NSUInteger);
+        return order;
+    }
+
+    // Points without an x value have no row
+    ChartDataExporterRow *rows = malloc(MAX(count, 1) * sizeof(ChartDataExporterRow));
+    NSUInteger rowCount = 0;
+    BOOL sorted = YES;
+    for (NSUInteger i = 0; i < count; i++) {
+        double value = [x valueAtIndex:i];
+        if (isnan(value)) {
+            continue;
+        }
+        if (rowCount && value < rows[rowCount - 1].x) {
+            sorted = NO;
+        }
+        rows[rowCount].x = value;
+        rows[rowCount].index = i;
+        rowCount++;
+    }
+    if (!sorted) {
+        qsort(rows, rowCount, sizeof(ChartDataExporterRow), ChartDataExporterCompareRows);
+    }
+    for (NSUInteger i = 0; i < rowCount; i++) {
+        if (written && rows[i].x == rows[i - 1].x) {
+            indexes[written - 1] = rows[i].index;
+        }
+        else {
+            indexes[written++] = rows[i].index;
+        }
+    }
+    free(rows);
+    order.length = written * sizeof(NSUInteger);
+    return order;
+}
+
+- (NSArray<NSString*>*)headers
+{
+    NSMutableArray *headers = [NSMutableArray array];
+    ChartDataColumn *x = [self xColumn];
+    [headers addObject:self.xTitle ?: (x.type == ChartDataColumnTypeDatetime ? @"DateTime" : @"Category")];
+
+    NSArray *yColumns = [self yColumns];
+    for (NSUInteger i = 0; i < yColumns.count; i++) {
+        id name = i < self.seriesNames.count ? self.seriesNames[i] : nil;
+        if (![name isKindOfClass:[NSString class]]) {
+            name = [yColumns[i] name] ?: [NSString stringWithFormat:@"Series %lu", (unsigned long)i + 1];
+        }
+        [headers addObject:name];
+    }
+    return headers;
+}
+
+#pragma mark - Cells
+
+static void ChartDataExporterAppend(NSMutableData *buffer, const char *bytes, size_t length)
+{
+    [buffer appendBytes:bytes length:length];
+}
+
+static void ChartDataExporterAppendString(NSMutableData *buffer, const char *string)
+{
+    [buffer appendBytes:string length:strlen(string)];
+}
+
+- (void)appendText:(const char *)text toBuffer:(NSMutableData*)buffer format:(ChartDataExportFormat)format header:(BOOL)header
+{
+    if (format == ChartDataExportFormatCSV) {
+        // Neither quotes nor markup are escaped by export-data
+        ChartDataExporterAppend(buffer, "\"", 1);
+        ChartDataExporterAppendString(buffer, text);
+        ChartDataExporterAppend(buffer, "\"", 1);
+        return;
+    }
+    ChartDataExporterAppendString(buffer, header ? "<th class=\"text\">" : "<td class=\"text\">");
+    ChartDataExporterAppendString(buffer, text);
+    ChartDataExporterAppendString(buffer, header ? "</th>" : "</td>");
+}
+
+- (void)appendNumber:(double)value toBuffer:(NSMutableData*)buffer format:(ChartDataExportFormat)format
+{
+    char digits[ChartNumberBufferSize];
+    if (isnan(value)) {
+        // A null point value, empty when joined into a line and "null" in a table cell
+        if (format == ChartDataExportFormatXLS) {
+            ChartDataExporterAppendString(buffer, "<td class=\"text\">null</td>");
+        }
+        return;
+    }
+    size_t length = ChartFormatNumber(value, self.decimal, digits);
+    if (format == ChartDataExportFormatCSV) {
+        ChartDataExporterAppend(buffer, digits, length);
+        return;
+    }
+    ChartDataExporterAppendString(buffer, "<td class=\"number\">");
+    ChartDataExporterAppend(buffer, digits, length);
+    ChartDataExporterAppendString(buffer, "</td>");
+}
+
+- (void)appendX:(NSUInteger)row toBuffer:(NSMutableData*)buffer format:(ChartDataExportFormat)format
+{
+    ChartDataColumn *x = [self xColumn];
+    if (!x) {
+        [self appendNumber:row toBuffer:buffer format:format];
+        return;
+    }
+    switch (x.type) {
+        case ChartDataColumnTypeDatetime: {
+            char date[128];
+            const char *dateFormat = self.dateFormat.UTF8String ?: "";
+            size_t length = ChartFormatDate([x valueAtIndex:row], dateFormat, self.useUTC, date, sizeof(date));
+            if (length < sizeof(date)) {
+                [self appendText:date toBuffer:buffer format:format header:NO];
+            }
+            else {
+                char *longDate = malloc(length + 1);
+                ChartFormatDate([x valueAtIndex:row], dateFormat, self.useUTC, longDate, length + 1);
+                [self appendText:longDate toBuffer:buffer format:format header:NO];
+                free(longDate);
+            }
+            break;
+        }
+        case ChartDataColumnTypeString: {
+            id name = [x objectAtIndex:row];
+            [self appendText:[name isKindOfClass:[NSString class]] ? [name UTF8String] : "" toBuffer:buffer format:format header:NO];
+            break;
+        }
+        default:
+            [self appendNumber:[x valueAtIndex:row] toBuffer:buffer format:format];
+            break;
+    }
+}
+
+#pragma mark - Writing
+
+- (BOOL)writeBuffer:(NSMutableData*)buffer toStream:(NSOutputStream*)stream error:(NSError**)error
+{
+    const uint8_t *bytes = buffer.bytes;
+    NSUInteger remaining = buffer.length;
+    while (remaining > 0) {
+        NSInteger written = [stream write:bytes maxLength:remaining];
+        if (written <= 0) {
+            if (error) {
+                *error = stream.streamError ?: [NSError errorWithDomain:NSPOSIXErrorDomain code:EIO userInfo:nil];
+            }
+            return NO;
+        }
+        bytes += written;
+        remaining -= (NSUInteger)written;
+    }
+    buffer.length = 0;
+    return YES;
+}
+
+- (BOOL)writeFormat:(ChartDataExportFormat)format toStream:(NSOutputStream*)stream progress:(NSProgress*)progress error:(NSError**)error
+{
+    self.decimal = self.decimalPoint.length ? (char)[self.decimalPoint characterAtIndex:0] : '.';
+    // Only a ',' locale changes the numbers of the downloads
+    if (self.decimal != ',') {
+        self.decimal = '.';
+    }
+    NSData *order = [self rowOrder];
+    const NSUInteger *rows = order.bytes;
+    NSUInteger rowCount = order.length / sizeof(NSUInteger);
+    NSArray<ChartDataColumn*> *yColumns = [self yColumns];
+    NSUInteger chunk = MAX(self.rowsPerChunk, 1);
+    const char *itemDelimiter = self.itemDelimiter.UTF8String ?: ",";
+    const char *lineDelimiter = self.lineDelimiter.UTF8String ?: "\n";
+    BOOL csv = format == ChartDataExportFormatCSV;
+    NSMutableData *buffer = [NSMutableData dataWithCapacity:64 * 1024];
+
+    progress.totalUnitCount = (int64_t)rowCount;
+
+    // The header row
+    if (csv) {
+        ChartDataExporterAppendString(buffer, ChartDataExporterByteOrderMark);
+    }
+    else {
+        ChartDataExporterAppendString(buffer, ChartDataExporterXLSHead);
+        ChartDataExporterAppendString(buffer, "<table><thead><tr>");
+    }
+    NSArray *headers = [self headers];
+    for (NSUInteger i = 0; i < headers.count; i++) {
+        if (csv && i) {
+            ChartDataExporterAppendString(buffer, itemDelimiter);
+        }
+        [self appendText:[headers[i] UTF8String] ?: "" toBuffer:buffer format:format header:YES];
+    }
+    ChartDataExporterAppendString(buffer, csv ? "" : "</tr></thead><tbody>");
+
+    BOOL success = YES;
+    for (NSUInteger start = 0; start < rowCount && success; start += chunk) {
+        @autoreleasepool {
+            NSUInteger end = MIN(start + chunk, rowCount);
+            for (NSUInteger i = start; i < end; i++) {
+                NSUInteger row = rows[i];
+                if (csv) {
+                    ChartDataExporterAppendString(buffer, lineDelimiter);
+                }
+                else {
+                    ChartDataExporterAppendString(buffer, "<tr>");
+                }
+                [self appendX:row toBuffer:buffer format:format];
+                for (ChartDataColumn *column in yColumns) {
+                    if (csv) {
+                        ChartDataExporterAppendString(buffer, itemDelimiter);
+                    }
+                    [self appendNumber:[column valueAtIndex:row] toBuffer:buffer format:format];
+                }
+                if (!csv) {
+                    ChartDataExporterAppendString(buffer, "</tr>");
+                }
+            }
+            success = [self writeBuffer:buffer toStream:stream error:error];
+            progress.completedUnitCount = (int64_t)end;
+        }
+        if (progress.cancelled) {
+            if (error) {
+                *error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSUserCancelledError userInfo:nil];
+            }
+            return NO;
+        }
+    }
+    if (!success) {
+        return NO;
+    }
+
+    if (!csv) {
+        ChartDataExporterAppendString(buffer, "</tbody></table>");
+        ChartDataExporterAppendString(buffer, ChartDataExporterXLSTail);
+    }
+    return [self writeBuffer:buffer toStream:stream error:error];
+}
+
+- (NSProgress*)exportFormat:(ChartDataExportFormat)format toURL:(NSURL*)url completion:(void (^)(NSError *error))completion
+{
+    NSProgress *progress = [NSProgress progressWithTotalUnitCount:(int64_t)[self rowCount]];
+    progress.cancellable = YES;
+
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSError *error = nil;
+        NSOutputStream *stream = [NSOutputStream outputStreamWithURL:url append:NO];
+        [stream open];
+        BOOL success = stream && stream.streamStatus == NSStreamStatusOpen && [self writeFormat:format toStream:stream progress:progress error:&error];
+        [stream close];
+        if (!success) {
+            error = error ?: stream.streamError ?: [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileWriteUnknownError userInfo:@{ NSURLErrorKey: url ?: [NSNull null] }];
+            [[NSFileManager defaultManager] removeItemAtURL:url error:nil];
+        }
+        if (completion) {
+            dispatch_async(dispatch_get_main_queue(), ^{
+                completion(error);
+            });
+        }
+    });
+    return progress;
+}
+
+@end
@@ -0,0 +1,267 @@
+//
+//  ChartPNGWriter.c
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#include "ChartPNGWriter.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+#define ChartPNGChunkSize 65536
+
+struct ChartPNGWriter {
+    uint32_t width;
+    uint32_t height;
+    uint32_t row;
+    int channels;
+    size_t rowLength;
+    ChartPNGWriteFunction write;
+    void *context;
+    bool failed;
+
+    // The unfiltered current and previous rows, and one candidate per filter type, each with its
+    // filter byte in front
+    uint8_t *current;
+    uint8_t *previous;
+    uint8_t *filtered[5];
+
+    z_stream stream;
+    bool streamReady;
+    uint8_t *chunk;
+};
+
+#pragma mark - Chunks
+
+static void ChartPNGPutUInt32(uint8_t *bytes, uint32_t value)
+{
+    bytes[0] = (uint8_t)(value >> 24);
+    bytes[1] = (uint8_t)(value >> 16);
+    bytes[2] = (uint8_t)(value >> 8);
+    bytes[3] = (uint8_t)value;
+}
+
+static bool ChartPNGWriteChunk(ChartPNGWriter *writer, const char *type, const uint8_t *data, uint32_t length)
+{
+    uint8_t header[8], footer[4];
+    ChartPNGPutUInt32(header, length);
+    memcpy(header + 4, type, 4);
+
+    uLong crc = crc32(0L, Z_NULL, 0);
+    crc = crc32(crc, (const Bytef *)type, 4);
+    if (length) {
+        crc = crc32(crc, data, length);
+    }
+    ChartPNGPutUInt32(footer, (uint32_t)crc);
+
+    if (writer->failed ||
+        !writer->write(header, sizeof(header), writer->context) ||
+        (length && !writer->write(data, length, writer->context)) ||
+        !writer->write(footer, sizeof(footer), writer->context)) {
+        writer->failed = true;
+        return false;
+    }
+    return true;
+}
+
+// Deflates input, writing an IDAT chunk each time the chunk buffer fills, and all that is left on
+// Z_FINISH
+static bool ChartPNGDeflate(ChartPNGWriter *writer, const uint8_t *input, size_t length, int flush)
+{
+    z_stream *stream = &writer->stream;
+    stream->next_in = (Bytef *)input;
+    stream->avail_in = (uInt)length;
+
+    do {
+        int result = deflate(stream, flush);
+        if (result == Z_STREAM_ERROR) {
+            writer->failed = true;
+            return false;
+        }
+        bool full = stream->avail_out == 0;
+        if (full || (flush == Z_FINISH && stream->avail_out < ChartPNGChunkSize)) {
+            if (!ChartPNGWriteChunk(writer, "IDAT", writer->chunk, ChartPNGChunkSize - stream->avail_out)) {
+                return false;
+            }
+            stream->next_out = writer->chunk;
+            stream->avail_out = ChartPNGChunkSize;
+        }
+        if (flush == Z_FINISH && result == Z_STREAM_END) {
+            break;
+        }
+    } while (stream->avail_in > 0 || flush == Z_FINISH);
+    return true;
+}
+
+#pragma mark - Filters
+
+static uint8_t ChartPNGPaeth(int a, int b, int c)
+{
+    int p = a + b - c;
+    int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+    if (pa <= pb && pa <= pc) {
+        return (uint8_t)a;
+    }
+    return (uint8_t)(pb <= pc ? b : c);
+}
+
+// Filters the current row with each of the five filters and returns the one with the smallest sum
+// of absolute values, the heuristic of the PNG specification
+static const uint8_t *ChartPNGFilterRow(ChartPNGWriter *writer)
+{
+    const uint8_t *row = writer->current + 1, *above = writer->previous + 1;
+    size_t length = writer->rowLength;
+    int bpp = writer->channels;
+    unsigned long best = ~0UL;
+    const uint8_t *chosen = writer->filtered[0];
+
+    for (int type = 0; type < 5; type++) {
+        uint8_t *out = writer->filtered[type];
+        unsigned long sum = 0;
+        out[0] = (uint8_t)type;
+        for (size_t i = 0; i < length; i++) {
+            int left = i >= (size_t)bpp ? row[i - bpp] : 0;
+            int up = above[i];
+            int upLeft = i >= (size_t)bpp ? above[i - bpp] : 0;
+            uint8_t value;
+            switch (type) {
+                case 0: value = row[i]; break;
+                case 1: value = (uint8_t)(row[i] - left); break;
+                case 2: value = (uint8_t)(row[i] - up); break;
+                case 3: value = (uint8_t)(row[i] - ((left + up) >> 1)); break;
+                default: value = (uint8_t)(row[i] - ChartPNGPaeth(left, up, upLeft)); break;
+            }
+            out[i + 1] = value;
+            sum += value < 128 ? value : 256 - value;
+        }
+        if (sum < best) {
+            best = sum;
+            chosen = out;
+        }
+    }
+    return chosen;
+}
+
+// Converts premultiplied B, G, R, A pixels to straight R, G, B(, A), rounding to nearest
+static void ChartPNGConvertRow(ChartPNGWriter *writer, const uint8_t *pixels)
+{
+    uint8_t *out = writer->current + 1;
+    for (uint32_t x = 0; x < writer->width; x++, pixels += 4) {
+        unsigned alpha = pixels[3];
+        unsigned b = pixels[0], g = pixels[1], r = pixels[2];
+        if (alpha && alpha < 255) {
+            r = (r * 255 + alpha / 2) / alpha;
+            g = (g * 255 + alpha / 2) / alpha;
+            b = (b * 255 + alpha / 2) / alpha;
+            r = r > 255 ? 255 : r;
+            g = g > 255 ? 255 : g;
+            b = b > 255 ? 255 : b;
+        }
+        *out++ = (uint8_t)r;
+        *out++ = (uint8_t)g;
+        *out++ = (uint8_t)b;
+        if (writer->channels == 4) {
+            *out++ = (uint8_t)alpha;
+        }
+    }
+}
+
+#pragma mark - Writer
+
+ChartPNGWriter *ChartPNGWriterCreate(uint32_t width, uint32_t height, bool opaque, int level,
+                                     ChartPNGWriteFunction write, void *context)
+{
+    if (!width || !height || !write || width > 0x7fffffff / 4 || height > 0x7fffffff) {
+        return NULL;
+    }
+    ChartPNGWriter *writer = calloc(1, sizeof(ChartPNGWriter));
+    if (!writer) {
+        return NULL;
+    }
+    writer->width = width;
+    writer->height = height;
+    writer->channels = opaque ? 3 : 4;
+    writer->rowLength = (size_t)width * (size_t)writer->channels;
+    writer->write = write;
+    writer->context = context;
+
+    writer->current = calloc(writer->rowLength + 1, 1);
+    writer->previous = calloc(writer->rowLength + 1, 1);
+    writer->chunk = malloc(ChartPNGChunkSize);
+    bool allocated = writer->current && writer->previous && writer->chunk;
+    for (int i = 0; i < 5; i++) {
+        writer->filtered[i] = malloc(writer->rowLength + 1);
+        allocated = allocated && writer->filtered[i];
+    }
+    if (!allocated || deflateInit(&writer->stream, level) != Z_OK) {
+        ChartPNGWriterFree(writer);
+        return NULL;
+    }
+    writer->streamReady = true;
+    writer->stream.next_out = writer->chunk;
+    writer->stream.avail_out = ChartPNGChunkSize;
+
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    uint8_t header[13];
+    ChartPNGPutUInt32(header, width);
+    ChartPNGPutUInt32(header + 4, height);
+    header[8] = 8;                      // bit depth
+    header[9] = opaque ? 2 : 6;         // truecolor, with alpha unless opaque
+    header[10] = 0;                     // deflate
+    header[11] = 0;                     // adaptive filtering
+    header[12] = 0;                     // no interlace
+    if (!write(signature, sizeof(signature), context) || !ChartPNGWriteChunk(writer, "IHDR", header, sizeof(header))) {
+        ChartPNGWriterFree(writer);
+        return NULL;
+    }
+    return writer;
+}
+
+bool ChartPNGWriterAppendRows(ChartPNGWriter *writer, const uint8_t *pixels, size_t bytesPerRow, uint32_t count)
+{
+    if (writer->failed || count > writer->height - writer->row) {
+        writer->failed = true;
+        return false;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        ChartPNGConvertRow(writer, pixels + i * bytesPerRow);
+        const uint8_t *filtered = ChartPNGFilterRow(writer);
+        if (!ChartPNGDeflate(writer, filtered, writer->rowLength + 1, Z_NO_FLUSH)) {
+            return false;
+        }
+        uint8_t *swap = writer->previous;
+        writer->previous = writer->current;
+        writer->current = swap;
+        writer->row++;
+    }
+    return true;
+}
+
+bool ChartPNGWriterFinish(ChartPNGWriter *writer)
+{
+    if (writer->failed || writer->row != writer->height) {
+        return false;
+    }
+    return ChartPNGDeflate(writer, NULL, 0, Z_FINISH) && ChartPNGWriteChunk(writer, "IEND", NULL, 0);
+}
+
+void ChartPNGWriterFree(ChartPNGWriter *writer)
+{
+    if (!writer) {
+        return;
+    }
+    if (writer->streamReady) {
+        deflateEnd(&writer->stream);
+    }
+    free(writer->current);
+    free(writer->previous);
+    for (int i = 0; i < 5; i++) {
+        free(writer->filtered[i]);
+    }
+    free(writer->chunk);
+    free(writer);
+}
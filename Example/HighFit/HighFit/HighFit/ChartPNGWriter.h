@@ -0,0 +1,60 @@
+//
+//  ChartPNGWriter.h
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#ifndef ChartPNGWriter_h
+#define ChartPNGWriter_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Encodes a PNG a band of rows at a time, so an image never has to be in memory as a whole. Rows
+// are filtered and deflated as they are appended and the compressed bytes are handed to a write
+// function in IDAT chunks. Memory use is a few rows and the zlib state, whatever the image size.
+//
+// Rows are 32 bit pixels in the layout of a Core Graphics bitmap context with
+// kCGImageAlphaPremultipliedFirst | kCGBitmapByteOrder32Little, that is bytes B, G, R, A with
+// premultiplied color. They are written as 8 bit RGBA, or RGB when opaque is set.
+
+/**
+ *  Receives encoded bytes, returns false to stop the encoder.
+ */
+typedef bool (*ChartPNGWriteFunction)(const uint8_t *bytes, size_t length, void *context);
+
+typedef struct ChartPNGWriter ChartPNGWriter;
+
+/**
+ *  Starts an image and writes its header. Returns NULL when the size is empty or memory or the
+ *  write function fail. Level is the zlib compression level, -1 for the default.
+ */
+ChartPNGWriter *ChartPNGWriterCreate(uint32_t width, uint32_t height, bool opaque, int level,
+                                     ChartPNGWriteFunction write, void *context);
+
+/**
+ *  Appends count rows of width pixels, bytesPerRow apart. Returns false when the rows would pass
+ *  the height of the image or writing fails.
+ */
+bool ChartPNGWriterAppendRows(ChartPNGWriter *writer, const uint8_t *pixels, size_t bytesPerRow, uint32_t count);
+
+/**
+ *  Flushes the compressed data and writes the end of the image. Fails unless every row was
+ *  appended.
+ */
+bool ChartPNGWriterFinish(ChartPNGWriter *writer);
+
+void ChartPNGWriterFree(ChartPNGWriter *writer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ChartPNGWriter_h */
@@ -0,0 +1,63 @@
+//
+//  ChartSVGRenderer.h
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+
+/**
+ *  Draws the SVG of an exported chart with Core Graphics and Core Text, in place of canvg and
+ *  svg2pdf in the page. The subset the Highcharts SVG renderer writes is supported: groups with
+ *  transforms, opacity and clip paths, paths, rects, circles, ellipses, lines, polylines, polygons,
+ *  text with tspans and outlines, linear and radial gradients and data URI images.
+ *  Parsing and drawing only touch the given context, so both can run on a background queue.
+ */
+@interface ChartSVGRenderer : NSObject
+
+/**
+ *  Parses svg, returns nil when it is not well formed or has no svg root.
+ */
+- (instancetype)initWithSVG:(NSString*)svg;
+
+/**
+ *  The width and height of the root, in points.
+ */
+@property (assign, nonatomic, readonly) CGSize size;
+
+/**
+ *  Draws into a context with a top-left origin, in points.
+ */
+- (void)drawInContext:(CGContextRef)context;
+
+/**
+ *  Renders into a new bitmap image with scale pixels per point.
+ */
+- (UIImage*)imageWithScale:(CGFloat)scale;
+
+/**
+ *  Bytes of bitmap a PNG is drawn into at a time. PNG images are rasterized in strips of whole
+ *  rows that fit this limit, each one drawn with the same transform shifted by its first row, and
+ *  the rows are filtered and compressed as they come, so the pixels are those of a single bitmap
+ *  while memory stays bounded at any scale. Defaults to 4 MB.
+ */
+@property (assign, nonatomic) size_t stripByteLimit;
+
+- (NSData*)PNGDataWithScale:(CGFloat)scale;
+
+/**
+ *  Streams a PNG to a file, without holding the image or its encoded data in memory. The file is
+ *  written next to url and moved into place once complete.
+ */
+- (BOOL)writePNGWithScale:(CGFloat)scale toURL:(NSURL*)url error:(NSError**)error;
+
+- (NSData*)JPEGDataWithScale:(CGFloat)scale quality:(CGFloat)quality;
+
+/**
+ *  A single page PDF the size of the chart, with vector paths and text.
+ */
+- (NSData*)PDFData;
+
+@end
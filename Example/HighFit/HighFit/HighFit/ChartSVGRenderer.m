@@ -0,0 +1,1379 @@
+//
+//  ChartSVGRenderer.m
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import "ChartSVGRenderer.h"
+#import "ChartPNGWriter.h"
+#import <CoreText/CoreText.h>
+#import <ImageIO/ImageIO.h>
+#import <MobileCoreServices/MobileCoreServices.h>
+
+#pragma mark - Document
+
+@interface ChartSVGNode : NSObject
+@property (strong, nonatomic) NSString *name;
+@property (strong, nonatomic) NSDictionary<NSString*, NSString*> *attributes;
+@property (strong, nonatomic) NSMutableArray<ChartSVGNode*> *children;
+/**
+ *  The characters of a text node, named "#text".
+ */
+@property (strong, nonatomic) NSMutableString *text;
+@end
+
+@implementation ChartSVGNode
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        self.children = [NSMutableArray array];
+    }
+    return self;
+}
+
+@end
+
+static NSString *ChartSVGTrim(NSString *string)
+{
+    return [string stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceAndNewlineCharacterSet]];
+}
+
+/**
+ *  Declarations of the style attribute override presentation attributes, as in a browser.
+ */
+static NSDictionary *ChartSVGMergeStyle(NSDictionary *attributes)
+{
+    NSString *style = attributes[@"style"];
+    if (!style.length) {
+        return attributes;
+    }
+    NSMutableDictionary *merged = [attributes mutableCopy];
+    for (NSString *declaration in [style componentsSeparatedByString:@";"]) {
+        NSRange colon = [declaration rangeOfString:@":"];
+        if (colon.location == NSNotFound) {
+            continue;
+        }
+        NSString *key = ChartSVGTrim([declaration substringToIndex:colon.location]).lowercaseString;
+        NSString *value = ChartSVGTrim([declaration substringFromIndex:colon.location + 1]);
+        if (key.length && value.length) {
+            merged[key] = value;
+        }
+    }
+    return merged;
+}
+
+@interface ChartSVGParser : NSObject <NSXMLParserDelegate>
+@property (strong, nonatomic) NSMutableArray<ChartSVGNode*> *stack;
+@property (strong, nonatomic) ChartSVGNode *root;
+@property (strong, nonatomic) NSMutableDictionary<NSString*, ChartSVGNode*> *ids;
+@end
+
+@implementation ChartSVGParser
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        self.stack = [NSMutableArray array];
+        self.ids = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+
+- (void)parser:(NSXMLParser *)parser didStartElement:(NSString *)elementName namespaceURI:(NSString *)namespaceURI qualifiedName:(NSString *)qName attributes:(NSDictionary<NSString *, NSString *> *)attributeDict
+{
+    ChartSVGNode *node = [[ChartSVGNode alloc] init];
+    NSRange colon = [elementName rangeOfString:@":"];
+    node.name = colon.location == NSNotFound ? elementName : [elementName substringFromIndex:colon.location + 1];
+    node.attributes = ChartSVGMergeStyle(attributeDict);
+    if (node.attributes[@"id"]) {
+        self.ids[node.attributes[@"id"]] = node;
+    }
+    [self.stack.lastObject.children addObject:node];
+    if (!self.root) {
+        self.root = node;
+    }
+    [self.stack addObject:node];
+}
+
+- (void)parser:(NSXMLParser *)parser didEndElement:(NSString *)elementName namespaceURI:(NSString *)namespaceURI qualifiedName:(NSString *)qName
+{
+    [self.stack removeLastObject];
+}
+
+- (void)parser:(NSXMLParser *)parser foundCharacters:(NSString *)string
+{
+    ChartSVGNode *parent = self.stack.lastObject;
+    // Only text content is drawn, whitespace between other elements is layout of the markup
+    if (![parent.name isEqualToString:@"text"] && ![parent.name isEqualToString:@"tspan"]) {
+        return;
+    }
+    ChartSVGNode *last = parent.children.lastObject;
+    if (![last.name isEqualToString:@"#text"]) {
+        last = [[ChartSVGNode alloc] init];
+        last.name = @"#text";
+        last.text = [NSMutableString string];
+        [parent.children addObject:last];
+    }
+    [last.text appendString:string];
+}
+
+@end
+
+#pragma mark - Values
+
+static CGFloat ChartSVGNumber(NSString *value, CGFloat fallback)
+{
+    if (![value isKindOfClass:[NSString class]] || !value.length) {
+        return fallback;
+    }
+    // Units like "11px" are read as their number
+    const char *bytes = value.UTF8String;
+    char *end = NULL;
+    double number = strtod(bytes, &end);
+    return end == bytes ? fallback : (CGFloat)number;
+}
+
+/**
+ *  A gradient coordinate, with percentages as fractions.
+ */
+static CGFloat ChartSVGFraction(NSString *value, CGFloat fallback)
+{
+    CGFloat number = ChartSVGNumber(value, fallback);
+    return [value hasSuffix:@"%"] ? number / 100 : number;
+}
+
+/**
+ *  Numbers separated by commas and whitespace, as in points, transforms and dash arrays.
+ */
+static NSArray<NSNumber*> *ChartSVGNumberList(NSString *value)
+{
+    NSMutableArray *numbers = [NSMutableArray array];
+    const char *c = value.UTF8String ?: "";
+    while (*c) {
+        if (*c == ',' || *c == ' ' || *c == '\t' || *c == '\n' || *c == '\r') {
+            c++;
+            continue;
+        }
+        char *end = NULL;
+        double number = strtod(c, &end);
+        if (end == c) {
+            break;
+        }
+        [numbers addObject:@(number)];
+        c = end;
+    }
+    return numbers;
+}
+
+/**
+ *  The id of a url(#id) reference. Highcharts prefixes the page URL when the page has a base tag.
+ */
+static NSString *ChartSVGReference(NSString *value)
+{
+    if (![value hasPrefix:@"url("]) {
+        return nil;
+    }
+    NSRange hash = [value rangeOfString:@"#" options:NSBackwardsSearch];
+    NSRange close = [value rangeOfString:@")" options:NSBackwardsSearch];
+    if (hash.location == NSNotFound || close.location == NSNotFound || close.location < hash.location) {
+        return nil;
+    }
+    NSString *reference = [value substringWithRange:NSMakeRange(hash.location + 1, close.location - hash.location - 1)];
+    return [reference stringByTrimmingCharactersInSet:[NSCharacterSet characterSetWithCharactersInString:@"\"' "]];
+}
+
+static BOOL ChartSVGParseColor(NSString *value, CGFloat rgba[4])
+{
+    if (![value isKindOfClass:[NSString class]]) {
+        return NO;
+    }
+    NSString *string = ChartSVGTrim(value).lowercaseString;
+
+    if ([string hasPrefix:@"#"]) {
+        unsigned int hex = 0;
+        NSString *digits = [string substringFromIndex:1];
+        if (![[NSScanner scannerWithString:digits] scanHexInt:&hex]) {
+            return NO;
+        }
+        if (digits.length == 3) {
+            rgba[0] = ((hex >> 8) & 0xf) * 17 / 255.0;
+            rgba[1] = ((hex >> 4) & 0xf) * 17 / 255.0;
+            rgba[2] = (hex & 0xf) * 17 / 255.0;
+        }
+        else if (digits.length == 6) {
+            rgba[0] = ((hex >> 16) & 0xff) / 255.0;
+            rgba[1] = ((hex >> 8) & 0xff) / 255.0;
+            rgba[2] = (hex & 0xff) / 255.0;
+        }
+        else {
+            return NO;
+        }
+        rgba[3] = 1;
+        return YES;
+    }
+
+    if ([string hasPrefix:@"rgb"]) {
+        NSRange open = [string rangeOfString:@"("];
+        NSRange close = [string rangeOfString:@")"];
+        if (open.location == NSNotFound || close.location == NSNotFound || close.location < open.location) {
+            return NO;
+        }
+        NSString *inner = [string substringWithRange:NSMakeRange(open.location + 1, close.location - open.location - 1)];
+        NSArray *parts = [inner componentsSeparatedByString:@","];
+        if (parts.count < 3) {
+            return NO;
+        }
+        for (NSUInteger i = 0; i < 3; i++) {
+            rgba[i] = MAX(0, MIN(255, [parts[i] doubleValue])) / 255.0;
+        }
+        rgba[3] = parts.count > 3 ? MAX(0, MIN(1, [parts[3] doubleValue])) : 1;
+        return YES;
+    }
+
+    NSDictionary *names = @{
+                            @"white": @"#ffffff", @"black": @"#000000", @"red": @"#ff0000", @"green": @"#008000",
+                            @"blue": @"#0000ff", @"yellow": @"#ffff00", @"orange": @"#ffa500", @"gray": @"#808080",
+                            @"grey": @"#808080", @"silver": @"#c0c0c0", @"purple": @"#800080"
+                            };
+    if (names[string]) {
+        return ChartSVGParseColor(names[string], rgba);
+    }
+    if ([string isEqualToString:@"transparent"]) {
+        rgba[0] = rgba[1] = rgba[2] = rgba[3] = 0;
+        return YES;
+    }
+    return NO;
+}
+
+#pragma mark - Transforms
+
+static CGAffineTransform ChartSVGParseTransform(NSString *value)
+{
+    CGAffineTransform transform = CGAffineTransformIdentity;
+    NSScanner *scanner = [NSScanner scannerWithString:value ?: @""];
+    scanner.charactersToBeSkipped = [NSCharacterSet characterSetWithCharactersInString:@" ,\t\n\r"];
+    NSString *name = nil;
+    NSString *arguments = nil;
+
+    while ([scanner scanUpToString:@"(" intoString:&name] && [scanner scanString:@"(" intoString:NULL]) {
+        arguments = @"";
+        [scanner scanUpToString:@")" intoString:&arguments];
+        [scanner scanString:@")" intoString:NULL];
+        NSArray<NSNumber*> *n = ChartSVGNumberList(arguments);
+        name = ChartSVGTrim(name);
+        CGAffineTransform step = CGAffineTransformIdentity;
+
+        if ([name isEqualToString:@"translate"] && n.count) {
+            step = CGAffineTransformMakeTranslation(n[0].doubleValue, n.count > 1 ? n[1].doubleValue : 0);
+        }
+        else if ([name isEqualToString:@"scale"] && n.count) {
+            step = CGAffineTransformMakeScale(n[0].doubleValue, n.count > 1 ? n[1].doubleValue : n[0].doubleValue);
+        }
+        else if ([name isEqualToString:@"rotate"] && n.count) {
+            CGFloat angle = n[0].doubleValue * M_PI / 180;
+            if (n.count > 2) {
+                CGFloat cx = n[1].doubleValue, cy = n[2].doubleValue;
+                step = CGAffineTransformMakeTranslation(cx, cy);
+                step = CGAffineTransformRotate(step, angle);
+                step = CGAffineTransformTranslate(step, -cx, -cy);
+            }
+            else {
+                step = CGAffineTransformMakeRotation(angle);
+            }
+        }
+        else if ([name isEqualToString:@"matrix"] && n.count == 6) {
+            step = CGAffineTransformMake(n[0].doubleValue, n[1].doubleValue, n[2].doubleValue,
+                                         n[3].doubleValue, n[4].doubleValue, n[5].doubleValue);
+        }
+        else if ([name isEqualToString:@"skewX"] && n.count) {
+            step = CGAffineTransformMake(1, 0, tan(n[0].doubleValue * M_PI / 180), 1, 0, 0);
+        }
+        else if ([name isEqualToString:@"skewY"] && n.count) {
+            step = CGAffineTransformMake(1, tan(n[0].doubleValue * M_PI / 180), 0, 1, 0, 0);
+        }
+        // Later transforms apply first, in the space of the earlier ones
+        transform = CGAffineTransformConcat(step, transform);
+    }
+    return transform;
+}
+
+#pragma mark - Path data
+
+typedef struct {
+    const char *c;
+} ChartSVGPathScanner;
+
+static void ChartSVGSkipSeparators(ChartSVGPathScanner *scanner)
+{
+    while (*scanner->c == ' ' || *scanner->c == ',' || *scanner->c == '\t' || *scanner->c == '\n' || *scanner->c == '\r') {
+        scanner->c++;
+    }
+}
+
+static BOOL ChartSVGScanNumber(ChartSVGPathScanner *scanner, CGFloat *value)
+{
+    ChartSVGSkipSeparators(scanner);
+    char *end = NULL;
+    double number = strtod(scanner->c, &end);
+    if (end == scanner->c) {
+        return NO;
+    }
+    scanner->c = end;
+    *value = (CGFloat)number;
+    return YES;
+}
+
+// Arc flags are single digits and may be written without separators
+static BOOL ChartSVGScanFlag(ChartSVGPathScanner *scanner, BOOL *flag)
+{
+    ChartSVGSkipSeparators(scanner);
+    if (*scanner->c != '0' && *scanner->c != '1') {
+        return NO;
+    }
+    *flag = *scanner->c == '1';
+    scanner->c++;
+    return YES;
+}
+
+static CGFloat ChartSVGVectorAngle(CGFloat ux, CGFloat uy, CGFloat vx, CGFloat vy)
+{
+    return atan2(ux * vy - uy * vx, ux * vx + uy * vy);
+}
+
+/**
+ *  Adds an elliptical arc from the current point to (x, y), converting the endpoint form of the
+ *  path data to a center, as in appendix F.6.5 of the SVG specification.
+ */
+static void ChartSVGAddArc(CGMutablePathRef path, CGPoint from, CGFloat rx, CGFloat ry, CGFloat rotation, BOOL large, BOOL sweep, CGFloat x, CGFloat y)
+{
+    if (from.x == x && from.y == y) {
+        return;
+    }
+    rx = fabs(rx);
+    ry = fabs(ry);
+    if (rx == 0 || ry == 0) {
+        CGPathAddLineToPoint(path, NULL, x, y);
+        return;
+    }
+    CGFloat phi = rotation * M_PI / 180, cosPhi = cos(phi), sinPhi = sin(phi);
+    CGFloat dx = (from.x - x) / 2, dy = (from.y - y) / 2;
+    CGFloat x1 = cosPhi * dx + sinPhi * dy;
+    CGFloat y1 = -sinPhi * dx + cosPhi * dy;
+
+    CGFloat lambda = (x1 * x1) / (rx * rx) + (y1 * y1) / (ry * ry);
+    if (lambda > 1) {
+        rx *= sqrt(lambda);
+        ry *= sqrt(lambda);
+    }
+    CGFloat numerator = rx * rx * ry * ry - rx * rx * y1 * y1 - ry * ry * x1 * x1;
+    CGFloat denominator = rx * rx * y1 * y1 + ry * ry * x1 * x1;
+    CGFloat coefficient = (large != sweep ? 1 : -1) * sqrt(MAX(0, numerator / denominator));
+    CGFloat cx1 = coefficient * rx * y1 / ry;
+    CGFloat cy1 = -coefficient * ry * x1 / rx;
+    CGFloat cx = cosPhi * cx1 - sinPhi * cy1 + (from.x + x) / 2;
+    CGFloat cy = sinPhi * cx1 + cosPhi * cy1 + (from.y + y) / 2;
+
+    CGFloat start = ChartSVGVectorAngle(1, 0, (x1 - cx1) / rx, (y1 - cy1) / ry);
+    CGFloat delta = ChartSVGVectorAngle((x1 - cx1) / rx, (y1 - cy1) / ry, (-x1 - cx1) / rx, (-y1 - cy1) / ry);
+    if (!sweep && delta > 0) {
+        delta -= 2 * M_PI;
+    }
+    else if (sweep && delta < 0) {
+        delta += 2 * M_PI;
+    }
+
+    CGAffineTransform transform = CGAffineTransformMakeTranslation(cx, cy);
+    transform = CGAffineTransformRotate(transform, phi);
+    transform = CGAffineTransformScale(transform, rx, ry);
+    CGPathAddRelativeArc(path, &transform, 0, 0, 1, start, delta);
+}
+
+static CGMutablePathRef ChartSVGCreatePath(NSString *data)
+{
+    CGMutablePathRef path = CGPathCreateMutable();
+    ChartSVGPathScanner scanner = { data.UTF8String ?: "" };
+    CGPoint current = CGPointZero, start = CGPointZero, control = CGPointZero;
+    char command = 0, previous = 0;
+
+    while (YES) {
+        ChartSVGSkipSeparators(&scanner);
+        char c = *scanner.c;
+        if (!c) {
+            break;
+        }
+        if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z')) {
+            command = c;
+            scanner.c++;
+        }
+        else if (!command) {
+            break;
+        }
+        BOOL relative = command >= 'a';
+        CGFloat ox = relative ? current.x : 0, oy = relative ? current.y : 0;
+        CGFloat v[6];
+        BOOL flags[2];
+
+        switch (command) {
+            case 'M': case 'm':
+                if (!ChartSVGScanNumber(&scanner, &v[0]) || !ChartSVGScanNumber(&scanner, &v[1])) {
+                    return path;
+                }
+                current = start = CGPointMake(ox + v[0], oy + v[1]);
+                CGPathMoveToPoint(path, NULL, current.x, current.y);
+                // Further pairs are lines
+                command = relative ? 'l' : 'L';
+                break;
+            case 'L': case 'l':
+                if (!ChartSVGScanNumber(&scanner, &v[0]) || !ChartSVGScanNumber(&scanner, &v[1])) {
+                    return path;
+                }
+                current = CGPointMake(ox + v[0], oy + v[1]);
+                CGPathAddLineToPoint(path, NULL, current.x, current.y);
+                break;
+            case 'H': case 'h':
+                if (!ChartSVGScanNumber(&scanner, &v[0])) {
+                    return path;
+                }
+                current.x = ox + v[0];
+                CGPathAddLineToPoint(path, NULL, current.x, current.y);
+                break;
+            case 'V': case 'v':
+                if (!ChartSVGScanNumber(&scanner, &v[0])) {
+                    return path;
+                }
+                current.y = oy + v[0];
+                CGPathAddLineToPoint(path, NULL, current.x, current.y);
+                break;
+            case 'C': case 'c':
+                for (int i = 0; i < 6; i++) {
+                    if (!ChartSVGScanNumber(&scanner, &v[i])) {
+                        return path;
+                    }
+                }
+                control = CGPointMake(ox + v[2], oy + v[3]);
+                current = CGPointMake(ox + v[4], oy + v[5]);
+                CGPathAddCurveToPoint(path, NULL, ox + v[0], oy + v[1], control.x, control.y, current.x, current.y);
+                break;
+            case 'S': case 's': {
+                for (int i = 0; i < 4; i++) {
+                    if (!ChartSVGScanNumber(&scanner, &v[i])) {
+                        return path;
+                    }
+                }
+                BOOL smooth = previous == 'C' || previous == 'c' || previous == 'S' || previous == 's';
+                CGPoint reflected = smooth ? CGPointMake(2 * current.x - control.x, 2 * current.y - control.y) : current;
+                control = CGPointMake(ox + v[0], oy + v[1]);
+                current = CGPointMake(ox + v[2], oy + v[3]);
+                CGPathAddCurveToPoint(path, NULL, reflected.x, reflected.y, control.x, control.y, current.x, current.y);
+                break;
+            }
+            case 'Q': case 'q':
+                for (int i = 0; i < 4; i++) {
+                    if (!ChartSVGScanNumber(&scanner, &v[i])) {
+                        return path;
+                    }
+                }
+                control = CGPointMake(ox + v[0], oy + v[1]);
+                current = CGPointMake(ox + v[2], oy + v[3]);
+                CGPathAddQuadCurveToPoint(path, NULL, control.x, control.y, current.x, current.y);
+                break;
+            case 'T': case 't': {
+                if (!ChartSVGScanNumber(&scanner, &v[0]) || !ChartSVGScanNumber(&scanner, &v[1])) {
+                    return path;
+                }
+                BOOL smooth = previous == 'Q' || previous == 'q' || previous == 'T' || previous == 't';
+                control = smooth ? CGPointMake(2 * current.x - control.x, 2 * current.y - control.y) : current;
+                current = CGPointMake(ox + v[0], oy + v[1]);
+                CGPathAddQuadCurveToPoint(path, NULL, control.x, control.y, current.x, current.y);
+                break;
+            }
+            case 'A': case 'a': {
+                if (!ChartSVGScanNumber(&scanner, &v[0]) || !ChartSVGScanNumber(&scanner, &v[1]) ||
+                    !ChartSVGScanNumber(&scanner, &v[2]) || !ChartSVGScanFlag(&scanner, &flags[0]) ||
+                    !ChartSVGScanFlag(&scanner, &flags[1]) || !ChartSVGScanNumber(&scanner, &v[3]) ||
+                    !ChartSVGScanNumber(&scanner, &v[4])) {
+                    return path;
+                }
+                CGPoint end = CGPointMake(ox + v[3], oy + v[4]);
+                ChartSVGAddArc(path, current, v[0], v[1], v[2], flags[0], flags[1], end.x, end.y);
+                current = end;
+                break;
+            }
+            case 'Z': case 'z':
+                if (!CGPathIsEmpty(path)) {
+                    CGPathCloseSubpath(path);
+                }
+                current = start;
+                break;
+            default:
+                return path;
+        }
+        previous = command;
+    }
+    return path;
+}
+
+#pragma mark - Style
+
+/**
+ *  The inherited presentation properties in effect for an element.
+ */
+@interface ChartSVGStyle : NSObject <NSCopying>
+@property (strong, nonatomic) NSString *fill;
+@property (strong, nonatomic) NSString *stroke;
+@property (strong, nonatomic) NSString *color;
+@property (strong, nonatomic) NSString *fillRule;
+@property (strong, nonatomic) NSString *fontFamily;
+@property (strong, nonatomic) NSString *fontWeight;
+@property (strong, nonatomic) NSString *textAnchor;
+@property (strong, nonatomic) NSString *lineCap;
+@property (strong, nonatomic) NSString *lineJoin;
+@property (strong, nonatomic) NSString *dashArray;
+@property (strong, nonatomic) NSString *visibility;
+@property (assign, nonatomic) CGFloat fillOpacity;
+@property (assign, nonatomic) CGFloat strokeOpacity;
+@property (assign, nonatomic) CGFloat strokeWidth;
+@property (assign, nonatomic) CGFloat miterLimit;
+@property (assign, nonatomic) CGFloat fontSize;
+@end
+
+@implementation ChartSVGStyle
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        // The initial values of the specification
+        self.fill = @"black";
+        self.stroke = @"none";
+        self.color = @"black";
+        self.fillRule = @"nonzero";
+        self.fontFamily = @"sans-serif";
+        self.fontWeight = @"normal";
+        self.textAnchor = @"start";
+        self.lineCap = @"butt";
+        self.lineJoin = @"miter";
+        self.visibility = @"visible";
+        self.fillOpacity = 1;
+        self.strokeOpacity = 1;
+        self.strokeWidth = 1;
+        self.miterLimit = 4;
+        self.fontSize = 16;
+    }
+    return self;
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    ChartSVGStyle *copy = [[ChartSVGStyle allocWithZone:zone] init];
+    copy.fill = self.fill;
+    copy.stroke = self.stroke;
+    copy.color = self.color;
+    copy.fillRule = self.fillRule;
+    copy.fontFamily = self.fontFamily;
+    copy.fontWeight = self.fontWeight;
+    copy.textAnchor = self.textAnchor;
+    copy.lineCap = self.lineCap;
+    copy.lineJoin = self.lineJoin;
+    copy.dashArray = self.dashArray;
+    copy.visibility = self.visibility;
+    copy.fillOpacity = self.fillOpacity;
+    copy.strokeOpacity = self.strokeOpacity;
+    copy.strokeWidth = self.strokeWidth;
+    copy.miterLimit = self.miterLimit;
+    copy.fontSize = self.fontSize;
+    return copy;
+}
+
+- (ChartSVGStyle*)styleWithAttributes:(NSDictionary<NSString*, NSString*> *)attributes
+{
+    ChartSVGStyle *style = [self copy];
+    NSString *(^value)(NSString *) = ^NSString *(NSString *key) {
+        NSString *string = attributes[key];
+        return string.length && ![string isEqualToString:@"inherit"] ? string : nil;
+    };
+    style.color = value(@"color") ?: style.color;
+    style.fill = value(@"fill") ?: style.fill;
+    style.stroke = value(@"stroke") ?: style.stroke;
+    style.fillRule = value(@"fill-rule") ?: style.fillRule;
+    style.fontFamily = value(@"font-family") ?: style.fontFamily;
+    style.fontWeight = value(@"font-weight") ?: style.fontWeight;
+    style.textAnchor = value(@"text-anchor") ?: style.textAnchor;
+    style.lineCap = value(@"stroke-linecap") ?: style.lineCap;
+    style.lineJoin = value(@"stroke-linejoin") ?: style.lineJoin;
+    style.dashArray = value(@"stroke-dasharray") ?: style.dashArray;
+    style.visibility = value(@"visibility") ?: style.visibility;
+    style.fillOpacity = ChartSVGNumber(value(@"fill-opacity"), style.fillOpacity);
+    style.strokeOpacity = ChartSVGNumber(value(@"stroke-opacity"), style.strokeOpacity);
+    style.strokeWidth = ChartSVGNumber(value(@"stroke-width"), style.strokeWidth);
+    style.miterLimit = ChartSVGNumber(value(@"stroke-miterlimit"), style.miterLimit);
+    style.fontSize = ChartSVGNumber(value(@"font-size"), style.fontSize);
+    return style;
+}
+
+- (NSString*)resolvedPaint:(NSString*)paint
+{
+    return [paint isEqualToString:@"currentColor"] ? self.color : paint;
+}
+
+@end
+
+#pragma mark - Text runs
+
+@interface ChartSVGTextRun : NSObject
+@property (strong, nonatomic) ChartSVGStyle *style;
+@property (assign, nonatomic) CTLineRef line;
+@property (assign, nonatomic) CGFloat width;
+@property (assign, nonatomic) CGPoint position;
+@property (assign, nonatomic) NSUInteger chunk;
+@end
+
+@implementation ChartSVGTextRun
+
+- (void)dealloc
+{
+    if (_line) {
+        CFRelease(_line);
+    }
+}
+
+@end
+
+#pragma mark - Renderer
+
+@interface ChartSVGRenderer ()
+@property (strong, nonatomic) ChartSVGNode *root;
+@property (strong, nonatomic) NSDictionary<NSString*, ChartSVGNode*> *ids;
+@property (assign, nonatomic, readwrite) CGSize size;
+@property (strong, nonatomic) NSMutableDictionary *fonts;
+@end
+
+@implementation ChartSVGRenderer
+
+- (instancetype)initWithSVG:(NSString*)svg
+{
+    self = [super init];
+    if (self) {
+        NSData *data = [svg dataUsingEncoding:NSUTF8StringEncoding];
+        if (!data) {
+            return nil;
+        }
+        NSXMLParser *xml = [[NSXMLParser alloc] initWithData:data];
+        ChartSVGParser *parser = [[ChartSVGParser alloc] init];
+        xml.delegate = parser;
+        if (![xml parse] || ![parser.root.name isEqualToString:@"svg"]) {
+            return nil;
+        }
+        self.root = parser.root;
+        self.ids = parser.ids;
+
+        NSArray<NSNumber*> *viewBox = ChartSVGNumberList(self.root.attributes[@"viewBox"]);
+        CGFloat width = ChartSVGNumber(self.root.attributes[@"width"], viewBox.count == 4 ? viewBox[2].doubleValue : 0);
+        CGFloat height = ChartSVGNumber(self.root.attributes[@"height"], viewBox.count == 4 ? viewBox[3].doubleValue : 0);
+        self.size = CGSizeMake(width, height);
+        self.stripByteLimit = 4 << 20;
+    }
+    return self;
+}
+
+#pragma mark Output
+
+- (void)drawInContext:(CGContextRef)context
+{
+    self.fonts = [NSMutableDictionary dictionary];
+    CGContextSaveGState(context);
+
+    NSArray<NSNumber*> *viewBox = ChartSVGNumberList(self.root.attributes[@"viewBox"]);
+    if (viewBox.count == 4 && viewBox[2].doubleValue > 0 && viewBox[3].doubleValue > 0) {
+        CGContextScaleCTM(context, self.size.width / viewBox[2].doubleValue, self.size.height / viewBox[3].doubleValue);
+        CGContextTranslateCTM(context, -viewBox[0].doubleValue, -viewBox[1].doubleValue);
+    }
+    ChartSVGStyle *style = [[[ChartSVGStyle alloc] init] styleWithAttributes:self.root.attributes];
+    for (ChartSVGNode *child in self.root.children) {
+        [self drawNode:child style:style context:context];
+    }
+
+    CGContextRestoreGState(context);
+    self.fonts = nil;
+}
+
+- (CGImageRef)createImageWithScale:(CGFloat)scale
+{
+    if (self.size.width <= 0 || self.size.height <= 0) {
+        return NULL;
+    }
+    scale = scale > 0 ? scale : 1;
+    size_t width = (size_t)ceil(self.size.width * scale), height = (size_t)ceil(self.size.height * scale);
+    CGColorSpaceRef space = CGColorSpaceCreateDeviceRGB();
+    CGContextRef context = CGBitmapContextCreate(NULL, width, height, 8, 0, space, kCGImageAlphaPremultipliedFirst | kCGBitmapByteOrder32Little);
+    CGColorSpaceRelease(space);
+    if (!context) {
+        return NULL;
+    }
+    // Bitmap contexts are y-up, SVG is drawn top-down
+    CGContextTranslateCTM(context, 0, height);
+    CGContextScaleCTM(context, scale, -scale);
+    [self drawInContext:context];
+
+    CGImageRef image = CGBitmapContextCreateImage(context);
+    CGContextRelease(context);
+    return image;
+}
+
+- (UIImage*)imageWithScale:(CGFloat)scale
+{
+    CGImageRef cgImage = [self createImageWithScale:scale];
+    if (!cgImage) {
+        return nil;
+    }
+    UIImage *image = [UIImage imageWithCGImage:cgImage scale:scale > 0 ? scale : 1 orientation:UIImageOrientationUp];
+    CGImageRelease(cgImage);
+    return image;
+}
+
+- (NSData*)encodeImageWithScale:(CGFloat)scale type:(CFStringRef)type properties:(NSDictionary*)properties
+{
+    CGImageRef image = [self createImageWithScale:scale];
+    if (!image) {
+        return nil;
+    }
+    NSMutableData *data = [NSMutableData data];
+    CGImageDestinationRef destination = CGImageDestinationCreateWithData((__bridge CFMutableDataRef)data, type, 1, NULL);
+    BOOL success = NO;
+    if (destination) {
+        CGImageDestinationAddImage(destination, image, (__bridge CFDictionaryRef)properties);
+        success = CGImageDestinationFinalize(destination);
+        CFRelease(destination);
+    }
+    CGImageRelease(image);
+    return success ? data : nil;
+}
+
+static bool ChartSVGAppendData(const uint8_t *bytes, size_t length, void *context)
+{
+    [(__bridge NSMutableData*)context appendBytes:bytes length:length];
+    return true;
+}
+
+static bool ChartSVGWriteFile(const uint8_t *bytes, size_t length, void *context)
+{
+    return fwrite(bytes, 1, length, (FILE*)context) == length;
+}
+
+/**
+ *  Draws the image in strips into one reusable bitmap and appends each strip to a PNG writer.
+ *  A strip starting at pixel row y is the full image translated up by y pixels, a whole number,
+ *  so edges and antialiasing come out as in a single bitmap.
+ */
+- (BOOL)encodePNGWithScale:(CGFloat)scale write:(ChartPNGWriteFunction)write context:(void*)writeContext
+{
+    if (self.size.width <= 0 || self.size.height <= 0) {
+        return NO;
+    }
+    scale = scale > 0 ? scale : 1;
+    size_t width = (size_t)ceil(self.size.width * scale), height = (size_t)ceil(self.size.height * scale);
+    if (width > UINT32_MAX || height > UINT32_MAX) {
+        return NO;
+    }
+    size_t bytesPerRow = width * 4;
+    size_t stripHeight = MIN(height, MAX((size_t)1, self.stripByteLimit / bytesPerRow));
+    uint8_t *pixels = malloc(bytesPerRow * stripHeight);
+    ChartPNGWriter *writer = pixels ? ChartPNGWriterCreate((uint32_t)width, (uint32_t)height, false, -1, write, writeContext) : NULL;
+    if (!writer) {
+        free(pixels);
+        return NO;
+    }
+
+    CGColorSpaceRef space = CGColorSpaceCreateDeviceRGB();
+    BOOL success = YES;
+    for (size_t y = 0; y < height && success; y += stripHeight) {
+        size_t rows = MIN(stripHeight, height - y);
+        memset(pixels, 0, bytesPerRow * rows);
+        CGContextRef context = CGBitmapContextCreate(pixels, width, rows, 8, bytesPerRow, space, kCGImageAlphaPremultipliedFirst | kCGBitmapByteOrder32Little);
+        if (!context) {
+            success = NO;
+            break;
+        }
+        // As createImageWithScale:, with the origin moved to the top row of the strip
+        CGContextTranslateCTM(context, 0, (CGFloat)(y + rows));
+        CGContextScaleCTM(context, scale, -scale);
+        @autoreleasepool {
+            [self drawInContext:context];
+        }
+        CGContextFlush(context);
+        CGContextRelease(context);
+        success = ChartPNGWriterAppendRows(writer, pixels, bytesPerRow, (uint32_t)rows);
+    }
+    CGColorSpaceRelease(space);
+
+    success = success && ChartPNGWriterFinish(writer);
+    ChartPNGWriterFree(writer);
+    free(pixels);
+    return success;
+}
+
+- (NSData*)PNGDataWithScale:(CGFloat)scale
+{
+    NSMutableData *data = [NSMutableData data];
+    return [self encodePNGWithScale:scale write:ChartSVGAppendData context:(__bridge void*)data] ? data : nil;
+}
+
+- (BOOL)writePNGWithScale:(CGFloat)scale toURL:(NSURL*)url error:(NSError**)error
+{
+    NSURL *partialURL = [url URLByAppendingPathExtension:@"partial"];
+    FILE *file = fopen(partialURL.fileSystemRepresentation, "wb");
+    if (!file) {
+        if (error) {
+            *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:@{ NSURLErrorKey: partialURL }];
+        }
+        return NO;
+    }
+    errno = 0;
+    BOOL success = [self encodePNGWithScale:scale write:ChartSVGWriteFile context:file];
+    int errorCode = success ? 0 : errno;
+    if (fclose(file) != 0 && success) {
+        success = NO;
+        errorCode = errno;
+    }
+    if (!success) {
+        unlink(partialURL.fileSystemRepresentation);
+        if (error) {
+            *error = errorCode ?
+                [NSError errorWithDomain:NSPOSIXErrorDomain code:errorCode userInfo:@{ NSURLErrorKey: url }] :
+                [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileWriteUnknownError userInfo:@{ NSURLErrorKey: url }];
+        }
+        return NO;
+    }
+    if (rename(partialURL.fileSystemRepresentation, url.fileSystemRepresentation) != 0) {
+        if (error) {
+            *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:@{ NSURLErrorKey: url }];
+        }
+        unlink(partialURL.fileSystemRepresentation);
+        return NO;
+    }
+    return YES;
+}
+
+- (NSData*)JPEGDataWithScale:(CGFloat)scale quality:(CGFloat)quality
+{
+    NSDictionary *properties = @{ (__bridge id)kCGImageDestinationLossyCompressionQuality: @(quality) };
+    return [self encodeImageWithScale:scale type:kUTTypeJPEG properties:properties];
+}
+
+- (NSData*)PDFData
+{
+    if (self.size.width <= 0 || self.size.height <= 0) {
+        return nil;
+    }
+    NSMutableData *data = [NSMutableData data];
+    CGDataConsumerRef consumer = CGDataConsumerCreateWithCFData((__bridge CFMutableDataRef)data);
+    CGRect mediaBox = CGRectMake(0, 0, self.size.width, self.size.height);
+    CGContextRef context = CGPDFContextCreate(consumer, &mediaBox, NULL);
+    CGDataConsumerRelease(consumer);
+    if (!context) {
+        return nil;
+    }
+    CGPDFContextBeginPage(context, NULL);
+    CGContextTranslateCTM(context, 0, self.size.height);
+    CGContextScaleCTM(context, 1, -1);
+    [self drawInContext:context];
+    CGPDFContextEndPage(context);
+    CGPDFContextClose(context);
+    CGContextRelease(context);
+    return data;
+}
+
+#pragma mark Elements
+
+- (void)drawNode:(ChartSVGNode*)node style:(ChartSVGStyle*)parentStyle context:(CGContextRef)context
+{
+    static NSSet *skipped;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        skipped = [NSSet setWithObjects:@"defs", @"clipPath", @"linearGradient", @"radialGradient", @"stop", @"title",
+                   @"desc", @"style", @"script", @"metadata", @"mask", @"pattern", @"#text", nil];
+    });
+    NSDictionary *attributes = node.attributes;
+    if ([skipped containsObject:node.name] || [attributes[@"display"] isEqualToString:@"none"]) {
+        return;
+    }
+    ChartSVGStyle *style = [parentStyle styleWithAttributes:attributes];
+    CGFloat opacity = ChartSVGNumber(attributes[@"opacity"], 1);
+    if (opacity <= 0) {
+        return;
+    }
+    BOOL group = [node.name isEqualToString:@"g"] || [node.name isEqualToString:@"svg"] || [node.name isEqualToString:@"a"];
+
+    CGContextSaveGState(context);
+    if (attributes[@"transform"]) {
+        CGContextConcatCTM(context, ChartSVGParseTransform(attributes[@"transform"]));
+    }
+    if (group && [node.name isEqualToString:@"svg"]) {
+        CGContextTranslateCTM(context, ChartSVGNumber(attributes[@"x"], 0), ChartSVGNumber(attributes[@"y"], 0));
+    }
+    [self clipWithReference:attributes[@"clip-path"] context:context];
+
+    BOOL layer = group && opacity < 1;
+    if (layer) {
+        CGContextSetAlpha(context, opacity);
+        CGContextBeginTransparencyLayer(context, NULL);
+    }
+
+    if (group) {
+        for (ChartSVGNode *child in node.children) {
+            [self drawNode:child style:style context:context];
+        }
+    }
+    else if ([style.visibility isEqualToString:@"visible"]) {
+        if ([node.name isEqualToString:@"text"]) {
+            [self drawText:node style:style opacity:opacity context:context];
+        }
+        else if ([node.name isEqualToString:@"image"]) {
+            [self drawImage:node opacity:opacity context:context];
+        }
+        else {
+            CGPathRef path = [self createPathForShape:node];
+            if (path) {
+                [self paintPath:path style:style opacity:opacity context:context];
+                CGPathRelease(path);
+            }
+        }
+    }
+
+    if (layer) {
+        CGContextEndTransparencyLayer(context);
+    }
+    CGContextRestoreGState(context);
+}
+
+- (CGPathRef)createPathForShape:(ChartSVGNode*)node
+{
+    NSDictionary *a = node.attributes;
+    NSString *name = node.name;
+
+    if ([name isEqualToString:@"path"]) {
+        return ChartSVGCreatePath(a[@"d"]);
+    }
+    if ([name isEqualToString:@"rect"]) {
+        CGRect rect = CGRectMake(ChartSVGNumber(a[@"x"], 0), ChartSVGNumber(a[@"y"], 0),
+                                 ChartSVGNumber(a[@"width"], 0), ChartSVGNumber(a[@"height"], 0));
+        if (rect.size.width <= 0 || rect.size.height <= 0) {
+            return NULL;
+        }
+        CGFloat rx = ChartSVGNumber(a[@"rx"], ChartSVGNumber(a[@"ry"], 0));
+        CGFloat ry = ChartSVGNumber(a[@"ry"], rx);
+        rx = MIN(rx, rect.size.width / 2);
+        ry = MIN(ry, rect.size.height / 2);
+        return rx > 0 && ry > 0 ? CGPathCreateWithRoundedRect(rect, rx, ry, NULL) : CGPathCreateWithRect(rect, NULL);
+    }
+    if ([name isEqualToString:@"circle"] || [name isEqualToString:@"ellipse"]) {
+        CGFloat rx = ChartSVGNumber(a[@"r"], ChartSVGNumber(a[@"rx"], 0));
+        CGFloat ry = ChartSVGNumber(a[@"r"], ChartSVGNumber(a[@"ry"], 0));
+        if (rx <= 0 || ry <= 0) {
+            return NULL;
+        }
+        CGFloat cx = ChartSVGNumber(a[@"cx"], 0), cy = ChartSVGNumber(a[@"cy"], 0);
+        return CGPathCreateWithEllipseInRect(CGRectMake(cx - rx, cy - ry, rx * 2, ry * 2), NULL);
+    }
+    if ([name isEqualToString:@"line"]) {
+        CGMutablePathRef path = CGPathCreateMutable();
+        CGPathMoveToPoint(path, NULL, ChartSVGNumber(a[@"x1"], 0), ChartSVGNumber(a[@"y1"], 0));
+        CGPathAddLineToPoint(path, NULL, ChartSVGNumber(a[@"x2"], 0), ChartSVGNumber(a[@"y2"], 0));
+        return path;
+    }
+    if ([name isEqualToString:@"polyline"] || [name isEqualToString:@"polygon"]) {
+        NSArray<NSNumber*> *points = ChartSVGNumberList(a[@"points"]);
+        if (points.count < 4) {
+            return NULL;
+        }
+        CGMutablePathRef path = CGPathCreateMutable();
+        CGPathMoveToPoint(path, NULL, points[0].doubleValue, points[1].doubleValue);
+        for (NSUInteger i = 2; i + 1 < points.count; i += 2) {
+            CGPathAddLineToPoint(path, NULL, points[i].doubleValue, points[i + 1].doubleValue);
+        }
+        if ([name isEqualToString:@"polygon"]) {
+            CGPathCloseSubpath(path);
+        }
+        return path;
+    }
+    return NULL;
+}
+
+#pragma mark Painting
+
+- (void)applyStrokeStyle:(ChartSVGStyle*)style context:(CGContextRef)context
+{
+    CGContextSetLineWidth(context, style.strokeWidth);
+    CGContextSetMiterLimit(context, style.miterLimit);
+    CGContextSetLineCap(context, [style.lineCap isEqualToString:@"round"] ? kCGLineCapRound :
+                        [style.lineCap isEqualToString:@"square"] ? kCGLineCapSquare : kCGLineCapButt);
+    CGContextSetLineJoin(context, [style.lineJoin isEqualToString:@"round"] ? kCGLineJoinRound :
+                         [style.lineJoin isEqualToString:@"bevel"] ? kCGLineJoinBevel : kCGLineJoinMiter);
+
+    NSArray<NSNumber*> *dashes = [style.dashArray isEqualToString:@"none"] ? nil : ChartSVGNumberList(style.dashArray);
+    if (dashes.count) {
+        // An odd count of dashes is repeated to make it even
+        NSUInteger count = dashes.count % 2 ? dashes.count * 2 : dashes.count;
+        CGFloat *lengths = malloc(sizeof(CGFloat) * count);
+        CGFloat total = 0;
+        for (NSUInteger i = 0; i < count; i++) {
+            lengths[i] = MAX(0, dashes[i % dashes.count].doubleValue);
+            total += lengths[i];
+        }
+        if (total > 0) {
+            CGContextSetLineDash(context, 0, lengths, count);
+        }
+        free(lengths);
+    }
+    else {
+        CGContextSetLineDash(context, 0, NULL, 0);
+    }
+}
+
+- (void)paintPath:(CGPathRef)path style:(ChartSVGStyle*)style opacity:(CGFloat)opacity context:(CGContextRef)context
+{
+    BOOL evenOdd = [style.fillRule isEqualToString:@"evenodd"];
+    NSString *fill = [style resolvedPaint:style.fill];
+    if (![fill isEqualToString:@"none"]) {
+        [self paint:fill path:path evenOdd:evenOdd opacity:style.fillOpacity * opacity context:context];
+    }
+
+    NSString *stroke = [style resolvedPaint:style.stroke];
+    if (![stroke isEqualToString:@"none"] && style.strokeWidth > 0) {
+        CGContextSaveGState(context);
+        [self applyStrokeStyle:style context:context];
+        CGContextAddPath(context, path);
+        CGContextReplacePathWithStrokedPath(context);
+        CGPathRef outline = CGContextCopyPath(context);
+        CGContextBeginPath(context);
+        [self paint:stroke path:outline evenOdd:NO opacity:style.strokeOpacity * opacity context:context];
+        CGPathRelease(outline);
+        CGContextRestoreGState(context);
+    }
+}
+
+/**
+ *  Fills path with a color or a gradient reference.
+ */
+- (void)paint:(NSString*)paint path:(CGPathRef)path evenOdd:(BOOL)evenOdd opacity:(CGFloat)opacity context:(CGContextRef)context
+{
+    if (!path || CGPathIsEmpty(path)) {
+        return;
+    }
+    NSString *reference = ChartSVGReference(paint);
+    if (reference) {
+        ChartSVGNode *gradient = self.ids[reference];
+        if (gradient) {
+            [self fillPath:path gradient:gradient evenOdd:evenOdd opacity:opacity context:context];
+        }
+        return;
+    }
+    CGFloat rgba[4];
+    if (!ChartSVGParseColor(paint, rgba) || rgba[3] * opacity <= 0) {
+        return;
+    }
+    CGContextSetRGBFillColor(context, rgba[0], rgba[1], rgba[2], rgba[3] * opacity);
+    CGContextAddPath(context, path);
+    if (evenOdd) {
+        CGContextEOFillPath(context);
+    }
+    else {
+        CGContextFillPath(context);
+    }
+}
+
+- (void)fillPath:(CGPathRef)path gradient:(ChartSVGNode*)node evenOdd:(BOOL)evenOdd opacity:(CGFloat)opacity context:(CGContextRef)context
+{
+    BOOL linear = [node.name isEqualToString:@"linearGradient"];
+    if (!linear && ![node.name isEqualToString:@"radialGradient"]) {
+        return;
+    }
+    NSMutableArray<ChartSVGNode*> *stops = [NSMutableArray array];
+    for (ChartSVGNode *child in node.children) {
+        if ([child.name isEqualToString:@"stop"]) {
+            [stops addObject:child];
+        }
+    }
+    if (!stops.count) {
+        return;
+    }
+
+    NSUInteger count = stops.count;
+    CGFloat *components = malloc(sizeof(CGFloat) * 4 * count);
+    CGFloat *locations = malloc(sizeof(CGFloat) * count);
+    CGFloat previous = 0;
+    for (NSUInteger i = 0; i < count; i++) {
+        NSDictionary *a = stops[i].attributes;
+        // Offsets never go back, as in the specification
+        locations[i] = previous = MAX(previous, MIN(1, ChartSVGFraction(a[@"offset"], 0)));
+        CGFloat *rgba = components + i * 4;
+        if (!ChartSVGParseColor(a[@"stop-color"] ?: @"black", rgba)) {
+            rgba[0] = rgba[1] = rgba[2] = rgba[3] = 0;
+        }
+        rgba[3] *= ChartSVGNumber(a[@"stop-opacity"], 1) * opacity;
+    }
+    CGColorSpaceRef space = CGColorSpaceCreateDeviceRGB();
+    CGGradientRef gradient = CGGradientCreateWithColorComponents(space, components, locations, count);
+    CGColorSpaceRelease(space);
+    free(components);
+    free(locations);
+
+    NSDictionary *a = node.attributes;
+    BOOL userSpace = [a[@"gradientUnits"] isEqualToString:@"userSpaceOnUse"];
+    CGRect box = CGPathGetPathBoundingBox(path);
+
+    CGContextSaveGState(context);
+    CGContextAddPath(context, path);
+    if (evenOdd) {
+        CGContextEOClip(context);
+    }
+    else {
+        CGContextClip(context);
+    }
+    if (!userSpace) {
+        CGContextTranslateCTM(context, box.origin.x, box.origin.y);
+        CGContextScaleCTM(context, MAX(box.size.width, 1e-6), MAX(box.size.height, 1e-6));
+    }
+    if (a[@"gradientTransform"]) {
+        CGContextConcatCTM(context, ChartSVGParseTransform(a[@"gradientTransform"]));
+    }
+
+    CGGradientDrawingOptions extend = kCGGradientDrawsBeforeStartLocation | kCGGradientDrawsAfterEndLocation;
+    if (linear) {
+        CGPoint start = CGPointMake(ChartSVGFraction(a[@"x1"], 0), ChartSVGFraction(a[@"y1"], 0));
+        CGPoint end = CGPointMake(ChartSVGFraction(a[@"x2"], 1), ChartSVGFraction(a[@"y2"], 0));
+        CGContextDrawLinearGradient(context, gradient, start, end, extend);
+    }
+    else {
+        CGFloat cx = ChartSVGFraction(a[@"cx"], 0.5), cy = ChartSVGFraction(a[@"cy"], 0.5);
+        CGPoint center = CGPointMake(cx, cy);
+        CGPoint focus = CGPointMake(ChartSVGFraction(a[@"fx"], cx), ChartSVGFraction(a[@"fy"], cy));
+        CGContextDrawRadialGradient(context, gradient, focus, 0, center, ChartSVGFraction(a[@"r"], 0.5), extend);
+    }
+    CGContextRestoreGState(context);
+    CGGradientRelease(gradient);
+}
+
+- (void)clipWithReference:(NSString*)value context:(CGContextRef)context
+{
+    NSString *reference = ChartSVGReference(value);
+    ChartSVGNode *clip = reference ? self.ids[reference] : nil;
+    if (!clip) {
+        return;
+    }
+    CGMutablePathRef path = CGPathCreateMutable();
+    CGAffineTransform clipTransform = ChartSVGParseTransform(clip.attributes[@"transform"]);
+    for (ChartSVGNode *child in clip.children) {
+        CGPathRef shape = [self createPathForShape:child];
+        if (shape) {
+            CGAffineTransform transform = CGAffineTransformConcat(ChartSVGParseTransform(child.attributes[@"transform"]), clipTransform);
+            CGPathAddPath(path, &transform, shape);
+            CGPathRelease(shape);
+        }
+    }
+    // An empty clip path hides the element
+    CGContextAddPath(context, path);
+    if (CGPathIsEmpty(path)) {
+        CGContextClipToRect(context, CGRectZero);
+    }
+    else {
+        CGContextClip(context);
+    }
+    CGPathRelease(path);
+}
+
+#pragma mark Text
+
+- (CTFontRef)fontForStyle:(ChartSVGStyle*)style
+{
+    NSString *weight = style.fontWeight;
+    BOOL bold = [weight isEqualToString:@"bold"] || [weight isEqualToString:@"bolder"] || weight.integerValue >= 600;
+    NSString *key = [NSString stringWithFormat:@"%@|%g|%d", style.fontFamily, style.fontSize, bold];
+    id cached = self.fonts[key];
+    if (cached) {
+        return (__bridge CTFontRef)cached;
+    }
+
+    // The first family of the list that is installed, generic families map to Helvetica
+    CTFontRef font = NULL;
+    for (NSString *name in [style.fontFamily componentsSeparatedByString:@","]) {
+        NSString *family = [name stringByTrimmingCharactersInSet:[NSCharacterSet characterSetWithCharactersInString:@" \"'"]];
+        if (!family.length || [family isEqualToString:@"sans-serif"] || [family isEqualToString:@"serif"]) {
+            continue;
+        }
+        CTFontRef candidate = CTFontCreateWithName((__bridge CFStringRef)family, style.fontSize, NULL);
+        NSString *installed = CFBridgingRelease(CTFontCopyFamilyName(candidate));
+        if ([installed caseInsensitiveCompare:family] == NSOrderedSame) {
+            font = candidate;
+            break;
+        }
+        CFRelease(candidate);
+    }
+    if (!font) {
+        font = CTFontCreateWithName(CFSTR("Helvetica"), style.fontSize, NULL);
+    }
+    if (bold) {
+        CTFontRef boldFont = CTFontCreateCopyWithSymbolicTraits(font, 0, NULL, kCTFontBoldTrait, kCTFontBoldTrait);
+        if (boldFont) {
+            CFRelease(font);
+            font = boldFont;
+        }
+    }
+    self.fonts[key] = CFBridgingRelease(font);
+    return font;
+}
+
+/**
+ *  Collapses whitespace like the default xml:space handling.
+ */
+static NSString *ChartSVGCollapseWhitespace(NSString *string)
+{
+    NSMutableString *collapsed = [NSMutableString stringWithCapacity:string.length];
+    BOOL space = NO;
+    for (NSUInteger i = 0; i < string.length; i++) {
+        unichar c = [string characterAtIndex:i];
+        if (c == '\n' || c == '\r') {
+            continue;
+        }
+        if (c == ' ' || c == '\t') {
+            if (!space) {
+                [collapsed appendString:@" "];
+            }
+            space = YES;
+            continue;
+        }
+        space = NO;
+        [collapsed appendFormat:@"%C", c];
+    }
+    return collapsed;
+}
+
+- (void)collectRuns:(NSMutableArray<ChartSVGTextRun*>*)runs node:(ChartSVGNode*)node style:(ChartSVGStyle*)style cursor:(CGPoint*)cursor chunk:(NSUInteger*)chunk
+{
+    NSDictionary *a = node.attributes;
+    NSArray<NSNumber*> *x = ChartSVGNumberList(a[@"x"]), *y = ChartSVGNumberList(a[@"y"]);
+    NSArray<NSNumber*> *dx = ChartSVGNumberList(a[@"dx"]), *dy = ChartSVGNumberList(a[@"dy"]);
+    // An absolute x starts a new chunk, which is anchored as a whole
+    if (x.count) {
+        cursor->x = x[0].doubleValue;
+        (*chunk)++;
+    }
+    if (y.count) {
+        cursor->y = y[0].doubleValue;
+    }
+    cursor->x += dx.count ? dx[0].doubleValue : 0;
+    cursor->y += dy.count ? dy[0].doubleValue : 0;
+
+    for (ChartSVGNode *child in node.children) {
+        if ([child.name isEqualToString:@"#text"]) {
+            NSString *string = ChartSVGCollapseWhitespace(child.text);
+            if (!string.length) {
+                continue;
+            }
+            ChartSVGTextRun *run = [[ChartSVGTextRun alloc] init];
+            run.style = style;
+            NSDictionary *attributes = @{ (__bridge id)kCTFontAttributeName: (__bridge id)[self fontForStyle:style],
+                                          (__bridge id)kCTForegroundColorFromContextAttributeName: @YES };
+            NSAttributedString *attributed = [[NSAttributedString alloc] initWithString:string attributes:attributes];
+            run.line = CTLineCreateWithAttributedString((__bridge CFAttributedStringRef)attributed);
+            run.width = CTLineGetTypographicBounds(run.line, NULL, NULL, NULL);
+            run.position = *cursor;
+            run.chunk = *chunk;
+            [runs addObject:run];
+            cursor->x += run.width;
+        }
+        else if ([child.name isEqualToString:@"tspan"] && ![child.attributes[@"display"] isEqualToString:@"none"]) {
+            [self collectRuns:runs node:child style:[style styleWithAttributes:child.attributes] cursor:cursor chunk:chunk];
+        }
+    }
+}
+
+- (void)drawText:(ChartSVGNode*)node style:(ChartSVGStyle*)style opacity:(CGFloat)opacity context:(CGContextRef)context
+{
+    NSMutableArray<ChartSVGTextRun*> *runs = [NSMutableArray array];
+    CGPoint cursor = CGPointZero;
+    NSUInteger chunk = 0;
+    [self collectRuns:runs node:node style:style cursor:&cursor chunk:&chunk];
+
+    // Anchors move each chunk by its width, using the anchor of the text element
+    NSMutableDictionary<NSNumber*, NSNumber*> *chunkWidths = [NSMutableDictionary dictionary];
+    for (ChartSVGTextRun *run in runs) {
+        chunkWidths[@(run.chunk)] = @(chunkWidths[@(run.chunk)].doubleValue + run.width);
+    }
+    CGFloat anchor = [style.textAnchor isEqualToString:@"middle"] ? 0.5 : [style.textAnchor isEqualToString:@"end"] ? 1 : 0;
+
+    for (ChartSVGTextRun *run in runs) {
+        if (![run.style.visibility isEqualToString:@"visible"]) {
+            continue;
+        }
+        CGFloat shift = -anchor * chunkWidths[@(run.chunk)].doubleValue;
+        ChartSVGStyle *runStyle = run.style;
+        CGFloat fill[4], stroke[4];
+        BOOL hasFill = ChartSVGParseColor([runStyle resolvedPaint:runStyle.fill], fill);
+        BOOL hasStroke = runStyle.strokeWidth > 0 && ChartSVGParseColor([runStyle resolvedPaint:runStyle.stroke], stroke);
+        if (!hasFill && !hasStroke) {
+            continue;
+        }
+
+        CGContextSaveGState(context);
+        CGContextTranslateCTM(context, run.position.x + shift, run.position.y);
+        // Core Text draws in a y-up space
+        CGContextScaleCTM(context, 1, -1);
+        CGContextSetTextMatrix(context, CGAffineTransformIdentity);
+        CGContextSetTextPosition(context, 0, 0);
+        if (hasFill) {
+            CGContextSetRGBFillColor(context, fill[0], fill[1], fill[2], fill[3] * runStyle.fillOpacity * opacity);
+        }
+        if (hasStroke) {
+            [self applyStrokeStyle:runStyle context:context];
+            CGContextSetRGBStrokeColor(context, stroke[0], stroke[1], stroke[2], stroke[3] * runStyle.strokeOpacity * opacity);
+        }
+        CGContextSetTextDrawingMode(context, hasFill && hasStroke ? kCGTextFillStroke : hasStroke ? kCGTextStroke : kCGTextFill);
+        CTLineDraw(run.line, context);
+        CGContextRestoreGState(context);
+    }
+}
+
+#pragma mark Images
+
+- (void)drawImage:(ChartSVGNode*)node opacity:(CGFloat)opacity context:(CGContextRef)context
+{
+    NSDictionary *a = node.attributes;
+    NSString *href = a[@"xlink:href"] ?: a[@"href"];
+    NSRange comma = [href rangeOfString:@","];
+    // Only embedded images, the renderer does not load from the network
+    if (![href hasPrefix:@"data:"] || comma.location == NSNotFound) {
+        return;
+    }
+    NSString *payload = [href substringFromIndex:comma.location + 1];
+    NSData *data = [[href substringToIndex:comma.location] hasSuffix:@";base64"] ?
+        [[NSData alloc] initWithBase64EncodedString:payload options:NSDataBase64DecodingIgnoreUnknownCharacters] :
+        [[payload stringByRemovingPercentEncoding] dataUsingEncoding:NSUTF8StringEncoding];
+    if (!data) {
+        return;
+    }
+    CGImageSourceRef source = CGImageSourceCreateWithData((__bridge CFDataRef)data, NULL);
+    CGImageRef image = source ? CGImageSourceCreateImageAtIndex(source, 0, NULL) : NULL;
+    if (source) {
+        CFRelease(source);
+    }
+    if (!image) {
+        return;
+    }
+    CGRect rect = CGRectMake(ChartSVGNumber(a[@"x"], 0), ChartSVGNumber(a[@"y"], 0),
+                             ChartSVGNumber(a[@"width"], CGImageGetWidth(image)), ChartSVGNumber(a[@"height"], CGImageGetHeight(image)));
+    CGContextSaveGState(context);
+    CGContextSetAlpha(context, opacity);
+    CGContextTranslateCTM(context, rect.origin.x, rect.origin.y + rect.size.height);
+    CGContextScaleCTM(context, 1, -1);
+    CGContextDrawImage(context, CGRectMake(0, 0, rect.size.width, rect.size.height), image);
+    CGContextRestoreGState(context);
+    CGImageRelease(image);
+}
+
+@end
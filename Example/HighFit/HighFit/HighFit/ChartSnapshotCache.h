@@ -0,0 +1,56 @@
+//
+//  ChartSnapshotCache.h
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+#import <Highcharts/Highcharts.h>
+
+/**
+ *  Memory and disk cache of chart snapshots, keyed by a hash of the serialized options and the view size.
+ *  Both levels evict the least recently used snapshots once their byte budget is exceeded.
+ */
+@interface ChartSnapshotCache : NSObject
+
++ (instancetype)sharedCache;
+
+/**
+ *  Creates a cache storing its files in directory, which is created when needed.
+ */
+- (instancetype)initWithDirectory:(NSString*)directory;
+
+/**
+ *  Byte budget of decoded bitmaps kept in memory. Defaults to 16 MB.
+ */
+@property (assign, nonatomic) NSUInteger memoryByteLimit;
+
+/**
+ *  Byte budget of the PNG files kept on disk. Defaults to 64 MB.
+ */
+@property (assign, nonatomic) NSUInteger diskByteLimit;
+
+/**
+ *  Stable key for options drawn at a size and scale. Dictionary keys are sorted before hashing,
+ *  so equal options give equal keys across launches.
+ */
++ (NSString*)keyForOptions:(HIOptions*)options size:(CGSize)size scale:(CGFloat)scale;
+
+/**
+ *  Returns a snapshot from memory, without touching the disk.
+ */
+- (UIImage*)memoryImageForKey:(NSString*)key;
+
+/**
+ *  Looks up a snapshot in memory, then on disk, and renders it with ChartSnapshotRenderer on a miss.
+ *  The completion is called on the main queue, right away when the snapshot is in memory.
+ */
+- (void)imageForOptions:(HIOptions*)options size:(CGSize)size completion:(void (^)(UIImage *image))completion;
+
+- (void)storeImage:(UIImage*)image forKey:(NSString*)key;
+- (void)removeImageForKey:(NSString*)key;
+- (void)removeAllImages;
+
+@end
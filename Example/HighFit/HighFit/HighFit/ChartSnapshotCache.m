@@ -0,0 +1,350 @@
+//
+//  ChartSnapshotCache.m
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import "ChartSnapshotCache.h"
+#import "ChartSnapshotRenderer.h"
+#import <CommonCrypto/CommonDigest.h>
+
+// Bump when the renderer output changes, so stale snapshots are not served
+static NSString * const ChartSnapshotCacheVersion = @"2";
+
+@interface ChartSnapshotCache ()
+@property (strong, nonatomic) NSString *directory;
+@property (strong, nonatomic) NSMutableDictionary *images;
+@property (strong, nonatomic) NSMutableArray *recentKeys;
+@property (assign, nonatomic) NSUInteger memoryUsage;
+@property (assign, nonatomic) NSInteger diskUsage;
+@property (strong, nonatomic) dispatch_queue_t queue;
+@end
+
+@implementation ChartSnapshotCache
+
++ (instancetype)sharedCache
+{
+    static ChartSnapshotCache *sharedCache = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        NSString *caches = [NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES) firstObject];
+        sharedCache = [[ChartSnapshotCache alloc] initWithDirectory:[caches stringByAppendingPathComponent:@"ChartSnapshots"]];
+    });
+
+    return sharedCache;
+}
+
+- (instancetype)initWithDirectory:(NSString*)directory
+{
+    self = [super init];
+    if (self) {
+        self.directory = directory;
+        self.images = [NSMutableDictionary dictionary];
+        self.recentKeys = [NSMutableArray array];
+        self.memoryByteLimit = 16 * 1024 * 1024;
+        self.diskByteLimit = 64 * 1024 * 1024;
+        // Unknown until the directory is first scanned
+        self.diskUsage = -1;
+        self.queue = dispatch_queue_create("com.highsoft.highfit.snapshots", DISPATCH_QUEUE_SERIAL);
+
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(didReceiveMemoryWarning:) name:UIApplicationDidReceiveMemoryWarningNotification object:nil];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+- (void)didReceiveMemoryWarning:(NSNotification*)notification
+{
+    @synchronized (self) {
+        [self.images removeAllObjects];
+        [self.recentKeys removeAllObjects];
+        self.memoryUsage = 0;
+    }
+}
+
+#pragma mark - Keys
+
+static void ChartSnapshotAppendString(NSMutableString *string, NSString *value)
+{
+    NSString *escaped = [value stringByReplacingOccurrencesOfString:@"\\" withString:@"\\\\"];
+    escaped = [escaped stringByReplacingOccurrencesOfString:@"\"" withString:@"\\\""];
+    [string appendFormat:@"\"%@\"", escaped];
+}
+
+// Serializes params like JSON with sorted keys, so that equal options give equal keys and
+// different ones cannot collide. Booleans and null are written as such rather than described,
+// since @YES describes itself as 1 and NSNull as <null>.
+static void ChartSnapshotAppendCanonical(NSMutableString *string, id value)
+{
+    if ([value isKindOfClass:[NSDictionary class]]) {
+        [string appendString:@"{"];
+        for (id key in [[value allKeys] sortedArrayUsingSelector:@selector(compare:)]) {
+            ChartSnapshotAppendString(string, [key description]);
+            [string appendString:@":"];
+            ChartSnapshotAppendCanonical(string, value[key]);
+            [string appendString:@","];
+        }
+        [string appendString:@"}"];
+    }
+    else if ([value isKindOfClass:[NSArray class]]) {
+        [string appendString:@"["];
+        for (id item in value) {
+            ChartSnapshotAppendCanonical(string, item);
+            [string appendString:@","];
+        }
+        [string appendString:@"]"];
+    }
+    else if ([value isKindOfClass:[NSString class]]) {
+        ChartSnapshotAppendString(string, value);
+    }
+    else if ([value isKindOfClass:[NSNumber class]]) {
+        if (CFGetTypeID((__bridge CFTypeRef)value) == CFBooleanGetTypeID()) {
+            [string appendString:[value boolValue] ? @"true" : @"false"];
+        }
+        else {
+            [string appendString:[value stringValue]];
+        }
+    }
+    else if (!value || value == [NSNull null]) {
+        [string appendString:@"null"];
+    }
+    else if ([value respondsToSelector:@selector(getParams)]) {
+        ChartSnapshotAppendCanonical(string, [value getParams]);
+    }
+    else if ([value respondsToSelector:@selector(getData)]) {
+        ChartSnapshotAppendCanonical(string, [value getData]);
+    }
+    else if ([value respondsToSelector:@selector(getFunction)]) {
+        [string appendString:@"function"];
+        ChartSnapshotAppendCanonical(string, [value getFunction]);
+    }
+    else {
+        // Tagged with the class, so no other value can read the same
+        [string appendFormat:@"<%@>", NSStringFromClass([value class])];
+        ChartSnapshotAppendString(string, [value description]);
+    }
+}
+
++ (NSString*)keyForParams:(NSDictionary*)params size:(CGSize)size scale:(CGFloat)scale
+{
+    NSMutableString *canonical = [NSMutableString stringWithFormat:@"%@|%gx%g@%g|", ChartSnapshotCacheVersion, size.width, size.height, scale];
+    ChartSnapshotAppendCanonical(canonical, params);
+
+    NSData *data = [canonical dataUsingEncoding:NSUTF8StringEncoding];
+    unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256(data.bytes, (CC_LONG)data.length, digest);
+
+    NSMutableString *key = [NSMutableString stringWithCapacity:CC_SHA256_DIGEST_LENGTH * 2];
+    for (NSUInteger i = 0; i < CC_SHA256_DIGEST_LENGTH; i++) {
+        [key appendFormat:@"%02x", digest[i]];
+    }
+    return key;
+}
+
++ (NSString*)keyForOptions:(HIOptions*)options size:(CGSize)size scale:(CGFloat)scale
+{
+    return [self keyForParams:[options getParams] size:size scale:scale];
+}
+
+#pragma mark - Memory
+
+- (UIImage*)memoryImageForKey:(NSString*)key
+{
+    @synchronized (self) {
+        UIImage *image = self.images[key];
+        if (image) {
+            [self.recentKeys removeObject:key];
+            [self.recentKeys addObject:key];
+        }
+        return image;
+    }
+}
+
+static NSUInteger ChartSnapshotCost(UIImage *image)
+{
+    CGImageRef cgImage = image.CGImage;
+    return cgImage ? CGImageGetBytesPerRow(cgImage) * CGImageGetHeight(cgImage) : 0;
+}
+
+- (void)storeMemoryImage:(UIImage*)image forKey:(NSString*)key
+{
+    @synchronized (self) {
+        [self removeMemoryImageForKey:key];
+        NSUInteger cost = ChartSnapshotCost(image);
+        if (cost > self.memoryByteLimit) {
+            return;
+        }
+        self.images[key] = image;
+        [self.recentKeys addObject:key];
+        self.memoryUsage += cost;
+
+        while (self.memoryUsage > self.memoryByteLimit && self.recentKeys.count) {
+            [self removeMemoryImageForKey:self.recentKeys.firstObject];
+        }
+    }
+}
+
+- (void)removeMemoryImageForKey:(NSString*)key
+{
+    @synchronized (self) {
+        UIImage *image = self.images[key];
+        if (image) {
+            self.memoryUsage -= ChartSnapshotCost(image);
+            [self.images removeObjectForKey:key];
+            [self.recentKeys removeObject:key];
+        }
+    }
+}
+
+#pragma mark - Disk
+
+- (NSString*)pathForKey:(NSString*)key
+{
+    return [self.directory stringByAppendingPathComponent:[key stringByAppendingPathExtension:@"png"]];
+}
+
+// Disk methods run on the cache queue
+
+- (UIImage*)diskImageForKey:(NSString*)key scale:(CGFloat)scale
+{
+    NSString *path = [self pathForKey:key];
+    NSData *data = [NSData dataWithContentsOfFile:path];
+    if (!data) {
+        return nil;
+    }
+    // The modification date doubles as the last access time for eviction
+    [[NSFileManager defaultManager] setAttributes:@{ NSFileModificationDate: [NSDate date] } ofItemAtPath:path error:nil];
+    return [UIImage imageWithData:data scale:scale];
+}
+
+- (void)writeDiskImage:(UIImage*)image forKey:(NSString*)key
+{
+    NSData *data = UIImagePNGRepresentation(image);
+    if (!data || data.length > self.diskByteLimit) {
+        return;
+    }
+    NSFileManager *manager = [NSFileManager defaultManager];
+    [manager createDirectoryAtPath:self.directory withIntermediateDirectories:YES attributes:nil error:nil];
+
+    NSString *path = [self pathForKey:key];
+    NSInteger previous = (NSInteger)[[manager attributesOfItemAtPath:path error:nil] fileSize];
+    if (![data writeToFile:path atomically:YES]) {
+        return;
+    }
+    if (self.diskUsage >= 0) {
+        self.diskUsage += (NSInteger)data.length - previous;
+    }
+    [self trimDisk];
+}
+
+- (void)trimDisk
+{
+    NSFileManager *manager = [NSFileManager defaultManager];
+    if (self.diskUsage >= 0 && self.diskUsage <= (NSInteger)self.diskByteLimit) {
+        return;
+    }
+
+    NSArray *keys = @[ NSURLContentModificationDateKey, NSURLFileSizeKey ];
+    NSArray *files = [manager contentsOfDirectoryAtURL:[NSURL fileURLWithPath:self.directory] includingPropertiesForKeys:keys options:NSDirectoryEnumerationSkipsHiddenFiles error:nil];
+    NSMutableArray *entries = [NSMutableArray array];
+    NSInteger usage = 0;
+    for (NSURL *file in files) {
+        NSDictionary *values = [file resourceValuesForKeys:keys error:nil];
+        if (values[NSURLFileSizeKey]) {
+            usage += [values[NSURLFileSizeKey] integerValue];
+            [entries addObject:@[ values[NSURLContentModificationDateKey] ?: [NSDate distantPast], values[NSURLFileSizeKey], file ]];
+        }
+    }
+    [entries sortUsingComparator:^NSComparisonResult(NSArray *a, NSArray *b) {
+        return [a[0] compare:b[0]];
+    }];
+    for (NSArray *entry in entries) {
+        if (usage <= (NSInteger)self.diskByteLimit) {
+            break;
+        }
+        if ([manager removeItemAtURL:entry[2] error:nil]) {
+            usage -= [entry[1] integerValue];
+        }
+    }
+    self.diskUsage = usage;
+}
+
+#pragma mark - Public
+
+- (void)imageForOptions:(HIOptions*)options size:(CGSize)size completion:(void (^)(UIImage *image))completion
+{
+    CGFloat scale = [UIScreen mainScreen].scale;
+    NSDictionary *params = [options getParams];
+    NSString *key = [ChartSnapshotCache keyForParams:params size:size scale:scale];
+
+    UIImage *image = [self memoryImageForKey:key];
+    if (image) {
+        if (completion) {
+            completion(image);
+        }
+        return;
+    }
+
+    dispatch_async(self.queue, ^{
+        UIImage *snapshot = [self diskImageForKey:key scale:scale];
+        if (!snapshot) {
+            ChartSnapshotRenderer *renderer = [[ChartSnapshotRenderer alloc] initWithParams:params];
+            snapshot = [renderer imageWithSize:size scale:scale];
+            if (snapshot) {
+                [self writeDiskImage:snapshot forKey:key];
+            }
+        }
+        if (snapshot) {
+            [self storeMemoryImage:snapshot forKey:key];
+        }
+        if (completion) {
+            dispatch_async(dispatch_get_main_queue(), ^{
+                completion(snapshot);
+            });
+        }
+    });
+}
+
+- (void)storeImage:(UIImage*)image forKey:(NSString*)key
+{
+    if (!image || !key) {
+        return;
+    }
+    [self storeMemoryImage:image forKey:key];
+    dispatch_async(self.queue, ^{
+        [self writeDiskImage:image forKey:key];
+    });
+}
+
+- (void)removeImageForKey:(NSString*)key
+{
+    [self removeMemoryImageForKey:key];
+    dispatch_async(self.queue, ^{
+        NSString *path = [self pathForKey:key];
+        NSInteger size = (NSInteger)[[[NSFileManager defaultManager] attributesOfItemAtPath:path error:nil] fileSize];
+        if ([[NSFileManager defaultManager] removeItemAtPath:path error:nil] && self.diskUsage >= 0) {
+            self.diskUsage -= size;
+        }
+    });
+}
+
+- (void)removeAllImages
+{
+    @synchronized (self) {
+        [self.images removeAllObjects];
+        [self.recentKeys removeAllObjects];
+        self.memoryUsage = 0;
+    }
+    dispatch_async(self.queue, ^{
+        [[NSFileManager defaultManager] removeItemAtPath:self.directory error:nil];
+        self.diskUsage = 0;
+    });
+}
+
+@end
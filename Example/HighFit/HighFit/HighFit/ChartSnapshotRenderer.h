@@ -0,0 +1,55 @@
+//
+//  ChartSnapshotRenderer.h
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+// CHART_SNAPSHOT_HEADLESS builds the renderer without UIKit and the framework, for the reference
+// image comparison in Snapshots that runs on macOS
+#if CHART_SNAPSHOT_HEADLESS
+#import <Foundation/Foundation.h>
+#import <CoreGraphics/CoreGraphics.h>
+#else
+#import <UIKit/UIKit.h>
+#import <Highcharts/Highcharts.h>
+#endif
+
+/**
+ *  Draws a static picture of a chart with Core Graphics, without starting a web view.
+ *  Line, spline, area, areaspline, column, bar, pie and scatter series are supported, and axes,
+ *  ticks and labels are laid out with the same rules as the JavaScript library.
+ *  The renderer only touches the context it is given, so it can run on a background queue
+ *  or headless against a bitmap context.
+ */
+@interface ChartSnapshotRenderer : NSObject
+
+/**
+ *  The serialized options the snapshot is drawn from.
+ */
+@property (strong, nonatomic, readonly) NSDictionary *params;
+
+#if !CHART_SNAPSHOT_HEADLESS
+- (instancetype)initWithOptions:(HIOptions*)options;
+#endif
+- (instancetype)initWithParams:(NSDictionary*)params;
+
+/**
+ *  Draws the chart into a context with a top-left origin, in points.
+ */
+- (void)drawInContext:(CGContextRef)context size:(CGSize)size;
+
+/**
+ *  Renders the chart into a new bitmap image.
+ */
+- (CGImageRef)newCGImageWithSize:(CGSize)size scale:(CGFloat)scale CF_RETURNS_RETAINED;
+
+#if !CHART_SNAPSHOT_HEADLESS
+/**
+ *  Renders the chart into a new bitmap image.
+ */
+- (UIImage*)imageWithSize:(CGSize)size scale:(CGFloat)scale;
+#endif
+
+@end
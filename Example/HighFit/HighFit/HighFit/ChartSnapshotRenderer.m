@@ -0,0 +1,1950 @@
+//
+//  ChartSnapshotRenderer.m
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import "ChartSnapshotRenderer.h"
+#import <CoreText/CoreText.h>
+
+#pragma mark - Model
+
+@interface SnapshotPoint : NSObject
+@property (assign, nonatomic) double x;
+@property (assign, nonatomic) double y;
+@property (assign, nonatomic) double low;
+@property (assign, nonatomic) double high;
+@property (assign, nonatomic) CGFloat plotX;
+@property (assign, nonatomic) CGFloat plotY;
+@property (assign, nonatomic) BOOL isNull;
+@property (strong, nonatomic) NSString *name;
+@property (strong, nonatomic) id color;
+@end
+
+@implementation SnapshotPoint
+@end
+
+@interface SnapshotSeries : NSObject
+@property (strong, nonatomic) NSString *type;
+@property (strong, nonatomic) NSDictionary *options;
+@property (strong, nonatomic) NSMutableArray *points;
+@property (strong, nonatomic) id color;
+@property (strong, nonatomic) NSString *stackKey;
+@property (assign, nonatomic) NSInteger index;
+@property (assign, nonatomic) NSInteger columnIndex;
+@end
+
+@implementation SnapshotSeries
+@end
+
+@interface SnapshotAxis : NSObject
+@property (strong, nonatomic) NSDictionary *options;
+@property (strong, nonatomic) NSArray *categories;
+@property (strong, nonatomic) NSArray *ticks;
+@property (assign, nonatomic) BOOL isX;
+@property (assign, nonatomic) BOOL horizontal;
+@property (assign, nonatomic) BOOL reversed;
+@property (assign, nonatomic) BOOL datetime;
+@property (assign, nonatomic) double dataMin;
+@property (assign, nonatomic) double dataMax;
+@property (assign, nonatomic) double min;
+@property (assign, nonatomic) double max;
+@property (assign, nonatomic) double tickInterval;
+@property (assign, nonatomic) double dateUnit;
+@property (assign, nonatomic) double threshold;
+@property (assign, nonatomic) BOOL softThreshold;
+@property (assign, nonatomic) double pointRange;
+@property (assign, nonatomic) double minPointOffset;
+@property (assign, nonatomic) CGFloat pos;
+@property (assign, nonatomic) CGFloat len;
+@end
+
+@implementation SnapshotAxis
+
+- (CGFloat)toPixels:(double)value
+{
+    double range = self.max - self.min + 2 * self.minPointOffset;
+    double scale = range > 0 ? self.len / range : 0;
+    double offset = (value - self.min + self.minPointOffset) * scale;
+    // Vertical axes grow upwards, so a non-reversed vertical axis counts from the bottom
+    BOOL fromEnd = self.horizontal ? self.reversed : !self.reversed;
+    double pixels = fromEnd ? self.pos + self.len - offset : self.pos + offset;
+    return (CGFloat)MAX(-1e5, MIN(1e5, pixels));
+}
+
+@end
+
+#pragma mark - Option helpers
+
+static double const SnapshotSpacing[4] = { 10, 10, 15, 10 };
+
+static id SnapshotValue(NSDictionary *dict, NSString *key)
+{
+    id value = [dict isKindOfClass:[NSDictionary class]] ? dict[key] : nil;
+    return value == [NSNull null] ? nil : value;
+}
+
+static NSDictionary *SnapshotDictionary(id value)
+{
+    if ([value isKindOfClass:[NSArray class]]) {
+        value = [value firstObject];
+    }
+    return [value isKindOfClass:[NSDictionary class]] ? value : @{};
+}
+
+static double SnapshotNumber(id value, double fallback)
+{
+    if ([value isKindOfClass:[NSNumber class]] || [value isKindOfClass:[NSString class]]) {
+        // Also accepts CSS lengths like "14px"
+        NSScanner *scanner = [NSScanner scannerWithString:[value description]];
+        double number;
+        if ([scanner scanDouble:&number]) {
+            return number;
+        }
+    }
+    return fallback;
+}
+
+static BOOL SnapshotBool(id value, BOOL fallback)
+{
+    if ([value isKindOfClass:[NSNumber class]] || [value isKindOfClass:[NSString class]]) {
+        return [value boolValue];
+    }
+    return fallback;
+}
+
+static NSDictionary *SnapshotMerge(NSDictionary *base, NSDictionary *extra)
+{
+    NSMutableDictionary *merged = [NSMutableDictionary dictionaryWithDictionary:base ?: @{}];
+    [extra enumerateKeysAndObjectsUsingBlock:^(id key, id obj, BOOL *stop) {
+        if ([obj isKindOfClass:[NSDictionary class]] && [merged[key] isKindOfClass:[NSDictionary class]]) {
+            merged[key] = SnapshotMerge(merged[key], obj);
+        }
+        else if (obj != [NSNull null]) {
+            merged[key] = obj;
+        }
+    }];
+    return merged;
+}
+
+static double SnapshotCorrectFloat(double value)
+{
+    return [[NSString stringWithFormat:@"%.14g", value] doubleValue];
+}
+
+#pragma mark - Colors
+
+static BOOL SnapshotParseColor(id value, CGFloat rgba[4])
+{
+    if (![value isKindOfClass:[NSString class]]) {
+        return NO;
+    }
+    NSString *string = [[value stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceCharacterSet]] lowercaseString];
+
+    if ([string hasPrefix:@"#"]) {
+        unsigned int hex = 0;
+        NSString *digits = [string substringFromIndex:1];
+        if (![[NSScanner scannerWithString:digits] scanHexInt:&hex]) {
+            return NO;
+        }
+        if (digits.length == 3) {
+            rgba[0] = ((hex >> 8) & 0xf) * 17 / 255.0;
+            rgba[1] = ((hex >> 4) & 0xf) * 17 / 255.0;
+            rgba[2] = (hex & 0xf) * 17 / 255.0;
+        }
+        else if (digits.length == 6) {
+            rgba[0] = ((hex >> 16) & 0xff) / 255.0;
+            rgba[1] = ((hex >> 8) & 0xff) / 255.0;
+            rgba[2] = (hex & 0xff) / 255.0;
+        }
+        else {
+            return NO;
+        }
+        rgba[3] = 1;
+        return YES;
+    }
+
+    if ([string hasPrefix:@"rgb"]) {
+        NSRange open = [string rangeOfString:@"("];
+        NSRange close = [string rangeOfString:@")"];
+        if (open.location == NSNotFound || close.location == NSNotFound || close.location < open.location) {
+            return NO;
+        }
+        NSString *inner = [string substringWithRange:NSMakeRange(open.location + 1, close.location - open.location - 1)];
+        NSArray *parts = [inner componentsSeparatedByString:@","];
+        if (parts.count < 3) {
+            return NO;
+        }
+        for (NSUInteger i = 0; i < 3; i++) {
+            rgba[i] = MAX(0, MIN(255, [parts[i] doubleValue])) / 255.0;
+        }
+        rgba[3] = parts.count > 3 ? MAX(0, MIN(1, [parts[3] doubleValue])) : 1;
+        return YES;
+    }
+
+    NSDictionary *names = @{
+                            @"white": @"#ffffff", @"black": @"#000000", @"red": @"#ff0000", @"green": @"#008000",
+                            @"blue": @"#0000ff", @"yellow": @"#ffff00", @"orange": @"#ffa500", @"gray": @"#808080",
+                            @"grey": @"#808080", @"silver": @"#c0c0c0", @"purple": @"#800080"
+                            };
+    if (names[string]) {
+        return SnapshotParseColor(names[string], rgba);
+    }
+    if ([string isEqualToString:@"transparent"]) {
+        rgba[0] = rgba[1] = rgba[2] = rgba[3] = 0;
+        return YES;
+    }
+    return NO;
+}
+
+static BOOL SnapshotIsGradient(id paint)
+{
+    return [paint isKindOfClass:[NSDictionary class]] && (paint[@"linearGradient"] || paint[@"radialGradient"]);
+}
+
+static void SnapshotSetFillColor(CGContextRef context, id paint, CGFloat opacity)
+{
+    CGFloat rgba[4] = { 0, 0, 0, 0 };
+    SnapshotParseColor(paint, rgba);
+    CGContextSetRGBFillColor(context, rgba[0], rgba[1], rgba[2], rgba[3] * opacity);
+}
+
+static BOOL SnapshotSetStrokeColor(CGContextRef context, id paint, CGFloat opacity)
+{
+    CGFloat rgba[4];
+    if (!SnapshotParseColor(paint, rgba) || rgba[3] == 0) {
+        return NO;
+    }
+    CGContextSetRGBStrokeColor(context, rgba[0], rgba[1], rgba[2], rgba[3] * opacity);
+    return YES;
+}
+
+/**
+ *  Picks the first stop color of a gradient, used where a single color is needed.
+ */
+static id SnapshotSolidColor(id paint)
+{
+    if (SnapshotIsGradient(paint)) {
+        NSArray *stops = paint[@"stops"];
+        return [stops.firstObject isKindOfClass:[NSArray class]] && [stops.firstObject count] > 1 ? stops.firstObject[1] : nil;
+    }
+    return paint;
+}
+
+/**
+ *  Fills a path with a color or gradient. Gradient coordinates are fractions of box, or pixels
+ *  from origin when any of them is above 1, like userSpaceOnUse gradients in the SVG renderer.
+ */
+static void SnapshotFillPath(CGContextRef context, CGPathRef path, id paint, CGRect box, CGPoint origin, CGFloat opacity)
+{
+    if (!path || !paint) {
+        return;
+    }
+    if (!SnapshotIsGradient(paint)) {
+        SnapshotSetFillColor(context, paint, opacity);
+        CGContextAddPath(context, path);
+        CGContextFillPath(context);
+        return;
+    }
+
+    NSArray *stops = paint[@"stops"];
+    NSUInteger count = stops.count;
+    if (count == 0) {
+        return;
+    }
+    CGFloat *components = malloc(sizeof(CGFloat) * 4 * count);
+    CGFloat *locations = malloc(sizeof(CGFloat) * count);
+    for (NSUInteger i = 0; i < count; i++) {
+        NSArray *stop = stops[i];
+        locations[i] = SnapshotNumber(stop.firstObject, 0);
+        if (!SnapshotParseColor(stop.lastObject, components + i * 4)) {
+            components[i * 4] = components[i * 4 + 1] = components[i * 4 + 2] = components[i * 4 + 3] = 0;
+        }
+        components[i * 4 + 3] *= opacity;
+    }
+    CGColorSpaceRef space = CGColorSpaceCreateDeviceRGB();
+    CGGradientRef gradient = CGGradientCreateWithColorComponents(space, components, locations, count);
+    free(components);
+    free(locations);
+
+    CGContextSaveGState(context);
+    CGContextAddPath(context, path);
+    CGContextClip(context);
+
+    CGGradientDrawingOptions extend = kCGGradientDrawsBeforeStartLocation | kCGGradientDrawsAfterEndLocation;
+    NSDictionary *linear = SnapshotValue(paint, @"linearGradient");
+    if (linear) {
+        double x1 = SnapshotNumber(linear[@"x1"], 0), y1 = SnapshotNumber(linear[@"y1"], 0);
+        double x2 = SnapshotNumber(linear[@"x2"], 0), y2 = SnapshotNumber(linear[@"y2"], 0);
+        BOOL userSpace = x1 > 1 || y1 > 1 || x2 > 1 || y2 > 1;
+        CGRect space = userSpace ? CGRectMake(origin.x, origin.y, 1, 1) : box;
+        CGPoint start = CGPointMake(space.origin.x + x1 * space.size.width, space.origin.y + y1 * space.size.height);
+        CGPoint end = CGPointMake(space.origin.x + x2 * space.size.width, space.origin.y + y2 * space.size.height);
+        CGContextDrawLinearGradient(context, gradient, start, end, extend);
+    }
+    else {
+        NSDictionary *radial = SnapshotValue(paint, @"radialGradient");
+        CGPoint center = CGPointMake(box.origin.x + SnapshotNumber(radial[@"cx"], 0.5) * box.size.width,
+                                     box.origin.y + SnapshotNumber(radial[@"cy"], 0.5) * box.size.height);
+        CGFloat radius = SnapshotNumber(radial[@"r"], 0.5) * MAX(box.size.width, box.size.height);
+        CGContextDrawRadialGradient(context, gradient, center, 0, center, radius, kCGGradientDrawsAfterEndLocation);
+    }
+    CGContextRestoreGState(context);
+    CGGradientRelease(gradient);
+    CGColorSpaceRelease(space);
+}
+
+/**
+ *  Copies a path with later moves turned into lines, so separate subpaths close as one outline.
+ */
+static CGMutablePathRef SnapshotCreateJoinedPath(CGPathRef path)
+{
+    CGMutablePathRef joined = CGPathCreateMutable();
+    __block BOOL started = NO;
+    CGPathApplyWithBlock(path, ^(const CGPathElement *element) {
+        CGPoint *points = element->points;
+        switch (element->type) {
+            case kCGPathElementMoveToPoint:
+                if (started) {
+                    CGPathAddLineToPoint(joined, NULL, points[0].x, points[0].y);
+                }
+                else {
+                    CGPathMoveToPoint(joined, NULL, points[0].x, points[0].y);
+                }
+                started = YES;
+                break;
+            case kCGPathElementAddLineToPoint:
+                CGPathAddLineToPoint(joined, NULL, points[0].x, points[0].y);
+                break;
+            case kCGPathElementAddQuadCurveToPoint:
+                CGPathAddQuadCurveToPoint(joined, NULL, points[0].x, points[0].y, points[1].x, points[1].y);
+                break;
+            case kCGPathElementAddCurveToPoint:
+                CGPathAddCurveToPoint(joined, NULL, points[0].x, points[0].y, points[1].x, points[1].y, points[2].x, points[2].y);
+                break;
+            case kCGPathElementCloseSubpath:
+                break;
+        }
+    });
+    return joined;
+}
+
+#pragma mark - Text
+
+typedef struct {
+    CTFontRef font;
+    CGFloat fontSize;
+    CGFloat color[4];
+    CGFloat outline[4];
+    CGFloat outlineWidth;
+} SnapshotTextStyle;
+
+static SnapshotTextStyle SnapshotTextStyleMake(NSDictionary *defaults, id style)
+{
+    NSDictionary *css = SnapshotMerge(defaults, [style isKindOfClass:[NSDictionary class]] ? style : nil);
+    SnapshotTextStyle text;
+    text.fontSize = SnapshotNumber(css[@"fontSize"], 12);
+
+    NSString *family = @"Helvetica";
+    for (NSString *name in [SnapshotValue(css, @"fontFamily") componentsSeparatedByString:@","]) {
+        NSString *trimmed = [name stringByTrimmingCharactersInSet:[NSCharacterSet characterSetWithCharactersInString:@" \"'"]];
+        if (trimmed.length && ![trimmed isEqualToString:@"sans-serif"]) {
+            family = trimmed;
+            break;
+        }
+    }
+    CTFontRef font = CTFontCreateWithName((__bridge CFStringRef)family, text.fontSize, NULL);
+    NSString *weight = [SnapshotValue(css, @"fontWeight") description];
+    if ([weight isEqualToString:@"bold"] || weight.integerValue >= 600) {
+        CTFontRef bold = CTFontCreateCopyWithSymbolicTraits(font, 0, NULL, kCTFontBoldTrait, kCTFontBoldTrait);
+        if (bold) {
+            CFRelease(font);
+            font = bold;
+        }
+    }
+    text.font = font;
+
+    if (!SnapshotParseColor(SnapshotValue(css, @"color"), text.color)) {
+        text.color[0] = text.color[1] = text.color[2] = 0.2;
+        text.color[3] = 1;
+    }
+    // textOutline is "width color", an outline with a color the renderer can't parse is not drawn
+    text.outlineWidth = 0;
+    NSArray *outline = [[SnapshotValue(css, @"textOutline") description] componentsSeparatedByString:@" "];
+    if (outline.count == 2 && SnapshotParseColor(outline[1], text.outline)) {
+        text.outlineWidth = SnapshotNumber(outline[0], 0);
+    }
+    return text;
+}
+
+static void SnapshotTextStyleRelease(SnapshotTextStyle *text)
+{
+    if (text->font) {
+        CFRelease(text->font);
+        text->font = NULL;
+    }
+}
+
+typedef struct {
+    CGFloat height;
+    CGFloat baseline;
+} SnapshotMetrics;
+
+/**
+ *  Line height and baseline for a font size, matching the SVG renderer's font metrics.
+ */
+static SnapshotMetrics SnapshotFontMetrics(CGFloat fontSize)
+{
+    SnapshotMetrics metrics;
+    metrics.height = fontSize < 24 ? fontSize + 3 : round(fontSize * 1.2);
+    metrics.baseline = round(metrics.height * 0.8);
+    return metrics;
+}
+
+static CTLineRef SnapshotCreateLine(NSString *string, SnapshotTextStyle *text)
+{
+    NSDictionary *attributes = @{ (__bridge id)kCTFontAttributeName: (__bridge id)text->font,
+                                  (__bridge id)kCTForegroundColorFromContextAttributeName: @YES };
+    NSAttributedString *attributed = [[NSAttributedString alloc] initWithString:string ?: @"" attributes:attributes];
+    return CTLineCreateWithAttributedString((__bridge CFAttributedStringRef)attributed);
+}
+
+static CGFloat SnapshotTextWidth(NSString *string, SnapshotTextStyle *text)
+{
+    CTLineRef line = SnapshotCreateLine(string, text);
+    CGFloat width = CTLineGetTypographicBounds(line, NULL, NULL, NULL);
+    CFRelease(line);
+    return width;
+}
+
+/**
+ *  Draws a single line of text with its baseline at point.y. Align is "left", "center" or "right".
+ */
+static void SnapshotDrawText(CGContextRef context, NSString *string, SnapshotTextStyle *text, CGPoint point, NSString *align, CGFloat rotation)
+{
+    if (string.length == 0) {
+        return;
+    }
+    CTLineRef line = SnapshotCreateLine(string, text);
+    CGFloat width = CTLineGetTypographicBounds(line, NULL, NULL, NULL);
+    CGFloat x = [align isEqualToString:@"right"] ? -width : [align isEqualToString:@"center"] ? -width / 2 : 0;
+
+    CGContextSaveGState(context);
+    CGContextTranslateCTM(context, point.x, point.y);
+    CGContextRotateCTM(context, rotation * M_PI / 180.0);
+    // Core Text draws in a y-up space
+    CGContextScaleCTM(context, 1, -1);
+    CGContextSetTextMatrix(context, CGAffineTransformIdentity);
+    if (text->outlineWidth > 0) {
+        CGContextSetRGBStrokeColor(context, text->outline[0], text->outline[1], text->outline[2], text->outline[3]);
+        CGContextSetRGBFillColor(context, text->outline[0], text->outline[1], text->outline[2], text->outline[3]);
+        CGContextSetLineWidth(context, text->outlineWidth * 2);
+        CGContextSetLineJoin(context, kCGLineJoinRound);
+        CGContextSetTextDrawingMode(context, kCGTextFillStroke);
+        CGContextSetTextPosition(context, x, 0);
+        CTLineDraw(line, context);
+    }
+    CGContextSetRGBFillColor(context, text->color[0], text->color[1], text->color[2], text->color[3]);
+    CGContextSetTextDrawingMode(context, kCGTextFill);
+    CGContextSetTextPosition(context, x, 0);
+    CTLineDraw(line, context);
+    CGContextRestoreGState(context);
+    CFRelease(line);
+}
+
+#pragma mark - Number and date formats
+
+static NSString *SnapshotNumberFormat(double value, NSString *thousandsSep)
+{
+    NSString *string = [NSString stringWithFormat:@"%.14g", SnapshotCorrectFloat(value)];
+    if ([string rangeOfString:@"e"].location != NSNotFound) {
+        return string;
+    }
+    NSString *sign = [string hasPrefix:@"-"] ? @"-" : @"";
+    NSArray *parts = [[string substringFromIndex:sign.length] componentsSeparatedByString:@"."];
+    NSMutableString *integer = [parts[0] mutableCopy];
+    for (NSInteger i = (NSInteger)integer.length - 3; i > 0 && thousandsSep.length; i -= 3) {
+        [integer insertString:thousandsSep atIndex:i];
+    }
+    return parts.count > 1 ? [NSString stringWithFormat:@"%@%@.%@", sign, integer, parts[1]] : [sign stringByAppendingString:integer];
+}
+
+static NSString *SnapshotDateFormat(NSString *format, double timestamp)
+{
+    static NSArray *months, *weekdays;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        months = @[ @"Jan", @"Feb", @"Mar", @"Apr", @"May", @"Jun", @"Jul", @"Aug", @"Sep", @"Oct", @"Nov", @"Dec" ];
+        weekdays = @[ @"Sun", @"Mon", @"Tue", @"Wed", @"Thu", @"Fri", @"Sat" ];
+    });
+    time_t seconds = (time_t)floor(timestamp / 1000);
+    struct tm date;
+    gmtime_r(&seconds, &date);
+
+    NSMutableString *result = [NSMutableString string];
+    for (NSUInteger i = 0; i < format.length; i++) {
+        unichar c = [format characterAtIndex:i];
+        if (c != '%' || i + 1 == format.length) {
+            [result appendFormat:@"%C", c];
+            continue;
+        }
+        unichar key = [format characterAtIndex:++i];
+        switch (key) {
+            case 'a': [result appendString:weekdays[date.tm_wday]]; break;
+            case 'e': [result appendFormat:@"%d", date.tm_mday]; break;
+            case 'd': [result appendFormat:@"%02d", date.tm_mday]; break;
+            case 'b': [result appendString:months[date.tm_mon]]; break;
+            case 'm': [result appendFormat:@"%02d", date.tm_mon + 1]; break;
+            case 'y': [result appendFormat:@"%02d", date.tm_year % 100]; break;
+            case 'Y': [result appendFormat:@"%d", date.tm_year + 1900]; break;
+            case 'H': [result appendFormat:@"%02d", date.tm_hour]; break;
+            case 'M': [result appendFormat:@"%02d", date.tm_min]; break;
+            case 'S': [result appendFormat:@"%02d", date.tm_sec]; break;
+            case 'L': [result appendFormat:@"%03d", (int)fmod(fmod(timestamp, 1000) + 1000, 1000)]; break;
+            default: [result appendFormat:@"%%%C", key]; break;
+        }
+    }
+    return result;
+}
+
+#pragma mark - Tick positions
+
+static double SnapshotNormalizeTickInterval(double interval, NSArray *multiples, double magnitude)
+{
+    double normalized = interval / magnitude;
+    for (NSUInteger i = 0; i < multiples.count; i++) {
+        double multiple = [multiples[i] doubleValue];
+        double next = i + 1 < multiples.count ? [multiples[i + 1] doubleValue] : multiple;
+        if (normalized <= (multiple + next) / 2) {
+            return SnapshotCorrectFloat(multiple * magnitude);
+        }
+    }
+    return SnapshotCorrectFloat([multiples.lastObject doubleValue] * magnitude);
+}
+
+static NSArray *SnapshotTimeUnits(void)
+{
+    static NSArray *units;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        units = @[
+                  @[ @1, @[ @1, @2, @5, @10, @20, @25, @50, @100, @200, @500 ], @"%H:%M:%S.%L" ],
+                  @[ @1000, @[ @1, @2, @5, @10, @15, @30 ], @"%H:%M:%S" ],
+                  @[ @60000, @[ @1, @2, @5, @10, @15, @30 ], @"%H:%M" ],
+                  @[ @3600000, @[ @1, @2, @3, @4, @6, @8, @12 ], @"%H:%M" ],
+                  @[ @86400000, @[ @1, @2 ], @"%e. %b" ],
+                  @[ @604800000, @[ @1, @2 ], @"%e. %b" ],
+                  @[ @2592000000, @[ @1, @2, @3, @4, @6 ], @"%b '%y" ],
+                  @[ @31556952000, @[ @1, @2, @5, @10, @20, @50, @100 ], @"%Y" ]
+                  ];
+    });
+    return units;
+}
+
+static void SnapshotSetTimeTicks(SnapshotAxis *axis, double interval)
+{
+    NSArray *units = SnapshotTimeUnits();
+    NSArray *unit = units.lastObject;
+    double count = 1;
+    for (NSArray *candidate in units) {
+        double range = [candidate[0] doubleValue];
+        NSArray *multiples = candidate[1];
+        double largest = range * [multiples.lastObject doubleValue];
+        NSUInteger next = [units indexOfObject:candidate] + 1;
+        double nextRange = next < units.count ? [units[next][0] doubleValue] : INFINITY;
+        if (candidate == units.lastObject || interval <= (largest + nextRange) / 2) {
+            unit = candidate;
+            double magnitude = candidate == units.lastObject ? pow(10, floor(log10(MAX(1, interval / range)))) : 1;
+            count = MAX(1, SnapshotNormalizeTickInterval(interval / range / magnitude, multiples, 1) * magnitude);
+            break;
+        }
+    }
+    double range = [unit[0] doubleValue];
+    axis.dateUnit = range;
+    axis.tickInterval = range * count;
+
+    NSMutableArray *ticks = [NSMutableArray array];
+    if (range < 604800000) {
+        double start = floor(axis.min / axis.tickInterval) * axis.tickInterval;
+        for (double t = start; t <= axis.max + axis.tickInterval / 2 && ticks.count < 500; t += axis.tickInterval) {
+            [ticks addObject:@(t)];
+        }
+    }
+    else if (range == 604800000) {
+        // Weeks start on Monday, four days before the epoch's Thursday
+        double monday = -3 * 86400000.0;
+        double start = monday + floor((axis.min - monday) / axis.tickInterval) * axis.tickInterval;
+        for (double t = start; t <= axis.max + axis.tickInterval / 2 && ticks.count < 500; t += axis.tickInterval) {
+            [ticks addObject:@(t)];
+        }
+    }
+    else {
+        BOOL years = range > 2592000000;
+        time_t seconds = (time_t)floor(axis.min / 1000);
+        struct tm date;
+        gmtime_r(&seconds, &date);
+        int step = (int)count;
+        int month = years ? 0 : date.tm_mon - date.tm_mon % step;
+        int year = date.tm_year + 1900;
+        if (years) {
+            year -= year % step;
+        }
+        while (ticks.count < 500) {
+            struct tm tick = { 0 };
+            tick.tm_year = year - 1900;
+            tick.tm_mon = month;
+            tick.tm_mday = 1;
+            double t = (double)timegm(&tick) * 1000;
+            [ticks addObject:@(t)];
+            if (t > axis.max) {
+                break;
+            }
+            if (years) {
+                year += step;
+            }
+            else {
+                month += step;
+                year += month / 12;
+                month %= 12;
+            }
+        }
+    }
+    axis.ticks = ticks;
+}
+
+static void SnapshotSetTickPositions(SnapshotAxis *axis)
+{
+    NSDictionary *options = axis.options;
+    id userMin = SnapshotValue(options, @"min"), userMax = SnapshotValue(options, @"max");
+    double minPadding = SnapshotNumber(SnapshotValue(options, @"minPadding"), axis.isX ? 0.01 : 0.05);
+    double maxPadding = SnapshotNumber(SnapshotValue(options, @"maxPadding"), axis.isX ? 0.01 : 0.05);
+    double threshold = axis.threshold;
+    double min = axis.dataMin, max = axis.dataMax;
+    BOOL categories = axis.categories && axis.isX;
+
+    // A hard threshold, as with columns and areas, pins that end of the axis without padding
+    if (!axis.softThreshold && !isnan(threshold)) {
+        if (axis.dataMin >= threshold) {
+            min = threshold;
+            minPadding = 0;
+        }
+        else if (axis.dataMax <= threshold) {
+            max = threshold;
+            maxPadding = 0;
+        }
+    }
+    min = SnapshotNumber(userMin, min);
+    max = SnapshotNumber(userMax, max);
+
+    double length = max - min;
+    if (!categories && length > 0) {
+        if (!userMin) {
+            min -= length * minPadding;
+        }
+        if (!userMax) {
+            max += length * maxPadding;
+        }
+    }
+    // A soft threshold only stops the padding from crossing it
+    if (axis.softThreshold && !isnan(threshold)) {
+        if (!userMin && min < threshold && axis.dataMin >= threshold) {
+            min = threshold;
+        }
+        else if (!userMax && max > threshold && axis.dataMax <= threshold) {
+            max = threshold;
+        }
+    }
+    axis.min = min;
+    axis.max = max;
+
+    double tickPixelInterval = SnapshotNumber(SnapshotValue(options, @"tickPixelInterval"), axis.isX ? 100 : 72);
+    double userInterval = SnapshotNumber(SnapshotValue(options, @"tickInterval"), NAN);
+    double interval = userInterval;
+    if (min == max) {
+        interval = 1;
+    }
+    else if (isnan(interval)) {
+        interval = categories ? 1 : (max - min) * tickPixelInterval / MAX(axis.len, tickPixelInterval);
+        if (axis.pointRange > 0) {
+            interval = MAX(axis.pointRange, interval);
+        }
+    }
+
+    if (axis.datetime) {
+        SnapshotSetTimeTicks(axis, interval);
+    }
+    else {
+        if (isnan(userInterval)) {
+            double magnitude = pow(10, floor(log10(interval)));
+            NSArray *multiples = @[ @1, @2, @2.5, @5, @10 ];
+            // Years and similar four digit values are not given decimal ticks
+            BOOL allowDecimals = SnapshotBool(SnapshotValue(options, @"allowDecimals"), !(interval > 0.5 && interval < 5 && max > 1000 && max < 9999));
+            if (!allowDecimals && magnitude == 1) {
+                multiples = @[ @1, @2, @5, @10 ];
+            }
+            interval = SnapshotNormalizeTickInterval(interval, multiples, magnitude);
+        }
+        axis.tickInterval = interval;
+        NSMutableArray *ticks = [NSMutableArray array];
+        double start = floor(SnapshotCorrectFloat(min / interval)) * interval;
+        double end = ceil(SnapshotCorrectFloat(max / interval)) * interval;
+        for (double t = start; t <= end + interval / 2 && ticks.count < 1000; t += interval) {
+            [ticks addObject:@(SnapshotCorrectFloat(t))];
+        }
+        axis.ticks = ticks;
+    }
+
+    if (axis.ticks.count == 1 || axis.min == axis.max) {
+        // A single value gets a unit range around it
+        axis.min -= 0.5;
+        axis.max += 0.5;
+    }
+    else if (axis.ticks.count > 1) {
+        if (SnapshotBool(SnapshotValue(options, @"startOnTick"), !axis.isX) && !userMin) {
+            axis.min = [axis.ticks.firstObject doubleValue];
+        }
+        if (SnapshotBool(SnapshotValue(options, @"endOnTick"), !axis.isX) && !userMax) {
+            axis.max = [axis.ticks.lastObject doubleValue];
+        }
+    }
+    double epsilon = axis.tickInterval * 1e-9;
+    NSIndexSet *inside = [axis.ticks indexesOfObjectsPassingTest:^BOOL(NSNumber *tick, NSUInteger idx, BOOL *stop) {
+        return tick.doubleValue >= axis.min - epsilon && tick.doubleValue <= axis.max + epsilon;
+    }];
+    axis.ticks = [axis.ticks objectsAtIndexes:inside];
+}
+
+static NSString *SnapshotAxisLabel(SnapshotAxis *axis, double value)
+{
+    NSDictionary *labels = SnapshotValue(axis.options, @"labels");
+    NSString *format = SnapshotValue(labels, @"format");
+    NSString *text;
+
+    if (axis.categories && axis.isX) {
+        NSInteger index = (NSInteger)round(value);
+        id category = index >= 0 && index < (NSInteger)axis.categories.count ? axis.categories[index] : nil;
+        text = category ? [category description] : SnapshotNumberFormat(value, @" ");
+    }
+    else if (axis.datetime) {
+        NSArray *units = SnapshotTimeUnits();
+        NSString *dateFormat = units.lastObject[2];
+        for (NSArray *unit in units) {
+            if ([unit[0] doubleValue] == axis.dateUnit) {
+                dateFormat = unit[2];
+            }
+        }
+        // Ticks on midnight of a sub-day axis show the day instead of the time
+        if (axis.dateUnit < 86400000 && fmod(value, 86400000) == 0) {
+            dateFormat = @"%e. %b";
+        }
+        text = SnapshotDateFormat(dateFormat, value);
+    }
+    else {
+        NSArray *symbols = @[ @"k", @"M", @"G", @"T", @"P", @"E" ];
+        for (NSInteger i = symbols.count - 1; i >= 0 && !text; i--) {
+            double multiplier = pow(1000, i + 1);
+            if (axis.tickInterval >= multiplier && fmod(value * 10, multiplier) == 0 && value != 0) {
+                text = [SnapshotNumberFormat(value / multiplier, @" ") stringByAppendingString:symbols[i]];
+            }
+        }
+        if (!text) {
+            text = SnapshotNumberFormat(value, fabs(value) >= 10000 ? @" " : @"");
+        }
+    }
+    if (format.length) {
+        text = [format stringByReplacingOccurrencesOfString:@"{value}" withString:text];
+    }
+    return text;
+}
+
+#pragma mark - Renderer
+
+@interface ChartSnapshotRenderer ()
+@property (strong, nonatomic, readwrite) NSDictionary *params;
+@property (strong, nonatomic) NSArray *series;
+@property (strong, nonatomic) SnapshotAxis *xAxis;
+@property (strong, nonatomic) SnapshotAxis *yAxis;
+@property (assign, nonatomic) BOOL inverted;
+@property (assign, nonatomic) CGRect plotBox;
+@property (assign, nonatomic) double closestPointRange;
+@end
+
+@implementation ChartSnapshotRenderer
+
+#if !CHART_SNAPSHOT_HEADLESS
+- (instancetype)initWithOptions:(HIOptions*)options
+{
+    return [self initWithParams:[options getParams]];
+}
+#endif
+
+- (instancetype)initWithParams:(NSDictionary*)params
+{
+    self = [super init];
+    if (self) {
+        self.params = params ?: @{};
+    }
+    return self;
+}
+
+- (CGImageRef)newCGImageWithSize:(CGSize)size scale:(CGFloat)scale
+{
+    if (size.width <= 0 || size.height <= 0) {
+        return NULL;
+    }
+    scale = scale > 0 ? scale : 1;
+    size_t width = (size_t)ceil(size.width * scale), height = (size_t)ceil(size.height * scale);
+    CGColorSpaceRef space = CGColorSpaceCreateDeviceRGB();
+    CGContextRef context = CGBitmapContextCreate(NULL, width, height, 8, 0, space, kCGImageAlphaPremultipliedFirst | kCGBitmapByteOrder32Little);
+    CGColorSpaceRelease(space);
+    if (!context) {
+        return NULL;
+    }
+    // Bitmap contexts are y-up, the renderer draws top-down
+    CGContextTranslateCTM(context, 0, height);
+    CGContextScaleCTM(context, scale, -scale);
+    [self drawInContext:context size:size];
+
+    CGImageRef cgImage = CGBitmapContextCreateImage(context);
+    CGContextRelease(context);
+    return cgImage;
+}
+
+#if !CHART_SNAPSHOT_HEADLESS
+- (UIImage*)imageWithSize:(CGSize)size scale:(CGFloat)scale
+{
+    CGImageRef cgImage = [self newCGImageWithSize:size scale:scale];
+    if (!cgImage) {
+        return nil;
+    }
+    scale = scale > 0 ? scale : 1;
+    UIImage *image = [UIImage imageWithCGImage:cgImage scale:scale orientation:UIImageOrientationUp];
+    CGImageRelease(cgImage);
+    return image;
+}
+#endif
+
+#pragma mark Series
+
+- (NSArray*)defaultColors
+{
+    NSArray *colors = SnapshotValue(self.params, @"colors");
+    return colors.count ? colors : @[ @"#7cb5ec", @"#434348", @"#90ed7d", @"#f7a35c", @"#8085e9", @"#f15c80", @"#e4d354", @"#2b908f", @"#f45b5b", @"#91e8e1" ];
+}
+
+- (void)prepareSeries
+{
+    NSDictionary *chart = SnapshotDictionary(self.params[@"chart"]);
+    NSDictionary *plotOptions = SnapshotDictionary(self.params[@"plotOptions"]);
+    NSString *defaultType = SnapshotValue(chart, @"type") ?: @"line";
+    NSArray *colors = [self defaultColors];
+    NSMutableArray *list = [NSMutableArray array];
+    NSInteger colorCounter = 0;
+
+    for (NSDictionary *options in SnapshotValue(self.params, @"series")) {
+        if (![options isKindOfClass:[NSDictionary class]]) {
+            continue;
+        }
+        SnapshotSeries *series = [[SnapshotSeries alloc] init];
+        series.type = SnapshotValue(options, @"type") ?: defaultType;
+        series.options = SnapshotMerge(SnapshotMerge(SnapshotValue(plotOptions, @"series"), SnapshotValue(plotOptions, series.type)), options);
+        series.index = list.count;
+        if (!SnapshotBool(SnapshotValue(series.options, @"visible"), YES)) {
+            continue;
+        }
+        series.color = SnapshotValue(series.options, @"color") ?: colors[colorCounter++ % colors.count];
+
+        BOOL pie = [series.type isEqualToString:@"pie"];
+        double pointStart = SnapshotNumber(SnapshotValue(series.options, @"pointStart"), 0);
+        double pointInterval = SnapshotNumber(SnapshotValue(series.options, @"pointInterval"), 1);
+        series.points = [NSMutableArray array];
+        NSInteger i = 0;
+        for (id item in SnapshotValue(options, @"data")) {
+            SnapshotPoint *point = [[SnapshotPoint alloc] init];
+            point.x = pointStart + pointInterval * i++;
+            if ([item isKindOfClass:[NSNumber class]]) {
+                point.y = [item doubleValue];
+            }
+            else if ([item isKindOfClass:[NSArray class]] && [item count] > 0) {
+                NSArray *array = item;
+                id y = array.count > 1 ? array[1] : array[0];
+                if (array.count > 1) {
+                    if ([array[0] isKindOfClass:[NSString class]]) {
+                        point.name = array[0];
+                    }
+                    else {
+                        point.x = SnapshotNumber(array[0], point.x);
+                    }
+                }
+                point.isNull = ![y isKindOfClass:[NSNumber class]];
+                point.y = SnapshotNumber(y, 0);
+            }
+            else if ([item isKindOfClass:[NSDictionary class]]) {
+                point.x = SnapshotNumber(SnapshotValue(item, @"x"), point.x);
+                point.isNull = ![SnapshotValue(item, @"y") isKindOfClass:[NSNumber class]];
+                point.y = SnapshotNumber(SnapshotValue(item, @"y"), 0);
+                point.name = [SnapshotValue(item, @"name") description];
+                point.color = SnapshotValue(item, @"color");
+            }
+            else {
+                point.isNull = YES;
+            }
+            if (pie && !point.color) {
+                point.color = colors[(i - 1) % colors.count];
+            }
+            point.low = 0;
+            point.high = point.y;
+            [series.points addObject:point];
+        }
+        [list addObject:series];
+    }
+    self.series = list;
+    self.inverted = SnapshotBool(SnapshotValue(chart, @"inverted"), NO);
+    for (SnapshotSeries *series in list) {
+        if ([series.type isEqualToString:@"bar"]) {
+            self.inverted = YES;
+        }
+    }
+}
+
+- (BOOL)isColumn:(SnapshotSeries*)series
+{
+    return [series.type isEqualToString:@"column"] || [series.type isEqualToString:@"bar"];
+}
+
+- (BOOL)isArea:(SnapshotSeries*)series
+{
+    return [series.type isEqualToString:@"area"] || [series.type isEqualToString:@"areaspline"];
+}
+
+- (NSArray*)cartesianSeries
+{
+    return [self.series filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"type != 'pie'"]];
+}
+
+/**
+ *  Sets low and high for stacked series. Stacks are built from the last series so the first one
+ *  ends up on top, as with reversedStacks.
+ */
+- (void)buildStacks
+{
+    NSMutableDictionary *positive = [NSMutableDictionary dictionary];
+    NSMutableDictionary *negative = [NSMutableDictionary dictionary];
+    NSMutableDictionary *totals = [NSMutableDictionary dictionary];
+    NSArray *cartesian = [self cartesianSeries];
+
+    for (SnapshotSeries *series in cartesian) {
+        NSString *stacking = SnapshotValue(series.options, @"stacking");
+        if ([stacking isEqualToString:@"normal"] || [stacking isEqualToString:@"percent"]) {
+            NSString *group = [self isColumn:series] ? @"column" : series.type;
+            series.stackKey = [NSString stringWithFormat:@"%@,%@", group, [SnapshotValue(series.options, @"stack") ?: @"" description]];
+            for (SnapshotPoint *point in series.points) {
+                NSString *key = [NSString stringWithFormat:@"%@,%.17g", series.stackKey, point.x];
+                totals[key] = @([totals[key] doubleValue] + (point.isNull ? 0 : fabs(point.y)));
+            }
+        }
+    }
+
+    for (SnapshotSeries *series in cartesian.reverseObjectEnumerator) {
+        if (!series.stackKey) {
+            continue;
+        }
+        BOOL percent = [SnapshotValue(series.options, @"stacking") isEqualToString:@"percent"];
+        for (SnapshotPoint *point in series.points) {
+            if (point.isNull) {
+                continue;
+            }
+            NSString *key = [NSString stringWithFormat:@"%@,%.17g", series.stackKey, point.x];
+            double total = [totals[key] doubleValue];
+            double y = percent ? (total ? point.y / total * 100 : 0) : point.y;
+            NSMutableDictionary *sums = y < 0 ? negative : positive;
+            point.low = [sums[key] doubleValue];
+            point.high = point.low + y;
+            sums[key] = @(point.high);
+        }
+    }
+}
+
+- (void)setColumnIndexes
+{
+    NSMutableArray *stacks = [NSMutableArray array];
+    NSInteger count = 0;
+    for (SnapshotSeries *series in [self cartesianSeries]) {
+        if (![self isColumn:series]) {
+            continue;
+        }
+        if (series.stackKey) {
+            NSUInteger index = [stacks indexOfObject:series.stackKey];
+            if (index == NSNotFound) {
+                [stacks addObject:series.stackKey];
+                series.columnIndex = count++;
+            }
+            else {
+                // Find the column index of the first series in the same stack
+                for (SnapshotSeries *other in self.series) {
+                    if ([other.stackKey isEqualToString:series.stackKey]) {
+                        series.columnIndex = other.columnIndex;
+                        break;
+                    }
+                }
+            }
+        }
+        else {
+            series.columnIndex = count++;
+        }
+    }
+}
+
+- (NSInteger)columnCount
+{
+    NSInteger count = 0;
+    for (SnapshotSeries *series in [self cartesianSeries]) {
+        if ([self isColumn:series]) {
+            count = MAX(count, series.columnIndex + 1);
+        }
+    }
+    return count;
+}
+
+#pragma mark Axes
+
+- (void)prepareAxes
+{
+    NSArray *cartesian = [self cartesianSeries];
+    if (cartesian.count == 0) {
+        self.xAxis = nil;
+        self.yAxis = nil;
+        return;
+    }
+
+    SnapshotAxis *xAxis = [[SnapshotAxis alloc] init];
+    xAxis.isX = YES;
+    xAxis.options = SnapshotDictionary(self.params[@"xAxis"]);
+    NSArray *categories = SnapshotValue(xAxis.options, @"categories");
+    xAxis.categories = [categories isKindOfClass:[NSArray class]] && categories.count ? categories : nil;
+    xAxis.datetime = [SnapshotValue(xAxis.options, @"type") isEqualToString:@"datetime"];
+    xAxis.horizontal = !self.inverted;
+    // Inverted charts list categories from the top
+    xAxis.reversed = SnapshotBool(SnapshotValue(xAxis.options, @"reversed"), self.inverted);
+
+    SnapshotAxis *yAxis = [[SnapshotAxis alloc] init];
+    yAxis.options = SnapshotDictionary(self.params[@"yAxis"]);
+    yAxis.horizontal = self.inverted;
+    yAxis.reversed = SnapshotBool(SnapshotValue(yAxis.options, @"reversed"), NO);
+
+    double xMin = INFINITY, xMax = -INFINITY, yMin = INFINITY, yMax = -INFINITY;
+    double closest = INFINITY;
+    yAxis.threshold = 0;
+    yAxis.softThreshold = YES;
+    xAxis.threshold = NAN;
+    for (SnapshotSeries *series in cartesian) {
+        BOOL column = [self isColumn:series];
+        if (column || [self isArea:series]) {
+            yAxis.softThreshold = NO;
+        }
+        yAxis.threshold = SnapshotNumber(SnapshotValue(series.options, @"threshold"), yAxis.threshold);
+        double lastX = NAN;
+        for (SnapshotPoint *point in series.points) {
+            xMin = MIN(xMin, point.x);
+            xMax = MAX(xMax, point.x);
+            if (point.x - lastX > 0) {
+                closest = MIN(closest, point.x - lastX);
+            }
+            lastX = point.x;
+            if (!point.isNull) {
+                yMin = MIN(yMin, series.stackKey ? MIN(point.low, point.high) : point.high);
+                yMax = MAX(yMax, series.stackKey ? MAX(point.low, point.high) : point.high);
+            }
+        }
+    }
+    // Category axes give every series a point range of one category
+    self.closestPointRange = xAxis.categories ? 1 : (isinf(closest) ? 1 : closest);
+    xAxis.dataMin = isinf(xMin) ? 0 : xMin;
+    xAxis.dataMax = isinf(xMax) ? 0 : xMax;
+    xAxis.pointRange = xAxis.categories || [self columnCount] > 0 ? self.closestPointRange : 0;
+    xAxis.minPointOffset = xAxis.pointRange / 2;
+
+    yAxis.dataMin = isinf(yMin) ? 0 : yMin;
+    yAxis.dataMax = isinf(yMax) ? 0 : yMax;
+
+    self.xAxis = xAxis;
+    self.yAxis = yAxis;
+}
+
+- (void)setAxisTicks
+{
+    SnapshotSetTickPositions(self.xAxis);
+    SnapshotSetTickPositions(self.yAxis);
+}
+
+- (NSArray*)labelsForAxis:(SnapshotAxis*)axis
+{
+    NSMutableArray *labels = [NSMutableArray array];
+    for (NSNumber *tick in axis.ticks) {
+        [labels addObject:SnapshotAxisLabel(axis, tick.doubleValue)];
+    }
+    return labels;
+}
+
+- (NSDictionary*)labelStyleDefaults
+{
+    return @{ @"color": @"#666666", @"fontSize": @"11px", @"fontFamily": @"\"Lucida Grande\", \"Lucida Sans Unicode\", Arial, Helvetica, sans-serif" };
+}
+
+/**
+ *  Space an axis takes outside the plot area: labels, their distance and the axis title.
+ */
+- (CGFloat)offsetForAxis:(SnapshotAxis*)axis
+{
+    NSDictionary *labels = SnapshotValue(axis.options, @"labels");
+    NSDictionary *title = SnapshotValue(axis.options, @"title");
+    NSString *titleText = title ? [SnapshotValue(title, @"text") description] : (axis.isX ? nil : @"Values");
+    CGFloat offset = 0;
+    CGFloat labelSize = 0;
+    BOOL left = !axis.horizontal;
+
+    if (SnapshotBool(SnapshotValue(labels, @"enabled"), YES)) {
+        SnapshotTextStyle text = SnapshotTextStyleMake([self labelStyleDefaults], SnapshotValue(labels, @"style"));
+        SnapshotMetrics metrics = SnapshotFontMetrics(text.fontSize);
+        if (left) {
+            for (NSString *label in [self labelsForAxis:axis]) {
+                labelSize = MAX(labelSize, SnapshotTextWidth(label, &text));
+            }
+            offset = labelSize + 10 - SnapshotNumber(SnapshotValue(labels, @"x"), -15);
+        }
+        else {
+            labelSize = metrics.height;
+            offset = labelSize + 5 - metrics.baseline + SnapshotNumber(SnapshotValue(labels, @"y"), metrics.baseline + 8);
+        }
+        SnapshotTextStyleRelease(&text);
+    }
+    if (titleText.length) {
+        SnapshotTextStyle text = SnapshotTextStyleMake(@{ @"color": @"#666666", @"fontSize": @"12px" }, SnapshotValue(title, @"style"));
+        offset = MAX(offset, labelSize + (left ? 10 : 5) + SnapshotFontMetrics(text.fontSize).height);
+        SnapshotTextStyleRelease(&text);
+    }
+    return offset;
+}
+
+#pragma mark Layout
+
+- (CGFloat)drawTitles:(CGContextRef)context size:(CGSize)size draw:(BOOL)draw
+{
+    CGFloat titleOffset = 0;
+    CGRect box = CGRectMake(SnapshotSpacing[3], SnapshotSpacing[0], size.width - SnapshotSpacing[1] - SnapshotSpacing[3], size.height);
+    NSArray *keys = @[ @"title", @"subtitle" ];
+
+    for (NSString *key in keys) {
+        NSDictionary *options = SnapshotDictionary(self.params[key]);
+        BOOL isTitle = [key isEqualToString:@"title"];
+        NSString *string = options[@"text"] ? [SnapshotValue(options, @"text") description] : (isTitle ? @"Chart title" : nil);
+        if (string.length == 0) {
+            continue;
+        }
+        NSDictionary *defaults = isTitle ? @{ @"color": @"#333333", @"fontSize": @"18px" } : @{ @"color": @"#666666", @"fontSize": @"12px" };
+        SnapshotTextStyle text = SnapshotTextStyleMake(defaults, SnapshotValue(options, @"style"));
+        SnapshotMetrics metrics = SnapshotFontMetrics(text.fontSize);
+
+        if (draw) {
+            NSString *align = SnapshotValue(options, @"align") ?: @"center";
+            CGFloat x = SnapshotNumber(SnapshotValue(options, @"x"), 0);
+            x += [align isEqualToString:@"left"] ? CGRectGetMinX(box) : [align isEqualToString:@"right"] ? CGRectGetMaxX(box) : CGRectGetMidX(box);
+            CGFloat y = box.origin.y + SnapshotNumber(SnapshotValue(options, @"y"), titleOffset + metrics.baseline + (isTitle ? -3 : 2));
+            SnapshotDrawText(context, string, &text, CGPointMake(x, y), align, 0);
+        }
+        if (!SnapshotBool(SnapshotValue(options, @"floating"), NO) && !SnapshotValue(options, @"verticalAlign")) {
+            titleOffset = ceil(titleOffset + metrics.height);
+        }
+        SnapshotTextStyleRelease(&text);
+    }
+    if (titleOffset > 0) {
+        titleOffset += SnapshotNumber(SnapshotValue(SnapshotDictionary(self.params[@"title"]), @"margin"), 15);
+    }
+    return titleOffset;
+}
+
+- (NSArray*)legendItems
+{
+    NSDictionary *legend = SnapshotDictionary(self.params[@"legend"]);
+    NSMutableArray *items = [NSMutableArray array];
+    if (!SnapshotBool(SnapshotValue(legend, @"enabled"), YES)) {
+        return items;
+    }
+    for (SnapshotSeries *series in self.series) {
+        BOOL pie = [series.type isEqualToString:@"pie"];
+        if (!SnapshotBool(SnapshotValue(series.options, @"showInLegend"), !pie)) {
+            continue;
+        }
+        if (pie) {
+            for (SnapshotPoint *point in series.points) {
+                [items addObject:@{ @"name": point.name ?: @"Slice", @"color": point.color ?: series.color, @"line": @NO }];
+            }
+        }
+        else {
+            NSString *name = [SnapshotValue(series.options, @"name") description] ?: [NSString stringWithFormat:@"Series %ld", (long)series.index + 1];
+            BOOL line = ![self isColumn:series] && ![series.type isEqualToString:@"scatter"];
+            [items addObject:@{ @"name": name, @"color": SnapshotSolidColor(series.color) ?: @"#cccccc", @"line": @(line) }];
+        }
+    }
+    return items;
+}
+
+/**
+ *  Lays out the legend at the bottom of the chart, row by row, and returns its height including the margin.
+ */
+- (CGFloat)drawLegend:(CGContextRef)context size:(CGSize)size draw:(BOOL)draw
+{
+    NSArray *items = [self legendItems];
+    if (items.count == 0) {
+        return 0;
+    }
+    NSDictionary *legend = SnapshotDictionary(self.params[@"legend"]);
+    SnapshotTextStyle text = SnapshotTextStyleMake(@{ @"color": @"#333333", @"fontSize": @"12px", @"fontWeight": @"bold" }, SnapshotValue(legend, @"itemStyle"));
+    SnapshotMetrics metrics = SnapshotFontMetrics(text.fontSize);
+    CGFloat padding = 8, itemDistance = 20, symbolPadding = 5, symbolHeight = text.fontSize, lineSymbolWidth = 16;
+    CGFloat maxWidth = size.width - SnapshotSpacing[1] - SnapshotSpacing[3] - 2 * padding;
+
+    NSMutableArray *rows = [NSMutableArray arrayWithObject:[NSMutableArray array]];
+    NSMutableArray *rowWidths = [NSMutableArray arrayWithObject:@0];
+    for (NSDictionary *item in items) {
+        CGFloat symbolWidth = [item[@"line"] boolValue] ? lineSymbolWidth : symbolHeight;
+        CGFloat width = symbolWidth + symbolPadding + SnapshotTextWidth(item[@"name"], &text);
+        CGFloat rowWidth = [rowWidths.lastObject doubleValue];
+        if ([rows.lastObject count] > 0 && rowWidth + itemDistance + width > maxWidth) {
+            [rows addObject:[NSMutableArray array]];
+            [rowWidths addObject:@0];
+            rowWidth = 0;
+        }
+        rowWidth += ([rows.lastObject count] ? itemDistance : 0) + width;
+        [rows.lastObject addObject:@[ item, @(width), @(symbolWidth) ]];
+        rowWidths[rowWidths.count - 1] = @(rowWidth);
+    }
+
+    CGFloat height = 2 * padding + rows.count * metrics.height;
+    if (draw) {
+        CGFloat top = size.height - SnapshotSpacing[2] - height + SnapshotNumber(SnapshotValue(legend, @"y"), 0);
+        for (NSUInteger r = 0; r < rows.count; r++) {
+            CGFloat x = (size.width - [rowWidths[r] doubleValue]) / 2;
+            CGFloat baseline = top + padding + r * metrics.height + metrics.baseline;
+            CGFloat middle = baseline - metrics.baseline + metrics.height / 2;
+            for (NSArray *entry in rows[r]) {
+                NSDictionary *item = entry[0];
+                CGFloat symbolWidth = [entry[2] doubleValue];
+                if ([item[@"line"] boolValue]) {
+                    if (SnapshotSetStrokeColor(context, item[@"color"], 1)) {
+                        CGContextSetLineWidth(context, 2);
+                        CGContextMoveToPoint(context, x, middle);
+                        CGContextAddLineToPoint(context, x + symbolWidth, middle);
+                        CGContextStrokePath(context);
+                    }
+                    SnapshotSetFillColor(context, item[@"color"], 1);
+                    CGContextFillEllipseInRect(context, CGRectMake(x + symbolWidth / 2 - 4, middle - 4, 8, 8));
+                }
+                else {
+                    SnapshotSetFillColor(context, item[@"color"], 1);
+                    CGContextFillEllipseInRect(context, CGRectMake(x, middle - symbolHeight / 2, symbolHeight, symbolHeight));
+                }
+                SnapshotDrawText(context, item[@"name"], &text, CGPointMake(x + symbolWidth + symbolPadding, baseline), @"left", 0);
+                x += [entry[1] doubleValue] + itemDistance;
+            }
+        }
+    }
+    SnapshotTextStyleRelease(&text);
+    return height + SnapshotNumber(SnapshotValue(legend, @"margin"), 12);
+}
+
+- (void)layoutWithSize:(CGSize)size titleOffset:(CGFloat)titleOffset legendHeight:(CGFloat)legendHeight
+{
+    NSDictionary *chart = SnapshotDictionary(self.params[@"chart"]);
+    CGFloat top = SnapshotNumber(SnapshotValue(chart, @"marginTop"), SnapshotSpacing[0] + titleOffset);
+    CGFloat right = SnapshotNumber(SnapshotValue(chart, @"marginRight"), SnapshotSpacing[1]);
+    CGFloat bottom = SnapshotNumber(SnapshotValue(chart, @"marginBottom"), SnapshotSpacing[2] + legendHeight);
+    CGFloat left = SnapshotNumber(SnapshotValue(chart, @"marginLeft"), SnapshotSpacing[3]);
+    CGRect box = CGRectMake(left, top, MAX(1, size.width - left - right), MAX(1, size.height - top - bottom));
+
+    if (self.xAxis) {
+        SnapshotAxis *horizontal = self.inverted ? self.yAxis : self.xAxis;
+        SnapshotAxis *vertical = self.inverted ? self.xAxis : self.yAxis;
+        // Two passes, since label widths depend on the ticks and the ticks on the plot size
+        for (NSInteger pass = 0; pass < 2; pass++) {
+            horizontal.pos = box.origin.x;
+            horizontal.len = box.size.width;
+            vertical.pos = box.origin.y;
+            vertical.len = box.size.height;
+            [self setAxisTicks];
+
+            CGFloat plotLeft = SnapshotValue(chart, @"marginLeft") ? left : left + [self offsetForAxis:vertical];
+            CGFloat plotBottom = SnapshotValue(chart, @"marginBottom") ? bottom : bottom + [self offsetForAxis:horizontal];
+            box = CGRectMake(plotLeft, top, MAX(1, size.width - plotLeft - right), MAX(1, size.height - top - plotBottom));
+        }
+        horizontal.pos = box.origin.x;
+        horizontal.len = box.size.width;
+        vertical.pos = box.origin.y;
+        vertical.len = box.size.height;
+        [self setAxisTicks];
+    }
+    self.plotBox = box;
+}
+
+- (CGPoint)pointForX:(double)x y:(double)y
+{
+    CGFloat px = [self.xAxis toPixels:x], py = [self.yAxis toPixels:y];
+    return self.inverted ? CGPointMake(py, px) : CGPointMake(px, py);
+}
+
+- (void)translate
+{
+    for (SnapshotSeries *series in [self cartesianSeries]) {
+        for (SnapshotPoint *point in series.points) {
+            CGPoint pixel = [self pointForX:point.x y:point.high];
+            point.plotX = pixel.x;
+            point.plotY = pixel.y;
+        }
+    }
+}
+
+#pragma mark Drawing
+
+- (void)drawInContext:(CGContextRef)context size:(CGSize)size
+{
+    if (!context || size.width <= 0 || size.height <= 0) {
+        return;
+    }
+    [self prepareSeries];
+    [self buildStacks];
+    [self setColumnIndexes];
+    [self prepareAxes];
+
+    CGContextSaveGState(context);
+    [self drawBackground:context size:size];
+    CGFloat titleOffset = [self drawTitles:context size:size draw:NO];
+    CGFloat legendHeight = [self drawLegend:context size:size draw:NO];
+    [self layoutWithSize:size titleOffset:titleOffset legendHeight:legendHeight];
+    [self translate];
+
+    [self drawPlotBackground:context];
+    if (self.xAxis) {
+        [self drawGridForAxis:self.xAxis context:context];
+        [self drawGridForAxis:self.yAxis context:context];
+    }
+    for (SnapshotSeries *series in self.series) {
+        if ([series.type isEqualToString:@"pie"]) {
+            [self drawPieSeries:series context:context];
+            continue;
+        }
+        // Graphs are clipped to the plot area, markers are not
+        CGContextSaveGState(context);
+        CGContextClipToRect(context, self.plotBox);
+        if ([self isColumn:series]) {
+            [self drawColumnSeries:series context:context];
+        }
+        else {
+            [self drawLineSeries:series context:context];
+        }
+        CGContextRestoreGState(context);
+        if (![self isColumn:series]) {
+            [self drawMarkersForSeries:series context:context];
+        }
+    }
+    if (self.xAxis) {
+        [self drawAxis:self.xAxis context:context];
+        [self drawAxis:self.yAxis context:context];
+    }
+    for (SnapshotSeries *series in [self cartesianSeries]) {
+        [self drawDataLabelsForSeries:series context:context];
+    }
+    [self drawTitles:context size:size draw:YES];
+    [self drawLegend:context size:size draw:YES];
+    [self drawCredits:context size:size];
+    CGContextRestoreGState(context);
+}
+
+- (void)drawBackground:(CGContextRef)context size:(CGSize)size
+{
+    NSDictionary *chart = SnapshotDictionary(self.params[@"chart"]);
+    id background = SnapshotValue(chart, @"backgroundColor") ?: @"#ffffff";
+    CGFloat borderWidth = SnapshotNumber(SnapshotValue(chart, @"borderWidth"), 0);
+    CGFloat radius = SnapshotNumber(SnapshotValue(chart, @"borderRadius"), 0);
+    CGRect rect = CGRectInset(CGRectMake(0, 0, size.width, size.height), borderWidth / 2, borderWidth / 2);
+    radius = MIN(radius, MIN(rect.size.width, rect.size.height) / 2);
+
+    CGPathRef path = CGPathCreateWithRoundedRect(rect, radius, radius, NULL);
+    SnapshotFillPath(context, path, background, rect, CGPointZero, 1);
+    if (borderWidth > 0 && SnapshotSetStrokeColor(context, SnapshotValue(chart, @"borderColor") ?: @"#335cad", 1)) {
+        CGContextSetLineWidth(context, borderWidth);
+        CGContextAddPath(context, path);
+        CGContextStrokePath(context);
+    }
+    CGPathRelease(path);
+}
+
+- (void)drawPlotBackground:(CGContextRef)context
+{
+    NSDictionary *chart = SnapshotDictionary(self.params[@"chart"]);
+    id background = SnapshotValue(chart, @"plotBackgroundColor");
+    CGPathRef path = CGPathCreateWithRect(self.plotBox, NULL);
+    if (background) {
+        SnapshotFillPath(context, path, background, self.plotBox, self.plotBox.origin, 1);
+    }
+    CGFloat borderWidth = SnapshotNumber(SnapshotValue(chart, @"plotBorderWidth"), 0);
+    if (borderWidth > 0 && SnapshotSetStrokeColor(context, SnapshotValue(chart, @"plotBorderColor") ?: @"#cccccc", 1)) {
+        CGContextSetLineWidth(context, borderWidth);
+        CGContextAddPath(context, path);
+        CGContextStrokePath(context);
+    }
+    CGPathRelease(path);
+}
+
+/**
+ *  Pixel positions of tick marks and grid lines. Category axes place them between the categories.
+ */
+- (NSArray*)tickMarkPositionsForAxis:(SnapshotAxis*)axis
+{
+    NSMutableArray *positions = [NSMutableArray array];
+    BOOL between = axis.categories && axis.isX && ![SnapshotValue(axis.options, @"tickmarkPlacement") isEqualToString:@"on"];
+    for (NSNumber *tick in axis.ticks) {
+        [positions addObject:@([axis toPixels:tick.doubleValue - (between ? 0.5 : 0)])];
+    }
+    if (between && axis.ticks.count) {
+        [positions addObject:@([axis toPixels:[axis.ticks.lastObject doubleValue] + 0.5])];
+    }
+    return positions;
+}
+
+- (void)drawGridForAxis:(SnapshotAxis*)axis context:(CGContextRef)context
+{
+    CGFloat width = SnapshotNumber(SnapshotValue(axis.options, @"gridLineWidth"), axis.isX ? 0 : 1);
+    if (width <= 0 || !SnapshotSetStrokeColor(context, SnapshotSolidColor(SnapshotValue(axis.options, @"gridLineColor")) ?: @"#e6e6e6", 1)) {
+        return;
+    }
+    CGContextSetLineWidth(context, width);
+    CGRect box = self.plotBox;
+    for (NSNumber *position in [self tickMarkPositionsForAxis:axis]) {
+        // Crisp lines sit on half pixels for odd widths
+        CGFloat p = round(position.doubleValue) + fmod(width, 2) / 2;
+        if (axis.horizontal) {
+            CGContextMoveToPoint(context, p, CGRectGetMinY(box));
+            CGContextAddLineToPoint(context, p, CGRectGetMaxY(box));
+        }
+        else {
+            CGContextMoveToPoint(context, CGRectGetMinX(box), p);
+            CGContextAddLineToPoint(context, CGRectGetMaxX(box), p);
+        }
+    }
+    CGContextStrokePath(context);
+}
+
+- (void)drawAxis:(SnapshotAxis*)axis context:(CGContextRef)context
+{
+    NSDictionary *options = axis.options;
+    CGRect box = self.plotBox;
+
+    CGFloat lineWidth = SnapshotNumber(SnapshotValue(options, @"lineWidth"), axis.isX ? 1 : 0);
+    if (lineWidth > 0 && SnapshotSetStrokeColor(context, SnapshotSolidColor(SnapshotValue(options, @"lineColor")) ?: @"#ccd6eb", 1)) {
+        CGContextSetLineWidth(context, lineWidth);
+        if (axis.horizontal) {
+            CGFloat y = round(CGRectGetMaxY(box)) + fmod(lineWidth, 2) / 2;
+            CGContextMoveToPoint(context, CGRectGetMinX(box), y);
+            CGContextAddLineToPoint(context, CGRectGetMaxX(box), y);
+        }
+        else {
+            CGFloat x = round(CGRectGetMinX(box)) - fmod(lineWidth, 2) / 2;
+            CGContextMoveToPoint(context, x, CGRectGetMinY(box));
+            CGContextAddLineToPoint(context, x, CGRectGetMaxY(box));
+        }
+        CGContextStrokePath(context);
+    }
+
+    CGFloat tickWidth = SnapshotNumber(SnapshotValue(options, @"tickWidth"), axis.isX ? 1 : 0);
+    CGFloat tickLength = SnapshotNumber(SnapshotValue(options, @"tickLength"), 10);
+    if (tickWidth > 0 && tickLength > 0 && SnapshotSetStrokeColor(context, SnapshotSolidColor(SnapshotValue(options, @"tickColor")) ?: @"#ccd6eb", 1)) {
+        BOOL inside = [SnapshotValue(options, @"tickPosition") isEqualToString:@"inside"];
+        CGContextSetLineWidth(context, tickWidth);
+        for (NSNumber *position in [self tickMarkPositionsForAxis:axis]) {
+            CGFloat p = round(position.doubleValue) + fmod(tickWidth, 2) / 2;
+            if (axis.horizontal) {
+                CGContextMoveToPoint(context, p, CGRectGetMaxY(box));
+                CGContextAddLineToPoint(context, p, CGRectGetMaxY(box) + (inside ? -tickLength : tickLength));
+            }
+            else {
+                CGContextMoveToPoint(context, CGRectGetMinX(box), p);
+                CGContextAddLineToPoint(context, CGRectGetMinX(box) + (inside ? tickLength : -tickLength), p);
+            }
+        }
+        CGContextStrokePath(context);
+    }
+
+    NSDictionary *labelOptions = SnapshotValue(options, @"labels");
+    CGFloat labelWidth = 0;
+    if (SnapshotBool(SnapshotValue(labelOptions, @"enabled"), YES)) {
+        SnapshotTextStyle text = SnapshotTextStyleMake([self labelStyleDefaults], SnapshotValue(labelOptions, @"style"));
+        SnapshotMetrics metrics = SnapshotFontMetrics(text.fontSize);
+        NSArray *labels = [self labelsForAxis:axis];
+        for (NSString *label in labels) {
+            labelWidth = MAX(labelWidth, SnapshotTextWidth(label, &text));
+        }
+
+        // Thin out horizontal labels that would overlap, like the automatic label step
+        NSInteger step = (NSInteger)SnapshotNumber(SnapshotValue(labelOptions, @"step"), 0);
+        if (step < 1) {
+            step = 1;
+            if (axis.horizontal && axis.ticks.count > 1) {
+                CGFloat slot = fabs([axis toPixels:[axis.ticks[1] doubleValue]] - [axis toPixels:[axis.ticks[0] doubleValue]]);
+                while (slot * step < labelWidth + 4 && step < (NSInteger)axis.ticks.count) {
+                    step++;
+                }
+            }
+        }
+
+        for (NSUInteger i = 0; i < axis.ticks.count; i += step) {
+            CGFloat p = [axis toPixels:[axis.ticks[i] doubleValue]];
+            if (axis.horizontal) {
+                CGFloat y = CGRectGetMaxY(box) + SnapshotNumber(SnapshotValue(labelOptions, @"y"), metrics.baseline + 8);
+                CGFloat x = p + SnapshotNumber(SnapshotValue(labelOptions, @"x"), 0);
+                SnapshotDrawText(context, labels[i], &text, CGPointMake(x, y), SnapshotValue(labelOptions, @"align") ?: @"center", 0);
+            }
+            else {
+                CGFloat x = CGRectGetMinX(box) + SnapshotNumber(SnapshotValue(labelOptions, @"x"), -15);
+                CGFloat y = p + metrics.baseline - metrics.height / 2 + SnapshotNumber(SnapshotValue(labelOptions, @"y"), 0);
+                SnapshotDrawText(context, labels[i], &text, CGPointMake(x, y), SnapshotValue(labelOptions, @"align") ?: @"right", 0);
+            }
+        }
+        SnapshotTextStyleRelease(&text);
+    }
+
+    NSDictionary *title = SnapshotValue(options, @"title");
+    NSString *titleText = title ? [SnapshotValue(title, @"text") description] : (axis.isX ? nil : @"Values");
+    if (titleText.length) {
+        SnapshotTextStyle text = SnapshotTextStyleMake(@{ @"color": @"#666666", @"fontSize": @"12px" }, SnapshotValue(title, @"style"));
+        SnapshotMetrics metrics = SnapshotFontMetrics(text.fontSize);
+        if (axis.horizontal) {
+            CGFloat labelSize = SnapshotNumber(SnapshotValue(SnapshotMerge([self labelStyleDefaults], SnapshotValue(labelOptions, @"style")), @"fontSize"), 11);
+            CGFloat labelHeight = SnapshotFontMetrics(labelSize).height;
+            CGFloat y = CGRectGetMaxY(box) + labelHeight + 13 + metrics.baseline;
+            SnapshotDrawText(context, titleText, &text, CGPointMake(CGRectGetMidX(box), y), @"center", 0);
+        }
+        else {
+            CGFloat x = CGRectGetMinX(box) - labelWidth - 10 - metrics.height + metrics.baseline;
+            SnapshotDrawText(context, titleText, &text, CGPointMake(x, CGRectGetMidY(box)), @"center", -90);
+        }
+        SnapshotTextStyleRelease(&text);
+    }
+}
+
+#pragma mark Series drawing
+
+/**
+ *  Control points for a spline, the same smoothing the spline series uses.
+ */
+- (void)addSplineToPath:(CGMutablePathRef)path points:(NSArray*)points
+{
+    CGFloat smoothing = 1.5, denom = smoothing + 1;
+    CGPoint lastRight = CGPointZero;
+    for (NSUInteger i = 0; i < points.count; i++) {
+        CGPoint p = [points[i] CGPointValue];
+        if (i == 0) {
+            CGPathMoveToPoint(path, NULL, p.x, p.y);
+            lastRight = p;
+            continue;
+        }
+        CGPoint last = [points[i - 1] CGPointValue];
+        CGPoint left = p, right = p;
+        if (i + 1 < points.count) {
+            CGPoint next = [points[i + 1] CGPointValue];
+            left = CGPointMake((smoothing * p.x + last.x) / denom, (smoothing * p.y + last.y) / denom);
+            right = CGPointMake((smoothing * p.x + next.x) / denom, (smoothing * p.y + next.y) / denom);
+            CGFloat correction = right.x != left.x ? ((right.y - left.y) * (right.x - p.x)) / (right.x - left.x) + p.y - right.y : 0;
+            left.y += correction;
+            right.y += correction;
+            // Keep control points from overshooting the neighbouring points
+            if (left.y > last.y && left.y > p.y) {
+                left.y = MAX(last.y, p.y);
+                right.y = 2 * p.y - left.y;
+            }
+            else if (left.y < last.y && left.y < p.y) {
+                left.y = MIN(last.y, p.y);
+                right.y = 2 * p.y - left.y;
+            }
+            if (right.y > next.y && right.y > p.y) {
+                right.y = MAX(next.y, p.y);
+                left.y = 2 * p.y - right.y;
+            }
+            else if (right.y < next.y && right.y < p.y) {
+                right.y = MIN(next.y, p.y);
+                left.y = 2 * p.y - right.y;
+            }
+        }
+        CGPathAddCurveToPoint(path, NULL, lastRight.x, lastRight.y, left.x, left.y, p.x, p.y);
+        lastRight = right;
+    }
+}
+
+- (void)addSegment:(NSArray*)points toPath:(CGMutablePathRef)path spline:(BOOL)spline
+{
+    if (spline) {
+        [self addSplineToPath:path points:points];
+        return;
+    }
+    for (NSUInteger i = 0; i < points.count; i++) {
+        CGPoint p = [points[i] CGPointValue];
+        if (i == 0) {
+            CGPathMoveToPoint(path, NULL, p.x, p.y);
+        }
+        else {
+            CGPathAddLineToPoint(path, NULL, p.x, p.y);
+        }
+    }
+}
+
+- (void)drawLineSeries:(SnapshotSeries*)series context:(CGContextRef)context
+{
+    NSDictionary *options = series.options;
+    BOOL scatter = [series.type isEqualToString:@"scatter"];
+    BOOL area = [self isArea:series];
+    BOOL spline = [series.type isEqualToString:@"spline"] || [series.type isEqualToString:@"areaspline"];
+    BOOL connectNulls = SnapshotBool(SnapshotValue(options, @"connectNulls"), NO);
+    double threshold = SnapshotNumber(SnapshotValue(options, @"threshold"), 0);
+
+    // Split into segments at null points
+    NSMutableArray *segments = [NSMutableArray arrayWithObject:[NSMutableArray array]];
+    for (SnapshotPoint *point in series.points) {
+        if (point.isNull) {
+            if (!connectNulls && [segments.lastObject count]) {
+                [segments addObject:[NSMutableArray array]];
+            }
+            continue;
+        }
+        [segments.lastObject addObject:point];
+    }
+
+    if (area) {
+        id fillColor = SnapshotValue(options, @"fillColor");
+        CGFloat fillOpacity = fillColor ? 1 : SnapshotNumber(SnapshotValue(options, @"fillOpacity"), 0.75);
+        for (NSArray *segment in segments) {
+            if (segment.count == 0) {
+                continue;
+            }
+            NSMutableArray *top = [NSMutableArray array];
+            NSMutableArray *bottom = [NSMutableArray array];
+            for (SnapshotPoint *point in segment) {
+                [top addObject:[NSValue valueWithCGPoint:CGPointMake(point.plotX, point.plotY)]];
+                double low = series.stackKey ? point.low : MAX(MIN(threshold, self.yAxis.max), self.yAxis.min);
+                [bottom insertObject:[NSValue valueWithCGPoint:[self pointForX:point.x y:low]] atIndex:0];
+            }
+            CGMutablePathRef path = CGPathCreateMutable();
+            [self addSegment:top toPath:path spline:spline];
+            CGPoint first = [bottom.firstObject CGPointValue];
+            CGPathAddLineToPoint(path, NULL, first.x, first.y);
+            if (series.stackKey) {
+                // The bottom of a stacked area follows the series below it
+                [self addSegment:bottom toPath:path spline:spline];
+                CGMutablePathRef joined = SnapshotCreateJoinedPath(path);
+                CGPathRelease(path);
+                path = joined;
+            }
+            else {
+                CGPoint last = [bottom.lastObject CGPointValue];
+                CGPathAddLineToPoint(path, NULL, last.x, last.y);
+            }
+            CGPathCloseSubpath(path);
+            SnapshotFillPath(context, path, fillColor ?: series.color, CGPathGetBoundingBox(path), self.plotBox.origin, fillOpacity);
+            CGPathRelease(path);
+        }
+    }
+
+    CGFloat lineWidth = SnapshotNumber(SnapshotValue(options, @"lineWidth"), scatter ? 0 : 2);
+    if (lineWidth > 0 && SnapshotSetStrokeColor(context, SnapshotSolidColor(SnapshotValue(options, @"lineColor") ?: series.color), 1)) {
+        CGMutablePathRef path = CGPathCreateMutable();
+        for (NSArray *segment in segments) {
+            NSMutableArray *points = [NSMutableArray array];
+            for (SnapshotPoint *point in segment) {
+                [points addObject:[NSValue valueWithCGPoint:CGPointMake(point.plotX, point.plotY)]];
+            }
+            [self addSegment:points toPath:path spline:spline];
+        }
+        CGContextSetLineWidth(context, lineWidth);
+        CGContextSetLineJoin(context, kCGLineJoinRound);
+        CGContextSetLineCap(context, kCGLineCapRound);
+        CGContextAddPath(context, path);
+        CGContextStrokePath(context);
+        CGPathRelease(path);
+    }
+}
+
+- (void)drawMarkersForSeries:(SnapshotSeries*)series context:(CGContextRef)context
+{
+    NSDictionary *marker = SnapshotValue(series.options, @"marker");
+    CGFloat radius = SnapshotNumber(SnapshotValue(marker, @"radius"), 4);
+    BOOL scatter = [series.type isEqualToString:@"scatter"];
+    id enabled = SnapshotValue(marker, @"enabled");
+    BOOL show;
+    if (enabled) {
+        show = SnapshotBool(enabled, YES);
+    }
+    else {
+        // Markers are hidden by default when points are too dense to tell apart
+        CGFloat range = fabs([self.xAxis toPixels:self.closestPointRange] - [self.xAxis toPixels:0]);
+        show = scatter || range > SnapshotNumber(SnapshotValue(marker, @"enabledThreshold"), 2) * radius;
+    }
+    if (!show || radius <= 0) {
+        return;
+    }
+    NSString *symbol = SnapshotValue(marker, @"symbol") ?: @"circle";
+    CGFloat lineWidth = SnapshotNumber(SnapshotValue(marker, @"lineWidth"), 0);
+    id lineColor = SnapshotValue(marker, @"lineColor") ?: @"#ffffff";
+
+    for (SnapshotPoint *point in series.points) {
+        if (point.isNull || !CGRectContainsPoint(CGRectInset(self.plotBox, -1, -1), CGPointMake(point.plotX, point.plotY))) {
+            continue;
+        }
+        CGRect rect = CGRectMake(point.plotX - radius, point.plotY - radius, radius * 2, radius * 2);
+        CGMutablePathRef path = CGPathCreateMutable();
+        if ([symbol isEqualToString:@"square"]) {
+            CGPathAddRect(path, NULL, rect);
+        }
+        else if ([symbol isEqualToString:@"diamond"]) {
+            CGPathMoveToPoint(path, NULL, CGRectGetMidX(rect), CGRectGetMinY(rect));
+            CGPathAddLineToPoint(path, NULL, CGRectGetMaxX(rect), CGRectGetMidY(rect));
+            CGPathAddLineToPoint(path, NULL, CGRectGetMidX(rect), CGRectGetMaxY(rect));
+            CGPathAddLineToPoint(path, NULL, CGRectGetMinX(rect), CGRectGetMidY(rect));
+            CGPathCloseSubpath(path);
+        }
+        else if ([symbol isEqualToString:@"triangle"] || [symbol isEqualToString:@"triangle-down"]) {
+            BOOL down = [symbol isEqualToString:@"triangle-down"];
+            CGPathMoveToPoint(path, NULL, CGRectGetMidX(rect), down ? CGRectGetMaxY(rect) : CGRectGetMinY(rect));
+            CGPathAddLineToPoint(path, NULL, CGRectGetMaxX(rect), down ? CGRectGetMinY(rect) : CGRectGetMaxY(rect));
+            CGPathAddLineToPoint(path, NULL, CGRectGetMinX(rect), down ? CGRectGetMinY(rect) : CGRectGetMaxY(rect));
+            CGPathCloseSubpath(path);
+        }
+        else {
+            CGPathAddEllipseInRect(path, NULL, rect);
+        }
+        SnapshotFillPath(context, path, SnapshotValue(marker, @"fillColor") ?: point.color ?: SnapshotSolidColor(series.color), rect, self.plotBox.origin, 1);
+        if (lineWidth > 0 && SnapshotSetStrokeColor(context, lineColor, 1)) {
+            CGContextSetLineWidth(context, lineWidth);
+            CGContextAddPath(context, path);
+            CGContextStrokePath(context);
+        }
+        CGPathRelease(path);
+    }
+}
+
+- (CGRect)columnRectForPoint:(SnapshotPoint*)point series:(SnapshotSeries*)series
+{
+    NSDictionary *options = series.options;
+    SnapshotAxis *xAxis = self.xAxis;
+    CGFloat categoryWidth = MIN(fabs([xAxis toPixels:self.closestPointRange] - [xAxis toPixels:0]), xAxis.len);
+    CGFloat groupPadding = categoryWidth * SnapshotNumber(SnapshotValue(options, @"groupPadding"), 0.2);
+    CGFloat pointPadding = SnapshotNumber(SnapshotValue(options, @"pointPadding"), 0.1);
+    BOOL grouping = SnapshotBool(SnapshotValue(options, @"grouping"), YES);
+    NSInteger count = grouping ? MAX(1, [self columnCount]) : 1;
+    CGFloat pointOffsetWidth = (categoryWidth - 2 * groupPadding) / count;
+    CGFloat pointWidth = pointOffsetWidth * (1 - 2 * pointPadding);
+    pointWidth = MIN(pointWidth, SnapshotNumber(SnapshotValue(options, @"maxPointWidth"), INFINITY));
+    pointWidth = SnapshotNumber(SnapshotValue(options, @"pointWidth"), pointWidth);
+    NSInteger index = grouping ? series.columnIndex : 0;
+    if (xAxis.reversed) {
+        index = count - 1 - index;
+    }
+    CGFloat offset = -categoryWidth / 2 + groupPadding + index * pointOffsetWidth + (pointOffsetWidth - pointWidth) / 2;
+
+    CGFloat center = [xAxis toPixels:point.x];
+    double threshold = SnapshotNumber(SnapshotValue(options, @"threshold"), 0);
+    double low = series.stackKey ? point.low : MAX(MIN(threshold, self.yAxis.max), self.yAxis.min);
+    CGFloat top = [self.yAxis toPixels:point.high], base = [self.yAxis toPixels:low];
+    CGFloat start = MIN(top, base), length = fabs(base - top);
+
+    CGFloat minPointLength = SnapshotNumber(SnapshotValue(options, @"minPointLength"), 0);
+    if (length < minPointLength) {
+        // Grow short columns away from the threshold, towards higher values for positive points
+        BOOL increasing = (point.high >= low) != self.yAxis.reversed;
+        start = increasing == self.inverted ? base : base - minPointLength;
+        length = minPointLength;
+    }
+    CGRect rect = self.inverted ? CGRectMake(start, center + offset, length, pointWidth) : CGRectMake(center + offset, start, pointWidth, length);
+    // Crisp edges like the SVG renderer
+    CGFloat borderWidth = SnapshotNumber(SnapshotValue(options, @"borderWidth"), 1);
+    CGFloat crisp = fmod(borderWidth, 2) / 2;
+    CGFloat x = round(CGRectGetMinX(rect)) + crisp, y = round(CGRectGetMinY(rect)) + crisp;
+    return CGRectMake(x, y, round(CGRectGetMaxX(rect)) + crisp - x, round(CGRectGetMaxY(rect)) + crisp - y);
+}
+
+- (void)drawColumnSeries:(SnapshotSeries*)series context:(CGContextRef)context
+{
+    NSDictionary *options = series.options;
+    CGFloat borderWidth = SnapshotNumber(SnapshotValue(options, @"borderWidth"), 1);
+    CGFloat borderRadius = SnapshotNumber(SnapshotValue(options, @"borderRadius"), 0);
+    id borderColor = SnapshotValue(options, @"borderColor") ?: @"#ffffff";
+    BOOL colorByPoint = SnapshotBool(SnapshotValue(options, @"colorByPoint"), NO);
+    NSArray *colors = [self defaultColors];
+    NSInteger i = 0;
+
+    for (SnapshotPoint *point in series.points) {
+        i++;
+        if (point.isNull) {
+            continue;
+        }
+        CGRect rect = [self columnRectForPoint:point series:series];
+        if (rect.size.width <= 0) {
+            continue;
+        }
+        CGFloat radius = MIN(borderRadius, MIN(rect.size.width, rect.size.height) / 2);
+        CGPathRef path = CGPathCreateWithRoundedRect(rect, radius, radius, NULL);
+        id color = point.color ?: (colorByPoint ? colors[(i - 1) % colors.count] : series.color);
+        SnapshotFillPath(context, path, color, rect, self.plotBox.origin, 1);
+        if (borderWidth > 0 && SnapshotSetStrokeColor(context, borderColor, 1)) {
+            CGContextSetLineWidth(context, borderWidth);
+            CGContextAddPath(context, path);
+            CGContextStrokePath(context);
+        }
+        CGPathRelease(path);
+    }
+}
+
+- (void)drawPieSeries:(SnapshotSeries*)series context:(CGContextRef)context
+{
+    NSDictionary *options = series.options;
+    NSDictionary *dataLabels = SnapshotValue(options, @"dataLabels");
+    BOOL labels = SnapshotBool(SnapshotValue(dataLabels, @"enabled"), YES);
+    CGFloat distance = SnapshotNumber(SnapshotValue(dataLabels, @"distance"), 30);
+    SnapshotTextStyle text = SnapshotTextStyleMake(@{ @"color": @"#000000", @"fontSize": @"11px", @"fontWeight": @"bold" }, SnapshotValue(dataLabels, @"style"));
+    SnapshotMetrics metrics = SnapshotFontMetrics(text.fontSize);
+
+    CGRect box = self.plotBox;
+    NSArray *center = [SnapshotValue(options, @"center") isKindOfClass:[NSArray class]] ? options[@"center"] : nil;
+    CGFloat smallest = MIN(box.size.width, box.size.height);
+    CGFloat cx = box.origin.x + [self pieLength:center.count > 0 ? center[0] : nil base:box.size.width fallback:box.size.width / 2];
+    CGFloat cy = box.origin.y + [self pieLength:center.count > 1 ? center[1] : nil base:box.size.height fallback:box.size.height / 2];
+    // Without an explicit size, shrink the pie to leave room for labels outside it
+    CGFloat fitted = labels && distance > 0 ? smallest - 2 * (distance + metrics.height) : smallest;
+    CGFloat minSize = SnapshotNumber(SnapshotValue(options, @"minSize"), 80);
+    CGFloat diameter = [self pieLength:SnapshotValue(options, @"size") base:smallest fallback:MAX(fitted, minSize)];
+    CGFloat inner = [self pieLength:SnapshotValue(options, @"innerSize") base:diameter fallback:0];
+    CGFloat radius = diameter / 2;
+
+    double total = 0;
+    for (SnapshotPoint *point in series.points) {
+        total += point.isNull || point.y < 0 ? 0 : point.y;
+    }
+    double startAngle = (SnapshotNumber(SnapshotValue(options, @"startAngle"), 0) - 90) * M_PI / 180;
+    double endAngle = SnapshotValue(options, @"endAngle") ? (SnapshotNumber(SnapshotValue(options, @"endAngle"), 0) - 90) * M_PI / 180 : startAngle + 2 * M_PI;
+    double circle = endAngle - startAngle;
+    CGFloat borderWidth = SnapshotNumber(SnapshotValue(options, @"borderWidth"), 1);
+    id borderColor = SnapshotValue(options, @"borderColor") ?: @"#ffffff";
+
+    double angle = startAngle;
+    for (SnapshotPoint *point in series.points) {
+        if (point.isNull || point.y <= 0 || total <= 0) {
+            continue;
+        }
+        double end = angle + point.y / total * circle;
+        CGMutablePathRef path = CGPathCreateMutable();
+        if (inner > 0) {
+            CGPathAddArc(path, NULL, cx, cy, radius, angle, end, NO);
+            CGPathAddArc(path, NULL, cx, cy, inner / 2, end, angle, YES);
+        }
+        else {
+            CGPathMoveToPoint(path, NULL, cx, cy);
+            CGPathAddArc(path, NULL, cx, cy, radius, angle, end, NO);
+        }
+        CGPathCloseSubpath(path);
+        SnapshotFillPath(context, path, point.color ?: series.color, CGRectMake(cx - radius, cy - radius, diameter, diameter), self.plotBox.origin, 1);
+        if (borderWidth > 0 && SnapshotSetStrokeColor(context, borderColor, 1)) {
+            CGContextSetLineWidth(context, borderWidth);
+            CGContextSetLineJoin(context, kCGLineJoinRound);
+            CGContextAddPath(context, path);
+            CGContextStrokePath(context);
+        }
+        CGPathRelease(path);
+
+        if (labels && point.name.length) {
+            double middle = (angle + end) / 2;
+            BOOL right = cos(middle) >= 0;
+            CGPoint edge = CGPointMake(cx + cos(middle) * radius, cy + sin(middle) * radius);
+            CGPoint bend = CGPointMake(cx + cos(middle) * (radius + distance - 5), cy + sin(middle) * (radius + distance - 5));
+            CGPoint label = CGPointMake(bend.x + (right ? 5 : -5), bend.y);
+            if (distance > 0 && SnapshotBool(SnapshotValue(dataLabels, @"connector"), YES)
+                && SnapshotSetStrokeColor(context, SnapshotValue(dataLabels, @"connectorColor") ?: SnapshotSolidColor(point.color ?: series.color), 1)) {
+                CGContextSetLineWidth(context, SnapshotNumber(SnapshotValue(dataLabels, @"connectorWidth"), 1));
+                CGContextMoveToPoint(context, edge.x, edge.y);
+                CGContextAddLineToPoint(context, bend.x, bend.y);
+                CGContextAddLineToPoint(context, label.x, label.y);
+                CGContextStrokePath(context);
+            }
+            NSString *align = distance > 0 ? (right ? @"left" : @"right") : @"center";
+            CGPoint position = distance > 0 ? CGPointMake(label.x + (right ? 2 : -2), label.y + metrics.baseline - metrics.height / 2)
+                                            : CGPointMake(cx + cos(middle) * (radius + distance), cy + sin(middle) * (radius + distance) + metrics.baseline - metrics.height / 2);
+            SnapshotDrawText(context, point.name, &text, position, align, 0);
+        }
+        angle = end;
+    }
+    SnapshotTextStyleRelease(&text);
+}
+
+- (CGFloat)pieLength:(id)value base:(CGFloat)base fallback:(CGFloat)fallback
+{
+    if ([value isKindOfClass:[NSString class]] && [value hasSuffix:@"%"]) {
+        return base * [value doubleValue] / 100;
+    }
+    return SnapshotNumber(value, fallback);
+}
+
+- (void)drawDataLabelsForSeries:(SnapshotSeries*)series context:(CGContextRef)context
+{
+    NSDictionary *dataLabels = SnapshotValue(series.options, @"dataLabels");
+    if (!SnapshotBool(SnapshotValue(dataLabels, @"enabled"), NO)) {
+        return;
+    }
+    SnapshotTextStyle text = SnapshotTextStyleMake(@{ @"color": @"#000000", @"fontSize": @"11px", @"fontWeight": @"bold", @"textOutline": @"1px #ffffff" },
+                                                   SnapshotValue(dataLabels, @"style"));
+    if ([SnapshotValue(dataLabels, @"color") isKindOfClass:[NSString class]]) {
+        SnapshotParseColor(SnapshotValue(dataLabels, @"color"), text.color);
+    }
+    SnapshotMetrics metrics = SnapshotFontMetrics(text.fontSize);
+    NSString *format = SnapshotValue(dataLabels, @"format") ?: @"{y}";
+    CGFloat offsetX = SnapshotNumber(SnapshotValue(dataLabels, @"x"), 0);
+    CGFloat offsetY = SnapshotNumber(SnapshotValue(dataLabels, @"y"), -6);
+
+    for (SnapshotPoint *point in series.points) {
+        if (point.isNull || !CGRectContainsPoint(CGRectInset(self.plotBox, -1, -1), CGPointMake(point.plotX, point.plotY))) {
+            continue;
+        }
+        NSString *value = [NSString stringWithFormat:@"%.15g", point.y];
+        NSString *string = [format stringByReplacingOccurrencesOfString:@"{point.y}" withString:value];
+        string = [string stringByReplacingOccurrencesOfString:@"{y}" withString:value];
+        string = [string stringByReplacingOccurrencesOfString:@"{x}" withString:[NSString stringWithFormat:@"%.15g", point.x]];
+        string = [string stringByReplacingOccurrencesOfString:@"{point.name}" withString:point.name ?: @""];
+        string = [string stringByReplacingOccurrencesOfString:@"{series.name}" withString:[SnapshotValue(series.options, @"name") description] ?: @""];
+
+        CGPoint anchor = CGPointMake(point.plotX, point.plotY);
+        if ([self isColumn:series]) {
+            CGRect rect = [self columnRectForPoint:point series:series];
+            anchor = self.inverted ? CGPointMake(CGRectGetMaxX(rect) + 5, CGRectGetMidY(rect)) : CGPointMake(CGRectGetMidX(rect), CGRectGetMinY(rect));
+        }
+        if (self.inverted) {
+            SnapshotDrawText(context, string, &text, CGPointMake(anchor.x + offsetX, anchor.y + metrics.baseline - metrics.height / 2), @"left", 0);
+        }
+        else {
+            SnapshotDrawText(context, string, &text, CGPointMake(anchor.x + offsetX, anchor.y + offsetY), @"center", 0);
+        }
+    }
+    SnapshotTextStyleRelease(&text);
+}
+
+- (void)drawCredits:(CGContextRef)context size:(CGSize)size
+{
+    NSDictionary *credits = SnapshotDictionary(self.params[@"credits"]);
+    if (!SnapshotBool(SnapshotValue(credits, @"enabled"), YES)) {
+        return;
+    }
+    SnapshotTextStyle text = SnapshotTextStyleMake(@{ @"color": @"#999999", @"fontSize": @"9px" }, SnapshotValue(credits, @"style"));
+    NSDictionary *position = SnapshotValue(credits, @"position");
+    CGPoint point = CGPointMake(size.width + SnapshotNumber(SnapshotValue(position, @"x"), -10),
+                                size.height + SnapshotNumber(SnapshotValue(position, @"y"), -5));
+    SnapshotDrawText(context, [SnapshotValue(credits, @"text") description] ?: @"Highcharts.com", &text, point, @"right", 0);
+    SnapshotTextStyleRelease(&text);
+}
+
+@end
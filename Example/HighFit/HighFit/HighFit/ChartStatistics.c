@@ -0,0 +1,419 @@
+//
+//  ChartStatistics.c
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#include "ChartStatistics.h"
+
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Define CHART_STATISTICS_NO_SIMD to benchmark the portable code paths. NEON has double lanes on
+// 64 bit ARM only.
+#if !defined(CHART_STATISTICS_NO_SIMD) && defined(__SSE2__)
+#include <emmintrin.h>
+#define CHART_STATISTICS_SSE2 1
+#elif !defined(CHART_STATISTICS_NO_SIMD) && defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define CHART_STATISTICS_NEON 1
+#endif
+
+// More bins than this are taken for a bin width that does not fit the data
+#define ChartHistogramMaxBins ((size_t)1 << 24)
+
+#pragma mark - Summaries
+
+ChartStatsSummary ChartStatsSummarize(const double *values, size_t count)
+{
+    ChartStatsSummary summary = { 0, 0, INFINITY, -INFINITY };
+    double numbers = 0;
+    size_t i = 0;
+
+#if CHART_STATISTICS_SSE2
+    const __m128d one = _mm_set1_pd(1);
+    __m128d sum0 = _mm_setzero_pd(), sum1 = _mm_setzero_pd();
+    __m128d count0 = _mm_setzero_pd(), count1 = _mm_setzero_pd();
+    __m128d min0 = _mm_set1_pd(INFINITY), min1 = min0;
+    __m128d max0 = _mm_set1_pd(-INFINITY), max1 = max0;
+    double lanes[2];
+
+    for (; i + 4 <= count; i += 4) {
+        __m128d a = _mm_loadu_pd(values + i);
+        __m128d b = _mm_loadu_pd(values + i + 2);
+        // Ordered compares are false for NaN, which then adds nothing
+        __m128d numberA = _mm_cmpord_pd(a, a);
+        __m128d numberB = _mm_cmpord_pd(b, b);
+        sum0 = _mm_add_pd(sum0, _mm_and_pd(numberA, a));
+        sum1 = _mm_add_pd(sum1, _mm_and_pd(numberB, b));
+        count0 = _mm_add_pd(count0, _mm_and_pd(numberA, one));
+        count1 = _mm_add_pd(count1, _mm_and_pd(numberB, one));
+        // minpd and maxpd return the second operand when either is NaN
+        min0 = _mm_min_pd(a, min0);
+        min1 = _mm_min_pd(b, min1);
+        max0 = _mm_max_pd(a, max0);
+        max1 = _mm_max_pd(b, max1);
+    }
+    _mm_storeu_pd(lanes, _mm_add_pd(sum0, sum1));
+    summary.sum = lanes[0] + lanes[1];
+    _mm_storeu_pd(lanes, _mm_add_pd(count0, count1));
+    numbers = lanes[0] + lanes[1];
+    _mm_storeu_pd(lanes, _mm_min_pd(min0, min1));
+    summary.min = fmin(lanes[0], lanes[1]);
+    _mm_storeu_pd(lanes, _mm_max_pd(max0, max1));
+    summary.max = fmax(lanes[0], lanes[1]);
+#elif CHART_STATISTICS_NEON
+    const uint64x2_t one = vreinterpretq_u64_f64(vdupq_n_f64(1));
+    float64x2_t sum0 = vdupq_n_f64(0), sum1 = sum0;
+    float64x2_t count0 = vdupq_n_f64(0), count1 = count0;
+    float64x2_t min0 = vdupq_n_f64(INFINITY), min1 = min0;
+    float64x2_t max0 = vdupq_n_f64(-INFINITY), max1 = max0;
+
+    for (; i + 4 <= count; i += 4) {
+        float64x2_t a = vld1q_f64(values + i);
+        float64x2_t b = vld1q_f64(values + i + 2);
+        uint64x2_t numberA = vceqq_f64(a, a);
+        uint64x2_t numberB = vceqq_f64(b, b);
+        sum0 = vaddq_f64(sum0, vreinterpretq_f64_u64(vandq_u64(numberA, vreinterpretq_u64_f64(a))));
+        sum1 = vaddq_f64(sum1, vreinterpretq_f64_u64(vandq_u64(numberB, vreinterpretq_u64_f64(b))));
+        count0 = vaddq_f64(count0, vreinterpretq_f64_u64(vandq_u64(numberA, one)));
+        count1 = vaddq_f64(count1, vreinterpretq_f64_u64(vandq_u64(numberB, one)));
+        // The nm variants return the number when one operand is NaN
+        min0 = vminnmq_f64(min0, a);
+        min1 = vminnmq_f64(min1, b);
+        max0 = vmaxnmq_f64(max0, a);
+        max1 = vmaxnmq_f64(max1, b);
+    }
+    summary.sum = vaddvq_f64(vaddq_f64(sum0, sum1));
+    numbers = vaddvq_f64(vaddq_f64(count0, count1));
+    summary.min = vminnmvq_f64(vminnmq_f64(min0, min1));
+    summary.max = vmaxnmvq_f64(vmaxnmq_f64(max0, max1));
+#endif
+
+    summary.count = (size_t)numbers;
+    for (; i < count; i++) {
+        double value = values[i];
+        if (!isnan(value)) {
+            summary.count++;
+            summary.sum += value;
+            summary.min = value < summary.min ? value : summary.min;
+            summary.max = value > summary.max ? value : summary.max;
+        }
+    }
+    if (!summary.count) {
+        summary.min = summary.max = NAN;
+    }
+    return summary;
+}
+
+double ChartStatsStandardDeviation(const double *values, size_t count, double mean)
+{
+    double squares = 0;
+    size_t numbers = 0;
+    size_t i = 0;
+
+#if CHART_STATISTICS_SSE2
+    const __m128d one = _mm_set1_pd(1);
+    const __m128d center = _mm_set1_pd(mean);
+    __m128d sum0 = _mm_setzero_pd(), sum1 = _mm_setzero_pd();
+    __m128d count0 = _mm_setzero_pd(), count1 = _mm_setzero_pd();
+    double lanes[2];
+
+    for (; i + 4 <= count; i += 4) {
+        __m128d a = _mm_loadu_pd(values + i);
+        __m128d b = _mm_loadu_pd(values + i + 2);
+        __m128d numberA = _mm_cmpord_pd(a, a);
+        __m128d numberB = _mm_cmpord_pd(b, b);
+        a = _mm_sub_pd(a, center);
+        b = _mm_sub_pd(b, center);
+        sum0 = _mm_add_pd(sum0, _mm_and_pd(numberA, _mm_mul_pd(a, a)));
+        sum1 = _mm_add_pd(sum1, _mm_and_pd(numberB, _mm_mul_pd(b, b)));
+        count0 = _mm_add_pd(count0, _mm_and_pd(numberA, one));
+        count1 = _mm_add_pd(count1, _mm_and_pd(numberB, one));
+    }
+    _mm_storeu_pd(lanes, _mm_add_pd(sum0, sum1));
+    squares = lanes[0] + lanes[1];
+    _mm_storeu_pd(lanes, _mm_add_pd(count0, count1));
+    numbers = (size_t)(lanes[0] + lanes[1]);
+#elif CHART_STATISTICS_NEON
+    const uint64x2_t one = vreinterpretq_u64_f64(vdupq_n_f64(1));
+    const float64x2_t center = vdupq_n_f64(mean);
+    float64x2_t sum0 = vdupq_n_f64(0), sum1 = sum0;
+    float64x2_t count0 = vdupq_n_f64(0), count1 = count0;
+
+    for (; i + 4 <= count; i += 4) {
+        float64x2_t a = vld1q_f64(values + i);
+        float64x2_t b = vld1q_f64(values + i + 2);
+        uint64x2_t numberA = vceqq_f64(a, a);
+        uint64x2_t numberB = vceqq_f64(b, b);
+        a = vsubq_f64(a, center);
+        b = vsubq_f64(b, center);
+        sum0 = vaddq_f64(sum0, vreinterpretq_f64_u64(vandq_u64(numberA, vreinterpretq_u64_f64(vmulq_f64(a, a)))));
+        sum1 = vaddq_f64(sum1, vreinterpretq_f64_u64(vandq_u64(numberB, vreinterpretq_u64_f64(vmulq_f64(b, b)))));
+        count0 = vaddq_f64(count0, vreinterpretq_f64_u64(vandq_u64(numberA, one)));
+        count1 = vaddq_f64(count1, vreinterpretq_f64_u64(vandq_u64(numberB, one)));
+    }
+    squares = vaddvq_f64(vaddq_f64(sum0, sum1));
+    numbers = (size_t)vaddvq_f64(vaddq_f64(count0, count1));
+#endif
+
+    for (; i < count; i++) {
+        double value = values[i];
+        if (!isnan(value)) {
+            double deviation = value - mean;
+            squares += deviation * deviation;
+            numbers++;
+        }
+    }
+    return numbers > 1 ? sqrt(squares / (double)(numbers - 1)) : NAN;
+}
+
+double ChartStatsCorrectFloat(double value)
+{
+    char buffer[32];
+    if (!isfinite(value)) {
+        return value;
+    }
+    snprintf(buffer, sizeof(buffer), "%.13e", value);
+    return strtod(buffer, NULL);
+}
+
+#pragma mark - Histogram
+
+ChartBinsRule ChartBinsRuleFromString(const char *string)
+{
+    if (string && strcmp(string, "sturges") == 0) {
+        return ChartBinsRuleSturges;
+    }
+    if (string && strcmp(string, "rice") == 0) {
+        return ChartBinsRuleRice;
+    }
+    return ChartBinsRuleSquareRoot;
+}
+
+size_t ChartStatsBinsNumber(ChartBinsRule rule, size_t count)
+{
+    double bins = 0;
+    switch (rule) {
+        case ChartBinsRuleSturges:
+            bins = count ? ceil(log((double)count) * M_LOG2E) : 0;
+            break;
+        case ChartBinsRuleRice:
+            bins = ceil(2 * pow((double)count, 1.0 / 3));
+            break;
+        default:
+            break;
+    }
+    // The series falls back to the square root rule when a rule gives no bins
+    if (bins <= 0) {
+        bins = round(sqrt((double)count));
+    }
+    return (size_t)bins;
+}
+
+bool ChartStatsHistogramBins(ChartStatsSummary summary, size_t binsNumber, double binWidth, ChartHistogramBins *bins)
+{
+    double width = binWidth;
+    double first, last;
+
+    if (!summary.count) {
+        return false;
+    }
+    if (!(width > 0) || !isfinite(width)) {
+        width = binsNumber ? (summary.max - summary.min) / (double)binsNumber : 0;
+    }
+    if (!(width > 0) || !isfinite(width)) {
+        width = 1;
+    }
+
+    first = floor(summary.min / width);
+    last = floor(summary.max / width);
+    if (last - first >= (double)ChartHistogramMaxBins) {
+        return false;
+    }
+    bins->start = first * width;
+    bins->width = width;
+    bins->count = (size_t)(last - first) + 1;
+    return true;
+}
+
+double ChartStatsHistogramBinX(ChartHistogramBins bins, size_t index)
+{
+    return ChartStatsCorrectFloat((round(bins.start / bins.width) + (double)index) * bins.width);
+}
+
+void ChartStatsHistogramCount(const double *values, size_t count, ChartHistogramBins bins, size_t *counts)
+{
+    // Values go in the bin of floor(value / width) as in the series, relative to the first bin
+    double first = round(bins.start / bins.width);
+    double last = (double)(bins.count - 1);
+    size_t i;
+
+    memset(counts, 0, bins.count * sizeof(size_t));
+    for (i = 0; i < count; i++) {
+        double index = floor(values[i] / bins.width) - first;
+        // NaN fails both tests
+        if (index >= 0 && index <= last) {
+            counts[(size_t)index]++;
+        }
+    }
+}
+
+#pragma mark - Bell curve
+
+size_t ChartStatsBellcurvePointCount(size_t intervals, size_t pointsInInterval)
+{
+    return intervals * pointsInInterval * 2 + 1;
+}
+
+void ChartStatsBellcurve(double mean, double standardDeviation, size_t intervals, size_t pointsInInterval,
+                         double *x, double *y)
+{
+    size_t count = ChartStatsBellcurvePointCount(intervals, pointsInInterval);
+    double position = mean - (double)intervals * standardDeviation;
+    double increment = standardDeviation / (double)pointsInInterval;
+    double scale = standardDeviation * sqrt(2 * M_PI);
+    size_t i;
+
+    for (i = 0; i < count; i++) {
+        double deviation = position - mean;
+        x[i] = position;
+        y[i] = exp(-(deviation * deviation) / (2 * standardDeviation * standardDeviation)) / scale;
+        position += increment;
+    }
+}
+
+#pragma mark - Pareto
+
+double ChartStatsParetoPercents(const double *values, size_t count, double *percents)
+{
+    ChartStatsSummary summary = ChartStatsSummarize(values, count);
+    double cumulative = 0;
+    size_t i;
+
+    // A running sum, the series adds rounded percents but keeps summing the exact ones
+    for (i = 0; i < count; i++) {
+        double percent;
+        if (isnan(values[i])) {
+            percents[i] = NAN;
+            continue;
+        }
+        percent = values[i] / summary.sum * 100;
+        percents[i] = ChartStatsCorrectFloat(cumulative + percent);
+        cumulative += percent;
+    }
+    return summary.sum;
+}
+
+#pragma mark - Boxplot
+
+static void ChartStatsSwap(double *values, ptrdiff_t a, ptrdiff_t b)
+{
+    double value = values[a];
+    values[a] = values[b];
+    values[b] = value;
+}
+
+// Moves the value of rank k within left...right to index k, with smaller values before it and
+// larger ones after. Hoare partitions around a median of three.
+static void ChartStatsSelect(double *values, ptrdiff_t left, ptrdiff_t right, ptrdiff_t k)
+{
+    while (right > left) {
+        ptrdiff_t middle = left + (right - left) / 2;
+        ptrdiff_t i = left, j = right;
+        double pivot;
+
+        if (values[middle] < values[left]) {
+            ChartStatsSwap(values, middle, left);
+        }
+        if (values[right] < values[left]) {
+            ChartStatsSwap(values, right, left);
+        }
+        if (values[right] < values[middle]) {
+            ChartStatsSwap(values, right, middle);
+        }
+        pivot = values[middle];
+
+        while (i <= j) {
+            while (values[i] < pivot) {
+                i++;
+            }
+            while (values[j] > pivot) {
+                j--;
+            }
+            if (i <= j) {
+                ChartStatsSwap(values, i, j);
+                i++;
+                j--;
+            }
+        }
+        if (k <= j) {
+            right = j;
+        } else if (k >= i) {
+            left = i;
+        } else {
+            return;
+        }
+    }
+}
+
+// The quantile p of count sorted values, selecting its ranks within left...right, which must
+// hold them. Values after right are not smaller than any within.
+static double ChartStatsQuantile(double *values, size_t count, ptrdiff_t left, ptrdiff_t right, double p)
+{
+    double position = (double)(count - 1) * p;
+    ptrdiff_t rank = (ptrdiff_t)floor(position);
+    double fraction = position - (double)rank;
+    double next;
+    ptrdiff_t i;
+
+    ChartStatsSelect(values, left, right, rank);
+    if (fraction == 0 || rank + 1 >= (ptrdiff_t)count) {
+        return values[rank];
+    }
+    // The next rank is the smallest value after this one
+    next = values[rank + 1];
+    for (i = rank + 2; i < (ptrdiff_t)count; i++) {
+        next = values[i] < next ? values[i] : next;
+    }
+    return values[rank] + fraction * (next - values[rank]);
+}
+
+bool ChartStatsBoxplot(const double *values, size_t count, ChartStatsBox *box)
+{
+    double *numbers;
+    size_t size = 0, i;
+    ptrdiff_t middle;
+
+    numbers = malloc((count ? count : 1) * sizeof(double));
+    if (!numbers) {
+        return false;
+    }
+    box->low = INFINITY;
+    box->high = -INFINITY;
+    for (i = 0; i < count; i++) {
+        double value = values[i];
+        if (!isnan(value)) {
+            numbers[size++] = value;
+            box->low = value < box->low ? value : box->low;
+            box->high = value > box->high ? value : box->high;
+        }
+    }
+    if (!size) {
+        free(numbers);
+        return false;
+    }
+
+    // The median splits the values, so the quartiles are selected within either side of it
+    middle = (ptrdiff_t)floor((double)(size - 1) * 0.5);
+    box->median = ChartStatsQuantile(numbers, size, 0, (ptrdiff_t)size - 1, 0.5);
+    box->q1 = ChartStatsQuantile(numbers, size, 0, middle, 0.25);
+    box->q3 = ChartStatsQuantile(numbers, size, middle, (ptrdiff_t)size - 1, 0.75);
+    free(numbers);
+    return true;
+}
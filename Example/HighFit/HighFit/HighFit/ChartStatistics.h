@@ -0,0 +1,136 @@
+//
+//  ChartStatistics.h
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#ifndef ChartStatistics_h
+#define ChartStatistics_h
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Derives the data of the histogram, bellcurve, pareto and boxplot series from a column of values,
+// so only the derived points have to be sent to the chart instead of every sample. Bins, means and
+// cumulative percents follow the derivedData functions of the histogram-bellcurve and pareto
+// modules. NaN values, the empty cells of a column, are skipped.
+//
+// The passes over whole columns take two values at a time with SSE2 on x86 or NEON on ARM, in two
+// accumulators each. Sums are added up in that order rather than one by one, so a mean or percent
+// can differ from the series in the last of its 14 digits. Defining CHART_STATISTICS_NO_SIMD
+// leaves out the intrinsics.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    size_t count; // values that are not NaN
+    double sum;
+    double min;
+    double max;
+} ChartStatsSummary;
+
+/**
+ *  The count, sum and extremes of the values that are not NaN. The extremes are NaN when there
+ *  are none.
+ */
+ChartStatsSummary ChartStatsSummarize(const double *values, size_t count);
+
+/**
+ *  The sample standard deviation around mean, NaN unless there are two values.
+ */
+double ChartStatsStandardDeviation(const double *values, size_t count, double mean);
+
+/**
+ *  Rounds to 14 significant digits like Highcharts.correctFloat, so sums of fractions such as
+ *  0.1 + 0.2 print as they would on the chart.
+ */
+double ChartStatsCorrectFloat(double value);
+
+/**
+ *  The rules of the binsNumber option.
+ */
+typedef enum {
+    ChartBinsRuleSquareRoot = 0,
+    ChartBinsRuleSturges,
+    ChartBinsRuleRice
+} ChartBinsRule;
+
+/**
+ *  Maps a binsNumber option like "sturges" to its rule, square-root when unknown.
+ */
+ChartBinsRule ChartBinsRuleFromString(const char *string);
+
+/**
+ *  The number of bins for count values, as the histogram series computes it from the length of
+ *  its base series data.
+ */
+size_t ChartStatsBinsNumber(ChartBinsRule rule, size_t count);
+
+typedef struct {
+    double start; // x of the first bin, a multiple of the width
+    double width;
+    size_t count;
+} ChartHistogramBins;
+
+/**
+ *  Lays out bins of binWidth, or binsNumber bins across the extremes when binWidth is not
+ *  positive. Bins start at multiples of the width, like the histogram series. When all values are
+ *  equal the width falls back to 1. Returns false when the summary has no values or the width
+ *  would make more than 16M bins.
+ */
+bool ChartStatsHistogramBins(ChartStatsSummary summary, size_t binsNumber, double binWidth, ChartHistogramBins *bins);
+
+/**
+ *  The x of a bin, rounded like the keys of the histogram series. The bin ends at the x of the next.
+ */
+double ChartStatsHistogramBinX(ChartHistogramBins bins, size_t index);
+
+/**
+ *  Counts the values into the bins. counts has bins.count entries and is cleared first.
+ */
+void ChartStatsHistogramCount(const double *values, size_t count, ChartHistogramBins bins, size_t *counts);
+
+/**
+ *  The number of points of a bell curve, as in the bellcurve series.
+ */
+size_t ChartStatsBellcurvePointCount(size_t intervals, size_t pointsInInterval);
+
+/**
+ *  Samples the normal density of mean and standardDeviation at pointsInInterval points per standard
+ *  deviation, intervals deviations to each side of the mean. x and y have
+ *  ChartStatsBellcurvePointCount entries.
+ */
+void ChartStatsBellcurve(double mean, double standardDeviation, size_t intervals, size_t pointsInInterval,
+                         double *x, double *y);
+
+/**
+ *  The cumulative percent of the total at each value, as in the pareto series. NaN values keep NaN.
+ *  Returns the total.
+ */
+double ChartStatsParetoPercents(const double *values, size_t count, double *percents);
+
+typedef struct {
+    double low;
+    double q1;
+    double median;
+    double q3;
+    double high;
+} ChartStatsBox;
+
+/**
+ *  The extremes and quartiles of the values, the point of a boxplot series. Quartiles interpolate
+ *  linearly between the closest ranks, like QUARTILE.INC in spreadsheets. The values are selected
+ *  in a copy of the column, in linear time on average. Returns false when there are no values or
+ *  memory for the copy fails.
+ */
+bool ChartStatsBoxplot(const double *values, size_t count, ChartStatsBox *box);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ChartStatistics_h */
@@ -0,0 +1,46 @@
+//
+//  ChartStatisticsSeries.h
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <Highcharts/Highcharts.h>
+#import "ChartDataColumn.h"
+
+/**
+ *  Builds histogram, bellcurve, pareto and boxplot series from number columns with ChartStatistics.
+ *  The series carry only the derived points and no baseSeries, so a column of millions of samples
+ *  is never serialized into the options.
+ */
+@interface ChartStatisticsSeries : NSObject
+
+/**
+ *  The bins of column. binsNumber is an NSNumber or one of the rules "square-root", "sturges" and
+ *  "rice", nil for square-root. binWidth, when set, takes precedence, as in the histogram series.
+ *  Points have x, x2 and y like the points the series derives. Returns nil when the column has no
+ *  numbers.
+ */
++ (HIHistogram*)histogramWithColumn:(ChartDataColumn*)column binsNumber:(id)binsNumber binWidth:(NSNumber*)binWidth;
+
+/**
+ *  The normal curve of the mean and standard deviation of column, sampled like the bellcurve series.
+ *  Returns nil unless the column has two numbers.
+ */
++ (HIBellcurve*)bellcurveWithColumn:(ChartDataColumn*)column intervals:(NSUInteger)intervals pointsInInterval:(NSUInteger)pointsInInterval;
+
+/**
+ *  The cumulative percents of column, at the values of xColumn or at the row index when it is nil.
+ *  Empty cells are left out, as nulls are by the pareto series.
+ */
++ (HIPareto*)paretoWithColumn:(ChartDataColumn*)column xColumn:(ChartDataColumn*)xColumn;
+
+/**
+ *  One box per column, named after it, for a category x axis. Columns without numbers give null
+ *  points.
+ */
++ (HIBoxplot*)boxplotWithColumns:(NSArray<ChartDataColumn*>*)columns;
+
+@end
@@ -0,0 +1,146 @@
+//
+//  ChartStatisticsSeries.m
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import "ChartStatisticsSeries.h"
+#import "ChartStatistics.h"
+
+@implementation ChartStatisticsSeries
+
+static const double *ChartStatisticsValues(ChartDataColumn *column)
+{
+    return column.values ? (const double *)column.values.bytes : NULL;
+}
+
++ (HIHistogram*)histogramWithColumn:(ChartDataColumn*)column binsNumber:(id)binsNumber binWidth:(NSNumber*)binWidth
+{
+    const double *values = ChartStatisticsValues(column);
+    NSUInteger count = values ? column.count : 0;
+    ChartStatsSummary summary = ChartStatsSummarize(values, count);
+    ChartHistogramBins bins;
+    size_t number;
+
+    if ([binsNumber isKindOfClass:[NSNumber class]]) {
+        double requested = [binsNumber doubleValue];
+        number = requested > 0 ? (size_t)ceil(requested) : 0;
+    } else {
+        // The rules count the rows of the base series, empty cells included
+        NSString *rule = [binsNumber isKindOfClass:[NSString class]] ? binsNumber : nil;
+        number = ChartStatsBinsNumber(ChartBinsRuleFromString(rule.UTF8String), count);
+    }
+    if (!ChartStatsHistogramBins(summary, number, binWidth ? binWidth.doubleValue : 0, &bins)) {
+        return nil;
+    }
+
+    size_t *counts = malloc(bins.count * sizeof(size_t));
+    if (!counts) {
+        return nil;
+    }
+    ChartStatsHistogramCount(values, count, bins, counts);
+
+    NSMutableArray *data = [NSMutableArray arrayWithCapacity:bins.count];
+    for (size_t i = 0; i < bins.count; i++) {
+        [data addObject:@{ @"x": @(ChartStatsHistogramBinX(bins, i)),
+                           @"x2": @(ChartStatsHistogramBinX(bins, i + 1)),
+                           @"y": @(counts[i]) }];
+    }
+    free(counts);
+
+    HIHistogram *histogram = [[HIHistogram alloc] init];
+    histogram.name = column.name;
+    histogram.data = data;
+    return histogram;
+}
+
++ (HIBellcurve*)bellcurveWithColumn:(ChartDataColumn*)column intervals:(NSUInteger)intervals pointsInInterval:(NSUInteger)pointsInInterval
+{
+    const double *values = ChartStatisticsValues(column);
+    NSUInteger count = values ? column.count : 0;
+    ChartStatsSummary summary = ChartStatsSummarize(values, count);
+    if (summary.count < 2 || !pointsInInterval) {
+        return nil;
+    }
+
+    // The series rounds both before sampling the curve
+    double mean = ChartStatsCorrectFloat(summary.sum / (double)summary.count);
+    double deviation = ChartStatsCorrectFloat(ChartStatsStandardDeviation(values, count, mean));
+    size_t points = ChartStatsBellcurvePointCount(intervals, pointsInInterval);
+    double *x = malloc(points * sizeof(double));
+    double *y = malloc(points * sizeof(double));
+    if (!x || !y) {
+        free(x);
+        free(y);
+        return nil;
+    }
+    ChartStatsBellcurve(mean, deviation, intervals, pointsInInterval, x, y);
+
+    NSMutableArray *data = [NSMutableArray arrayWithCapacity:points];
+    for (size_t i = 0; i < points; i++) {
+        [data addObject:@[ @(x[i]), @(y[i]) ]];
+    }
+    free(x);
+    free(y);
+
+    HIBellcurve *bellcurve = [[HIBellcurve alloc] init];
+    bellcurve.name = column.name;
+    bellcurve.data = data;
+    return bellcurve;
+}
+
++ (HIPareto*)paretoWithColumn:(ChartDataColumn*)column xColumn:(ChartDataColumn*)xColumn
+{
+    const double *values = ChartStatisticsValues(column);
+    NSUInteger count = values ? column.count : 0;
+    double *percents = malloc((count ? count : 1) * sizeof(double));
+    if (!percents) {
+        return nil;
+    }
+    ChartStatsParetoPercents(values, count, percents);
+
+    NSMutableArray *data = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        if (!isnan(percents[i])) {
+            id x = xColumn ? [xColumn objectAtIndex:i] : @(i);
+            [data addObject:@[ x, @(percents[i]) ]];
+        }
+    }
+    free(percents);
+
+    HIPareto *pareto = [[HIPareto alloc] init];
+    pareto.name = column.name;
+    pareto.data = data;
+    if (xColumn.type == ChartDataColumnTypeString) {
+        // The turbo path only takes numeric x values, so long category series must skip it
+        pareto.turboThreshold = @0;
+    }
+    return pareto;
+}
+
++ (HIBoxplot*)boxplotWithColumns:(NSArray<ChartDataColumn*>*)columns
+{
+    NSMutableArray *data = [NSMutableArray arrayWithCapacity:columns.count];
+    for (ChartDataColumn *column in columns) {
+        const double *values = ChartStatisticsValues(column);
+        ChartStatsBox box;
+        if (!values || !ChartStatsBoxplot(values, column.count, &box)) {
+            [data addObject:[NSNull null]];
+            continue;
+        }
+        [data addObject:@{ @"name": column.name ?: @"",
+                           @"low": @(box.low),
+                           @"q1": @(box.q1),
+                           @"median": @(box.median),
+                           @"q3": @(box.q3),
+                           @"high": @(box.high) }];
+    }
+
+    HIBoxplot *boxplot = [[HIBoxplot alloc] init];
+    boxplot.data = data;
+    return boxplot;
+}
+
+@end
@@ -0,0 +1,254 @@
+//
+//  ChartValueFormatter.c
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#include "ChartValueFormatter.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#pragma mark - Numbers
+
+// The shortest significant digits that read back to value, and the decimal exponent of the first
+// digit. Any decimal of up to 15 digits survives a round trip through a double, so when rounding
+// to 15 digits reads back, the shortest digits are those without the trailing zeros. Otherwise
+// rounding to 16 and then 17 digits gives the closest digits of that length. Subnormals have
+// fewer significant bits, so all lengths are tried for them.
+static int ChartShortestDigits(double value, char *digits, int *exponent)
+{
+    char scientific[40];
+    int precision;
+    for (precision = value < DBL_MIN ? 1 : 15; precision < 17; precision++) {
+        snprintf(scientific, sizeof(scientific), "%.*e", precision - 1, value);
+        if (strtod(scientific, NULL) == value) {
+            break;
+        }
+    }
+    if (precision == 17) {
+        snprintf(scientific, sizeof(scientific), "%.*e", precision - 1, value);
+    }
+
+    // d.ddddde±x
+    int count = 0;
+    const char *c = scientific;
+    for (; *c && *c != 'e'; c++) {
+        if (*c >= '0' && *c <= '9') {
+            digits[count++] = *c;
+        }
+    }
+    *exponent = *c == 'e' ? atoi(c + 1) : 0;
+    while (count > 1 && digits[count - 1] == '0') {
+        count--;
+    }
+    digits[count] = '\0';
+    return count;
+}
+
+size_t ChartFormatNumber(double value, char decimalPoint, char *buffer)
+{
+    if (isnan(value)) {
+        return (size_t)snprintf(buffer, ChartNumberBufferSize, "NaN");
+    }
+    if (isinf(value)) {
+        return (size_t)snprintf(buffer, ChartNumberBufferSize, value < 0 ? "-Infinity" : "Infinity");
+    }
+    if (value == 0) {
+        // Including negative zero
+        return (size_t)snprintf(buffer, ChartNumberBufferSize, "0");
+    }
+
+    char digits[24];
+    int exponent = 0;
+    char *out = buffer;
+    if (value < 0) {
+        *out++ = '-';
+        value = -value;
+    }
+    int k = ChartShortestDigits(value, digits, &exponent);
+    // Position of the decimal point relative to the digits, the n of the ECMAScript algorithm
+    int n = exponent + 1;
+
+    if (k <= n && n <= 21) {
+        memcpy(out, digits, (size_t)k);
+        out += k;
+        for (int i = k; i < n; i++) {
+            *out++ = '0';
+        }
+    }
+    else if (0 < n && n <= 21) {
+        memcpy(out, digits, (size_t)n);
+        out += n;
+        *out++ = decimalPoint;
+        memcpy(out, digits + n, (size_t)(k - n));
+        out += k - n;
+    }
+    else if (-6 < n && n <= 0) {
+        *out++ = '0';
+        *out++ = decimalPoint;
+        for (int i = 0; i < -n; i++) {
+            *out++ = '0';
+        }
+        memcpy(out, digits, (size_t)k);
+        out += k;
+    }
+    else {
+        *out++ = digits[0];
+        if (k > 1) {
+            *out++ = decimalPoint;
+            memcpy(out, digits + 1, (size_t)(k - 1));
+            out += k - 1;
+        }
+        out += sprintf(out, "e%c%d", n - 1 < 0 ? '-' : '+', abs(n - 1));
+    }
+    *out = '\0';
+    return (size_t)(out - buffer);
+}
+
+#pragma mark - Dates
+
+static const char *const ChartWeekdays[] = {
+    "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"
+};
+
+static const char *const ChartMonths[] = {
+    "January", "February", "March", "April", "May", "June",
+    "July", "August", "September", "October", "November", "December"
+};
+
+static const char *const ChartShortMonths[] = {
+    "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+};
+
+typedef struct {
+    char *buffer;
+    size_t size;
+    size_t length;
+} ChartDateWriter;
+
+static void ChartDateAppend(ChartDateWriter *writer, const char *bytes, size_t length)
+{
+    if (writer->length < writer->size) {
+        size_t room = writer->size - writer->length;
+        memcpy(writer->buffer + writer->length, bytes, length < room ? length : room);
+    }
+    writer->length += length;
+}
+
+// Highcharts.pad: zeros, or the given character, in front up to length, counting a minus sign
+static void ChartDateAppendPadded(ChartDateWriter *writer, long number, int length, char pad)
+{
+    char digits[24];
+    int count = snprintf(digits, sizeof(digits), "%ld", number);
+    for (int i = count; i < length; i++) {
+        ChartDateAppend(writer, &pad, 1);
+    }
+    ChartDateAppend(writer, digits, (size_t)count);
+}
+
+static void ChartDateAppendString(ChartDateWriter *writer, const char *string)
+{
+    ChartDateAppend(writer, string, strlen(string));
+}
+
+// Civil date from days since 1970, so years outside the range of time_t still work in UTC
+static void ChartCivilFromDays(long long days, long long *year, int *month, int *day)
+{
+    days += 719468;
+    long long era = (days >= 0 ? days : days - 146096) / 146097;
+    long long dayOfEra = days - era * 146097;
+    long long yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    long long dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    long long mp = (5 * dayOfYear + 2) / 153;
+    *day = (int)(dayOfYear - (153 * mp + 2) / 5 + 1);
+    *month = (int)(mp < 10 ? mp + 2 : mp - 10);
+    *year = yearOfEra + era * 400 + (*month < 2);
+}
+
+size_t ChartFormatDate(double time, const char *format, bool useUTC, char *buffer, size_t size)
+{
+    ChartDateWriter writer = { buffer, size ? size - 1 : 0, 0 };
+    if (isnan(time) || isinf(time)) {
+        if (size) {
+            buffer[0] = '\0';
+        }
+        return 0;
+    }
+
+    long long year;
+    int month, day, weekday, hours, minutes, seconds;
+    double whole = floor(time / 1000.0);
+    long long days = (long long)floor(whole / 86400.0);
+    long long secondOfDay = (long long)whole - days * 86400;
+    time_t local = (time_t)whole;
+    struct tm parts;
+
+    if (!useUTC && (double)local == whole && localtime_r(&local, &parts)) {
+        year = parts.tm_year + 1900LL;
+        month = parts.tm_mon;
+        day = parts.tm_mday;
+        weekday = parts.tm_wday;
+        hours = parts.tm_hour;
+        minutes = parts.tm_min;
+        seconds = parts.tm_sec;
+    }
+    else {
+        ChartCivilFromDays(days, &year, &month, &day);
+        weekday = (int)(((days % 7) + 11) % 7);
+        hours = (int)(secondOfDay / 3600);
+        minutes = (int)(secondOfDay / 60 % 60);
+        seconds = (int)(secondOfDay % 60);
+    }
+    int hours12 = hours % 12 ? hours % 12 : 12;
+
+    for (const char *c = format; *c; c++) {
+        if (*c != '%' || !c[1]) {
+            ChartDateAppend(&writer, c, 1);
+            continue;
+        }
+        char yearDigits[24];
+        switch (*++c) {
+            case 'a': ChartDateAppend(&writer, ChartWeekdays[weekday], 3); break;
+            case 'A': ChartDateAppendString(&writer, ChartWeekdays[weekday]); break;
+            case 'd': ChartDateAppendPadded(&writer, day, 2, '0'); break;
+            case 'e': ChartDateAppendPadded(&writer, day, 2, ' '); break;
+            case 'w': ChartDateAppendPadded(&writer, weekday, 0, '0'); break;
+            case 'b': ChartDateAppendString(&writer, ChartShortMonths[month]); break;
+            case 'B': ChartDateAppendString(&writer, ChartMonths[month]); break;
+            case 'm': ChartDateAppendPadded(&writer, month + 1, 2, '0'); break;
+            case 'y': {
+                // fullYear.toString().substr(2, 2)
+                int count = snprintf(yearDigits, sizeof(yearDigits), "%lld", year);
+                if (count > 2) {
+                    ChartDateAppend(&writer, yearDigits + 2, count > 3 ? 2 : 1);
+                }
+                break;
+            }
+            case 'Y': ChartDateAppendPadded(&writer, (long)year, 0, '0'); break;
+            case 'H': ChartDateAppendPadded(&writer, hours, 2, '0'); break;
+            case 'k': ChartDateAppendPadded(&writer, hours, 0, '0'); break;
+            case 'I': ChartDateAppendPadded(&writer, hours12, 2, '0'); break;
+            case 'l': ChartDateAppendPadded(&writer, hours12, 0, '0'); break;
+            case 'M': ChartDateAppendPadded(&writer, minutes, 2, '0'); break;
+            case 'p': ChartDateAppendString(&writer, hours < 12 ? "AM" : "PM"); break;
+            case 'P': ChartDateAppendString(&writer, hours < 12 ? "am" : "pm"); break;
+            case 'S': ChartDateAppendPadded(&writer, seconds, 2, '0'); break;
+            case 'L': ChartDateAppendPadded(&writer, (long)round(fmod(time, 1000.0)), 3, '0'); break;
+            default:
+                // Unknown keys are left in place
+                ChartDateAppend(&writer, c - 1, 2);
+                break;
+        }
+    }
+    if (size) {
+        buffer[writer.length < writer.size ? writer.length : writer.size] = '\0';
+    }
+    return writer.length;
+}
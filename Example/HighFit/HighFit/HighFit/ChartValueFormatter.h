@@ -0,0 +1,43 @@
+//
+//  ChartValueFormatter.h
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#ifndef ChartValueFormatter_h
+#define ChartValueFormatter_h
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  Enough for any number written by ChartFormatNumber, including the terminator.
+ */
+#define ChartNumberBufferSize 32
+
+/**
+ *  Writes a number like JavaScript's Number.prototype.toString: the shortest digits that read
+ *  back to the same double, in plain or exponential notation by the same rules. The first '.'
+ *  is replaced with decimalPoint, as export-data does for a ',' locale. Returns the length.
+ */
+size_t ChartFormatNumber(double value, char decimalPoint, char *buffer);
+
+/**
+ *  Writes a time in milliseconds since 1970 like Highcharts.dateFormat, with the English names
+ *  of the default lang options. Times are read in UTC, or in the local time zone unless useUTC.
+ *  Returns the length the full result needs, writing at most size - 1 bytes and a terminator.
+ *  NaN writes an empty string.
+ */
+size_t ChartFormatDate(double time, const char *format, bool useUTC, char *buffer, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ChartValueFormatter_h */
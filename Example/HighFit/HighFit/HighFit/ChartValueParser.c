@@ -0,0 +1,567 @@
+//
+//  ChartValueParser.c
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#include "ChartValueParser.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Define CHART_VALUE_PARSER_NO_SIMD to benchmark the portable code paths
+#if !defined(CHART_VALUE_PARSER_NO_SIMD) && defined(__SSE2__)
+#include <emmintrin.h>
+#define CHART_VALUE_PARSER_SSE2 1
+#elif !defined(CHART_VALUE_PARSER_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define CHART_VALUE_PARSER_NEON 1
+#endif
+
+// Cells up to this length are copied to a zero padded buffer and take the vectorized paths
+#define ChartFastCellLength 32
+
+static int ChartIsSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+static int ChartIsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+static void ChartTrim(const char **bytes, size_t *length)
+{
+    const char *start = *bytes;
+    const char *end = start + *length;
+    while (start < end && ChartIsSpace(*start)) {
+        start++;
+    }
+    while (end > start && ChartIsSpace(end[-1])) {
+        end--;
+    }
+    *bytes = start;
+    *length = (size_t)(end - start);
+}
+
+#pragma mark - Vectorized helpers
+
+// Number of leading ASCII digits. The bytes must be readable up to a multiple of 16 past length.
+static size_t ChartDigitRun(const char *bytes, size_t length)
+{
+    size_t i = 0;
+
+#if CHART_VALUE_PARSER_SSE2
+    const __m128i zero = _mm_set1_epi8('0');
+    const __m128i nine = _mm_set1_epi8(9);
+    for (; i < length; i += 16) {
+        __m128i chunk = _mm_sub_epi8(_mm_loadu_si128((const __m128i *)(bytes + i)), zero);
+        // Digits are the bytes that stay within 0...9 as unsigned after subtracting '0'
+        __m128i digits = _mm_cmpeq_epi8(_mm_min_epu8(chunk, nine), chunk);
+        unsigned mask = (unsigned)_mm_movemask_epi8(digits);
+        if (mask != 0xFFFF) {
+            i += (size_t)__builtin_ctz(~mask);
+            return i < length ? i : length;
+        }
+    }
+    return length;
+#elif CHART_VALUE_PARSER_NEON
+    const uint8x16_t zero = vdupq_n_u8('0');
+    const uint8x16_t ten = vdupq_n_u8(10);
+    for (; i < length; i += 16) {
+        uint8x16_t chunk = vsubq_u8(vld1q_u8((const uint8_t *)(bytes + i)), zero);
+        uint8x16_t digits = vcltq_u8(chunk, ten);
+        // Narrow the byte mask to four bits per byte to read it as one 64 bit word
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(digits), 4)), 0);
+        if (mask != UINT64_MAX) {
+            i += (size_t)__builtin_ctzll(~mask) / 4;
+            return i < length ? i : length;
+        }
+    }
+    return length;
+#else
+    while (i < length && ChartIsDigit(bytes[i])) {
+        i++;
+    }
+    return i;
+#endif
+}
+
+// Converts eight ASCII digits loaded little endian with three multiplications
+static uint64_t ChartEightDigits(const char *bytes)
+{
+    uint64_t value;
+    memcpy(&value, bytes, sizeof(value));
+    value -= 0x3030303030303030ULL;
+    value = (value * 10) + (value >> 8);
+    value = (((value & 0x000000FF000000FFULL) * 0x000F424000000064ULL) +
+             (((value >> 16) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)) >> 32;
+    return value;
+}
+
+static uint64_t ChartDigits(const char *bytes, size_t count)
+{
+    uint64_t value = 0;
+    for (; count >= 8; count -= 8, bytes += 8) {
+        value = value * 100000000ULL + ChartEightDigits(bytes);
+    }
+    for (; count; count--, bytes++) {
+        value = value * 10 + (uint64_t)(*bytes - '0');
+    }
+    return value;
+}
+
+// True when the eight bytes hold ASCII digits wherever mask has 0xFF
+static int ChartDigitsAt(const char *bytes, uint64_t mask)
+{
+    uint64_t value;
+    uint64_t high = 0x3030303030303030ULL & mask;
+    memcpy(&value, bytes, sizeof(value));
+    value &= mask;
+    // '0' to '?' share the high nibble 3, and adding 6 only keeps it for '0' to '9'
+    if ((value & 0xF0F0F0F0F0F0F0F0ULL) != high) {
+        return 0;
+    }
+    return ((value + (0x0606060606060606ULL & mask)) & 0xF0F0F0F0F0F0F0F0ULL) == high;
+}
+
+static const double ChartPowersOfTen[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+ChartDateFormat ChartDateFormatFromString(const char *string)
+{
+    if (!string) {
+        return ChartDateFormatNone;
+    }
+    if (strcmp(string, "YYYY-mm-dd") == 0) {
+        return ChartDateFormatYYYYmmdd;
+    }
+    if (strcmp(string, "dd/mm/YYYY") == 0) {
+        return ChartDateFormatddmmYYYY;
+    }
+    if (strcmp(string, "mm/dd/YYYY") == 0) {
+        return ChartDateFormatmmddYYYY;
+    }
+    if (strcmp(string, "dd/mm/YY") == 0) {
+        return ChartDateFormatddmmYY;
+    }
+    if (strcmp(string, "mm/dd/YY") == 0) {
+        return ChartDateFormatmmddYY;
+    }
+    return ChartDateFormatNone;
+}
+
+#pragma mark - Numbers
+
+// Plain decimals of up to 19 digits. Returns 1 for a number, 0 for none and -1 to leave it to strtod.
+static int ChartParseNumberFast(const char *bytes, size_t length, char decimalPoint, double *value)
+{
+    char padded[ChartFastCellLength + 16];
+    size_t i = 0, integers, fractions = 0;
+    int negative = 0;
+    uint64_t mantissa;
+
+    if (length > ChartFastCellLength) {
+        return -1;
+    }
+    // Only the 16 bytes after the cell are read past it
+    memcpy(padded, bytes, length);
+    memset(padded + length, 0, 16);
+
+    if (padded[0] == '-' || padded[0] == '+') {
+        negative = padded[0] == '-';
+        i++;
+    }
+    integers = ChartDigitRun(padded + i, length - i);
+    mantissa = ChartDigits(padded + i, integers > 19 ? 0 : integers);
+    i += integers;
+
+    if (i < length && (padded[i] == '.' || padded[i] == decimalPoint)) {
+        int separator = padded[i] != '.';
+        i++;
+        fractions = ChartDigitRun(padded + i, length - i);
+        // Like the decimalRegex of the data module, a custom separator needs digits on both sides
+        if (separator && (integers == 0 || fractions == 0)) {
+            return 0;
+        }
+        if (integers + fractions <= 19) {
+            mantissa = mantissa * (uint64_t)ChartPowersOfTen[fractions] + ChartDigits(padded + i, fractions);
+        }
+        i += fractions;
+    }
+
+    // Exponents, digit groups and long mantissas take the exact path
+    if (i != length || integers + fractions == 0 || integers + fractions > 19 || mantissa > (1ULL << 53)) {
+        return -1;
+    }
+
+    // Both operands are exact, so one division rounds correctly
+    double result = (double)mantissa / ChartPowersOfTen[fractions];
+    *value = negative ? -result : result;
+    return 1;
+}
+
+bool ChartParseNumber(const char *bytes, size_t length, char decimalPoint, double *value)
+{
+    char buffer[64];
+    size_t count = 0;
+    int digitsOnly = 1;
+    size_t i;
+    double fast;
+
+    ChartTrim(&bytes, &length);
+    if (length == 0 || length >= sizeof(buffer)) {
+        return false;
+    }
+
+    int parsed = ChartParseNumberFast(bytes, length, decimalPoint, &fast);
+    if (parsed >= 0) {
+        if (parsed && value) {
+            *value = fast;
+        }
+        return parsed == 1;
+    }
+
+    // "1 000" is read as 1000, but only when the cell has nothing but digits and spaces
+    for (i = 0; i < length; i++) {
+        if (!ChartIsDigit(bytes[i]) && !ChartIsSpace(bytes[i])) {
+            digitsOnly = 0;
+            break;
+        }
+    }
+    for (i = 0; i < length; i++) {
+        char c = bytes[i];
+        if (digitsOnly && ChartIsSpace(c)) {
+            continue;
+        }
+        if (c == decimalPoint) {
+            c = '.';
+        }
+        else if (c == 'x' || c == 'X') {
+            // strtod reads hexadecimals, which +g === parseFloat(g) rejects
+            return false;
+        }
+        buffer[count++] = c;
+    }
+    buffer[count] = '\0';
+
+    // Equivalent of +g === parseFloat(g): a plain decimal that uses up the whole cell
+    i = 0;
+    if (buffer[i] == '-' || buffer[i] == '+') {
+        i++;
+    }
+    if (!ChartIsDigit(buffer[i]) && !(buffer[i] == '.' && ChartIsDigit(buffer[i + 1]))) {
+        return false;
+    }
+
+    char *end = NULL;
+    double result = strtod(buffer, &end);
+    if (end != buffer + count) {
+        return false;
+    }
+    if (value) {
+        *value = result;
+    }
+    return true;
+}
+
+#pragma mark - Dates
+
+double ChartDateUTC(long year, long month, long day)
+{
+    // Normalize the month like Date.UTC does, then count days from the civil calendar
+    year += month / 12;
+    month %= 12;
+    if (month < 0) {
+        month += 12;
+        year--;
+    }
+    long y = year - (month < 2);
+    long era = (y >= 0 ? y : y - 399) / 400;
+    long yoe = y - era * 400;
+    long mp = (month + 10) % 12;
+    long doy = (153 * mp + 2) / 5;
+    long doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    long days = era * 146097 + doe - 719468;
+
+    return ((double)days + (double)(day - 1)) * 86400000.0;
+}
+
+// Splits a date into up to three numeric parts separated by '-', '/' or '.'
+static size_t ChartDateParts(const char *bytes, size_t length, long parts[3], size_t digits[3])
+{
+    size_t count = 0;
+    size_t i = 0;
+
+    while (i < length && count < 3) {
+        long number = 0;
+        size_t start = i;
+        while (i < length && ChartIsDigit(bytes[i])) {
+            number = number * 10 + (bytes[i] - '0');
+            i++;
+        }
+        if (i == start) {
+            return 0;
+        }
+        parts[count] = number;
+        digits[count] = i - start;
+        count++;
+        if (i == length) {
+            break;
+        }
+        if (bytes[i] != '-' && bytes[i] != '/' && bytes[i] != '.') {
+            return 0;
+        }
+        i++;
+    }
+    return i == length ? count : 0;
+}
+
+static int ChartCurrentShortYear(void)
+{
+    time_t now = time(NULL);
+    struct tm date;
+    gmtime_r(&now, &date);
+    return date.tm_year + 1900 - 2000;
+}
+
+static int ChartIsDateSeparator(char c)
+{
+    return c == '-' || c == '/' || c == '.';
+}
+
+// Zero padded dates in their full width, like 2017-01-02 or 02/01/17, read without a loop
+static int ChartDatePartsFast(const char *bytes, size_t length, ChartDateFormat format, long parts[3], size_t digits[3])
+{
+    char padded[16] = { 0 };
+
+    if (length > 10) {
+        return 0;
+    }
+    memcpy(padded, bytes, length);
+
+    if (format == ChartDateFormatYYYYmmdd && length == 10) {
+        if (!ChartIsDateSeparator(padded[4]) || !ChartIsDateSeparator(padded[7]) ||
+            !ChartDigitsAt(padded, 0x00FFFF00FFFFFFFFULL) || !ChartDigitsAt(padded + 8, 0xFFFFULL)) {
+            return 0;
+        }
+        parts[0] = (long)ChartDigits(padded, 4);
+        parts[1] = (long)ChartDigits(padded + 5, 2);
+        parts[2] = (long)ChartDigits(padded + 8, 2);
+        digits[0] = 4;
+        digits[1] = digits[2] = 2;
+        return 1;
+    }
+    if ((length == 10 || length == 8) && format != ChartDateFormatYYYYmmdd) {
+        if (!ChartIsDateSeparator(padded[2]) || !ChartIsDateSeparator(padded[5]) ||
+            !ChartDigitsAt(padded, 0xFFFF00FFFF00FFFFULL) || (length == 10 && !ChartDigitsAt(padded + 8, 0xFFFFULL))) {
+            return 0;
+        }
+        parts[0] = (long)ChartDigits(padded, 2);
+        parts[1] = (long)ChartDigits(padded + 3, 2);
+        parts[2] = (long)ChartDigits(padded + 6, length - 6);
+        digits[0] = digits[1] = 2;
+        digits[2] = length - 6;
+        return 1;
+    }
+    return 0;
+}
+
+static bool ChartParseDateWithShortYear(const char *bytes, size_t length, ChartDateFormat format, int shortYear, double *value)
+{
+    long parts[3];
+    size_t digits[3];
+    long year, month, day;
+
+    ChartTrim(&bytes, &length);
+    if (!ChartDatePartsFast(bytes, length, format, parts, digits) &&
+        ChartDateParts(bytes, length, parts, digits) != 3) {
+        return false;
+    }
+
+    switch (format) {
+        case ChartDateFormatYYYYmmdd:
+            if (digits[0] != 4 || digits[1] > 2 || digits[2] > 2) {
+                return false;
+            }
+            year = parts[0];
+            month = parts[1];
+            day = parts[2];
+            break;
+
+        case ChartDateFormatddmmYYYY:
+        case ChartDateFormatmmddYYYY:
+            if (digits[0] > 2 || digits[1] > 2 || digits[2] != 4) {
+                return false;
+            }
+            day = format == ChartDateFormatddmmYYYY ? parts[0] : parts[1];
+            month = format == ChartDateFormatddmmYYYY ? parts[1] : parts[0];
+            year = parts[2];
+            break;
+
+        case ChartDateFormatddmmYY:
+            if (digits[0] > 2 || digits[1] > 2 || digits[2] != 2) {
+                return false;
+            }
+            day = parts[0];
+            month = parts[1];
+            // Two digit years ahead of the current one are read as the last century
+            year = parts[2] + (parts[2] > shortYear ? 1900 : 2000);
+            break;
+
+        case ChartDateFormatmmddYY:
+            if (digits[0] > 2 || digits[1] > 2 || digits[2] != 2) {
+                return false;
+            }
+            month = parts[0];
+            day = parts[1];
+            year = parts[2] + 2000;
+            break;
+
+        default:
+            return false;
+    }
+
+    if (value) {
+        *value = ChartDateUTC(year, month - 1, day);
+    }
+    return true;
+}
+
+bool ChartParseDate(const char *bytes, size_t length, ChartDateFormat format, double *value)
+{
+    int shortYear = format == ChartDateFormatddmmYY ? ChartCurrentShortYear() : 0;
+    return ChartParseDateWithShortYear(bytes, length, format, shortYear, value);
+}
+
+ChartDateFormat ChartDetectDateFormat(const char *const *cells, const size_t *lengths, size_t count)
+{
+    long max[3] = { 0, 0, 0 };
+    long first[3] = { -1, -1, -1 };
+    int same[3] = { 1, 1, 1 };
+    int deduced = 0;
+    char kinds[3][5] = { "", "", "" };
+    size_t i, j;
+
+    for (i = 0; i < count; i++) {
+        long parts[3];
+        size_t digits[3];
+        const char *cell = cells[i];
+        size_t length = lengths[i];
+
+        ChartTrim(&cell, &length);
+        if (ChartDateParts(cell, length, parts, digits) != 3) {
+            continue;
+        }
+        for (j = 0; j < 3; j++) {
+            if (first[j] < 0) {
+                first[j] = parts[j];
+            }
+            else if (first[j] != parts[j]) {
+                same[j] = 0;
+            }
+            if (parts[j] > max[j]) {
+                max[j] = parts[j];
+            }
+            if (parts[j] > 31) {
+                strcpy(kinds[j], parts[j] < 100 ? "YY" : "YYYY");
+            }
+            else if (parts[j] > 12 && parts[j] <= 31) {
+                strcpy(kinds[j], "dd");
+                deduced = 1;
+            }
+            else if (!kinds[j][0]) {
+                strcpy(kinds[j], "mm");
+            }
+        }
+    }
+
+    if (!deduced) {
+        return ChartDateFormatYYYYmmdd;
+    }
+
+    // A part that never changes over 12 is taken for a year, a changing one for the day
+    for (j = 0; j < 3; j++) {
+        int isYear = strcmp(kinds[j], "YY") == 0 || strcmp(kinds[j], "YYYY") == 0;
+        if (same[j]) {
+            if (max[j] > 12 && !isYear) {
+                strcpy(kinds[j], "YY");
+            }
+        }
+        else if (max[j] > 12 && strcmp(kinds[j], "mm") == 0) {
+            strcpy(kinds[j], "dd");
+        }
+    }
+
+    char format[16];
+    snprintf(format, sizeof(format), "%s/%s/%s", kinds[0], kinds[1], kinds[2]);
+    ChartDateFormat result = ChartDateFormatFromString(format);
+
+    return result != ChartDateFormatNone ? result : ChartDateFormatYYYYmmdd;
+}
+
+ChartDateFormat ChartDetectColumnDateFormat(const char *const *cells, const size_t *lengths, size_t count, size_t sampleSize)
+{
+    const char *sample[256];
+    size_t sampleLengths[256];
+    size_t i, n = 0;
+
+    if (sampleSize == 0 || sampleSize > 256) {
+        sampleSize = 256;
+    }
+    if (count <= sampleSize) {
+        return ChartDetectDateFormat(cells, lengths, count);
+    }
+    // Evenly spaced, so a column sorted by date still shows its whole day and month ranges
+    for (i = 0; i < sampleSize; i++) {
+        size_t index = (size_t)((double)i * (double)(count - 1) / (double)(sampleSize - 1));
+        sample[n] = cells[index];
+        sampleLengths[n] = lengths[index];
+        n++;
+    }
+    return ChartDetectDateFormat(sample, sampleLengths, n);
+}
+
+#pragma mark - Columns
+
+size_t ChartParseNumbers(const char *const *cells, const size_t *lengths, size_t count, char decimalPoint, double *values)
+{
+    size_t parsed = 0;
+    size_t i;
+
+    for (i = 0; i < count; i++) {
+        if (ChartParseNumber(cells[i], lengths[i], decimalPoint, &values[i])) {
+            parsed++;
+        }
+        else {
+            values[i] = NAN;
+        }
+    }
+    return parsed;
+}
+
+size_t ChartParseDates(const char *const *cells, const size_t *lengths, size_t count, ChartDateFormat format, double *values)
+{
+    int shortYear = ChartCurrentShortYear();
+    size_t parsed = 0;
+    size_t i;
+
+    for (i = 0; i < count; i++) {
+        if (ChartParseDateWithShortYear(cells[i], lengths[i], format, shortYear, &values[i])) {
+            parsed++;
+        }
+        else {
+            values[i] = NAN;
+        }
+    }
+    return parsed;
+}
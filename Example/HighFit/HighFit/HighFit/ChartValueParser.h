@@ -0,0 +1,84 @@
+//
+//  ChartValueParser.h
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#ifndef ChartValueParser_h
+#define ChartValueParser_h
+
+#include <stddef.h>
+#include <stdbool.h>
+
+// The parsers classify digit runs 16 bytes at a time with SSE2 or NEON and convert eight digits
+// at a time within a 64 bit word. Plain decimals of up to 19 digits and zero padded dates are read
+// this way, other cells fall back to strtod and a scalar date reader, so the results are the same.
+// Defining CHART_VALUE_PARSER_NO_SIMD leaves out the intrinsics.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  The fixed date formats of the data module's dateFormats option.
+ */
+typedef enum {
+    ChartDateFormatNone = 0,
+    ChartDateFormatYYYYmmdd,
+    ChartDateFormatddmmYYYY,
+    ChartDateFormatmmddYYYY,
+    ChartDateFormatddmmYY,
+    ChartDateFormatmmddYY
+} ChartDateFormat;
+
+/**
+ *  Maps a dateFormat option like "dd/mm/YYYY" to its format, ChartDateFormatNone when unknown.
+ */
+ChartDateFormat ChartDateFormatFromString(const char *string);
+
+/**
+ *  Parses a cell the way the data module's parseColumn does: surrounding whitespace is trimmed,
+ *  inner whitespace is dropped from digit groups like "1 000", and decimalPoint is read as a
+ *  decimal separator next to '.'. Returns false unless the whole cell is a number.
+ */
+bool ChartParseNumber(const char *bytes, size_t length, char decimalPoint, double *value);
+
+/**
+ *  Parses a date in one of the fixed formats to milliseconds since 1970 in UTC.
+ *  Parts may be separated by '-', '/' or '.', as in the data module.
+ */
+bool ChartParseDate(const char *bytes, size_t length, ChartDateFormat format, double *value);
+
+/**
+ *  Deduces the date format from a sample of cells, using the day, month and year ranges like the
+ *  data module does for the whole column. Falls back to ChartDateFormatYYYYmmdd.
+ */
+ChartDateFormat ChartDetectDateFormat(const char *const *cells, const size_t *lengths, size_t count);
+
+/**
+ *  Deduces the date format of a whole column from sampleSize evenly spaced cells, at most 256.
+ */
+ChartDateFormat ChartDetectColumnDateFormat(const char *const *cells, const size_t *lengths, size_t count, size_t sampleSize);
+
+/**
+ *  Parses a column of cells into values, NaN where a cell is not a number. Returns the count of numbers.
+ */
+size_t ChartParseNumbers(const char *const *cells, const size_t *lengths, size_t count, char decimalPoint, double *values);
+
+/**
+ *  Parses a column of cells into values, NaN where a cell is not a date. Returns the count of dates.
+ */
+size_t ChartParseDates(const char *const *cells, const size_t *lengths, size_t count, ChartDateFormat format, double *values);
+
+/**
+ *  Milliseconds since 1970 for a UTC calendar date, like Date.UTC. Month is zero based.
+ */
+double ChartDateUTC(long year, long month, long day);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ChartValueParser_h */
@@ -10,6 +10,7 @@
 #import <Highcharts/Highcharts.h>
 #import "OptionsProvider.h"
 #import "DataTableViewController.h"
+#import "SuspendableChartView.h"
 
 @interface DashboardViewController ()
 @property (strong, nonatomic) NSMutableArray *sources;
@@ -116,9 +117,7 @@
     
         cell.selectionStyle = UITableViewCellSelectionStyleNone;
     
-        HIGChartView *chartView = [[HIGChartView alloc] initWithFrame:CGRectMake(5.0f, 5.0f, self.view.bounds.size.width-20.0f, 240.0f)];
-    
-        chartView.backgroundColor = [UIColor clearColor];
+        SuspendableChartView *chartView = [[SuspendableChartView alloc] initWithFrame:CGRectMake(5.0f, 5.0f, self.view.bounds.size.width-20.0f, 240.0f)];
     
         NSArray *series = [self.data objectAtIndex:indexPath.row][self.dataName];
         int sum = 0;
@@ -128,6 +127,7 @@
         
         options[@"subtitle"] = [NSString stringWithFormat:@"%d %@", sum, options[@"unit"]];
     
+        // The container shows a cached snapshot until the live chart has loaded
         chartView.options = [OptionsProvider provideOptionsForChartType:options series:series type:@"day"];
         
         [cell addSubview:chartView];
@@ -187,6 +187,17 @@
 
 #pragma mark - Table view delegate
 
+- (void)tableView:(UITableView *)tableView willDisplayCell:(UITableViewCell *)cell forRowAtIndexPath:(NSIndexPath *)indexPath
+{
+    [[self chartViewInCell:cell] resume];
+}
+
+- (void)tableView:(UITableView *)tableView didEndDisplayingCell:(UITableViewCell *)cell forRowAtIndexPath:(NSIndexPath *)indexPath
+{
+    // Scrolled away charts release their web view until they come back
+    [[self chartViewInCell:cell] suspend];
+}
+
 /*
 // In a xib-based application, navigation from a table can be handled in -tableView:didSelectRowAtIndexPath:
 - (void)tableView:(UITableView *)tableView didSelectRowAtIndexPath:(NSIndexPath *)indexPath {
@@ -239,10 +250,20 @@
     [self.tableView reloadData];
 }
 
+- (SuspendableChartView*)chartViewInCell:(UITableViewCell*)cell
+{
+    for (UIView *view in [cell subviews]) {
+        if ([view isKindOfClass:[SuspendableChartView class]]) {
+            return (SuspendableChartView*)view;
+        }
+    }
+    return nil;
+}
+
 - (void) updateCellButtonTag: (UITableViewCell*) cell newIndex:(NSInteger) index
 {
     for (UIView *view in [cell subviews]) {
-        if([view isKindOfClass:[HIGChartView class]]) {
+        if([view isKindOfClass:[SuspendableChartView class]]) {
             for (UIView *subview in [view subviews]) {
                 if([subview isKindOfClass:[UIButton class]]) {
                     subview.tag = index;
@@ -0,0 +1,56 @@
+//
+//  HIChartView+Export.h
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+#import <Highcharts/Highcharts.h>
+
+typedef NS_ENUM(NSInteger, ChartImageFormat) {
+    ChartImageFormatPNG,
+    ChartImageFormatJPEG,
+    ChartImageFormatPDF,
+    ChartImageFormatSVG
+};
+
+extern NSString * const ChartExportErrorDomain;
+
+typedef NS_ENUM(NSInteger, ChartExportError) {
+    /**
+     *  The chart has not loaded, or the page returned no SVG.
+     */
+    ChartExportErrorNoChart = 1,
+    /**
+     *  The SVG could not be parsed or drawn.
+     */
+    ChartExportErrorRender
+};
+
+@interface HIChartView (Export)
+
+/**
+ *  Evaluates script in the page of a loaded chart and calls completion on the main queue with its
+ *  result, or nil when the chart view has no page or the script fails.
+ */
+- (void)evaluateChartScript:(NSString*)script completion:(void (^)(id result))completion;
+
+/**
+ *  Exports the chart like the exporting menu, without the offline-exporting libraries. The SVG
+ *  is read from the page once, with exporting.chartOptions applied, and rasterized or encoded as
+ *  a PDF on a background queue. Scale is the pixels per point of PNG and JPEG images and is
+ *  ignored for vector formats. Completion is called on the main queue.
+ */
+- (void)exportImageWithFormat:(ChartImageFormat)format scale:(CGFloat)scale completion:(void (^)(NSData *data, NSError *error))completion;
+
+/**
+ *  Exports the chart laid out at size, CGSizeZero for its current size. With the exporting and
+ *  exporting-live plugins loaded and no exporting.chartOptions, the live chart is serialized, and
+ *  resized for the export when size differs, instead of the exporting module building a copy.
+ *  Scale only changes the pixels of PNG and JPEG images, so it never needs a new layout.
+ */
+- (void)exportImageWithFormat:(ChartImageFormat)format size:(CGSize)size scale:(CGFloat)scale completion:(void (^)(NSData *data, NSError *error))completion;
+
+@end
@@ -0,0 +1,130 @@
+//
+//  HIChartView+Export.m
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import "HIChartView+Export.h"
+#import "ChartSVGRenderer.h"
+#import <WebKit/WebKit.h>
+
+NSString * const ChartExportErrorDomain = @"ChartExportErrorDomain";
+
+// The SVG of the exporting module when it is loaded, else the live SVG serialized as XML. A size
+// is passed as the source size, which the exporting-live module lays out on the live chart.
+static NSString * const ChartExportSVGScript =
+@"(function (width, height) {"
+"    var H = window.Highcharts, chart, svg, chartOptions;"
+"    if (!H) { return null; }"
+"    H.each(H.charts, function (c) { if (c) { chart = c; } });"
+"    if (!chart) { return null; }"
+"    if (chart.getSVG) {"
+"        chartOptions = chart.options.exporting && chart.options.exporting.chartOptions;"
+"        if (width && height) {"
+"            chartOptions = H.merge(chartOptions, { exporting: { sourceWidth: width, sourceHeight: height } });"
+"        }"
+"        return chart.getSVG(chartOptions);"
+"    }"
+"    svg = chart.container.querySelector('svg');"
+"    return svg ? new XMLSerializer().serializeToString(svg) : null;"
+"}(%g, %g))";
+
+static const CGFloat ChartExportJPEGQuality = 0.9;
+
+@implementation HIChartView (Export)
+
+#pragma mark - Scripts
+
+- (UIView*)chartWebViewInView:(UIView*)view
+{
+    if ([view isKindOfClass:[WKWebView class]] || [view isKindOfClass:[UIWebView class]]) {
+        return view;
+    }
+    for (UIView *subview in view.subviews) {
+        UIView *webView = [self chartWebViewInView:subview];
+        if (webView) {
+            return webView;
+        }
+    }
+    return nil;
+}
+
+- (void)evaluateChartScript:(NSString*)script completion:(void (^)(id result))completion
+{
+    UIView *webView = [self chartWebViewInView:self];
+
+    if ([webView isKindOfClass:[WKWebView class]]) {
+        [(WKWebView*)webView evaluateJavaScript:script completionHandler:^(id result, NSError *error) {
+            if (completion) {
+                completion(error ? nil : result);
+            }
+        }];
+        return;
+    }
+    id result = nil;
+    if ([webView isKindOfClass:[UIWebView class]]) {
+        result = [(UIWebView*)webView stringByEvaluatingJavaScriptFromString:script];
+    }
+    if (completion) {
+        completion(result);
+    }
+}
+
+#pragma mark - Export
+
+- (void)exportImageWithFormat:(ChartImageFormat)format scale:(CGFloat)scale completion:(void (^)(NSData *data, NSError *error))completion
+{
+    [self exportImageWithFormat:format size:CGSizeZero scale:scale completion:completion];
+}
+
+- (void)exportImageWithFormat:(ChartImageFormat)format size:(CGSize)size scale:(CGFloat)scale completion:(void (^)(NSData *data, NSError *error))completion
+{
+    NSString *script = [NSString stringWithFormat:ChartExportSVGScript, MAX(size.width, 0), MAX(size.height, 0)];
+    [self evaluateChartScript:script completion:^(id result) {
+        NSString *svg = [result isKindOfClass:[NSString class]] && [result length] ? result : nil;
+        if (!svg) {
+            NSError *error = [NSError errorWithDomain:ChartExportErrorDomain code:ChartExportErrorNoChart
+                                             userInfo:@{ NSLocalizedDescriptionKey: @"The chart has not loaded." }];
+            if (completion) {
+                completion(nil, error);
+            }
+            return;
+        }
+        if (format == ChartImageFormatSVG) {
+            if (completion) {
+                completion([svg dataUsingEncoding:NSUTF8StringEncoding], nil);
+            }
+            return;
+        }
+
+        // Parsing and drawing large charts takes long enough to drop frames
+        dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+            NSData *data = nil;
+            @autoreleasepool {
+                ChartSVGRenderer *renderer = [[ChartSVGRenderer alloc] initWithSVG:svg];
+                switch (format) {
+                    case ChartImageFormatPNG:
+                        data = [renderer PNGDataWithScale:scale];
+                        break;
+                    case ChartImageFormatJPEG:
+                        data = [renderer JPEGDataWithScale:scale quality:ChartExportJPEGQuality];
+                        break;
+                    default:
+                        data = [renderer PDFData];
+                        break;
+                }
+            }
+            NSError *error = data ? nil : [NSError errorWithDomain:ChartExportErrorDomain code:ChartExportErrorRender
+                                                          userInfo:@{ NSLocalizedDescriptionKey: @"The chart could not be drawn." }];
+            dispatch_async(dispatch_get_main_queue(), ^{
+                if (completion) {
+                    completion(data, error);
+                }
+            });
+        });
+    }];
+}
+
+@end
@@ -0,0 +1,55 @@
+//
+//  SuspendableChartView.h
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import <UIKit/UIKit.h>
+#import <Highcharts/Highcharts.h>
+
+/**
+ *  Hosts a chart view that is torn down while it is off screen. On suspension the zoomed axis
+ *  extremes, selected points and drilldown levels are read from the page and the chart view is
+ *  released, leaving a snapshot in its place. Resuming loads a new chart view behind the snapshot
+ *  and replays the saved state once it has loaded.
+ */
+@interface SuspendableChartView : UIView
+
+@property (strong, nonatomic) HIOptions *options;
+
+/**
+ *  The live chart view, nil while suspended.
+ */
+@property (strong, nonatomic, readonly) HIChartView *chartView;
+
+@property (assign, nonatomic, readonly, getter=isSuspended) BOOL suspended;
+
+/**
+ *  Suspends when the view leaves its window, and on memory warnings while off screen. Defaults to YES.
+ */
+@property (assign, nonatomic) BOOL automaticallySuspends;
+
+/**
+ *  Receives chartViewDidLoad: for every chart view the container loads.
+ */
+@property (weak, nonatomic) id<HIChartViewDelegate> delegate;
+
+- (void)suspend;
+- (void)resume;
+
+/**
+ *  Adds rows to the table of options.data, given as table rows without the row of names. The
+ *  options are updated in place, and a live chart parses only the new cells with the
+ *  data-incremental module instead of being reloaded.
+ */
+- (void)addDataRows:(NSArray<NSArray*>*)rows;
+
+/**
+ *  Replaces table rows starting at row, where 0 is the first row after the names. Rows past the
+ *  end are added.
+ */
+- (void)updateDataRows:(NSArray<NSArray*>*)rows fromRow:(NSUInteger)row;
+
+@end
@@ -0,0 +1,363 @@
+//
+//  SuspendableChartView.m
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+
+#import "SuspendableChartView.h"
+#import "ChartSnapshotCache.h"
+#import "HIChartView+Export.h"
+
+// Reads the state that differs from the options: user set extremes, selected points and the drilldown path
+static NSString * const SuspendableChartCaptureScript =
+@"(function () {"
+"    var H = window.Highcharts, chart, state;"
+"    if (!H) { return null; }"
+"    H.each(H.charts, function (c) { if (c) { chart = c; } });"
+"    if (!chart) { return null; }"
+"    state = { xAxis: [], yAxis: [], selected: [], drilldown: [] };"
+"    H.each(chart.drilldownLevels || [], function (level) {"
+"        state.drilldown.push([H.inArray(level.seriesOptions, level.levelSeriesOptions), level.pointIndex]);"
+"    });"
+"    H.each(['xAxis', 'yAxis'], function (coll) {"
+"        H.each(chart[coll], function (axis) {"
+"            var zoomed = axis.userMin !== undefined || axis.userMax !== undefined;"
+"            state[coll].push(zoomed ? [axis.userMin, axis.userMax] : null);"
+"        });"
+"    });"
+"    H.each(chart.series, function (series, i) {"
+"        H.each(series.points || [], function (point, j) {"
+"            if (point && point.selected) { state.selected.push([i, j]); }"
+"        });"
+"    });"
+"    return JSON.stringify(state);"
+"}())";
+
+// Replays a captured state without animation, drilldown first since it replaces the series
+static NSString * const SuspendableChartRestoreScript =
+@"(function (state) {"
+"    var H = window.Highcharts, chart, drilldown;"
+"    if (!H || !state) { return; }"
+"    H.each(H.charts, function (c) { if (c) { chart = c; } });"
+"    if (!chart) { return; }"
+"    drilldown = chart.options.drilldown;"
+"    if (drilldown) { drilldown.animation = false; }"
+"    H.each(state.drilldown, function (level) {"
+"        var series = chart.series[level[0]], point = series && series.points[level[1]];"
+"        if (point && point.doDrilldown) { point.doDrilldown(); }"
+"    });"
+"    H.each(['xAxis', 'yAxis'], function (coll) {"
+"        H.each(state[coll], function (extremes, i) {"
+"            var axis = chart[coll][i];"
+"            if (axis && extremes) {"
+"                axis.setExtremes(H.pick(extremes[0], undefined), H.pick(extremes[1], undefined), false, false);"
+"            }"
+"        });"
+"    });"
+"    H.each(state.selected, function (item) {"
+"        var series = chart.series[item[0]], point = series && series.points[item[1]];"
+"        if (point) { point.select(true, true); }"
+"    });"
+"    chart.redraw(false);"
+"    if (chart.resetZoomButton === undefined && H.grep(state.xAxis.concat(state.yAxis), Boolean).length) {"
+"        chart.showResetZoom();"
+"    }"
+"}(%@))";
+
+// Passes table rows to the data-incremental module, as rows or as columns when the table is switched
+static NSString * const SuspendableChartDataScript =
+@"(function (start, rows, switched) {"
+"    var H = window.Highcharts, chart;"
+"    if (!H) { return; }"
+"    H.each(H.charts, function (c) { if (c) { chart = c; } });"
+"    if (!chart || !chart.updateDataRows) { return; }"
+"    if (switched) {"
+"        chart.updateDataColumns(start === null ? undefined : start, rows);"
+"    } else {"
+"        chart.updateDataRows(start === null ? undefined : start, rows);"
+"    }"
+"}(%@, %@, %@))";
+
+@interface SuspendableChartView () <HIChartViewDelegate>
+@property (strong, nonatomic, readwrite) HIChartView *chartView;
+@property (assign, nonatomic, readwrite, getter=isSuspended) BOOL suspended;
+@property (strong, nonatomic) UIImageView *snapshotView;
+@property (strong, nonatomic) NSString *savedState;
+@property (assign, nonatomic) NSUInteger generation;
+@property (assign, nonatomic, getter=isChartLoaded) BOOL chartLoaded;
+@end
+
+@implementation SuspendableChartView
+
+- (instancetype)initWithFrame:(CGRect)frame
+{
+    self = [super initWithFrame:frame];
+    if (self) {
+        self.automaticallySuspends = YES;
+        self.backgroundColor = [UIColor clearColor];
+
+        self.snapshotView = [[UIImageView alloc] initWithFrame:self.bounds];
+        self.snapshotView.autoresizingMask = UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight;
+        [self addSubview:self.snapshotView];
+
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(didReceiveMemoryWarning:) name:UIApplicationDidReceiveMemoryWarningNotification object:nil];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+- (void)setOptions:(HIOptions *)options
+{
+    _options = options;
+    self.savedState = nil;
+    [self loadSnapshot];
+    if (!self.suspended) {
+        [self loadChartView];
+    }
+}
+
+#pragma mark - Visibility
+
+- (void)didMoveToWindow
+{
+    [super didMoveToWindow];
+
+    if (!self.automaticallySuspends) {
+        return;
+    }
+    if (self.window) {
+        [self resume];
+    }
+    else {
+        [self suspend];
+    }
+}
+
+- (BOOL)isVisible
+{
+    if (!self.window || self.hidden) {
+        return NO;
+    }
+    CGRect frame = [self convertRect:self.bounds toView:nil];
+    return CGRectIntersectsRect(frame, self.window.bounds);
+}
+
+- (void)didReceiveMemoryWarning:(NSNotification*)notification
+{
+    if (self.automaticallySuspends && ![self isVisible]) {
+        [self suspend];
+    }
+}
+
+#pragma mark - Suspension
+
+- (void)suspend
+{
+    if (self.suspended) {
+        return;
+    }
+    self.suspended = YES;
+    NSUInteger generation = ++self.generation;
+    [self loadSnapshot];
+
+    __weak SuspendableChartView *weakSelf = self;
+    [self evaluateScript:SuspendableChartCaptureScript completion:^(id result) {
+        SuspendableChartView *strongSelf = weakSelf;
+        // A resume while the state was being read keeps the chart alive
+        if (!strongSelf || strongSelf.generation != generation) {
+            return;
+        }
+        if ([result isKindOfClass:[NSString class]]) {
+            strongSelf.savedState = result;
+        }
+        [strongSelf tearDownChartView];
+    }];
+}
+
+- (void)resume
+{
+    if (!self.suspended) {
+        return;
+    }
+    self.suspended = NO;
+    self.generation++;
+    if (!self.chartView) {
+        [self loadChartView];
+    }
+}
+
+- (void)loadChartView
+{
+    if (!self.options) {
+        return;
+    }
+    [self tearDownChartView];
+
+    HIChartView *chartView = [[HIChartView alloc] initWithFrame:self.bounds];
+    chartView.autoresizingMask = UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight;
+    chartView.backgroundColor = [UIColor clearColor];
+    chartView.delegate = self;
+    if (self.options.data) {
+        chartView.plugins = @[ @"data-incremental" ];
+    }
+    chartView.options = self.options;
+    // Behind the snapshot until it has loaded
+    [self insertSubview:chartView belowSubview:self.snapshotView];
+    self.chartView = chartView;
+    self.chartLoaded = NO;
+    self.snapshotView.alpha = 1.0f;
+}
+
+- (void)tearDownChartView
+{
+    if (!self.chartView) {
+        return;
+    }
+    self.snapshotView.alpha = 1.0f;
+    self.chartView.delegate = nil;
+    [self.chartView removeFromSuperview];
+    self.chartView = nil;
+}
+
+- (void)loadSnapshot
+{
+    if (!self.options || self.bounds.size.width <= 0 || self.bounds.size.height <= 0) {
+        return;
+    }
+    __weak UIImageView *snapshotView = self.snapshotView;
+    [[ChartSnapshotCache sharedCache] imageForOptions:self.options size:self.bounds.size completion:^(UIImage *image) {
+        if (image) {
+            snapshotView.image = image;
+        }
+    }];
+}
+
+#pragma mark - Data
+
+- (void)addDataRows:(NSArray<NSArray*>*)rows
+{
+    [self updateDataRows:rows startingAt:NSNotFound];
+}
+
+- (void)updateDataRows:(NSArray<NSArray*>*)rows fromRow:(NSUInteger)row
+{
+    [self updateDataRows:rows startingAt:row];
+}
+
+- (void)updateDataRows:(NSArray<NSArray*>*)rows startingAt:(NSUInteger)start
+{
+    HIData *data = self.options.data;
+    if (!rows.count || !(data.rows || data.columns)) {
+        return;
+    }
+    BOOL switched = data.switchRowsAndColumns.boolValue;
+    NSUInteger offset = (data.firstRowAsNames ? data.firstRowAsNames.boolValue : YES) ? 1 : 0;
+
+    // Table rows are entries of data.rows, or of data.columns when the table is switched
+    BOOL rowMajor = (data.rows != nil) != switched;
+    NSMutableArray *table = [(data.rows ?: data.columns) mutableCopy];
+    if (rowMajor) {
+        NSUInteger index = start == NSNotFound ? table.count : MIN(start + offset, table.count);
+        for (NSArray *row in rows) {
+            if (index < table.count) {
+                table[index] = row;
+            }
+            else {
+                [table addObject:row];
+            }
+            index++;
+        }
+    }
+    else {
+        for (NSUInteger column = 0; column < table.count; column++) {
+            NSMutableArray *cells = [table[column] mutableCopy];
+            NSUInteger index = start == NSNotFound ? cells.count : start + offset;
+            for (NSArray *row in rows) {
+                id cell = column < row.count ? row[column] : [NSNull null];
+                while (cells.count < index) {
+                    [cells addObject:[NSNull null]];
+                }
+                if (index < cells.count) {
+                    cells[index] = cell;
+                }
+                else {
+                    [cells addObject:cell];
+                }
+                index++;
+            }
+            table[column] = cells;
+        }
+    }
+    if (data.rows) {
+        data.rows = table;
+    }
+    else {
+        data.columns = table;
+    }
+
+    if (self.suspended || !self.chartView) {
+        return;
+    }
+    if (!self.chartLoaded) {
+        // The page may have been built from the options before the edit
+        [self loadChartView];
+        return;
+    }
+    NSData *json = [NSJSONSerialization dataWithJSONObject:rows options:0 error:nil];
+    if (!json) {
+        [self loadChartView];
+        return;
+    }
+    NSString *script = [NSString stringWithFormat:SuspendableChartDataScript,
+                        start == NSNotFound ? @"null" : @(start).stringValue,
+                        [[NSString alloc] initWithData:json encoding:NSUTF8StringEncoding],
+                        switched ? @"true" : @"false"];
+    [self evaluateScript:script completion:nil];
+}
+
+#pragma mark - Scripts
+
+- (void)evaluateScript:(NSString*)script completion:(void (^)(id result))completion
+{
+    if (self.chartView) {
+        [self.chartView evaluateChartScript:script completion:completion];
+    }
+    else if (completion) {
+        completion(nil);
+    }
+}
+
+#pragma mark - Chart view delegate
+
+- (void)chartViewDidLoad:(HIChartView *)chart
+{
+    if (chart != self.chartView) {
+        return;
+    }
+    self.chartLoaded = YES;
+    void (^reveal)(void) = ^{
+        [UIView animateWithDuration:0.2 animations:^{
+            self.snapshotView.alpha = 0.0f;
+        }];
+        [self.delegate chartViewDidLoad:chart];
+    };
+
+    if (self.savedState.length) {
+        NSString *script = [NSString stringWithFormat:SuspendableChartRestoreScript, self.savedState];
+        self.savedState = nil;
+        [self evaluateScript:script completion:^(id result) {
+            reveal();
+        }];
+    }
+    else {
+        reveal();
+    }
+}
+
+@end
@@ -6,37 +6,41 @@
 
  License: www.highcharts.com/license
 */
-(function(A){"object"===typeof module&&module.exports?module.exports=A:A(Highcharts)})(function(A){(function(b){var t=b.deg2rad,f=b.isNumber,l=b.pick,x=b.relativeLength;b.CenteredSeriesMixin={getCenter:function(){var b=this.options,r=this.chart,q=2*(b.slicedOffset||0),k=r.plotWidth-2*q,r=r.plotHeight-2*q,v=b.center,v=[l(v[0],"50%"),l(v[1],"50%"),b.size||"100%",b.innerSize||0],f=Math.min(k,r),w,C;for(w=0;4>w;++w)C=v[w],b=2>w||2===w&&/%$/.test(C),v[w]=x(C,[k,r,f,v[2]][w])+(b?q:0);v[3]>v[2]&&(v[3]=v[2]);
-return v},getStartAndEndRadians:function(b,r){b=f(b)?b:0;r=f(r)&&r>b&&360>r-b?r:b+360;return{start:t*(b+-90),end:t*(r+-90)}}}})(A);var O=function(){return function(b){var t=this,f=t.graphic,l=b.animate,x=b.attr,u=b.onComplete,r=b.css,q=b.group,k=b.renderer,v=b.shapeArgs;b=b.shapeType;t.shouldDraw()?(f||(t.graphic=f=k[b](v).add(q)),f.css(r).attr(x).animate(l,void 0,u)):f&&f.animate(l,void 0,function(){t.graphic=f=f.destroy();"function"===typeof u&&u()})}}(),J=function(b){var t=b.each,f=b.extend,l=
-b.pick;return{getColor:function(f,u){var r=u.index,q=u.levelMap,k=u.parentColor,v=u.parentColorIndex,t=u.series,w=u.colors,C=u.siblings,m=t.points,z,G,x;if(f){m=m[f.i];f=q[f.levelDynamic]||{};(z=m&&("boolean"===typeof f.colorByPoint?f.colorByPoint:!!t.options.colorByPoint))&&(G=w[m.index%w.length]);w=m&&m.options.color;z=f&&f.color;if(q=k)q=(q=f&&f.colorVariation)&&"brightness"===q.key?b.color(k).brighten(r/C*q.to).get():k;z=l(w,z,G,q,t.color);x=l(m&&m.options.colorIndex,f&&f.colorIndex,v,u.colorIndex)}return{color:z,
-colorIndex:x}},setTreeValues:function u(b,q){var k=q.before,v=q.idRoot,r=q.mapIdToNode[v],w=q.points[b.i],C=w&&w.options||{},m=0,z=[];f(b,{levelDynamic:b.level-(("boolean"===typeof q.levelIsConstant?q.levelIsConstant:1)?0:r.level),name:l(w&&w.name,""),visible:v===b.id||("boolean"===typeof q.visible?q.visible:!1)});"function"===typeof k&&(b=k(b,q));t(b.children,function(k,l){var r=f({},q);f(r,{index:l,siblings:b.children.length,visible:b.visible});k=u(k,r);z.push(k);k.visible&&(m+=k.val)});b.visible=
-0<m||b.visible;k=l(C.value,m);f(b,{children:z,childrenTotal:m,isLeaf:b.visible&&!m,val:k});return b}}}(A);(function(b,t){var f=b.seriesType,l=b.seriesTypes,x=b.map,u=b.merge,r=b.extend,q=b.noop,k=b.each,v=t.getColor,A=b.grep,w=b.isNumber,C=b.isString,m=b.pick,z=b.Series,G=b.stableSort,K=function(a,e,c){c=c||this;b.objectEach(a,function(b,d){e.call(c,b,d,a)})},H=b.reduce,F=function(a,e,c){c=c||this;a=e.call(c,a);!1!==a&&F(a,e,c)};f("treemap","scatter",{showInLegend:!1,marker:!1,dataLabels:{enabled:!0,
-defer:!1,verticalAlign:"middle",formatter:function(){return this.point.name||this.point.id},inside:!0},tooltip:{headerFormat:"",pointFormat:"\x3cb\x3e{point.name}\x3c/b\x3e: {point.value}\x3cbr/\x3e"},ignoreHiddenPoint:!0,layoutAlgorithm:"sliceAndDice",layoutStartingDirection:"vertical",alternateStartingDirection:!1,levelIsConstant:!0,drillUpButton:{position:{align:"right",x:-10,y:10}}},{pointArrayMap:["value"],axisTypes:l.heatmap?["xAxis","yAxis","colorAxis"]:["xAxis","yAxis"],directTouch:!0,optionalAxis:"colorAxis",
-getSymbol:q,parallelArrays:["x","y","value","colorValue"],colorKey:"colorValue",translateColors:l.heatmap&&l.heatmap.prototype.translateColors,colorAttribs:l.heatmap&&l.heatmap.prototype.colorAttribs,trackerGroups:["group","dataLabelsGroup"],getListOfParents:function(a,e){a=H(a||[],function(a,e,d){e=m(e.parent,"");void 0===a[e]&&(a[e]=[]);a[e].push(d);return a},{});K(a,function(a,D,d){""!==D&&-1===b.inArray(D,e)&&(k(a,function(a){d[""].push(a)}),delete d[D])});return a},getTree:function(){var a=x(this.data,
-function(a){return a.id}),a=this.getListOfParents(this.data,a);this.nodeMap=[];return this.buildNode("",-1,0,a,null)},init:function(a,e){z.prototype.init.call(this,a,e);this.options.allowDrillToNode&&b.addEvent(this,"click",this.onClickDrillToNode)},buildNode:function(a,e,c,b,d){var h=this,p=[],D=h.points[e],L=0,y;k(b[a]||[],function(d){y=h.buildNode(h.points[d].id,d,c+1,b,a);L=Math.max(y.height+1,L);p.push(y)});e={id:a,i:e,children:p,height:L,level:c,parent:d,visible:!1};h.nodeMap[e.id]=e;D&&(D.node=
-e);return e},setTreeValues:function(a){var e=this,c=e.options,b=e.nodeMap[e.rootNode],c="boolean"===typeof c.levelIsConstant?c.levelIsConstant:!0,d=0,h=[],p,g=e.points[a.i];k(a.children,function(a){a=e.setTreeValues(a);h.push(a);a.ignore||(d+=a.val)});G(h,function(a,d){return a.sortIndex-d.sortIndex});p=m(g&&g.options.value,d);g&&(g.value=p);r(a,{children:h,childrenTotal:d,ignore:!(m(g&&g.visible,!0)&&0<p),isLeaf:a.visible&&!d,levelDynamic:a.level-(c?0:b.level),name:m(g&&g.name,""),sortIndex:m(g&&
-g.sortIndex,-p),val:p});return a},calculateChildrenAreas:function(a,e){var c=this,b=c.options,d=this.levelMap[a.levelDynamic+1],h=m(c[d&&d.layoutAlgorithm]&&d.layoutAlgorithm,b.layoutAlgorithm),p=b.alternateStartingDirection,g=[];a=A(a.children,function(a){return!a.ignore});d&&d.layoutStartingDirection&&(e.direction="vertical"===d.layoutStartingDirection?0:1);g=c[h](e,a);k(a,function(a,d){d=g[d];a.values=u(d,{val:a.childrenTotal,direction:p?1-e.direction:e.direction});a.pointValues=u(d,{x:d.x/c.axisRatio,
-width:d.width/c.axisRatio});a.children.length&&c.calculateChildrenAreas(a,a.values)})},setPointValues:function(){var a=this.xAxis,e=this.yAxis;k(this.points,function(c){var b=c.node,d=b.pointValues,h,p;d&&b.visible?(b=Math.round(a.translate(d.x,0,0,0,1))-0,h=Math.round(a.translate(d.x+d.width,0,0,0,1))-0,p=Math.round(e.translate(d.y,0,0,0,1))-0,d=Math.round(e.translate(d.y+d.height,0,0,0,1))-0,c.shapeType="rect",c.shapeArgs={x:Math.min(b,h),y:Math.min(p,d),width:Math.abs(h-b),height:Math.abs(d-p)},
-c.plotX=c.shapeArgs.x+c.shapeArgs.width/2,c.plotY=c.shapeArgs.y+c.shapeArgs.height/2):(delete c.plotX,delete c.plotY)})},setColorRecursive:function(a,e,c,b,d){var h=this,p=h&&h.chart,p=p&&p.options&&p.options.colors,g;if(a){g=v(a,{colors:p,index:b,levelMap:h.levelMap,parentColor:e,parentColorIndex:c,series:h,siblings:d});if(e=h.points[a.i])e.color=g.color,e.colorIndex=g.colorIndex;k(a.children||[],function(d,c){h.setColorRecursive(d,g.color,g.colorIndex,c,a.children.length)})}},algorithmGroup:function(a,
-e,c,b){this.height=a;this.width=e;this.plot=b;this.startDirection=this.direction=c;this.lH=this.nH=this.lW=this.nW=this.total=0;this.elArr=[];this.lP={total:0,lH:0,nH:0,lW:0,nW:0,nR:0,lR:0,aspectRatio:function(a,c){return Math.max(a/c,c/a)}};this.addElement=function(a){this.lP.total=this.elArr[this.elArr.length-1];this.total+=a;0===this.direction?(this.lW=this.nW,this.lP.lH=this.lP.total/this.lW,this.lP.lR=this.lP.aspectRatio(this.lW,this.lP.lH),this.nW=this.total/this.height,this.lP.nH=this.lP.total/
-this.nW,this.lP.nR=this.lP.aspectRatio(this.nW,this.lP.nH)):(this.lH=this.nH,this.lP.lW=this.lP.total/this.lH,this.lP.lR=this.lP.aspectRatio(this.lP.lW,this.lH),this.nH=this.total/this.width,this.lP.nW=this.lP.total/this.nH,this.lP.nR=this.lP.aspectRatio(this.lP.nW,this.nH));this.elArr.push(a)};this.reset=function(){this.lW=this.nW=0;this.elArr=[];this.total=0}},algorithmCalcPoints:function(a,e,c,b){var d,h,p,g,D=c.lW,y=c.lH,n=c.plot,f,q=0,l=c.elArr.length-1;e?(D=c.nW,y=c.nH):f=c.elArr[c.elArr.length-
-1];k(c.elArr,function(a){if(e||q<l)0===c.direction?(d=n.x,h=n.y,p=D,g=a/p):(d=n.x,h=n.y,g=y,p=a/g),b.push({x:d,y:h,width:p,height:g}),0===c.direction?n.y+=g:n.x+=p;q+=1});c.reset();0===c.direction?c.width-=D:c.height-=y;n.y=n.parent.y+(n.parent.height-c.height);n.x=n.parent.x+(n.parent.width-c.width);a&&(c.direction=1-c.direction);e||c.addElement(f)},algorithmLowAspectRatio:function(a,b,c){var e=[],d=this,h,p={x:b.x,y:b.y,parent:b},g=0,f=c.length-1,y=new this.algorithmGroup(b.height,b.width,b.direction,
-p);k(c,function(c){h=c.val/b.val*b.height*b.width;y.addElement(h);y.lP.nR>y.lP.lR&&d.algorithmCalcPoints(a,!1,y,e,p);g===f&&d.algorithmCalcPoints(a,!0,y,e,p);g+=1});return e},algorithmFill:function(a,b,c){var e=[],d,h=b.direction,p=b.x,g=b.y,f=b.width,y=b.height,n,q,l,r;k(c,function(c){d=c.val/b.val*b.height*b.width;n=p;q=g;0===h?(r=y,l=d/r,f-=l,p+=l):(l=f,r=d/l,y-=r,g+=r);e.push({x:n,y:q,width:l,height:r});a&&(h=1-h)});return e},strip:function(a,b){return this.algorithmLowAspectRatio(!1,a,b)},squarified:function(a,
-b){return this.algorithmLowAspectRatio(!0,a,b)},sliceAndDice:function(a,b){return this.algorithmFill(!0,a,b)},stripes:function(a,b){return this.algorithmFill(!1,a,b)},translate:function(){var a=this,b=a.rootNode=m(a.rootNode,a.options.rootId,""),c,f;z.prototype.translate.call(a);a.levelMap=H(a.options.levels||[],function(a,b){a[b.level]=b;return a},{});f=a.tree=a.getTree();c=a.nodeMap[b];""===b||c&&c.children.length||(a.drillToNode("",!1),b=a.rootNode,c=a.nodeMap[b]);F(a.nodeMap[a.rootNode],function(b){var d=
-!1,c=b.parent;b.visible=!0;if(c||""===c)d=a.nodeMap[c];return d});F(a.nodeMap[a.rootNode].children,function(a){var b=!1;k(a,function(a){a.visible=!0;a.children.length&&(b=(b||[]).concat(a.children))});return b});a.setTreeValues(f);a.axisRatio=a.xAxis.len/a.yAxis.len;a.nodeMap[""].pointValues=b={x:0,y:0,width:100,height:100};a.nodeMap[""].values=b=u(b,{width:b.width*a.axisRatio,direction:"vertical"===a.options.layoutStartingDirection?0:1,val:f.val});a.calculateChildrenAreas(f,b);a.colorAxis?a.translateColors():
-a.options.colorByPoint||a.setColorRecursive(a.tree);a.options.allowDrillToNode&&(c=c.pointValues,a.xAxis.setExtremes(c.x,c.x+c.width,!1),a.yAxis.setExtremes(c.y,c.y+c.height,!1),a.xAxis.setScale(),a.yAxis.setScale());a.setPointValues()},drawDataLabels:function(){var a=this,b=A(a.points,function(a){return a.node.visible}),c,f;k(b,function(b){f=a.levelMap[b.node.levelDynamic];c={style:{}};b.node.isLeaf||(c.enabled=!1);f&&f.dataLabels&&(c=u(c,f.dataLabels),a._hasPointLabels=!0);b.shapeArgs&&(c.style.width=
-b.shapeArgs.width,b.dataLabel&&b.dataLabel.css({width:b.shapeArgs.width+"px"}));b.dlOptions=u(c,b.options.dataLabels)});z.prototype.drawDataLabels.call(this)},alignDataLabel:function(a){l.column.prototype.alignDataLabel.apply(this,arguments);a.dataLabel&&a.dataLabel.attr({zIndex:(a.node.zIndex||0)+1})},drawPoints:function(){var a=this,b=A(a.points,function(a){return a.node.visible});k(b,function(b){var c="level-group-"+b.node.levelDynamic;a[c]||(a[c]=a.chart.renderer.g(c).attr({zIndex:1E3-b.node.levelDynamic}).add(a.group));
-b.group=a[c]});l.column.prototype.drawPoints.call(this);this.colorAttribs&&k(this.points,function(a){a.graphic.css(this.colorAttribs(a))},this);a.options.allowDrillToNode&&k(b,function(b){b.graphic&&(b.drillId=a.options.interactByLeaf?a.drillToByLeaf(b):a.drillToByGroup(b))})},onClickDrillToNode:function(a){var b=(a=a.point)&&a.drillId;C(b)&&(a.setState(""),this.drillToNode(b))},drillToByGroup:function(a){var b=!1;1!==a.node.level-this.nodeMap[this.rootNode].level||a.node.isLeaf||(b=a.id);return b},
-drillToByLeaf:function(a){var b=!1;if(a.node.parent!==this.rootNode&&a.node.isLeaf)for(a=a.node;!b;)a=this.nodeMap[a.parent],a.parent===this.rootNode&&(b=a.id);return b},drillUp:function(){var a=this.nodeMap[this.rootNode];a&&C(a.parent)&&this.drillToNode(a.parent)},drillToNode:function(a,b){var c=this.nodeMap[a];this.idPreviousRoot=this.rootNode;this.rootNode=a;""===a?this.drillUpButton=this.drillUpButton.destroy():this.showDrillUpButton(c&&c.name||a);this.isDirty=!0;m(b,!0)&&this.chart.redraw()},
-showDrillUpButton:function(a){var b=this;a=a||"\x3c Back";var c=b.options.drillUpButton,f,d;c.text&&(a=c.text);this.drillUpButton?this.drillUpButton.attr({text:a}).align():(d=(f=c.theme)&&f.states,this.drillUpButton=this.chart.renderer.button(a,null,null,function(){b.drillUp()},f,d&&d.hover,d&&d.select).attr({align:c.position.align,zIndex:7}).add().align(c.position,!1,c.relativeTo||"plotBox"))},buildKDTree:q,drawLegendSymbol:b.LegendSymbolMixin.drawRectangle,getExtremes:function(){z.prototype.getExtremes.call(this,
-this.colorValueData);this.valueMin=this.dataMin;this.valueMax=this.dataMax;z.prototype.getExtremes.call(this)},getExtremesFromAll:!0,bindAxes:function(){var a={endOnTick:!1,gridLineWidth:0,lineWidth:0,min:0,dataMin:0,minPadding:0,max:100,dataMax:100,maxPadding:0,startOnTick:!1,title:null,tickPositions:[]};z.prototype.bindAxes.call(this);b.extend(this.yAxis.options,a);b.extend(this.xAxis.options,a)},utils:{recursive:F,reduce:H}},{getClassName:function(){var a=b.Point.prototype.getClassName.call(this),
-e=this.series,c=e.options;this.node.level<=e.nodeMap[e.rootNode].level?a+=" highcharts-above-level":this.node.isLeaf||m(c.interactByLeaf,!c.allowDrillToNode)?this.node.isLeaf||(a+=" highcharts-internal-node"):a+=" highcharts-internal-node-interactive";return a},isValid:function(){return this.id||w(this.value)},setState:function(a){b.Point.prototype.setState.call(this,a);this.graphic&&this.graphic.attr({zIndex:"hover"===a?1:0})},setVisible:l.pie.prototype.pointClass.prototype.setVisible})})(A,J);(function(b,
-t,f){var l=b.CenteredSeriesMixin,x=b.Series,u=b.each,r=b.extend,q=l.getCenter,k=f.getColor,v=l.getStartAndEndRadians,A=b.grep,w=b.isNumber,C=b.isObject,m=b.isString,z=b.merge,G=b.pick,K=180/Math.PI,l=b.seriesType,H=f.setTreeValues,F=b.reduce,a=function(a,b){var c=a.start,d=a.end-c,e=a.val,f=a.x,y=a.y,n=a.r,k=n+a.radius;return F(b||[],function(b,h){h={x:f,y:y,innerR:n,r:k,radius:a.radius,start:c,end:c+1/e*h.val*d};b.push(h);c=h.end;return b},[])},e=function d(b,c){var e=[];b=A(b.children,function(a){return a.visible});
-e=a(c,b);u(b,function(a,b){b=e[b];var c=b.start+(b.end-b.start)/2,h=b.innerR+(b.r-b.innerR)/2,c=0===b.innerR&&6.28<b.end-b.start?{x:b.x,y:b.y}:{x:b.x+Math.cos(c)*h,y:b.y+Math.sin(c)*h},h=a.val?a.childrenTotal>a.val?a.childrenTotal:a.val:a.childrenTotal;a.shapeArgs=z(b,{plotX:c.x,plotY:c.y});a.values=z(b,{val:h});a.children.length&&d(a,a.values)})},c=function(a,b){var c=b.mapIdToNode[a.parent],d=b.series,e=d.chart,f=d.points[a.i];b=k(a,{colors:e&&e.options&&e.options.colors,colorIndex:d.colorIndex,
-colorByPoint:d.colorByPoint,index:b.index,levelMap:b.levelMap,parentColor:c&&c.color,parentColorIndex:c&&c.colorIndex,series:b.series,siblings:b.siblings});a.color=b.color;a.colorIndex=b.colorIndex;f&&(f.color=a.color,f.colorIndex=a.colorIndex);return a};l("sunburst","treemap",{center:["50%","50%"],dataLabels:{defer:!0,style:{textOverflow:"ellipsis"},rotationMode:"perpendicular"},rootId:void 0,levelIsConstant:!0},{drawDataLabels:b.noop,drawPoints:function(){var a=this,b=a.levelMap,c=a.shapeRoot,e=
-a.group,f=a.hasRendered,k=a.rootNode,l=a.idPreviousRoot,q=a.nodeMap,m=q[l],v=m&&m.shapeArgs,m=a.points,t=a.startAndEndRadians,B=a.chart,B=B&&B.options&&B.options.chart||{},A="boolean"===typeof B.animation?B.animation:!0,B=a.center,F=B[0],G=B[1],I=B[3]/2,H=a.chart.renderer,M,J=!1,N=!1;if(B=!!(A&&f&&k!==l&&a.dataLabelsGroup))a.dataLabelsGroup.attr({opacity:0}),M=function(){J=!0;a.dataLabelsGroup&&a.dataLabelsGroup.animate({opacity:1,visibility:"visible"})};u(m,function(d){var h,p,g=d.node,m=b[g.levelDynamic];
-h=d.shapeExisting||{};var n=g.shapeArgs||{},u=a.pointAttribs(d,d.selected&&"select"),y,B=!(!g.visible||!g.shapeArgs);if(f&&A){var x={};p={end:n.end,start:n.start,innerR:n.innerR,r:n.r,x:F,y:G};B?!d.graphic&&v&&(x=k===d.id?{start:t.start,end:t.end}:v.end<=n.start?{start:t.end,end:t.end}:{start:t.start,end:t.start},x.innerR=x.r=I):d.graphic&&(l===d.id?p={innerR:I,r:I}:c&&(p=c.end<=h.start?{innerR:I,r:I,start:t.end,end:t.end}:{innerR:I,r:I,start:t.start,end:t.start}));h=x}else p=n,h={};var x=[n.plotX,
-n.plotY],E;d.node.isLeaf||(k===d.id?(E=q[k],E=E.parent):E=d.id);r(d,{shapeExisting:n,tooltipPos:x,drillId:E,name:""+(d.name||d.id||d.index),plotX:n.plotX,plotY:n.plotY,value:g.val,isNull:!B});x=d.options;E=a.options;g=C(n)?n:{};E=C(E)?E.dataLabels:{};x=C(x)?x.dataLabels:{};m=C(m)?m.dataLabels:{};m=z({rotationMode:"perpendicular",style:{width:g.radius}},E,m,x);w(m.rotation)||(g=g.end-(g.end-g.start)/2,g=g*K%180,"parallel"===m.rotationMode&&(g-=90),90<g&&(g-=180),m.rotation=g);0===m.rotation&&(m.rotation=
-.001);d.dlOptions=m;!N&&B&&(N=!0,y=M);d.draw({animate:p,attr:r(h,u),onComplete:y,group:e,renderer:H,shapeType:"arc",shapeArgs:n})});B&&N?(a.hasRendered=!1,a.options.dataLabels.defer=!0,x.prototype.drawDataLabels.call(a),a.hasRendered=!0,J&&M()):x.prototype.drawDataLabels.call(a)},pointAttribs:b.seriesTypes.column.prototype.pointAttribs,translate:function(){var a=this.options,b=this.center=q.call(this),f=this.startAndEndRadians=v(a.startAngle,a.endAngle),g=b[3]/2,k=b[2]/2,l=this.rootNode=G(this.rootNode,
-a.rootId,""),n=this.nodeMap,r,t=n&&n[l],u,w;this.shapeRoot=t&&t.shapeArgs;x.prototype.translate.call(this);this.levelMap=F(this.options.levels||[],function(a,b){a[b.level]=b;return a},{});w=this.tree=this.getTree();n=this.nodeMap;t=n[l];r=m(t.parent)?t.parent:"";u=n[r];H(w,{before:c,idRoot:l,levelIsConstant:a.levelIsConstant,levelMap:this.levelMap,mapIdToNode:n,points:this.points,series:this});a=n[""].shapeArgs={end:f.end,r:g,radius:(k-g)/(l===r?t.height:t.height+1),start:f.start,val:u.val,x:b[0],
-y:b[1]};e(u,a)},animate:function(a){var b=this.chart,c=[b.plotWidth/2,b.plotHeight/2],d=b.plotLeft,e=b.plotTop,b=this.group;a?(a={translateX:c[0]+d,translateY:c[1]+e,scaleX:.001,scaleY:.001,rotation:10,opacity:.01},b.attr(a)):(a={translateX:d,translateY:e,scaleX:1,scaleY:1,rotation:0,opacity:1},b.animate(a,this.options.animation),this.animate=null)}},{draw:t,shouldDraw:function(){return!this.isNull}})})(A,O,J)});
+(function(a){if(typeof module==='object'&&module.exports){module.exports=a;}else{a(Highcharts);}}(function(a){(function(a){var b=a.deg2rad,c=a.isNumber,d=a.pick,e=a.relativeLength;a.CenteredSeriesMixin={getCenter:function(){var c=this.options,i=this.chart,f=2*(c.slicedOffset||0),j,l=i.plotWidth-2*f,k=i.plotHeight-2*f,h=c.center,b=[d(h[0],'50%'),d(h[1],'50%'),c.size||'100%',c.innerSize||0],m=Math.min(l,k),a,g;for(a=0;a<4;++a){g=b[a];j=a<2||(a===2&&/%$/.test(g));b[a]=e(g,[l,k,m,b[2]][a])+(j?f:0);}if(b[3]>b[2]){b[3]=b[2];
+}return b;},getStartAndEndRadians:function h(f,a){var d=c(f)?f:0,g=((c(a)&&a>d&&(a-d)<360)?a:d+360),e=-90;return{start:b*(d+e),end:b*(g+e)};}};}(a));var c=(function(){var a=function l(a){var c=this,b=c.graphic,e=a.animate,f=a.attr,d=a.onComplete,g=a.css,h=a.group,i=a.renderer,j=a.shapeArgs,k=a.shapeType;if(c.shouldDraw()){if(!b){c.graphic=b=i[k](j).add(h);}b.css(g).attr(f).animate(e,undefined,d);}else if(b){b.animate(e,undefined,function(){c.graphic=b=b.destroy();if(typeof d==='function'){d();}});
+}};return a;}());var b=(function(a){var e=a.each,b=a.extend,d=function(a){return typeof a==='boolean';},g=function(a){return typeof a==='function';},c=a.pick;var f=function u(g,e){var o=e.index,p=e.levelMap,n=e.parentColor,q=e.parentColorIndex,h=e.series,l=e.colors,s=e.siblings,r=h.points,m,f,b,j,i,k;var t=function(d){var c=b&&b.colorVariation;if(c&&c.key==='brightness'){return a.color(d).brighten(o/s*c.to).get();}return d;};if(g){f=r[g.i];b=p[g.levelDynamic]||{};m=f&&(d(b.colorByPoint)?b.colorByPoint:!!h.options.colorByPoint);
+if(m){j=l[f.index%l.length];}i=c(f&&f.options.color,b&&b.color,j,n&&t(n),h.color);k=c(f&&f.options.colorIndex,b&&b.colorIndex,q,e.colorIndex);}return{color:i,colorIndex:k};};var h=function s(a,f){var j=f.before,l=f.idRoot,o=f.mapIdToNode,p=o[l],n=(d(f.levelIsConstant)?f.levelIsConstant:true),r=f.points,i=r[a.i],q=(i&&i.options)||{},h=0,k=[],m;b(a,{levelDynamic:a.level-(n?0:p.level),name:c(i&&i.name,''),visible:(l===a.id||(d(f.visible)?f.visible:false))});if(g(j)){a=j(a,f);}e(a.children,function(c,
+e){var d=b({},f);b(d,{index:e,siblings:a.children.length,visible:a.visible});c=s(c,d);k.push(c);if(c.visible){h+=c.val;}});a.visible=h>0||a.visible;m=c(q.value,h);b(a,{children:k,childrenTotal:h,isLeaf:a.visible&&!h,val:m});return a;};return{getColor:f,setTreeValues:h};}(a));(function(a,s){var t=a.seriesType,d=a.seriesTypes,m=a.map,f=a.merge,h=a.extend,n=a.noop,b=a.each,p=s.getColor,i=a.grep,q=a.isNumber,j=a.isString,c=a.pick,e=a.Series,u=a.stableSort,o=function(c,d,b){b=b||this;a.objectEach(c,function(e,
+a){d.call(b,e,a,c);});},l=a.reduce,g=function(d,c,a){var b;a=a||this;b=c.call(a,d);if(b!==false){g(b,c,a);}},k;function r(a,b){if(a===b){return a!==0||1/a===1/b;}return a!==a&&b!==b;}t('treemap','scatter',{showInLegend:false,marker:false,dataLabels:{enabled:true,defer:false,verticalAlign:'middle',formatter:function(){return this.point.name||this.point.id;},inside:true},tooltip:{headerFormat:'',pointFormat:'<b>{point.name}</b>: {point.value}<br/>'},ignoreHiddenPoint:true,layoutAlgorithm:'sliceAndDice',
+layoutStartingDirection:'vertical',alternateStartingDirection:false,levelIsConstant:true,drillUpButton:{position:{align:'right',x:-10,y:10}}},{pointArrayMap:['value'],axisTypes:d.heatmap?['xAxis','yAxis','colorAxis']:['xAxis','yAxis'],directTouch:true,optionalAxis:'colorAxis',getSymbol:n,parallelArrays:['x','y','value','colorValue'],colorKey:'colorValue',translateColors:(d.heatmap&&d.heatmap.prototype.translateColors),colorAttribs:(d.heatmap&&d.heatmap.prototype.colorAttribs),trackerGroups:['group',
+'dataLabelsGroup'],getListOfParents:function(e,f){var d=l(e||[],function(a,d,e){var b=c(d.parent,'');if(a[b]===undefined){a[b]=[];}a[b].push(e);return a;},{}),a={};b(f,function(b){if(j(b)){a['#'+b]=true;}});o(d,function(e,c,d){if(c!==''&&!a['#'+c]){b(e,function(a){d[''].push(a);});delete d[c];}});return d;},getTree:function(){var c=this,a=c.data,d=c.treeIndex,f=d&&d.ids.length===a.length,e,b;for(b=0;f&&b<a.length;b++){f=(a[b].id===d.ids[b]&&a[b].parent===d.parents[b]);}if(!f){e=m(a,function(a){return a.id;
+});d=c.treeIndex={ids:e,parents:m(a,function(a){return a.parent;}),listOfParents:c.getListOfParents(a,e)};c.childrenAreas={};}c.nodeMap=[];return c.buildNode('',-1,0,d.listOfParents,null);},init:function(c,d){var b=this;e.prototype.init.call(b,c,d);if(b.options.allowDrillToNode){a.addEvent(b,'click',b.onClickDrillToNode);}},buildNode:function(f,h,i,j,l){var c=this,g=[],k=c.points[h],e=0,a,d;b((j[f]||[]),function(a){d=c.buildNode(c.points[a].id,a,(i+1),j,f);e=Math.max(d.height+1,e);g.push(d);});a={id:f,
+i:h,children:g,height:e,level:i,parent:l,visible:false};c.nodeMap[a.id]=a;if(k){k.node=a;}return a;},setTreeValues:function(d){var e=this,j=e.options,k=e.rootNode,m=e.nodeMap,n=m[k],l=(typeof j.levelIsConstant==='boolean'?j.levelIsConstant:true),g=0,i=[],f,a=e.points[d.i];b(d.children,function(a){a=e.setTreeValues(a);i.push(a);if(!a.ignore){g+=a.val;}});u(i,function(a,b){return a.sortIndex-b.sortIndex;});f=c(a&&a.options.value,g);if(a){a.value=f;}h(d,{children:i,childrenTotal:g,ignore:!(c(a&&a.visible,
+true)&&(f>0)),isLeaf:d.visible&&!g,levelDynamic:(d.level-(l?0:n.level)),name:c(a&&a.name,''),sortIndex:c(a&&a.sortIndex,-f),val:f});return d;},calculateChildrenAreas:function(o,d){var e=this,t=e.options,j=this.levelMap[o.levelDynamic+1],n=c((e[j&&j.layoutAlgorithm]&&j.layoutAlgorithm),t.layoutAlgorithm),p=t.alternateStartingDirection,q=e.childrenAreas||(e.childrenAreas={}),a=q[o.i],s=[],l,g,m;l=i(o.children,function(a){return!a.ignore;});if(j&&j.layoutStartingDirection){d.direction=(j.layoutStartingDirection==='vertical'?0:1);
+}g=[n,p,e.axisRatio,d.x,d.y,d.width,d.height,d.direction,d.val];b(l,function(a){g.push(a.i,a.val,a.childrenTotal);});if(a&&a.inputs.length!==g.length){a=false;}for(m=0;a&&m<g.length;m++){if(!r(a.inputs[m],g[m])){a=false;}}if(!a){a={inputs:g,values:[],pointValues:[]};s=e[n](d,l);b(l,function(c,g){var b=s[g];a.values.push(f(b,{val:c.childrenTotal,direction:(p?1-d.direction:d.direction)}));a.pointValues.push(f(b,{x:(b.x/e.axisRatio),width:(b.width/e.axisRatio)}));});if(e[n]===k[n]){q[o.i]=a;}}b(l,function(b,
+c){b.values=h({},a.values[c]);b.pointValues=h({},a.pointValues[c]);if(b.children.length&&b.visible){e.calculateChildrenAreas(b,b.values);}});},setPointValues:function(){var a=this,c=a.xAxis,d=a.yAxis;b(a.points,function(a){var j=a.node,b=j.pointValues,f,g,h,i,e=0;if(b&&j.visible){f=Math.round(c.translate(b.x,0,0,0,1))-e;g=Math.round(c.translate(b.x+b.width,0,0,0,1))-e;h=Math.round(d.translate(b.y,0,0,0,1))-e;i=Math.round(d.translate(b.y+b.height,0,0,0,1))-e;a.shapeType='rect';a.shapeArgs={x:Math.min(f,
+g),y:Math.min(h,i),width:Math.abs(g-f),height:Math.abs(i-h)};a.plotX=(a.shapeArgs.x+(a.shapeArgs.width/2));a.plotY=(a.shapeArgs.y+(a.shapeArgs.height/2));}else{delete a.plotX;delete a.plotY;}});},setColorRecursive:function(d,j,g,i,k){var a=this,f=a&&a.chart,h=f&&f.options&&f.options.colors,c,e;if(d){c=p(d,{colors:h,index:i,levelMap:a.levelMap,parentColor:j,parentColorIndex:g,series:a,siblings:k});e=a.points[d.i];if(e){e.color=c.color;e.colorIndex=c.colorIndex;}b(d.children||[],function(b,e){a.setColorRecursive(b,
+c.color,c.colorIndex,e,d.children.length);});}},algorithmGroup:function(b,d,a,c){this.height=b;this.width=d;this.plot=c;this.direction=a;this.startDirection=a;this.total=0;this.nW=0;this.lW=0;this.nH=0;this.lH=0;this.elArr=[];this.lP={total:0,lH:0,nH:0,lW:0,nW:0,nR:0,lR:0,aspectRatio:function(b,a){return Math.max((b/a),(a/b));}};this.addElement=function(a){this.lP.total=this.elArr[this.elArr.length-1];this.total=this.total+a;if(this.direction===0){this.lW=this.nW;this.lP.lH=this.lP.total/this.lW;
+this.lP.lR=this.lP.aspectRatio(this.lW,this.lP.lH);this.nW=this.total/this.height;this.lP.nH=this.lP.total/this.nW;this.lP.nR=this.lP.aspectRatio(this.nW,this.lP.nH);}else{this.lH=this.nH;this.lP.lW=this.lP.total/this.lH;this.lP.lR=this.lP.aspectRatio(this.lP.lW,this.lH);this.nH=this.total/this.width;this.lP.nW=this.lP.total/this.nH;this.lP.nR=this.lP.aspectRatio(this.lP.nW,this.nH);}this.elArr.push(a);};this.reset=function(){this.nW=0;this.lW=0;this.elArr=[];this.total=0;};},algorithmCalcPoints:function(n,
+i,a,m){var j,k,e,d,g=a.lW,f=a.lH,c=a.plot,l,h=0,o=a.elArr.length-1;if(i){g=a.nW;f=a.nH;}else{l=a.elArr[a.elArr.length-1];}b(a.elArr,function(b){if(i||(h<o)){if(a.direction===0){j=c.x;k=c.y;e=g;d=b/e;}else{j=c.x;k=c.y;d=f;e=b/d;}m.push({x:j,y:k,width:e,height:d});if(a.direction===0){c.y=c.y+d;}else{c.x=c.x+e;}}h=h+1;});a.reset();if(a.direction===0){a.width=a.width-g;}else{a.height=a.height-f;}c.y=c.parent.y+(c.parent.height-a.height);c.x=c.parent.x+(c.parent.width-a.width);if(n){a.direction=1-a.direction;
+}if(!i){a.addElement(l);}},algorithmLowAspectRatio:function(h,a,g){var d=[],j=this,i,f={x:a.x,y:a.y,parent:a},k=a.direction,e=0,l=g.length-1,c=new this.algorithmGroup(a.height,a.width,k,f);b(g,function(b){i=b.val/a.val*a.height*a.width;c.addElement(i);if(c.lP.nR>c.lP.lR){j.algorithmCalcPoints(h,false,c,d,f);}if(e===l){j.algorithmCalcPoints(h,true,c,d,f);}e=e+1;});return d;},algorithmFill:function(o,a,n){var k=[],g,e=a.direction,i=a.x,j=a.y,h=a.width,f=a.height,l,m,d,c;b(n,function(b){g=b.val/a.val*a.height*a.width;
+l=i;m=j;if(e===0){c=f;d=g/c;h=h-d;i=i+d;}else{d=h;c=g/d;f=f-c;j=j+c;}k.push({x:l,y:m,width:d,height:c});if(o){e=1-e;}});return k;},strip:function(b,a){return this.algorithmLowAspectRatio(false,b,a);},squarified:function(b,a){return this.algorithmLowAspectRatio(true,b,a);},sliceAndDice:function(b,a){return this.algorithmFill(true,b,a);},stripes:function(b,a){return this.algorithmFill(false,b,a);},translate:function(){var a=this,i=a.rootNode=c(a.rootNode,a.options.rootId,''),h,k,m,j,d;e.prototype.translate.call(a);
+a.levelMap=l(a.options.levels||[],function(a,b){a[b.level]=b;return a;},{});j=a.tree=a.getTree();h=a.nodeMap[i];if(i!==''&&(!h||!h.children.length)){a.drillToNode('',false);i=a.rootNode;h=a.nodeMap[i];}g(a.nodeMap[a.rootNode],function(d){var c=false,b=d.parent;d.visible=true;if(b||b===''){c=a.nodeMap[b];}return c;});g(a.nodeMap[a.rootNode].children,function(c){var a=false;b(c,function(b){var c;b.visible=true;if(b.children.length){a=a||[];for(c=0;c<b.children.length;c++){a.push(b.children[c]);}}});
+return a;});a.setTreeValues(j);a.axisRatio=(a.xAxis.len/a.yAxis.len);a.nodeMap[''].pointValues=k={x:0,y:0,width:100,height:100};a.nodeMap[''].values=m=f(k,{width:(k.width*a.axisRatio),direction:(a.options.layoutStartingDirection==='vertical'?0:1),val:j.val});a.calculateChildrenAreas(j,m);if(a.colorAxis){a.translateColors();}else if(!a.options.colorByPoint){a.setColorRecursive(a.tree);}if(a.options.allowDrillToNode){d=h.pointValues;a.xAxis.setExtremes(d.x,d.x+d.width,false);a.yAxis.setExtremes(d.y,
+d.y+d.height,false);a.xAxis.setScale();a.yAxis.setScale();}a.setPointValues();},drawDataLabels:function(){var d=this,g=i(d.points,function(a){return a.node.visible;}),a,c;b(g,function(b){c=d.levelMap[b.node.levelDynamic];a={style:{}};if(!b.node.isLeaf){a.enabled=false;}if(c&&c.dataLabels){a=f(a,c.dataLabels);d._hasPointLabels=true;}if(b.shapeArgs){a.style.width=b.shapeArgs.width;if(b.dataLabel){b.dataLabel.css({width:b.shapeArgs.width+'px'});}}b.dlOptions=f(a,b.options.dataLabels);});e.prototype.drawDataLabels.call(this);
+},alignDataLabel:function(a){d.column.prototype.alignDataLabel.apply(this,arguments);if(a.dataLabel){a.dataLabel.attr({zIndex:(a.node.zIndex||0)+1});}},drawPoints:function(){var a=this,c=i(a.points,function(a){return a.node.visible;});b(c,function(c){var b='level-group-'+c.node.levelDynamic;if(!a[b]){a[b]=a.chart.renderer.g(b).attr({zIndex:1000-c.node.levelDynamic}).add(a.group);}c.group=a[b];});d.column.prototype.drawPoints.call(this);if(this.colorAttribs){b(this.points,function(a){a.graphic.css(this.colorAttribs(a));
+},this);}if(a.options.allowDrillToNode){b(c,function(b){if(b.graphic){b.drillId=a.options.interactByLeaf?a.drillToByLeaf(b):a.drillToByGroup(b);}});}},onClickDrillToNode:function(c){var d=this,a=c.point,b=a&&a.drillId;if(j(b)){a.setState('');d.drillToNode(b);}},drillToByGroup:function(a){var c=this,b=false;if((a.node.level-c.nodeMap[c.rootNode].level)===1&&!a.node.isLeaf){b=a.id;}return b;},drillToByLeaf:function(c){var d=this,b=false,a;if((c.node.parent!==d.rootNode)&&c.node.isLeaf){a=c.node;while(!b){a=d.nodeMap[a.parent];
+if(a.parent===d.rootNode){b=a.id;}}}return b;},drillUp:function(){var b=this,a=b.nodeMap[b.rootNode];if(a&&j(a.parent)){b.drillToNode(a.parent);}},drillToNode:function(b,f){var a=this,e=a.nodeMap,d=e[b];a.idPreviousRoot=a.rootNode;a.rootNode=b;if(b===''){a.drillUpButton=a.drillUpButton.destroy();}else{a.showDrillUpButton((d&&d.name||b));}this.isDirty=true;if(c(f,true)){this.chart.redraw();}},showDrillUpButton:function(f){var e=this,d=(f||'< Back'),a=e.options.drillUpButton,c,b;if(a.text){d=a.text;
+}if(!this.drillUpButton){c=a.theme;b=c&&c.states;this.drillUpButton=this.chart.renderer.button(d,null,null,function(){e.drillUp();},c,b&&b.hover,b&&b.select).attr({align:a.position.align,zIndex:7}).add().align(a.position,false,a.relativeTo||'plotBox');}else{this.drillUpButton.attr({text:d}).align();}},buildKDTree:n,drawLegendSymbol:a.LegendSymbolMixin.drawRectangle,getExtremes:function(){e.prototype.getExtremes.call(this,this.colorValueData);this.valueMin=this.dataMin;this.valueMax=this.dataMax;
+e.prototype.getExtremes.call(this);},getExtremesFromAll:true,bindAxes:function(){var b={endOnTick:false,gridLineWidth:0,lineWidth:0,min:0,dataMin:0,minPadding:0,max:100,dataMax:100,maxPadding:0,startOnTick:false,title:null,tickPositions:[]};e.prototype.bindAxes.call(this);a.extend(this.yAxis.options,b);a.extend(this.xAxis.options,b);},utils:{recursive:g,reduce:l}},{getClassName:function(){var b=a.Point.prototype.getClassName.call(this),d=this.series,e=d.options;if(this.node.level<=d.nodeMap[d.rootNode].level){b+=' highcharts-above-level';
+}else if(!this.node.isLeaf&&!c(e.interactByLeaf,!e.allowDrillToNode)){b+=' highcharts-internal-node-interactive';}else if(!this.node.isLeaf){b+=' highcharts-internal-node';}return b;},isValid:function(){return this.id||q(this.value);},setState:function(b){a.Point.prototype.setState.call(this,b);if(this.graphic){this.graphic.attr({zIndex:b==='hover'?1:0});}},setVisible:d.pie.prototype.pointClass.prototype.setVisible});k={};b(['sliceAndDice','stripes','squarified','strip'],function(a){k[a]=d.treemap.prototype[a];
+});}(a,b));(function(a,j,h){var e=a.CenteredSeriesMixin,c=a.Series,f=a.each,g=a.extend,k=e.getCenter,l=h.getColor,m=e.getStartAndEndRadians,n=a.grep,o=a.isNumber,b=a.isObject,p=a.isString,d=a.merge,r=a.pick,s=180/Math.PI,t=a.seriesType,w=h.setTreeValues,i=a.reduce;var q=function k(a,d){var b=a.start,f=a.end-b,g=a.val,h=a.x,j=a.y,c=a.r,e=c+a.radius;return i(d||[],function(d,k){var l=(1/g)*k.val,m=l*f,i={x:h,y:j,innerR:c,r:e,radius:a.radius,start:b,end:b+m};d.push(i);b=i.end;return d;},[]);};var v=function g(c,
+e){var b=[],a=n(c.children,function(a){return a.visible;});b=q(e,a);f(a,function(c,i){var a=b[i],e=a.start+((a.end-a.start)/2),h=a.innerR+((a.r-a.innerR)/2),j=(a.innerR===0&&(a.end-a.start)>6.28),f=j?{x:a.x,y:a.y}:{x:a.x+Math.cos(e)*h,y:a.y+Math.sin(e)*h},k=(c.val?(c.childrenTotal>c.val?c.childrenTotal:c.val):c.childrenTotal);c.shapeArgs=d(a,{plotX:f.x,plotY:f.y});c.values=d(a,{val:k});if(c.children.length){g(c,c.values);}});};var u=function h(a,b){var c=b.mapIdToNode[a.parent],d=b.series,e=d.chart,
+f=d.points[a.i],g=l(a,{colors:e&&e.options&&e.options.colors,colorIndex:d.colorIndex,colorByPoint:d.colorByPoint,index:b.index,levelMap:b.levelMap,parentColor:c&&c.color,parentColorIndex:c&&c.colorIndex,series:b.series,siblings:b.siblings});a.color=g.color;a.colorIndex=g.colorIndex;if(f){f.color=a.color;f.colorIndex=a.colorIndex;}return a;};var x={center:['50%','50%'],dataLabels:{defer:true,style:{textOverflow:'ellipsis'},rotationMode:'perpendicular'},rootId:undefined,levelIsConstant:true};var z={drawDataLabels:a.noop,
+drawPoints:function F(){var a=this,C=a.levelMap,y=a.shapeRoot,B=a.group,t=a.hasRendered,i=a.rootNode,m=a.idPreviousRoot,u=a.nodeMap,v=u[m],x=(v&&v.shapeArgs),D=a.points,e=a.startAndEndRadians,l=a.chart,w=(l&&l.options&&l.options.chart)||{},q=(typeof w.animation==='boolean'?w.animation:true),n=a.center,z=n[0],A=n[1],h=n[3]/2,E=a.chart.renderer,k,p=false,j=false,r=!!(q&&t&&i!==m&&a.dataLabelsGroup);if(r){a.dataLabelsGroup.attr({opacity:0});k=function(){var b=a;p=true;if(b.dataLabelsGroup){b.dataLabelsGroup.animate({opacity:1,
+visibility:'visible'});}};}f(D,function(f){var r=f.node,H=C[r.levelDynamic],L=f.shapeExisting||{},c=r.shapeArgs||{},K=a.pointAttribs(f,f.selected&&'select'),I,F=!!(r.visible&&r.shapeArgs),n,D,G,v,w,J,l,p;if(t&&q){n={};D={end:c.end,start:c.start,innerR:c.innerR,r:c.r,x:z,y:A};if(F){if(!f.graphic&&x){if(i===f.id){n={start:e.start,end:e.end};}else{n=(x.end<=c.start)?{start:e.end,end:e.end}:{start:e.start,end:e.start};}n.innerR=n.r=h;}}else if(f.graphic){if(m===f.id){D={innerR:h,r:h};}else if(y){D=(y.end<=L.start)?{innerR:h,
+r:h,start:e.end,end:e.end}:{innerR:h,r:h,start:e.start,end:e.start};}}}else{D=c;n={};}if(!f.node.isLeaf){G=i===f.id?u[i].parent:f.id;}g(f,{shapeExisting:c,tooltipPos:[c.plotX,c.plotY],drillId:G,name:''+(f.name||f.id||f.index),plotX:c.plotX,plotY:c.plotY,value:r.val,isNull:!F});v=f.options;w=a.options;c=b(c)?c:{};w=b(w)?w.dataLabels:{};v=b(v)?v.dataLabels:{};J=b(H)?H.dataLabels:{};l=d({rotationMode:'perpendicular',style:{width:c.radius}},w,J,v);if(!o(l.rotation)){p=c.end-(c.end-c.start)/2;p=(p*s)%180;
+if(l.rotationMode==='parallel'){p-=90;}if(p>90){p-=180;}l.rotation=p;}if(l.rotation===0){l.rotation=0.001;}f.dlOptions=l;if(!j&&F){j=true;I=k;}f.draw({animate:D,attr:g(n,K),onComplete:I,group:B,renderer:E,shapeType:'arc',shapeArgs:c});});if(r&&j){a.hasRendered=false;a.options.dataLabels.defer=true;c.prototype.drawDataLabels.call(a);a.hasRendered=true;if(p){k();}}else{c.prototype.drawDataLabels.call(a);}},pointAttribs:a.seriesTypes.column.prototype.pointAttribs,translate:function x(){var a=this,f=a.options,
+g=a.center=k.call(a),n=a.startAndEndRadians=m(f.startAngle,f.endAngle),l=g[3]/2,t=g[2]/2,e=a.rootNode=r(a.rootNode,f.rootId,''),b=a.nodeMap,h,d=b&&b[e],j,o,q,s;a.shapeRoot=d&&d.shapeArgs;c.prototype.translate.call(a);a.levelMap=i(a.options.levels||[],function(a,b){a[b.level]=b;return a;},{});q=a.tree=a.getTree();b=a.nodeMap;d=b[e];h=p(d.parent)?d.parent:'';j=b[h];w(q,{before:u,idRoot:e,levelIsConstant:f.levelIsConstant,levelMap:a.levelMap,mapIdToNode:b,points:a.points,series:a});o=(t-l)/(e===h?d.height:d.height+1);
+s=b[''].shapeArgs={end:n.end,r:l,radius:o,start:n.start,val:j.val,x:g[0],y:g[1]};v(j,s);},animate:function(g){var b=this.chart,c=[b.plotWidth/2,b.plotHeight/2],e=b.plotLeft,f=b.plotTop,a,d=this.group;if(g){a={translateX:c[0]+e,translateY:c[1]+f,scaleX:0.001,scaleY:0.001,rotation:10,opacity:0.01};d.attr(a);}else{a={translateX:e,translateY:f,scaleX:1,scaleY:1,rotation:0,opacity:1};d.animate(a,this.options.animation);this.animate=null;}}};var y={draw:j,shouldDraw:function b(){var a=this;return!a.isNull;
+}};t('sunburst','treemap',x,z,y);}(a,c,b));}));
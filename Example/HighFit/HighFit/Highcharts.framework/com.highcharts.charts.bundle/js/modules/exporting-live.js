@@ -0,0 +1,15 @@
+/*
+ Highcharts JS v6.0.2 (2017-10-20)
+ Live exporting module
+
+ (c) 2009-2017 Highsoft AS
+
+ License: www.highcharts.com/license
+*/
+(function(a){if(typeof module==='object'&&module.exports){module.exports=a;}else{a(Highcharts);}}(function(a){(function(a){var b=a.each,h=a.merge,i=a.objectEach,d=a.pick,c=a.Chart;var g=['highcharts-tracker-line','highcharts-tracker-area','highcharts-halo','highcharts-crosshair'];function e(a,b){return(' '+a+' ').indexOf(' '+b+' ')!==-1;}function f(b){var c=false;if(b===undefined||b===null){return false;}if(typeof b!=='object'||a.isArray(b)){return true;}i(b,function(a){c=c||f(a);});return c;}c.prototype.getLiveExportSize=function(m){var k=this.options,
+g=k.exporting||{},l=h(m),e=l.chart||{},c=l.exporting||{},j=this.renderTo.style,i={};if(g.liveSVG===false||g.allowHTML||a.grep(this.series,function(a){return a.options.isInternal;}).length){return;}i.width=d(c.sourceWidth,g.sourceWidth)||d(e.width,k.chart.width)||(/px$/.test(j.width)&&parseInt(j.width,10))||600;i.height=d(c.sourceHeight,g.sourceHeight)||d(e.height,k.chart.height)||(/px$/.test(j.height)&&parseInt(j.height,10))||400;i.borderRadius=e.borderRadius;b(['width','height','borderRadius'],
+function(a){delete e[a];});delete c.sourceWidth;delete c.sourceHeight;delete c.enabled;return f(l)?undefined:i;};c.prototype.detachInteractiveElements=function(i){var c=this,d=[],j=[],k=[].concat(c.exportSVGElements||[],c.exportDivElements||[],[c.resetZoomButton,c.drillUpButton,c.tooltip&&c.tooltip.label]),f=c.chartBackground&&c.chartBackground.element,h;b(k,function(a){var b=a&&(a.element||a);if(b&&b.parentNode){d.push(b);}});b(c.container.getElementsByTagName('*'),function(b){var c=b.getAttribute&&b.getAttribute('class');
+if(!c){return;}if(a.grep(g,function(a){return e(c,a);}).length){d.push(b);}else if(e(c,'highcharts-tracker')){if(b.nodeName==='path'){d.push(b);}else{j.push({node:b,className:c});}}});d=a.map(d,function(a){return{node:a,parent:a.parentNode,next:a.nextSibling};});b(d,function(a){if(a.node.parentNode){a.parent.removeChild(a.node);}});b(j,function(a){a.node.setAttribute('class',a.className.replace(/ highcharts-tracker(?= |$)/,' '));});if(f&&i!==undefined){h=[f.getAttribute('rx'),f.getAttribute('ry')];
+f.setAttribute('rx',i);f.setAttribute('ry',i);}return function(){var c=d.length,a;b(j,function(a){a.node.setAttribute('class',a.className);});while(c--){a=d[c];a.parent.insertBefore(a.node,a.next&&a.next.parentNode===a.parent?a.next:null);}if(h){b(['rx','ry'],function(b,a){if(h[a]===null){f.removeAttribute(b);}else{f.setAttribute(b,h[a]);}});}};};c.prototype.getLiveSVG=function(e,d,i){var a=this,c=a.options.chart,f=e!==a.chartWidth||d!==a.chartHeight,b,g,h;if(f){b={width:a.chartWidth,height:a.chartHeight,
+optionsWidth:c.width,optionsHeight:c.height,hasUserSize:a.hasUserSize};a.setSize(e,d,false);}g=a.detachInteractiveElements(i);h=a.sanitizeSVG(a.getChartHTML(),{exporting:a.options.exporting,chart:{width:e,height:d}});g();if(f){a.setSize(b.width,b.height,false);c.width=b.optionsWidth;c.height=b.optionsHeight;a.hasUserSize=b.hasUserSize;}return h;};a.wrap(c.prototype,'getSVG',function(c,b){var a=this.getLiveExportSize(b);return a?this.getLiveSVG(a.width,a.height,a.borderRadius):c.call(this,b);});}(a));
+}));
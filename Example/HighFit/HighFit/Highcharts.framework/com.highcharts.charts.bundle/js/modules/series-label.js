@@ -5,16 +5,28 @@
 
  License: www.highcharts.com/license
 */
-(function(t){"object"===typeof module&&module.exports?module.exports=t:t(Highcharts)})(function(t){(function(n){function t(d,b,a,m,c,e){d=(e-b)*(a-d)-(m-b)*(c-d);return 0<d?!0:0>d?!1:!0}function v(d,b,a,m,c,e,f,h){return t(d,b,c,e,f,h)!==t(a,m,c,e,f,h)&&t(d,b,a,m,c,e)!==t(d,b,a,m,f,h)}function B(d,b,a,m,c,e,f,h){return v(d,b,d+a,b,c,e,f,h)||v(d+a,b,d+a,b+m,c,e,f,h)||v(d,b+m,d+a,b+m,c,e,f,h)||v(d,b,d,b+m,c,e,f,h)}function C(d){var b=this,a=Math.max(n.animObject(b.renderer.globalAnimation).duration,
-250),m=!b.hasRendered;d.apply(b,[].slice.call(arguments,1));b.labelSeries=[];b.labelSeriesMaxSum=0;clearTimeout(b.seriesLabelTimer);w(b.series,function(c){var e=c.options.label,d=c.labelBySeries,h=d&&d.closest;e.enabled&&c.visible&&(c.graph||c.area)&&!c.isSeriesBoosting&&(b.labelSeries.push(c),e.minFontSize&&e.maxFontSize&&(c.sum=n.reduce(c.yData,function(a,b){return(a||0)+(b||0)},0),b.labelSeriesMaxSum=Math.max(b.labelSeriesMaxSum,c.sum)),m&&(a=Math.max(a,n.animObject(c.options.animation).duration)),
-h&&(void 0!==h[0].plotX?d.animate({x:h[0].plotX+h[1],y:h[0].plotY+h[2]}):d.attr({opacity:0})))});b.seriesLabelTimer=n.syncTimeout(function(){b.drawSeriesLabels()},b.renderer.forExport?0:a)}var D=n.wrap,w=n.each,E=n.extend,y=n.isNumber,x=n.pick,z=n.Series,F=n.SVGRenderer,A=n.Chart;n.setOptions({plotOptions:{series:{label:{enabled:!0,connectorAllowed:!0,connectorNeighbourDistance:24,minFontSize:null,maxFontSize:null,onArea:null,style:{fontWeight:"bold"},boxesToAvoid:[]}}}});F.prototype.symbols.connector=
-function(d,b,a,m,c){var e=c&&c.anchorX;c=c&&c.anchorY;var f,h,g=a/2;y(e)&&y(c)&&(f=["M",e,c],h=b-c,0>h&&(h=-m-h),h<a&&(g=e<d+a/2?h:a-h),c>b+m?f.push("L",d+g,b+m):c<b?f.push("L",d+g,b):e<d?f.push("L",d,b+m/2):e>d+a&&f.push("L",d+a,b+m/2));return f||[]};z.prototype.getPointsOnGraph=function(){if(this.xAxis||this.yAxis){var d=this.points,b,a,m=[],c,e,f,h;e=this.graph||this.area;f=e.element;var g=this.chart.inverted,q=this.xAxis;b=this.yAxis;var r=g?b.pos:q.pos,g=g?q.pos:b.pos,q=x(this.options.label.onArea,
-!!this.area),u=b.getThreshold(this.options.threshold);if(this.getPointSpline&&f.getPointAtLength&&!q){e.toD&&(a=e.attr("d"),e.attr({d:e.toD}));h=f.getTotalLength();for(c=0;c<h;c+=16)b=f.getPointAtLength(c),m.push({chartX:r+b.x,chartY:g+b.y,plotX:b.x,plotY:b.y});a&&e.attr({d:a});b=d[d.length-1];b.chartX=r+b.plotX;b.chartY=g+b.plotY;m.push(b)}else for(h=d.length,c=0;c<h;c+=1){b=d[c];a=d[c-1];b.chartX=r+b.plotX;b.chartY=g+b.plotY;q&&(b.chartCenterY=g+(b.plotY+x(b.yBottom,u))/2);if(0<c&&(e=Math.abs(b.chartX-
-a.chartX),f=Math.abs(b.chartY-a.chartY),e=Math.max(e,f),16<e))for(e=Math.ceil(e/16),f=1;f<e;f+=1)m.push({chartX:a.chartX+f/e*(b.chartX-a.chartX),chartY:a.chartY+f/e*(b.chartY-a.chartY),chartCenterY:a.chartCenterY+f/e*(b.chartCenterY-a.chartCenterY),plotX:a.plotX+f/e*(b.plotX-a.plotX),plotY:a.plotY+f/e*(b.plotY-a.plotY)});y(b.plotY)&&m.push(b)}return m}};z.prototype.labelFontSize=function(d,b){return d+this.sum/this.chart.labelSeriesMaxSum*(b-d)+"px"};z.prototype.checkClearPoint=function(d,b,a,m){var c=
-Number.MAX_VALUE,e=Number.MAX_VALUE,f,h,g=this.options.label.connectorAllowed,q=x(this.options.label.onArea,!!this.area),r=this.chart,u,k,n,t,p,l;for(p=0;p<r.boxesToAvoid.length;p+=1)if(k=r.boxesToAvoid[p],l=d+a.width,u=b,n=b+a.height,!(d>k.right||l<k.left||u>k.bottom||n<k.top))return!1;for(p=0;p<r.series.length;p+=1)if(u=r.series[p],k=u.interpolatedPoints,u.visible&&k){for(l=1;l<k.length;l+=1){if(k[l].chartX>=d-16&&k[l-1].chartX<=d+a.width+16){if(B(d,b,a.width,a.height,k[l-1].chartX,k[l-1].chartY,
-k[l].chartX,k[l].chartY))return!1;this===u&&!f&&m&&(f=B(d-16,b-16,a.width+32,a.height+32,k[l-1].chartX,k[l-1].chartY,k[l].chartX,k[l].chartY))}!g&&!f||this===u&&!q||(n=d+a.width/2-k[l].chartX,t=b+a.height/2-k[l].chartY,c=Math.min(c,n*n+t*t))}if(!q&&g&&this===u&&(m&&!f||c<Math.pow(this.options.label.connectorNeighbourDistance,2))){for(l=1;l<k.length;l+=1)f=Math.min(Math.pow(d+a.width/2-k[l].chartX,2)+Math.pow(b+a.height/2-k[l].chartY,2),Math.pow(d-k[l].chartX,2)+Math.pow(b-k[l].chartY,2),Math.pow(d+
-a.width-k[l].chartX,2)+Math.pow(b-k[l].chartY,2),Math.pow(d+a.width-k[l].chartX,2)+Math.pow(b+a.height-k[l].chartY,2),Math.pow(d-k[l].chartX,2)+Math.pow(b+a.height-k[l].chartY,2)),f<e&&(e=f,h=k[l]);f=!0}}return!m||f?{x:d,y:b,weight:c-(h?e:0),connectorPoint:h}:!1};A.prototype.drawSeriesLabels=function(){var d=this,b=this.labelSeries;d.boxesToAvoid=[];w(b,function(a){a.interpolatedPoints=a.getPointsOnGraph();w(a.options.label.boxesToAvoid||[],function(a){d.boxesToAvoid.push(a)})});w(d.series,function(a){function b(a,
-b,c){return a>n&&a<=n+t-c.width&&b>=k&&b<=k+v-c.height}if(a.xAxis||a.yAxis){var c,e,f,h=[],g,q;c=a.options.label;var r=d.inverted,n=r?a.yAxis.pos:a.xAxis.pos,k=r?a.xAxis.pos:a.yAxis.pos,t=d.inverted?a.yAxis.len:a.xAxis.len,v=d.inverted?a.xAxis.len:a.yAxis.len,p=a.interpolatedPoints,l=x(c.onArea,!!a.area),r=a.labelBySeries;e=c.minFontSize;c=c.maxFontSize;if(a.visible&&!a.isSeriesBoosting&&p){r||(a.labelBySeries=r=d.renderer.label(a.name,0,-9999,"connector").css(E({color:l?d.renderer.getContrast(a.color):
-a.color},a.options.label.style)),e&&c&&r.css({fontSize:a.labelFontSize(e,c)}),r.attr({padding:0,opacity:d.renderer.forExport?1:0,stroke:a.color,"stroke-width":1,zIndex:3}).add(a.group).animate({opacity:1},{duration:200}));c=r.getBBox();c.width=Math.round(c.width);for(q=p.length-1;0<q;--q)l?(e=p[q].chartX-c.width/2,f=p[q].chartCenterY-c.height/2):(e=p[q].chartX+3,f=p[q].chartY-c.height-3,b(e,f,c)&&(g=a.checkClearPoint(e,f,c)),g&&h.push(g),e=p[q].chartX+3,f=p[q].chartY+3,b(e,f,c)&&(g=a.checkClearPoint(e,
-f,c)),g&&h.push(g),e=p[q].chartX-c.width-3,f=p[q].chartY+3,b(e,f,c)&&(g=a.checkClearPoint(e,f,c)),g&&h.push(g),e=p[q].chartX-c.width-3,f=p[q].chartY-c.height-3),b(e,f,c)&&(g=a.checkClearPoint(e,f,c)),g&&h.push(g);if(!h.length&&!l)for(e=n+t-c.width;e>=n;e-=16)for(f=k;f<k+v-c.height;f+=16)(g=a.checkClearPoint(e,f,c,!0))&&h.push(g);if(h.length){if(h.sort(function(a,b){return b.weight-a.weight}),g=h[0],d.boxesToAvoid.push({left:g.x,right:g.x+c.width,top:g.y,bottom:g.y+c.height}),h=Math.sqrt(Math.pow(Math.abs(g.x-
-r.x),2),Math.pow(Math.abs(g.y-r.y),2)))p={opacity:d.renderer.forExport?1:0,x:g.x-n,y:g.y-k},l={opacity:1},10>=h&&(l={x:p.x,y:p.y},p={}),a.labelBySeries.attr(E(p,{anchorX:g.connectorPoint&&g.connectorPoint.plotX,anchorY:g.connectorPoint&&g.connectorPoint.plotY})).animate(l),a.options.kdNow=!0,a.buildKDTree(),a=a.searchPoint({chartX:g.x,chartY:g.y},!0),r.closest=[a,g.x-n-a.plotX,g.y-k-a.plotY]}else r&&(a.labelBySeries=r.destroy())}}})};D(A.prototype,"render",C);D(A.prototype,"redraw",C)})(t)});
+(function(a){if(typeof module==='object'&&module.exports){module.exports=a;}else{a(Highcharts);}}(function(a){(function(a){var d=3,t=a.wrap,b=a.each,p=a.extend,s=a.inArray,l=a.isNumber,e=a.pick,g=a.Series,u=a.SVGRenderer,k=a.Chart;var c=16;a.setOptions({plotOptions:{series:{label:{enabled:true,connectorAllowed:true,connectorNeighbourDistance:24,minFontSize:null,maxFontSize:null,onArea:null,style:{fontWeight:'bold'},boxesToAvoid:[]}}}});function i(b,c,d,f,e,g){var a=((g-c)*(d-b))-((f-c)*(e-b));return a>0?true:a<0?false:true;
+}function j(a,e,b,f,c,g,d,h){return i(a,e,c,g,d,h)!==i(b,f,c,g,d,h)&&i(a,e,b,f,c,g)!==i(a,e,b,f,d,h);}function h(a,b,d,c,e,g,f,h){return(j(a,b,a+d,b,e,g,f,h)||j(a+d,b,a+d,b+c,e,g,f,h)||j(a,b+c,a+d,b+c,e,g,f,h)||j(a,b,a,b+c,e,g,f,h));}function n(h,i,a,f,g){var c=h-f,d=h+a.width-f,e=i-g,b=i+a.height-g,j=h+a.width/2-f,k=i+a.height/2-g;return Math.min(j*j+k*k,c*c+e*e,d*d+e*e,d*d+b*b,c*c+b*b);}var q=new Float64Array(1),r=new Uint32Array(q.buffer);function f(a,c){var b;for(b=0;b<c.length;b++){q[0]=c[b];
+a=Math.imul(a^r[0],16777619);a=Math.imul(a^r[1],16777619);}return a;}function m(i){var a=this,d=Infinity,e=Infinity,g=-Infinity,h=-Infinity,f=true;a.counts=[];b(i.series,function(j,i){var c=j.interpolatedPoints;a.counts[i]=0;if(j.visible&&c){a.counts[i]=Math.max(c.length-1,0);b(c,function(c){var a=c.chartX,b=c.chartY;if(!isFinite(a)||!isFinite(b)){f=false;}d=Math.min(d,a);e=Math.min(e,b);g=Math.max(g,a);h=Math.max(h,b);});}});a.valid=f;if(!f){return;}a.x=d===Infinity?0:d;a.y=e===Infinity?0:e;a.columns=Math.max(1,
+Math.ceil((g-a.x)/c)+1);a.rows=Math.max(1,Math.ceil((h-a.y)/c)+1);a.segmentCells=[];a.pointCells=[];a.seriesPointCells=[];a.stamp=0;a.countsBefore=[0];b(a.counts,function(c,b){a.countsBefore[b+1]=a.countsBefore[b]+c;});b(i.series,function(g,e){var d=g.interpolatedPoints,f=a.seriesPointCells[e]=[],c,b;if(!g.visible||!d){return;}for(c=1;c<d.length;c++){b={series:e,x1:d[c-1].chartX,y1:d[c-1].chartY,x2:d[c].chartX,y2:d[c].chartY,stamp:0};a.eachCell(Math.min(b.x1,b.x2),Math.min(b.y1,b.y2),Math.max(b.x1,
+b.x2),Math.max(b.y1,b.y2),function(c){(a.segmentCells[c]||(a.segmentCells[c]=[])).push(b);});a.eachCell(b.x2,b.y2,b.x2,b.y2,function(g){var h={series:e,index:c,x:b.x2,y:b.y2,point:d[c]};(a.pointCells[g]||(a.pointCells[g]=[])).push(h);(f[g]||(f[g]=[])).push(h);});}});}m.prototype={column:function(a){return Math.min(this.columns-1,Math.max(0,Math.floor((a-this.x)/c)));},row:function(a){return Math.min(this.rows-1,Math.max(0,Math.floor((a-this.y)/c)));},eachCell:function(g,i,h,j,e){var c=this.column(g),
+d=this.column(h),f=this.row(j),b=this.row(i),a;for(;b<=f;b++){for(a=c;a<=d;a++){e(b*this.columns+a);}}},eachSegment:function(e,g,f,h,d){var a=this,b=++a.stamp,c=false;a.eachCell(e,g,f,h,function(g){var f=a.segmentCells[g],e;for(e=0;f&&!c&&e<f.length;e++){if(f[e].stamp!==b){f[e].stamp=b;c=d(f[e]);}}});},eachNearPoint:function(p,l,n,m,o,r,q){var b=this,g=b.column(l),h=b.column(m),i=b.row(n),j=b.row(o),t=Math.max(b.columns,b.rows),s=Math.min(l-b.x-g*c,b.x+(h+1)*c-m,n-b.y-i*c,b.y+(j+1)*c-o)-1,a,k,f=function(d,
+e){var a,c;if(d>=0&&d<b.columns&&e>=0&&e<b.rows){a=p[e*b.columns+d];for(c=0;a&&c<a.length;c++){r(a[c]);}}},d,e;for(a=0;a<=t;a++){k=a?Math.max(0,s+(a-1)*c):0;if(q(k*k)){return;}if(a===0){for(e=i;e<=j;e++){for(d=g;d<=h;d++){f(d,e);}}}else{for(d=g-a;d<=h+a;d++){f(d,i-a);f(d,j+a);}for(e=i-a+1;e<=j+a-1;e++){f(g-a,e);f(h+a,e);}}}},checkClearPoint:function(t,c,f,a,p){var d=this,w=t.chart,y=t.options.label,x=y.connectorAllowed,z=e(y.onArea,!!t.area),j=s(t,w.series),D=j===-1?0:d.counts[j],F=j>0&&d.countsBefore[j]>0,
+C=d.countsBefore[d.counts.length]-d.countsBefore[j+1]>0,i=16,l=false,E=false,g=[Number.MAX_VALUE,Number.MAX_VALUE,Number.MAX_VALUE],B,o=Number.MAX_VALUE,q,A,u=c+a.width/2,v=f+a.height/2,k,m,r;if(!x&&z&&p){return;}for(r=0;r<w.boxesToAvoid.length;r+=1){m=w.boxesToAvoid[r];if(!(c>m.right||c+a.width<m.left||f>m.bottom||f+a.height<m.top)){return false;}}d.eachSegment(c-i-1,f-i-1,c+a.width+i+1,f+a.height+i+1,function(b){if(b.x2>=c-i&&b.x1<=c+a.width+i){if(h(c,f,a.width,a.height,b.x1,b.y1,b.x2,b.y2)){E=true;
+return true;}if(b.series===j&&!l&&p){l=h(c-i,f-i,a.width+2*i,a.height+2*i,b.x1,b.y1,b.x2,b.y2);}}return false;});if(E){return false;}k=x?[F,z&&D>0,C]:[false,false,l&&C];if(k[0]||k[1]||k[2]){d.eachNearPoint(d.pointCells,u,v,u,v,function(a){var c=a.series<j?0:a.series===j?1:2,d,e,b;if(k[c]){d=u-a.x;e=v-a.y;b=d*d+e*e;if(b<g[c]){g[c]=b;}}},function(a){return(!k[0]||a>g[0])&&(!k[1]||a>g[1])&&(!k[2]||a>g[2]);});}B=Math.min(g[0],g[1],g[2]);b(g,function(a){if(a!==Number.MAX_VALUE){d.reach=Math.max(d.reach,
+Math.sqrt(a));}});if(!z&&x&&D>0&&((p&&!l)||g[0]<Math.pow(y.connectorNeighbourDistance,2))){d.eachNearPoint(d.seriesPointCells[j],c,f,c+a.width,f+a.height,function(b){var d=n(c,f,a,b.x,b.y);if(d<o||(d===o&&q&&b.index<A)){o=d;q=b.point;A=b.index;}},function(a){return a>o;});l=true;}return!p||l?{x:c,y:f,weight:B-(q?o:0),connectorPoint:q}:false;},placementKey:function(j,k,l,c){var g=this,o=j.chart,p=j.options.label,w=j.interpolatedPoints,v=s(j,o.series),t=[],q=Infinity,u=Infinity,r=-Infinity,n=-Infinity,
+x=++g.stamp,i=0,a=2166136261,h,m;a=f(a,[k.width,k.height,l.left,l.top,l.width,l.height,o.inverted?1:0,e(p.onArea,!!j.area)?1:0,p.connectorAllowed?1:0,p.connectorNeighbourDistance,v,w.length]);b(g.counts,function(b){a=f(a,[b?1:0]);});c+=k.width+k.height+d+16;b(w,function(b){var i=g.row(b.chartY-c),j=g.row(b.chartY+c),d;a=f(a,[b.chartX,b.chartY,e(b.chartCenterY,0)]);q=Math.min(q,b.chartX-c);u=Math.min(u,b.chartY-c);r=Math.max(r,b.chartX+c);n=Math.max(n,b.chartY+c);for(h=g.column(b.chartX-c);h<=g.column(b.chartX+c);
+h++){d=t[h];if(d){d[0]=Math.min(d[0],i);d[1]=Math.max(d[1],j);}else{t[h]=[i,j];}}});b(t,function(c,d){var a,b;for(m=c?c[0]:0;c&&m<=c[1];m++){a=g.segmentCells[m*g.columns+d];for(b=0;a&&b<a.length;b++){if(a[b].series!==v&&a[b].stamp!==x){a[b].stamp=x;i=(i+f(2166136261,[a[b].series,a[b].x1,a[b].y1,a[b].x2,a[b].y2]))|0;}}}});b(o.boxesToAvoid,function(a){if(!(a.left>r||a.right<q||a.top>n||a.bottom<u)){i=(i+f(2166136261,[a.left,a.right,a.top,a.bottom]))|0;}});a=f(a,[i]);return a;}};u.prototype.symbols.connector=function(a,
+b,e,h,i){var f=i&&i.anchorX,g=i&&i.anchorY,d,c,j=e/2;if(l(f)&&l(g)){d=['M',f,g];c=b-g;if(c<0){c=-h-c;}if(c<e){j=f<a+(e/2)?c:e-c;}if(g>b+h){d.push('L',a+j,b+h);}else if(g<b){d.push('L',a+j,b);}else if(f<a){d.push('L',a,b+h/2);}else if(f>a+e){d.push('L',a+e,b+h/2);}}return d||[];};g.prototype.getPointsOnGraph=function(){if(!this.xAxis&&!this.yAxis){return;}var o=16,i=this.points,a,b,h=[],c,s,t,n,j,f,d,m,g=this.graph||this.area,p=g.element,u=this.chart.inverted,w=this.xAxis,r=this.yAxis,q=u?r.pos:w.pos,
+k=u?w.pos:r.pos,v=e(this.options.label.onArea,!!this.area),x=r.getThreshold(this.options.threshold);if(this.getPointSpline&&p.getPointAtLength&&!v){if(g.toD){m=g.attr('d');g.attr({d:g.toD});}j=p.getTotalLength();for(c=0;c<j;c+=o){a=p.getPointAtLength(c);h.push({chartX:q+a.x,chartY:k+a.y,plotX:a.x,plotY:a.y});}if(m){g.attr({d:m});}a=i[i.length-1];a.chartX=q+a.plotX;a.chartY=k+a.plotY;h.push(a);}else{j=i.length;for(c=0;c<j;c+=1){a=i[c];b=i[c-1];a.chartX=q+a.plotX;a.chartY=k+a.plotY;if(v){a.chartCenterY=k+(a.plotY+e(a.yBottom,
+x))/2;}if(c>0){s=Math.abs(a.chartX-b.chartX);t=Math.abs(a.chartY-b.chartY);n=Math.max(s,t);if(n>o){f=Math.ceil(n/o);for(d=1;d<f;d+=1){h.push({chartX:b.chartX+d/f*(a.chartX-b.chartX),chartY:b.chartY+d/f*(a.chartY-b.chartY),chartCenterY:b.chartCenterY+d/f*(a.chartCenterY-b.chartCenterY),plotX:b.plotX+d/f*(a.plotX-b.plotX),plotY:b.plotY+d/f*(a.plotY-b.plotY)});}}}if(l(a.plotY)){h.push(a);}}}return h;};g.prototype.labelFontSize=function(a,b){return a+(this.sum/this.chart.labelSeriesMaxSum*(b-a))+'px';
+};g.prototype.checkClearPoint=function(e,f,a,b){var c=this.chart.seriesLabelGrid,d=c&&c.checkClearPoint(this,e,f,a,b);return d===undefined?this.checkClearPointOnGraphs(e,f,a,b):d;};g.prototype.checkClearPointOnGraphs=function(d,g,c,o){var m=Number.MAX_VALUE,r=Number.MAX_VALUE,q,p,u=this.options.label.connectorAllowed,v=e(this.options.label.onArea,!!this.area),l=this.chart,j,b,i=16,k,s,t,f,a;function w(a,b){return!(b.left>a.right||b.right<a.left||b.top>a.bottom||b.bottom<a.top);}for(f=0;f<l.boxesToAvoid.length;
+f+=1){if(w(l.boxesToAvoid[f],{left:d,right:d+c.width,top:g,bottom:g+c.height})){return false;}}for(f=0;f<l.series.length;f+=1){j=l.series[f];b=j.interpolatedPoints;if(j.visible&&b){for(a=1;a<b.length;a+=1){if(b[a].chartX>=d-i&&b[a-1].chartX<=d+c.width+i){if(h(d,g,c.width,c.height,b[a-1].chartX,b[a-1].chartY,b[a].chartX,b[a].chartY)){return false;}if(this===j&&!k&&o){k=h(d-i,g-i,c.width+2*i,c.height+2*i,b[a-1].chartX,b[a-1].chartY,b[a].chartX,b[a].chartY);}}if((u||k)&&(this!==j||v)){s=d+c.width/2-b[a].chartX;
+t=g+c.height/2-b[a].chartY;m=Math.min(m,s*s+t*t);}}if(!v&&u&&this===j&&((o&&!k)||m<Math.pow(this.options.label.connectorNeighbourDistance,2))){for(a=1;a<b.length;a+=1){q=n(d,g,c,b[a].chartX,b[a].chartY);if(q<r){r=q;p=b[a];}}k=true;}}}return!o||k?{x:d,y:g,weight:m-(p?r:0),connectorPoint:p}:false;};k.prototype.drawSeriesLabels=function(){var a=this,c=this.labelSeries;a.boxesToAvoid=[];b(c,function(c){c.interpolatedPoints=c.getPointsOnGraph();b(c.options.label.boxesToAvoid||[],function(b){a.boxesToAvoid.push(b);
+});});a.seriesLabelGrid=new m(a);if(!a.seriesLabelGrid.valid){a.seriesLabelGrid=undefined;}b(a.series,function(b){if(!b.xAxis&&!b.yAxis){return;}var f,g,h,m=[],v,i,c,x=b.options.label,B=a.inverted,n=B?b.yAxis.pos:b.xAxis.pos,o=B?b.xAxis.pos:b.yAxis.pos,A=a.inverted?b.yAxis.len:b.xAxis.len,z=a.inverted?b.xAxis.len:b.yAxis.len,k=b.interpolatedPoints,y=e(x.onArea,!!b.area),j=b.labelBySeries,D=x.minFontSize,C=x.maxFontSize,s=b.labelPlacement,l=a.seriesLabelGrid,E={left:n,top:o,width:A,height:z},w,q,
+u,t;function r(b,c,a){return b>n&&b<=n+A-a.width&&c>=o&&c<=o+z-a.height;}if(b.visible&&!b.isSeriesBoosting&&k){if(!j){b.labelBySeries=j=a.renderer.label(b.name,0,-9999,'connector').css(p({color:y?a.renderer.getContrast(b.color):b.color},b.options.label.style));if(D&&C){j.css({fontSize:b.labelFontSize(D,C)});}j.attr({padding:0,opacity:a.renderer.forExport?1:0,stroke:b.color,'stroke-width':1,zIndex:3}).add(b.group).animate({opacity:1},{duration:200});}f=j.getBBox();f.width=Math.round(f.width);if(l&&s&&s.label===j&&s.key===l.placementKey(b,
+f,E,s.reach)){a.boxesToAvoid.push(s.box);return;}b.labelPlacement=undefined;if(l){l.reach=0;}for(i=k.length-1;i>0;i-=1){if(y){g=k[i].chartX-f.width/2;h=k[i].chartCenterY-f.height/2;if(r(g,h,f)){c=b.checkClearPoint(g,h,f);}if(c){m.push(c);}}else{g=k[i].chartX+d;h=k[i].chartY-f.height-d;if(r(g,h,f)){c=b.checkClearPoint(g,h,f);}if(c){m.push(c);}g=k[i].chartX+d;h=k[i].chartY+d;if(r(g,h,f)){c=b.checkClearPoint(g,h,f);}if(c){m.push(c);}g=k[i].chartX-f.width-d;h=k[i].chartY+d;if(r(g,h,f)){c=b.checkClearPoint(g,
+h,f);}if(c){m.push(c);}g=k[i].chartX-f.width-d;h=k[i].chartY-f.height-d;if(r(g,h,f)){c=b.checkClearPoint(g,h,f);}if(c){m.push(c);}}}if(!m.length&&!y){if(l){l.reach=Infinity;}for(g=n+A-f.width;g>=n;g-=16){for(h=o;h<o+z-f.height;h+=16){v=b.checkClearPoint(g,h,f,true);if(v){m.push(v);}}}}if(m.length){m.sort(function(a,b){return b.weight-a.weight;});c=m[0];if(l){b.labelPlacement={key:l.placementKey(b,f,E,l.reach),reach:l.reach,label:j};}a.boxesToAvoid.push({left:c.x,right:c.x+f.width,top:c.y,bottom:c.y+f.height});
+if(b.labelPlacement){b.labelPlacement.box=a.boxesToAvoid[a.boxesToAvoid.length-1];}w=Math.sqrt(Math.pow(Math.abs(c.x-j.x),2),Math.pow(Math.abs(c.y-j.y),2));if(w){q={opacity:a.renderer.forExport?1:0,x:c.x-n,y:c.y-o};u={opacity:1};if(w<=10){u={x:q.x,y:q.y};q={};}b.labelBySeries.attr(p(q,{anchorX:c.connectorPoint&&c.connectorPoint.plotX,anchorY:c.connectorPoint&&c.connectorPoint.plotY})).animate(u);b.options.kdNow=true;b.buildKDTree();t=b.searchPoint({chartX:c.x,chartY:c.y},true);j.closest=[t,c.x-n-t.plotX,
+c.y-o-t.plotY];}}else if(j){b.labelBySeries=j.destroy();}}});a.seriesLabelGrid=undefined;};function o(f){var c=this,d=Math.max(a.animObject(c.renderer.globalAnimation).duration,250),e=!c.hasRendered;f.apply(c,[].slice.call(arguments,1));c.labelSeries=[];c.labelSeriesMaxSum=0;clearTimeout(c.seriesLabelTimer);b(c.series,function(b){var h=b.options.label,g=b.labelBySeries,f=g&&g.closest;if(h.enabled&&b.visible&&(b.graph||b.area)&&!b.isSeriesBoosting){c.labelSeries.push(b);if(h.minFontSize&&h.maxFontSize){b.sum=a.reduce(b.yData,
+function(b,a){return(b||0)+(a||0);},0);c.labelSeriesMaxSum=Math.max(c.labelSeriesMaxSum,b.sum);}if(e){d=Math.max(d,a.animObject(b.options.animation).duration);}if(f){if(f[0].plotX!==undefined){g.animate({x:f[0].plotX+f[1],y:f[0].plotY+f[2]});}else{g.attr({opacity:0});}}}});c.seriesLabelTimer=a.syncTimeout(function(){c.drawSeriesLabels();},c.renderer.forExport?0:d);}t(k.prototype,'render',o);t(k.prototype,'redraw',o);}(a));}));
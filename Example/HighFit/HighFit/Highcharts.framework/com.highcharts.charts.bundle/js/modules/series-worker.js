@@ -0,0 +1,25 @@
+/*
+ Highcharts JS v6.0.2 (2017-10-20)
+ Series worker module
+
+ (c) 2009-2017 Highsoft AS
+
+ License: www.highcharts.com/license
+*/
+(function(a){if(typeof module==='object'&&module.exports){module.exports=a;}else{a(Highcharts);}}(function(a){(function(c){var d=c.win,a=c.each,m=c.objectEach,f=c.pick,g=c.wrap,p=c.Chart,e=c.Series,b;c.setOptions({plotOptions:{series:{workerThreshold:50000}}});function t(){var a={};function e(a){return parseFloat(a.toPrecision(14));}function g(d,e){var a=0,c=d.length,b;while(a<c){b=(a+c)>>>1;if(d[b]<e){a=b+1;}else{c=b;}}return a;}function j(d,e){var a=0,c=d.length,b;while(a<c){b=(a+c)>>>1;if(d[b]<=e){a=b+1;
+}else{c=b;}}return a;}function f(b){var m=a[b.id],d=m.xData,e=d.length,f=0,c=e,l=false,i,k,h;if(b.canCrop&&(!b.cropThreshold||e>b.cropThreshold)){if(d[e-1]<b.min||d[0]>b.max){f=c=0;l=true;}else if(d[0]<b.min||d[e-1]>b.max){f=g(d,b.min);c=j(d,b.max);if(f<e){f=Math.max(0,f-b.cropShoulder);if(c<e){c=c+b.cropShoulder;}}else{f=e;}l=true;}}c=Math.min(c,e);for(h=c-1;h>f;h--){k=d[h]-d[h-1];if(k>0&&(i===undefined||k<i)){i=k;}}return{id:b.id,start:f,end:c,cropped:l,closestPointRange:i};}function c(d,n,m,l,
+k){var h=a[d.id].xData,j=d.start,i=d.end,f=Infinity,e=-Infinity,b,g,c;for(b=j;b<i;b++){c=n[b-m];g=h[b];if(c===c&&(d.cropped||((b+1<i?h[b+1]:g)>=l&&(b>j?h[b-1]:g)<=k))){if(c<f){f=c;}if(c>e){e=c;}}}d.dataMin=f===Infinity?undefined:f;d.dataMax=e===-Infinity?undefined:e;}function h(g,c){var f={},e={},d={};b(c.order,function(m){var h=g[m],n=a[m],o=n.xData,p=n.yData,l=new Float64Array(h.end-h.start),b,k,i,j;for(b=h.start;b<h.end;b++){k=o[b];i=p[b];j=c.negStacks&&i<c.threshold?e:f;if(i===i){j[k]=(j[k]||0)+i;
+l[b-h.start]=j[k];}else{l[b-h.start]=NaN;}}d[m]=l;});return d;}function b(b,c){for(var a=0;a<b.length;a++){c(b[a],a);}}function d(e,a,d){var b=1,c=0;if(d){b=-1;c=a.len;}if(a.reversed){b*=-1;c-=b*a.len;}return b*(e-a.min)*a.transA+c+b*a.minPixelPadding;}function i(b){var h=a[b.id],k=h.xData,l=h.yData,g=b.end-b.start,i=new Float64Array(g),j=new Float64Array(g),c,f;for(c=0;c<g;c++){i[c]=e(Math.min(Math.max(-1e5,d(k[b.start+c],b.xAxis)),1e5));f=l[b.start+c];j[c]=f===f?Math.min(Math.max(-1e5,d(f,b.yAxis,
+true)),1e5):NaN;}return{id:b.id,key:b.key,plotX:i,plotY:j};}self.onmessage=function(k){var d=k.data,e={},g=[],j=[];if(d.type==='setData'){a[d.id]={xData:d.xData,yData:d.yData};}else if(d.type==='remove'){delete a[d.id];}else if(d.type==='crop'){b(d.items,function(b){if(a[b.id]){e[b.id]=f(b);g.push(e[b.id]);}});b(d.stacks,function(a){var d=h(e,a);b(a.order,function(b){e[b].stacked=true;c(e[b],d[b],e[b].start,a.min,a.max);});});b(d.items,function(b){var d=e[b.id];if(d&&!d.stacked){c(d,a[b.id].yData,
+0,b.min,b.max);}});self.postMessage({jobId:d.jobId,results:g});}else if(d.type==='translate'){b(d.items,function(c){var b;if(a[c.id]){b=i(c);g.push(b);j.push(b.plotX.buffer,b.plotY.buffer);}});self.postMessage({jobId:d.jobId,results:g},j);}};}function i(){var a,c;if(b===undefined){b=false;if(d.Worker&&d.Blob&&d.URL&&d.Float64Array){try{a=new d.Blob(['('+t.toString()+')();'],{type:'application/javascript'});c=d.URL.createObjectURL(a);b={worker:new d.Worker(c),callbacks:{},jobId:0,seriesId:0};b.worker.onmessage=function(a){var c=b.callbacks[a.data.jobId];
+delete b.callbacks[a.data.jobId];if(c){c(a.data.results);}};}catch(a){b=false;}}}return b;}function n(a,d,c){var b=i();a.jobId=++b.jobId;b.callbacks[a.jobId]=c;b.worker.postMessage(a,d||[]);}function h(a){return{min:a.min,transA:a.transA,minPixelPadding:a.minPixelPadding,reversed:!!a.reversed,len:a.len};}function o(a,b){return a&&b&&a.min===b.min&&a.transA===b.transA&&a.minPixelPadding===b.minPixelPadding&&a.reversed===b.reversed&&a.len===b.len;}e.prototype.useWorker=function(){var a=this,b=a.xAxis,
+c=a.yAxis,d=a.options.workerThreshold;return!!(d&&a.isCartesian&&a.sorted&&!a.pointArrayMap&&!a.hasGroupedData&&!a.getExtremesFromAll&&!a.options.getExtremesFromAll&&!a.options.pointPlacement&&!a.options.startFromThreshold&&a.options.stacking!=='percent'&&!(a.isSeriesBoosting)&&b&&c&&!b.isLog&&!b.isOrdinal&&!b.isBroken&&!c.isLog&&!c.isBroken&&a.xData&&a.xData.length>=d&&i());};e.prototype.uploadWorkerData=function(){var a=this,e=a.xData,j=a.yData,c=e.length,f,g,b,h;if(!a.isDirtyData&&a.workerXData===e&&a.workerDataLength===c){return;
+}f=new d.Float64Array(c);g=new d.Float64Array(c);for(b=0;b<c;b++){f[b]=e[b];h=j[b];g[b]=typeof h==='number'?h:NaN;}if(a.workerId===undefined){a.workerId='series-'+(++i().seriesId);}i().worker.postMessage({type:'setData',id:a.workerId,xData:f,yData:g},[f.buffer,g.buffer]);a.workerXData=e;a.workerDataLength=c;a.workerVersion=(a.workerVersion||0)+1;delete a.workerCrop;delete a.workerTranslation;};function k(a){return{min:f(a.userMin,a.options.min,-Infinity),max:f(a.userMax,a.options.max,Infinity)};
+}function j(b,a){return[b.workerVersion,a.min,a.max].join(',');}function q(a){return a.isDirtyData||a.workerXData!==a.xData||a.workerDataLength!==a.xData.length||!a.workerCrop||a.workerCrop.key!==j(a,k(a.xAxis))||a.workerCrop.stackMembers!==a.workerStackMembers;}function l(a){return a.yAxis.index+':'+a.type+f(a.options.stack,'');}function r(i,h,g){var d=[],e={},b=[],c={};a(h,function(a){var g=k(a.xAxis),i=a.options,h;a.uploadWorkerData();c[a.workerId]=a;a.workerPendingKey=j(a,g);d.push({id:a.workerId,
+min:g.min,max:g.max,canCrop:true,cropThreshold:i.cropThreshold,cropShoulder:f(a.cropShoulder,1)});if(i.stacking&&a.visible){h=e[l(a)];if(!h){h=e[l(a)]={order:[],min:g.min,max:g.max,threshold:f(i.threshold,0),negStacks:!!a.negStacks,reversed:f(a.yAxis.options.reversedStacks,true)};b.push(h);}h.order.push(a.workerId);}});a(b,function(a){if(a.reversed){a.order.reverse();}});n({type:'crop',items:d,stacks:b},null,function(b){a(b,function(b){var a=c[b.id];if(a&&a.workerXData){b.key=a.workerPendingKey;
+b.stackMembers=a.workerStackMembers;a.workerCrop=b;}});g();});}function s(e,d){var b=[],c={};a(e,function(a){var d=a.workerCrop;if(d&&!a.options.stacking){c[a.workerId]=a;b.push({id:a.workerId,key:d.key,start:d.start,end:d.end,xAxis:h(a.xAxis),yAxis:h(a.yAxis)});}});if(!b.length){return d();}n({type:'translate',items:b},null,function(e){a(e,function(a,d){var e=c[a.id];if(e){a.xAxis=b[d].xAxis;a.yAxis=b[d].yAxis;e.workerTranslation=a;}});d();});}g(e.prototype,'processData',function(g,f){var a=this,
+b=a.workerCrop,e=a.xAxis,c,d;if(b&&a.useWorker()&&a.workerXData===a.xData&&a.workerDataLength===a.xData.length){if(!a.isDirty&&!e.isDirty&&!a.yAxis.isDirty&&!f){return false;}d=e.getExtremes();c=k(e);if(b.key===j(a,c)&&(!b.cropped||(d.min===c.min&&d.max===c.max))){a.cropped=b.cropped;a.cropStart=b.start;a.processedXData=b.cropped?a.xData.slice(b.start,b.end):a.xData;a.processedYData=b.cropped?a.yData.slice(b.start,b.end):a.yData;a.closestPointRange=b.closestPointRange;a.workerCropApplied=b;return;
+}}a.workerCropApplied=null;return g.call(a,f);});g(e.prototype,'getExtremes',function(c,b){var a=this.workerCropApplied;if(!b&&a&&a.stacked===!!(this.options.stacking&&this.visible)){this.dataMin=a.dataMin;this.dataMax=a.dataMax;return;}return c.call(this,b);});g(e.prototype,'translate',function(p){var b=this,f=b.workerTranslation,m=b.workerCropApplied,l=b.xAxis,n=b.yAxis,g=l.categories,q=b.options.threshold,k,a,c,e,j,i=Number.MAX_VALUE,d;if(!f||!m||f.key!==m.key||b.options.stacking||b.modifyValue||!o(f.xAxis,
+h(l))||!o(f.yAxis,h(n))){return p.call(b);}b.generatePoints();k=b.points;for(d=0;d<k.length;d++){a=k[d];c=f.plotX[d];e=f.plotY[d];a.plotX=c;a.yBottom=null;a.plotY=e===e?e:undefined;a.isInside=a.plotY!==undefined&&e>=0&&e<=n.len&&c>=0&&c<=l.len;a.clientX=c;a.negative=a.y<(q||0);a.category=g&&g[a.x]!==undefined?g[a.x]:a.x;if(!a.isNull){if(j!==undefined){i=Math.min(i,Math.abs(c-j));}j=c;}a.zone=b.zones.length&&a.getZone();}b.closestPointRangePx=i;});g(e.prototype,'destroy',function(a){if(this.workerId!==undefined&&b){b.worker.postMessage({type:'remove',
+id:this.workerId});}return a.apply(this,Array.prototype.slice.call(arguments,1));});g(p.prototype,'redraw',function(h,g){var b=this,f={},e={},d=[];if(b.workerRedrawing||!b.hasRendered){return h.call(b,g);}a(b.series,function(a){var b;a.workerStackMembers=undefined;if(a.visible&&a.options.stacking){b=l(a);(f[b]=f[b]||[]).push(a);}});m(f,function(b){var d=c.map(b,function(a){return a.index;}).join(',');a(b,function(a){a.workerStackMembers=d;});});a(b.series,function(a){if(a.visible&&a.useWorker()&&q(a)){e[a.index]=true;
+}});m(f,function(d){var c=false,b=true;a(d,function(a){c=c||e[a.index];b=b&&a.useWorker();});if(c){a(d,function(a){e[a.index]=b;if(!b){delete a.workerCrop;delete a.workerTranslation;}});}});a(b.series,function(a){if(e[a.index]){d.push(a);}});if(!d.length){return h.call(b,g);}b.workerRedrawing=true;r(b,d,function(){if(!b.series){return;}a(b.axes,function(a){a.setScale();});s(d,function(){if(!b.series){return;}try{h.call(b,g);}finally{b.workerRedrawing=false;}});});});}(a));}));
@@ -0,0 +1,427 @@
+/*
+ Highcharts JS v6.0.2 (2017-10-20)
+ Incremental data module
+
+ (c) 2009-2017 Highsoft AS
+
+ License: www.highcharts.com/license
+*/
+/**
+ * (c) 2009-2017 Highsoft AS
+ *
+ * License: www.highcharts.com/license
+ *
+ * Incremental data module. Adds rows to, or replaces rows of, a chart built
+ * by the data module without running it over the whole table again. Only
+ * the new cells are parsed, using the column types found when the chart was
+ * created, and the points are merged into the existing series with a single
+ * redraw. Edits the cached types cannot describe, like a category appearing
+ * in a datetime x column, fall back to parsing the full table once.
+ *
+ * Requires the data module.
+ */
+(function (factory) {
+    if (typeof module === 'object' && module.exports) {
+        module.exports = factory;
+    } else {
+        factory(Highcharts);
+    }
+}(function (Highcharts) {
+    (function (H) {
+        var each = H.each,
+            inArray = H.inArray,
+            isNumber = H.isNumber,
+            map = H.map,
+            merge = H.merge,
+            pick = H.pick,
+            splat = H.splat,
+            Chart = H.Chart;
+
+        /**
+         * The point layout of each series, in series order. Series from
+         * seriesMapping reuse the readers of the data module, the others take
+         * the x column and the next free columns the way Data.complete hands
+         * them out.
+         */
+        function getSeriesLayouts(data) {
+            var valueCount = data.valueCount,
+                columns = data.columns,
+                layouts = [],
+                freeIndexes,
+                readers,
+                index,
+                i;
+
+            function isComplete(readers) {
+                var complete = true;
+                each(readers, function (reader) {
+                    if (reader.columnIndex === undefined) {
+                        complete = false;
+                    }
+                });
+                return complete;
+            }
+
+            function addLayout(readers) {
+                var pointIsArray = true;
+                each(readers, function (reader) {
+                    if (
+                        reader.configName !== 'x' &&
+                        reader.configName !== 'y' &&
+                        reader.configName !== undefined
+                    ) {
+                        pointIsArray = false;
+                    }
+                });
+                layouts.push({
+                    pointIsArray: pointIsArray,
+                    readers: readers
+                });
+            }
+
+            each(valueCount.seriesBuilders, function (builder) {
+                if (isComplete(builder.readers)) {
+                    addLayout(map(builder.readers, function (reader) {
+                        return {
+                            columnIndex: reader.columnIndex,
+                            configName: reader.configName
+                        };
+                    }));
+                }
+            });
+
+            // The mapped builders have taken their columns, what is left was
+            // free when the dynamic series were built
+            freeIndexes = data.getFreeIndexes(
+                columns.length,
+                valueCount.seriesBuilders
+            );
+            while (freeIndexes.length > 0) {
+                readers = [{ columnIndex: 0, configName: 'x' }];
+                index = inArray(0, freeIndexes);
+                if (index !== -1) {
+                    freeIndexes.splice(index, 1);
+                }
+                for (i = 0; i < valueCount.global; i++) {
+                    readers.push({
+                        columnIndex: freeIndexes.shift(),
+                        configName: valueCount.globalPointArrayMap[i]
+                    });
+                }
+                if (isComplete(readers)) {
+                    addLayout(readers);
+                }
+            }
+            return layouts;
+        }
+
+        /**
+         * Reads what the first parse learned about the table: the type of
+         * every column, the x axis type and the series layouts.
+         */
+        function getState(data) {
+            var chartOptions = data.chartOptions,
+                columnTypes = data.options.columnTypes || [],
+                categoryAxis = !!(
+                    chartOptions &&
+                    chartOptions.xAxis &&
+                    splat(chartOptions.xAxis)[0].type === 'category'
+                ),
+                state = data.incremental,
+                layouts,
+                xColumn;
+
+            if (state) {
+                return state;
+            }
+
+            layouts = getSeriesLayouts(data);
+            xColumn = layouts.length && layouts[0].readers.length &&
+                data.columns[layouts[0].readers[0].columnIndex];
+
+            state = data.incremental = {
+                layouts: layouts,
+                xAxisType: xColumn && (
+                    xColumn.isDatetime ? 'datetime' :
+                        (!xColumn.isNumeric ? 'category' : undefined)
+                ),
+                columns: map(data.columns, function (column, i) {
+                    var isX = inArray(i, data.valueCount.xColumns) !== -1;
+                    return {
+                        isX: isX,
+                        type: columnTypes[i],
+                        isCategory: isX && (
+                            categoryAxis || columnTypes[i] === 'string'
+                        ),
+                        isDatetime: !!column.isDatetime,
+                        isNumeric: !!column.isNumeric,
+                        mixed: !!column.mixed
+                    };
+                })
+            };
+
+            if (state.xAxisType === 'category') {
+                each(layouts, function (layout) {
+                    each(layout.readers, function (reader) {
+                        if (reader.configName === 'x') {
+                            reader.configName = 'name';
+                        }
+                    });
+                });
+            }
+            return state;
+        }
+
+        /**
+         * Parses one cell like Data.parseColumn, with the type already known.
+         * Returns false when the cell would change the type of its column,
+         * which the series built so far do not account for.
+         */
+        function parseCell(data, column, cell, result) {
+            var trimmed = data.trim(cell),
+                numeric = data.trim(cell, true),
+                value = parseFloat(numeric),
+                isDatetime = false,
+                isNumeric = false;
+
+            if (column.isCategory) {
+                result.value = '' + trimmed;
+                return true;
+            }
+            // Mixed x columns keep the raw cells, and a new cell may decide
+            // whether the column is still mixed
+            if (column.isX && column.mixed) {
+                result.value = trimmed;
+                return false;
+            }
+
+            if (+numeric === value) {
+                if (value > 31536E6 && column.type !== 'float') {
+                    isDatetime = true;
+                } else {
+                    isNumeric = true;
+                }
+            } else if (column.isX && column.type !== 'float') {
+                value = data.parseDate(cell);
+                if (isNumber(value)) {
+                    isDatetime = true;
+                }
+            }
+
+            if (isDatetime || isNumeric) {
+                result.value = value;
+                // A new kind of value in an x column can change the axis type
+                return !column.isX ||
+                    (isDatetime ? column.isDatetime : column.isNumeric);
+            }
+
+            result.value = trimmed === '' ? null : trimmed;
+            return !column.isX || result.value === null || (
+                !column.isDatetime && !column.isNumeric
+            );
+        }
+
+        /**
+         * Parses rows into the typed and raw columns. Returns the row index
+         * range the cells went into, or false if the table must be parsed
+         * again.
+         */
+        function parseRows(data, state, rows, start) {
+            var columns = data.columns,
+                rawColumns = data.rawColumns,
+                rawOffset = data.firstRowAsNames ? 1 : 0,
+                result = {},
+                valid = true;
+
+            each(rows, function (row, i) {
+                var rowIndex = start + i;
+                each(columns, function (column, j) {
+                    var cell = row[j];
+                    if (!parseCell(data, state.columns[j], cell, result)) {
+                        valid = false;
+                    }
+                    column[rowIndex] = result.value;
+                    // Mixed columns are their own raw column
+                    if (rawColumns[j] && rawColumns[j] !== column) {
+                        rawColumns[j][rowIndex + rawOffset] = data.trim(cell);
+                    }
+                });
+            });
+            return valid;
+        }
+
+        /**
+         * Builds the point options of one series for a table row, like
+         * SeriesBuilder.read.
+         */
+        function readPoint(layout, columns, rowIndex) {
+            var point = layout.pointIsArray ? [] : {};
+            each(layout.readers, function (reader) {
+                var value = columns[reader.columnIndex][rowIndex];
+                if (layout.pointIsArray) {
+                    point.push(value);
+                } else {
+                    point[reader.configName] = value;
+                }
+            });
+            return point;
+        }
+
+        /**
+         * Runs the data module over the whole table, used when an edit does
+         * not fit the cached column types. The raw cells are kept up to date
+         * by the incremental path, so they are what the table holds now.
+         */
+        function reparse(data, redraw) {
+            var chart = data.chart,
+                rawColumns = map(data.rawColumns, function (column, i) {
+                    // A mixed column lost its name with the parsed ones
+                    return column === data.columns[i] && data.firstRowAsNames ?
+                        [column.name].concat(column) :
+                        column.slice();
+                }),
+                options = merge(data.options, {
+                    csv: null,
+                    rows: null,
+                    table: null,
+                    googleSpreadsheetKey: null,
+                    switchRowsAndColumns: false,
+                    dateFormat: data.options.dateFormat || data.dateFormat
+                });
+
+            options.columns = rawColumns;
+            options.afterComplete = function (dataOptions) {
+                chart.update(dataOptions, redraw);
+            };
+            chart.data = H.data(options, data.chartOptions);
+            chart.data.chart = chart;
+        }
+
+        /**
+         * Puts parsed rows into the series, adding points past the end and
+         * updating the others.
+         */
+        function mergeRows(chart, state, start, count) {
+            var columns = chart.data.columns;
+
+            each(state.layouts, function (layout, i) {
+                var series = chart.series[i],
+                    data,
+                    rowIndex,
+                    point,
+                    pointOptions,
+                    replaceAll = false;
+
+                if (!series) {
+                    return;
+                }
+                data = series.options.data || [];
+
+                for (rowIndex = start; rowIndex < start + count; rowIndex++) {
+                    pointOptions = readPoint(layout, columns, rowIndex);
+                    if (rowIndex >= data.length) {
+                        series.addPoint(pointOptions, false, false, false);
+                    } else {
+                        point = series.data[rowIndex];
+                        if (point && point.update) {
+                            point.update(pointOptions, false, false);
+                        } else {
+                            // Points outside the cropped range only exist
+                            // as options
+                            data[rowIndex] = pointOptions;
+                            replaceAll = true;
+                        }
+                    }
+                }
+                if (replaceAll) {
+                    series.setData(data.slice(), false, false, false);
+                }
+            });
+        }
+
+        /**
+         * Converts cells given in the layout of data.rows or data.columns
+         * into table rows, following switchRowsAndColumns.
+         */
+        function toTableRows(data, cells, asColumns) {
+            if (!!asColumns === !data.options.switchRowsAndColumns) {
+                return data.rowsToColumns(cells) || [];
+            }
+            return cells;
+        }
+
+        function editRows(chart, cells, asColumns, start, redraw, animation) {
+            var data = chart.data,
+                state,
+                rows,
+                rowCount;
+
+            if (!data || !data.columns || !data.columns.length || !cells) {
+                return;
+            }
+            state = getState(data);
+            rows = toTableRows(data, cells, asColumns);
+            rowCount = data.columns[0].length;
+            start = start === undefined ? rowCount : Math.min(start, rowCount);
+            redraw = pick(redraw, true);
+
+            if (
+                !parseRows(data, state, rows, start) ||
+                // Sorting reverses the table, so rows no longer line up
+                // with points
+                data.options.sort
+            ) {
+                reparse(data, redraw);
+                return;
+            }
+
+            mergeRows(chart, state, start, rows.length);
+            if (redraw) {
+                chart.redraw(animation);
+            }
+        }
+
+        /**
+         * Adds rows after the last row of the data module table. The rows
+         * have the layout of data.rows, without a row of names.
+         *
+         * @param {Array<Array>} rows The new rows.
+         * @param {Boolean} [redraw=true] Whether to redraw the chart.
+         * @param {Boolean|AnimationOptions} [animation]
+         */
+        Chart.prototype.addDataRows = function (rows, redraw, animation) {
+            editRows(this, rows, false, undefined, redraw, animation);
+        };
+
+        /**
+         * Adds rows given in the layout of data.columns, each column
+         * holding the new cells of that column.
+         */
+        Chart.prototype.addDataColumns = function (columns, redraw, animation) {
+            editRows(this, columns, true, undefined, redraw, animation);
+        };
+
+        /**
+         * Replaces rows of the table starting at the data row start, where
+         * 0 is the first row after the names. Rows past the end are added.
+         */
+        Chart.prototype.updateDataRows = function (
+            start,
+            rows,
+            redraw,
+            animation
+        ) {
+            editRows(this, rows, false, start, redraw, animation);
+        };
+
+        Chart.prototype.updateDataColumns = function (
+            start,
+            columns,
+            redraw,
+            animation
+        ) {
+            editRows(this, columns, true, start, redraw, animation);
+        };
+
+    }(Highcharts));
+}));
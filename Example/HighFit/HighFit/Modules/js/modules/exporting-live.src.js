@@ -0,0 +1,277 @@
+/*
+ Highcharts JS v6.0.2 (2017-10-20)
+ Live exporting module
+
+ (c) 2009-2017 Highsoft AS
+
+ License: www.highcharts.com/license
+*/
+/**
+ * (c) 2009-2017 Highsoft AS
+ *
+ * License: www.highcharts.com/license
+ *
+ * Live exporting module. Chart.getSVG of the exporting module builds a
+ * second chart from the options of the first one only to serialize it. When
+ * the export asks for nothing but the chart itself, possibly at another
+ * size, this module serializes the SVG of the live chart instead: parts that
+ * an exported chart does not have, like the exporting buttons, tooltip and
+ * trackers, are taken out of the tree while it is read. A different size is
+ * laid out on the live chart with setSize, and the original size is restored
+ * afterwards. Any other chartOptions, like a theme for printing, still go
+ * through the copy.
+ *
+ * Set exporting.liveSVG to false to always export through a copy.
+ *
+ * Requires the exporting module.
+ */
+(function (factory) {
+    if (typeof module === 'object' && module.exports) {
+        module.exports = factory;
+    } else {
+        factory(Highcharts);
+    }
+}(function (Highcharts) {
+    (function (H) {
+        var each = H.each,
+            merge = H.merge,
+            objectEach = H.objectEach,
+            pick = H.pick,
+            Chart = H.Chart;
+
+        /**
+         * The classes of elements that only the interactive chart has.
+         */
+        var interactiveClasses = [
+            'highcharts-tracker-line',
+            'highcharts-tracker-area',
+            'highcharts-halo',
+            'highcharts-crosshair'
+        ];
+
+        function hasClass(className, name) {
+            return (' ' + className + ' ').indexOf(' ' + name + ' ') !== -1;
+        }
+
+        /**
+         * Whether options set anything, undefined and null count as unset.
+         */
+        function hasValues(options) {
+            var found = false;
+            if (options === undefined || options === null) {
+                return false;
+            }
+            if (typeof options !== 'object' || H.isArray(options)) {
+                return true;
+            }
+            objectEach(options, function (value) {
+                found = found || hasValues(value);
+            });
+            return found;
+        }
+
+        /**
+         * The size getSVG would export at, or undefined when chartOptions
+         * change more than the size. Chart.getSVGForExport always adds a zero
+         * border radius and the source size, these are applied to the live
+         * chart directly, so the border radius is returned with the size.
+         */
+        Chart.prototype.getLiveExportSize = function (chartOptions) {
+            var options = this.options,
+                exporting = options.exporting || {},
+                overrides = merge(chartOptions),
+                chartOverrides = overrides.chart || {},
+                exportingOverrides = overrides.exporting || {},
+                style = this.renderTo.style,
+                size = {};
+
+            if (
+                exporting.liveSVG === false ||
+                exporting.allowHTML ||
+                H.grep(this.series, function (series) {
+                    return series.options.isInternal;
+                }).length
+            ) {
+                return;
+            }
+
+            // The same precedence as getSVG
+            size.width = pick(exportingOverrides.sourceWidth,
+                    exporting.sourceWidth) ||
+                pick(chartOverrides.width, options.chart.width) ||
+                (/px$/.test(style.width) && parseInt(style.width, 10)) ||
+                600;
+            size.height = pick(exportingOverrides.sourceHeight,
+                    exporting.sourceHeight) ||
+                pick(chartOverrides.height, options.chart.height) ||
+                (/px$/.test(style.height) && parseInt(style.height, 10)) ||
+                400;
+
+            size.borderRadius = chartOverrides.borderRadius;
+            each(['width', 'height', 'borderRadius'], function (key) {
+                delete chartOverrides[key];
+            });
+            delete exportingOverrides.sourceWidth;
+            delete exportingOverrides.sourceHeight;
+            // Disabling the buttons is what an export does anyway
+            delete exportingOverrides.enabled;
+
+            return hasValues(overrides) ? undefined : size;
+        };
+
+        /**
+         * Takes the elements out of the tree that an exported chart would not
+         * have, and returns a function putting them back.
+         */
+        Chart.prototype.detachInteractiveElements = function (borderRadius) {
+            var chart = this,
+                detached = [],
+                tracked = [],
+                elements = [].concat(
+                    chart.exportSVGElements || [],
+                    chart.exportDivElements || [],
+                    [
+                        chart.resetZoomButton,
+                        chart.drillUpButton,
+                        chart.tooltip && chart.tooltip.label
+                    ]
+                ),
+                background = chart.chartBackground &&
+                    chart.chartBackground.element,
+                radius;
+
+            each(elements, function (element) {
+                var node = element && (element.element || element);
+                if (node && node.parentNode) {
+                    detached.push(node);
+                }
+            });
+            each(chart.container.getElementsByTagName('*'), function (node) {
+                var className = node.getAttribute &&
+                    node.getAttribute('class');
+                if (!className) {
+                    return;
+                }
+                if (H.grep(interactiveClasses, function (name) {
+                    return hasClass(className, name);
+                }).length) {
+                    detached.push(node);
+                } else if (hasClass(className, 'highcharts-tracker')) {
+                    // Line trackers are paths, groups of points take the
+                    // class to be tracked themselves
+                    if (node.nodeName === 'path') {
+                        detached.push(node);
+                    } else {
+                        tracked.push({ node: node, className: className });
+                    }
+                }
+            });
+
+            // Remember the places before removing anything
+            detached = H.map(detached, function (node) {
+                return {
+                    node: node,
+                    parent: node.parentNode,
+                    next: node.nextSibling
+                };
+            });
+            each(detached, function (item) {
+                if (item.node.parentNode) {
+                    item.parent.removeChild(item.node);
+                }
+            });
+            each(tracked, function (item) {
+                item.node.setAttribute('class', item.className.replace(
+                    / highcharts-tracker(?= |$)/,
+                    ' '
+                ));
+            });
+
+            if (background && borderRadius !== undefined) {
+                radius = [
+                    background.getAttribute('rx'),
+                    background.getAttribute('ry')
+                ];
+                background.setAttribute('rx', borderRadius);
+                background.setAttribute('ry', borderRadius);
+            }
+
+            return function () {
+                var i = detached.length,
+                    item;
+                each(tracked, function (item) {
+                    item.node.setAttribute('class', item.className);
+                });
+                // In reverse, so every next sibling is back in place first
+                while (i--) {
+                    item = detached[i];
+                    item.parent.insertBefore(
+                        item.node,
+                        item.next && item.next.parentNode === item.parent ?
+                            item.next :
+                            null
+                    );
+                }
+                if (radius) {
+                    each(['rx', 'ry'], function (key, j) {
+                        if (radius[j] === null) {
+                            background.removeAttribute(key);
+                        } else {
+                            background.setAttribute(key, radius[j]);
+                        }
+                    });
+                }
+            };
+        };
+
+        /**
+         * Serializes the live chart at a size, laying it out again when the
+         * size differs from the current one. A defined borderRadius replaces
+         * the one of the chart background.
+         */
+        Chart.prototype.getLiveSVG = function (width, height, borderRadius) {
+            var chart = this,
+                chartOptions = chart.options.chart,
+                resized = width !== chart.chartWidth ||
+                    height !== chart.chartHeight,
+                saved,
+                restore,
+                svg;
+
+            if (resized) {
+                saved = {
+                    width: chart.chartWidth,
+                    height: chart.chartHeight,
+                    optionsWidth: chartOptions.width,
+                    optionsHeight: chartOptions.height,
+                    hasUserSize: chart.hasUserSize
+                };
+                chart.setSize(width, height, false);
+            }
+
+            restore = chart.detachInteractiveElements(borderRadius);
+            svg = chart.sanitizeSVG(chart.getChartHTML(), {
+                exporting: chart.options.exporting,
+                chart: { width: width, height: height }
+            });
+            restore();
+
+            if (resized) {
+                chart.setSize(saved.width, saved.height, false);
+                // setSize writes the size to the options, which would stop
+                // the chart from following its container
+                chartOptions.width = saved.optionsWidth;
+                chartOptions.height = saved.optionsHeight;
+                chart.hasUserSize = saved.hasUserSize;
+            }
+            return svg;
+        };
+
+        H.wrap(Chart.prototype, 'getSVG', function (proceed, chartOptions) {
+            var size = this.getLiveExportSize(chartOptions);
+            return size ?
+                this.getLiveSVG(size.width, size.height, size.borderRadius) :
+                proceed.call(this, chartOptions);
+        });
+    }(Highcharts));
+}));
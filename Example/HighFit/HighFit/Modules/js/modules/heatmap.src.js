@@ -0,0 +1,1688 @@
+/*
+ Highcharts JS v6.0.2 (2017-10-20)
+
+ (c) 2009-2017 Torstein Honsi
+
+ License: www.highcharts.com/license
+*/
+/**
+ * (c) 2009-2017 Torstein Honsi
+ *
+ * License: www.highcharts.com/license
+ *
+ * Heatmap module, with the color axis and the heatmap series.
+ *
+ * Large heatmaps on a regular grid are drawn into one image instead of an
+ * element per cell. Without padding or borders each cell is a pixel of a
+ * bitmap scaled to the plot, smoothed when interpolation is set; other cells
+ * are traced into a canvas the size of the plot. The cell under the pointer
+ * is looked up on the grid from the axis values at its position.
+ */
+(function (factory) {
+    if (typeof module === 'object' && module.exports) {
+        module.exports = factory;
+    } else {
+        factory(Highcharts);
+    }
+}(function (Highcharts) {
+    (function (H) {
+        var Axis = H.Axis,
+            Chart = H.Chart,
+            color = H.color,
+            ColorAxis,
+            each = H.each,
+            extend = H.extend,
+            isNumber = H.isNumber,
+            Legend = H.Legend,
+            LegendSymbolMixin = H.LegendSymbolMixin,
+            noop = H.noop,
+            merge = H.merge,
+            pick = H.pick,
+            wrap = H.wrap;
+
+        // The color axis is bundled in the map modules too, set it up once
+        if (!H.ColorAxis) {
+
+            /**
+             * The ColorAxis object for inclusion in gradient legends.
+             */
+            ColorAxis = H.ColorAxis = function () {
+                this.init.apply(this, arguments);
+            };
+            extend(ColorAxis.prototype, Axis.prototype);
+            extend(ColorAxis.prototype, {
+                defaultColorAxisOptions: {
+                    lineWidth: 0,
+                    minPadding: 0,
+                    maxPadding: 0,
+                    gridLineWidth: 1,
+                    tickPixelInterval: 72,
+                    startOnTick: true,
+                    endOnTick: true,
+                    offset: 0,
+                    marker: {
+                        animation: {
+                            duration: 50
+                        },
+                        width: 0.01
+                    },
+                    labels: {
+                        overflow: 'justify',
+                        rotation: 0
+                    },
+                    minColor: '#e6ebf5',
+                    maxColor: '#003399',
+                    tickLength: 5,
+                    showInLegend: true
+                },
+
+                // The number of colors sampled from the stops into the lookup
+                // table of toColor
+                colorTableLength: 1024,
+
+                // Properties to preserve after destroy, for Axis.update
+                keepProps: [
+                    'legendGroup',
+                    'legendItemHeight',
+                    'legendItemWidth',
+                    'legendItem',
+                    'legendSymbol'
+                ].concat(Axis.prototype.keepProps),
+
+                /**
+                 * Initialize the color axis.
+                 */
+                init: function (chart, userOptions) {
+                    var horiz = chart.options.legend.layout !== 'vertical',
+                        options;
+
+                    this.coll = 'colorAxis';
+
+                    // Build the options
+                    options = merge(this.defaultColorAxisOptions, {
+                        side: horiz ? 2 : 1,
+                        reversed: !horiz
+                    }, userOptions, {
+                        opposite: !horiz,
+                        showEmpty: false,
+                        title: null
+                    });
+
+                    Axis.prototype.init.call(this, chart, options);
+
+                    // Base init() pushes it to the xAxis array, now pop it again
+                    // chart[this.isXAxis ? 'xAxis' : 'yAxis'].pop();
+
+                    // Prepare data classes
+                    if (userOptions.dataClasses) {
+                        this.initDataClasses(userOptions);
+                    }
+                    this.initStops();
+
+                    // Override original axis properties
+                    this.horiz = horiz;
+                    this.zoomEnabled = false;
+
+                    // Add default values
+                    this.defaultLegendLength = 200;
+                },
+
+                initDataClasses: function (userOptions) {
+                    var chart = this.chart,
+                        dataClasses,
+                        colorCounter = 0,
+                        colorCount = chart.options.chart.colorCount,
+                        options = this.options,
+                        len = userOptions.dataClasses.length;
+
+                    this.dataClasses = dataClasses = [];
+                    this.legendItems = [];
+
+                    each(userOptions.dataClasses, function (dataClass, i) {
+                        dataClass = merge(dataClass);
+                        dataClasses.push(dataClass);
+
+                        if (options.dataClassColor === 'category') {
+                            dataClass.colorIndex = colorCounter;
+
+                            // Loop back to zero
+                            colorCounter++;
+                            if (colorCounter === colorCount) {
+                                colorCounter = 0;
+                            }
+                        } else {
+                            dataClass.color = color(options.minColor).tweenTo(
+                                color(options.maxColor),
+                                len < 2 ? 0.5 : i / (len - 1) // #3219
+                            );
+                        }
+                    });
+
+                    this.initDataClassIndex();
+                },
+
+                /**
+                 * Index the data classes by the intervals between their
+                 * limits, so that toColor can find the class of a value by a
+                 * binary search. Each limit and each open interval between two
+                 * limits holds the last data class that contains it, as the
+                 * linear search would find.
+                 */
+                initDataClassIndex: function () {
+                    var dataClasses = this.dataClasses,
+                        limits = [],
+                        classes = [],
+                        numeric = true,
+                        slot,
+                        low,
+                        high,
+                        i;
+
+                    each(dataClasses, function (dataClass) {
+                        each([dataClass.from, dataClass.to], function (limit) {
+                            if (limit !== undefined) {
+                                numeric = numeric && isNumber(limit);
+                                limits.push(limit);
+                            }
+                        });
+                    });
+
+                    // Limits given as strings or null compare differently
+                    if (!numeric) {
+                        this.dataClassIndex = undefined;
+                        return;
+                    }
+
+                    limits.sort(function (a, b) {
+                        return a - b;
+                    });
+                    limits = H.grep(limits, function (limit, i) {
+                        return limit !== limits[i - 1];
+                    });
+
+                    // Odd slots are the limits, even slots the open intervals
+                    // below, between and above them
+                    for (slot = 0; slot <= 2 * limits.length; slot++) {
+                        if (slot % 2) {
+                            low = high = limits[(slot - 1) / 2];
+                        } else {
+                            low = slot ? limits[slot / 2 - 1] : -Infinity;
+                            high = slot < 2 * limits.length ?
+                                limits[slot / 2] :
+                                Infinity;
+                        }
+
+                        i = dataClasses.length;
+                        while (i--) {
+                            if (
+                                (
+                                    dataClasses[i].from === undefined ||
+                                    dataClasses[i].from <= low
+                                ) &&
+                                (
+                                    dataClasses[i].to === undefined ||
+                                    dataClasses[i].to >= high
+                                )
+                            ) {
+                                break;
+                            }
+                        }
+                        classes[slot] = i;
+                    }
+
+                    this.dataClassIndex = {
+                        limits: limits,
+                        classes: classes
+                    };
+                },
+
+                /**
+                 * Get the index of the data class that a value falls in, or -1.
+                 */
+                getDataClass: function (value) {
+                    var dataClasses = this.dataClasses,
+                        index = this.dataClassIndex,
+                        limits,
+                        low = 0,
+                        high,
+                        middle,
+                        dataClass,
+                        i;
+
+                    if (index && isNumber(value)) {
+                        limits = index.limits;
+                        high = limits.length;
+
+                        // Count the limits below the value
+                        while (low < high) {
+                            middle = (low + high) >> 1;
+                            if (limits[middle] < value) {
+                                low = middle + 1;
+                            } else {
+                                high = middle;
+                            }
+                        }
+                        return index.classes[
+                            limits[low] === value ? 2 * low + 1 : 2 * low
+                        ];
+                    }
+
+                    i = dataClasses.length;
+                    while (i--) {
+                        dataClass = dataClasses[i];
+                        if (
+                            (dataClass.from === undefined ||
+                                value >= dataClass.from) &&
+                            (dataClass.to === undefined ||
+                                value <= dataClass.to)
+                        ) {
+                            break;
+                        }
+                    }
+                    return i;
+                },
+
+                /**
+                 * Override so that ticks are not added in data class axes
+                 * (#6914)
+                 */
+                setTickPositions: function () {
+                    if (!this.dataClasses) {
+                        return Axis.prototype.setTickPositions.call(this);
+                    }
+                },
+
+                initStops: function () {
+                    this.stops = this.options.stops || [
+                        [0, this.options.minColor],
+                        [1, this.options.maxColor]
+                    ];
+                    each(this.stops, function (stop) {
+                        stop.color = color(stop[1]);
+                    });
+                    this.initColorTable();
+                },
+
+                /**
+                 * Sample the stops into a lookup table of colors, so that
+                 * toColor doesn't tween colors for each point. The table
+                 * covers the normalized positions from 0 to 1 and only changes
+                 * with the stops. Their RGBA components are kept for the boost
+                 * renderer. Stops that can't be tweened, like gradients, are
+                 * computed for each value as before.
+                 */
+                initColorTable: function () {
+                    var length = this.colorTableLength,
+                        colorTable = [],
+                        rgbaTable,
+                        rgbaCache = {},
+                        rgba,
+                        j,
+                        k;
+
+                    this.colorTable = this.colorTableRGBA = undefined;
+                    this.rgbaCache = rgbaCache;
+
+                    // Data classes don't use the stops
+                    if (this.dataClasses) {
+                        return;
+                    }
+                    for (j = 0; j < this.stops.length; j++) {
+                        rgba = this.stops[j].color.rgba;
+                        if (!rgba || !rgba.length) {
+                            return;
+                        }
+                    }
+
+                    rgbaTable = new Float32Array(length * 4);
+                    for (j = 0; j < length; j++) {
+                        colorTable[j] = this.getStopColor(j / (length - 1));
+
+                        rgba = color(colorTable[j]).rgba;
+                        for (k = 0; k < 4; k++) {
+                            rgbaTable[j * 4 + k] = k < 3 ?
+                                rgba[k] / 255 :
+                                rgba[k];
+                        }
+                        if (!rgbaCache[colorTable[j]]) {
+                            rgbaCache[colorTable[j]] =
+                                rgbaTable.subarray(j * 4, j * 4 + 4);
+                        }
+                    }
+
+                    this.colorTable = colorTable;
+                    this.colorTableRGBA = rgbaTable;
+                },
+
+                /**
+                 * Get the RGBA components of a color from toColor, with the
+                 * channels from 0 to 1 as the boost renderer takes them. Colors
+                 * from the lookup table and the data classes are only parsed
+                 * once. The returned array must not be modified.
+                 */
+                getRGBA: function (colorString) {
+                    var rgbaCache = this.rgbaCache,
+                        rgba = rgbaCache && rgbaCache[colorString],
+                        dataClasses = this.dataClasses,
+                        i;
+
+                    if (!rgba) {
+                        rgba = color(colorString).rgba;
+                        for (i = 0; i < 3; i++) {
+                            rgba[i] /= 255;
+                        }
+
+                        // Keep the colors of the data classes, other colors
+                        // are given on the points
+                        if (rgbaCache && dataClasses) {
+                            i = dataClasses.length;
+                            while (i--) {
+                                if (dataClasses[i].color === colorString) {
+                                    rgbaCache[colorString] = rgba;
+                                    break;
+                                }
+                            }
+                        }
+                    }
+                    return rgba;
+                },
+
+                /**
+                 * Extend the setOptions method to process extreme colors and
+                 * color stops.
+                 */
+                setOptions: function (userOptions) {
+                    Axis.prototype.setOptions.call(this, userOptions);
+
+                    this.options.crosshair = this.options.marker;
+                },
+
+                setAxisSize: function () {
+                    var symbol = this.legendSymbol,
+                        chart = this.chart,
+                        legendOptions = chart.options.legend || {},
+                        x,
+                        y,
+                        width,
+                        height;
+
+                    if (symbol) {
+                        this.left = x = symbol.attr('x');
+                        this.top = y = symbol.attr('y');
+                        this.width = width = symbol.attr('width');
+                        this.height = height = symbol.attr('height');
+                        this.right = chart.chartWidth - x - width;
+                        this.bottom = chart.chartHeight - y - height;
+
+                        this.len = this.horiz ? width : height;
+                        this.pos = this.horiz ? x : y;
+                    } else {
+                        // Fake length for disabled legend to avoid tick issues
+                        // and such (#5205)
+                        this.len = (
+                            this.horiz ?
+                                legendOptions.symbolWidth :
+                                legendOptions.symbolHeight
+                        ) || this.defaultLegendLength;
+                    }
+                },
+
+                normalizedValue: function (value) {
+                    if (this.isLog) {
+                        value = this.val2lin(value);
+                    }
+                    return 1 - ((this.max - value) / ((this.max - this.min) || 1));
+                },
+
+                /**
+                 * Get the color at a normalized position in the stops.
+                 */
+                getStopColor: function (pos) {
+                    var stops = this.stops,
+                        from,
+                        to,
+                        i = stops.length;
+
+                    while (i--) {
+                        if (pos > stops[i][0]) {
+                            break;
+                        }
+                    }
+                    from = stops[i] || stops[i + 1];
+                    to = stops[i + 1] || from;
+
+                    // The position within the gradient
+                    pos = 1 - (to[0] - pos) / ((to[0] - from[0]) || 1);
+
+                    return from.color.tweenTo(
+                        to.color,
+                        pos
+                    );
+                },
+
+                /**
+                 * Translate from a value to a color.
+                 */
+                toColor: function (value, point) {
+                    var pos,
+                        colorTable = this.colorTable,
+                        color,
+                        dataClasses = this.dataClasses,
+                        dataClass,
+                        i;
+
+                    if (dataClasses) {
+                        i = this.getDataClass(value);
+                        if (i > -1) {
+                            dataClass = dataClasses[i];
+                            if (point) {
+                                point.dataClass = i;
+                                point.colorIndex = dataClass.colorIndex;
+                            }
+                        }
+
+                    } else {
+
+                        pos = this.normalizedValue(value);
+                        if (colorTable && isFinite(pos)) {
+                            color = colorTable[Math.round(
+                                Math.min(Math.max(pos, 0), 1) *
+                                (colorTable.length - 1)
+                            )];
+                        } else {
+                            color = this.getStopColor(pos);
+                        }
+                    }
+                    return color;
+                },
+
+                /**
+                 * Override the getOffset method to add the whole axis groups
+                 * inside the legend.
+                 */
+                getOffset: function () {
+                    var group = this.legendGroup,
+                        sideOffset = this.chart.axisOffset[this.side];
+
+                    if (group) {
+
+                        // Hook for the getOffset method to add groups to this
+                        // parent group
+                        this.axisParent = group;
+
+                        // Call the base
+                        Axis.prototype.getOffset.call(this);
+
+                        // First time only
+                        if (!this.added) {
+
+                            this.added = true;
+
+                            this.labelLeft = 0;
+                            this.labelRight = this.width;
+                        }
+                        // Reset it to avoid color axis reserving space
+                        this.chart.axisOffset[this.side] = sideOffset;
+                    }
+                },
+
+                /**
+                 * Create the color gradient.
+                 */
+                setLegendColor: function () {
+                    var grad,
+                        reversed = this.reversed,
+                        one = reversed ? 1 : 0,
+                        zero = reversed ? 0 : 1;
+
+                    grad = this.horiz ? [one, 0, zero, 0] : [0, zero, 0, one];
+                    this.legendColor = {
+                        linearGradient: {
+                            x1: grad[0],
+                            y1: grad[1],
+                            x2: grad[2],
+                            y2: grad[3]
+                        },
+                        stops: this.stops
+                    };
+                },
+
+                /**
+                 * The color axis appears inside the legend and has its own
+                 * legend symbol.
+                 */
+                drawLegendSymbol: function (legend, item) {
+                    var padding = legend.padding,
+                        legendOptions = legend.options,
+                        horiz = this.horiz,
+                        width = pick(
+                            legendOptions.symbolWidth,
+                            horiz ? this.defaultLegendLength : 12
+                        ),
+                        height = pick(
+                            legendOptions.symbolHeight,
+                            horiz ? 12 : this.defaultLegendLength
+                        ),
+                        labelPadding = pick(
+                            legendOptions.labelPadding,
+                            horiz ? 16 : 30
+                        ),
+                        itemDistance = pick(legendOptions.itemDistance, 10);
+
+                    this.setLegendColor();
+
+                    // Create the gradient
+                    item.legendSymbol = this.chart.renderer.rect(
+                        0,
+                        legend.baseline - 11,
+                        width,
+                        height
+                    ).attr({
+                        zIndex: 1
+                    }).add(item.legendGroup);
+
+                    // Set how much space this legend item takes up
+                    this.legendItemWidth = width + padding +
+                        (horiz ? itemDistance : labelPadding);
+                    this.legendItemHeight = height + padding +
+                        (horiz ? labelPadding : 0);
+                },
+
+                /**
+                 * Fool the legend
+                 */
+                setState: noop,
+                visible: true,
+                setVisible: noop,
+
+                getSeriesExtremes: function () {
+                    var series = this.series,
+                        i = series.length;
+
+                    this.dataMin = Infinity;
+                    this.dataMax = -Infinity;
+                    while (i--) {
+                        if (series[i].valueMin !== undefined) {
+                            this.dataMin = Math.min(
+                                this.dataMin,
+                                series[i].valueMin
+                            );
+                            this.dataMax = Math.max(
+                                this.dataMax,
+                                series[i].valueMax
+                            );
+                        }
+                    }
+                },
+
+                drawCrosshair: function (e, point) {
+                    var plotX = point && point.plotX,
+                        plotY = point && point.plotY,
+                        crossPos,
+                        axisPos = this.pos,
+                        axisLen = this.len;
+
+                    if (point) {
+                        crossPos = this.toPixels(point[point.series.colorKey]);
+                        if (crossPos < axisPos) {
+                            crossPos = axisPos - 2;
+                        } else if (crossPos > axisPos + axisLen) {
+                            crossPos = axisPos + axisLen + 2;
+                        }
+
+                        point.plotX = crossPos;
+                        point.plotY = this.len - crossPos;
+                        Axis.prototype.drawCrosshair.call(this, e, point);
+                        point.plotX = plotX;
+                        point.plotY = plotY;
+
+                        if (this.cross) {
+                            this.cross
+                                .addClass('highcharts-coloraxis-marker')
+                                .add(this.legendGroup);
+
+                        }
+                    }
+                },
+
+                getPlotLinePath: function (a, b, c, d, pos) {
+                    // crosshairs only
+                    return isNumber(pos) ? // pos can be 0 (#3969)
+                        (
+                            this.horiz ? [
+                                'M',
+                                pos - 4, this.top - 6,
+                                'L',
+                                pos + 4, this.top - 6,
+                                pos, this.top,
+                                'Z'
+                            ] : [
+                                'M',
+                                this.left, pos,
+                                'L',
+                                this.left - 6, pos + 6,
+                                this.left - 6, pos - 6,
+                                'Z'
+                            ]
+                        ) :
+                        Axis.prototype.getPlotLinePath.call(this, a, b, c, d);
+                },
+
+                update: function (newOptions, redraw) {
+                    var chart = this.chart,
+                        legend = chart.legend;
+
+                    each(this.series, function (series) {
+                        // Needed for Axis.update when choropleth colors change
+                        series.isDirtyData = true;
+                    });
+
+                    // When updating data classes, destroy old items and make
+                    // sure new ones are created (#3207)
+                    if (newOptions.dataClasses && legend.allItems) {
+                        each(legend.allItems, function (item) {
+                            if (item.isDataClass && item.legendGroup) {
+                                item.legendGroup.destroy();
+                            }
+                        });
+                        chart.isDirtyLegend = true;
+                    }
+
+                    // Keep the options structure updated for export. Unlike
+                    // xAxis and yAxis, the colorAxis is not an array. (#3207)
+                    chart.options[this.coll] = merge(this.userOptions, newOptions);
+
+                    Axis.prototype.update.call(this, newOptions, redraw);
+                    if (this.legendItem) {
+                        this.setLegendColor();
+                        legend.colorizeItem(this, true);
+                    }
+                },
+
+                /**
+                 * Extend basic axis remove by also removing the legend item.
+                 */
+                remove: function () {
+                    if (this.legendItem) {
+                        this.chart.legend.destroyItem(this);
+                    }
+                    Axis.prototype.remove.call(this);
+                },
+
+                /**
+                 * Get the legend item symbols for data classes
+                 */
+                getDataClassLegendSymbols: function () {
+                    var axis = this,
+                        chart = this.chart,
+                        legendItems = this.legendItems,
+                        legendOptions = chart.options.legend,
+                        valueDecimals = legendOptions.valueDecimals,
+                        valueSuffix = legendOptions.valueSuffix || '',
+                        name;
+
+                    if (!legendItems.length) {
+                        each(this.dataClasses, function (dataClass, i) {
+                            var vis = true,
+                                from = dataClass.from,
+                                to = dataClass.to;
+
+                            // Assemble the default name. This can be
+                            // overridden by legend.options.labelFormatter
+                            name = '';
+                            if (from === undefined) {
+                                name = '< ';
+                            } else if (to === undefined) {
+                                name = '> ';
+                            }
+                            if (from !== undefined) {
+                                name += H.numberFormat(from, valueDecimals) +
+                                    valueSuffix;
+                            }
+                            if (from !== undefined && to !== undefined) {
+                                name += ' - ';
+                            }
+                            if (to !== undefined) {
+                                name += H.numberFormat(to, valueDecimals) +
+                                    valueSuffix;
+                            }
+                            // Add a mock object to the legend items
+                            legendItems.push(extend({
+                                chart: chart,
+                                name: name,
+                                options: {},
+                                drawLegendSymbol:
+                                    LegendSymbolMixin.drawRectangle,
+                                visible: true,
+                                setState: noop,
+                                isDataClass: true,
+                                setVisible: function () {
+                                    vis = this.visible = !vis;
+                                    each(axis.series, function (series) {
+                                        each(series.points, function (point) {
+                                            if (point.dataClass === i) {
+                                                point.setVisible(vis);
+                                            }
+                                        });
+                                        // Cells drawn into one image have
+                                        // no elements to hide
+                                        if (series.rasterLayer) {
+                                            series.drawPoints();
+                                        }
+                                    });
+                                    chart.legend.colorizeItem(this, vis);
+                                }
+                            }, dataClass));
+                        });
+                    }
+                    return legendItems;
+                },
+                name: '' // Prevents 'undefined' in legend in IE8
+            });
+
+            /**
+             * Handle animation of the color attributes directly
+             */
+            each(['fill', 'stroke'], function (prop) {
+                H.Fx.prototype[prop + 'Setter'] = function () {
+                    this.elem.attr(
+                        prop,
+                        color(this.start).tweenTo(
+                            color(this.end),
+                            this.pos
+                        ),
+                        null,
+                        true
+                    );
+                };
+            });
+
+            /**
+             * Extend the chart getAxes method to also get the color axis
+             */
+            wrap(Chart.prototype, 'getAxes', function (proceed) {
+                var options = this.options,
+                    colorAxisOptions = options.colorAxis;
+
+                proceed.call(this);
+
+                this.colorAxis = [];
+                if (colorAxisOptions) {
+                    new ColorAxis(this, colorAxisOptions); // eslint-disable-line no-new
+                }
+            });
+
+            /**
+             * Wrap the legend getAllItems method to add the color axis. This
+             * also removes the axis' own series to prevent them from showing
+             * up individually.
+             */
+            wrap(Legend.prototype, 'getAllItems', function (proceed) {
+                var allItems = [],
+                    colorAxis = this.chart.colorAxis[0];
+
+                if (colorAxis && colorAxis.options) {
+                    if (colorAxis.options.showInLegend) {
+                        // Data classes
+                        if (colorAxis.options.dataClasses) {
+                            allItems = allItems.concat(
+                                colorAxis.getDataClassLegendSymbols()
+                            );
+                        // Gradient legend
+                        } else {
+                            // Add this axis on top
+                            allItems.push(colorAxis);
+                        }
+                    }
+
+                    // Don't add the color axis' series
+                    each(colorAxis.series, function (series) {
+                        series.options.showInLegend = false;
+                    });
+                }
+
+                return allItems.concat(proceed.call(this));
+            });
+
+            wrap(Legend.prototype, 'colorizeItem', function (proceed, item, visible) {
+                proceed.call(this, item, visible);
+                if (visible && item.legendColor) {
+                    item.legendSymbol.attr({
+                        fill: item.legendColor
+                    });
+                }
+            });
+
+            // Updates in the legend need to be reflected in the color axis
+            // (6888)
+            wrap(Legend.prototype, 'update', function (proceed) {
+                proceed.apply(this, [].slice.call(arguments, 1));
+
+                if (this.chart.colorAxis[0]) {
+                    this.chart.colorAxis[0].update({}, arguments[2]);
+                }
+            });
+        }
+    }(Highcharts));
+    (function (H) {
+        var defined = H.defined,
+            each = H.each,
+            noop = H.noop,
+            seriesTypes = H.seriesTypes;
+
+        /**
+         * Mixin for maps and heatmaps
+         */
+        H.colorPointMixin = {
+            /**
+             * Color points have a value option that determines whether or not
+             * it is a null point
+             */
+            isValid: function () {
+                return this.value !== null;
+            },
+
+            /**
+             * Set the visibility of a single point
+             */
+            setVisible: function (vis) {
+                var point = this,
+                    method = vis ? 'show' : 'hide';
+
+                // Cells drawn into the image of a heatmap are left out of it
+                point.visible = vis;
+
+                // Show and hide associated elements
+                each(['graphic', 'dataLabel'], function (key) {
+                    if (point[key]) {
+                        point[key][method]();
+                    }
+                });
+            },
+
+            setState: function (state) {
+                var point = this,
+                    series = point.series;
+
+                // A cell drawn into the image gets an element of its own while
+                // it is hovered or selected
+                if (series.rasterLayer && state && !point.graphic) {
+                    series.drawRasterState(point);
+                }
+
+                H.Point.prototype.setState.call(point, state);
+                if (point.graphic) {
+                    point.graphic.attr({
+                        zIndex: state === 'hover' ? 1 : 0
+                    });
+                }
+
+                if (
+                    series.rasterLayer &&
+                    !point.state &&
+                    !point.selected &&
+                    point.graphic
+                ) {
+                    point.graphic = point.graphic.destroy();
+                }
+            }
+        };
+
+        H.colorSeriesMixin = {
+            pointArrayMap: ['value'],
+            axisTypes: ['xAxis', 'yAxis', 'colorAxis'],
+            optionalAxis: 'colorAxis',
+            trackerGroups: ['group', 'markerGroup', 'dataLabelsGroup'],
+            getSymbol: noop,
+            parallelArrays: ['x', 'y', 'value'],
+            colorKey: 'value',
+
+
+            /**
+             * In choropleth maps, the color is a result of the value, so this
+             * needs translation too
+             */
+            translateColors: function () {
+                var series = this,
+                    nullColor = this.options.nullColor,
+                    colorAxis = this.colorAxis,
+                    colorKey = this.colorKey;
+
+                each(this.data, function (point) {
+                    var value = point[colorKey],
+                        color;
+
+                    color = point.options.color ||
+                        (
+                            point.isNull ?
+                                nullColor :
+                                (colorAxis && value !== undefined) ?
+                                    colorAxis.toColor(value, point) :
+                                    point.color || series.color
+                        );
+
+                    if (color) {
+                        point.color = color;
+                    }
+                });
+            },
+
+            /**
+             * Get the color attributes to apply on the graphic
+             */
+            colorAttribs: function (point) {
+                var ret = {};
+                if (defined(point.color)) {
+                    ret[this.colorProp || 'fill'] = point.color;
+                }
+                return ret;
+            }
+        };
+    }(Highcharts));
+    (function (H) {
+        var colorPointMixin = H.colorPointMixin,
+            doc = H.doc,
+            each = H.each,
+            isNumber = H.isNumber,
+            merge = H.merge,
+            noop = H.noop,
+            pick = H.pick,
+            Pointer = H.Pointer,
+            Series = H.Series,
+            seriesType = H.seriesType,
+            seriesTypes = H.seriesTypes,
+            win = H.win,
+            canvasSupported = !!(
+                doc.createElement('canvas').getContext &&
+                doc.createElement('canvas').getContext('2d')
+            );
+
+        /**
+         * Trace the shape of a cell into the canvas context. Tiles are
+         * rectangles, circles, or paths of straight lines.
+         */
+        function traceTile(ctx, point) {
+            var shapeArgs = point.shapeArgs,
+                path,
+                command,
+                i = 0;
+
+            if (point.shapeType === 'circle') {
+                ctx.moveTo(shapeArgs.x + shapeArgs.r, shapeArgs.y);
+                ctx.arc(shapeArgs.x, shapeArgs.y, shapeArgs.r, 0, 2 * Math.PI, false);
+            } else if (point.shapeType === 'path') {
+                path = shapeArgs.d;
+                while (i < path.length) {
+                    if (typeof path[i] === 'string') {
+                        command = path[i];
+                        i++;
+                    }
+                    if (command === 'M') {
+                        ctx.moveTo(path[i], path[i + 1]);
+                        i += 2;
+                        command = 'L'; // Implicit lineTo after moveTo
+                    } else if (command === 'L') {
+                        ctx.lineTo(path[i], path[i + 1]);
+                        i += 2;
+                    } else {
+                        ctx.closePath();
+                    }
+                }
+            } else {
+                ctx.rect(shapeArgs.x, shapeArgs.y, shapeArgs.width, shapeArgs.height);
+            }
+        }
+
+        /**
+         * The bounding box of the shape of a cell.
+         */
+        function getTileBox(point) {
+            var shapeArgs = point.shapeArgs,
+                path,
+                i,
+                x,
+                y,
+                box;
+
+            if (point.shapeType === 'circle') {
+                return {
+                    x: shapeArgs.x - shapeArgs.r,
+                    y: shapeArgs.y - shapeArgs.r,
+                    width: 2 * shapeArgs.r,
+                    height: 2 * shapeArgs.r
+                };
+            }
+            if (point.shapeType === 'path') {
+                path = shapeArgs.d;
+                box = { x: Infinity, y: Infinity, x2: -Infinity, y2: -Infinity };
+                for (i = 0; i < path.length; i++) {
+                    if (typeof path[i] !== 'string') {
+                        x = path[i];
+                        y = path[++i];
+                        box.x = Math.min(box.x, x);
+                        box.y = Math.min(box.y, y);
+                        box.x2 = Math.max(box.x2, x);
+                        box.y2 = Math.max(box.y2, y);
+                    }
+                }
+                box.width = box.x2 - box.x;
+                box.height = box.y2 - box.y;
+                return box;
+            }
+            return shapeArgs;
+        }
+
+        /**
+         * The heatmap code is bundled in the tilemap module too. Pointer
+         * events are resolved to cells of the image by whichever module loads
+         * first.
+         */
+        if (!seriesTypes.heatmap) {
+
+            /**
+             * Resolve points on heatmap images. Touch and mouse over events
+             * reach the image in the tracker group, which carries no point.
+             */
+            H.wrap(Pointer.prototype, 'getPointFromEvent', function (proceed, e) {
+                var point = proceed.call(this, e),
+                    series = e.target && e.target.rasterSeries;
+                if (!point && series && series.rasterLayer) {
+                    point = series.getRasterPointFromEvent(e);
+                }
+                return point;
+            });
+
+            /**
+             * Moving within the image fires no new mouseover, so follow the
+             * mouse to update the hovered cell.
+             */
+            H.Chart.prototype.callbacks.push(function (chart) {
+                H.addEvent(chart.container, 'mousemove', function (e) {
+                    var series = e.target && e.target.rasterSeries,
+                        point;
+                    if (series && series.rasterLayer) {
+                        point = series.getRasterPointFromEvent(e);
+                        if (point && point !== chart.hoverPoint) {
+                            point.onMouseOver(e);
+                        }
+                    }
+                });
+            });
+        }
+
+        /**
+         * Heatmap series type
+         */
+        seriesType('heatmap', 'scatter', {
+            animation: false,
+            borderWidth: 0,
+            dataLabels: {
+                formatter: function () { // #2945
+                    return this.point.value;
+                },
+                inside: true,
+                verticalAlign: 'middle',
+                crop: false,
+                overflow: false,
+                padding: 0 // #3837
+            },
+            marker: null,
+            pointRange: null, // dynamically set to colsize by default
+            tooltip: {
+                pointFormat: '{point.x}, {point.y}: {point.value}<br/>'
+            },
+            states: {
+                normal: {
+                    animation: true
+                },
+                hover: {
+                    halo: false,  // #3406, halo is not required on heatmaps
+                    brightness: 0.2
+                }
+            },
+
+            /**
+             * Series with at least this many cells on a regular grid of
+             * colsize by rowsize are drawn into a single image instead of an
+             * element per cell, and the cell under the pointer is found from
+             * its position. Set to 0 to always draw elements.
+             */
+            rasterThreshold: 1000,
+
+            /**
+             * Blend the colors of neighbouring cells in the image instead of
+             * filling each cell with one color. Applies to cells without
+             * padding or borders on linear axes.
+             */
+            interpolation: false
+        }, merge(H.colorSeriesMixin, {
+            pointArrayMap: ['y', 'value'],
+            hasPointSpecificOptions: true,
+            getExtremesFromAll: true,
+            directTouch: true,
+
+            /**
+             * Override the init method to add point ranges on both axes.
+             */
+            init: function () {
+                var options;
+                seriesTypes.scatter.prototype.init.apply(this, arguments);
+
+                options = this.options;
+                // #3758, prevent resetting in setData
+                options.pointRange = pick(options.pointRange, options.colsize || 1);
+                this.yAxis.axisPointRange = options.rowsize || 1; // general point range
+            },
+            translate: function () {
+                var series = this,
+                    options = series.options,
+                    xAxis = series.xAxis,
+                    yAxis = series.yAxis,
+                    seriesPointPadding = options.pointPadding || 0,
+                    between = function (x, a, b) {
+                        return Math.min(Math.max(a, x), b);
+                    };
+
+                series.generatePoints();
+
+                each(series.points, function (point) {
+                    var xPad = (options.colsize || 1) / 2,
+                        yPad = (options.rowsize || 1) / 2,
+                        x1 = between(
+                            Math.round(
+                                xAxis.len -
+                                xAxis.translate(point.x - xPad, 0, 1, 0, 1)
+                            ),
+                            -xAxis.len, 2 * xAxis.len
+                        ),
+                        x2 = between(
+                            Math.round(
+                                xAxis.len -
+                                xAxis.translate(point.x + xPad, 0, 1, 0, 1)
+                            ),
+                            -xAxis.len, 2 * xAxis.len
+                        ),
+                        y1 = between(
+                            Math.round(yAxis.translate(point.y - yPad, 0, 1, 0, 1)),
+                            -yAxis.len, 2 * yAxis.len
+                        ),
+                        y2 = between(
+                            Math.round(yAxis.translate(point.y + yPad, 0, 1, 0, 1)),
+                            -yAxis.len, 2 * yAxis.len
+                        ),
+                        pointPadding = pick(point.pointPadding, seriesPointPadding);
+
+                    // Set plotX and plotY for use in K-D-Tree and more
+                    point.plotX = point.clientX = (x1 + x2) / 2;
+                    point.plotY = (y1 + y2) / 2;
+
+                    point.shapeType = 'rect';
+                    point.shapeArgs = {
+                        x: Math.min(x1, x2) + pointPadding,
+                        y: Math.min(y1, y2) + pointPadding,
+                        width: Math.abs(x2 - x1) - pointPadding * 2,
+                        height: Math.abs(y2 - y1) - pointPadding * 2
+                    };
+                });
+
+                series.translateColors();
+            },
+            drawPoints: function () {
+                var series = this;
+
+                if (series.isRasterSeries()) {
+                    series.drawRaster();
+                    return;
+                }
+                series.destroyRaster();
+
+                seriesTypes.column.prototype.drawPoints.call(series);
+
+                each(series.points, function (point) {
+                    if (point.graphic) {
+                        point.graphic.css(series.colorAttribs(point));
+                    }
+                });
+            },
+
+            /**
+             * Whether the cells are drawn into a single image. Cells off the
+             * grid, or with colors that the image can not show, like
+             * gradients or the classes of styled mode, keep their elements.
+             */
+            isRasterSeries: function () {
+                var threshold = this.options.rasterThreshold;
+                return !!(
+                    canvasSupported &&
+                    threshold &&
+                    !this.chart.polar &&
+                    this.points &&
+                    this.points.length >= threshold &&
+                    this.getRasterGrid()
+                );
+            },
+
+            /**
+             * Index the points by cell, counting columns of colsize and rows
+             * of rowsize from the lowest x and y. The grid is null when a point
+             * is off the grid or has no plain color, or when the grid has
+             * many more cells than there are points.
+             */
+            getRasterGrid: function () {
+                var series = this,
+                    options = series.options,
+                    xAxis = series.xAxis,
+                    yAxis = series.yAxis,
+                    points = series.points,
+                    len = points.length,
+                    colsize = options.colsize || 1,
+                    rowsize = options.rowsize || 1,
+                    xMin = Infinity,
+                    xMax = -Infinity,
+                    yMin = Infinity,
+                    yMax = -Infinity,
+                    tiled = !!(
+                        options.pointPadding ||
+                        options.borderWidth ||
+                        xAxis.isLog ||
+                        yAxis.isLog ||
+                        xAxis.isBroken ||
+                        yAxis.isBroken
+                    ),
+                    cols,
+                    rows,
+                    cells,
+                    col,
+                    row,
+                    point,
+                    i;
+
+                series.rasterGrid = null;
+
+                for (i = 0; i < len; i++) {
+                    point = points[i];
+                    if (
+                        typeof point.color !== 'string' ||
+                        !isNumber(point.x) ||
+                        !isNumber(point.y) ||
+                        !point.shapeArgs
+                    ) {
+                        return null;
+                    }
+                    xMin = Math.min(xMin, point.x);
+                    xMax = Math.max(xMax, point.x);
+                    yMin = Math.min(yMin, point.y);
+                    yMax = Math.max(yMax, point.y);
+                    if (
+                        point.shapeType !== 'rect' ||
+                        point.pointPadding ||
+                        point.borderWidth
+                    ) {
+                        tiled = true;
+                    }
+                }
+
+                cols = Math.round((xMax - xMin) / colsize) + 1;
+                rows = Math.round((yMax - yMin) / rowsize) + 1;
+                if (!len || cols * rows > Math.max(4 * len, 65536)) {
+                    return null;
+                }
+
+                // The index of the point in each cell plus one, 0 for empty
+                // cells. A later point in the same cell is drawn on top.
+                cells = new Int32Array(cols * rows);
+                for (i = 0; i < len; i++) {
+                    col = (points[i].x - xMin) / colsize;
+                    row = (points[i].y - yMin) / rowsize;
+                    if (
+                        Math.abs(col - Math.round(col)) > 1e-6 ||
+                        Math.abs(row - Math.round(row)) > 1e-6
+                    ) {
+                        return null;
+                    }
+                    cells[Math.round(row) * cols + Math.round(col)] = i + 1;
+                }
+
+                series.rasterGrid = {
+                    xMin: xMin,
+                    yMin: yMin,
+                    colsize: colsize,
+                    rowsize: rowsize,
+                    cols: cols,
+                    rows: rows,
+                    cells: cells,
+                    tiled: tiled
+                };
+                return series.rasterGrid;
+            },
+
+            /**
+             * Get the cleared canvas of the image, the size of the plot area.
+             * In inverted charts it is drawn in the untransformed coordinates
+             * of the series group, like the cells.
+             */
+            getRasterLayer: function () {
+                var series = this,
+                    ratio = win.devicePixelRatio || 1,
+                    width = Math.max(1, Math.ceil(series.xAxis.len)),
+                    height = Math.max(1, Math.ceil(series.yAxis.len)),
+                    layer = series.rasterLayer,
+                    canvas,
+                    ctx;
+
+                if (!layer) {
+                    canvas = doc.createElement('canvas');
+                    layer = series.rasterLayer = {
+                        canvas: canvas,
+                        ctx: canvas.getContext('2d'),
+                        image: series.chart.renderer.image('', 0, 0, 0, 0)
+                            .add(series.group)
+                    };
+                    layer.image.element.rasterSeries = series;
+                }
+
+                canvas = layer.canvas;
+                ctx = layer.ctx;
+                if (canvas.width !== width * ratio) {
+                    canvas.width = width * ratio;
+                }
+                if (canvas.height !== height * ratio) {
+                    canvas.height = height * ratio;
+                }
+                ctx.setTransform(1, 0, 0, 1, 0, 0);
+                ctx.clearRect(0, 0, canvas.width, canvas.height);
+                ctx.setTransform(ratio, 0, 0, ratio, 0, 0);
+
+                layer.image.attr({
+                    width: width,
+                    height: height
+                });
+                return layer;
+            },
+
+            destroyRaster: function () {
+                var series = this;
+                if (series.rasterLayer) {
+                    series.rasterLayer.image.destroy();
+                    delete series.rasterLayer;
+                    delete series.rasterBitmap;
+                }
+            },
+
+            /**
+             * Draw the cells into the image. Hovered and selected cells keep an
+             * element on top of it.
+             */
+            drawRaster: function () {
+                var series = this,
+                    layer = series.getRasterLayer();
+
+                each(series.points, function (point) {
+                    var graphic = point.graphic;
+                    if (graphic) {
+                        if (point.state || point.selected) {
+                            graphic.attr(point.shapeArgs);
+                        } else {
+                            point.graphic = graphic.destroy();
+                        }
+                    }
+                });
+
+                if (series.rasterGrid.tiled) {
+                    series.drawRasterTiles(layer.ctx);
+                } else {
+                    series.drawRasterBitmap(layer.ctx);
+                }
+
+                layer.image.attr({
+                    href: layer.canvas.toDataURL('image/png')
+                });
+            },
+
+            /**
+             * Fill a bitmap with one pixel per cell and scale it to the plot.
+             * The bitmap is drawn with smoothing when interpolation is set, so
+             * colors blend between the centers of the cells.
+             */
+            drawRasterBitmap: function (ctx) {
+                var series = this,
+                    grid = series.rasterGrid,
+                    points = series.points,
+                    xAxis = series.xAxis,
+                    yAxis = series.yAxis,
+                    bitmap = series.rasterBitmap ||
+                        (series.rasterBitmap = doc.createElement('canvas')),
+                    bitmapCtx,
+                    imageData,
+                    data,
+                    colors = {},
+                    colorAxis = series.colorAxis,
+                    // The channels of the color axis are from 0 to 1
+                    scale = colorAxis ? 255 : 1,
+                    rgba,
+                    point,
+                    i,
+                    // The outer edges of the grid
+                    x1 = xAxis.len - xAxis.translate(
+                        grid.xMin - grid.colsize / 2, 0, 1, 0, 1
+                    ),
+                    x2 = xAxis.len - xAxis.translate(
+                        grid.xMin + (grid.cols - 0.5) * grid.colsize, 0, 1, 0, 1
+                    ),
+                    y1 = yAxis.translate(grid.yMin - grid.rowsize / 2, 0, 1, 0, 1),
+                    y2 = yAxis.translate(
+                        grid.yMin + (grid.rows - 0.5) * grid.rowsize, 0, 1, 0, 1
+                    );
+
+                bitmap.width = grid.cols;
+                bitmap.height = grid.rows;
+                bitmapCtx = bitmap.getContext('2d');
+                imageData = bitmapCtx.createImageData(grid.cols, grid.rows);
+                data = imageData.data;
+
+                for (i = 0; i < grid.cells.length; i++) {
+                    point = grid.cells[i] && points[grid.cells[i] - 1];
+                    if (point && point.visible !== false) {
+                        // Parse each color once, those of the color axis
+                        // lookup table are parsed already
+                        rgba = colors[point.color];
+                        if (!rgba) {
+                            rgba = colors[point.color] = colorAxis ?
+                                colorAxis.getRGBA(point.color) :
+                                H.color(point.color).rgba;
+                        }
+                        if (isNumber(rgba[0])) {
+                            data[4 * i] = rgba[0] * scale;
+                            data[4 * i + 1] = rgba[1] * scale;
+                            data[4 * i + 2] = rgba[2] * scale;
+                            data[4 * i + 3] = Math.round(255 * pick(rgba[3], 1));
+                        }
+                    }
+                }
+                bitmapCtx.putImageData(imageData, 0, 0);
+
+                // Map the pixels to the cells, mirrored on reversed axes
+                ctx.imageSmoothingEnabled = !!series.options.interpolation;
+                ctx.transform(
+                    (x2 - x1) / grid.cols,
+                    0,
+                    0,
+                    (y2 - y1) / grid.rows,
+                    x1,
+                    y1
+                );
+                ctx.drawImage(bitmap, 0, 0);
+            },
+
+            /**
+             * Trace the shape of every cell, filling and stroking runs of
+             * cells with the same colors at once. Used for padded cells,
+             * borders, logarithmic axes and the shapes of tilemaps.
+             */
+            drawRasterTiles: function (ctx) {
+                var series = this,
+                    options = series.options,
+                    points = series.points,
+                    started = false,
+                    fill,
+                    stroke,
+                    lineWidth,
+                    point,
+                    i,
+                    paint = function () {
+                        if (started) {
+                            ctx.fillStyle = fill;
+                            ctx.fill();
+                            if (lineWidth && stroke) {
+                                ctx.strokeStyle = stroke;
+                                ctx.lineWidth = lineWidth;
+                                ctx.stroke();
+                            }
+                        }
+                    };
+
+                for (i = 0; i < points.length; i++) {
+                    point = points[i];
+                    if (point.visible !== false) {
+                        if (
+                            point.color !== fill ||
+                            (point.borderColor || options.borderColor) !== stroke ||
+                            (point.borderWidth || options.borderWidth || 0) !== lineWidth
+                        ) {
+                            paint();
+                            started = true;
+                            fill = point.color;
+                            stroke = point.borderColor || options.borderColor;
+                            lineWidth = point.borderWidth || options.borderWidth || 0;
+                            ctx.beginPath();
+                        }
+                        traceTile(ctx, point);
+                    }
+                }
+                paint();
+            },
+
+            /**
+             * Give a cell of the image an element for its hover or select
+             * state, styled like the elements of drawPoints.
+             */
+            drawRasterState: function (point) {
+                var series = this;
+
+                if (point.shapeArgs) {
+                    point.graphic = series.chart.renderer[point.shapeType || 'rect'](
+                        point.shapeArgs
+                    )
+                        .addClass(point.getClassName(), true)
+                        .css(series.colorAttribs(point))
+                        .add(series.group);
+                    point.graphic.element.point = point;
+                }
+            },
+
+            /**
+             * Find the cell under a pointer event from its position on the
+             * axes. Rectangles fill their own cell, the shapes of a tilemap
+             * are offset by up to half a cell, so of the cells around the
+             * position the closest one that contains it is taken.
+             */
+            getRasterPointFromEvent: function (e) {
+                var series = this,
+                    chart = series.chart,
+                    grid = series.rasterGrid,
+                    xAxis = series.xAxis,
+                    yAxis = series.yAxis,
+                    inverted = chart.inverted,
+                    plotX,
+                    plotY,
+                    col,
+                    row,
+                    i,
+                    j,
+                    point,
+                    box,
+                    distance,
+                    closest,
+                    closestDistance = Infinity;
+
+                if (!grid) {
+                    return;
+                }
+
+                e = chart.pointer.normalize(e);
+                plotX = inverted ?
+                    xAxis.len - (e.chartY - xAxis.pos) :
+                    e.chartX - xAxis.pos;
+                plotY = inverted ?
+                    yAxis.len - (e.chartX - yAxis.pos) :
+                    e.chartY - yAxis.pos;
+
+                col = Math.round(
+                    (xAxis.translate(xAxis.len - plotX, 1, 1, 0, 1) - grid.xMin) /
+                    grid.colsize
+                );
+                row = Math.round(
+                    (yAxis.translate(plotY, 1, 1, 0, 1) - grid.yMin) /
+                    grid.rowsize
+                );
+
+                for (i = Math.max(col - 1, 0); i <= Math.min(col + 1, grid.cols - 1); i++) {
+                    for (j = Math.max(row - 1, 0); j <= Math.min(row + 1, grid.rows - 1); j++) {
+                        point = grid.cells[j * grid.cols + i];
+                        point = point && series.points[point - 1];
+                        if (point && point.visible !== false) {
+                            box = getTileBox(point);
+                            distance = Math.pow(point.plotX - plotX, 2) +
+                                Math.pow(point.plotY - plotY, 2);
+                            if (
+                                plotX >= box.x &&
+                                plotX <= box.x + box.width &&
+                                plotY >= box.y &&
+                                plotY <= box.y + box.height &&
+                                distance < closestDistance
+                            ) {
+                                closest = point;
+                                closestDistance = distance;
+                            }
+                        }
+                    }
+                }
+                return closest;
+            },
+
+            destroy: function () {
+                this.destroyRaster();
+                Series.prototype.destroy.apply(this, arguments);
+            },
+
+            animate: noop,
+            getBox: noop,
+            drawLegendSymbol: H.LegendSymbolMixin.drawRectangle,
+            alignDataLabel: seriesTypes.column.prototype.alignDataLabel,
+            getExtremes: function () {
+                // Get the extremes from the value data
+                Series.prototype.getExtremes.call(this, this.valueData);
+                this.valueMin = this.dataMin;
+                this.valueMax = this.dataMax;
+
+                // Get the extremes from the y data
+                Series.prototype.getExtremes.call(this);
+            }
+
+        }), H.extend({
+            haloPath: function (size) {
+                if (!size) {
+                    return [];
+                }
+                var rect = this.shapeArgs;
+                return [
+                    'M', rect.x - size, rect.y - size,
+                    'L', rect.x - size, rect.y + rect.height + size,
+                    rect.x + rect.width + size, rect.y + rect.height + size,
+                    rect.x + rect.width + size, rect.y - size,
+                    'Z'
+                ];
+            }
+        }, colorPointMixin));
+    }(Highcharts));
+}));
@@ -0,0 +1,1153 @@
+/*
+  Highcharts JS v6.0.2 (2017-10-20)
+
+ Support for parallel coordinates in Highcharts
+
+ (c) 2010-2017 Pawel Fus
+
+ License: www.highcharts.com/license
+*/
+/**
+ * Parallel coordinates module
+ *
+ * (c) 2010-2017 Pawel Fus
+ *
+ * License: www.highcharts.com/license
+ *
+ * Plots with many records are drawn into one image with translucent lines
+ * instead of a line per record. Brushing an axis looks up the records within
+ * its range in the values of the axis, sorted once, and only restyles the
+ * records that enter or leave the brushes.
+ */
+(function (factory) {
+    if (typeof module === 'object' && module.exports) {
+        module.exports = factory;
+    } else {
+        factory(Highcharts);
+    }
+}(function (Highcharts) {
+    (function (H) {
+        // Extensions for parallel coordinates plot.
+        var SeriesProto = H.Series.prototype,
+            ChartProto = H.Chart.prototype,
+            AxisProto = H.Axis.prototype,
+            addEvent = H.addEvent,
+            doc = H.doc,
+            fireEvent = H.fireEvent,
+            isNumber = H.isNumber,
+            pick = H.pick,
+            each = H.each,
+            wrap = H.wrap,
+            merge = H.merge,
+            erase = H.erase,
+            splat = H.splat,
+            extend = H.extend,
+            defined = H.defined,
+            arrayMin = H.arrayMin,
+            arrayMax = H.arrayMax,
+            win = H.win,
+            canvasSupported = !!(
+                doc.createElement('canvas').getContext &&
+                doc.createElement('canvas').getContext('2d')
+            );
+
+        var defaultXAxisOptions = {
+            opposite: true,
+            type: 'category'
+        };
+
+        /**
+         * @optionparent chart
+         */
+        var defaultParallelOptions = {
+            /**
+             * Flag to render charts as a parallel coordinates plot. In a
+             * parallel coordinates plot (||-coords) by default all required
+             * yAxes are generated and the legend is disabled.
+             */
+            parallelCoordinates: false,
+
+            /**
+             * Parallel coordinates plots with at least this many records are
+             * drawn into a single image instead of a line per record. Lines in
+             * the image have no markers, data labels or tooltips. Set to 0 to
+             * always draw the lines.
+             */
+            parallelRasterThreshold: 1000,
+
+            /**
+             * The opacity of each line in the image, so that dense bundles of
+             * records show through each other.
+             */
+            parallelRasterOpacity: 0.3,
+
+            /**
+             * Common options for all yAxes rendered in a parallel coordinates
+             * plot.
+             */
+            parallelAxes: {
+                /**
+                 * Titles for yAxes are taken from
+                 * xAxis.categories. All options for
+                 * xAxis.labels applies to parallel coordinates titles.
+                 */
+                title: {
+                    text: '',
+                    reserveSpace: false
+                },
+                labels: {
+                    x: 0,
+                    y: 4,
+                    align: 'center',
+                    reserveSpace: false
+                },
+                offset: 0,
+
+                /**
+                 * Brush an axis by dragging along it. Records with values
+                 * outside the brushed ranges of any axis are dimmed. The axis
+                 * fires a brush event with the range when it changes.
+                 */
+                brush: {
+                    enabled: false,
+
+                    /**
+                     * The width of the area along the axis that takes the
+                     * drag, in pixels.
+                     */
+                    width: 16,
+
+
+                    /**
+                     * The opacity of the records outside the brushed ranges.
+                     */
+                    inactiveOpacity: 0.1
+                }
+            }
+        };
+
+        H.setOptions({
+            chart: defaultParallelOptions
+        });
+
+        /**
+         * Initialize parallelCoordinates
+         */
+        wrap(ChartProto, 'init', function (proceed, options) {
+            var defaultyAxis = splat(options.yAxis || {}),
+                yAxisLength = defaultyAxis.length,
+                newYAxes = [];
+
+            /**
+             * Flag used in parallel coordinates plot to check if chart has
+             * ||-coords (parallel coords).
+             */
+            this.hasParallelCoordinates = options.chart &&
+                options.chart.parallelCoordinates;
+
+            if (this.hasParallelCoordinates) {
+
+                this.setParallelInfo(options);
+
+                // Push empty yAxes in case user did not define them:
+                for (; yAxisLength <= this.parallelInfo.counter; yAxisLength++) {
+                    newYAxes.push({});
+                }
+
+                options = merge(
+                    {
+                        legend: {
+                            enabled: false
+                        }
+                    },
+                    options,
+                    // Disable boost
+                    {
+                        boost: {
+                            seriesThreshold: Number.MAX_SAFE_INTEGER
+                        },
+                        plotOptions: {
+                            series: {
+                                boostThreshold: Number.MAX_SAFE_INTEGER
+                            }
+                        }
+                    }
+                );
+
+                options.yAxis = defaultyAxis.concat(newYAxes);
+                options.xAxis = merge(
+                    defaultXAxisOptions, // docs
+                    splat(options.xAxis || {})[0]
+                );
+            }
+
+            return proceed.call(this, options);
+        });
+
+        /**
+         * Initialize parallelCoordinates
+         */
+        wrap(ChartProto, 'update', function (proceed, options) {
+            if (options.chart) {
+                if (defined(options.chart.parallelCoordinates)) {
+                    this.hasParallelCoordinates = options.chart.parallelCoordinates;
+                }
+
+                if (this.hasParallelCoordinates && options.chart.parallelAxes) {
+                    this.options.chart.parallelAxes = merge(
+                        this.options.chart.parallelAxes,
+                        options.chart.parallelAxes
+                    );
+                    each(this.yAxis, function (axis) {
+                        axis.update({}, false);
+                    });
+                }
+            }
+
+            return proceed.apply(this, Array.prototype.slice.call(arguments, 1));
+        });
+
+        /**
+         * Draw the records into the image and apply the brushes once the
+         * series are rendered.
+         */
+        ChartProto.callbacks.push(function (chart) {
+            chart.renderParallel();
+            addEvent(chart, 'redraw', function () {
+                chart.renderParallel();
+            });
+        });
+
+        extend(ChartProto, /** @lends Highcharts.Chart.prototype */ {
+            /**
+             * Define how many parellel axes we have according to the longest
+             * dataset. This is quite heavy - loop over all series and check
+             * series.data.length Consider:
+             * - make this an option, so user needs to set this to get better
+             *   performance
+             * - check only first series for number of points and assume the
+             *   rest is the same
+             *
+             * @param {Object} options User options
+             */
+            setParallelInfo: function (options) {
+                var chart = this,
+                    seriesOptions = options.series;
+
+                chart.parallelInfo = {
+                    counter: 0
+                };
+
+                each(seriesOptions, function (series) {
+                    if (series.data) {
+                        chart.parallelInfo.counter = Math.max(
+                            chart.parallelInfo.counter,
+                            series.data.length - 1
+                        );
+                    }
+                });
+            },
+
+            /**
+             * Whether the records are drawn into one image.
+             */
+            isParallelRaster: function () {
+                var threshold = this.options.chart.parallelRasterThreshold;
+                return !!(
+                    canvasSupported &&
+                    threshold &&
+                    this.series.length >= threshold
+                );
+            },
+
+            /**
+             * Bring the image and the brushes up to date after the series
+             * are rendered.
+             */
+            renderParallel: function () {
+                var chart = this,
+                    raster = chart.hasParallelCoordinates &&
+                        chart.isParallelRaster(),
+                    redrawRecords = chart.isDirtyParallelRaster;
+
+                if (!raster) {
+                    chart.destroyParallelRaster();
+                }
+
+                if (chart.hasParallelCoordinates && chart.isDirtyParallelBrush) {
+                    chart.updateParallelBrushes();
+                }
+
+                if (raster && redrawRecords) {
+                    chart.drawParallelRaster();
+                }
+                chart.isDirtyParallelRaster = false;
+            },
+
+            /**
+             * Get the canvas and image of a layer of records, the size of the
+             * plot area. Like series, the layers are drawn in the untransformed
+             * coordinates of the axes and inverted with the chart.
+             */
+            getParallelLayer: function (i) {
+                var chart = this,
+                    renderer = chart.renderer,
+                    xAxis = chart.xAxis[0],
+                    yAxis = chart.yAxis[0],
+                    inverted = chart.inverted,
+                    ratio = win.devicePixelRatio || 1,
+                    width = Math.max(1, Math.ceil(xAxis.len)),
+                    height = Math.max(1, Math.ceil(yAxis.len)),
+                    raster = chart.parallelRaster,
+                    layer,
+                    canvas,
+                    ctx;
+
+                if (!raster) {
+                    raster = chart.parallelRaster = {
+                        group: renderer.g('parallel-raster')
+                            .attr({ zIndex: 0.1 })
+                            .add(chart.seriesGroup),
+                        layers: []
+                    };
+                }
+
+                // Same plot box as the series groups
+                raster.group.attr({
+                    translateX: (inverted ? yAxis : xAxis).left,
+                    translateY: (inverted ? xAxis : yAxis).top
+                });
+                raster.group.width = yAxis.len;
+                raster.group.height = xAxis.len;
+                raster.group.invert(inverted);
+
+                layer = raster.layers[i];
+                if (!layer) {
+                    canvas = doc.createElement('canvas');
+                    layer = raster.layers[i] = {
+                        canvas: canvas,
+                        ctx: canvas.getContext('2d'),
+                        image: renderer.image('', 0, 0, 0, 0).add(raster.group)
+                    };
+                }
+
+                canvas = layer.canvas;
+                ctx = layer.ctx;
+                if (canvas.width !== width * ratio) {
+                    canvas.width = width * ratio;
+                }
+                if (canvas.height !== height * ratio) {
+                    canvas.height = height * ratio;
+                }
+                ctx.setTransform(1, 0, 0, 1, 0, 0);
+                ctx.clearRect(0, 0, canvas.width, canvas.height);
+                ctx.setTransform(ratio, 0, 0, ratio, 0, 0);
+
+                layer.image.attr({
+                    width: width,
+                    height: height
+                });
+                return layer;
+            },
+
+            destroyParallelRaster: function () {
+                if (this.parallelRaster) {
+                    this.parallelRaster.group.destroy();
+                    delete this.parallelRaster;
+                }
+            },
+
+            /**
+             * Draw all visible records into the lower layer, and the records
+             * within the brushes into the upper one.
+             */
+            drawParallelRaster: function () {
+                var chart = this,
+                    layer = chart.getParallelLayer(0);
+
+                chart.drawParallelRecords(layer);
+                chart.drawParallelSelection();
+            },
+
+            /**
+             * Draw the records that are within the brushes on top of the
+             * dimmed image of all records. Without brushes the upper layer is
+             * empty.
+             */
+            drawParallelSelection: function () {
+                var chart = this,
+                    brushed = chart.parallelBrushed,
+                    brushOptions = chart.options.chart.parallelAxes.brush,
+                    layer;
+
+                if (!chart.parallelRaster) {
+                    return;
+                }
+
+                layer = chart.getParallelLayer(1);
+                if (brushed) {
+                    chart.drawParallelRecords(layer, chart.parallelSelected);
+                } else {
+                    layer.image.attr({ href: '' });
+                }
+                chart.parallelRaster.layers[0].image.attr({
+                    opacity: brushed ? brushOptions.inactiveOpacity : 1
+                });
+            },
+
+            /**
+             * Stroke each record as a line through its points, so that the
+             * opacity of overlapping records adds up. With selected flags,
+             * only the flagged records are drawn.
+             */
+            drawParallelRecords: function (layer, selected) {
+                var chart = this,
+                    ctx = layer.ctx,
+                    series = chart.series,
+                    styles = {},
+                    strokeStyle,
+                    lineWidth,
+                    style,
+                    points,
+                    point,
+                    moved,
+                    i,
+                    j;
+
+                ctx.globalAlpha = chart.options.chart.parallelRasterOpacity;
+                ctx.lineJoin = 'round';
+                ctx.lineCap = 'round';
+
+                for (i = 0; i < series.length; i++) {
+                    if (!series[i].visible || (selected && !selected[i])) {
+                        continue;
+                    }
+
+                    style = chart.getParallelRecordStyle(series[i], styles);
+                    if (style.color !== strokeStyle) {
+                        ctx.strokeStyle = strokeStyle = style.color;
+                    }
+                    if (style.width !== lineWidth) {
+                        ctx.lineWidth = lineWidth = style.width;
+                    }
+
+                    points = series[i].points || [];
+                    moved = false;
+                    ctx.beginPath();
+                    for (j = 0; j < points.length; j++) {
+                        point = points[j];
+                        if (point.isNull || !isNumber(point.plotY)) {
+                            moved = false; // Gap at null values
+                        } else if (moved) {
+                            ctx.lineTo(point.plotX, point.plotY);
+                        } else {
+                            ctx.moveTo(point.plotX, point.plotY);
+                            moved = true;
+                        }
+                    }
+                    ctx.stroke();
+                }
+
+                layer.image.attr({
+                    href: layer.canvas.toDataURL('image/png')
+                });
+            },
+
+            /**
+             * The color and width of the line of a record.
+             */
+            getParallelRecordStyle: function (series, styles) {
+                var key = series.colorIndex + ' ' + (series.options.className || ''),
+                    probe,
+                    computed;
+
+                // The style sheet gives the colors, read them from a graph of
+                // each color class once per drawing
+                if (!styles[key]) {
+                    probe = this.renderer.path(['M', 0, 0])
+                        .addClass(
+                            'highcharts-graph highcharts-color-' +
+                            series.colorIndex + ' ' +
+                            (series.options.className || '')
+                        )
+                        .add(this.parallelRaster.group);
+                    computed = win.getComputedStyle &&
+                        win.getComputedStyle(probe.element);
+                    styles[key] = {
+                        color: (computed && computed.stroke) || '#000000',
+                        width: (computed && parseFloat(computed.strokeWidth)) || 1
+                    };
+                    probe.destroy();
+                }
+                return styles[key];
+            },
+
+            /**
+             * Count for each record how many brushes it is within, and apply
+             * the selection to all records. Needed when records or axes have
+             * changed since the brushes were last applied.
+             */
+            updateParallelBrushes: function () {
+                var chart = this,
+                    hits = new Int32Array(chart.series.length),
+                    selected = new Uint8Array(chart.series.length),
+                    brushed = 0,
+                    i;
+
+                // Records start out selected, as they are drawn
+                for (i = 0; i < selected.length; i++) {
+                    selected[i] = 1;
+                }
+                chart.isDirtyParallelBrush = false;
+                chart.parallelHits = hits;
+                chart.parallelSelected = selected;
+
+                each(chart.yAxis, function (axis) {
+                    var index,
+                        slice,
+                        k;
+
+                    delete axis.brushSlice;
+                    if (axis.brush) {
+                        index = axis.getBrushIndex();
+                        slice = axis.brushSlice = axis.getBrushSlice();
+                        for (k = slice.start; k < slice.end; k++) {
+                            hits[index.records[k]]++;
+                        }
+                        brushed++;
+                    }
+                });
+
+                // Without brushes before or now, no record is dimmed
+                chart.selectParallelRecords(
+                    null,
+                    !!(brushed || chart.parallelBrushed)
+                );
+                chart.parallelBrushed = brushed;
+            },
+
+            /**
+             * Move the brush of an axis without counting all records again.
+             * The records of the axis are sorted by value, so the records
+             * entering or leaving the brush are the ones between the old and
+             * new ends of its slice.
+             */
+            moveParallelBrush: function (axis) {
+                var chart = this,
+                    hits = chart.parallelHits,
+                    records,
+                    from,
+                    to,
+                    changed = [],
+                    brushed = chart.parallelBrushed;
+
+                if (chart.isDirtyParallelBrush || !hits) {
+                    chart.updateParallelBrushes();
+                    return;
+                }
+
+                records = axis.getBrushIndex().records;
+                from = axis.brushSlice || { start: 0, end: 0 };
+                to = axis.brush ? axis.getBrushSlice() : { start: 0, end: 0 };
+
+                function count(start, end, delta) {
+                    var k;
+                    for (k = start; k < end; k++) {
+                        hits[records[k]] += delta;
+                        changed.push(records[k]);
+                    }
+                }
+
+                // Records leaving and entering the slice
+                count(from.start, Math.min(from.end, to.start), -1);
+                count(Math.max(from.start, to.end), from.end, -1);
+                count(to.start, Math.min(to.end, from.start), 1);
+                count(Math.max(to.start, from.end), to.end, 1);
+
+                if (axis.brushSlice && !axis.brush) {
+                    brushed--;
+                } else if (!axis.brushSlice && axis.brush) {
+                    brushed++;
+                }
+                if (axis.brush) {
+                    axis.brushSlice = to;
+                } else {
+                    delete axis.brushSlice;
+                }
+
+                // Adding or removing a brush changes the count that all
+                // records need to reach
+                if (brushed !== chart.parallelBrushed) {
+                    chart.parallelBrushed = brushed;
+                    chart.selectParallelRecords(null, true);
+                } else {
+                    chart.selectParallelRecords(changed);
+                }
+            },
+
+            /**
+             * Select the given records, or all, that are within every brush,
+             * and dim the others. Only records whose selection changed are
+             * touched, unless forced.
+             */
+            selectParallelRecords: function (records, force) {
+                var chart = this,
+                    series = chart.series,
+                    hits = chart.parallelHits,
+                    selectedFlags = chart.parallelSelected,
+                    brushed = chart.parallelBrushed,
+                    raster = chart.parallelRaster,
+                    opacity = chart.options.chart.parallelAxes.brush.inactiveOpacity,
+                    changed = force,
+                    len = records ? records.length : series.length,
+                    selected,
+                    i,
+                    j;
+
+                for (j = 0; j < len; j++) {
+                    i = records ? records[j] : j;
+                    selected = !brushed || hits[i] === brushed ? 1 : 0;
+                    if (force || selected !== selectedFlags[i]) {
+                        selectedFlags[i] = selected;
+                        changed = true;
+                        if (!raster) {
+                            each(
+                                ['group', 'markerGroup', 'dataLabelsGroup'],
+                                function (key) {
+                                    if (series[i][key]) {
+                                        series[i][key].attr({
+                                            opacity: selected ? 1 : opacity
+                                        });
+                                    }
+                                }
+                            );
+                        }
+                    }
+                }
+
+                if (raster && changed) {
+                    chart.drawParallelSelection();
+                }
+            }
+        });
+
+        // On update, keep parallelPosition.
+        AxisProto.keepProps.push('parallelPosition', 'brush');
+
+        /**
+         * Update default options with predefined for a parallel coords.
+         */
+        wrap(AxisProto, 'setOptions', function (proceed, userOptions) {
+            var axis = this,
+                chart = axis.chart,
+                axisPosition = ['left', 'width', 'height', 'top'];
+
+            proceed.apply(axis, Array.prototype.slice.call(arguments, 1));
+
+            if (chart.hasParallelCoordinates) {
+                if (chart.inverted) {
+                    axisPosition = axisPosition.reverse();
+                }
+
+                if (axis.isXAxis) {
+                    axis.options = merge(
+                        axis.options,
+                        defaultXAxisOptions,
+                        userOptions
+                    );
+                } else {
+                    axis.options = merge(
+                        axis.options,
+                        axis.chart.options.chart.parallelAxes,
+                        userOptions
+                    );
+                    axis.parallelPosition = pick(
+                        axis.parallelPosition,
+                        chart.yAxis.length
+                    );
+                    axis.setParallelPosition(axisPosition, axis.options);
+                }
+            }
+        });
+
+        /**
+         * Each axis should gather extremes from points on a particular position
+         * in series.data. Not like the default one, which gathers extremes from
+         * all series bind to this axis. Consider using series.points instead of
+         * series.yData.
+         */
+        wrap(AxisProto, 'getSeriesExtremes', function (proceed) {
+            if (this.chart.hasParallelCoordinates && !this.isXAxis) {
+                var index = this.parallelPosition,
+                    currentPoints = [];
+
+                each(this.series, function (series) {
+                    if (defined(series.yData[index])) {
+                        // We need to use push() beacause of null points
+                        currentPoints.push(series.yData[index]);
+                    }
+                });
+                this.dataMin = arrayMin(currentPoints);
+                this.dataMax = arrayMax(currentPoints);
+
+                // The values have changed, sort them again when brushing
+                this.brushIndex = null;
+                this.chart.isDirtyParallelBrush = true;
+            } else {
+                proceed.apply(this, Array.prototype.slice.call(arguments, 1));
+            }
+        });
+
+        /**
+         * Draw the brush of parallel axes along with the axis.
+         */
+        wrap(AxisProto, 'render', function (proceed) {
+            proceed.apply(this, Array.prototype.slice.call(arguments, 1));
+
+            if (this.chart.hasParallelCoordinates && this.coll === 'yAxis') {
+                this.renderBrush();
+            }
+        });
+
+        wrap(AxisProto, 'destroy', function (proceed) {
+            this.destroyBrush();
+            return proceed.apply(this, Array.prototype.slice.call(arguments, 1));
+        });
+
+        extend(AxisProto, /** @lends Highcharts.Axis.prototype */ {
+            /**
+             * Set predefined left+width and top+height (inverted) for yAxes.
+             * This method modifies options param.
+             *
+             * @param  {Array} axisPosition
+             * ['left', 'width', 'height', 'top'] or ['top', 'height', 'width', 'left']
+             * for an inverted chart.
+             * @param  {Object} options {@link Highcharts.Axis#options}.
+             */
+            setParallelPosition: function (axisPosition, options) {
+                options[axisPosition[0]] = 100 * (this.parallelPosition + 0.5) /
+                    (this.chart.parallelInfo.counter + 1) + '%';
+                this[axisPosition[1]] = options[axisPosition[1]] = 0;
+
+                // In case of chart.update(inverted), remove old options:
+                this[axisPosition[2]] = options[axisPosition[2]] = null;
+                this[axisPosition[3]] = options[axisPosition[3]] = null;
+            },
+
+            /**
+             * Brush the axis from one value to another. The records with
+             * values outside of the brushed ranges are dimmed. Without values
+             * the brush is removed.
+             *
+             * @param {Number} [from] The lower end of the brushed range.
+             * @param {Number} [to] The upper end of the brushed range.
+             */
+            setBrush: function (from, to) {
+                var axis = this;
+
+                axis.brush = isNumber(from) && isNumber(to) ? {
+                    from: Math.min(from, to),
+                    to: Math.max(from, to)
+                } : undefined;
+
+                axis.renderBrush();
+                axis.chart.moveParallelBrush(axis);
+
+                fireEvent(axis, 'brush', extend({}, axis.brush));
+            },
+
+            /**
+             * The records that have a value on this axis, sorted by the value.
+             */
+            getBrushIndex: function () {
+                var axis = this,
+                    series = axis.chart.series,
+                    position = axis.parallelPosition,
+                    records = [],
+                    values = [],
+                    sortedValues,
+                    value,
+                    i;
+
+                if (!axis.brushIndex) {
+                    for (i = 0; i < series.length; i++) {
+                        value = series[i].yData && series[i].yData[position];
+                        if (isNumber(value)) {
+                            records.push(i);
+                        }
+                        values[i] = value;
+                    }
+                    records.sort(function (a, b) {
+                        return values[a] - values[b];
+                    });
+
+                    sortedValues = new Float64Array(records.length);
+                    for (i = 0; i < records.length; i++) {
+                        sortedValues[i] = values[records[i]];
+                    }
+                    axis.brushIndex = {
+                        records: new Int32Array(records),
+                        values: sortedValues
+                    };
+                }
+                return axis.brushIndex;
+            },
+
+            /**
+             * The range of the sorted records that are within the brush,
+             * found by binary searches for its ends.
+             */
+            getBrushSlice: function () {
+                var values = this.getBrushIndex().values,
+                    brush = this.brush;
+
+                function search(value, inclusive) {
+                    var low = 0,
+                        high = values.length,
+                        middle;
+                    while (low < high) {
+                        middle = (low + high) >> 1;
+                        if (
+                            values[middle] < value ||
+                            (inclusive && values[middle] === value)
+                        ) {
+                            low = middle + 1;
+                        } else {
+                            high = middle;
+                        }
+                    }
+                    return low;
+                }
+
+                return {
+                    start: search(brush.from),
+                    end: search(brush.to, true)
+                };
+            },
+
+            /**
+             * Render the area along the axis that takes the drag, and the
+             * brushed range.
+             */
+            renderBrush: function () {
+                var axis = this,
+                    renderer = axis.chart.renderer,
+                    options = axis.options.brush,
+                    horiz = axis.horiz,
+                    width = options.width,
+                    brush = axis.brush,
+                    from,
+                    to;
+
+                if (!options.enabled) {
+                    axis.destroyBrush();
+                    return;
+                }
+
+                if (!axis.brushGroup) {
+                    axis.brushGroup = renderer.g('parallel-brush')
+                        .attr({ zIndex: 7 })
+                        .add();
+                    axis.brushTracker = renderer.rect()
+                        .addClass('highcharts-parallel-brush-tracker')
+                        .css({
+                            cursor: horiz ? 'ew-resize' : 'ns-resize'
+                        })
+                        .add(axis.brushGroup);
+                    axis.brushRect = renderer.rect()
+                        .addClass('highcharts-parallel-brush')
+                        .css({
+                            pointerEvents: 'none'
+                        })
+                        .add(axis.brushGroup);
+
+                    each(['mousedown', 'touchstart'], function (type) {
+                        addEvent(axis.brushTracker.element, type, function (e) {
+                            axis.onBrushStart(e);
+                        });
+                    });
+                }
+
+                axis.brushTracker.attr(horiz ? {
+                    x: axis.left,
+                    y: axis.top - width / 2,
+                    width: axis.len,
+                    height: width
+                } : {
+                    x: axis.left - width / 2,
+                    y: axis.top,
+                    width: width,
+                    height: axis.len
+                });
+
+                if (brush) {
+                    from = Math.min(
+                        Math.max(axis.toPixels(brush.from), axis.pos),
+                        axis.pos + axis.len
+                    );
+                    to = Math.min(
+                        Math.max(axis.toPixels(brush.to), axis.pos),
+                        axis.pos + axis.len
+                    );
+                    axis.brushRect.attr(horiz ? {
+                        x: Math.min(from, to),
+                        y: axis.top - width / 2,
+                        width: Math.abs(to - from),
+                        height: width
+                    } : {
+                        x: axis.left - width / 2,
+                        y: Math.min(from, to),
+                        width: width,
+                        height: Math.abs(to - from)
+                    }).show();
+                } else {
+                    axis.brushRect.hide();
+                }
+            },
+
+            destroyBrush: function () {
+                if (this.brushGroup) {
+                    this.brushGroup.destroy();
+                    delete this.brushGroup;
+                    delete this.brushTracker;
+                    delete this.brushRect;
+                }
+            },
+
+            /**
+             * Follow a drag along the axis until it is released. A tap
+             * without dragging removes the brush.
+             */
+            onBrushStart: function (e) {
+                var axis = this,
+                    pointer = axis.chart.pointer,
+                    start = axis.getBrushValue(pointer.normalize(e)),
+                    moved = false,
+                    unbind = [];
+
+                function move(e) {
+                    moved = true;
+                    axis.setBrush(start, axis.getBrushValue(pointer.normalize(e)));
+                    e.preventDefault();
+                }
+
+                function end() {
+                    each(unbind, function (fn) {
+                        fn();
+                    });
+                    if (!moved) {
+                        axis.setBrush();
+                    }
+                }
+
+                each(['mousemove', 'touchmove'], function (type) {
+                    unbind.push(addEvent(doc, type, move));
+                });
+                each(['mouseup', 'touchend', 'touchcancel'], function (type) {
+                    unbind.push(addEvent(doc, type, end));
+                });
+
+                // Keep the pointer from zooming, panning or scrolling
+                e.stopPropagation();
+                e.preventDefault();
+            },
+
+            /**
+             * The axis value at the position of a normalized event, within the
+             * axis.
+             */
+            getBrushValue: function (e) {
+                var axis = this,
+                    pos = axis.horiz ? e.chartX : e.chartY;
+
+                return axis.toValue(
+                    Math.min(Math.max(pos, axis.pos), axis.pos + axis.len)
+                );
+            }
+        });
+
+        /**
+         * Bind each series to each yAxis. yAxis needs a reference to all series
+         * to calculate extremes.
+         */
+        wrap(SeriesProto, 'bindAxes', function (proceed) {
+            if (this.chart.hasParallelCoordinates) {
+                var series = this;
+                each(this.chart.axes, function (axis) {
+                    series.insert(axis.series);
+                    axis.isDirty = true;
+                });
+                series.xAxis = this.chart.xAxis[0];
+                series.yAxis = this.chart.yAxis[0];
+                series.chart.isDirtyParallelBrush = true;
+            } else {
+                proceed.apply(this, Array.prototype.slice.call(arguments, 1));
+            }
+        });
+
+        /**
+         * Translate each point using corresponding yAxis.
+         */
+        wrap(SeriesProto, 'translate', function (proceed) {
+            proceed.apply(this, Array.prototype.slice.call(arguments, 1));
+
+            var series = this,
+                chart = series.chart,
+                points = series.points,
+                dataLength = points && points.length,
+                closestPointRangePx = Number.MAX_VALUE,
+                lastPlotX,
+                point,
+                i;
+
+            if (this.chart.hasParallelCoordinates) {
+                for (i = 0; i < dataLength; i++) {
+                    point = points[i];
+                    if (defined(point.y)) {
+                        point.plotX = point.clientX = chart.inverted ?
+                            chart.plotHeight - chart.yAxis[i].top + chart.plotTop :
+                            chart.yAxis[i].left - chart.plotLeft;
+
+                        point.plotY = chart.yAxis[i]
+                            .translate(point.y, false, true, null, true);
+
+                        if (lastPlotX !== undefined) {
+                            closestPointRangePx = Math.min(
+                                closestPointRangePx,
+                                Math.abs(point.plotX - lastPlotX)
+                            );
+                        }
+                        lastPlotX = point.plotX;
+                        point.isInside = chart.isInsidePlot(
+                            point.plotX,
+                            point.plotY,
+                            chart.inverted
+                        );
+                    } else {
+                        point.isNull = true;
+                    }
+                }
+                this.closestPointRangePx = closestPointRangePx;
+            }
+        });
+
+        /**
+         * Draw large plots into one image. The series are only translated, and
+         * their existing elements are removed.
+         */
+        wrap(SeriesProto, 'render', function (proceed) {
+            var series = this,
+                chart = series.chart;
+
+            if (chart.hasParallelCoordinates && chart.isParallelRaster()) {
+                each(series.points || [], function (point) {
+                    each(['graphic', 'dataLabel'], function (key) {
+                        if (point[key]) {
+                            point[key] = point[key].destroy();
+                        }
+                    });
+                });
+                each(
+                    ['graph', 'tracker', 'group', 'markerGroup', 'dataLabelsGroup'],
+                    function (key) {
+                        if (series[key]) {
+                            series[key] = series[key].destroy();
+                        }
+                    }
+                );
+                series.isDirty = false;
+                series.hasRendered = true;
+                chart.isDirtyParallelRaster = true;
+            } else {
+                proceed.apply(series, Array.prototype.slice.call(arguments, 1));
+            }
+        });
+
+        /**
+         * On destroy, we need to remove series from each axis.series
+         */
+        wrap(SeriesProto, 'destroy', function (proceed) {
+            if (this.chart.hasParallelCoordinates) {
+                var series = this;
+                each(this.chart.axes || [], function (axis) {
+                    if (axis && axis.series) {
+                        erase(axis.series, series);
+                        axis.isDirty = axis.forceRedraw = true;
+                    }
+                });
+                series.chart.isDirtyParallelBrush = true;
+                series.chart.isDirtyParallelRaster = true;
+            }
+            proceed.apply(this, Array.prototype.slice.call(arguments, 1));
+        });
+
+        function addFormattedValue(proceed) {
+            var chart = this.series.chart,
+                config = proceed.apply(
+                    this,
+                    Array.prototype.slice.call(arguments, 1)
+                ),
+                formattedValue,
+                yAxisOptions,
+                labelFormat,
+                yAxis;
+
+            if (chart.hasParallelCoordinates && !defined(config.formattedValue)) {
+                yAxis = chart.yAxis[this.x];
+                yAxisOptions = yAxis.options;
+
+                labelFormat = pick(
+                    /**
+                     * Parallel coordinates only. Format that will be used for
+                     * point.y and available in tooltip.pointFormat as
+                     * {point.formattedValue}. If not set, {point.formattedValue}
+                     * will use other options, in this order:
+                     *
+                     * 1. yAxis.labels.format will be used if set
+                     * 2. if yAxis is a category, then category name will be
+                     *    displayed
+                     * 3. if yAxis is a datetime, then value will use the same
+                     *    format as yAxis labels
+                     * 4. if yAxis is linear/logarithmic type, then simple value
+                     *    will be used
+                     */
+                    yAxisOptions.tooltipValueFormat,
+                    yAxisOptions.labels.format
+                );
+                if (labelFormat) {
+                    formattedValue = H.format(
+                        labelFormat,
+                        extend(
+                            this,
+                            { value: this.y }
+                        )
+                    );
+                } else if (yAxis.isDatetimeAxis) {
+                    formattedValue = H.dateFormat(
+                        yAxisOptions.dateTimeLabelFormats[
+                            yAxis.tickPositions.info.unitName
+                        ],
+                        this.y
+                    );
+                } else if (yAxisOptions.categories) {
+                    formattedValue = yAxisOptions.categories[this.y];
+                } else {
+                    formattedValue = this.y;
+                }
+
+                config.formattedValue = config.point.formattedValue = formattedValue;
+            }
+
+            return config;
+        }
+
+        each(['line', 'spline'], function (seriesName) {
+            wrap(
+                H.seriesTypes[seriesName].prototype.pointClass.prototype,
+                'getLabelConfig',
+                addFormattedValue
+            );
+        });
+
+    }(Highcharts));
+}));
@@ -0,0 +1,870 @@
+/*
+ Highcharts JS v6.0.2 (2017-10-20)
+ Series worker module
+
+ (c) 2009-2017 Highsoft AS
+
+ License: www.highcharts.com/license
+*/
+/**
+ * (c) 2009-2017 Highsoft AS
+ *
+ * License: www.highcharts.com/license
+ *
+ * Series worker module. Moves cropping, closest point range, stacking sums,
+ * data extremes and pixel translation of large cartesian series into a Web
+ * Worker, so the page thread stays free for touch handling while a zoomed
+ * chart is processed. Data is uploaded once per setData as transferable
+ * typed arrays and the translated pixel positions are posted back the same
+ * way.
+ */
+(function (factory) {
+    if (typeof module === 'object' && module.exports) {
+        module.exports = factory;
+    } else {
+        factory(Highcharts);
+    }
+}(function (Highcharts) {
+    (function (H) {
+        var win = H.win,
+            each = H.each,
+            objectEach = H.objectEach,
+            pick = H.pick,
+            wrap = H.wrap,
+            Chart = H.Chart,
+            Series = H.Series,
+            workerState;
+
+        /**
+         * Series with more points than this are processed in the worker.
+         * Set to 0 to disable the worker for a series.
+         */
+        H.setOptions({
+            plotOptions: {
+                series: {
+                    workerThreshold: 50000
+                }
+            }
+        });
+
+        /**
+         * The worker body. It is serialized with toString, so it must not
+         * reference anything outside its own scope.
+         */
+        function workerMain() {
+            var store = {};
+
+            function correctFloat(num) {
+                return parseFloat(num.toPrecision(14));
+            }
+
+            // First index with x >= value in the sorted x data.
+            function lowerBound(xData, value) {
+                var lo = 0,
+                    hi = xData.length,
+                    mid;
+                while (lo < hi) {
+                    mid = (lo + hi) >>> 1;
+                    if (xData[mid] < value) {
+                        lo = mid + 1;
+                    } else {
+                        hi = mid;
+                    }
+                }
+                return lo;
+            }
+
+            // First index with x > value in the sorted x data.
+            function upperBound(xData, value) {
+                var lo = 0,
+                    hi = xData.length,
+                    mid;
+                while (lo < hi) {
+                    mid = (lo + hi) >>> 1;
+                    if (xData[mid] <= value) {
+                        lo = mid + 1;
+                    } else {
+                        hi = mid;
+                    }
+                }
+                return lo;
+            }
+
+            // Same rules as Series.processData and Series.cropData.
+            function crop(item) {
+                var data = store[item.id],
+                    xData = data.xData,
+                    len = xData.length,
+                    start = 0,
+                    end = len,
+                    cropped = false,
+                    closestPointRange,
+                    distance,
+                    i;
+
+                if (
+                    item.canCrop &&
+                    (!item.cropThreshold || len > item.cropThreshold)
+                ) {
+                    if (xData[len - 1] < item.min || xData[0] > item.max) {
+                        start = end = 0;
+                        cropped = true;
+                    } else if (xData[0] < item.min || xData[len - 1] > item.max) {
+                        start = lowerBound(xData, item.min);
+                        end = upperBound(xData, item.max);
+                        if (start < len) {
+                            start = Math.max(0, start - item.cropShoulder);
+                            if (end < len) {
+                                end = end + item.cropShoulder;
+                            }
+                        } else {
+                            start = len;
+                        }
+                        cropped = true;
+                    }
+                }
+                end = Math.min(end, len);
+
+                for (i = end - 1; i > start; i--) {
+                    distance = xData[i] - xData[i - 1];
+                    if (
+                        distance > 0 &&
+                        (closestPointRange === undefined ||
+                            distance < closestPointRange)
+                    ) {
+                        closestPointRange = distance;
+                    }
+                }
+
+                return {
+                    id: item.id,
+                    start: start,
+                    end: end,
+                    cropped: cropped,
+                    closestPointRange: closestPointRange
+                };
+            }
+
+            // Same inclusion rules as Series.getExtremes.
+            function extremes(result, values, offset, min, max) {
+                var xData = store[result.id].xData,
+                    start = result.start,
+                    end = result.end,
+                    dataMin = Infinity,
+                    dataMax = -Infinity,
+                    i,
+                    x,
+                    y;
+
+                for (i = start; i < end; i++) {
+                    y = values[i - offset];
+                    x = xData[i];
+                    if (
+                        y === y &&
+                        (
+                            result.cropped ||
+                            ((i + 1 < end ? xData[i + 1] : x) >= min &&
+                                (i > start ? xData[i - 1] : x) <= max)
+                        )
+                    ) {
+                        if (y < dataMin) {
+                            dataMin = y;
+                        }
+                        if (y > dataMax) {
+                            dataMax = y;
+                        }
+                    }
+                }
+                result.dataMin = dataMin === Infinity ? undefined : dataMin;
+                result.dataMax = dataMax === -Infinity ? undefined : dataMax;
+            }
+
+            /**
+             * Cumulative stack sums for series sharing a stack key, in the
+             * order the y axis builds its stacks. Positive and negative
+             * values are summed separately when the series type has
+             * negative stacks.
+             */
+            function stackSums(results, group) {
+                var pos = {},
+                    neg = {},
+                    sums = {};
+
+                each(group.order, function (id) {
+                    var result = results[id],
+                        data = store[id],
+                        xData = data.xData,
+                        yData = data.yData,
+                        cum = new Float64Array(result.end - result.start),
+                        i,
+                        x,
+                        y,
+                        stack;
+
+                    for (i = result.start; i < result.end; i++) {
+                        x = xData[i];
+                        y = yData[i];
+                        stack = group.negStacks && y < group.threshold ?
+                            neg :
+                            pos;
+                        if (y === y) {
+                            stack[x] = (stack[x] || 0) + y;
+                            cum[i - result.start] = stack[x];
+                        } else {
+                            cum[i - result.start] = NaN;
+                        }
+                    }
+                    sums[id] = cum;
+                });
+                return sums;
+            }
+
+            function each(arr, fn) {
+                for (var i = 0; i < arr.length; i++) {
+                    fn(arr[i], i);
+                }
+            }
+
+            function translateAxis(value, axis, cvsCoord) {
+                var sign = 1,
+                    cvsOffset = 0;
+                if (cvsCoord) {
+                    sign = -1;
+                    cvsOffset = axis.len;
+                }
+                if (axis.reversed) {
+                    sign *= -1;
+                    cvsOffset -= sign * axis.len;
+                }
+                return sign * (value - axis.min) * axis.transA + cvsOffset +
+                    sign * axis.minPixelPadding;
+            }
+
+            function translate(item) {
+                var data = store[item.id],
+                    xData = data.xData,
+                    yData = data.yData,
+                    count = item.end - item.start,
+                    plotX = new Float64Array(count),
+                    plotY = new Float64Array(count),
+                    i,
+                    y;
+
+                for (i = 0; i < count; i++) {
+                    plotX[i] = correctFloat(Math.min(Math.max(
+                        -1e5,
+                        translateAxis(xData[item.start + i], item.xAxis)
+                    ), 1e5));
+                    y = yData[item.start + i];
+                    plotY[i] = y === y ?
+                        Math.min(Math.max(
+                            -1e5,
+                            translateAxis(y, item.yAxis, true)
+                        ), 1e5) :
+                        NaN;
+                }
+                return {
+                    id: item.id,
+                    key: item.key,
+                    plotX: plotX,
+                    plotY: plotY
+                };
+            }
+
+            self.onmessage = function (e) {
+                var msg = e.data,
+                    results = {},
+                    replies = [],
+                    transfer = [];
+
+                if (msg.type === 'setData') {
+                    store[msg.id] = {
+                        xData: msg.xData,
+                        yData: msg.yData
+                    };
+
+                } else if (msg.type === 'remove') {
+                    delete store[msg.id];
+
+                } else if (msg.type === 'crop') {
+                    each(msg.items, function (item) {
+                        if (store[item.id]) {
+                            results[item.id] = crop(item);
+                            replies.push(results[item.id]);
+                        }
+                    });
+                    each(msg.stacks, function (group) {
+                        var sums = stackSums(results, group);
+                        each(group.order, function (id) {
+                            results[id].stacked = true;
+                            extremes(
+                                results[id],
+                                sums[id],
+                                results[id].start,
+                                group.min,
+                                group.max
+                            );
+                        });
+                    });
+                    each(msg.items, function (item) {
+                        var result = results[item.id];
+                        if (result && !result.stacked) {
+                            extremes(
+                                result,
+                                store[item.id].yData,
+                                0,
+                                item.min,
+                                item.max
+                            );
+                        }
+                    });
+                    self.postMessage({ jobId: msg.jobId, results: replies });
+
+                } else if (msg.type === 'translate') {
+                    each(msg.items, function (item) {
+                        var result;
+                        if (store[item.id]) {
+                            result = translate(item);
+                            replies.push(result);
+                            transfer.push(result.plotX.buffer, result.plotY.buffer);
+                        }
+                    });
+                    self.postMessage(
+                        { jobId: msg.jobId, results: replies },
+                        transfer
+                    );
+                }
+            };
+        }
+
+        /**
+         * Lazily start the shared worker. Returns false when the page can not
+         * run workers from a blob, in which case all series are processed on
+         * the page thread as usual.
+         */
+        function getWorker() {
+            var blob,
+                url;
+
+            if (workerState === undefined) {
+                workerState = false;
+                if (win.Worker && win.Blob && win.URL && win.Float64Array) {
+                    try {
+                        blob = new win.Blob(
+                            ['(' + workerMain.toString() + ')();'],
+                            { type: 'application/javascript' }
+                        );
+                        url = win.URL.createObjectURL(blob);
+                        workerState = {
+                            worker: new win.Worker(url),
+                            callbacks: {},
+                            jobId: 0,
+                            seriesId: 0
+                        };
+                        workerState.worker.onmessage = function (e) {
+                            var callback = workerState.callbacks[e.data.jobId];
+                            delete workerState.callbacks[e.data.jobId];
+                            if (callback) {
+                                callback(e.data.results);
+                            }
+                        };
+                    } catch (e) {
+                        workerState = false;
+                    }
+                }
+            }
+            return workerState;
+        }
+
+        function postJob(msg, transfer, callback) {
+            var state = getWorker();
+            msg.jobId = ++state.jobId;
+            state.callbacks[msg.jobId] = callback;
+            state.worker.postMessage(msg, transfer || []);
+        }
+
+        function axisTransform(axis) {
+            return {
+                min: axis.min,
+                transA: axis.transA,
+                minPixelPadding: axis.minPixelPadding,
+                reversed: !!axis.reversed,
+                len: axis.len
+            };
+        }
+
+        function sameTransform(a, b) {
+            return a && b &&
+                a.min === b.min &&
+                a.transA === b.transA &&
+                a.minPixelPadding === b.minPixelPadding &&
+                a.reversed === b.reversed &&
+                a.len === b.len;
+        }
+
+        /**
+         * Whether the series qualifies for worker processing. Only simple
+         * one-value series on linear axes are handled, everything else is
+         * left to the regular pipeline.
+         */
+        Series.prototype.useWorker = function () {
+            var series = this,
+                xAxis = series.xAxis,
+                yAxis = series.yAxis,
+                threshold = series.options.workerThreshold;
+
+            return !!(
+                threshold &&
+                series.isCartesian &&
+                series.sorted &&
+                !series.pointArrayMap &&
+                !series.hasGroupedData &&
+                !series.getExtremesFromAll &&
+                !series.options.getExtremesFromAll &&
+                !series.options.pointPlacement &&
+                !series.options.startFromThreshold &&
+                series.options.stacking !== 'percent' &&
+                !(series.isSeriesBoosting) &&
+                xAxis && yAxis &&
+                !xAxis.isLog && !xAxis.isOrdinal && !xAxis.isBroken &&
+                !yAxis.isLog && !yAxis.isBroken &&
+                series.xData &&
+                series.xData.length >= threshold &&
+                getWorker()
+            );
+        };
+
+        /**
+         * Upload the series data to the worker when it has changed since the
+         * last upload. The arrays are copied into typed arrays and their
+         * buffers transferred, so the page thread keeps no second copy.
+         */
+        Series.prototype.uploadWorkerData = function () {
+            var series = this,
+                xData = series.xData,
+                yData = series.yData,
+                len = xData.length,
+                xTyped,
+                yTyped,
+                i,
+                y;
+
+            // setData with as many points updates them in place, so the
+            // arrays are the same but the data is dirty
+            if (
+                !series.isDirtyData &&
+                series.workerXData === xData &&
+                series.workerDataLength === len
+            ) {
+                return;
+            }
+
+            xTyped = new win.Float64Array(len);
+            yTyped = new win.Float64Array(len);
+            for (i = 0; i < len; i++) {
+                xTyped[i] = xData[i];
+                y = yData[i];
+                yTyped[i] = typeof y === 'number' ? y : NaN;
+            }
+
+            if (series.workerId === undefined) {
+                series.workerId = 'series-' + (++getWorker().seriesId);
+            }
+            getWorker().worker.postMessage({
+                type: 'setData',
+                id: series.workerId,
+                xData: xTyped,
+                yData: yTyped
+            }, [xTyped.buffer, yTyped.buffer]);
+
+            series.workerXData = xData;
+            series.workerDataLength = len;
+            series.workerVersion = (series.workerVersion || 0) + 1;
+            delete series.workerCrop;
+            delete series.workerTranslation;
+        };
+
+        /**
+         * Predict the x axis extremes the next redraw will crop to. Unzoomed
+         * axes are not cropped, so they need no prediction.
+         */
+        function predictExtremes(axis) {
+            return {
+                min: pick(axis.userMin, axis.options.min, -Infinity),
+                max: pick(axis.userMax, axis.options.max, Infinity)
+            };
+        }
+
+        function cropKey(series, extremes) {
+            return [series.workerVersion, extremes.min, extremes.max].join(',');
+        }
+
+        /**
+         * Whether the worker results of a series are missing or out of date
+         * for the data and x extremes of the next redraw, or for the members
+         * of its stack.
+         */
+        function needsCrop(series) {
+            return series.isDirtyData ||
+                series.workerXData !== series.xData ||
+                series.workerDataLength !== series.xData.length ||
+                !series.workerCrop ||
+                series.workerCrop.key !==
+                    cropKey(series, predictExtremes(series.xAxis)) ||
+                series.workerCrop.stackMembers !== series.workerStackMembers;
+        }
+
+        /**
+         * The stack a stacked series is summed in, by y axis and the stack
+         * key Chart.getStacks gives it.
+         */
+        function stackGroupKey(series) {
+            return series.yAxis.index + ':' + series.type +
+                pick(series.options.stack, '');
+        }
+
+        /**
+         * Run the crop, stacking and extremes pass for the given series.
+         */
+        function runCrop(chart, seriesList, callback) {
+            var items = [],
+                stacks = {},
+                stackList = [],
+                byId = {};
+
+            each(seriesList, function (series) {
+                var extremes = predictExtremes(series.xAxis),
+                    options = series.options,
+                    group;
+
+                series.uploadWorkerData();
+                byId[series.workerId] = series;
+                series.workerPendingKey = cropKey(series, extremes);
+                items.push({
+                    id: series.workerId,
+                    min: extremes.min,
+                    max: extremes.max,
+                    canCrop: true,
+                    cropThreshold: options.cropThreshold,
+                    cropShoulder: pick(series.cropShoulder, 1)
+                });
+
+                if (options.stacking && series.visible) {
+                    group = stacks[stackGroupKey(series)];
+                    if (!group) {
+                        group = stacks[stackGroupKey(series)] = {
+                            order: [],
+                            min: extremes.min,
+                            max: extremes.max,
+                            threshold: pick(options.threshold, 0),
+                            negStacks: !!series.negStacks,
+                            reversed: pick(
+                                series.yAxis.options.reversedStacks,
+                                true
+                            )
+                        };
+                        stackList.push(group);
+                    }
+                    group.order.push(series.workerId);
+                }
+            });
+
+            // Match the order Axis.buildStacks walks the series in
+            each(stackList, function (group) {
+                if (group.reversed) {
+                    group.order.reverse();
+                }
+            });
+
+            postJob({
+                type: 'crop',
+                items: items,
+                stacks: stackList
+            }, null, function (results) {
+                each(results, function (result) {
+                    var series = byId[result.id];
+                    if (series && series.workerXData) {
+                        result.key = series.workerPendingKey;
+                        result.stackMembers = series.workerStackMembers;
+                        series.workerCrop = result;
+                    }
+                });
+                callback();
+            });
+        }
+
+        /**
+         * Run the pixel translation pass against the current axis transforms.
+         */
+        function runTranslate(seriesList, callback) {
+            var items = [],
+                byId = {};
+
+            each(seriesList, function (series) {
+                var crop = series.workerCrop;
+                if (crop && !series.options.stacking) {
+                    byId[series.workerId] = series;
+                    items.push({
+                        id: series.workerId,
+                        key: crop.key,
+                        start: crop.start,
+                        end: crop.end,
+                        xAxis: axisTransform(series.xAxis),
+                        yAxis: axisTransform(series.yAxis)
+                    });
+                }
+            });
+
+            if (!items.length) {
+                return callback();
+            }
+
+            postJob({ type: 'translate', items: items }, null, function (results) {
+                each(results, function (result, i) {
+                    var series = byId[result.id];
+                    if (series) {
+                        result.xAxis = items[i].xAxis;
+                        result.yAxis = items[i].yAxis;
+                        series.workerTranslation = result;
+                    }
+                });
+                callback();
+            });
+        }
+
+        /**
+         * Use the worker crop when it was computed for the extremes the axis
+         * actually ended up with.
+         */
+        wrap(Series.prototype, 'processData', function (proceed, force) {
+            var series = this,
+                crop = series.workerCrop,
+                xAxis = series.xAxis,
+                predicted,
+                extremes;
+
+            if (
+                crop &&
+                series.useWorker() &&
+                series.workerXData === series.xData &&
+                series.workerDataLength === series.xData.length
+            ) {
+                if (
+                    !series.isDirty && !xAxis.isDirty &&
+                    !series.yAxis.isDirty && !force
+                ) {
+                    return false;
+                }
+                extremes = xAxis.getExtremes();
+                predicted = predictExtremes(xAxis);
+                if (
+                    crop.key === cropKey(series, predicted) &&
+                    (!crop.cropped ||
+                        (extremes.min === predicted.min &&
+                            extremes.max === predicted.max))
+                ) {
+                    series.cropped = crop.cropped;
+                    series.cropStart = crop.start;
+                    series.processedXData = crop.cropped ?
+                        series.xData.slice(crop.start, crop.end) :
+                        series.xData;
+                    series.processedYData = crop.cropped ?
+                        series.yData.slice(crop.start, crop.end) :
+                        series.yData;
+                    series.closestPointRange = crop.closestPointRange;
+                    series.workerCropApplied = crop;
+                    return;
+                }
+            }
+            series.workerCropApplied = null;
+            return proceed.call(series, force);
+        });
+
+        /**
+         * The worker extremes apply to the default y values only, explicit
+         * value arrays from other modules are computed as usual.
+         */
+        wrap(Series.prototype, 'getExtremes', function (proceed, yData) {
+            var crop = this.workerCropApplied;
+            if (
+                !yData &&
+                crop &&
+                crop.stacked === !!(this.options.stacking && this.visible)
+            ) {
+                this.dataMin = crop.dataMin;
+                this.dataMax = crop.dataMax;
+                return;
+            }
+            return proceed.call(this, yData);
+        });
+
+        /**
+         * Apply the worker pixel positions when both axis transforms are the
+         * ones the worker translated with. Stacked series are translated on
+         * the page thread since their positions come from the stack items.
+         */
+        wrap(Series.prototype, 'translate', function (proceed) {
+            var series = this,
+                result = series.workerTranslation,
+                crop = series.workerCropApplied,
+                xAxis = series.xAxis,
+                yAxis = series.yAxis,
+                categories = xAxis.categories,
+                threshold = series.options.threshold,
+                points,
+                point,
+                plotX,
+                plotY,
+                lastPlotX,
+                closestPointRangePx = Number.MAX_VALUE,
+                i;
+
+            if (
+                !result ||
+                !crop ||
+                result.key !== crop.key ||
+                series.options.stacking ||
+                series.modifyValue ||
+                !sameTransform(result.xAxis, axisTransform(xAxis)) ||
+                !sameTransform(result.yAxis, axisTransform(yAxis))
+            ) {
+                return proceed.call(series);
+            }
+
+            series.generatePoints();
+            points = series.points;
+
+            for (i = 0; i < points.length; i++) {
+                point = points[i];
+                plotX = result.plotX[i];
+                plotY = result.plotY[i];
+                point.plotX = plotX;
+                point.yBottom = null;
+                point.plotY = plotY === plotY ? plotY : undefined;
+                point.isInside = point.plotY !== undefined &&
+                    plotY >= 0 && plotY <= yAxis.len &&
+                    plotX >= 0 && plotX <= xAxis.len;
+                point.clientX = plotX;
+                point.negative = point.y < (threshold || 0);
+                point.category = categories && categories[point.x] !== undefined ?
+                    categories[point.x] :
+                    point.x;
+                if (!point.isNull) {
+                    if (lastPlotX !== undefined) {
+                        closestPointRangePx = Math.min(
+                            closestPointRangePx,
+                            Math.abs(plotX - lastPlotX)
+                        );
+                    }
+                    lastPlotX = plotX;
+                }
+                point.zone = series.zones.length && point.getZone();
+            }
+            series.closestPointRangePx = closestPointRangePx;
+        });
+
+        wrap(Series.prototype, 'destroy', function (proceed) {
+            if (this.workerId !== undefined && workerState) {
+                workerState.worker.postMessage({
+                    type: 'remove',
+                    id: this.workerId
+                });
+            }
+            return proceed.apply(this, Array.prototype.slice.call(arguments, 1));
+        });
+
+        /**
+         * When a redraw changes the x extremes of worker series, run the crop
+         * and translation passes in the worker first and redraw once they are
+         * back. In between the chart keeps showing the previous frame.
+         */
+        wrap(Chart.prototype, 'redraw', function (proceed, animation) {
+            var chart = this,
+                stackGroups = {},
+                queued = {},
+                pending = [];
+
+            if (chart.workerRedrawing || !chart.hasRendered) {
+                return proceed.call(chart, animation);
+            }
+
+            each(chart.series, function (series) {
+                var key;
+                series.workerStackMembers = undefined;
+                if (series.visible && series.options.stacking) {
+                    key = stackGroupKey(series);
+                    (stackGroups[key] = stackGroups[key] || []).push(series);
+                }
+            });
+            objectEach(stackGroups, function (members) {
+                var indexes = H.map(members, function (series) {
+                    return series.index;
+                }).join(',');
+                each(members, function (series) {
+                    series.workerStackMembers = indexes;
+                });
+            });
+
+            each(chart.series, function (series) {
+                if (series.visible && series.useWorker() && needsCrop(series)) {
+                    queued[series.index] = true;
+                }
+            });
+
+            // The stack sums of a series take every member of its stack, so
+            // a member that is cropped again brings the others along. A stack
+            // with a member the worker does not take is processed on the page
+            // thread, with the stale worker results of the others dropped.
+            objectEach(stackGroups, function (members) {
+                var touched = false,
+                    eligible = true;
+                each(members, function (series) {
+                    touched = touched || queued[series.index];
+                    eligible = eligible && series.useWorker();
+                });
+                if (touched) {
+                    each(members, function (series) {
+                        queued[series.index] = eligible;
+                        if (!eligible) {
+                            delete series.workerCrop;
+                            delete series.workerTranslation;
+                        }
+                    });
+                }
+            });
+
+            // In the order of the chart, which is the order of the stacks
+            each(chart.series, function (series) {
+                if (queued[series.index]) {
+                    pending.push(series);
+                }
+            });
+
+            if (!pending.length) {
+                return proceed.call(chart, animation);
+            }
+
+            chart.workerRedrawing = true;
+            runCrop(chart, pending, function () {
+                if (!chart.series) { // destroyed meanwhile
+                    return;
+                }
+                // Settle the axes so the translation uses final transforms
+                each(chart.axes, function (axis) {
+                    axis.setScale();
+                });
+                runTranslate(pending, function () {
+                    if (!chart.series) {
+                        return;
+                    }
+                    try {
+                        proceed.call(chart, animation);
+                    } finally {
+                        chart.workerRedrawing = false;
+                    }
+                });
+            });
+        });
+
+    }(Highcharts));
+}));
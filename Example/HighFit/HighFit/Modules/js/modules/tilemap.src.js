@@ -0,0 +1,1416 @@
+/*
+  Highcharts JS v6.0.2 (2017-10-20)
+ Tilemap module
+
+ (c) 2010-2017 Highsoft AS
+
+ License: www.highcharts.com/license
+*/
+/**
+ * (c) 2010-2017 Highsoft AS
+ *
+ * License: www.highcharts.com/license
+ *
+ * Tilemap module. Bundles the heatmap series, which tilemaps extend with
+ * hexagon, diamond, circle and square tiles. Large tilemaps are traced into
+ * one image like heatmaps, and the tile under the pointer is the closest of
+ * the cells around its grid position.
+ */
+(function (factory) {
+    if (typeof module === 'object' && module.exports) {
+        module.exports = factory;
+    } else {
+        factory(Highcharts);
+    }
+}(function (Highcharts) {
+    (function (H) {
+        var defined = H.defined,
+            each = H.each,
+            noop = H.noop,
+            seriesTypes = H.seriesTypes;
+
+        /**
+         * Mixin for maps and heatmaps
+         */
+        H.colorPointMixin = {
+            /**
+             * Color points have a value option that determines whether or not
+             * it is a null point
+             */
+            isValid: function () {
+                return this.value !== null;
+            },
+
+            /**
+             * Set the visibility of a single point
+             */
+            setVisible: function (vis) {
+                var point = this,
+                    method = vis ? 'show' : 'hide';
+
+                // Cells drawn into the image of a heatmap are left out of it
+                point.visible = vis;
+
+                // Show and hide associated elements
+                each(['graphic', 'dataLabel'], function (key) {
+                    if (point[key]) {
+                        point[key][method]();
+                    }
+                });
+            },
+
+            setState: function (state) {
+                var point = this,
+                    series = point.series;
+
+                // A cell drawn into the image gets an element of its own while
+                // it is hovered or selected
+                if (series.rasterLayer && state && !point.graphic) {
+                    series.drawRasterState(point);
+                }
+
+                H.Point.prototype.setState.call(point, state);
+                if (point.graphic) {
+                    point.graphic.attr({
+                        zIndex: state === 'hover' ? 1 : 0
+                    });
+                }
+
+                if (
+                    series.rasterLayer &&
+                    !point.state &&
+                    !point.selected &&
+                    point.graphic
+                ) {
+                    point.graphic = point.graphic.destroy();
+                }
+            }
+        };
+
+        H.colorSeriesMixin = {
+            pointArrayMap: ['value'],
+            axisTypes: ['xAxis', 'yAxis', 'colorAxis'],
+            optionalAxis: 'colorAxis',
+            trackerGroups: ['group', 'markerGroup', 'dataLabelsGroup'],
+            getSymbol: noop,
+            parallelArrays: ['x', 'y', 'value'],
+            colorKey: 'value',
+
+
+            /**
+             * In choropleth maps, the color is a result of the value, so this
+             * needs translation too
+             */
+            translateColors: function () {
+                var series = this,
+                    nullColor = this.options.nullColor,
+                    colorAxis = this.colorAxis,
+                    colorKey = this.colorKey;
+
+                each(this.data, function (point) {
+                    var value = point[colorKey],
+                        color;
+
+                    color = point.options.color ||
+                        (
+                            point.isNull ?
+                                nullColor :
+                                (colorAxis && value !== undefined) ?
+                                    colorAxis.toColor(value, point) :
+                                    point.color || series.color
+                        );
+
+                    if (color) {
+                        point.color = color;
+                    }
+                });
+            },
+
+            /**
+             * Get the color attributes to apply on the graphic
+             */
+            colorAttribs: function (point) {
+                var ret = {};
+                if (defined(point.color)) {
+                    ret[this.colorProp || 'fill'] = point.color;
+                }
+                return ret;
+            }
+        };
+    }(Highcharts));
+    (function (H) {
+        var colorPointMixin = H.colorPointMixin,
+            doc = H.doc,
+            each = H.each,
+            isNumber = H.isNumber,
+            merge = H.merge,
+            noop = H.noop,
+            pick = H.pick,
+            Pointer = H.Pointer,
+            Series = H.Series,
+            seriesType = H.seriesType,
+            seriesTypes = H.seriesTypes,
+            win = H.win,
+            canvasSupported = !!(
+                doc.createElement('canvas').getContext &&
+                doc.createElement('canvas').getContext('2d')
+            );
+
+        /**
+         * Trace the shape of a cell into the canvas context. Tiles are
+         * rectangles, circles, or paths of straight lines.
+         */
+        function traceTile(ctx, point) {
+            var shapeArgs = point.shapeArgs,
+                path,
+                command,
+                i = 0;
+
+            if (point.shapeType === 'circle') {
+                ctx.moveTo(shapeArgs.x + shapeArgs.r, shapeArgs.y);
+                ctx.arc(shapeArgs.x, shapeArgs.y, shapeArgs.r, 0, 2 * Math.PI, false);
+            } else if (point.shapeType === 'path') {
+                path = shapeArgs.d;
+                while (i < path.length) {
+                    if (typeof path[i] === 'string') {
+                        command = path[i];
+                        i++;
+                    }
+                    if (command === 'M') {
+                        ctx.moveTo(path[i], path[i + 1]);
+                        i += 2;
+                        command = 'L'; // Implicit lineTo after moveTo
+                    } else if (command === 'L') {
+                        ctx.lineTo(path[i], path[i + 1]);
+                        i += 2;
+                    } else {
+                        ctx.closePath();
+                    }
+                }
+            } else {
+                ctx.rect(shapeArgs.x, shapeArgs.y, shapeArgs.width, shapeArgs.height);
+            }
+        }
+
+        /**
+         * The bounding box of the shape of a cell.
+         */
+        function getTileBox(point) {
+            var shapeArgs = point.shapeArgs,
+                path,
+                i,
+                x,
+                y,
+                box;
+
+            if (point.shapeType === 'circle') {
+                return {
+                    x: shapeArgs.x - shapeArgs.r,
+                    y: shapeArgs.y - shapeArgs.r,
+                    width: 2 * shapeArgs.r,
+                    height: 2 * shapeArgs.r
+                };
+            }
+            if (point.shapeType === 'path') {
+                path = shapeArgs.d;
+                box = { x: Infinity, y: Infinity, x2: -Infinity, y2: -Infinity };
+                for (i = 0; i < path.length; i++) {
+                    if (typeof path[i] !== 'string') {
+                        x = path[i];
+                        y = path[++i];
+                        box.x = Math.min(box.x, x);
+                        box.y = Math.min(box.y, y);
+                        box.x2 = Math.max(box.x2, x);
+                        box.y2 = Math.max(box.y2, y);
+                    }
+                }
+                box.width = box.x2 - box.x;
+                box.height = box.y2 - box.y;
+                return box;
+            }
+            return shapeArgs;
+        }
+
+        /**
+         * The heatmap code is bundled in the tilemap module too. Pointer
+         * events are resolved to cells of the image by whichever module loads
+         * first.
+         */
+        if (!seriesTypes.heatmap) {
+
+            /**
+             * Resolve points on heatmap images. Touch and mouse over events
+             * reach the image in the tracker group, which carries no point.
+             */
+            H.wrap(Pointer.prototype, 'getPointFromEvent', function (proceed, e) {
+                var point = proceed.call(this, e),
+                    series = e.target && e.target.rasterSeries;
+                if (!point && series && series.rasterLayer) {
+                    point = series.getRasterPointFromEvent(e);
+                }
+                return point;
+            });
+
+            /**
+             * Moving within the image fires no new mouseover, so follow the
+             * mouse to update the hovered cell.
+             */
+            H.Chart.prototype.callbacks.push(function (chart) {
+                H.addEvent(chart.container, 'mousemove', function (e) {
+                    var series = e.target && e.target.rasterSeries,
+                        point;
+                    if (series && series.rasterLayer) {
+                        point = series.getRasterPointFromEvent(e);
+                        if (point && point !== chart.hoverPoint) {
+                            point.onMouseOver(e);
+                        }
+                    }
+                });
+            });
+        }
+
+        /**
+         * Heatmap series type
+         */
+        seriesType('heatmap', 'scatter', {
+            animation: false,
+            borderWidth: 0,
+            dataLabels: {
+                formatter: function () { // #2945
+                    return this.point.value;
+                },
+                inside: true,
+                verticalAlign: 'middle',
+                crop: false,
+                overflow: false,
+                padding: 0 // #3837
+            },
+            marker: null,
+            pointRange: null, // dynamically set to colsize by default
+            tooltip: {
+                pointFormat: '{point.x}, {point.y}: {point.value}<br/>'
+            },
+            states: {
+                normal: {
+                    animation: true
+                },
+                hover: {
+                    halo: false,  // #3406, halo is not required on heatmaps
+                    brightness: 0.2
+                }
+            },
+
+            /**
+             * Series with at least this many cells on a regular grid of
+             * colsize by rowsize are drawn into a single image instead of an
+             * element per cell, and the cell under the pointer is found from
+             * its position. Set to 0 to always draw elements.
+             */
+            rasterThreshold: 1000,
+
+            /**
+             * Blend the colors of neighbouring cells in the image instead of
+             * filling each cell with one color. Applies to cells without
+             * padding or borders on linear axes.
+             */
+            interpolation: false
+        }, merge(H.colorSeriesMixin, {
+            pointArrayMap: ['y', 'value'],
+            hasPointSpecificOptions: true,
+            getExtremesFromAll: true,
+            directTouch: true,
+
+            /**
+             * Override the init method to add point ranges on both axes.
+             */
+            init: function () {
+                var options;
+                seriesTypes.scatter.prototype.init.apply(this, arguments);
+
+                options = this.options;
+                // #3758, prevent resetting in setData
+                options.pointRange = pick(options.pointRange, options.colsize || 1);
+                this.yAxis.axisPointRange = options.rowsize || 1; // general point range
+            },
+            translate: function () {
+                var series = this,
+                    options = series.options,
+                    xAxis = series.xAxis,
+                    yAxis = series.yAxis,
+                    seriesPointPadding = options.pointPadding || 0,
+                    between = function (x, a, b) {
+                        return Math.min(Math.max(a, x), b);
+                    };
+
+                series.generatePoints();
+
+                each(series.points, function (point) {
+                    var xPad = (options.colsize || 1) / 2,
+                        yPad = (options.rowsize || 1) / 2,
+                        x1 = between(
+                            Math.round(
+                                xAxis.len -
+                                xAxis.translate(point.x - xPad, 0, 1, 0, 1)
+                            ),
+                            -xAxis.len, 2 * xAxis.len
+                        ),
+                        x2 = between(
+                            Math.round(
+                                xAxis.len -
+                                xAxis.translate(point.x + xPad, 0, 1, 0, 1)
+                            ),
+                            -xAxis.len, 2 * xAxis.len
+                        ),
+                        y1 = between(
+                            Math.round(yAxis.translate(point.y - yPad, 0, 1, 0, 1)),
+                            -yAxis.len, 2 * yAxis.len
+                        ),
+                        y2 = between(
+                            Math.round(yAxis.translate(point.y + yPad, 0, 1, 0, 1)),
+                            -yAxis.len, 2 * yAxis.len
+                        ),
+                        pointPadding = pick(point.pointPadding, seriesPointPadding);
+
+                    // Set plotX and plotY for use in K-D-Tree and more
+                    point.plotX = point.clientX = (x1 + x2) / 2;
+                    point.plotY = (y1 + y2) / 2;
+
+                    point.shapeType = 'rect';
+                    point.shapeArgs = {
+                        x: Math.min(x1, x2) + pointPadding,
+                        y: Math.min(y1, y2) + pointPadding,
+                        width: Math.abs(x2 - x1) - pointPadding * 2,
+                        height: Math.abs(y2 - y1) - pointPadding * 2
+                    };
+                });
+
+                series.translateColors();
+            },
+            drawPoints: function () {
+                var series = this;
+
+                if (series.isRasterSeries()) {
+                    series.drawRaster();
+                    return;
+                }
+                series.destroyRaster();
+
+                seriesTypes.column.prototype.drawPoints.call(series);
+
+                each(series.points, function (point) {
+                    if (point.graphic) {
+                        point.graphic.css(series.colorAttribs(point));
+                    }
+                });
+            },
+
+            /**
+             * Whether the cells are drawn into a single image. Cells off the
+             * grid, or with colors that the image can not show, like
+             * gradients or the classes of styled mode, keep their elements.
+             */
+            isRasterSeries: function () {
+                var threshold = this.options.rasterThreshold;
+                return !!(
+                    canvasSupported &&
+                    threshold &&
+                    !this.chart.polar &&
+                    this.points &&
+                    this.points.length >= threshold &&
+                    this.getRasterGrid()
+                );
+            },
+
+            /**
+             * Index the points by cell, counting columns of colsize and rows
+             * of rowsize from the lowest x and y. The grid is null when a point
+             * is off the grid or has no plain color, or when the grid has
+             * many more cells than there are points.
+             */
+            getRasterGrid: function () {
+                var series = this,
+                    options = series.options,
+                    xAxis = series.xAxis,
+                    yAxis = series.yAxis,
+                    points = series.points,
+                    len = points.length,
+                    colsize = options.colsize || 1,
+                    rowsize = options.rowsize || 1,
+                    xMin = Infinity,
+                    xMax = -Infinity,
+                    yMin = Infinity,
+                    yMax = -Infinity,
+                    tiled = !!(
+                        options.pointPadding ||
+                        options.borderWidth ||
+                        xAxis.isLog ||
+                        yAxis.isLog ||
+                        xAxis.isBroken ||
+                        yAxis.isBroken
+                    ),
+                    cols,
+                    rows,
+                    cells,
+                    col,
+                    row,
+                    point,
+                    i;
+
+                series.rasterGrid = null;
+
+                for (i = 0; i < len; i++) {
+                    point = points[i];
+                    if (
+                        typeof point.color !== 'string' ||
+                        !isNumber(point.x) ||
+                        !isNumber(point.y) ||
+                        !point.shapeArgs
+                    ) {
+                        return null;
+                    }
+                    xMin = Math.min(xMin, point.x);
+                    xMax = Math.max(xMax, point.x);
+                    yMin = Math.min(yMin, point.y);
+                    yMax = Math.max(yMax, point.y);
+                    if (
+                        point.shapeType !== 'rect' ||
+                        point.pointPadding ||
+                        point.borderWidth
+                    ) {
+                        tiled = true;
+                    }
+                }
+
+                cols = Math.round((xMax - xMin) / colsize) + 1;
+                rows = Math.round((yMax - yMin) / rowsize) + 1;
+                if (!len || cols * rows > Math.max(4 * len, 65536)) {
+                    return null;
+                }
+
+                // The index of the point in each cell plus one, 0 for empty
+                // cells. A later point in the same cell is drawn on top.
+                cells = new Int32Array(cols * rows);
+                for (i = 0; i < len; i++) {
+                    col = (points[i].x - xMin) / colsize;
+                    row = (points[i].y - yMin) / rowsize;
+                    if (
+                        Math.abs(col - Math.round(col)) > 1e-6 ||
+                        Math.abs(row - Math.round(row)) > 1e-6
+                    ) {
+                        return null;
+                    }
+                    cells[Math.round(row) * cols + Math.round(col)] = i + 1;
+                }
+
+                series.rasterGrid = {
+                    xMin: xMin,
+                    yMin: yMin,
+                    colsize: colsize,
+                    rowsize: rowsize,
+                    cols: cols,
+                    rows: rows,
+                    cells: cells,
+                    tiled: tiled
+                };
+                return series.rasterGrid;
+            },
+
+            /**
+             * Get the cleared canvas of the image, the size of the plot area.
+             * In inverted charts it is drawn in the untransformed coordinates
+             * of the series group, like the cells.
+             */
+            getRasterLayer: function () {
+                var series = this,
+                    ratio = win.devicePixelRatio || 1,
+                    width = Math.max(1, Math.ceil(series.xAxis.len)),
+                    height = Math.max(1, Math.ceil(series.yAxis.len)),
+                    layer = series.rasterLayer,
+                    canvas,
+                    ctx;
+
+                if (!layer) {
+                    canvas = doc.createElement('canvas');
+                    layer = series.rasterLayer = {
+                        canvas: canvas,
+                        ctx: canvas.getContext('2d'),
+                        image: series.chart.renderer.image('', 0, 0, 0, 0)
+                            .add(series.group)
+                    };
+                    layer.image.element.rasterSeries = series;
+                }
+
+                canvas = layer.canvas;
+                ctx = layer.ctx;
+                if (canvas.width !== width * ratio) {
+                    canvas.width = width * ratio;
+                }
+                if (canvas.height !== height * ratio) {
+                    canvas.height = height * ratio;
+                }
+                ctx.setTransform(1, 0, 0, 1, 0, 0);
+                ctx.clearRect(0, 0, canvas.width, canvas.height);
+                ctx.setTransform(ratio, 0, 0, ratio, 0, 0);
+
+                layer.image.attr({
+                    width: width,
+                    height: height
+                });
+                return layer;
+            },
+
+            destroyRaster: function () {
+                var series = this;
+                if (series.rasterLayer) {
+                    series.rasterLayer.image.destroy();
+                    delete series.rasterLayer;
+                    delete series.rasterBitmap;
+                }
+            },
+
+            /**
+             * Draw the cells into the image. Hovered and selected cells keep an
+             * element on top of it.
+             */
+            drawRaster: function () {
+                var series = this,
+                    layer = series.getRasterLayer();
+
+                each(series.points, function (point) {
+                    var graphic = point.graphic;
+                    if (graphic) {
+                        if (point.state || point.selected) {
+                            graphic.attr(point.shapeArgs);
+                        } else {
+                            point.graphic = graphic.destroy();
+                        }
+                    }
+                });
+
+                if (series.rasterGrid.tiled) {
+                    series.drawRasterTiles(layer.ctx);
+                } else {
+                    series.drawRasterBitmap(layer.ctx);
+                }
+
+                layer.image.attr({
+                    href: layer.canvas.toDataURL('image/png')
+                });
+            },
+
+            /**
+             * Fill a bitmap with one pixel per cell and scale it to the plot.
+             * The bitmap is drawn with smoothing when interpolation is set, so
+             * colors blend between the centers of the cells.
+             */
+            drawRasterBitmap: function (ctx) {
+                var series = this,
+                    grid = series.rasterGrid,
+                    points = series.points,
+                    xAxis = series.xAxis,
+                    yAxis = series.yAxis,
+                    bitmap = series.rasterBitmap ||
+                        (series.rasterBitmap = doc.createElement('canvas')),
+                    bitmapCtx,
+                    imageData,
+                    data,
+                    colors = {},
+                    colorAxis = series.colorAxis,
+                    // The channels of the color axis are from 0 to 1
+                    scale = colorAxis ? 255 : 1,
+                    rgba,
+                    point,
+                    i,
+                    // The outer edges of the grid
+                    x1 = xAxis.len - xAxis.translate(
+                        grid.xMin - grid.colsize / 2, 0, 1, 0, 1
+                    ),
+                    x2 = xAxis.len - xAxis.translate(
+                        grid.xMin + (grid.cols - 0.5) * grid.colsize, 0, 1, 0, 1
+                    ),
+                    y1 = yAxis.translate(grid.yMin - grid.rowsize / 2, 0, 1, 0, 1),
+                    y2 = yAxis.translate(
+                        grid.yMin + (grid.rows - 0.5) * grid.rowsize, 0, 1, 0, 1
+                    );
+
+                bitmap.width = grid.cols;
+                bitmap.height = grid.rows;
+                bitmapCtx = bitmap.getContext('2d');
+                imageData = bitmapCtx.createImageData(grid.cols, grid.rows);
+                data = imageData.data;
+
+                for (i = 0; i < grid.cells.length; i++) {
+                    point = grid.cells[i] && points[grid.cells[i] - 1];
+                    if (point && point.visible !== false) {
+                        // Parse each color once, those of the color axis
+                        // lookup table are parsed already
+                        rgba = colors[point.color];
+                        if (!rgba) {
+                            rgba = colors[point.color] = colorAxis ?
+                                colorAxis.getRGBA(point.color) :
+                                H.color(point.color).rgba;
+                        }
+                        if (isNumber(rgba[0])) {
+                            data[4 * i] = rgba[0] * scale;
+                            data[4 * i + 1] = rgba[1] * scale;
+                            data[4 * i + 2] = rgba[2] * scale;
+                            data[4 * i + 3] = Math.round(255 * pick(rgba[3], 1));
+                        }
+                    }
+                }
+                bitmapCtx.putImageData(imageData, 0, 0);
+
+                // Map the pixels to the cells, mirrored on reversed axes
+                ctx.imageSmoothingEnabled = !!series.options.interpolation;
+                ctx.transform(
+                    (x2 - x1) / grid.cols,
+                    0,
+                    0,
+                    (y2 - y1) / grid.rows,
+                    x1,
+                    y1
+                );
+                ctx.drawImage(bitmap, 0, 0);
+            },
+
+            /**
+             * Trace the shape of every cell, filling and stroking runs of
+             * cells with the same colors at once. Used for padded cells,
+             * borders, logarithmic axes and the shapes of tilemaps.
+             */
+            drawRasterTiles: function (ctx) {
+                var series = this,
+                    options = series.options,
+                    points = series.points,
+                    started = false,
+                    fill,
+                    stroke,
+                    lineWidth,
+                    point,
+                    i,
+                    paint = function () {
+                        if (started) {
+                            ctx.fillStyle = fill;
+                            ctx.fill();
+                            if (lineWidth && stroke) {
+                                ctx.strokeStyle = stroke;
+                                ctx.lineWidth = lineWidth;
+                                ctx.stroke();
+                            }
+                        }
+                    };
+
+                for (i = 0; i < points.length; i++) {
+                    point = points[i];
+                    if (point.visible !== false) {
+                        if (
+                            point.color !== fill ||
+                            (point.borderColor || options.borderColor) !== stroke ||
+                            (point.borderWidth || options.borderWidth || 0) !== lineWidth
+                        ) {
+                            paint();
+                            started = true;
+                            fill = point.color;
+                            stroke = point.borderColor || options.borderColor;
+                            lineWidth = point.borderWidth || options.borderWidth || 0;
+                            ctx.beginPath();
+                        }
+                        traceTile(ctx, point);
+                    }
+                }
+                paint();
+            },
+
+            /**
+             * Give a cell of the image an element for its hover or select
+             * state, styled like the elements of drawPoints.
+             */
+            drawRasterState: function (point) {
+                var series = this;
+
+                if (point.shapeArgs) {
+                    point.graphic = series.chart.renderer[point.shapeType || 'rect'](
+                        point.shapeArgs
+                    )
+                        .addClass(point.getClassName(), true)
+                        .css(series.colorAttribs(point))
+                        .add(series.group);
+                    point.graphic.element.point = point;
+                }
+            },
+
+            /**
+             * Find the cell under a pointer event from its position on the
+             * axes. Rectangles fill their own cell, the shapes of a tilemap
+             * are offset by up to half a cell, so of the cells around the
+             * position the closest one that contains it is taken.
+             */
+            getRasterPointFromEvent: function (e) {
+                var series = this,
+                    chart = series.chart,
+                    grid = series.rasterGrid,
+                    xAxis = series.xAxis,
+                    yAxis = series.yAxis,
+                    inverted = chart.inverted,
+                    plotX,
+                    plotY,
+                    col,
+                    row,
+                    i,
+                    j,
+                    point,
+                    box,
+                    distance,
+                    closest,
+                    closestDistance = Infinity;
+
+                if (!grid) {
+                    return;
+                }
+
+                e = chart.pointer.normalize(e);
+                plotX = inverted ?
+                    xAxis.len - (e.chartY - xAxis.pos) :
+                    e.chartX - xAxis.pos;
+                plotY = inverted ?
+                    yAxis.len - (e.chartX - yAxis.pos) :
+                    e.chartY - yAxis.pos;
+
+                col = Math.round(
+                    (xAxis.translate(xAxis.len - plotX, 1, 1, 0, 1) - grid.xMin) /
+                    grid.colsize
+                );
+                row = Math.round(
+                    (yAxis.translate(plotY, 1, 1, 0, 1) - grid.yMin) /
+                    grid.rowsize
+                );
+
+                for (i = Math.max(col - 1, 0); i <= Math.min(col + 1, grid.cols - 1); i++) {
+                    for (j = Math.max(row - 1, 0); j <= Math.min(row + 1, grid.rows - 1); j++) {
+                        point = grid.cells[j * grid.cols + i];
+                        point = point && series.points[point - 1];
+                        if (point && point.visible !== false) {
+                            box = getTileBox(point);
+                            distance = Math.pow(point.plotX - plotX, 2) +
+                                Math.pow(point.plotY - plotY, 2);
+                            if (
+                                plotX >= box.x &&
+                                plotX <= box.x + box.width &&
+                                plotY >= box.y &&
+                                plotY <= box.y + box.height &&
+                                distance < closestDistance
+                            ) {
+                                closest = point;
+                                closestDistance = distance;
+                            }
+                        }
+                    }
+                }
+                return closest;
+            },
+
+            destroy: function () {
+                this.destroyRaster();
+                Series.prototype.destroy.apply(this, arguments);
+            },
+
+            animate: noop,
+            getBox: noop,
+            drawLegendSymbol: H.LegendSymbolMixin.drawRectangle,
+            alignDataLabel: seriesTypes.column.prototype.alignDataLabel,
+            getExtremes: function () {
+                // Get the extremes from the value data
+                Series.prototype.getExtremes.call(this, this.valueData);
+                this.valueMin = this.dataMin;
+                this.valueMax = this.dataMax;
+
+                // Get the extremes from the y data
+                Series.prototype.getExtremes.call(this);
+            }
+
+        }), H.extend({
+            haloPath: function (size) {
+                if (!size) {
+                    return [];
+                }
+                var rect = this.shapeArgs;
+                return [
+                    'M', rect.x - size, rect.y - size,
+                    'L', rect.x - size, rect.y + rect.height + size,
+                    rect.x + rect.width + size, rect.y + rect.height + size,
+                    rect.x + rect.width + size, rect.y - size,
+                    'Z'
+                ];
+            }
+        }, colorPointMixin));
+    }(Highcharts));
+    (function (H) {
+        var seriesType = H.seriesType,
+            each = H.each,
+            reduce = H.reduce,
+            pick = H.pick,
+            // Utility func to get the middle number of 3
+            between = function (x, a, b) {
+                return Math.min(Math.max(a, x), b);
+            },
+            // Utility func to get padding definition from tile size division
+            tilePaddingFromTileSize = function (series, xDiv, yDiv) {
+                var options = series.options;
+                return {
+                    xPad: (options.colsize || 1) / -xDiv,
+                    yPad: (options.rowsize || 1) / -yDiv
+                };
+            };
+
+        // Map of shape types.
+        H.tileShapeTypes = {
+
+            // Hexagon shape type.
+            hexagon: {
+                alignDataLabel: H.seriesTypes.scatter.prototype.alignDataLabel,
+                getSeriesPadding: function (series) {
+                    return tilePaddingFromTileSize(series, 3, 2);
+                },
+                haloPath: function (size) {
+                    if (!size) {
+                        return [];
+                    }
+                    var hexagon = this.tileEdges;
+                    return [
+                        'M', hexagon.x2 - size, hexagon.y1 + size,
+                        'L', hexagon.x3 + size, hexagon.y1 + size,
+                        hexagon.x4 + size * 1.5, hexagon.y2,
+                        hexagon.x3 + size, hexagon.y3 - size,
+                        hexagon.x2 - size, hexagon.y3 - size,
+                        hexagon.x1 - size * 1.5, hexagon.y2,
+                        'Z'
+                    ];
+                },
+                translate: function () {
+                    var series = this,
+                        options = series.options,
+                        xAxis = series.xAxis,
+                        yAxis = series.yAxis,
+                        seriesPointPadding = options.pointPadding || 0,
+                        xPad = (options.colsize || 1) / 3,
+                        yPad = (options.rowsize || 1) / 2,
+                        yShift;
+
+                    series.generatePoints();
+
+                    each(series.points, function (point) {
+                        var x1 = between(
+                                Math.floor(
+                                    xAxis.len -
+                                    xAxis.translate(point.x - xPad * 2, 0, 1, 0, 1)
+                                ), -xAxis.len, 2 * xAxis.len
+                            ),
+                            x2 = between(
+                                Math.floor(
+                                    xAxis.len -
+                                    xAxis.translate(point.x - xPad, 0, 1, 0, 1)
+                                ), -xAxis.len, 2 * xAxis.len
+                            ),
+                            x3 = between(
+                                Math.floor(
+                                    xAxis.len -
+                                    xAxis.translate(point.x + xPad, 0, 1, 0, 1)
+                                ), -xAxis.len, 2 * xAxis.len
+                            ),
+                            x4 = between(
+                                Math.floor(
+                                    xAxis.len -
+                                    xAxis.translate(point.x + xPad * 2, 0, 1, 0, 1)
+                                ), -xAxis.len, 2 * xAxis.len
+                            ),
+                            y1 = between(
+                                Math.floor(yAxis.translate(point.y - yPad, 0, 1, 0, 1)),
+                                -yAxis.len,
+                                2 * yAxis.len
+                            ),
+                            y2 = between(
+                                Math.floor(yAxis.translate(point.y, 0, 1, 0, 1)),
+                                -yAxis.len,
+                                2 * yAxis.len
+                            ),
+                            y3 = between(
+                                Math.floor(yAxis.translate(point.y + yPad, 0, 1, 0, 1)),
+                                -yAxis.len,
+                                2 * yAxis.len
+                            ),
+                            pointPadding = pick(point.pointPadding, seriesPointPadding),
+                            // We calculate the point padding of the midpoints to
+                            // preserve the angles of the shape.
+                            midPointPadding = pointPadding *
+                                Math.abs(x2 - x1) / Math.abs(y3 - y2),
+                            xMidPadding = xAxis.reversed ?
+                                -midPointPadding : midPointPadding,
+                            xPointPadding = xAxis.reversed ?
+                                -pointPadding : pointPadding,
+                            yPointPadding = yAxis.reversed ?
+                                -pointPadding : pointPadding;
+
+                        // Shift y-values for every second grid column
+                        if (point.x % 2) {
+                            yShift = yShift || Math.round(Math.abs(y3 - y1) / 2) *
+                                // We have to reverse the shift for reversed y-axes
+                                (yAxis.reversed ? -1 : 1);
+                            y1 += yShift;
+                            y2 += yShift;
+                            y3 += yShift;
+                        }
+
+                        // Set plotX and plotY for use in K-D-Tree and more
+                        point.plotX = point.clientX = (x2 + x3) / 2;
+                        point.plotY = y2;
+
+                        // Apply point padding to translated coordinates
+                        x1 += xMidPadding + xPointPadding;
+                        x2 += xPointPadding;
+                        x3 -= xPointPadding;
+                        x4 -= xMidPadding + xPointPadding;
+                        y1 -= yPointPadding;
+                        y3 += yPointPadding;
+
+                        // Store points for halo creation
+                        point.tileEdges = {
+                            x1: x1, x2: x2, x3: x3, x4: x4, y1: y1, y2: y2, y3: y3
+                        };
+
+                        // Finally set the shape for this point
+                        point.shapeType = 'path';
+                        point.shapeArgs = {
+                            d: [
+                                'M', x2, y1,
+                                'L', x3, y1,
+                                x4, y2,
+                                x3, y3,
+                                x2, y3,
+                                x1, y2,
+                                'Z'
+                            ]
+                        };
+                    });
+
+                    series.translateColors();
+                }
+            },
+
+
+            // Diamond shape type.
+            diamond: {
+                alignDataLabel: H.seriesTypes.scatter.prototype.alignDataLabel,
+                getSeriesPadding: function (series) {
+                    return tilePaddingFromTileSize(series, 2, 2);
+                },
+                haloPath: function (size) {
+                    if (!size) {
+                        return [];
+                    }
+                    var diamond = this.tileEdges;
+                    return [
+                        'M', diamond.x2, diamond.y1 + size,
+                        'L', diamond.x3 + size, diamond.y2,
+                        diamond.x2, diamond.y3 - size,
+                        diamond.x1 - size, diamond.y2,
+                        'Z'
+                    ];
+                },
+                translate: function () {
+                    var series = this,
+                        options = series.options,
+                        xAxis = series.xAxis,
+                        yAxis = series.yAxis,
+                        seriesPointPadding = options.pointPadding || 0,
+                        xPad = (options.colsize || 1),
+                        yPad = (options.rowsize || 1) / 2,
+                        yShift;
+
+                    series.generatePoints();
+
+                    each(series.points, function (point) {
+                        var x1 = between(
+                                Math.round(
+                                    xAxis.len -
+                                    xAxis.translate(point.x - xPad, 0, 1, 0, 0)
+                                ), -xAxis.len, 2 * xAxis.len
+                            ),
+                            x2 = between(
+                                Math.round(
+                                    xAxis.len -
+                                    xAxis.translate(point.x, 0, 1, 0, 0)
+                                ), -xAxis.len, 2 * xAxis.len
+                            ),
+                            x3 = between(
+                                Math.round(
+                                    xAxis.len -
+                                    xAxis.translate(point.x + xPad, 0, 1, 0, 0)
+                                ), -xAxis.len, 2 * xAxis.len
+                            ),
+                            y1 = between(
+                                Math.round(yAxis.translate(point.y - yPad, 0, 1, 0, 0)),
+                                -yAxis.len,
+                                2 * yAxis.len
+                            ),
+                            y2 = between(
+                                Math.round(yAxis.translate(point.y, 0, 1, 0, 0)),
+                                -yAxis.len,
+                                2 * yAxis.len
+                            ),
+                            y3 = between(
+                                Math.round(yAxis.translate(point.y + yPad, 0, 1, 0, 0)),
+                                -yAxis.len,
+                                2 * yAxis.len
+                            ),
+                            pointPadding = pick(point.pointPadding, seriesPointPadding),
+                            // We calculate the point padding of the midpoints to
+                            // preserve the angles of the shape.
+                            midPointPadding = pointPadding *
+                                Math.abs(x2 - x1) / Math.abs(y3 - y2),
+                            xPointPadding = xAxis.reversed ?
+                                -midPointPadding : midPointPadding,
+                            yPointPadding = yAxis.reversed ?
+                                -pointPadding : pointPadding;
+
+                        // Shift y-values for every second grid column
+                        // We have to reverse the shift for reversed y-axes
+                        if (point.x % 2) {
+                            yShift = Math.abs(y3 - y1) / 2 * (yAxis.reversed ? -1 : 1);
+                            y1 += yShift;
+                            y2 += yShift;
+                            y3 += yShift;
+                        }
+
+                        // Set plotX and plotY for use in K-D-Tree and more
+                        point.plotX = point.clientX = x2;
+                        point.plotY = y2;
+
+                        // Apply point padding to translated coordinates
+                        x1 += xPointPadding;
+                        x3 -= xPointPadding;
+                        y1 -= yPointPadding;
+                        y3 += yPointPadding;
+
+                        // Store points for halo creation
+                        point.tileEdges = {
+                            x1: x1, x2: x2, x3: x3, y1: y1, y2: y2, y3: y3
+                        };
+
+                        // Set this point's shape parameters
+                        point.shapeType = 'path';
+                        point.shapeArgs = {
+                            d: [
+                                'M', x2, y1,
+                                'L', x3, y2,
+                                x2, y3,
+                                x1, y2,
+                                'Z'
+                            ]
+                        };
+                    });
+
+                    series.translateColors();
+                }
+            },
+
+
+            // Circle shape type.
+            circle: {
+                alignDataLabel: H.seriesTypes.scatter.prototype.alignDataLabel,
+                getSeriesPadding: function (series) {
+                    return tilePaddingFromTileSize(series, 2, 2);
+                },
+                haloPath: function (size) {
+                    return H.seriesTypes.scatter.prototype.pointClass.prototype.haloPath
+                        .call(this, size + (size && this.radius));
+                },
+                translate: function () {
+                    var series = this,
+                        options = series.options,
+                        xAxis = series.xAxis,
+                        yAxis = series.yAxis,
+                        seriesPointPadding = options.pointPadding || 0,
+                        yRadius = (options.rowsize || 1) / 2,
+                        colsize = (options.colsize || 1),
+                        colsizePx,
+                        yRadiusPx,
+                        xRadiusPx,
+                        radius,
+                        forceNextRadiusCompute = false;
+
+                    series.generatePoints();
+
+                    each(series.points, function (point) {
+                        var x = between(
+                                Math.round(
+                                    xAxis.len -
+                                    xAxis.translate(point.x, 0, 1, 0, 0)
+                                ), -xAxis.len, 2 * xAxis.len
+                            ),
+                            y = between(
+                                Math.round(yAxis.translate(point.y, 0, 1, 0, 0)),
+                                -yAxis.len,
+                                2 * yAxis.len
+                            ),
+                            pointPadding = seriesPointPadding,
+                            hasPerPointPadding = false;
+
+                        // If there is point padding defined on a single point, add
+                        // it
+                        if (point.pointPadding !== undefined) {
+                            pointPadding = point.pointPadding;
+                            hasPerPointPadding = true;
+                            forceNextRadiusCompute = true;
+                        }
+
+                        // Find radius if not found already.
+                        // Use the smallest one (x vs y) to avoid overlap.
+                        // Note that the radius will be recomputed for each series.
+                        // Ideal (max) x radius is dependent on y radius:
+                        /*
+                                        * (circle 2)
+
+                                                * (circle 3)
+                                                |    yRadiusPx
+                            (circle 1)    *-------|
+                                         colsizePx
+
+                            The distance between circle 1 and 3 (and circle 2 and 3) is
+                            2r, which is the hypotenuse of the triangle created by
+                            colsizePx and yRadiusPx. If the distance between circle 2
+                            and circle 1 is less than 2r, we use half of that distance
+                            instead (yRadiusPx).
+                        */
+                        if (!radius || forceNextRadiusCompute) {
+                            colsizePx = Math.abs(
+                                between(
+                                    Math.floor(
+                                        xAxis.len -
+                                        xAxis.translate(point.x + colsize, 0, 1, 0, 0)
+                                    ), -xAxis.len, 2 * xAxis.len
+                                ) - x
+                            );
+                            yRadiusPx = Math.abs(
+                                between(
+                                    Math.floor(
+                                        yAxis.translate(point.y + yRadius, 0, 1, 0, 0)
+                                    ), -yAxis.len, 2 * yAxis.len
+                                ) - y
+                            );
+                            xRadiusPx = Math.floor(
+                                Math.sqrt(
+                                    (colsizePx * colsizePx + yRadiusPx * yRadiusPx)
+                                ) / 2
+                            );
+                            radius = Math.min(
+                                colsizePx, xRadiusPx, yRadiusPx
+                            ) - pointPadding;
+
+                            // If we have per point padding we need to always
+                            // compute the radius for this point and the next.
+                            // If we used to have per point padding but don't
+                            // anymore, don't force compute next radius.
+                            if (forceNextRadiusCompute && !hasPerPointPadding) {
+                                forceNextRadiusCompute = false;
+                            }
+                        }
+
+                        // Shift y-values for every second grid column.
+                        // Note that we always use the optimal y axis radius for
+                        // this. Also note: We have to reverse the shift for
+                        // reversed y-axes.
+                        if (point.x % 2) {
+                            y += yRadiusPx * (yAxis.reversed ? -1 : 1);
+                        }
+
+                        // Set plotX and plotY for use in K-D-Tree and more
+                        point.plotX = point.clientX = x;
+                        point.plotY = y;
+
+                        // Save radius for halo
+                        point.radius = radius;
+
+                        // Set this point's shape parameters
+                        point.shapeType = 'circle';
+                        point.shapeArgs = {
+                            x: x,
+                            y: y,
+                            r: radius
+                        };
+                    });
+
+                    series.translateColors();
+                }
+            },
+
+
+            // Square shape type.
+            square: {
+                alignDataLabel: H.seriesTypes.heatmap.prototype.alignDataLabel,
+                translate: H.seriesTypes.heatmap.prototype.translate,
+                getSeriesPadding: function () {
+                    return;
+                },
+                haloPath: H.seriesTypes.heatmap.prototype.pointClass.prototype.haloPath
+            }
+        };
+
+
+        // Extension to add pixel padding for series. Uses getSeriesPixelPadding
+        // on each series and adds the largest padding required. If no series
+        // has this function defined, we add nothing.
+        H.wrap(H.Axis.prototype, 'setAxisTranslation', function (proceed) {
+
+            // We need to run the original func first, so that we know the
+            // translation formula to use for computing the padding
+            proceed.apply(this, Array.prototype.slice.call(arguments, 1));
+
+            var axis = this,
+                // Find which series' padding to use
+                seriesPadding = reduce(
+                    H.map(axis.series, function (series) {
+                        return series.getSeriesPixelPadding &&
+                            series.getSeriesPixelPadding(axis);
+                    }),
+                    function (a, b) {
+                        return (a && a.padding) > (b && b.padding) ? a : b;
+                    }
+                ) || {
+                    padding: 0,
+                    axisLengthFactor: 1
+                },
+                lengthPadding = Math.round(
+                    seriesPadding.padding * seriesPadding.axisLengthFactor
+                );
+
+            // Don't waste time on this if we're not adding extra padding
+            if (seriesPadding.padding) {
+                // Recompute translation with new axis length now (minus
+                // padding)
+                axis.len -= lengthPadding;
+                proceed.apply(axis, Array.prototype.slice.call(arguments, 1));
+                axis.minPixelPadding += seriesPadding.padding;
+                axis.len += lengthPadding;
+            }
+        });
+
+
+        /**
+         * A tilemap series is a type of heatmap where the tile shapes are
+         * configurable.
+         */
+        seriesType('tilemap', 'heatmap', {
+            states: {
+                hover: {
+                    halo: {
+                        enabled: true,
+                        size: 2,
+                        opacity: 0.5,
+                        attributes: {
+                            zIndex: 3
+                        }
+                    }
+                }
+            },
+
+            /**
+             * The padding between points in the tilemap.
+             */
+            pointPadding: 2,
+
+            /**
+             * The shape of the tiles in the tilemap. Possible values are
+             * `hexagon`, `circle`, `diamond`, and `square`.
+             */
+            tileShape: 'hexagon'
+
+        }, {
+
+            // Set tile shape object on series
+            setOptions: function () {
+                // Call original function
+                var ret = H.seriesTypes.heatmap.prototype.setOptions.apply(
+                    this,
+                    Array.prototype.slice.call(arguments)
+                );
+
+                this.tileShape = H.tileShapeTypes[ret.tileShape];
+                return ret;
+            },
+
+            // Use the shape's defined data label alignment function
+            alignDataLabel: function () {
+                return this.tileShape.alignDataLabel.apply(
+                    this,
+                    Array.prototype.slice.call(arguments)
+                );
+            },
+
+            // Get metrics for padding of axis for this series
+            getSeriesPixelPadding: function (axis) {
+                var isX = axis.isXAxis,
+                    padding = this.tileShape.getSeriesPadding(this),
+                    coord1,
+                    coord2;
+
+                // If the shape type does not require padding, return no-op
+                // padding
+                if (!padding) {
+                    return {
+                        padding: 0,
+                        axisLengthFactor: 1
+                    };
+                }
+
+                // Use translate to compute how far outside the points we
+                // draw, and use this difference as padding.
+                coord1 = Math.round(
+                    axis.translate(
+                        isX ?
+                            padding.xPad * 2 :
+                            padding.yPad,
+                        0, 1, 0, 1
+                    )
+                );
+                coord2 = Math.round(
+                    axis.translate(
+                        isX ? padding.xPad : 0,
+                        0, 1, 0, 1
+                    )
+                );
+
+                return {
+                    padding: Math.abs(coord1 - coord2) || 0,
+
+                    // Offset the yAxis length to compensate for shift.
+                    // Setting the length factor to 2 would add the same
+                    // margin to max as min. Now we only add a slight bit of
+                    // the min margin to max, as we don't actually draw
+                    // outside the max bounds. For the xAxis we draw outside
+                    // on both sides so we add the same margin to min and
+                    // max.
+                    axisLengthFactor: isX ? 2 : 1.1
+                };
+            },
+
+            // Use translate from tileShape
+            translate: function () {
+                return this.tileShape.translate.apply(
+                    this,
+                    Array.prototype.slice.call(arguments)
+                );
+            }
+
+        }, H.extend({
+            /**
+             * Use the shape's defined halo path function
+             */
+            haloPath: function () {
+                return this.series.tileShape.haloPath.apply(
+                    this,
+                    Array.prototype.slice.call(arguments)
+                );
+            }
+        }, H.colorPointMixin));
+    }(Highcharts));
+}));
@@ -0,0 +1,803 @@
+/*
+ Highcharts JS v6.0.2 (2017-10-20)
+ Canvas series module
+
+ (c) 2009-2017 Highsoft AS
+
+ License: www.highcharts.com/license
+*/
+/**
+ * (c) 2009-2017 Highsoft AS
+ *
+ * License: www.highcharts.com/license
+ *
+ * Canvas series module. Series with many small elements draw their markers,
+ * columns and data labels into one canvas per layer instead of one SVG
+ * element per point. The canvas is injected into the series group as a single
+ * image, so clipping, inversion, visibility and animation of the group still
+ * apply. Styling goes through the regular pointAttribs and markerAttribs, so
+ * marker, state and zone options look the same as in SVG. Hover states are
+ * drawn as a single SVG overlay element.
+ *
+ * Unlike the boost module this is not a WebGL fallback: lines, areas, axes
+ * and tooltips are still rendered by the SVG renderer.
+ */
+(function (factory) {
+    if (typeof module === 'object' && module.exports) {
+        module.exports = factory;
+    } else {
+        factory(Highcharts);
+    }
+}(function (Highcharts) {
+    (function (H) {
+        var win = H.win,
+            doc = win.document,
+            each = H.each,
+            pick = H.pick,
+            merge = H.merge,
+            wrap = H.wrap,
+            format = H.format,
+            isNumber = H.isNumber,
+            defined = H.defined,
+            addEvent = H.addEvent,
+            Series = H.Series,
+            Point = H.Point,
+            Pointer = H.Pointer,
+            seriesTypes = H.seriesTypes,
+            symbols = H.SVGRenderer.prototype.symbols,
+            canvasSupported = !!(
+                doc.createElement('canvas').getContext &&
+                doc.createElement('canvas').getContext('2d')
+            );
+
+        /**
+         * Series with at least this many points draw their markers, columns
+         * and data labels on a canvas. Set to 0 to always use SVG for a
+         * series, or to 1 to always use the canvas.
+         */
+        H.setOptions({
+            plotOptions: {
+                series: {
+                    canvasThreshold: 1000
+                }
+            }
+        });
+
+        /**
+         * Trace an SVG path array as created by the renderer symbols into the
+         * canvas context. Only the commands used by the built-in marker
+         * symbols are supported.
+         */
+        function tracePath(ctx, path) {
+            var i = 0,
+                command,
+                len = path.length;
+
+            while (i < len) {
+                if (typeof path[i] === 'string') {
+                    command = path[i];
+                    i++;
+                }
+                if (command === 'M') {
+                    ctx.moveTo(path[i], path[i + 1]);
+                    i += 2;
+                    command = 'L'; // Implicit lineTo after moveTo
+                } else if (command === 'L') {
+                    ctx.lineTo(path[i], path[i + 1]);
+                    i += 2;
+                } else if (command === 'C') {
+                    ctx.bezierCurveTo(
+                        path[i], path[i + 1],
+                        path[i + 2], path[i + 3],
+                        path[i + 4], path[i + 5]
+                    );
+                    i += 6;
+                } else if (command === 'Z' || command === 'z') {
+                    ctx.closePath();
+                } else {
+                    i++; // Unknown command, skip its operand
+                }
+            }
+        }
+
+        function traceSymbol(ctx, symbol, x, y, width, height) {
+            if (symbol === 'circle') {
+                ctx.moveTo(x + width, y + height / 2);
+                ctx.arc(
+                    x + width / 2,
+                    y + height / 2,
+                    width / 2,
+                    0,
+                    2 * Math.PI,
+                    false
+                );
+            } else if (symbols[symbol]) {
+                tracePath(ctx, symbols[symbol](x, y, width, height));
+            }
+        }
+
+        function traceRect(ctx, x, y, width, height, r) {
+            if (r) {
+                r = Math.min(r, width / 2, height / 2);
+                ctx.moveTo(x + r, y);
+                ctx.lineTo(x + width - r, y);
+                ctx.arcTo(x + width, y, x + width, y + r, r);
+                ctx.lineTo(x + width, y + height - r);
+                ctx.arcTo(x + width, y + height, x + width - r, y + height, r);
+                ctx.lineTo(x + r, y + height);
+                ctx.arcTo(x, y + height, x, y + height - r, r);
+                ctx.lineTo(x, y + r);
+                ctx.arcTo(x, y, x + r, y, r);
+                ctx.closePath();
+            } else {
+                ctx.rect(x, y, width, height);
+            }
+        }
+
+        /**
+         * Gradients and patterns can not be batched, they are flattened to the
+         * series color, which is also what the legend symbol falls back to.
+         */
+        function canvasColor(color, fallback) {
+            return typeof color === 'string' ? color : fallback;
+        }
+
+        /**
+         * Consecutive shapes with the same style are filled and stroked in
+         * one batch. Flushing on every style change keeps the paint order of
+         * the points, and so the same overlap as in SVG.
+         */
+        function Batch(ctx) {
+            this.ctx = ctx;
+            this.key = null;
+        }
+        Batch.prototype = {
+            style: function (attribs, fallback) {
+                var fill = canvasColor(attribs.fill, fallback),
+                    stroke = canvasColor(attribs.stroke, fallback),
+                    lineWidth = attribs['stroke-width'] || 0,
+                    key = fill + ',' + stroke + ',' + lineWidth;
+
+                if (key !== this.key) {
+                    this.flush();
+                    this.key = key;
+                    this.fill = fill;
+                    this.stroke = stroke;
+                    this.lineWidth = lineWidth;
+                    this.ctx.beginPath();
+                }
+            },
+            flush: function () {
+                var ctx = this.ctx;
+                if (this.key !== null) {
+                    if (this.fill && this.fill !== 'none') {
+                        ctx.fillStyle = this.fill;
+                        ctx.fill();
+                    }
+                    if (this.lineWidth && this.stroke && this.stroke !== 'none') {
+                        ctx.strokeStyle = this.stroke;
+                        ctx.lineWidth = this.lineWidth;
+                        ctx.stroke();
+                    }
+                }
+                this.key = null;
+            }
+        };
+
+        H.extend(Series.prototype, {
+
+            /**
+             * Whether the points of the series are drawn on a canvas.
+             */
+            isCanvasSeries: function () {
+                var threshold = this.options.canvasThreshold;
+                return !!(
+                    canvasSupported &&
+                    threshold &&
+                    this.isCartesian &&
+                    !this.xAxis.isRadial &&
+                    !this.isSeriesBoosting &&
+                    this.points &&
+                    this.points.length >= threshold
+                );
+            },
+
+            /**
+             * Get a cleared canvas layer with its image element in the given
+             * group. The layer extends beyond the plot area by the padding so
+             * markers on the plot edges are not cut. In inverted charts the
+             * layer is drawn in the untransformed coordinates of the series
+             * group.
+             */
+            getCanvasLayer: function (name, group, width, height, padding) {
+                var series = this,
+                    renderer = series.chart.renderer,
+                    ratio = win.devicePixelRatio || 1,
+                    layer = series[name],
+                    canvas,
+                    ctx;
+
+                if (layer && layer.group !== group) {
+                    series.destroyCanvasLayer(name);
+                    layer = null;
+                }
+                if (!layer) {
+                    canvas = doc.createElement('canvas');
+                    layer = series[name] = {
+                        canvas: canvas,
+                        ctx: canvas.getContext('2d'),
+                        group: group,
+                        image: renderer.image('', 0, 0, 0, 0).add(group)
+                    };
+                    layer.image.element.canvasSeries = series;
+                }
+
+                canvas = layer.canvas;
+                ctx = layer.ctx;
+                width = Math.max(1, Math.ceil(width + 2 * padding));
+                height = Math.max(1, Math.ceil(height + 2 * padding));
+                if (canvas.width !== width * ratio) {
+                    canvas.width = width * ratio;
+                }
+                if (canvas.height !== height * ratio) {
+                    canvas.height = height * ratio;
+                }
+                ctx.setTransform(1, 0, 0, 1, 0, 0);
+                ctx.clearRect(0, 0, canvas.width, canvas.height);
+                ctx.setTransform(ratio, 0, 0, ratio, ratio * padding, ratio * padding);
+
+                layer.image.attr({
+                    x: -padding,
+                    y: -padding,
+                    width: width,
+                    height: height
+                });
+                return layer;
+            },
+
+            commitCanvasLayer: function (layer) {
+                layer.image.attr({
+                    href: layer.canvas.toDataURL('image/png')
+                });
+            },
+
+            destroyCanvasLayer: function (name) {
+                if (this[name]) {
+                    this[name].image.destroy();
+                    delete this[name];
+                }
+            },
+
+            /**
+             * Canvas version of Series.drawPoints for marker based series.
+             */
+            drawCanvasMarkers: function () {
+                var series = this,
+                    points = series.points,
+                    markerOptions = series.options.marker,
+                    group = series[series.specialGroup] || series.markerGroup,
+                    globallyEnabled = pick(
+                        markerOptions.enabled,
+                        series.closestPointRangePx >= 2 * markerOptions.radius
+                    ),
+                    padding = 2 * (markerOptions.radius || 0) +
+                        (markerOptions.lineWidth || 0) + 1,
+                    layer,
+                    batch,
+                    i,
+                    point,
+                    pointMarker,
+                    enabled,
+                    symbol,
+                    state,
+                    attribs,
+                    graphic;
+
+                if (markerOptions.enabled === false && !series._hasPointMarkers) {
+                    series.destroyCanvasLayer('canvasMarkers');
+                    return;
+                }
+
+                layer = series.getCanvasLayer(
+                    'canvasMarkers',
+                    group,
+                    series.xAxis.len,
+                    series.yAxis.len,
+                    padding
+                );
+                batch = new Batch(layer.ctx);
+
+                for (i = 0; i < points.length; i++) {
+                    point = points[i];
+                    pointMarker = point.marker || {};
+                    enabled = (globallyEnabled && pointMarker.enabled === undefined) ||
+                        pointMarker.enabled;
+                    graphic = point.graphic;
+
+                    if (
+                        !enabled ||
+                        !isNumber(point.plotY) ||
+                        point.y === null ||
+                        !point.isInside
+                    ) {
+                        if (graphic) {
+                            point.graphic = graphic.destroy();
+                        }
+                        continue;
+                    }
+
+                    symbol = pick(pointMarker.symbol, series.symbol);
+                    point.hasImage = symbol.indexOf('url') === 0;
+                    state = point.selected && 'select';
+                    attribs = series.markerAttribs(point, state);
+
+                    // Image markers load asynchronously, keep them in SVG
+                    if (point.hasImage) {
+                        if (!graphic) {
+                            point.graphic = graphic = series.chart.renderer.symbol(
+                                symbol,
+                                attribs.x,
+                                attribs.y,
+                                attribs.width,
+                                attribs.height,
+                                point.marker ? pointMarker : markerOptions
+                            ).add(group);
+                        }
+                        graphic.attr(attribs);
+                        continue;
+                    }
+
+                    if (graphic) {
+                        point.graphic = graphic.destroy();
+                    }
+                    if (attribs.width > 0) {
+                        batch.style(series.pointAttribs(point, state), series.color);
+                        traceSymbol(
+                            layer.ctx,
+                            symbol,
+                            attribs.x,
+                            attribs.y,
+                            attribs.width,
+                            attribs.height
+                        );
+                    }
+                }
+                batch.flush();
+                series.commitCanvasLayer(layer);
+            },
+
+            /**
+             * Canvas version of the column drawPoints.
+             */
+            drawCanvasColumns: function () {
+                var series = this,
+                    options = series.options,
+                    points = series.points,
+                    layer = series.getCanvasLayer(
+                        'canvasPoints',
+                        series.group,
+                        series.xAxis.len,
+                        series.yAxis.len,
+                        (options.borderWidth || 0) + 1
+                    ),
+                    batch = new Batch(layer.ctx),
+                    i,
+                    point,
+                    shapeArgs;
+
+                for (i = 0; i < points.length; i++) {
+                    point = points[i];
+                    if (point.graphic) {
+                        point.graphic = point.graphic.destroy();
+                    }
+                    shapeArgs = point.shapeArgs;
+                    if (isNumber(point.plotY) && point.y !== null && shapeArgs) {
+                        batch.style(
+                            series.pointAttribs(point, point.selected && 'select'),
+                            series.color
+                        );
+                        traceRect(
+                            layer.ctx,
+                            shapeArgs.x,
+                            shapeArgs.y,
+                            shapeArgs.width,
+                            shapeArgs.height,
+                            options.borderRadius
+                        );
+                    }
+                }
+                batch.flush();
+                series.commitCanvasLayer(layer);
+            },
+
+            /**
+             * Find the column under a pointer event arithmetically, since the
+             * canvas columns have no elements of their own.
+             */
+            getCanvasPointFromEvent: function (e) {
+                var series = this,
+                    chart = series.chart,
+                    points = series.points || [],
+                    inverted = chart.inverted,
+                    plotX,
+                    plotY,
+                    lo = 0,
+                    hi = points.length - 1,
+                    mid,
+                    i,
+                    shapeArgs,
+                    reversed,
+                    from,
+                    to;
+
+                e = chart.pointer.normalize(e);
+                plotX = inverted ?
+                    series.xAxis.len - (e.chartY - series.xAxis.pos) :
+                    e.chartX - series.xAxis.pos;
+                plotY = inverted ?
+                    series.yAxis.len - (e.chartX - series.yAxis.pos) :
+                    e.chartY - series.yAxis.pos;
+
+                // Points are sorted by x, so a binary search on plotX finds the
+                // neighbourhood. Grouped columns are offset from their plotX by
+                // less than a point width, so the neighbours cover them.
+                reversed = series.xAxis.reversed;
+                while (lo < hi) {
+                    mid = (lo + hi) >> 1;
+                    if (
+                        reversed ?
+                            points[mid].plotX > plotX :
+                            points[mid].plotX < plotX
+                    ) {
+                        lo = mid + 1;
+                    } else {
+                        hi = mid;
+                    }
+                }
+                from = Math.max(0, lo - 2);
+                to = Math.min(points.length - 1, lo + 2);
+                for (i = from; i <= to; i++) {
+                    shapeArgs = points[i].shapeArgs;
+                    if (
+                        shapeArgs &&
+                        points[i].y !== null &&
+                        plotX >= shapeArgs.x &&
+                        plotX <= shapeArgs.x + shapeArgs.width &&
+                        plotY >= shapeArgs.y &&
+                        plotY <= shapeArgs.y + shapeArgs.height
+                    ) {
+                        return points[i];
+                    }
+                }
+            },
+
+            /**
+             * Hover and select states of canvas columns are drawn as a single
+             * SVG element on top of the canvas.
+             */
+            drawCanvasState: function (point, state) {
+                var series = this,
+                    graphic = series.canvasStateGraphic;
+
+                if (state && point.shapeArgs) {
+                    if (!graphic) {
+                        graphic = series.canvasStateGraphic = series.chart.renderer[
+                            point.shapeType || 'rect'
+                        ](point.shapeArgs).add(series.group);
+                    }
+                    graphic
+                        .attr(point.shapeArgs)
+                        .attr({ r: series.options.borderRadius || 0 })
+                        .attr(series.pointAttribs(point, state))
+                        .show();
+                } else if (graphic) {
+                    graphic.hide();
+                }
+            },
+
+            /**
+             * Canvas version of Series.drawDataLabels, for labels without HTML,
+             * rotation, shape or background.
+             */
+            drawCanvasDataLabels: function () {
+                var series = this,
+                    chart = series.chart,
+                    renderer = chart.renderer,
+                    inverted = chart.inverted,
+                    seriesOptions = series.options,
+                    generalOptions = seriesOptions.dataLabels,
+                    group = series.plotGroup(
+                        'dataLabelsGroup',
+                        'data-labels',
+                        'visible',
+                        generalOptions.zIndex || 6
+                    ),
+                    plotWidth = inverted ? series.yAxis.len : series.xAxis.len,
+                    plotHeight = inverted ? series.xAxis.len : series.yAxis.len,
+                    layer = series.getCanvasLayer(
+                        'canvasLabels',
+                        group,
+                        plotWidth,
+                        plotHeight,
+                        0
+                    ),
+                    ctx = layer.ctx,
+                    isColumn = !!series.getColumnMetrics;
+
+                ctx.textBaseline = 'alphabetic';
+                ctx.textAlign = 'left';
+
+                each(series.points, function (point) {
+                    var pointOptions = point.dlOptions ||
+                            (point.options && point.options.dataLabels),
+                        options = pointOptions ?
+                            merge(generalOptions, pointOptions) :
+                            generalOptions,
+                        style,
+                        labelConfig,
+                        formatString,
+                        text,
+                        color,
+                        outline,
+                        fontSize,
+                        metrics,
+                        padding,
+                        box,
+                        align,
+                        verticalAlign,
+                        width,
+                        height,
+                        x,
+                        y;
+
+                    if (point.dataLabel) {
+                        point.dataLabel = point.dataLabel.destroy();
+                    }
+                    if (
+                        !pick(pointOptions && pointOptions.enabled, generalOptions.enabled) ||
+                        point.isNull ||
+                        !chart.isInsidePlot(
+                            pick(point.plotX, -9999),
+                            Math.round(pick(point.plotY, -9999)),
+                            inverted
+                        )
+                    ) {
+                        return;
+                    }
+
+                    labelConfig = point.getLabelConfig();
+                    formatString = options[point.formatPrefix + 'Format'] || options.format;
+                    text = defined(formatString) ?
+                        format(formatString, labelConfig) :
+                        (options[point.formatPrefix + 'Formatter'] || options.formatter)
+                            .call(labelConfig, options);
+                    if (!defined(text) || text === '') {
+                        return;
+                    }
+                    text = String(text).replace(/<[^>]+>/g, '');
+
+                    style = options.style || {};
+                    color = pick(options.color, style.color, series.color, '#000000');
+                    if (color === 'contrast') {
+                        point.contrastColor = renderer.getContrast(point.color || series.color);
+                        color = options.inside ||
+                            pick(point.labelDistance, options.distance) < 0 ||
+                            seriesOptions.stacking ?
+                                point.contrastColor :
+                                '#000000';
+                    }
+                    outline = style.textOutline && style.textOutline !== 'none' ?
+                        style.textOutline.split(' ') :
+                        null;
+
+                    fontSize = style.fontSize || '11px';
+                    metrics = renderer.fontMetrics(fontSize);
+                    padding = pick(options.padding, 0);
+                    ctx.font = [
+                        style.fontStyle || '',
+                        style.fontWeight || 'normal',
+                        fontSize,
+                        style.fontFamily || renderer.style.fontFamily
+                    ].join(' ');
+                    width = ctx.measureText(text).width + 2 * padding;
+                    height = metrics.h + 2 * padding;
+
+                    // The box to align the label to, same as alignDataLabel
+                    if (isColumn && point.shapeArgs) {
+                        box = series.getCanvasLabelBox(point, options);
+                        align = box.align;
+                        verticalAlign = box.verticalAlign;
+                    } else {
+                        box = {
+                            x: inverted ? series.yAxis.len - point.plotY : point.plotX,
+                            y: Math.round(inverted ? series.xAxis.len - point.plotX : point.plotY),
+                            width: 0,
+                            height: 0
+                        };
+                        align = options.align;
+                        verticalAlign = options.verticalAlign;
+                    }
+
+                    x = box.x + (options.x || 0) +
+                        ({ left: 0, center: 0.5, right: 1 }[align] || 0) *
+                        (box.width - width);
+                    y = box.y + (options.y || 0) +
+                        ({ top: 0, middle: 0.5, bottom: 1 }[verticalAlign] || 0) *
+                        (box.height - height);
+
+                    if (pick(options.overflow, 'justify') === 'justify') {
+                        x = Math.max(0, Math.min(x, plotWidth - width));
+                        y = Math.max(0, Math.min(y, plotHeight - height));
+                    } else if (
+                        pick(options.crop, true) &&
+                        (x < 0 || y < 0 || x + width > plotWidth || y + height > plotHeight)
+                    ) {
+                        return;
+                    }
+
+                    x += padding;
+                    y += padding + metrics.b;
+                    if (outline) {
+                        ctx.lineJoin = 'round';
+                        ctx.lineWidth = 2 * parseFloat(outline[0]);
+                        ctx.strokeStyle = outline[outline.length - 1] === 'contrast' ?
+                            renderer.getContrast(color) :
+                            outline[outline.length - 1];
+                        ctx.strokeText(text, x, y);
+                    }
+                    ctx.fillStyle = color;
+                    ctx.fillText(text, x, y);
+                });
+
+                series.commitCanvasLayer(layer);
+            },
+
+            /**
+             * The column label box, following the rules of the column
+             * alignDataLabel.
+             */
+            getCanvasLabelBox: function (point, options) {
+                var series = this,
+                    inverted = series.chart.inverted,
+                    below = pick(
+                        point.below,
+                        point.plotY > pick(series.translatedThreshold, series.yAxis.len)
+                    ),
+                    inside = pick(options.inside, !!series.options.stacking),
+                    dlBox = point.dlBox || point.shapeArgs,
+                    box = {
+                        x: dlBox.x,
+                        y: dlBox.y,
+                        width: dlBox.width,
+                        height: dlBox.height
+                    },
+                    overshoot;
+
+                if (box.y < 0) {
+                    box.height += box.y;
+                    box.y = 0;
+                }
+                overshoot = box.y + box.height - series.yAxis.len;
+                if (overshoot > 0) {
+                    box.height -= overshoot;
+                }
+                if (inverted) {
+                    box = {
+                        x: series.yAxis.len - box.y - box.height,
+                        y: series.xAxis.len - box.x - box.width,
+                        width: box.height,
+                        height: box.width
+                    };
+                }
+                if (!inside) {
+                    if (inverted) {
+                        box.x += below ? 0 : box.width;
+                        box.width = 0;
+                    } else {
+                        box.y += below ? box.height : 0;
+                        box.height = 0;
+                    }
+                }
+                box.align = pick(
+                    options.align,
+                    !inverted || inside ? 'center' : below ? 'right' : 'left'
+                );
+                box.verticalAlign = pick(
+                    options.verticalAlign,
+                    inverted || inside ? 'middle' : below ? 'top' : 'bottom'
+                );
+                return box;
+            }
+        });
+
+        wrap(Series.prototype, 'drawPoints', function (proceed) {
+            if (this.isCanvasSeries()) {
+                this.drawCanvasMarkers();
+            } else {
+                this.destroyCanvasLayer('canvasMarkers');
+                proceed.call(this);
+            }
+        });
+
+        wrap(seriesTypes.column.prototype, 'drawPoints', function (proceed) {
+            if (this.isCanvasSeries()) {
+                this.drawCanvasColumns();
+            } else {
+                this.destroyCanvasLayer('canvasPoints');
+                if (this.canvasStateGraphic) {
+                    this.canvasStateGraphic = this.canvasStateGraphic.destroy();
+                }
+                proceed.call(this);
+            }
+        });
+
+        wrap(Series.prototype, 'drawDataLabels', function (proceed) {
+            var options = this.options.dataLabels;
+            if (
+                this.isCanvasSeries() &&
+                (options.enabled || this._hasPointLabels) &&
+                !options.useHTML &&
+                !options.rotation &&
+                !options.shape &&
+                !options.backgroundColor &&
+                !options.borderWidth &&
+                !this.dlProcessOptions
+            ) {
+                this.drawCanvasDataLabels();
+            } else {
+                this.destroyCanvasLayer('canvasLabels');
+                proceed.call(this);
+            }
+        });
+
+        wrap(Series.prototype, 'destroy', function (proceed) {
+            var series = this;
+            each(['canvasMarkers', 'canvasPoints', 'canvasLabels'], function (name) {
+                series.destroyCanvasLayer(name);
+            });
+            if (series.canvasStateGraphic) {
+                series.canvasStateGraphic = series.canvasStateGraphic.destroy();
+            }
+            return proceed.apply(series, Array.prototype.slice.call(arguments, 1));
+        });
+
+        wrap(Point.prototype, 'setState', function (proceed, state) {
+            var series = this.series;
+            proceed.apply(this, Array.prototype.slice.call(arguments, 1));
+            if (series.canvasPoints) {
+                series.drawCanvasState(this, state || (this.selected && 'select'));
+            }
+        });
+
+        /**
+         * Resolve points on canvas columns. Touch and mouse over events reach
+         * the canvas image in the tracker group, which carries no point.
+         */
+        wrap(Pointer.prototype, 'getPointFromEvent', function (proceed, e) {
+            var point = proceed.call(this, e),
+                series = e.target && e.target.canvasSeries;
+            if (!point && series && series.canvasPoints) {
+                point = series.getCanvasPointFromEvent(e);
+            }
+            return point;
+        });
+
+        /**
+         * Moving within the canvas image fires no new mouseover, so follow the
+         * mouse to update the hovered column.
+         */
+        H.Chart.prototype.callbacks.push(function (chart) {
+            addEvent(chart.container, 'mousemove', function (e) {
+                var series = e.target && e.target.canvasSeries,
+                    point;
+                if (series && series.canvasPoints) {
+                    point = series.getCanvasPointFromEvent(e);
+                    if (point && point !== chart.hoverPoint) {
+                        point.onMouseOver(e);
+                    }
+                }
+            });
+        });
+
+    }(Highcharts));
+}));
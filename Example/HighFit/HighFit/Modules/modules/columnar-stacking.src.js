@@ -0,0 +1,461 @@
+/*
+ Highcharts JS v6.0.2 (2017-10-20)
+ Columnar stacking module
+
+ (c) 2009-2017 Highsoft AS
+
+ License: www.highcharts.com/license
+*/
+/**
+ * (c) 2009-2017 Highsoft AS
+ *
+ * License: www.highcharts.com/license
+ *
+ * Columnar stacking module. Stacked series that share x values are stacked
+ * in one pass over typed columns of their y values instead of building the
+ * stack point by point through string keyed stack indicators. Normal, percent
+ * and stream stacking are computed on the columns, and the columns are kept
+ * between redraws, so toggling series visibility only repeats the sums. The
+ * stack items on the y axis are filled the same way as before, so stack
+ * labels, tooltips and area paths are unchanged.
+ *
+ * Stacks with negative stacks, duplicate or unsorted x values, or series
+ * whose x values differ are stacked by the regular code. Stack totals are
+ * rounded once after the sum instead of after every addition, which can change
+ * the last of the 14 significant digits for data with many decimals.
+ */
+(function (factory) {
+    if (typeof module === 'object' && module.exports) {
+        module.exports = factory;
+    } else {
+        factory(Highcharts);
+    }
+}(function (Highcharts) {
+    (function (H) {
+        var each = H.each,
+            pick = H.pick,
+            wrap = H.wrap,
+            correctFloat = H.correctFloat,
+            Axis = H.Axis,
+            Series = H.Series,
+            StackItem = H.StackItem,
+            seriesTypes = H.seriesTypes,
+            getStackIndicator = Series.prototype.getStackIndicator;
+
+        /**
+         * Stacks where every series has at least this many points are
+         * stacked in columns. Set to 0 to disable it for a series.
+         */
+        H.setOptions({
+            plotOptions: {
+                series: {
+                    columnarStackThreshold: 1000
+                }
+            }
+        });
+
+        /**
+         * Get the y column of a series, reusing the previous one while the
+         * processed data is unchanged. Null values are NaN. The column is
+         * invalid when the x values are not increasing numbers or a y value
+         * is neither a finite number nor null.
+         */
+        function getColumn(series) {
+            var xData = series.processedXData,
+                yData = series.processedYData,
+                len = yData.length,
+                column = series.stackColumn,
+                values,
+                x,
+                y,
+                i;
+
+            if (
+                column &&
+                !series.isDirtyData &&
+                column.xData === xData &&
+                column.yData === yData &&
+                column.length === len
+            ) {
+                return column;
+            }
+
+            column = series.stackColumn = {
+                xData: xData,
+                yData: yData,
+                length: len,
+                values: new Float64Array(len),
+                hasNulls: false,
+                valid: xData.length === len
+            };
+            values = column.values;
+
+            for (i = 0; i < len && column.valid; i++) {
+                x = xData[i];
+                y = yData[i];
+                if (typeof x !== 'number' || (i && !(x > xData[i - 1]))) {
+                    column.valid = false;
+                } else if (y === null) {
+                    values[i] = NaN;
+                    column.hasNulls = true;
+                } else if (typeof y === 'number' && isFinite(y)) {
+                    values[i] = y;
+                } else {
+                    column.valid = false;
+                }
+            }
+            return column;
+        }
+
+        /**
+         * Check whether a stack group can be stacked in columns, and collect
+         * the columns of its series. The x values are compared only when a
+         * column or the column it was compared to has changed.
+         */
+        function initGroup(group) {
+            var members = group.series,
+                first = members[0],
+                stacking = first.options.stacking,
+                columns = [],
+                reference,
+                i;
+
+            for (i = 0; i < members.length; i++) {
+                var series = members[i],
+                    threshold = series.options.columnarStackThreshold,
+                    column;
+
+                if (
+                    series.negStacks ||
+                    series.options.stacking !== stacking ||
+                    !threshold ||
+                    series.processedYData.length < threshold
+                ) {
+                    return false;
+                }
+
+                column = getColumn(series);
+                if (!column.valid) {
+                    return false;
+                }
+
+                if (!reference) {
+                    reference = column;
+                } else if (column.alignedTo !== reference) {
+                    if (
+                        column.length !== reference.length ||
+                        !sameValues(column.xData, reference.xData)
+                    ) {
+                        return false;
+                    }
+                    column.alignedTo = reference;
+                }
+
+                group.hasNulls = group.hasNulls || column.hasNulls;
+                group.hasGaps = group.hasGaps || !!series.options.gapSize;
+                columns.push(column);
+            }
+
+            group.columns = columns;
+            group.xData = reference.xData;
+            group.stacking = stacking;
+            return true;
+        }
+
+        function sameValues(a, b) {
+            var i = a.length;
+            if (a !== b) {
+                while (i--) {
+                    if (a[i] !== b[i]) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Fill the stack items of a columnar group. The first pass sums the
+         * totals for all x values, the second walks the series in stack order
+         * with a running column of cumulative values, in the same order of
+         * additions as setStackedPoints.
+         */
+        Axis.prototype.setColumnarStacks = function (group) {
+            var axis = this,
+                members = group.series,
+                columns = group.columns,
+                xData = group.xData,
+                len = xData.length,
+                first = members[0],
+                options = first.options,
+                stacking = group.stacking,
+                isPercent = stacking === 'percent',
+                absolute = isPercent,
+                isStream = stacking === 'stream' &&
+                    seriesTypes.streamgraph &&
+                    first.streamStacker ===
+                        seriesTypes.streamgraph.prototype.streamStacker,
+                stacker = !isPercent && !isStream &&
+                    first[stacking + 'Stacker'],
+                base = options.startFromThreshold ? options.threshold : 0,
+                stacks = axis.stacks[group.key],
+                oldStacks = group.oldStacks,
+                stackLabels = axis.options.stackLabels,
+                totals = new Float64Array(len),
+                cum = new Float64Array(len),
+                items = [],
+                firstValues = columns[0].values,
+                values,
+                series,
+                stackedYData,
+                index,
+                item,
+                point,
+                factor,
+                bottom,
+                top,
+                x,
+                y,
+                i,
+                j;
+
+            if (isPercent) {
+                if (first.percentStacker !== Series.prototype.percentStacker) {
+                    stacker = first.percentStacker;
+                    isPercent = false;
+                }
+                axis.usePercentage = true;
+            }
+
+            for (j = 0; j < columns.length; j++) {
+                values = columns[j].values;
+                for (i = 0; i < len; i++) {
+                    y = values[i];
+                    if (y === y) {
+                        totals[i] += absolute ? Math.abs(y) : y;
+                    }
+                }
+            }
+
+            for (i = 0; i < len; i++) {
+                x = xData[i];
+                item = stacks[x];
+                if (!item) {
+                    if (oldStacks && oldStacks[x]) {
+                        item = stacks[x] = oldStacks[x];
+                    } else {
+                        item = stacks[x] = new StackItem(
+                            axis,
+                            stackLabels,
+                            false,
+                            x,
+                            options.stack
+                        );
+                    }
+                }
+                item.total = correctFloat(totals[i]);
+                if (firstValues[i] === firstValues[i]) {
+                    item.base = first.index;
+                }
+                items[i] = item;
+                cum[i] = base;
+            }
+
+            for (j = 0; j < members.length; j++) {
+                series = members[j];
+                index = series.index;
+                values = columns[j].values;
+                stackedYData = series.stackedYData = [];
+
+                for (i = 0; i < len; i++) {
+                    y = values[i];
+                    if (y !== y) {
+                        continue;
+                    }
+
+                    item = items[i];
+                    item.touched = series.stacksTouched;
+                    bottom = cum[i];
+                    top = cum[i] = bottom + y;
+
+                    // Reuse the point array of the previous build, so a
+                    // visibility toggle allocates nothing here
+                    point = item.points[index];
+                    if (!point) {
+                        point = item.points[index] = [];
+                    }
+
+                    // Percent and stream stacks are scaled and centered
+                    // like percentStacker and the streamgraph streamStacker
+                    if (isPercent) {
+                        factor = item.total ? 100 / item.total : 0;
+                        point[0] = correctFloat(bottom * factor);
+                        point[1] = stackedYData[i] =
+                            correctFloat(top * factor);
+                    } else if (isStream) {
+                        point[0] = bottom - item.total / 2;
+                        point[1] = top - item.total / 2;
+                        stackedYData[i] = index === 0 ? point[1] : point[0];
+                    } else {
+                        point[0] = bottom;
+                        point[1] = stackedYData[i] = top;
+                        if (stacker) {
+                            stacker.call(series, point, item, i);
+                        }
+                    }
+                }
+            }
+
+            for (i = 0; i < len; i++) {
+                items[i].cum = cum[i];
+            }
+        };
+
+        /**
+         * Group the stacked series of the axis by stack key, in the order
+         * buildStacks stacks them, and mark the groups that are stacked in
+         * columns before the regular stacking runs for the others.
+         */
+        wrap(Axis.prototype, 'buildStacks', function (proceed) {
+            var axis = this,
+                allSeries = axis.series,
+                reversed = pick(axis.options.reversedStacks, true),
+                len = allSeries.length,
+                groups = {},
+                columnar = [],
+                series,
+                group,
+                i;
+
+            if (axis.isXAxis) {
+                return proceed.call(axis);
+            }
+
+            for (i = len; i--;) {
+                series = allSeries[reversed ? i : len - i - 1];
+                series.columnarStack = null;
+                if (
+                    series.options.stacking &&
+                    (
+                        series.visible === true ||
+                        series.chart.options.chart.ignoreHiddenSeries === false
+                    )
+                ) {
+                    group = groups[series.stackKey];
+                    if (!group) {
+                        group = groups[series.stackKey] = {
+                            key: series.stackKey,
+                            series: []
+                        };
+                        columnar.push(group);
+                    }
+                    group.series.push(series);
+                }
+            }
+
+            columnar = H.grep(columnar, initGroup);
+            each(columnar, function (group) {
+                each(group.series, function (series) {
+                    series.columnarStack = group;
+                });
+            });
+
+            proceed.call(axis);
+
+            each(columnar, function (group) {
+                axis.setColumnarStacks(group);
+            });
+        });
+
+        /**
+         * Series of a columnar stack only take their turn in the regular
+         * order, so the stack items are touched and the old stacks are taken
+         * over the same way as when each series stacks itself.
+         */
+        wrap(Series.prototype, 'setStackedPoints', function (proceed) {
+            var group = this.columnarStack,
+                yAxis = this.yAxis;
+
+            if (group) {
+                if (!group.oldStacks) {
+                    group.oldStacks = yAxis.oldStacks[group.key] || {};
+                    if (!yAxis.stacks[group.key]) {
+                        yAxis.stacks[group.key] = {};
+                    }
+                }
+                yAxis.stacksTouched += 1;
+                this.stacksTouched = yAxis.stacksTouched;
+                yAxis.oldStacks = {};
+            } else {
+                proceed.call(this);
+            }
+        });
+
+        wrap(Series.prototype, 'modifyStacks', function (proceed) {
+            if (!this.columnarStack) {
+                proceed.call(this);
+            }
+        });
+
+        /**
+         * Columnar stacks hold one point per series and x value, keyed by the
+         * series index, so the indicator needs no string key. This is called
+         * once per point in translate, so it is not wrapped.
+         */
+        Series.prototype.getStackIndicator = function (
+            indicator,
+            x,
+            index,
+            key
+        ) {
+            if (this.columnarStack && !key) {
+                if (!indicator || indicator.key !== index) {
+                    indicator = { key: index, index: 0 };
+                }
+                indicator.x = x;
+                return indicator;
+            }
+            return getStackIndicator.apply(this, arguments);
+        };
+
+        /**
+         * Without null points every x value of a columnar stack has a point in
+         * each series, so the stack points are the series points in order and
+         * there are no cliffs. Stacks with nulls need the neighbour lookups of
+         * the regular code, and so do stacks with gaps, since the gaps are
+         * added to the stack as empty stack items.
+         */
+        wrap(seriesTypes.area.prototype, 'getStackPoints', function (
+            proceed,
+            points
+        ) {
+            var group = this.columnarStack,
+                i;
+
+            if (
+                group &&
+                !group.hasNulls &&
+                !group.hasGaps &&
+                (!points || points === this.points) &&
+                this.points.length === group.xData.length
+            ) {
+                points = this.points;
+                for (i = 0; i < points.length; i++) {
+                    if (points[i].isNull) {
+                        return proceed.call(this, points);
+                    }
+                }
+                for (i = 0; i < points.length; i++) {
+                    points[i].leftCliff = points[i].rightCliff = 0;
+                }
+                return points.slice();
+            }
+            return proceed.call(this, points);
+        });
+
+        wrap(Series.prototype, 'destroy', function (proceed) {
+            this.stackColumn = this.columnarStack = null;
+            proceed.call(this);
+        });
+    }(Highcharts));
+}));
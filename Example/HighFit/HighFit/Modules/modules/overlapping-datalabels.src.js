@@ -0,0 +1,346 @@
+/*
+ Highcharts JS v6.0.2 (2017-10-20)
+
+ (c) 2009-2017 Torstein Honsi
+
+ License: www.highcharts.com/license
+*/
+/**
+ * (c) 2009-2017 Highsoft AS
+ *
+ * License: www.highcharts.com/license
+ *
+ * Overlapping data labels module. The chart hides labels that overlap a
+ * label of a higher rank after every render, testing each label against all
+ * the others. With thousands of labels those tests dominate the redraw. This
+ * module replaces Chart.hideOverlappingLabels with a pass over a uniform grid
+ * of the plot: the boxes of the labels are read once, each label is only
+ * tested against the visible labels sharing a grid cell with it, and the
+ * labels left visible are the same as with the pairwise tests.
+ *
+ * The chart collects the labels itself, so the module only replaces the
+ * method.
+ */
+(function (factory) {
+    if (typeof module === 'object' && module.exports) {
+        module.exports = factory;
+    } else {
+        factory(Highcharts);
+    }
+}(function (Highcharts) {
+    (function (H) {
+        var each = H.each,
+            Chart = H.Chart;
+
+        /**
+         * Cells per label the grid may have at most, so a few large labels
+         * spanning the plot do not make it sparse.
+         */
+        var MAX_CELLS_PER_LABEL = 4;
+
+        function isIntersectRect(x1, y1, w1, h1, x2, y2, w2, h2) {
+            return !(
+                x2 > x1 + w1 ||
+                x2 + w2 < x1 ||
+                y2 > y1 + h1 ||
+                y2 + h2 < y1
+            );
+        }
+
+        /**
+         * Whether label b, placed before label a, overlaps it. As in the
+         * pairwise test, the padding of b is taken off both sizes.
+         */
+        function isOverlapping(b, a) {
+            var padding = b.padding;
+            return isIntersectRect(
+                b.x,
+                b.y,
+                b.width - padding,
+                b.height - padding,
+                a.x,
+                a.y,
+                a.width - padding,
+                a.height - padding
+            );
+        }
+
+        /**
+         * A uniform grid over the boxes, with cells about the mean label
+         * size. Boxes are added to every cell they cover.
+         */
+        function LabelGrid(boxes) {
+            var minX = Infinity,
+                minY = Infinity,
+                maxX = -Infinity,
+                maxY = -Infinity,
+                size = 0,
+                count = 0,
+                cells;
+
+            each(boxes, function (box) {
+                if (box.bounded) {
+                    minX = Math.min(minX, box.x);
+                    minY = Math.min(minY, box.y);
+                    maxX = Math.max(maxX, box.x + box.width);
+                    maxY = Math.max(maxY, box.y + box.height);
+                    size += (box.width + box.height) / 2;
+                    count++;
+                }
+            });
+
+            this.x = count ? minX : 0;
+            this.y = count ? minY : 0;
+            this.cellSize = Math.max(1, count ? size / count : 1);
+            this.columns = Math.max(
+                1,
+                Math.ceil((maxX - this.x) / this.cellSize) || 1
+            );
+            this.rows = Math.max(
+                1,
+                Math.ceil((maxY - this.y) / this.cellSize) || 1
+            );
+
+            cells = this.columns * this.rows;
+            if (cells > MAX_CELLS_PER_LABEL * count + 16) {
+                this.cellSize *= Math.sqrt(
+                    cells / (MAX_CELLS_PER_LABEL * count + 16)
+                );
+                this.columns = Math.max(
+                    1,
+                    Math.ceil((maxX - this.x) / this.cellSize)
+                );
+                this.rows = Math.max(
+                    1,
+                    Math.ceil((maxY - this.y) / this.cellSize)
+                );
+            }
+            this.cells = [];
+        }
+
+        LabelGrid.prototype = {
+            /**
+             * Calls fn with the index of each cell the box covers. Boxes
+             * outside the grid are clamped to its edge cells.
+             */
+            eachCell: function (box, fn) {
+                var grid = this,
+                    clamp = function (value, max) {
+                        return Math.min(max - 1, Math.max(0, value));
+                    },
+                    column0 = clamp(
+                        Math.floor((box.x - grid.x) / grid.cellSize),
+                        grid.columns
+                    ),
+                    column1 = clamp(
+                        Math.floor((box.x + box.width - grid.x) / grid.cellSize),
+                        grid.columns
+                    ),
+                    row0 = clamp(
+                        Math.floor((box.y - grid.y) / grid.cellSize),
+                        grid.rows
+                    ),
+                    row1 = clamp(
+                        Math.floor((box.y + box.height - grid.y) / grid.cellSize),
+                        grid.rows
+                    ),
+                    column,
+                    row;
+
+                for (row = row0; row <= row1; row++) {
+                    for (column = column0; column <= column1; column++) {
+                        fn(row * grid.columns + column);
+                    }
+                }
+            },
+
+            insert: function (box) {
+                var cells = this.cells;
+                this.eachCell(box, function (i) {
+                    (cells[i] || (cells[i] = [])).push(box);
+                });
+            },
+
+            /**
+             * The first box sharing a cell with box that passes test, each
+             * box tested once.
+             */
+            find: function (box, stamp, test) {
+                var cells = this.cells,
+                    found;
+                this.eachCell(box, function (i) {
+                    var cell = cells[i],
+                        j,
+                        other;
+                    if (found || !cell) {
+                        return;
+                    }
+                    for (j = 0; j < cell.length; j++) {
+                        other = cell[j];
+                        if (other.stamp !== stamp) {
+                            other.stamp = stamp;
+                            if (test(other)) {
+                                found = other;
+                                return;
+                            }
+                        }
+                    }
+                });
+                return found;
+            }
+        };
+
+        /**
+         * Hides the labels that overlap a visible label of a higher rank.
+         * Labels are taken in order of rank, and a label stays visible when
+         * it overlaps none of the visible labels before it, which is the
+         * outcome of testing every pair in that order.
+         */
+        Chart.prototype.hideOverlappingLabels = function (labels) {
+            var len = labels.length,
+                boxes = [],
+                unbounded = [],
+                visible = [],
+                grid,
+                label,
+                bBox,
+                pos,
+                parent,
+                i;
+
+            for (i = 0; i < len; i++) {
+                label = labels[i];
+                if (label) {
+                    // Mark with initial opacity
+                    label.oldOpacity = label.opacity;
+                    label.newOpacity = 1;
+
+                    // Get width and height if pure text nodes (stack labels)
+                    if (!label.width) {
+                        bBox = label.getBBox();
+                        label.width = bBox.width;
+                        label.height = bBox.height;
+                    }
+                }
+            }
+
+            // Prevent a situation in a gradually rising slope, that each
+            // label will hide the previous one because the previous one
+            // always has lower rank.
+            labels.sort(function (a, b) {
+                return (b.labelrank || 0) - (a.labelrank || 0);
+            });
+
+            // The absolute boxes of the placed labels, read once
+            for (i = 0; i < len; i++) {
+                label = labels[i];
+                if (label && label.placed) {
+                    pos = label.alignAttr;
+                    parent = label.parentGroup;
+                    boxes.push({
+                        label: label,
+                        x: pos.x + parent.translateX,
+                        y: pos.y + parent.translateY,
+                        width: label.width,
+                        height: label.height,
+                        padding: 2 * (label.box ? 0 : label.padding || 0),
+                        stamp: -1
+                    });
+                }
+            }
+            each(boxes, function (box) {
+                box.bounded = isFinite(box.x) && isFinite(box.y) &&
+                    isFinite(box.width) && isFinite(box.height);
+            });
+
+            grid = new LabelGrid(boxes);
+            each(boxes, function (box, stamp) {
+                var label = box.label,
+                    hides = function (other) {
+                        var otherLabel = other.label;
+                        if (
+                            other.visible &&
+                            otherLabel !== label &&
+                            isOverlapping(other, box)
+                        ) {
+                            if (otherLabel.labelrank < label.labelrank) {
+                                otherLabel.newOpacity = 0;
+                                other.visible = false;
+                                return false;
+                            }
+                            label.newOpacity = 0;
+                            return true;
+                        }
+                        return false;
+                    },
+                    j;
+
+                if (label.newOpacity === 0) {
+                    return;
+                }
+
+                // Boxes with a position that is not a number overlap any
+                // other box in the pairwise test, so they are tested
+                // against all of them
+                if (box.bounded) {
+                    j = 0;
+                    while (j < unbounded.length && !hides(unbounded[j])) {
+                        j++;
+                    }
+                    if (label.newOpacity !== 0) {
+                        grid.find(box, stamp, hides);
+                    }
+                } else {
+                    j = 0;
+                    while (j < visible.length && !hides(visible[j])) {
+                        j++;
+                    }
+                }
+
+                // Whether the box hides the labels after it is decided
+                // here, when it is the first of the pair
+                box.visible = label.newOpacity !== 0;
+                if (box.visible) {
+                    visible.push(box);
+                    if (box.bounded) {
+                        grid.insert(box);
+                    } else {
+                        unbounded.push(box);
+                    }
+                }
+            });
+
+            // Hide or show
+            each(labels, function (label) {
+                var complete,
+                    newOpacity;
+
+                if (label) {
+                    newOpacity = label.newOpacity;
+
+                    if (label.oldOpacity !== newOpacity && label.placed) {
+
+                        // Make sure the label is completely hidden to avoid
+                        // catching clicks (#4362)
+                        if (newOpacity) {
+                            label.show(true);
+                        } else {
+                            complete = function () {
+                                label.hide();
+                            };
+                        }
+
+                        // Animate or set the opacity
+                        label.alignAttr.opacity = newOpacity;
+                        label[label.isOld ? 'animate' : 'attr'](
+                            label.alignAttr,
+                            null,
+                            complete
+                        );
+                    }
+                    label.isOld = true;
+                }
+            });
+        };
+    }(Highcharts));
+}));
@@ -0,0 +1,518 @@
+/*
+  Highcharts JS v6.0.2 (2017-10-20)
+ Sankey diagram module
+
+ (c) 2010-2017 Torstein Honsi
+
+ License: www.highcharts.com/license
+*/
+/**
+ * (c) 2010-2017 Torstein Honsi
+ *
+ * License: www.highcharts.com/license
+ *
+ * Sankey diagram module. The points are the links between nodes, given by
+ * their from and to ids, and the nodes are created from those ids.
+ *
+ * The nodes are found by id in a lookup kept on the series, and the layout
+ * places the nodes of a column and the links of a node in one running pass
+ * each, so a translate is linear in the number of nodes and links. That is
+ * what keeps frequent weight updates cheap: the scale of the nodes depends
+ * on the largest column, so every node and link is placed again anyway.
+ */
+(function (factory) {
+    if (typeof module === 'object' && module.exports) {
+        module.exports = factory;
+    } else {
+        factory(Highcharts);
+    }
+}(function (Highcharts) {
+    (function (H) {
+        var defined = H.defined,
+            each = H.each,
+            extend = H.extend,
+            seriesType = H.seriesType,
+            Point = H.Point;
+
+        /**
+         * Map the items of a list by id, keeping the first item of each id.
+         */
+        var getLookup = function (list) {
+            var lookup = {};
+            each(list || [], function (item) {
+                var key = '#' + (item && item.id);
+                if (item && !lookup[key]) {
+                    lookup[key] = item;
+                }
+            });
+            return lookup;
+        };
+
+        /**
+         * Find the first item of a list with the given id. The lookup is
+         * keyed by the id as a string, so the list is searched only when the
+         * item found has an id of another type.
+         */
+        var findById = function (list, lookup, id) {
+            var item = lookup['#' + id];
+            if (item && item.id !== id) {
+                item = H.find(list, function (item) {
+                    return item.id === id;
+                });
+            }
+            return item;
+        };
+
+        seriesType('sankey', 'column', {
+            colorByPoint: true,
+            curveFactor: 0.33,
+            dataLabels: {
+                enabled: true,
+                backgroundColor: 'none', // enable padding
+                crop: false,
+                nodeFormat: undefined,
+                nodeFormatter: function () {
+                    return this.point.name;
+                },
+                format: undefined,
+                formatter: function () {
+                    return '';
+                },
+                inside: true
+            },
+            linkOpacity: 0.5,
+            nodeWidth: 20,
+            nodePadding: 10,
+            showInLegend: false,
+            states: {
+                hover: {
+                    linkOpacity: 1
+                }
+            },
+            tooltip: {
+                followPointer: true,
+                headerFormat:
+                    '<span style="font-size: 0.85em">{series.name}</span><br/>',
+                pointFormat:
+                    '{point.fromNode.name} → {point.toNode.name}: ' +
+                    '<b>{point.weight}</b><br/>',
+                nodeFormat: '{point.name}: <b>{point.sum}</b><br/>'
+            }
+        }, {
+            isCartesian: false,
+            forceDL: true,
+
+            /**
+             * Create a single node that holds information on incoming and
+             * outgoing links.
+             */
+            createNode: function (id) {
+                var lookup = this.nodeLookup,
+                    node = findById(this.nodes, lookup, id),
+                    options;
+
+                if (!node) {
+                    options = this.options.nodes && findById(
+                        this.options.nodes,
+                        this.nodeOptionsLookup ||
+                            getLookup(this.options.nodes),
+                        id
+                    );
+                    node = (new Point()).init(
+                        this,
+                        extend({
+                            className: 'highcharts-node',
+                            isNode: true,
+                            id: id,
+                            y: 1 // Pass isNull test
+                        }, options)
+                    );
+                    node.linksTo = [];
+                    node.linksFrom = [];
+                    node.formatPrefix = 'node';
+                    node.name = node.name || node.id; // for use in formats
+
+                    // Return the largest sum of either the incoming or
+                    // outgoing links.
+                    node.getSum = function () {
+                        var sumTo = 0,
+                            sumFrom = 0;
+                        each(node.linksTo, function (link) {
+                            sumTo += link.weight;
+                        });
+                        each(node.linksFrom, function (link) {
+                            sumFrom += link.weight;
+                        });
+                        return Math.max(sumTo, sumFrom);
+                    };
+
+                    // Get the offset in weight values of a point/link.
+                    node.offset = function (point, coll) {
+                        var offset = 0,
+                            i;
+                        for (i = 0; i < node[coll].length; i++) {
+                            if (node[coll][i] === point) {
+                                return offset;
+                            }
+                            offset += node[coll][i].weight;
+                        }
+                    };
+
+                    // Return true if the node has a shape, otherwise all
+                    // links are outgoing.
+                    node.hasShape = function () {
+                        var outgoing = 0;
+                        each(node.linksTo, function (link) {
+                            if (link.outgoing) {
+                                outgoing++;
+                            }
+                        });
+                        return (
+                            !node.linksTo.length ||
+                            outgoing !== node.linksTo.length
+                        );
+                    };
+
+                    this.nodes.push(node);
+                    if (!lookup['#' + id]) {
+                        lookup['#' + id] = node;
+                    }
+                }
+                return node;
+            },
+
+            /**
+             * Create a node column.
+             */
+            createNodeColumn: function () {
+                var chart = this.chart,
+                    column = [],
+                    nodePadding = this.options.nodePadding;
+
+                column.sum = function () {
+                    var sum = 0;
+                    each(this, function (node) {
+                        sum += node.getSum();
+                    });
+                    return sum;
+                };
+                // Get the offset in pixels of a node inside the column.
+                column.offset = function (node, factor) {
+                    var offset = 0,
+                        i;
+                    for (i = 0; i < column.length; i++) {
+                        if (column[i] === node) {
+                            return offset;
+                        }
+                        offset += column[i].getSum() * factor + nodePadding;
+                    }
+                };
+
+                // Get the column height in pixels.
+                column.top = function (factor) {
+                    var height = 0,
+                        i;
+                    for (i = 0; i < column.length; i++) {
+                        if (i > 0) {
+                            height += nodePadding;
+                        }
+                        height += column[i].getSum() * factor;
+                    }
+                    return (chart.plotSizeY - height) / 2;
+                };
+
+                return column;
+            },
+
+            /**
+             * Create node columns by analyzing the nodes and the relations
+             * between incoming links.
+             */
+            createNodeColumns: function () {
+                var columns = [];
+                each(this.nodes, function (node) {
+                    var fromColumn = 0,
+                        i,
+                        point;
+
+                    // No links to this node, place it left
+                    if (node.linksTo.length === 0) {
+                        node.column = 0;
+
+                    // There are incoming links, place it to the right of the
+                    // highest order column that links to this one.
+                    } else {
+                        for (i = 0; i < node.linksTo.length; i++) {
+                            point = node.linksTo[0];
+                            if (point.fromNode.column > fromColumn) {
+                                fromColumn = point.fromNode.column;
+                            }
+                        }
+                        node.column = fromColumn + 1;
+                    }
+
+                    if (!columns[node.column]) {
+                        columns[node.column] = this.createNodeColumn();
+                    }
+
+                    columns[node.column].push(node);
+
+                }, this);
+                return columns;
+            },
+
+            /**
+             * Return the presentational attributes.
+             */
+            pointAttribs: function (point, state) {
+
+                var opacity = this.options.linkOpacity;
+
+                if (state) {
+                    opacity = this.options.states[state].linkOpacity ||
+                        opacity;
+                }
+
+                return {
+                    fill: point.isNode ?
+                        point.color :
+                        H.color(point.color).setOpacity(opacity).get()
+                };
+            },
+
+            /**
+             * Extend generatePoints by adding the nodes, which are Point
+             * objects but pushed to the this.nodes array.
+             */
+            generatePoints: function () {
+
+                var nodeLookup = {};
+
+                H.Series.prototype.generatePoints.call(this);
+
+                if (!this.nodes) {
+                    this.nodes = []; // List of Point-like node items
+                    this.nodeLookup = {};
+                }
+                if (!this.nodeLookup) {
+                    this.nodeLookup = getLookup(this.nodes);
+                }
+                this.colorCounter = 0;
+                this.nodeOptionsLookup = getLookup(this.options.nodes);
+
+                // Reset links from previous run
+                each(this.nodes, function (node) {
+                    node.linksFrom.length = 0;
+                    node.linksTo.length = 0;
+                });
+
+                // Create the node list
+                each(this.points, function (point) {
+                    if (defined(point.from)) {
+                        if (!nodeLookup[point.from]) {
+                            nodeLookup[point.from] = this.createNode(
+                                point.from
+                            );
+                        }
+                        nodeLookup[point.from].linksFrom.push(point);
+                        point.fromNode = nodeLookup[point.from];
+                        point.color =
+                            point.options.color || nodeLookup[point.from].color;
+                    }
+                    if (defined(point.to)) {
+                        if (!nodeLookup[point.to]) {
+                            nodeLookup[point.to] = this.createNode(point.to);
+                        }
+                        nodeLookup[point.to].linksTo.push(point);
+                        point.toNode = nodeLookup[point.to];
+                    }
+
+                    point.name = point.name || point.id; // for use in formats
+                }, this);
+            },
+
+            /**
+             * Run pre-translation by generating the nodeColumns.
+             */
+            translate: function () {
+                if (!this.processedXData) {
+                    this.processData();
+                }
+                this.generatePoints();
+
+                this.nodeColumns = this.createNodeColumns();
+
+                var chart = this.chart,
+                    inverted = chart.inverted,
+                    options = this.options,
+                    left = 0,
+                    nodeWidth = options.nodeWidth,
+                    nodeColumns = this.nodeColumns,
+                    colDistance = (chart.plotSizeX - nodeWidth) /
+                        (nodeColumns.length - 1),
+                    curvy = (
+                        (inverted ? -colDistance : colDistance) *
+                        options.curveFactor
+                    ),
+                    factor = Infinity;
+
+                // Sum the nodes once, the column sums and offsets below add
+                // them up in the same order as column.sum and column.offset
+                each(nodeColumns, function (column) {
+                    var columnSum = 0;
+                    each(column, function (node) {
+                        node.sum = node.getSum();
+                        columnSum += node.sum;
+                    });
+                    factor = Math.min(
+                        factor,
+                        (
+                            chart.plotSizeY -
+                            (column.length - 1) * options.nodePadding
+                        ) / columnSum
+                    );
+                });
+
+                // Place the nodes in their columns, and the links at the
+                // nodes they go from and to
+                each(nodeColumns, function (column) {
+                    var height = 0,
+                        offset = 0;
+
+                    each(column, function (node, i) {
+                        if (i > 0) {
+                            height += options.nodePadding;
+                        }
+                        height += node.sum * factor;
+                    });
+                    column.pixelTop = (chart.plotSizeY - height) / 2;
+
+                    each(column, function (node) {
+                        var fromOffset = 0,
+                            toOffset = 0;
+
+                        node.columnOffset = offset;
+                        offset += node.sum * factor + options.nodePadding;
+
+                        each(node.linksFrom, function (point) {
+                            point.fromOffset = fromOffset;
+                            fromOffset += point.weight;
+                        });
+                        each(node.linksTo, function (point) {
+                            point.toOffset = toOffset;
+                            toOffset += point.weight;
+                        });
+                    });
+                });
+
+                each(nodeColumns, function (column) {
+                    each(column, function (node) {
+
+                        var height = node.sum * factor,
+                            fromNodeTop = column.pixelTop + node.columnOffset,
+                            nodeLeft = inverted ?
+                                chart.plotSizeX - left :
+                                left;
+
+                        node.shapeType = 'rect';
+                        node.shapeArgs = inverted ? {
+                            x: nodeLeft - nodeWidth,
+                            y: chart.plotSizeY - fromNodeTop - height,
+                            width: nodeWidth,
+                            height: height
+                        } : {
+                            x: nodeLeft,
+                            y: fromNodeTop,
+                            width: nodeWidth,
+                            height: height
+                        };
+                        node.shapeArgs.display = node.hasShape() ? '' : 'none';
+
+                        // Pass test in drawPoints
+                        node.plotY = 1;
+
+                        // Link paths
+                        each(node.linksFrom, function (point) {
+                            var linkHeight = point.weight * factor,
+                                fromLinkTop = point.fromOffset * factor,
+                                fromY = fromNodeTop + fromLinkTop,
+                                toNode = point.toNode,
+                                toColumn = nodeColumns[toNode.column],
+                                toY = toColumn.pixelTop +
+                                    point.toOffset * factor +
+                                    toNode.columnOffset,
+                                nodeW = nodeWidth,
+                                right = toNode.column * colDistance,
+                                outgoing = point.outgoing;
+
+                            if (inverted) {
+                                fromY = chart.plotSizeY - fromY;
+                                toY = chart.plotSizeY - toY;
+                                right = chart.plotSizeX - right;
+                                nodeW = -nodeW;
+                                linkHeight = -linkHeight;
+                            }
+
+                            point.shapeType = 'path';
+                            point.shapeArgs = {
+                                d: [
+                                    'M', nodeLeft + nodeW, fromY,
+                                    'C', nodeLeft + nodeW + curvy, fromY,
+                                    right - curvy, toY,
+                                    right, toY,
+                                    'L',
+                                    right + (outgoing ? nodeW : 0),
+                                    toY + linkHeight / 2,
+                                    'L',
+                                    right,
+                                    toY + linkHeight,
+                                    'C', right - curvy, toY + linkHeight,
+                                    nodeLeft + nodeW + curvy,
+                                    fromY + linkHeight,
+                                    nodeLeft + nodeW, fromY + linkHeight,
+                                    'z'
+                                ]
+                            };
+
+                            // Place data labels in the middle
+                            point.dlBox = {
+                                x: nodeLeft + (right - nodeLeft + nodeW) / 2,
+                                y: fromY + (toY - fromY) / 2,
+                                height: linkHeight,
+                                width: 0
+                            };
+                            // Pass test in drawPoints
+                            point.y = point.plotY = 1;
+
+                            if (!point.color) {
+                                point.color = node.color;
+                            }
+                        });
+                    });
+                    left += colDistance;
+
+                }, this);
+            },
+
+            /**
+             * Extend the render function to also render this.nodes together
+             * with the points.
+             */
+            render: function () {
+                var points = this.points;
+                this.points = this.points.concat(this.nodes);
+                H.seriesTypes.column.prototype.render.call(this);
+                this.points = points;
+            },
+            animate: H.Series.prototype.animate
+        }, {
+            getClassName: function () {
+                return 'highcharts-link ' +
+                    Point.prototype.getClassName.call(this);
+            },
+            isValid: function () {
+                return this.isNode || typeof this.weight === 'number';
+            }
+        });
+    }(Highcharts));
+}));
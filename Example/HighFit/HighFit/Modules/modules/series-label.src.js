@@ -0,0 +1,1414 @@
+/*
+ Highcharts JS v6.0.2 (2017-10-20)
+
+ (c) 2009-2017 Torstein Honsi
+
+ License: www.highcharts.com/license
+*/
+/**
+ * (c) 2009-2017 Torstein Honsi
+ *
+ * License: www.highcharts.com/license
+ *
+ * Series label module. Places the name of each series next to its graph,
+ * where it is clear of the other graphs and labels.
+ *
+ * Each candidate position of a label is tested against the graphs of the
+ * other series. Instead of walking every point of every series for every
+ * candidate, the segments and points of all graphs are put in a uniform grid
+ * once per placement pass, so a candidate only visits the grid cells around
+ * its box: segments crossing the box, and the nearest points by rings of
+ * cells. The positions found are the same as with the full walk, which is
+ * kept for positions tested outside a placement pass.
+ *
+ * A label is not placed again when nothing within reach of it changed since
+ * the last pass: its own graph, its size, the graphs of other series and the
+ * boxes to avoid around its graph. A redraw that only changes unrelated
+ * series leaves it where it is.
+ */
+(function (factory) {
+    if (typeof module === 'object' && module.exports) {
+        module.exports = factory;
+    } else {
+        factory(Highcharts);
+    }
+}(function (Highcharts) {
+    (function (H) {
+        /**
+         * Containing the logic for series labels
+         */
+        var labelDistance = 3,
+            wrap = H.wrap,
+            each = H.each,
+            extend = H.extend,
+            inArray = H.inArray,
+            isNumber = H.isNumber,
+            pick = H.pick,
+            Series = H.Series,
+            SVGRenderer = H.SVGRenderer,
+            Chart = H.Chart;
+
+        /**
+         * Size of the cells of the placement grid, in pixels, the distance
+         * graphs are interpolated at.
+         */
+        var gridCellSize = 16;
+
+        H.setOptions({
+            plotOptions: {
+                series: {
+                    label: {
+                        enabled: true,
+                        // Allow labels to be placed distant to the graph if
+                        // necessary, and draw a connector line to the graph
+                        connectorAllowed: true,
+                        // If the label is closer than this to a neighbour
+                        // graph, draw a connector
+                        connectorNeighbourDistance: 24,
+                        minFontSize: null,
+                        maxFontSize: null,
+                        onArea: null,
+                        style: {
+                            fontWeight: 'bold'
+                        },
+                        boxesToAvoid: []
+                    }
+                }
+            }
+        });
+
+        /**
+         * Counter-clockwise, part of the fast line intersection logic
+         */
+        function ccw(x1, y1, x2, y2, x3, y3) {
+            var cw = ((y3 - y1) * (x2 - x1)) - ((y2 - y1) * (x3 - x1));
+            return cw > 0 ? true : cw < 0 ? false : true;
+        }
+
+        /**
+         * Detect if two lines intersect
+         */
+        function intersectLine(x1, y1, x2, y2, x3, y3, x4, y4) {
+            return ccw(x1, y1, x3, y3, x4, y4) !== ccw(x2, y2, x3, y3, x4, y4) &&
+                ccw(x1, y1, x2, y2, x3, y3) !== ccw(x1, y1, x2, y2, x4, y4);
+        }
+
+        /**
+         * Detect if a box intersects with a line
+         */
+        function boxIntersectLine(x, y, w, h, x1, y1, x2, y2) {
+            return (
+                intersectLine(x, y, x + w, y, x1, y1, x2, y2) || // top of label
+                intersectLine(x + w, y, x + w, y + h, x1, y1, x2, y2) || // right
+                intersectLine(x, y + h, x + w, y + h, x1, y1, x2, y2) || // bottom
+                intersectLine(x, y, x, y + h, x1, y1, x2, y2) // left of label
+            );
+        }
+
+        /**
+         * The squared distance of a point to the box of a label, the least
+         * of the distances to its center and corners.
+         */
+        function connectorDistance(x, y, bBox, pointX, pointY) {
+            var left = x - pointX,
+                right = x + bBox.width - pointX,
+                top = y - pointY,
+                bottom = y + bBox.height - pointY,
+                centerX = x + bBox.width / 2 - pointX,
+                centerY = y + bBox.height / 2 - pointY;
+            return Math.min(
+                centerX * centerX + centerY * centerY,
+                left * left + top * top,
+                right * right + top * top,
+                right * right + bottom * bottom,
+                left * left + bottom * bottom
+            );
+        }
+
+        /**
+         * Hashes numbers by their bits into a running 32 bit FNV-1a hash.
+         */
+        var hashNumber = new Float64Array(1),
+            hashWords = new Uint32Array(hashNumber.buffer);
+        function hashNumbers(hash, values) {
+            var i;
+            for (i = 0; i < values.length; i++) {
+                hashNumber[0] = values[i];
+                hash = Math.imul(hash ^ hashWords[0], 16777619);
+                hash = Math.imul(hash ^ hashWords[1], 16777619);
+            }
+            return hash;
+        }
+
+        /**
+         * The graphs of the visible series with interpolated points, in a
+         * uniform grid of segments and points. Series are identified by their
+         * index in chart.series, which orders them as the full walk does.
+         */
+        function LabelGrid(chart) {
+            var grid = this,
+                minX = Infinity,
+                minY = Infinity,
+                maxX = -Infinity,
+                maxY = -Infinity,
+                finite = true;
+
+            grid.counts = [];
+
+            each(chart.series, function (series, s) {
+                var points = series.interpolatedPoints;
+                grid.counts[s] = 0;
+                if (series.visible && points) {
+                    grid.counts[s] = Math.max(points.length - 1, 0);
+                    each(points, function (point) {
+                        var x = point.chartX,
+                            y = point.chartY;
+                        if (!isFinite(x) || !isFinite(y)) {
+                            finite = false;
+                        }
+                        minX = Math.min(minX, x);
+                        minY = Math.min(minY, y);
+                        maxX = Math.max(maxX, x);
+                        maxY = Math.max(maxY, y);
+                    });
+                }
+            });
+
+            // Positions that are not numbers compare in ways a grid can not
+            // reproduce, the full walk handles them
+            grid.valid = finite;
+            if (!finite) {
+                return;
+            }
+
+            grid.x = minX === Infinity ? 0 : minX;
+            grid.y = minY === Infinity ? 0 : minY;
+            grid.columns = Math.max(1, Math.ceil((maxX - grid.x) / gridCellSize) + 1);
+            grid.rows = Math.max(1, Math.ceil((maxY - grid.y) / gridCellSize) + 1);
+            grid.segmentCells = [];
+            grid.pointCells = [];
+            grid.seriesPointCells = [];
+            grid.stamp = 0;
+
+            // Points before a series, to know when a class of points is
+            // empty
+            grid.countsBefore = [0];
+            each(grid.counts, function (count, s) {
+                grid.countsBefore[s + 1] = grid.countsBefore[s] + count;
+            });
+
+            each(chart.series, function (series, s) {
+                var points = series.interpolatedPoints,
+                    ownCells = grid.seriesPointCells[s] = [],
+                    j,
+                    segment;
+                if (!series.visible || !points) {
+                    return;
+                }
+                // Coordinates are copied, points and interpolated positions
+                // are objects of different shapes
+                for (j = 1; j < points.length; j++) {
+                    segment = {
+                        series: s,
+                        x1: points[j - 1].chartX,
+                        y1: points[j - 1].chartY,
+                        x2: points[j].chartX,
+                        y2: points[j].chartY,
+                        stamp: 0
+                    };
+                    grid.eachCell(
+                        Math.min(segment.x1, segment.x2),
+                        Math.min(segment.y1, segment.y2),
+                        Math.max(segment.x1, segment.x2),
+                        Math.max(segment.y1, segment.y2),
+                        function (i) {
+                            (grid.segmentCells[i] || (grid.segmentCells[i] = []))
+                                .push(segment);
+                        }
+                    );
+                    grid.eachCell(
+                        segment.x2,
+                        segment.y2,
+                        segment.x2,
+                        segment.y2,
+                        function (i) {
+                            var item = {
+                                series: s,
+                                index: j,
+                                x: segment.x2,
+                                y: segment.y2,
+                                point: points[j]
+                            };
+                            (grid.pointCells[i] || (grid.pointCells[i] = []))
+                                .push(item);
+                            (ownCells[i] || (ownCells[i] = [])).push(item);
+                        }
+                    );
+                }
+            });
+        }
+
+        LabelGrid.prototype = {
+            column: function (x) {
+                return Math.min(
+                    this.columns - 1,
+                    Math.max(0, Math.floor((x - this.x) / gridCellSize))
+                );
+            },
+
+            row: function (y) {
+                return Math.min(
+                    this.rows - 1,
+                    Math.max(0, Math.floor((y - this.y) / gridCellSize))
+                );
+            },
+
+            /**
+             * Calls fn with the index of each cell covering a rectangle,
+             * clamped to the grid.
+             */
+            eachCell: function (x1, y1, x2, y2, fn) {
+                var column0 = this.column(x1),
+                    column1 = this.column(x2),
+                    row1 = this.row(y2),
+                    row = this.row(y1),
+                    column;
+                for (; row <= row1; row++) {
+                    for (column = column0; column <= column1; column++) {
+                        fn(row * this.columns + column);
+                    }
+                }
+            },
+
+            /**
+             * Calls fn once with each segment that may cross a rectangle,
+             * until it returns true.
+             */
+            eachSegment: function (x1, y1, x2, y2, fn) {
+                var grid = this,
+                    stamp = ++grid.stamp,
+                    stopped = false;
+                grid.eachCell(x1, y1, x2, y2, function (i) {
+                    var cell = grid.segmentCells[i],
+                        j;
+                    for (j = 0; cell && !stopped && j < cell.length; j++) {
+                        if (cell[j].stamp !== stamp) {
+                            cell[j].stamp = stamp;
+                            stopped = fn(cell[j]);
+                        }
+                    }
+                });
+            },
+
+            /**
+             * Visits the points of cells in rings around a rectangle, nearest
+             * first. Before each ring, done is called with the least squared
+             * distance a point of the ring may have to the rectangle, and
+             * the search stops when it returns true.
+             */
+            eachNearPoint: function (cells, x1, y1, x2, y2, fn, done) {
+                var grid = this,
+                    column0 = grid.column(x1),
+                    column1 = grid.column(x2),
+                    row0 = grid.row(y1),
+                    row1 = grid.row(y2),
+                    rings = Math.max(grid.columns, grid.rows),
+                    // From the rectangle to the edges of its cells, less a
+                    // pixel for rounding
+                    margin = Math.min(
+                        x1 - grid.x - column0 * gridCellSize,
+                        grid.x + (column1 + 1) * gridCellSize - x2,
+                        y1 - grid.y - row0 * gridCellSize,
+                        grid.y + (row1 + 1) * gridCellSize - y2
+                    ) - 1,
+                    ring,
+                    bound,
+                    visit = function (column, row) {
+                        var cell,
+                            j;
+                        if (
+                            column >= 0 && column < grid.columns &&
+                            row >= 0 && row < grid.rows
+                        ) {
+                            cell = cells[row * grid.columns + column];
+                            for (j = 0; cell && j < cell.length; j++) {
+                                fn(cell[j]);
+                            }
+                        }
+                    },
+                    column,
+                    row;
+
+                for (ring = 0; ring <= rings; ring++) {
+                    bound = ring ?
+                        Math.max(0, margin + (ring - 1) * gridCellSize) :
+                        0;
+                    if (done(bound * bound)) {
+                        return;
+                    }
+                    if (ring === 0) {
+                        for (row = row0; row <= row1; row++) {
+                            for (column = column0; column <= column1; column++) {
+                                visit(column, row);
+                            }
+                        }
+                    } else {
+                        for (column = column0 - ring; column <= column1 + ring; column++) {
+                            visit(column, row0 - ring);
+                            visit(column, row1 + ring);
+                        }
+                        for (row = row0 - ring + 1; row <= row1 + ring - 1; row++) {
+                            visit(column0 - ring, row);
+                            visit(column1 + ring, row);
+                        }
+                    }
+                }
+            },
+
+            /**
+             * The grid counterpart of Series.checkClearPoint, undefined when
+             * the grid can not answer for the series.
+             */
+            checkClearPoint: function (series, x, y, bBox, checkDistance) {
+                var grid = this,
+                    chart = series.chart,
+                    labelOptions = series.options.label,
+                    connectorEnabled = labelOptions.connectorAllowed,
+                    onArea = pick(labelOptions.onArea, !!series.area),
+                    own = inArray(series, chart.series),
+                    ownPoints = own === -1 ? 0 : grid.counts[own],
+                    hasBefore = own > 0 && grid.countsBefore[own] > 0,
+                    hasAfter = grid.countsBefore[grid.counts.length] -
+                        grid.countsBefore[own + 1] > 0,
+                    leastDistance = 16,
+                    withinRange = false,
+                    rejected = false,
+                    distances = [Number.MAX_VALUE, Number.MAX_VALUE, Number.MAX_VALUE],
+                    distToOthersSquared,
+                    distToPointSquared = Number.MAX_VALUE,
+                    connectorPoint,
+                    connectorIndex,
+                    centerX = x + bBox.width / 2,
+                    centerY = y + bBox.height / 2,
+                    needed,
+                    box,
+                    i;
+
+                // Without a connector, distances are only measured to the
+                // series after the own one once its graph is in range
+                if (!connectorEnabled && onArea && checkDistance) {
+                    return;
+                }
+
+                for (i = 0; i < chart.boxesToAvoid.length; i += 1) {
+                    box = chart.boxesToAvoid[i];
+                    if (!(
+                        x > box.right ||
+                        x + bBox.width < box.left ||
+                        y > box.bottom ||
+                        y + bBox.height < box.top
+                    )) {
+                        return false;
+                    }
+                }
+
+                // Segments crossing the label, and the own graph within the
+                // least distance of it
+                grid.eachSegment(
+                    x - leastDistance - 1,
+                    y - leastDistance - 1,
+                    x + bBox.width + leastDistance + 1,
+                    y + bBox.height + leastDistance + 1,
+                    function (segment) {
+                        if (
+                            segment.x2 >= x - leastDistance &&
+                            segment.x1 <= x + bBox.width + leastDistance
+                        ) {
+                            if (boxIntersectLine(
+                                x,
+                                y,
+                                bBox.width,
+                                bBox.height,
+                                segment.x1,
+                                segment.y1,
+                                segment.x2,
+                                segment.y2
+                            )) {
+                                rejected = true;
+                                return true;
+                            }
+                            if (
+                                segment.series === own &&
+                                !withinRange &&
+                                checkDistance
+                            ) {
+                                withinRange = boxIntersectLine(
+                                    x - leastDistance,
+                                    y - leastDistance,
+                                    bBox.width + 2 * leastDistance,
+                                    bBox.height + 2 * leastDistance,
+                                    segment.x1,
+                                    segment.y1,
+                                    segment.x2,
+                                    segment.y2
+                                );
+                            }
+                        }
+                        return false;
+                    }
+                );
+                if (rejected) {
+                    return false;
+                }
+
+                // The nearest points of the series before, of the own series
+                // on areas, and of the series after
+                needed = connectorEnabled ?
+                    [hasBefore, onArea && ownPoints > 0, hasAfter] :
+                    [false, false, withinRange && hasAfter];
+                if (needed[0] || needed[1] || needed[2]) {
+                    grid.eachNearPoint(
+                        grid.pointCells,
+                        centerX,
+                        centerY,
+                        centerX,
+                        centerY,
+                        function (item) {
+                            var group = item.series < own ? 0 :
+                                    item.series === own ? 1 : 2,
+                                xDist,
+                                yDist,
+                                dist;
+                            if (needed[group]) {
+                                xDist = centerX - item.x;
+                                yDist = centerY - item.y;
+                                dist = xDist * xDist + yDist * yDist;
+                                if (dist < distances[group]) {
+                                    distances[group] = dist;
+                                }
+                            }
+                        },
+                        function (bound) {
+                            return (!needed[0] || bound > distances[0]) &&
+                                (!needed[1] || bound > distances[1]) &&
+                                (!needed[2] || bound > distances[2]);
+                        }
+                    );
+                }
+                distToOthersSquared = Math.min(
+                    distances[0],
+                    distances[1],
+                    distances[2]
+                );
+
+                // How far the graphs that weigh the position may be, a graph
+                // beyond that can only change it by coming nearer
+                each(distances, function (dist) {
+                    if (dist !== Number.MAX_VALUE) {
+                        grid.reach = Math.max(grid.reach, Math.sqrt(dist));
+                    }
+                });
+
+                // The connector goes to the nearest point of the own graph,
+                // the first one of equally near points
+                if (
+                    !onArea &&
+                    connectorEnabled &&
+                    ownPoints > 0 &&
+                    (
+                        (checkDistance && !withinRange) ||
+                        distances[0] < Math.pow(
+                            labelOptions.connectorNeighbourDistance,
+                            2
+                        )
+                    )
+                ) {
+                    grid.eachNearPoint(
+                        grid.seriesPointCells[own],
+                        x,
+                        y,
+                        x + bBox.width,
+                        y + bBox.height,
+                        function (item) {
+                            var dist = connectorDistance(
+                                x,
+                                y,
+                                bBox,
+                                item.x,
+                                item.y
+                            );
+                            if (
+                                dist < distToPointSquared ||
+                                (
+                                    dist === distToPointSquared &&
+                                    connectorPoint &&
+                                    item.index < connectorIndex
+                                )
+                            ) {
+                                distToPointSquared = dist;
+                                connectorPoint = item.point;
+                                connectorIndex = item.index;
+                            }
+                        },
+                        function (bound) {
+                            return bound > distToPointSquared;
+                        }
+                    );
+                    withinRange = true;
+                }
+
+                return !checkDistance || withinRange ? {
+                    x: x,
+                    y: y,
+                    weight: distToOthersSquared -
+                        (connectorPoint ? distToPointSquared : 0),
+                    connectorPoint: connectorPoint
+                } : false;
+            },
+
+            /**
+             * A hash of what the placement of a series label depends on: its
+             * graph, the label size, the pane, and the boxes to avoid and
+             * graphs of other series within reach of its graph. The reach is
+             * the farthest a position tested in the last placement was
+             * weighed against, so a graph beyond it can only matter by
+             * coming within reach.
+             */
+            placementKey: function (series, bBox, pane, reach) {
+                var grid = this,
+                    chart = series.chart,
+                    labelOptions = series.options.label,
+                    points = series.interpolatedPoints,
+                    own = inArray(series, chart.series),
+                    spans = [],
+                    left = Infinity,
+                    top = Infinity,
+                    right = -Infinity,
+                    bottom = -Infinity,
+                    stamp = ++grid.stamp,
+                    near = 0,
+                    hash = 2166136261,
+                    column,
+                    row;
+
+                hash = hashNumbers(hash, [
+                    bBox.width,
+                    bBox.height,
+                    pane.left,
+                    pane.top,
+                    pane.width,
+                    pane.height,
+                    chart.inverted ? 1 : 0,
+                    pick(labelOptions.onArea, !!series.area) ? 1 : 0,
+                    labelOptions.connectorAllowed ? 1 : 0,
+                    labelOptions.connectorNeighbourDistance,
+                    own,
+                    points.length
+                ]);
+                // Which series have graphs, a graph appearing anywhere
+                // counts when there was none before or after the own
+                each(grid.counts, function (count) {
+                    hash = hashNumbers(hash, [count ? 1 : 0]);
+                });
+
+                // Candidates and the segments crossing them are within a
+                // label of the graph. The cells within reach are kept as a
+                // span of rows for each column.
+                reach += bBox.width + bBox.height + labelDistance + 16;
+                each(points, function (point) {
+                    var row0 = grid.row(point.chartY - reach),
+                        row1 = grid.row(point.chartY + reach),
+                        span;
+                    hash = hashNumbers(hash, [
+                        point.chartX,
+                        point.chartY,
+                        pick(point.chartCenterY, 0)
+                    ]);
+                    left = Math.min(left, point.chartX - reach);
+                    top = Math.min(top, point.chartY - reach);
+                    right = Math.max(right, point.chartX + reach);
+                    bottom = Math.max(bottom, point.chartY + reach);
+                    for (
+                        column = grid.column(point.chartX - reach);
+                        column <= grid.column(point.chartX + reach);
+                        column++
+                    ) {
+                        span = spans[column];
+                        if (span) {
+                            span[0] = Math.min(span[0], row0);
+                            span[1] = Math.max(span[1], row1);
+                        } else {
+                            spans[column] = [row0, row1];
+                        }
+                    }
+                });
+
+                // Other graphs passing near the label's own graph, and the
+                // boxes to avoid there. Their hashes are summed, so the
+                // order they are found in does not count.
+                each(spans, function (span, column) {
+                    var cell,
+                        j;
+                    for (row = span ? span[0] : 0; span && row <= span[1]; row++) {
+                        cell = grid.segmentCells[row * grid.columns + column];
+                        for (j = 0; cell && j < cell.length; j++) {
+                            if (
+                                cell[j].series !== own &&
+                                cell[j].stamp !== stamp
+                            ) {
+                                cell[j].stamp = stamp;
+                                near = (near + hashNumbers(2166136261, [
+                                    cell[j].series,
+                                    cell[j].x1,
+                                    cell[j].y1,
+                                    cell[j].x2,
+                                    cell[j].y2
+                                ])) | 0;
+                            }
+                        }
+                    }
+                });
+                each(chart.boxesToAvoid, function (box) {
+                    if (!(
+                        box.left > right ||
+                        box.right < left ||
+                        box.top > bottom ||
+                        box.bottom < top
+                    )) {
+                        near = (near + hashNumbers(2166136261, [
+                            box.left,
+                            box.right,
+                            box.top,
+                            box.bottom
+                        ])) | 0;
+                    }
+                });
+                hash = hashNumbers(hash, [near]);
+                return hash;
+            }
+        };
+
+        /**
+         * General symbol definition for labels with connector
+         */
+        SVGRenderer.prototype.symbols.connector = function (x, y, w, h, options) {
+            var anchorX = options && options.anchorX,
+                anchorY = options && options.anchorY,
+                path,
+                yOffset,
+                lateral = w / 2;
+
+            if (isNumber(anchorX) && isNumber(anchorY)) {
+
+                path = ['M', anchorX, anchorY];
+
+                // Prefer 45 deg connectors
+                yOffset = y - anchorY;
+                if (yOffset < 0) {
+                    yOffset = -h - yOffset;
+                }
+                if (yOffset < w) {
+                    lateral = anchorX < x + (w / 2) ? yOffset : w - yOffset;
+                }
+
+                // Anchor below label
+                if (anchorY > y + h) {
+                    path.push('L', x + lateral, y + h);
+
+                // Anchor above label
+                } else if (anchorY < y) {
+                    path.push('L', x + lateral, y);
+
+                // Anchor left of label
+                } else if (anchorX < x) {
+                    path.push('L', x, y + h / 2);
+
+                // Anchor right of label
+                } else if (anchorX > x + w) {
+                    path.push('L', x + w, y + h / 2);
+                }
+            }
+            return path || [];
+        };
+
+        /**
+         * Points to avoid. In addition to actual data points, the label
+         * should avoid interpolated positions.
+         */
+        Series.prototype.getPointsOnGraph = function () {
+
+            if (!this.xAxis && !this.yAxis) {
+                return;
+            }
+
+            var distance = 16,
+                points = this.points,
+                point,
+                last,
+                interpolated = [],
+                i,
+                deltaX,
+                deltaY,
+                delta,
+                len,
+                n,
+                j,
+                d,
+                graph = this.graph || this.area,
+                node = graph.element,
+                inverted = this.chart.inverted,
+                xAxis = this.xAxis,
+                yAxis = this.yAxis,
+                paneLeft = inverted ? yAxis.pos : xAxis.pos,
+                paneTop = inverted ? xAxis.pos : yAxis.pos,
+                onArea = pick(this.options.label.onArea, !!this.area),
+                translatedThreshold = yAxis.getThreshold(this.options.threshold);
+
+            // For splines, get the point at length (possible caveat: peaks
+            // are not correctly detected)
+            if (this.getPointSpline && node.getPointAtLength && !onArea) {
+                // If it is animating towards a path definition, use that
+                // briefly, and reset
+                if (graph.toD) {
+                    d = graph.attr('d');
+                    graph.attr({ d: graph.toD });
+                }
+                len = node.getTotalLength();
+                for (i = 0; i < len; i += distance) {
+                    point = node.getPointAtLength(i);
+                    interpolated.push({
+                        chartX: paneLeft + point.x,
+                        chartY: paneTop + point.y,
+                        plotX: point.x,
+                        plotY: point.y
+                    });
+                }
+                if (d) {
+                    graph.attr({ d: d });
+                }
+                // Last point
+                point = points[points.length - 1];
+                point.chartX = paneLeft + point.plotX;
+                point.chartY = paneTop + point.plotY;
+                interpolated.push(point);
+
+            // Interpolate
+            } else {
+                len = points.length;
+                for (i = 0; i < len; i += 1) {
+
+                    point = points[i];
+                    last = points[i - 1];
+
+                    // Absolute coordinates so we can compare different panes
+                    point.chartX = paneLeft + point.plotX;
+                    point.chartY = paneTop + point.plotY;
+                    if (onArea) {
+                        // Vertically centered inside area
+                        point.chartCenterY = paneTop + (
+                            point.plotY +
+                            pick(point.yBottom, translatedThreshold)
+                        ) / 2;
+                    }
+
+                    // Add interpolated points
+                    if (i > 0) {
+                        deltaX = Math.abs(point.chartX - last.chartX);
+                        deltaY = Math.abs(point.chartY - last.chartY);
+                        delta = Math.max(deltaX, deltaY);
+                        if (delta > distance) {
+
+                            n = Math.ceil(delta / distance);
+
+                            for (j = 1; j < n; j += 1) {
+                                interpolated.push({
+                                    chartX: last.chartX +
+                                        j / n * (point.chartX - last.chartX),
+                                    chartY: last.chartY +
+                                        j / n * (point.chartY - last.chartY),
+                                    chartCenterY: last.chartCenterY +
+                                        j / n * (point.chartCenterY - last.chartCenterY),
+                                    plotX: last.plotX +
+                                        j / n * (point.plotX - last.plotX),
+                                    plotY: last.plotY +
+                                        j / n * (point.plotY - last.plotY)
+                                });
+                            }
+                        }
+                    }
+
+                    // Add the real point in order to find positive and
+                    // negative peaks
+                    if (isNumber(point.plotY)) {
+                        interpolated.push(point);
+                    }
+                }
+            }
+            return interpolated;
+        };
+
+        /**
+         * Overridable function to return series-specific font sizes for the
+         * labels. By default it returns bigger font sizes for series with the
+         * greater sum of y values.
+         */
+        Series.prototype.labelFontSize = function (minFontSize, maxFontSize) {
+            return minFontSize + (
+                this.sum / this.chart.labelSeriesMaxSum *
+                (maxFontSize - minFontSize)
+            ) + 'px';
+        };
+
+        /**
+         * Check whether a proposed label position is clear of other elements.
+         * During a placement pass the grid answers, otherwise every point of
+         * every series is walked.
+         */
+        Series.prototype.checkClearPoint = function (x, y, bBox, checkDistance) {
+            var grid = this.chart.seriesLabelGrid,
+                result = grid && grid.checkClearPoint(
+                    this,
+                    x,
+                    y,
+                    bBox,
+                    checkDistance
+                );
+            return result === undefined ?
+                this.checkClearPointOnGraphs(x, y, bBox, checkDistance) :
+                result;
+        };
+
+        /**
+         * Check whether a proposed label position is clear of other elements,
+         * walking every point of every series.
+         */
+        Series.prototype.checkClearPointOnGraphs = function (x, y, bBox, checkDistance) {
+            var distToOthersSquared = Number.MAX_VALUE, // distance to other graphs
+                distToPointSquared = Number.MAX_VALUE,
+                dist,
+                connectorPoint,
+                connectorEnabled = this.options.label.connectorAllowed,
+                onArea = pick(this.options.label.onArea, !!this.area),
+                chart = this.chart,
+                series,
+                points,
+                leastDistance = 16,
+                withinRange,
+                xDist,
+                yDist,
+                i,
+                j;
+
+            function intersectRect(r1, r2) {
+                return !(r2.left > r1.right ||
+                    r2.right < r1.left ||
+                    r2.top > r1.bottom ||
+                    r2.bottom < r1.top);
+            }
+
+            // Avoid rectangles
+            for (i = 0; i < chart.boxesToAvoid.length; i += 1) {
+                if (intersectRect(chart.boxesToAvoid[i], {
+                    left: x,
+                    right: x + bBox.width,
+                    top: y,
+                    bottom: y + bBox.height
+                })) {
+                    return false;
+                }
+            }
+
+            // For each series
+            for (i = 0; i < chart.series.length; i += 1) {
+                series = chart.series[i];
+                points = series.interpolatedPoints;
+                if (series.visible && points) {
+                    for (j = 1; j < points.length; j += 1) {
+
+                        if (
+                            // To avoid processing, only check intersection
+                            // if the X values are close to the box.
+                            points[j].chartX >= x - leastDistance &&
+                            points[j - 1].chartX <= x + bBox.width + leastDistance
+                        ) {
+                            // If any of the box sides intersect with the line,
+                            // return.
+                            if (boxIntersectLine(
+                                x,
+                                y,
+                                bBox.width,
+                                bBox.height,
+                                points[j - 1].chartX,
+                                points[j - 1].chartY,
+                                points[j].chartX,
+                                points[j].chartY
+                            )) {
+                                return false;
+                            }
+
+                            // But if it is too far away (a padded box doesn't
+                            // intersect), also return.
+                            if (this === series && !withinRange && checkDistance) {
+                                withinRange = boxIntersectLine(
+                                    x - leastDistance,
+                                    y - leastDistance,
+                                    bBox.width + 2 * leastDistance,
+                                    bBox.height + 2 * leastDistance,
+                                    points[j - 1].chartX,
+                                    points[j - 1].chartY,
+                                    points[j].chartX,
+                                    points[j].chartY
+                                );
+                            }
+                        }
+
+                        // Find the squared distance from the center of the
+                        // label. On area series, avoid its own graph.
+                        if (
+                            (connectorEnabled || withinRange) &&
+                            (this !== series || onArea)
+                        ) {
+                            xDist = x + bBox.width / 2 - points[j].chartX;
+                            yDist = y + bBox.height / 2 - points[j].chartY;
+                            distToOthersSquared = Math.min(
+                                distToOthersSquared,
+                                xDist * xDist + yDist * yDist
+                            );
+                        }
+                    }
+
+                    // Do we need a connector?
+                    if (
+                        !onArea &&
+                        connectorEnabled &&
+                        this === series &&
+                        (
+                            (checkDistance && !withinRange) ||
+                            distToOthersSquared < Math.pow(
+                                this.options.label.connectorNeighbourDistance,
+                                2
+                            )
+                        )
+                    ) {
+                        for (j = 1; j < points.length; j += 1) {
+                            dist = connectorDistance(
+                                x,
+                                y,
+                                bBox,
+                                points[j].chartX,
+                                points[j].chartY
+                            );
+                            if (dist < distToPointSquared) {
+                                distToPointSquared = dist;
+                                connectorPoint = points[j];
+                            }
+                        }
+                        withinRange = true;
+                    }
+                }
+            }
+
+            return !checkDistance || withinRange ? {
+                x: x,
+                y: y,
+                weight: distToOthersSquared -
+                    (connectorPoint ? distToPointSquared : 0),
+                connectorPoint: connectorPoint
+            } : false;
+
+        };
+
+        /**
+         * The main initiator method that runs on chart level after initiation
+         * and redraw. It runs in a timeout to prevent locking, and loops over
+         * all series, taking all series and labels into account when placing
+         * the labels.
+         */
+        Chart.prototype.drawSeriesLabels = function () {
+            var chart = this,
+                labelSeries = this.labelSeries;
+
+            chart.boxesToAvoid = [];
+
+            // Build the interpolated points
+            each(labelSeries, function (series) {
+                series.interpolatedPoints = series.getPointsOnGraph();
+
+                each(series.options.label.boxesToAvoid || [], function (box) {
+                    chart.boxesToAvoid.push(box);
+                });
+            });
+
+            chart.seriesLabelGrid = new LabelGrid(chart);
+            if (!chart.seriesLabelGrid.valid) {
+                chart.seriesLabelGrid = undefined;
+            }
+
+            each(chart.series, function (series) {
+
+                if (!series.xAxis && !series.yAxis) {
+                    return;
+                }
+
+                var bBox,
+                    x,
+                    y,
+                    results = [],
+                    clearPoint,
+                    i,
+                    best,
+                    labelOptions = series.options.label,
+                    inverted = chart.inverted,
+                    paneLeft = inverted ? series.yAxis.pos : series.xAxis.pos,
+                    paneTop = inverted ? series.xAxis.pos : series.yAxis.pos,
+                    paneWidth = chart.inverted ? series.yAxis.len : series.xAxis.len,
+                    paneHeight = chart.inverted ? series.xAxis.len : series.yAxis.len,
+                    points = series.interpolatedPoints,
+                    onArea = pick(labelOptions.onArea, !!series.area),
+                    label = series.labelBySeries,
+                    minFontSize = labelOptions.minFontSize,
+                    maxFontSize = labelOptions.maxFontSize,
+                    placement = series.labelPlacement,
+                    grid = chart.seriesLabelGrid,
+                    pane = {
+                        left: paneLeft,
+                        top: paneTop,
+                        width: paneWidth,
+                        height: paneHeight
+                    },
+                    dist,
+                    attr,
+                    anim,
+                    closest;
+
+                function insidePane(x, y, bBox) {
+                    return x > paneLeft && x <= paneLeft + paneWidth - bBox.width &&
+                        y >= paneTop && y <= paneTop + paneHeight - bBox.height;
+                }
+
+                if (series.visible && !series.isSeriesBoosting && points) {
+                    if (!label) {
+                        series.labelBySeries = label = chart.renderer
+                            .label(series.name, 0, -9999, 'connector')
+                            .css(extend({
+                                color: onArea ?
+                                    chart.renderer.getContrast(series.color) :
+                                    series.color
+                            }, series.options.label.style));
+
+                        // Adapt label sizes to the sum of the data
+                        if (minFontSize && maxFontSize) {
+                            label.css({
+                                fontSize: series.labelFontSize(minFontSize, maxFontSize)
+                            });
+                        }
+
+                        label
+                            .attr({
+                                padding: 0,
+                                opacity: chart.renderer.forExport ? 1 : 0,
+                                stroke: series.color,
+                                'stroke-width': 1,
+                                zIndex: 3
+                            })
+                            .add(series.group)
+                            .animate({ opacity: 1 }, { duration: 200 });
+                    }
+
+                    bBox = label.getBBox();
+                    bBox.width = Math.round(bBox.width);
+
+                    // Keep the label where it is when nothing within reach
+                    // of its graph changed
+                    if (
+                        grid &&
+                        placement &&
+                        placement.label === label &&
+                        placement.key === grid.placementKey(
+                            series,
+                            bBox,
+                            pane,
+                            placement.reach
+                        )
+                    ) {
+                        chart.boxesToAvoid.push(placement.box);
+                        return;
+                    }
+                    series.labelPlacement = undefined;
+                    if (grid) {
+                        grid.reach = 0;
+                    }
+
+                    // Ideal positions are centered above or below a point on
+                    // right side of chart
+                    for (i = points.length - 1; i > 0; i -= 1) {
+
+                        if (onArea) {
+
+                            // Centered
+                            x = points[i].chartX - bBox.width / 2;
+                            y = points[i].chartCenterY - bBox.height / 2;
+                            if (insidePane(x, y, bBox)) {
+                                best = series.checkClearPoint(
+                                    x,
+                                    y,
+                                    bBox
+                                );
+                            }
+                            if (best) {
+                                results.push(best);
+                            }
+
+                        } else {
+
+                            // Right - up
+                            x = points[i].chartX + labelDistance;
+                            y = points[i].chartY - bBox.height - labelDistance;
+                            if (insidePane(x, y, bBox)) {
+                                best = series.checkClearPoint(
+                                    x,
+                                    y,
+                                    bBox
+                                );
+                            }
+                            if (best) {
+                                results.push(best);
+                            }
+
+                            // Right - down
+                            x = points[i].chartX + labelDistance;
+                            y = points[i].chartY + labelDistance;
+                            if (insidePane(x, y, bBox)) {
+                                best = series.checkClearPoint(
+                                    x,
+                                    y,
+                                    bBox
+                                );
+                            }
+                            if (best) {
+                                results.push(best);
+                            }
+
+                            // Left - down
+                            x = points[i].chartX - bBox.width - labelDistance;
+                            y = points[i].chartY + labelDistance;
+                            if (insidePane(x, y, bBox)) {
+                                best = series.checkClearPoint(
+                                    x,
+                                    y,
+                                    bBox
+                                );
+                            }
+                            if (best) {
+                                results.push(best);
+                            }
+
+                            // Left - up
+                            x = points[i].chartX - bBox.width - labelDistance;
+                            y = points[i].chartY - bBox.height - labelDistance;
+                            if (insidePane(x, y, bBox)) {
+                                best = series.checkClearPoint(
+                                    x,
+                                    y,
+                                    bBox
+                                );
+                            }
+                            if (best) {
+                                results.push(best);
+                            }
+                        }
+                    }
+
+                    // Brute force, try all positions on the chart in a 16x16
+                    // grid
+                    if (!results.length && !onArea) {
+                        if (grid) {
+                            grid.reach = Infinity;
+                        }
+                        for (
+                            x = paneLeft + paneWidth - bBox.width;
+                            x >= paneLeft;
+                            x -= 16
+                        ) {
+                            for (
+                                y = paneTop;
+                                y < paneTop + paneHeight - bBox.height;
+                                y += 16
+                            ) {
+                                clearPoint = series.checkClearPoint(x, y, bBox, true);
+                                if (clearPoint) {
+                                    results.push(clearPoint);
+                                }
+                            }
+                        }
+                    }
+
+                    if (results.length) {
+
+                        results.sort(function (a, b) {
+                            return b.weight - a.weight;
+                        });
+
+                        best = results[0];
+
+                        // What the placement depended on, before its own
+                        // box is avoided
+                        if (grid) {
+                            series.labelPlacement = {
+                                key: grid.placementKey(
+                                    series,
+                                    bBox,
+                                    pane,
+                                    grid.reach
+                                ),
+                                reach: grid.reach,
+                                label: label
+                            };
+                        }
+
+                        chart.boxesToAvoid.push({
+                            left: best.x,
+                            right: best.x + bBox.width,
+                            top: best.y,
+                            bottom: best.y + bBox.height
+                        });
+                        if (series.labelPlacement) {
+                            series.labelPlacement.box =
+                                chart.boxesToAvoid[chart.boxesToAvoid.length - 1];
+                        }
+
+                        // Move it if needed
+                        dist = Math.sqrt(
+                            Math.pow(Math.abs(best.x - label.x), 2),
+                            Math.pow(Math.abs(best.y - label.y), 2)
+                        );
+
+                        if (dist) {
+
+                            // Move fast and fade in - pure animation movement
+                            // is distractive...
+                            attr = {
+                                opacity: chart.renderer.forExport ? 1 : 0,
+                                x: best.x - paneLeft,
+                                y: best.y - paneTop
+                            };
+                            anim = {
+                                opacity: 1
+                            };
+                            // ... unless we're just moving a short distance
+                            if (dist <= 10) {
+                                anim = {
+                                    x: attr.x,
+                                    y: attr.y
+                                };
+                                attr = {};
+                            }
+                            series.labelBySeries
+                                .attr(extend(attr, {
+                                    anchorX: best.connectorPoint &&
+                                        best.connectorPoint.plotX,
+                                    anchorY: best.connectorPoint &&
+                                        best.connectorPoint.plotY
+                                }))
+                                .animate(anim);
+
+                            // Record closest point to stick to for sync redraw
+                            series.options.kdNow = true;
+                            series.buildKDTree();
+                            closest = series.searchPoint({
+                                chartX: best.x,
+                                chartY: best.y
+                            }, true);
+                            label.closest = [
+                                closest,
+                                best.x - paneLeft - closest.plotX,
+                                best.y - paneTop - closest.plotY
+                            ];
+
+                        }
+
+                    } else if (label) {
+                        series.labelBySeries = label.destroy();
+                    }
+                }
+            });
+
+            // Positions tested later walk the graphs as they are then
+            chart.seriesLabelGrid = undefined;
+        };
+
+        /**
+         * Prepare drawing series labels
+         */
+        function drawLabels(proceed) {
+
+            var chart = this,
+                delay = Math.max(
+                    H.animObject(chart.renderer.globalAnimation).duration,
+                    250
+                ),
+                initial = !chart.hasRendered;
+
+            proceed.apply(chart, [].slice.call(arguments, 1));
+
+            chart.labelSeries = [];
+            chart.labelSeriesMaxSum = 0;
+
+            clearTimeout(chart.seriesLabelTimer);
+
+            // Which series should have labels
+            each(chart.series, function (series) {
+                var options = series.options.label,
+                    label = series.labelBySeries,
+                    closest = label && label.closest;
+
+                if (
+                    options.enabled &&
+                    series.visible &&
+                    (series.graph || series.area) &&
+                    !series.isSeriesBoosting
+                ) {
+                    chart.labelSeries.push(series);
+
+                    if (options.minFontSize && options.maxFontSize) {
+                        series.sum = H.reduce(series.yData, function (pv, cv) {
+                            return (pv || 0) + (cv || 0);
+                        }, 0);
+                        chart.labelSeriesMaxSum = Math.max(
+                            chart.labelSeriesMaxSum,
+                            series.sum
+                        );
+                    }
+
+                    // The labels are processing heavy, wait until the
+                    // animation is done
+                    if (initial) {
+                        delay = Math.max(
+                            delay,
+                            H.animObject(series.options.animation).duration
+                        );
+                    }
+
+                    // Keep the position updated to the axis while redrawing
+                    if (closest) {
+                        if (closest[0].plotX !== undefined) {
+                            label.animate({
+                                x: closest[0].plotX + closest[1],
+                                y: closest[0].plotY + closest[2]
+                            });
+                        } else {
+                            label.attr({ opacity: 0 });
+                        }
+                    }
+                }
+            });
+
+            chart.seriesLabelTimer = H.syncTimeout(function () {
+                chart.drawSeriesLabels();
+            }, chart.renderer.forExport ? 0 : delay);
+
+        }
+        wrap(Chart.prototype, 'render', drawLabels);
+        wrap(Chart.prototype, 'redraw', drawLabels);
+    }(Highcharts));
+}));
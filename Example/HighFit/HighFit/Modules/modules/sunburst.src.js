@@ -0,0 +1,1926 @@
+/*
+ Highcharts JS v6.0.2 (2017-10-20)
+
+ (c) 2016 Highsoft AS
+ Authors: Jon Arild Nygard
+
+ License: www.highcharts.com/license
+*/
+/**
+ * (c) 2016 Highsoft AS
+ * Authors: Jon Arild Nygard
+ *
+ * License: www.highcharts.com/license
+ *
+ * Sunburst series. The points are linked into a tree by their parent ids and
+ * the levels below the root node are drawn as rings of arcs.
+ *
+ * The module includes the treemap series it extends, so the tree is built
+ * the same way: the lists of children by parent id are kept between renders
+ * until an id or a parent of the points changes, and only the nodes below the
+ * root node are laid out.
+ */
+(function (factory) {
+    if (typeof module === 'object' && module.exports) {
+        module.exports = factory;
+    } else {
+        factory(Highcharts);
+    }
+}(function (Highcharts) {
+    (function (H) {
+        var deg2rad = H.deg2rad,
+            isNumber = H.isNumber,
+            pick = H.pick,
+            relativeLength = H.relativeLength;
+        H.CenteredSeriesMixin = {
+            /**
+             * Get the center of the pie based on the size and center options
+             * relative to the plot area. Borrowed by the polar and gauge
+             * series types.
+             */
+            getCenter: function () {
+
+                var options = this.options,
+                    chart = this.chart,
+                    slicingRoom = 2 * (options.slicedOffset || 0),
+                    handleSlicingRoom,
+                    plotWidth = chart.plotWidth - 2 * slicingRoom,
+                    plotHeight = chart.plotHeight - 2 * slicingRoom,
+                    centerOption = options.center,
+                    positions = [
+                        pick(centerOption[0], '50%'),
+                        pick(centerOption[1], '50%'),
+                        options.size || '100%',
+                        options.innerSize || 0
+                    ],
+                    smallestSize = Math.min(plotWidth, plotHeight),
+                    i,
+                    value;
+
+                for (i = 0; i < 4; ++i) {
+                    value = positions[i];
+                    handleSlicingRoom = i < 2 || (i === 2 && /%$/.test(value));
+
+                    // i == 0: centerX, relative to width
+                    // i == 1: centerY, relative to height
+                    // i == 2: size, relative to smallestSize
+                    // i == 3: innerSize, relative to size
+                    positions[i] = relativeLength(
+                        value,
+                        [plotWidth, plotHeight, smallestSize, positions[2]][i]
+                    ) + (handleSlicingRoom ? slicingRoom : 0);
+
+                }
+                // innerSize cannot be larger than size (#3632)
+                if (positions[3] > positions[2]) {
+                    positions[3] = positions[2];
+                }
+                return positions;
+            },
+
+            /**
+             * The start and end angles of the series in radians, from the
+             * startAngle and endAngle options in degrees.
+             */
+            getStartAndEndRadians: function getStartAndEndRadians(start, end) {
+                var startAngle = isNumber(start) ? start : 0, // must be a number
+                    endAngle = (
+                        (
+                            isNumber(end) && // must be a number
+                            end > startAngle && // must be larger than the start angle
+                            // difference must be less than 360 degrees
+                            (end - startAngle) < 360
+                        ) ?
+                            end :
+                            startAngle + 360
+                    ),
+                    correction = -90;
+                return {
+                    start: deg2rad * (startAngle + correction),
+                    end: deg2rad * (endAngle + correction)
+                };
+            }
+        };
+    }(Highcharts));
+    var drawPoint = (function () {
+        var draw = function draw(params) {
+            var point = this,
+                graphic = point.graphic,
+                animate = params.animate,
+                attr = params.attr,
+                onComplete = params.onComplete,
+                css = params.css,
+                group = params.group,
+                renderer = params.renderer,
+                shape = params.shapeArgs,
+                type = params.shapeType;
+
+            if (point.shouldDraw()) {
+                if (!graphic) {
+                    point.graphic = graphic = renderer[type](shape).add(group);
+                }
+                graphic.css(css).attr(attr).animate(animate, undefined, onComplete);
+            } else if (graphic) {
+                graphic.animate(animate, undefined, function () {
+                    point.graphic = graphic = graphic.destroy();
+                    if (typeof onComplete === 'function') {
+                        onComplete();
+                    }
+                });
+            }
+        };
+        return draw;
+    }());
+    var mixinTreeSeries = (function (H) {
+        var each = H.each,
+            extend = H.extend,
+            isBoolean = function (x) {
+                return typeof x === 'boolean';
+            },
+            isFn = function (x) {
+                return typeof x === 'function';
+            },
+            pick = H.pick;
+
+        /**
+         * The color and color index of a node, from its point, its level, the
+         * colors of the series or a variation of the color of its parent.
+         */
+        var getColor = function getColor(node, options) {
+            var index = options.index,
+                levelMap = options.levelMap,
+                parentColor = options.parentColor,
+                parentColorIndex = options.parentColorIndex,
+                series = options.series,
+                colors = options.colors,
+                siblings = options.siblings,
+                points = series.points,
+                getColorByPoint,
+                point,
+                level,
+                colorByPoint,
+                color,
+                colorIndex;
+
+            /**
+             * The color of the parent, varied by the colorVariation of the
+             * level.
+             */
+            var variation = function (color) {
+                var colorVariation = level && level.colorVariation;
+                if (colorVariation && colorVariation.key === 'brightness') {
+                    return H.color(color).brighten(
+                        index / siblings * colorVariation.to
+                    ).get();
+                }
+                return color;
+            };
+
+            if (node) {
+                point = points[node.i];
+                level = levelMap[node.levelDynamic] || {};
+                getColorByPoint = point && (
+                    isBoolean(level.colorByPoint) ?
+                        level.colorByPoint :
+                        !!series.options.colorByPoint
+                );
+                if (getColorByPoint) {
+                    colorByPoint = colors[point.index % colors.length];
+                }
+                color = pick(
+                    point && point.options.color,
+                    level && level.color,
+                    colorByPoint,
+                    parentColor && variation(parentColor),
+                    series.color
+                );
+                colorIndex = pick(
+                    point && point.options.colorIndex,
+                    level && level.colorIndex,
+                    parentColorIndex,
+                    options.colorIndex
+                );
+            }
+            return {
+                color: color,
+                colorIndex: colorIndex
+            };
+        };
+
+        /**
+         * Sets the values of a node and its descendants: the level relative
+         * to the root, the name, the visibility and the total of the visible
+         * children. The before callback is called on each node before its
+         * children.
+         */
+        var setTreeValues = function setTreeValues(tree, options) {
+            var before = options.before,
+                idRoot = options.idRoot,
+                mapIdToNode = options.mapIdToNode,
+                nodeRoot = mapIdToNode[idRoot],
+                levelIsConstant = (
+                    isBoolean(options.levelIsConstant) ?
+                        options.levelIsConstant :
+                        true
+                ),
+                points = options.points,
+                point = points[tree.i],
+                optionsPoint = (point && point.options) || {},
+                childrenTotal = 0,
+                children = [],
+                value;
+
+            extend(tree, {
+                levelDynamic: tree.level - (levelIsConstant ? 0 : nodeRoot.level),
+                name: pick(point && point.name, ''),
+                visible: (
+                    idRoot === tree.id ||
+                    (isBoolean(options.visible) ? options.visible : false)
+                )
+            });
+            if (isFn(before)) {
+                tree = before(tree, options);
+            }
+            // First give the children some values
+            each(tree.children, function (child, i) {
+                var newOptions = extend({}, options);
+                extend(newOptions, {
+                    index: i,
+                    siblings: tree.children.length,
+                    visible: tree.visible
+                });
+                child = setTreeValues(child, newOptions);
+                children.push(child);
+                if (child.visible) {
+                    childrenTotal += child.val;
+                }
+            });
+            tree.visible = childrenTotal > 0 || tree.visible;
+            // Set the values
+            value = pick(optionsPoint.value, childrenTotal);
+            extend(tree, {
+                children: children,
+                childrenTotal: childrenTotal,
+                isLeaf: tree.visible && !childrenTotal,
+                val: value
+            });
+            return tree;
+        };
+
+        return {
+            getColor: getColor,
+            setTreeValues: setTreeValues
+        };
+    }(Highcharts));
+    (function (H, mixinTreeSeries) {
+        var seriesType = H.seriesType,
+            seriesTypes = H.seriesTypes,
+            map = H.map,
+            merge = H.merge,
+            extend = H.extend,
+            noop = H.noop,
+            each = H.each,
+            getColor = mixinTreeSeries.getColor,
+            grep = H.grep,
+            isNumber = H.isNumber,
+            isString = H.isString,
+            pick = H.pick,
+            Series = H.Series,
+            stableSort = H.stableSort,
+            Color = H.Color,
+            eachObject = function (list, func, context) {
+                context = context || this;
+                H.objectEach(list, function (val, key) {
+                    func.call(context, val, key, list);
+                });
+            },
+            reduce = H.reduce,
+            recursive = function (item, func, context) {
+                var next;
+                context = context || this;
+                next = func.call(context, item);
+                if (next !== false) {
+                    recursive(next, func, context);
+                }
+            },
+            layoutAlgorithms;
+
+        /**
+         * Whether two inputs of a layout are the same, telling 0 from -0 and
+         * taking NaN as the same as itself.
+         */
+        function isSameInput(a, b) {
+            if (a === b) {
+                return a !== 0 || 1 / a === 1 / b;
+            }
+            return a !== a && b !== b;
+        }
+
+        /**
+         * Default options for the treemap series.
+         */
+        seriesType('treemap', 'scatter', {
+            showInLegend: false,
+            marker: false,
+            dataLabels: {
+                enabled: true,
+                defer: false,
+                verticalAlign: 'middle',
+                formatter: function () { // #2945
+                    return this.point.name || this.point.id;
+                },
+                inside: true
+            },
+            tooltip: {
+                headerFormat: '',
+                pointFormat: '<b>{point.name}</b>: {point.value}<br/>'
+            },
+            ignoreHiddenPoint: true,
+            layoutAlgorithm: 'sliceAndDice',
+            layoutStartingDirection: 'vertical',
+            alternateStartingDirection: false,
+            levelIsConstant: true,
+            drillUpButton: {
+                position: {
+                    align: 'right',
+                    x: -10,
+                    y: 10
+                }
+            },
+            borderColor: '#e6e6e6',
+            borderWidth: 1,
+            opacity: 0.15,
+            states: {
+                hover: {
+                    borderColor: '#999999',
+                    brightness: seriesTypes.heatmap ? 0 : 0.1,
+                    halo: false,
+                    opacity: 0.75,
+                    shadow: false
+                }
+            }
+
+        // Prototype members
+        }, {
+            pointArrayMap: ['value'],
+            axisTypes: seriesTypes.heatmap ?
+                ['xAxis', 'yAxis', 'colorAxis'] :
+                ['xAxis', 'yAxis'],
+            directTouch: true,
+            optionalAxis: 'colorAxis',
+            getSymbol: noop,
+            parallelArrays: ['x', 'y', 'value', 'colorValue'],
+            colorKey: 'colorValue', // Point color option key
+            translateColors: (
+                seriesTypes.heatmap &&
+                seriesTypes.heatmap.prototype.translateColors
+            ),
+            colorAttribs: (
+                seriesTypes.heatmap &&
+                seriesTypes.heatmap.prototype.colorAttribs
+            ),
+            trackerGroups: ['group', 'dataLabelsGroup'],
+
+            /**
+             * Creates an object map from parent id to childrens index.
+             * Children of parents that are not among the ids are moved to
+             * the top of the tree. The ids are looked up in a map instead of
+             * the list, where only the ids that are strings can be found.
+             */
+            getListOfParents: function (data, ids) {
+                var listOfParents = reduce(data || [], function (prev, curr, i) {
+                        var parent = pick(curr.parent, '');
+                        if (prev[parent] === undefined) {
+                            prev[parent] = [];
+                        }
+                        prev[parent].push(i);
+                        return prev;
+                    }, {}),
+                    isId = {};
+
+                each(ids, function (id) {
+                    if (isString(id)) {
+                        isId['#' + id] = true;
+                    }
+                });
+
+                // If parent does not exist, hoist parent to root of tree.
+                eachObject(listOfParents, function (children, parent, list) {
+                    if (parent !== '' && !isId['#' + parent]) {
+                        each(children, function (child) {
+                            list[''].push(child);
+                        });
+                        delete list[parent];
+                    }
+                });
+                return listOfParents;
+            },
+
+            /**
+             * Creates a tree structured object from the series points. The
+             * lists of children by parent id are kept until an id or a parent
+             * of the points changes.
+             */
+            getTree: function () {
+                var series = this,
+                    data = series.data,
+                    index = series.treeIndex,
+                    valid = index && index.ids.length === data.length,
+                    ids,
+                    i;
+
+                for (i = 0; valid && i < data.length; i++) {
+                    valid = (
+                        data[i].id === index.ids[i] &&
+                        data[i].parent === index.parents[i]
+                    );
+                }
+                if (!valid) {
+                    ids = map(data, function (d) {
+                        return d.id;
+                    });
+                    index = series.treeIndex = {
+                        ids: ids,
+                        parents: map(data, function (d) {
+                            return d.parent;
+                        }),
+                        listOfParents: series.getListOfParents(data, ids)
+                    };
+                    series.childrenAreas = {};
+                }
+
+                series.nodeMap = [];
+                return series.buildNode('', -1, 0, index.listOfParents, null);
+            },
+            init: function (chart, options) {
+                var series = this;
+                Series.prototype.init.call(series, chart, options);
+                if (series.options.allowDrillToNode) {
+                    H.addEvent(series, 'click', series.onClickDrillToNode);
+                }
+            },
+            buildNode: function (id, i, level, list, parent) {
+                var series = this,
+                    children = [],
+                    point = series.points[i],
+                    height = 0,
+                    node,
+                    child;
+
+                // Actions
+                each((list[id] || []), function (i) {
+                    child = series.buildNode(
+                        series.points[i].id,
+                        i,
+                        (level + 1),
+                        list,
+                        id
+                    );
+                    height = Math.max(child.height + 1, height);
+                    children.push(child);
+                });
+                node = {
+                    id: id,
+                    i: i,
+                    children: children,
+                    height: height,
+                    level: level,
+                    parent: parent,
+                    visible: false // @todo move this to better location
+                };
+                series.nodeMap[node.id] = node;
+                if (point) {
+                    point.node = node;
+                }
+                return node;
+            },
+            setTreeValues: function (tree) {
+                var series = this,
+                    options = series.options,
+                    idRoot = series.rootNode,
+                    mapIdToNode = series.nodeMap,
+                    nodeRoot = mapIdToNode[idRoot],
+                    levelIsConstant = (
+                        typeof options.levelIsConstant === 'boolean' ?
+                            options.levelIsConstant :
+                            true
+                    ),
+                    childrenTotal = 0,
+                    children = [],
+                    val,
+                    point = series.points[tree.i];
+
+                // First give the children some values
+                each(tree.children, function (child) {
+                    child = series.setTreeValues(child);
+                    children.push(child);
+                    if (!child.ignore) {
+                        childrenTotal += child.val;
+                    }
+                });
+                // Sort the children
+                stableSort(children, function (a, b) {
+                    return a.sortIndex - b.sortIndex;
+                });
+                // Set the values
+                val = pick(point && point.options.value, childrenTotal);
+                if (point) {
+                    point.value = val;
+                }
+                extend(tree, {
+                    children: children,
+                    childrenTotal: childrenTotal,
+                    // Ignore this node if point is not visible
+                    ignore: !(pick(point && point.visible, true) && (val > 0)),
+                    isLeaf: tree.visible && !childrenTotal,
+                    levelDynamic: (
+                        tree.level - (levelIsConstant ? 0 : nodeRoot.level)
+                    ),
+                    name: pick(point && point.name, ''),
+                    sortIndex: pick(point && point.sortIndex, -val),
+                    val: val
+                });
+                return tree;
+            },
+
+            /**
+             * Recursive function which calculates the area for all children
+             * of a node that are drawn.
+             *
+             * The areas of the children only depend on the area of the node,
+             * their values and the layout options, so they are kept with
+             * those inputs and used again while they are the same. Areas from
+             * custom layout algorithms, which may depend on anything, are
+             * always computed. Nodes that are not visible are given an area,
+             * but their children are not laid out.
+             *
+             * @param {Object} node The node which is parent to the children.
+             * @param {Object} area The rectangular area of the parent.
+             */
+            calculateChildrenAreas: function (parent, area) {
+                var series = this,
+                    options = series.options,
+                    level = this.levelMap[parent.levelDynamic + 1],
+                    algorithm = pick(
+                        (
+                            series[level && level.layoutAlgorithm] &&
+                            level.layoutAlgorithm
+                        ),
+                        options.layoutAlgorithm
+                    ),
+                    alternate = options.alternateStartingDirection,
+                    childrenAreas = series.childrenAreas ||
+                        (series.childrenAreas = {}),
+                    cached = childrenAreas[parent.i],
+                    childrenValues = [],
+                    children,
+                    inputs,
+                    i;
+
+                // Collect all children which should be included
+                children = grep(parent.children, function (n) {
+                    return !n.ignore;
+                });
+
+                if (level && level.layoutStartingDirection) {
+                    area.direction = (
+                        level.layoutStartingDirection === 'vertical' ? 0 : 1
+                    );
+                }
+
+                inputs = [
+                    algorithm,
+                    alternate,
+                    series.axisRatio,
+                    area.x,
+                    area.y,
+                    area.width,
+                    area.height,
+                    area.direction,
+                    area.val
+                ];
+                each(children, function (child) {
+                    inputs.push(child.i, child.val, child.childrenTotal);
+                });
+                if (cached && cached.inputs.length !== inputs.length) {
+                    cached = false;
+                }
+                for (i = 0; cached && i < inputs.length; i++) {
+                    if (!isSameInput(cached.inputs[i], inputs[i])) {
+                        cached = false;
+                    }
+                }
+                if (!cached) {
+                    cached = {
+                        inputs: inputs,
+                        values: [],
+                        pointValues: []
+                    };
+                    childrenValues = series[algorithm](area, children);
+                    each(children, function (child, index) {
+                        var values = childrenValues[index];
+                        cached.values.push(merge(values, {
+                            val: child.childrenTotal,
+                            direction: (
+                                alternate ? 1 - area.direction : area.direction
+                            )
+                        }));
+                        cached.pointValues.push(merge(values, {
+                            x: (values.x / series.axisRatio),
+                            width: (values.width / series.axisRatio)
+                        }));
+                    });
+                    if (series[algorithm] === layoutAlgorithms[algorithm]) {
+                        childrenAreas[parent.i] = cached;
+                    }
+                }
+
+                each(children, function (child, index) {
+                    // The kept areas are copied, as the direction of the
+                    // values is set by the level of their children
+                    child.values = extend({}, cached.values[index]);
+                    child.pointValues = extend({}, cached.pointValues[index]);
+                    // If node has children, then call method recursively
+                    if (child.children.length && child.visible) {
+                        series.calculateChildrenAreas(child, child.values);
+                    }
+                });
+            },
+
+            /**
+             * Sets the shapes of the points that are drawn. The stroke width
+             * is only read for those, as it is found from the class name of
+             * the point.
+             */
+            setPointValues: function () {
+                var series = this,
+                    xAxis = series.xAxis,
+                    yAxis = series.yAxis;
+                each(series.points, function (point) {
+                    var node = point.node,
+                        values = node.pointValues,
+                        x1,
+                        x2,
+                        y1,
+                        y2,
+                        crispCorr;
+
+                    // Points which is ignored, have no values.
+                    if (values && node.visible) {
+                        crispCorr = (
+                            (series.pointAttribs(point)['stroke-width'] || 0) %
+                            2
+                        ) / 2;
+                        x1 = Math.round(
+                            xAxis.translate(values.x, 0, 0, 0, 1)
+                        ) - crispCorr;
+                        x2 = Math.round(
+                            xAxis.translate(values.x + values.width, 0, 0, 0, 1)
+                        ) - crispCorr;
+                        y1 = Math.round(
+                            yAxis.translate(values.y, 0, 0, 0, 1)
+                        ) - crispCorr;
+                        y2 = Math.round(
+                            yAxis.translate(values.y + values.height, 0, 0, 0, 1)
+                        ) - crispCorr;
+                        // Set point values
+                        point.shapeType = 'rect';
+                        point.shapeArgs = {
+                            x: Math.min(x1, x2),
+                            y: Math.min(y1, y2),
+                            width: Math.abs(x2 - x1),
+                            height: Math.abs(y2 - y1)
+                        };
+                        point.plotX = (
+                            point.shapeArgs.x + (point.shapeArgs.width / 2)
+                        );
+                        point.plotY = (
+                            point.shapeArgs.y + (point.shapeArgs.height / 2)
+                        );
+                    } else {
+                        // Reset visibility
+                        delete point.plotX;
+                        delete point.plotY;
+                    }
+                });
+            },
+            setColorRecursive: function (
+                node,
+                parentColor,
+                colorIndex,
+                index,
+                siblings
+            ) {
+                var series = this,
+                    chart = series && series.chart,
+                    colors = chart && chart.options && chart.options.colors,
+                    colorInfo,
+                    point;
+
+                if (node) {
+                    colorInfo = getColor(node, {
+                        colors: colors,
+                        index: index,
+                        levelMap: series.levelMap,
+                        parentColor: parentColor,
+                        parentColorIndex: colorIndex,
+                        series: series,
+                        siblings: siblings
+                    });
+
+                    point = series.points[node.i];
+                    if (point) {
+                        point.color = colorInfo.color;
+                        point.colorIndex = colorInfo.colorIndex;
+                    }
+
+                    // Do it all again with the children
+                    each(node.children || [], function (child, i) {
+                        series.setColorRecursive(
+                            child,
+                            colorInfo.color,
+                            colorInfo.colorIndex,
+                            i,
+                            node.children.length
+                        );
+                    });
+                }
+            },
+            algorithmGroup: function (h, w, d, p) {
+                this.height = h;
+                this.width = w;
+                this.plot = p;
+                this.direction = d;
+                this.startDirection = d;
+                this.total = 0;
+                this.nW = 0;
+                this.lW = 0;
+                this.nH = 0;
+                this.lH = 0;
+                this.elArr = [];
+                this.lP = {
+                    total: 0,
+                    lH: 0,
+                    nH: 0,
+                    lW: 0,
+                    nW: 0,
+                    nR: 0,
+                    lR: 0,
+                    aspectRatio: function (w, h) {
+                        return Math.max((w / h), (h / w));
+                    }
+                };
+                this.addElement = function (el) {
+                    this.lP.total = this.elArr[this.elArr.length - 1];
+                    this.total = this.total + el;
+                    if (this.direction === 0) {
+                        // Calculate last point old aspect ratio
+                        this.lW = this.nW;
+                        this.lP.lH = this.lP.total / this.lW;
+                        this.lP.lR = this.lP.aspectRatio(this.lW, this.lP.lH);
+                        // Calculate last point new aspect ratio
+                        this.nW = this.total / this.height;
+                        this.lP.nH = this.lP.total / this.nW;
+                        this.lP.nR = this.lP.aspectRatio(this.nW, this.lP.nH);
+                    } else {
+                        // Calculate last point old aspect ratio
+                        this.lH = this.nH;
+                        this.lP.lW = this.lP.total / this.lH;
+                        this.lP.lR = this.lP.aspectRatio(this.lP.lW, this.lH);
+                        // Calculate last point new aspect ratio
+                        this.nH = this.total / this.width;
+                        this.lP.nW = this.lP.total / this.nH;
+                        this.lP.nR = this.lP.aspectRatio(this.lP.nW, this.nH);
+                    }
+                    this.elArr.push(el);
+                };
+                this.reset = function () {
+                    this.nW = 0;
+                    this.lW = 0;
+                    this.elArr = [];
+                    this.total = 0;
+                };
+            },
+            algorithmCalcPoints: function (
+                directionChange,
+                last,
+                group,
+                childrenArea
+            ) {
+                var pX,
+                    pY,
+                    pW,
+                    pH,
+                    gW = group.lW,
+                    gH = group.lH,
+                    plot = group.plot,
+                    keep,
+                    i = 0,
+                    end = group.elArr.length - 1;
+
+                if (last) {
+                    gW = group.nW;
+                    gH = group.nH;
+                } else {
+                    keep = group.elArr[group.elArr.length - 1];
+                }
+                each(group.elArr, function (p) {
+                    if (last || (i < end)) {
+                        if (group.direction === 0) {
+                            pX = plot.x;
+                            pY = plot.y;
+                            pW = gW;
+                            pH = p / pW;
+                        } else {
+                            pX = plot.x;
+                            pY = plot.y;
+                            pH = gH;
+                            pW = p / pH;
+                        }
+                        childrenArea.push({
+                            x: pX,
+                            y: pY,
+                            width: pW,
+                            height: pH
+                        });
+                        if (group.direction === 0) {
+                            plot.y = plot.y + pH;
+                        } else {
+                            plot.x = plot.x + pW;
+                        }
+                    }
+                    i = i + 1;
+                });
+                // Reset variables
+                group.reset();
+                if (group.direction === 0) {
+                    group.width = group.width - gW;
+                } else {
+                    group.height = group.height - gH;
+                }
+                plot.y = plot.parent.y + (plot.parent.height - group.height);
+                plot.x = plot.parent.x + (plot.parent.width - group.width);
+                if (directionChange) {
+                    group.direction = 1 - group.direction;
+                }
+                // If not last, then add uncalculated element
+                if (!last) {
+                    group.addElement(keep);
+                }
+            },
+            algorithmLowAspectRatio: function (directionChange, parent, children) {
+                var childrenArea = [],
+                    series = this,
+                    pTot,
+                    plot = {
+                        x: parent.x,
+                        y: parent.y,
+                        parent: parent
+                    },
+                    direction = parent.direction,
+                    i = 0,
+                    end = children.length - 1,
+                    group = new this.algorithmGroup( // eslint-disable-line new-cap
+                        parent.height,
+                        parent.width,
+                        direction,
+                        plot
+                    );
+                // Loop through and calculate all areas
+                each(children, function (child) {
+                    pTot = child.val / parent.val * parent.height * parent.width;
+                    group.addElement(pTot);
+                    if (group.lP.nR > group.lP.lR) {
+                        series.algorithmCalcPoints(
+                            directionChange,
+                            false,
+                            group,
+                            childrenArea,
+                            plot
+                        );
+                    }
+                    // If last child, then calculate all remaining areas
+                    if (i === end) {
+                        series.algorithmCalcPoints(
+                            directionChange,
+                            true,
+                            group,
+                            childrenArea,
+                            plot
+                        );
+                    }
+                    i = i + 1;
+                });
+                return childrenArea;
+            },
+            algorithmFill: function (directionChange, parent, children) {
+                var childrenArea = [],
+                    pTot,
+                    direction = parent.direction,
+                    x = parent.x,
+                    y = parent.y,
+                    width = parent.width,
+                    height = parent.height,
+                    pX,
+                    pY,
+                    pW,
+                    pH;
+                each(children, function (child) {
+                    pTot = child.val / parent.val * parent.height * parent.width;
+                    pX = x;
+                    pY = y;
+                    if (direction === 0) {
+                        pH = height;
+                        pW = pTot / pH;
+                        width = width - pW;
+                        x = x + pW;
+                    } else {
+                        pW = width;
+                        pH = pTot / pW;
+                        height = height - pH;
+                        y = y + pH;
+                    }
+                    childrenArea.push({
+                        x: pX,
+                        y: pY,
+                        width: pW,
+                        height: pH
+                    });
+                    if (directionChange) {
+                        direction = 1 - direction;
+                    }
+                });
+                return childrenArea;
+            },
+            strip: function (parent, children) {
+                return this.algorithmLowAspectRatio(false, parent, children);
+            },
+            squarified: function (parent, children) {
+                return this.algorithmLowAspectRatio(true, parent, children);
+            },
+            sliceAndDice: function (parent, children) {
+                return this.algorithmFill(true, parent, children);
+            },
+            stripes: function (parent, children) {
+                return this.algorithmFill(false, parent, children);
+            },
+            translate: function () {
+                var series = this,
+                    rootId = series.rootNode = pick(
+                        series.rootNode,
+                        series.options.rootId,
+                        ''
+                    ),
+                    rootNode,
+                    pointValues,
+                    seriesArea,
+                    tree,
+                    val;
+
+                // Call prototype function
+                Series.prototype.translate.call(series);
+
+                // Create a object map from level to options
+                series.levelMap = reduce(series.options.levels || [],
+                    function (arr, item) {
+                        arr[item.level] = item;
+                        return arr;
+                    }, {});
+                tree = series.tree = series.getTree();
+
+                // Ensure that the rootNode is valid
+                rootNode = series.nodeMap[rootId];
+                if (
+                    rootId !== '' &&
+                    (!rootNode || !rootNode.children.length)
+                ) {
+                    series.drillToNode('', false);
+                    rootId = series.rootNode;
+                    rootNode = series.nodeMap[rootId];
+                }
+
+                // Parents of the root node is by default visible
+                recursive(series.nodeMap[series.rootNode], function (node) {
+                    var next = false,
+                        p = node.parent;
+                    node.visible = true;
+                    if (p || p === '') {
+                        next = series.nodeMap[p];
+                    }
+                    return next;
+                });
+
+                // Children of the root node is by default visible, level by
+                // level
+                recursive(series.nodeMap[series.rootNode].children,
+                    function (children) {
+                        var next = false;
+                        each(children, function (child) {
+                            var i;
+                            child.visible = true;
+                            if (child.children.length) {
+                                next = next || [];
+                                for (i = 0; i < child.children.length; i++) {
+                                    next.push(child.children[i]);
+                                }
+                            }
+                        });
+                        return next;
+                    });
+                series.setTreeValues(tree);
+
+                // Calculate plotting values.
+                series.axisRatio = (series.xAxis.len / series.yAxis.len);
+                series.nodeMap[''].pointValues = pointValues = {
+                    x: 0,
+                    y: 0,
+                    width: 100,
+                    height: 100
+                };
+                series.nodeMap[''].values = seriesArea = merge(pointValues, {
+                    width: (pointValues.width * series.axisRatio),
+                    direction: (
+                        series.options.layoutStartingDirection === 'vertical' ?
+                            0 :
+                            1
+                    ),
+                    val: tree.val
+                });
+                series.calculateChildrenAreas(tree, seriesArea);
+
+                // Logic for point colors
+                if (series.colorAxis) {
+                    series.translateColors();
+                } else if (!series.options.colorByPoint) {
+                    series.setColorRecursive(series.tree);
+                }
+
+                // Update axis extremes according to the root node.
+                if (series.options.allowDrillToNode) {
+                    val = rootNode.pointValues;
+                    series.xAxis.setExtremes(val.x, val.x + val.width, false);
+                    series.yAxis.setExtremes(val.y, val.y + val.height, false);
+                    series.xAxis.setScale();
+                    series.yAxis.setScale();
+                }
+
+                // Assign values to points.
+                series.setPointValues();
+            },
+
+            /**
+             * Extend drawDataLabels with logic to handle custom options
+             * related to the treemap series:
+             * - Points which is not a leaf node, has dataLabels disabled by
+             *   default.
+             * - Options set on series.levels is merged in.
+             * - Width of the dataLabel is set to match the width of the point
+             *   shape.
+             */
+            drawDataLabels: function () {
+                var series = this,
+                    points = grep(series.points, function (n) {
+                        return n.node.visible;
+                    }),
+                    options,
+                    level;
+                each(points, function (point) {
+                    level = series.levelMap[point.node.levelDynamic];
+                    // Set options to new object to avoid problems with scope
+                    options = { style: {} };
+
+                    // If not a leaf, then label should be disabled as default
+                    if (!point.node.isLeaf) {
+                        options.enabled = false;
+                    }
+
+                    // If options for level exists, include them as well
+                    if (level && level.dataLabels) {
+                        options = merge(options, level.dataLabels);
+                        series._hasPointLabels = true;
+                    }
+
+                    // Set dataLabel width to the width of the point shape.
+                    if (point.shapeArgs) {
+                        options.style.width = point.shapeArgs.width;
+                        if (point.dataLabel) {
+                            point.dataLabel.css({
+                                width: point.shapeArgs.width + 'px'
+                            });
+                        }
+                    }
+
+                    // Merge custom options with point options
+                    point.dlOptions = merge(options, point.options.dataLabels);
+                });
+                Series.prototype.drawDataLabels.call(this);
+            },
+
+            /**
+             * Over the alignment method by setting z index
+             */
+            alignDataLabel: function (point) {
+                seriesTypes.column.prototype.alignDataLabel.apply(
+                    this,
+                    arguments
+                );
+                if (point.dataLabel) {
+                    // point.node.zIndex could be undefined (#6956)
+                    point.dataLabel.attr({ zIndex: (point.node.zIndex || 0) + 1 });
+                }
+            },
+
+            /**
+             * Get presentational attributes
+             */
+            pointAttribs: function (point, state) {
+                var level = (point && this.levelMap[point.node.levelDynamic]) || {},
+                    options = this.options,
+                    attr,
+                    stateOptions = (state && options.states[state]) || {},
+                    className = (point && point.getClassName()) || '',
+                    opacity;
+
+                // Set attributes by precedence. Point trumps level trumps
+                // series. Stroke width uses pick because it can be 0.
+                attr = {
+                    'stroke':
+                        (point && point.borderColor) ||
+                        level.borderColor ||
+                        stateOptions.borderColor ||
+                        options.borderColor,
+                    'stroke-width': pick(
+                        point && point.borderWidth,
+                        level.borderWidth,
+                        stateOptions.borderWidth,
+                        options.borderWidth
+                    ),
+                    'dashstyle':
+                        (point && point.borderDashStyle) ||
+                        level.borderDashStyle ||
+                        stateOptions.borderDashStyle ||
+                        options.borderDashStyle,
+                    'fill': (point && point.color) || this.color
+                };
+
+                // Hide levels above the current view
+                if (className.indexOf('highcharts-above-level') !== -1) {
+                    attr.fill = 'none';
+                    attr['stroke-width'] = 0;
+
+                // Nodes with children that accept interaction
+                } else if (
+                    className.indexOf('highcharts-internal-node-interactive') !==
+                    -1
+                ) {
+                    opacity = pick(stateOptions.opacity, options.opacity);
+                    attr.fill = Color(attr.fill).setOpacity(opacity).get();
+                    attr.cursor = 'pointer';
+                // Hide nodes that have children
+                } else if (className.indexOf('highcharts-internal-node') !== -1) {
+                    attr.fill = 'none';
+
+                } else if (state) {
+                    // Brighten and hoist the hover nodes
+                    attr.fill = Color(attr.fill)
+                        .brighten(stateOptions.brightness)
+                        .get();
+                }
+                return attr;
+            },
+
+            /**
+             * Extending ColumnSeries drawPoints
+             */
+            drawPoints: function () {
+                var series = this,
+                    points = grep(series.points, function (n) {
+                        return n.node.visible;
+                    });
+
+                each(points, function (point) {
+                    var groupKey = 'level-group-' + point.node.levelDynamic;
+                    if (!series[groupKey]) {
+                        series[groupKey] = series.chart.renderer.g(groupKey)
+                            .attr({
+                                // @todo Set the zIndex based upon the number
+                                // of levels, instead of using 1000
+                                zIndex: 1000 - point.node.levelDynamic
+                            })
+                            .add(series.group);
+                    }
+                    point.group = series[groupKey];
+
+                });
+                // Call standard drawPoints
+                seriesTypes.column.prototype.drawPoints.call(this);
+
+                // If drillToNode is allowed, set a point cursor on clickables &
+                // add drillId to point
+                if (series.options.allowDrillToNode) {
+                    each(points, function (point) {
+                        if (point.graphic) {
+                            point.drillId = series.options.interactByLeaf ?
+                                series.drillToByLeaf(point) :
+                                series.drillToByGroup(point);
+                        }
+                    });
+                }
+            },
+
+            /**
+             * Add drilling on the suitable points
+             */
+            onClickDrillToNode: function (event) {
+                var series = this,
+                    point = event.point,
+                    drillId = point && point.drillId;
+                // If a drill id is returned, add click event and cursor.
+                if (isString(drillId)) {
+                    point.setState(''); // Remove hover
+                    series.drillToNode(drillId);
+                }
+            },
+
+            /**
+             * Finds the drill id for a parent node.
+             * Returns false if point should not have a click event
+             * @param {Object} point
+             * @return {String|Boolean} Drill to id or false when point should
+             * not have a click event
+             */
+            drillToByGroup: function (point) {
+                var series = this,
+                    drillId = false;
+                if (
+                    (point.node.level - series.nodeMap[series.rootNode].level) ===
+                    1 &&
+                    !point.node.isLeaf
+                ) {
+                    drillId = point.id;
+                }
+                return drillId;
+            },
+
+            /**
+             * Finds the drill id for a leaf node.
+             * Returns false if point should not have a click event
+             * @param {Object} point
+             * @return {String|Boolean} Drill to id or false when point should
+             * not have a click event
+             */
+            drillToByLeaf: function (point) {
+                var series = this,
+                    drillId = false,
+                    nodeParent;
+                if ((point.node.parent !== series.rootNode) && point.node.isLeaf) {
+                    nodeParent = point.node;
+                    while (!drillId) {
+                        nodeParent = series.nodeMap[nodeParent.parent];
+                        if (nodeParent.parent === series.rootNode) {
+                            drillId = nodeParent.id;
+                        }
+                    }
+                }
+                return drillId;
+            },
+            drillUp: function () {
+                var series = this,
+                    node = series.nodeMap[series.rootNode];
+                if (node && isString(node.parent)) {
+                    series.drillToNode(node.parent);
+                }
+            },
+            drillToNode: function (id, redraw) {
+                var series = this,
+                    nodeMap = series.nodeMap,
+                    node = nodeMap[id];
+                series.idPreviousRoot = series.rootNode;
+                series.rootNode = id;
+                if (id === '') {
+                    series.drillUpButton = series.drillUpButton.destroy();
+                } else {
+                    series.showDrillUpButton((node && node.name || id));
+                }
+                this.isDirty = true; // Force redraw
+                if (pick(redraw, true)) {
+                    this.chart.redraw();
+                }
+            },
+            showDrillUpButton: function (name) {
+                var series = this,
+                    backText = (name || '< Back'),
+                    buttonOptions = series.options.drillUpButton,
+                    attr,
+                    states;
+
+                if (buttonOptions.text) {
+                    backText = buttonOptions.text;
+                }
+                if (!this.drillUpButton) {
+                    attr = buttonOptions.theme;
+                    states = attr && attr.states;
+
+                    this.drillUpButton = this.chart.renderer.button(
+                        backText,
+                        null,
+                        null,
+                        function () {
+                            series.drillUp();
+                        },
+                        attr,
+                        states && states.hover,
+                        states && states.select
+                    )
+                    .attr({
+                        align: buttonOptions.position.align,
+                        zIndex: 7
+                    })
+                    .add()
+                    .align(
+                        buttonOptions.position,
+                        false,
+                        buttonOptions.relativeTo || 'plotBox'
+                    );
+                } else {
+                    this.drillUpButton.attr({
+                        text: backText
+                    })
+                    .align();
+                }
+            },
+            buildKDTree: noop,
+            drawLegendSymbol: H.LegendSymbolMixin.drawRectangle,
+            getExtremes: function () {
+                // Get the extremes from the value data
+                Series.prototype.getExtremes.call(this, this.colorValueData);
+                this.valueMin = this.dataMin;
+                this.valueMax = this.dataMax;
+
+                // Get the extremes from the y data
+                Series.prototype.getExtremes.call(this);
+            },
+            getExtremesFromAll: true,
+            bindAxes: function () {
+                var treeAxis = {
+                    endOnTick: false,
+                    gridLineWidth: 0,
+                    lineWidth: 0,
+                    min: 0,
+                    dataMin: 0,
+                    minPadding: 0,
+                    max: 100,
+                    dataMax: 100,
+                    maxPadding: 0,
+                    startOnTick: false,
+                    title: null,
+                    tickPositions: []
+                };
+                Series.prototype.bindAxes.call(this);
+                H.extend(this.yAxis.options, treeAxis);
+                H.extend(this.xAxis.options, treeAxis);
+            },
+            utils: {
+                recursive: recursive,
+                reduce: reduce
+            }
+
+        // Point class
+        }, {
+            getClassName: function () {
+                var className = H.Point.prototype.getClassName.call(this),
+                    series = this.series,
+                    options = series.options;
+
+                // Above the current level
+                if (this.node.level <= series.nodeMap[series.rootNode].level) {
+                    className += ' highcharts-above-level';
+
+                } else if (
+                    !this.node.isLeaf &&
+                    !pick(options.interactByLeaf, !options.allowDrillToNode)
+                ) {
+                    className += ' highcharts-internal-node-interactive';
+
+                } else if (!this.node.isLeaf) {
+                    className += ' highcharts-internal-node';
+                }
+                return className;
+            },
+            isValid: function () {
+                return this.id || isNumber(this.value);
+            },
+            setState: function (state) {
+                H.Point.prototype.setState.call(this, state);
+
+                // Graphic does not exist when point is not visible.
+                if (this.graphic) {
+                    this.graphic.attr({
+                        zIndex: state === 'hover' ? 1 : 0
+                    });
+                }
+            },
+            setVisible: seriesTypes.pie.prototype.pointClass.prototype.setVisible
+        });
+
+        /**
+         * The built in layout algorithms, whose areas only depend on their
+         * inputs.
+         */
+        layoutAlgorithms = {};
+        each(['sliceAndDice', 'stripes', 'squarified', 'strip'], function (name) {
+            layoutAlgorithms[name] = seriesTypes.treemap.prototype[name];
+        });
+    }(Highcharts, mixinTreeSeries));
+    (function (H, drawPoint, mixinTreeSeries) {
+        var CenteredSeriesMixin = H.CenteredSeriesMixin,
+            Series = H.Series,
+            each = H.each,
+            extend = H.extend,
+            getCenter = CenteredSeriesMixin.getCenter,
+            getColor = mixinTreeSeries.getColor,
+            getStartAndEndRadians = CenteredSeriesMixin.getStartAndEndRadians,
+            grep = H.grep,
+            isNumber = H.isNumber,
+            isObject = H.isObject,
+            isString = H.isString,
+            merge = H.merge,
+            pick = H.pick,
+            rad2deg = 180 / Math.PI,
+            seriesType = H.seriesType,
+            setTreeValues = mixinTreeSeries.setTreeValues,
+            reduce = H.reduce;
+
+        /**
+         * Splits the arc of the parent between its children by their values.
+         */
+        var layoutAlgorithm = function layoutAlgorithm(parent, children) {
+            var startAngle = parent.start,
+                range = parent.end - startAngle,
+                total = parent.val,
+                x = parent.x,
+                y = parent.y,
+                innerRadius = parent.r,
+                outerRadius = innerRadius + parent.radius;
+
+            return reduce(children || [], function (arr, child) {
+                var percentage = (1 / total) * child.val,
+                    radians = percentage * range,
+                    values = {
+                        x: x,
+                        y: y,
+                        innerR: innerRadius,
+                        r: outerRadius,
+                        radius: parent.radius,
+                        start: startAngle,
+                        end: startAngle + radians
+                    };
+                arr.push(values);
+                startAngle = values.end;
+                return arr;
+            }, []);
+        };
+
+        /**
+         * Sets the arcs of the visible descendants of a node.
+         */
+        var setShapeArgs = function setShapeArgs(parent, parentValues) {
+            var childrenValues = [],
+                // Collect all children which should be included
+                children = grep(parent.children, function (n) {
+                    return n.visible;
+                });
+            childrenValues = layoutAlgorithm(parentValues, children);
+            each(children, function (child, index) {
+                var values = childrenValues[index],
+                    angle = values.start + ((values.end - values.start) / 2),
+                    radius = values.innerR + ((values.r - values.innerR) / 2),
+                    isCircle = (
+                        values.innerR === 0 &&
+                        (values.end - values.start) > 6.28
+                    ),
+                    center = isCircle ? { x: values.x, y: values.y } : {
+                        x: values.x + Math.cos(angle) * radius,
+                        y: values.y + Math.sin(angle) * radius
+                    },
+                    val = (
+                        child.val ?
+                            (
+                                child.childrenTotal > child.val ?
+                                    child.childrenTotal :
+                                    child.val
+                            ) :
+                            child.childrenTotal
+                    );
+                child.shapeArgs = merge(values, {
+                    plotX: center.x,
+                    plotY: center.y
+                });
+                child.values = merge(values, {
+                    val: val
+                });
+                // If node has children, then call method recursively
+                if (child.children.length) {
+                    setShapeArgs(child, child.values);
+                }
+            });
+        };
+
+        /**
+         * Sets the color of a node and its point, before the values of its
+         * children are set.
+         */
+        var setColor = function setColor(node, options) {
+            var nodeParent = options.mapIdToNode[node.parent],
+                series = options.series,
+                chart = series.chart,
+                point = series.points[node.i],
+                colorInfo = getColor(node, {
+                    colors: chart && chart.options && chart.options.colors,
+                    colorIndex: series.colorIndex,
+                    colorByPoint: series.colorByPoint,
+                    index: options.index,
+                    levelMap: options.levelMap,
+                    parentColor: nodeParent && nodeParent.color,
+                    parentColorIndex: nodeParent && nodeParent.colorIndex,
+                    series: options.series,
+                    siblings: options.siblings
+                });
+            node.color = colorInfo.color;
+            node.colorIndex = colorInfo.colorIndex;
+            if (point) {
+                point.color = node.color;
+                point.colorIndex = node.colorIndex;
+            }
+            return node;
+        };
+
+        /**
+         * Default options for the Sunburst series.
+         */
+        var sunburstOptions = {
+            center: ['50%', '50%'],
+            dataLabels: {
+                defer: true,
+                style: {
+                    textOverflow: 'ellipsis'
+                },
+                rotationMode: 'perpendicular'
+            },
+            rootId: undefined,
+            levelIsConstant: true
+        };
+
+        /**
+         * Properties of the Sunburst series.
+         */
+        var sunburstSeries = {
+            drawDataLabels: H.noop, // drawDataLabels is called in drawPoints
+            drawPoints: function drawPoints() {
+                var series = this,
+                    levelMap = series.levelMap,
+                    shapeRoot = series.shapeRoot,
+                    group = series.group,
+                    hasRendered = series.hasRendered,
+                    idRoot = series.rootNode,
+                    idPreviousRoot = series.idPreviousRoot,
+                    nodeMap = series.nodeMap,
+                    nodePreviousRoot = nodeMap[idPreviousRoot],
+                    shapePreviousRoot = (
+                        nodePreviousRoot && nodePreviousRoot.shapeArgs
+                    ),
+                    points = series.points,
+                    radians = series.startAndEndRadians,
+                    chart = series.chart,
+                    optionsChart = (
+                        chart && chart.options && chart.options.chart
+                    ) || {},
+                    animation = (
+                        typeof optionsChart.animation === 'boolean' ?
+                            optionsChart.animation :
+                            true
+                    ),
+                    positions = series.center,
+                    centerX = positions[0],
+                    centerY = positions[1],
+                    innerR = positions[3] / 2,
+                    renderer = series.chart.renderer,
+                    animateLabels,
+                    animateLabelsCalled = false,
+                    addedHack = false,
+                    hackDataLabelAnimation = !!(
+                        animation &&
+                        hasRendered &&
+                        idRoot !== idPreviousRoot &&
+                        series.dataLabelsGroup
+                    );
+
+                if (hackDataLabelAnimation) {
+                    series.dataLabelsGroup.attr({ opacity: 0 });
+                    animateLabels = function () {
+                        var s = series;
+                        animateLabelsCalled = true;
+                        if (s.dataLabelsGroup) {
+                            s.dataLabelsGroup.animate({
+                                opacity: 1,
+                                visibility: 'visible'
+                            });
+                        }
+                    };
+                }
+                each(points, function (point) {
+                    var node = point.node,
+                        level = levelMap[node.levelDynamic],
+                        shapeExisting = point.shapeExisting || {},
+                        shape = node.shapeArgs || {},
+                        attrStyle = series.pointAttribs(
+                            point,
+                            point.selected && 'select'
+                        ),
+                        onComplete,
+                        visible = !!(node.visible && node.shapeArgs),
+                        from,
+                        to,
+                        drillId,
+                        optionsPoint,
+                        optionsSeries,
+                        optionsLevel,
+                        dlOptions,
+                        rotation;
+
+                    if (hasRendered && animation) {
+                        from = {};
+                        to = {
+                            end: shape.end,
+                            start: shape.start,
+                            innerR: shape.innerR,
+                            r: shape.r,
+                            x: centerX,
+                            y: centerY
+                        };
+                        if (visible) {
+                            // Animate points in
+                            if (!point.graphic && shapePreviousRoot) {
+                                if (idRoot === point.id) {
+                                    from = {
+                                        start: radians.start,
+                                        end: radians.end
+                                    };
+                                } else {
+                                    from = (
+                                        shapePreviousRoot.end <= shape.start
+                                    ) ? {
+                                        start: radians.end,
+                                        end: radians.end
+                                    } : {
+                                        start: radians.start,
+                                        end: radians.start
+                                    };
+                                }
+                                // Animate from center and outwards.
+                                from.innerR = from.r = innerR;
+                            }
+                        } else if (point.graphic) {
+                            // Animate points out
+                            if (idPreviousRoot === point.id) {
+                                to = {
+                                    innerR: innerR,
+                                    r: innerR
+                                };
+                            } else if (shapeRoot) {
+                                to = (shapeRoot.end <= shapeExisting.start) ? {
+                                    innerR: innerR,
+                                    r: innerR,
+                                    start: radians.end,
+                                    end: radians.end
+                                } : {
+                                    innerR: innerR,
+                                    r: innerR,
+                                    start: radians.start,
+                                    end: radians.start
+                                };
+                            }
+                        }
+                    } else {
+                        // When animation is disabled, attr is called from
+                        // animation.
+                        to = shape;
+                        from = {};
+                    }
+
+                    // The drill id of a parent node is its own id, and the
+                    // id of its parent when it is the root node
+                    if (!point.node.isLeaf) {
+                        drillId = idRoot === point.id ?
+                            nodeMap[idRoot].parent :
+                            point.id;
+                    }
+                    extend(point, {
+                        shapeExisting: shape, // Store for use in animation
+                        tooltipPos: [shape.plotX, shape.plotY],
+                        drillId: drillId,
+                        name: '' + (point.name || point.id || point.index),
+                        plotX: shape.plotX, // used for data label position
+                        plotY: shape.plotY, // used for data label position
+                        value: node.val,
+                        isNull: !visible // used for dataLabels & point.draw
+                    });
+
+                    // Set data label options: the series, level and point
+                    // options merged over the defaults
+                    optionsPoint = point.options;
+                    optionsSeries = series.options;
+                    shape = isObject(shape) ? shape : {};
+                    optionsSeries = isObject(optionsSeries) ?
+                        optionsSeries.dataLabels :
+                        {};
+                    optionsPoint = isObject(optionsPoint) ?
+                        optionsPoint.dataLabels :
+                        {};
+                    optionsLevel = isObject(level) ? level.dataLabels : {};
+                    dlOptions = merge({
+                        rotationMode: 'perpendicular',
+                        style: {
+                            width: shape.radius
+                        }
+                    }, optionsSeries, optionsLevel, optionsPoint);
+                    if (!isNumber(dlOptions.rotation)) {
+                        rotation = shape.end - (shape.end - shape.start) / 2;
+                        rotation = (rotation * rad2deg) % 180;
+                        if (dlOptions.rotationMode === 'parallel') {
+                            rotation -= 90;
+                        }
+                        // Data labels should not rotate beyond 90 degrees, for
+                        // readability.
+                        if (rotation > 90) {
+                            rotation -= 180;
+                        }
+                        dlOptions.rotation = rotation;
+                    }
+                    // NOTE: alignDataLabel positions the data label
+                    // differently when rotation is 0. Avoiding this by
+                    // setting rotation to a small number.
+                    if (dlOptions.rotation === 0) {
+                        dlOptions.rotation = 0.001;
+                    }
+                    point.dlOptions = dlOptions;
+
+                    // If this is the first visible point, add the hack.
+                    if (!addedHack && visible) {
+                        addedHack = true;
+                        onComplete = animateLabels;
+                    }
+                    point.draw({
+                        animate: to,
+                        attr: extend(from, attrStyle),
+                        onComplete: onComplete,
+                        group: group,
+                        renderer: renderer,
+                        shapeType: 'arc',
+                        shapeArgs: shape
+                    });
+                });
+                // Draw data labels after points
+                // TODO draw labels one by one to avoid addtional looping
+                if (hackDataLabelAnimation && addedHack) {
+                    series.hasRendered = false;
+                    series.options.dataLabels.defer = true;
+                    Series.prototype.drawDataLabels.call(series);
+                    series.hasRendered = true;
+                    // If animateLabels is called before labels were hidden,
+                    // then call it again.
+                    if (animateLabelsCalled) {
+                        animateLabels();
+                    }
+                } else {
+                    Series.prototype.drawDataLabels.call(series);
+                }
+            },
+            pointAttribs: H.seriesTypes.column.prototype.pointAttribs,
+            translate: function translate() {
+                var series = this,
+                    options = series.options,
+                    positions = series.center = getCenter.call(series),
+                    radians = series.startAndEndRadians = getStartAndEndRadians(
+                        options.startAngle,
+                        options.endAngle
+                    ),
+                    innerRadius = positions[3] / 2,
+                    outerRadius = positions[2] / 2,
+                    idRoot = series.rootNode = pick(
+                        series.rootNode,
+                        options.rootId,
+                        ''
+                    ),
+                    mapIdToNode = series.nodeMap,
+                    idTop,
+                    nodeRoot = mapIdToNode && mapIdToNode[idRoot],
+                    nodeTop,
+                    radiusPerLevel,
+                    tree,
+                    values;
+
+                series.shapeRoot = nodeRoot && nodeRoot.shapeArgs;
+                // Call prototype function
+                Series.prototype.translate.call(series);
+                // Create a object map from level to options
+                series.levelMap = reduce(series.options.levels || [],
+                    function (arr, item) {
+                        arr[item.level] = item;
+                        return arr;
+                    }, {});
+                tree = series.tree = series.getTree();
+                mapIdToNode = series.nodeMap;
+                nodeRoot = mapIdToNode[idRoot];
+                idTop = isString(nodeRoot.parent) ? nodeRoot.parent : '';
+                nodeTop = mapIdToNode[idTop];
+                setTreeValues(tree, {
+                    before: setColor,
+                    idRoot: idRoot,
+                    levelIsConstant: options.levelIsConstant,
+                    levelMap: series.levelMap,
+                    mapIdToNode: mapIdToNode,
+                    points: series.points,
+                    series: series
+                });
+                // The radius of each ring, the root takes the inner one
+                radiusPerLevel = (outerRadius - innerRadius) / (
+                    idRoot === idTop ? nodeRoot.height : nodeRoot.height + 1
+                );
+                values = mapIdToNode[''].shapeArgs = {
+                    end: radians.end,
+                    r: innerRadius,
+                    radius: radiusPerLevel,
+                    start: radians.start,
+                    val: nodeTop.val,
+                    x: positions[0],
+                    y: positions[1]
+                };
+                setShapeArgs(nodeTop, values);
+            },
+
+            /**
+             * Animate the slices in. Similar to the animation of polar charts.
+             */
+            animate: function (init) {
+                var chart = this.chart,
+                    center = [
+                        chart.plotWidth / 2,
+                        chart.plotHeight / 2
+                    ],
+                    plotLeft = chart.plotLeft,
+                    plotTop = chart.plotTop,
+                    attribs,
+                    group = this.group;
+
+                // Initialize the animation
+                if (init) {
+                    // Scale down the group and place it in the center
+                    attribs = {
+                        translateX: center[0] + plotLeft,
+                        translateY: center[1] + plotTop,
+                        scaleX: 0.001, // #1499
+                        scaleY: 0.001,
+                        rotation: 10,
+                        opacity: 0.01
+                    };
+                    group.attr(attribs);
+
+                // Run the animation
+                } else {
+                    attribs = {
+                        translateX: plotLeft,
+                        translateY: plotTop,
+                        scaleX: 1,
+                        scaleY: 1,
+                        rotation: 0,
+                        opacity: 1
+                    };
+                    group.animate(attribs, this.options.animation);
+
+                    // Delete this function to allow it only once
+                    this.animate = null;
+                }
+            }
+        };
+
+        /**
+         * Properties of the Sunburst point.
+         */
+        var sunburstPoint = {
+            draw: drawPoint,
+            shouldDraw: function shouldDraw() {
+                var point = this;
+                return !point.isNull;
+            }
+        };
+
+        seriesType(
+            'sunburst',
+            'treemap',
+            sunburstOptions,
+            sunburstSeries,
+            sunburstPoint
+        );
+    }(Highcharts, drawPoint, mixinTreeSeries));
+}));
@@ -0,0 +1,1097 @@
+/*
+ Highcharts JS v6.0.2 (2017-10-20)
+
+ (c) 2016 Highsoft AS
+ Authors: Jon Arild Nygard
+
+ License: www.highcharts.com/license
+*/
+/**
+ * (c) 2016 Highsoft AS
+ * Authors: Jon Arild Nygard
+ *
+ * License: www.highcharts.com/license
+ *
+ * Word cloud series. The words are placed from the heaviest to the lightest,
+ * each one walking a spiral out from its first position until it is clear of
+ * the words placed before it.
+ *
+ * The placed words are kept in a two level occupancy grid: blocks of cells
+ * count the words touching them, so most steps of a spiral, far from the
+ * words placed so far, are cleared by a few counts, and near ones only test
+ * the words sharing a cell. Clouds with more words than the workerThreshold
+ * are measured on the page and laid out in a Web Worker, which streams the
+ * placed words back in batches that are drawn as they arrive. Layouts are
+ * cached by the words, their sizes and the layout options, so redrawing the
+ * same cloud draws the cached layout without measuring or placing again.
+ */
+(function (factory) {
+    if (typeof module === 'object' && module.exports) {
+        module.exports = factory;
+    } else {
+        factory(Highcharts);
+    }
+}(function (Highcharts) {
+    var drawPoint = (function () {
+        var draw = function draw(params) {
+            var point = this,
+                graphic = point.graphic,
+                animate = params.animate,
+                attr = params.attr,
+                onComplete = params.onComplete,
+                css = params.css,
+                group = params.group,
+                renderer = params.renderer,
+                shape = params.shapeArgs,
+                type = params.shapeType;
+
+            if (point.shouldDraw()) {
+                if (!graphic) {
+                    point.graphic = graphic = renderer[type](shape).add(group);
+                }
+                graphic.css(css).attr(attr).animate(animate, undefined, onComplete);
+            } else if (graphic) {
+                graphic.animate(animate, undefined, function () {
+                    point.graphic = graphic = graphic.destroy();
+                    if (typeof onComplete === 'function') {
+                        onComplete();
+                    }
+                });
+            }
+        };
+        return draw;
+    }());
+    (function (H, drawPoint) {
+        var each = H.each,
+            extend = H.extend,
+            isArray = H.isArray,
+            isNumber = H.isNumber,
+            isObject = H.isObject,
+            win = H.win,
+            Series = H.Series,
+            layout,
+            workerState,
+            layoutCache = {
+                keys: [],
+                layouts: {}
+            };
+
+        /**
+         * Layouts kept in the cache, the least recently made ones are
+         * dropped first.
+         */
+        var LAYOUT_CACHE_SIZE = 16;
+
+        /**
+         * Words posted back from the worker at a time.
+         */
+        var WORKER_BATCH_SIZE = 50;
+
+        /**
+         * The layout of the words, without access to the page: the spirals,
+         * the occupancy grid and the placement of measured words. It is
+         * serialized with toString for the worker, so it must not reference
+         * anything outside its own scope.
+         */
+        function wordcloudLayout() {
+            var BLOCK_CELLS = 8,
+                floor = Math.floor;
+
+            function isRectanglesIntersecting(r1, r2) {
+                return !(
+                    r2.left > r1.right ||
+                    r2.right < r1.left ||
+                    r2.top > r1.bottom ||
+                    r2.bottom < r1.top
+                );
+            }
+
+            /**
+             * Whether the sides of a rectangle are all finite. A sum with an
+             * infinite or NaN side is not finite, and subtracts to NaN.
+             */
+            function isFiniteRect(rect) {
+                var sum = rect.left + rect.right + rect.top + rect.bottom;
+                return sum - sum === 0;
+            }
+
+            /**
+             * Positions on a square spiral, 5 pixels apart, or false after
+             * 10000 attempts.
+             */
+            function squareSpiral(attempt) {
+                var k = Math.ceil((Math.sqrt(attempt) - 1) / 2),
+                    t = 2 * k + 1,
+                    m = Math.pow(t, 2),
+                    isBoolean = function (x) {
+                        return typeof x === 'boolean';
+                    },
+                    result = false;
+                t -= 1;
+                if (attempt <= 10000) {
+                    if (isBoolean(result) && attempt >= m - t) {
+                        result = {
+                            x: k - (m - attempt),
+                            y: -k
+                        };
+                    }
+                    m -= t;
+                    if (isBoolean(result) && attempt >= m - t) {
+                        result = {
+                            x: -k,
+                            y: -k + (m - attempt)
+                        };
+                    }
+
+                    m -= t;
+                    if (isBoolean(result)) {
+                        if (attempt >= m - t) {
+                            result = {
+                                x: -k + (m - attempt),
+                                y: k
+                            };
+                        } else {
+                            result = {
+                                x: k,
+                                y: k - (m - attempt - t)
+                            };
+                        }
+                    }
+                    result.x *= 5;
+                    result.y *= 5;
+                }
+                return result;
+            }
+
+            var spirals = {
+                /**
+                 * Positions on an archimedean spiral, or false when the
+                 * spiral leaves the playing field or after 10000 attempts.
+                 */
+                archimedean: function (attempt, params) {
+                    var field = params.field,
+                        result = false,
+                        maxDelta = (field.width * field.width) +
+                            (field.height * field.height),
+                        t = attempt * 0.2;
+                    // Emergency brake. TODO make spiralling logic more
+                    // foolproof.
+                    if (attempt <= 10000) {
+                        result = {
+                            x: t * Math.cos(t),
+                            y: t * Math.sin(t)
+                        };
+                        if (!(Math.min(Math.abs(result.x), Math.abs(result.y)) < maxDelta)) {
+                            result = false;
+                        }
+                    }
+                    return result;
+                },
+                /**
+                 * A square spiral stretched to the ratio of the playing
+                 * field.
+                 */
+                rectangular: function (attempt, params) {
+                    var result = squareSpiral(attempt, params),
+                        field = params.field;
+                    if (result) {
+                        result.x *= field.ratio;
+                    }
+                    return result;
+                },
+                square: squareSpiral
+            };
+
+            /**
+             * The placed words, in cells about the height of a word. Blocks
+             * of cells count the words touching them, so empty parts of the
+             * cloud are passed over without looking at cells. Words with
+             * positions that are not numbers are tested by any word.
+             */
+            function OccupancyGrid(cellSize) {
+                this.cellSize = cellSize;
+                this.cells = {};
+                this.blocks = {};
+                this.unbounded = [];
+            }
+
+            OccupancyGrid.prototype = {
+                insert: function (rect) {
+                    var grid = this,
+                        size = grid.cellSize,
+                        blockSize = size * BLOCK_CELLS,
+                        x1,
+                        y0,
+                        y1,
+                        x,
+                        y,
+                        column;
+
+                    if (!isFiniteRect(rect)) {
+                        grid.unbounded.push(rect);
+                        return;
+                    }
+                    x1 = floor(rect.right / size);
+                    y0 = floor(rect.top / size);
+                    y1 = floor(rect.bottom / size);
+                    for (x = floor(rect.left / size); x <= x1; x++) {
+                        column = grid.cells[x] || (grid.cells[x] = {});
+                        for (y = y0; y <= y1; y++) {
+                            (column[y] || (column[y] = [])).push(rect);
+                        }
+                    }
+                    x1 = floor(rect.right / blockSize);
+                    y0 = floor(rect.top / blockSize);
+                    y1 = floor(rect.bottom / blockSize);
+                    for (x = floor(rect.left / blockSize); x <= x1; x++) {
+                        column = grid.blocks[x] || (grid.blocks[x] = {});
+                        for (y = y0; y <= y1; y++) {
+                            column[y] = (column[y] || 0) + 1;
+                        }
+                    }
+                },
+
+                /**
+                 * A placed word intersecting the rectangle, or undefined.
+                 */
+                find: function (rect, placed) {
+                    var grid = this,
+                        size = grid.cellSize,
+                        unbounded = grid.unbounded,
+                        x0,
+                        x1,
+                        y0,
+                        y1,
+                        bx,
+                        bx1,
+                        by,
+                        by0,
+                        by1,
+                        x,
+                        xEnd,
+                        y,
+                        yEnd,
+                        i,
+                        blockColumn,
+                        column,
+                        cell;
+
+                    for (i = 0; i < unbounded.length; i++) {
+                        if (isRectanglesIntersecting(rect, unbounded[i])) {
+                            return unbounded[i];
+                        }
+                    }
+                    if (!isFiniteRect(rect)) {
+                        for (i = 0; i < placed.length; i++) {
+                            if (isRectanglesIntersecting(rect, placed[i])) {
+                                return placed[i];
+                            }
+                        }
+                        return;
+                    }
+
+                    x0 = floor(rect.left / size);
+                    x1 = floor(rect.right / size);
+                    y0 = floor(rect.top / size);
+                    y1 = floor(rect.bottom / size);
+                    bx1 = floor(x1 / BLOCK_CELLS);
+                    by0 = floor(y0 / BLOCK_CELLS);
+                    by1 = floor(y1 / BLOCK_CELLS);
+
+                    // Only the cells of blocks that words touch
+                    for (bx = floor(x0 / BLOCK_CELLS); bx <= bx1; bx++) {
+                        blockColumn = grid.blocks[bx];
+                        for (by = by0; blockColumn && by <= by1; by++) {
+                            if (!blockColumn[by]) {
+                                continue;
+                            }
+                            xEnd = bx * BLOCK_CELLS + BLOCK_CELLS - 1;
+                            xEnd = x1 < xEnd ? x1 : xEnd;
+                            yEnd = by * BLOCK_CELLS + BLOCK_CELLS - 1;
+                            yEnd = y1 < yEnd ? y1 : yEnd;
+                            for (x = x0 > bx * BLOCK_CELLS ? x0 : bx * BLOCK_CELLS; x <= xEnd; x++) {
+                                column = grid.cells[x];
+                                for (y = y0 > by * BLOCK_CELLS ? y0 : by * BLOCK_CELLS; column && y <= yEnd; y++) {
+                                    cell = column[y];
+                                    for (i = 0; cell && i < cell.length; i++) {
+                                        if (isRectanglesIntersecting(rect, cell[i])) {
+                                            return cell[i];
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            };
+
+            /**
+             * Returns a function that places measured words one by one, in
+             * cells of the given size. A word is a rectangle, flagged outside
+             * when its unmoved box is not inside the playing field, which the
+             * spiral does not change. The function returns the offset of the
+             * word from its first position, or false when it could not be
+             * placed, and the rectangle it was last tested at.
+             *
+             * The built in spirals only depend on the attempt and the size of
+             * the field, so with pure set their offsets are computed once per
+             * layout instead of once per word.
+             */
+            function createPlacer(field, spiral, cellSize, pure) {
+                var grid = new OccupancyGrid(cellSize),
+                    placed = [],
+                    offsets = [];
+
+                function offset(attempt) {
+                    if (!pure) {
+                        return spiral(attempt, { field: field });
+                    }
+                    if (offsets[attempt] === undefined) {
+                        offsets[attempt] = spiral(attempt, { field: field });
+                    }
+                    return offsets[attempt];
+                }
+
+                return function (word) {
+                    var rect = {
+                            left: word.left,
+                            right: word.right,
+                            top: word.top,
+                            bottom: word.bottom,
+                            width: word.width,
+                            height: word.height
+                        },
+                        attempt = 1,
+                        delta = { x: 0, y: 0 },
+                        last;
+
+                    function collides() {
+                        if (last && isRectanglesIntersecting(rect, last)) {
+                            return true;
+                        }
+                        last = grid.find(rect, placed);
+                        return !!last;
+                    }
+
+                    if (word.outside) {
+                        return { delta: false, rect: rect };
+                    }
+                    while (collides() && delta !== false) {
+                        delta = offset(attempt);
+                        if (delta) {
+                            rect.left = word.left + delta.x;
+                            rect.right = rect.left + rect.width;
+                            rect.top = word.top + delta.y;
+                            rect.bottom = rect.top + rect.height;
+                        }
+                        attempt++;
+                    }
+                    if (delta) {
+                        placed.push(rect);
+                        grid.insert(rect);
+                    }
+                    return { delta: delta, rect: rect };
+                };
+            }
+
+            return {
+                spirals: spirals,
+                createPlacer: createPlacer
+            };
+        }
+
+        /**
+         * The worker body, given the layout to run. Words come as a packed
+         * array and the offsets of the placed words go back in batches.
+         */
+        function workerMain(wordcloudLayout) {
+            var layout = wordcloudLayout(),
+                FIELDS = 7;
+
+            self.onmessage = function (e) {
+                var msg = e.data,
+                    packed = msg.words,
+                    count = packed.length / FIELDS,
+                    words = [],
+                    start = 0,
+                    place,
+                    deltas,
+                    delta,
+                    i;
+
+                function post(end) {
+                    self.postMessage({
+                        jobId: msg.jobId,
+                        start: start,
+                        deltas: deltas,
+                        done: end === count
+                    }, [deltas.buffer]);
+                    start = end;
+                }
+
+                for (i = 0; i < count; i++) {
+                    words.push({
+                        left: packed[i * FIELDS],
+                        right: packed[i * FIELDS + 1],
+                        top: packed[i * FIELDS + 2],
+                        bottom: packed[i * FIELDS + 3],
+                        width: packed[i * FIELDS + 4],
+                        height: packed[i * FIELDS + 5],
+                        outside: packed[i * FIELDS + 6] === 1
+                    });
+                }
+                place = layout.createPlacer(
+                    msg.field,
+                    layout.spirals[msg.spiral],
+                    msg.cellSize,
+                    true
+                );
+                deltas = new Float64Array(2 * Math.min(msg.batchSize, count));
+                for (i = 0; i < count; i++) {
+                    delta = place(words[i]).delta;
+                    deltas[2 * (i - start)] = delta ? delta.x : NaN;
+                    deltas[2 * (i - start) + 1] = delta ? delta.y : NaN;
+                    if (i + 1 - start === msg.batchSize || i + 1 === count) {
+                        post(i + 1);
+                        deltas = new Float64Array(
+                            2 * Math.min(msg.batchSize, count - start)
+                        );
+                    }
+                }
+                if (!count) {
+                    post(0);
+                }
+            };
+        }
+
+        /**
+         * Lazily start the layout worker. Returns false when the page can not
+         * run workers from a blob, in which case clouds are laid out on the
+         * page thread.
+         */
+        function getWorker() {
+            var blob,
+                url;
+
+            if (workerState === undefined) {
+                workerState = false;
+                if (win.Worker && win.Blob && win.URL && win.Float64Array) {
+                    try {
+                        blob = new win.Blob(
+                            [
+                                '(' + workerMain.toString() + ')(' +
+                                wordcloudLayout.toString() + ');'
+                            ],
+                            { type: 'application/javascript' }
+                        );
+                        url = win.URL.createObjectURL(blob);
+                        workerState = {
+                            worker: new win.Worker(url),
+                            callbacks: {},
+                            jobId: 0
+                        };
+                        workerState.worker.onmessage = function (e) {
+                            var callback = workerState.callbacks[e.data.jobId];
+                            if (e.data.done) {
+                                delete workerState.callbacks[e.data.jobId];
+                            }
+                            if (callback) {
+                                callback(e.data);
+                            }
+                        };
+                    } catch (e) {
+                        workerState = false;
+                    }
+                }
+            }
+            return workerState;
+        }
+
+        layout = wordcloudLayout();
+
+        /**
+         * Hashes a string into a running 32 bit FNV-1a hash.
+         */
+        function hashString(hash, str) {
+            var i;
+            str = String(str);
+            for (i = 0; i < str.length; i++) {
+                hash = Math.imul(hash ^ str.charCodeAt(i), 16777619);
+            }
+            return Math.imul(hash ^ 0x1f, 16777619);
+        }
+
+        /**
+         * The cache key of the layout of the sorted words: their text and
+         * font sizes, the style and the layout options, and the size of the
+         * plot.
+         */
+        function getLayoutKey(series, words, xAxis, yAxis) {
+            var options = series.options,
+                parts = [
+                    options.placementStrategy,
+                    options.spiral,
+                    JSON.stringify(options.rotation),
+                    JSON.stringify(options.style),
+                    xAxis.len,
+                    yAxis.len,
+                    words.length
+                ],
+                hash1 = 2166136261,
+                hash2 = 84696351;
+
+            each(words, function (word) {
+                parts.push(word.point.name, word.css.fontSize);
+            });
+            each(parts, function (part) {
+                hash1 = hashString(hash1, part);
+                hash2 = hashString(hash2 ^ 0x5bd1e995, part);
+            });
+            return (hash1 >>> 0).toString(36) + '-' + (hash2 >>> 0).toString(36);
+        }
+
+        function cacheLayout(key, value) {
+            var cache = layoutCache;
+            if (!cache.layouts[key]) {
+                cache.keys.push(key);
+                if (cache.keys.length > LAYOUT_CACHE_SIZE) {
+                    delete cache.layouts[cache.keys.shift()];
+                }
+            }
+            cache.layouts[key] = value;
+        }
+
+        /**
+         * getPlayingField - Calculates the playing field for the cloud,
+         * of 256 pixels high in the ratio of the plot.
+         */
+        var getPlayingField = function getPlayingField(targetWidth, targetHeight) {
+            var ratio = targetWidth / targetHeight;
+            return {
+                width: 256 * ratio,
+                height: 256,
+                ratio: ratio
+            };
+        };
+
+        /**
+         * getRotation - Calculates a number of degrees to rotate, based upon
+         * a number of orientations within a range from-to.
+         */
+        var getRotation = function getRotation(orientations, from, to) {
+            var range = to - from,
+                intervals = range / (orientations - 1),
+                orientation = Math.floor(Math.random() * orientations);
+            return from + (orientation * intervals);
+        };
+
+        /**
+         * outsidePlayingField - Detects if a word is placed outside the
+         * playing field.
+         */
+        var outsidePlayingField = function outsidePlayingField(wrapper, field) {
+            var rect = wrapper.getBBox(),
+                playingField = {
+                    left: -(field.width / 2),
+                    right: field.width / 2,
+                    top: -(field.height / 2),
+                    bottom: field.height / 2
+                };
+            return !(
+                playingField.left < rect.x &&
+                playingField.right > rect.x + rect.width &&
+                playingField.top < rect.y &&
+                playingField.bottom > rect.y + rect.height
+            );
+        };
+
+        /**
+         * updateFieldBoundaries - Grows the extremes of the field with a
+         * placed word.
+         */
+        var updateFieldBoundaries = function updateFieldBoundaries(field, rectangle) {
+            if (!isNumber(field.left) || field.left > rectangle.left) {
+                field.left = rectangle.left;
+            }
+            if (!isNumber(field.right) || field.right < rectangle.right) {
+                field.right = rectangle.right;
+            }
+            if (!isNumber(field.top) || field.top > rectangle.top) {
+                field.top = rectangle.top;
+            }
+            if (!isNumber(field.bottom) || field.bottom < rectangle.bottom) {
+                field.bottom = rectangle.bottom;
+            }
+            return field;
+        };
+
+        /**
+         * Strategies used for deciding rotation and initial position of a
+         * word. To implement a custom strategy, have a look at the function
+         * random for example.
+         */
+        var placementStrategies = {
+            random: function random(point, options) {
+                var field = options.field,
+                    r = options.rotation;
+                return {
+                    x: Math.round((field.width * (Math.random() + 0.5)) / 2) - (field.width / 2),
+                    y: Math.round((field.height * (Math.random() + 0.5)) / 2) - (field.height / 2),
+                    rotation: getRotation(r.orientations, r.from, r.to)
+                };
+            },
+            center: function center(point, options) {
+                var r = options.rotation;
+                return {
+                    x: 0,
+                    y: 0,
+                    rotation: getRotation(r.orientations, r.from, r.to)
+                };
+            }
+        };
+
+        /**
+         * Default options for the WordCloud series.
+         */
+        var wordCloudOptions = {
+            animation: {
+                duration: 500
+            },
+            borderWidth: 0,
+            clip: false, // Something goes wrong with clip. // TODO fix this
+            colorByPoint: true,
+            placementStrategy: 'center',
+            rotation: {
+                from: 0,
+                orientations: 2,
+                to: 90
+            },
+            showInLegend: false,
+            spiral: 'rectangular',
+            style: {
+                fontFamily: 'Impact, sans-serif'
+            },
+            tooltip: {
+                followPointer: true
+            },
+            /**
+             * Clouds with more words than this are laid out in a Web Worker
+             * and drawn as the placed words come back, unless exporting.
+             * Set to 0 to always lay out on the page thread.
+             */
+            workerThreshold: 500
+        };
+
+        /**
+         * Properties of the WordCloud series.
+         */
+        var wordCloudSeries = {
+            animate: Series.prototype.animate,
+            bindAxes: function () {
+                var wordcloudAxis = {
+                    endOnTick: false,
+                    gridLineWidth: 0,
+                    lineWidth: 0,
+                    maxPadding: 0,
+                    startOnTick: false,
+                    title: null,
+                    tickPositions: []
+                };
+                Series.prototype.bindAxes.call(this);
+                extend(this.yAxis.options, wordcloudAxis);
+                extend(this.xAxis.options, wordcloudAxis);
+            },
+            deriveFontSize: function deriveFontSize(relativeWeight) {
+                var maxFontSize = 25;
+                return Math.floor(maxFontSize * relativeWeight);
+            },
+            drawPoints: function () {
+                var series = this,
+                    xAxis = series.xAxis,
+                    yAxis = series.yAxis,
+                    options = series.options,
+                    renderer = series.chart.renderer,
+                    placementStrategy = series.placementStrategy[options.placementStrategy],
+                    spiral = series.spirals[options.spiral],
+                    weights = series.points.map(function (p) {
+                        return p.weight;
+                    }),
+                    maxWeight = Math.max.apply(null, weights),
+                    data = series.points.sort(function (a, b) {
+                        return b.weight - a.weight; // Sort descending
+                    }),
+                    words = [],
+                    fontSizes = [],
+                    cached,
+                    cloud,
+                    testElement,
+                    place,
+                    state;
+
+                each(data, function (point) {
+                    var relativeWeight = 1 / maxWeight * point.weight,
+                        css = extend({
+                            fontSize: series.deriveFontSize(relativeWeight),
+                            fill: point.color
+                        }, options.style);
+                    words.push({
+                        point: point,
+                        css: css
+                    });
+                    fontSizes.push(parseFloat(css.fontSize) || 0);
+                });
+                fontSizes.sort(function (a, b) {
+                    return a - b;
+                });
+
+                series.wordcloudJob = undefined;
+                cloud = series.wordcloudLayout = {
+                    key: getLayoutKey(series, words, xAxis, yAxis),
+                    field: getPlayingField(xAxis.len, yAxis.len),
+                    placed: [],
+                    words: [],
+                    hasRendered: series.hasRendered,
+                    // Cells of the occupancy grid about the height of a word
+                    cellSize: Math.max(1, fontSizes[fontSizes.length >> 1] || 1)
+                };
+
+                // The same words in the same plot, draw the cached layout
+                cached = layoutCache.layouts[cloud.key];
+                if (cached) {
+                    series.drawWords(words, cached.words, 0);
+                    series.wordcloudLayout = undefined;
+                    series.scaleCloud(cached.field);
+                    return;
+                }
+
+                /**
+                 * Place the word with the placement strategy and measure it.
+                 */
+                function measure(word) {
+                    var point = word.point,
+                        placement = placementStrategy(point, {
+                            data: data,
+                            field: cloud.field,
+                            placed: cloud.placed,
+                            rotation: options.rotation
+                        }),
+                        clientRect;
+                    word.placement = placement;
+                    word.attr = {
+                        align: 'center',
+                        x: placement.x,
+                        y: placement.y,
+                        text: point.name,
+                        rotation: placement.rotation
+                    };
+                    // The element keeps the first styles object it is given
+                    // and extends it after, so it gets a copy
+                    testElement.css(extend({}, word.css)).attr(word.attr);
+                    point.clientRect = clientRect = extend(
+                        {},
+                        testElement.element.getBoundingClientRect()
+                    );
+                    return {
+                        left: clientRect.left,
+                        right: clientRect.right,
+                        top: clientRect.top,
+                        bottom: clientRect.bottom,
+                        width: clientRect.width,
+                        height: clientRect.height,
+                        outside: outsidePlayingField(testElement, cloud.field)
+                    };
+                }
+
+                testElement = renderer.text().add(series.group);
+
+                // Large clouds with the built in strategies and spirals,
+                // which do not look at the placed words, are measured first
+                // and laid out in the worker
+                state = data.length > options.workerThreshold &&
+                    options.workerThreshold > 0 &&
+                    !renderer.forExport &&
+                    placementStrategy === placementStrategies[options.placementStrategy] &&
+                    spiral === layout.spirals[options.spiral] &&
+                    getWorker();
+                if (state) {
+                    series.postWords(state, words, words.map(measure));
+                    testElement.destroy();
+                    return;
+                }
+
+                place = layout.createPlacer(
+                    cloud.field,
+                    spiral,
+                    cloud.cellSize,
+                    spiral === layout.spirals[options.spiral]
+                );
+                each(words, function (word) {
+                    var result = place(measure(word));
+                    word.point.rect = result.rect;
+                    series.placeWord(word, result.delta);
+                });
+                testElement.destroy();
+                series.finishLayout();
+            },
+
+            /**
+             * Post the measured words to the worker, and draw the batches of
+             * placed words it posts back.
+             */
+            postWords: function (state, words, rects) {
+                var series = this,
+                    cloud = series.wordcloudLayout,
+                    packed = new win.Float64Array(7 * rects.length),
+                    jobId = ++state.jobId;
+
+                each(rects, function (rect, i) {
+                    packed[i * 7] = rect.left;
+                    packed[i * 7 + 1] = rect.right;
+                    packed[i * 7 + 2] = rect.top;
+                    packed[i * 7 + 3] = rect.bottom;
+                    packed[i * 7 + 4] = rect.width;
+                    packed[i * 7 + 5] = rect.height;
+                    packed[i * 7 + 6] = rect.outside ? 1 : 0;
+                });
+
+                series.wordcloudJob = jobId;
+                state.callbacks[jobId] = function (batch) {
+                    var deltas = batch.deltas,
+                        i,
+                        word,
+                        rect,
+                        delta;
+
+                    // The cloud was drawn again or removed meanwhile
+                    if (series.wordcloudJob !== jobId || !series.group) {
+                        return;
+                    }
+                    for (i = 0; 2 * i < deltas.length; i++) {
+                        word = words[batch.start + i];
+                        rect = rects[batch.start + i];
+                        delta = isNaN(deltas[2 * i]) ? false : {
+                            x: deltas[2 * i],
+                            y: deltas[2 * i + 1]
+                        };
+                        if (delta) {
+                            rect.left += delta.x;
+                            rect.right = rect.left + rect.width;
+                            rect.top += delta.y;
+                            rect.bottom = rect.top + rect.height;
+                        }
+                        delete rect.outside;
+                        word.point.rect = rect;
+                        series.placeWord(word, delta);
+                    }
+                    if (batch.done) {
+                        series.wordcloudJob = undefined;
+                        series.finishLayout();
+                    } else {
+                        series.scaleCloud(cloud.field);
+                    }
+                };
+                state.worker.postMessage({
+                    jobId: jobId,
+                    words: packed,
+                    field: {
+                        width: cloud.field.width,
+                        height: cloud.field.height,
+                        ratio: cloud.field.ratio
+                    },
+                    spiral: series.options.spiral,
+                    cellSize: cloud.cellSize,
+                    batchSize: WORKER_BATCH_SIZE
+                }, [packed.buffer]);
+            },
+
+            /**
+             * Moves a measured word by the offset the layout found for it,
+             * grows the field with it and draws it. Words without an offset
+             * could not be placed and are not drawn.
+             */
+            placeWord: function (word, delta) {
+                var series = this,
+                    point = word.point,
+                    attr = word.attr,
+                    clientRect = point.clientRect,
+                    cloud = series.wordcloudLayout;
+
+                if (isObject(delta)) {
+                    attr.x += delta.x;
+                    attr.y += delta.y;
+                    extend(word.placement, {
+                        left: attr.x - (clientRect.width / 2),
+                        right: attr.x + (clientRect.width / 2),
+                        top: attr.y - (clientRect.height / 2),
+                        bottom: attr.y + (clientRect.height / 2)
+                    });
+                    cloud.field = updateFieldBoundaries(cloud.field, word.placement);
+                    cloud.placed.push(point);
+                    point.isNull = false;
+                } else {
+                    point.isNull = true;
+                }
+                cloud.words.push({
+                    x: attr.x,
+                    y: attr.y,
+                    rotation: attr.rotation,
+                    isNull: point.isNull
+                });
+                series.drawWords([word], cloud.words, cloud.words.length - 1);
+            },
+
+            /**
+             * Draws words at laid out positions, starting from the position
+             * of the first one.
+             */
+            drawWords: function (words, positions, start) {
+                var series = this,
+                    animation = series.options.animation,
+                    hasRendered = series.wordcloudLayout.hasRendered;
+
+                each(words, function (word, i) {
+                    var point = word.point,
+                        position = positions[start + i],
+                        attr = {
+                            align: 'center',
+                            x: position.x,
+                            y: position.y,
+                            text: point.name,
+                            rotation: position.rotation
+                        },
+                        animate;
+
+                    point.isNull = position.isNull;
+                    if (animation) {
+                        // Animate to new positions
+                        animate = {
+                            x: attr.x,
+                            y: attr.y
+                        };
+                        // Animate from center of chart
+                        if (!hasRendered) {
+                            attr.x = 0;
+                            attr.y = 0;
+                        // or animate from previous position
+                        } else {
+                            delete attr.x;
+                            delete attr.y;
+                        }
+                    }
+                    point.draw({
+                        animate: animate,
+                        attr: attr,
+                        css: word.css,
+                        group: series.group,
+                        renderer: series.chart.renderer,
+                        shapeArgs: undefined,
+                        shapeType: 'text'
+                    });
+                });
+            },
+
+            /**
+             * Keeps the finished layout and scales the cloud to the plot.
+             */
+            finishLayout: function () {
+                var series = this,
+                    cloud = series.wordcloudLayout;
+                cacheLayout(cloud.key, {
+                    words: cloud.words,
+                    field: cloud.field
+                });
+                series.wordcloudLayout = undefined;
+                series.scaleCloud(cloud.field);
+            },
+
+            /**
+             * Scale the group to fit the extremes of the placed words in the
+             * plot.
+             */
+            scaleCloud: function (field) {
+                var series = this,
+                    xAxis = series.xAxis,
+                    yAxis = series.yAxis,
+                    scaleX = 1 / (2 * Math.max(Math.abs(field.left), Math.abs(field.right))),
+                    scaleY = 1 / (2 * Math.max(Math.abs(field.top), Math.abs(field.bottom))),
+                    scale = Math.min(scaleX * xAxis.len, scaleY * yAxis.len);
+                series.group.attr({
+                    scaleX: scale,
+                    scaleY: scale
+                });
+            },
+            hasData: function () {
+                var series = this;
+                return (
+                    isObject(series) &&
+                    series.visible === true &&
+                    isArray(series.points) &&
+                    series.points.length > 0
+                );
+            },
+            /**
+             * Strategies used for deciding rotation and initial position of a
+             * word. To implement a custom strategy, have a look at the
+             * function random for example.
+             */
+            placementStrategy: {
+                random: placementStrategies.random,
+                center: placementStrategies.center
+            },
+            pointArrayMap: ['weight'],
+            /**
+             * Spirals used for placing a word after the initial position
+             * experienced a collision with either another word or the borders.
+             * To implement a custom spiral, look at the function archimedeanSpiral
+             * for example.
+             */
+            spirals: {
+                archimedean: layout.spirals.archimedean,
+                rectangular: layout.spirals.rectangular,
+                square: layout.spirals.square
+            },
+            getPlotBox: function () {
+                var series = this,
+                    chart = series.chart,
+                    inverted = chart.inverted,
+                    // Swap axes for inverted (#2339)
+                    xAxis = series[(inverted ? 'yAxis' : 'xAxis')],
+                    yAxis = series[(inverted ? 'xAxis' : 'yAxis')],
+                    width = xAxis ? xAxis.len : chart.plotWidth,
+                    height = yAxis ? yAxis.len : chart.plotHeight,
+                    x = xAxis ? xAxis.left : chart.plotLeft,
+                    y = yAxis ? yAxis.top : chart.plotTop;
+                return {
+                    translateX: x + (width / 2),
+                    translateY: y + (height / 2),
+                    scaleX: 1, // #1623
+                    scaleY: 1
+                };
+            }
+        };
+
+        /**
+         * Properties of the WordCloud point.
+         */
+        var wordCloudPoint = {
+            draw: drawPoint,
+            shouldDraw: function shouldDraw() {
+                var point = this;
+                return !point.isNull;
+            }
+        };
+
+        /**
+         * A word cloud is a visualization of a set of words, where the size
+         * and placement of a word is determined by how it is weighted.
+         */
+        H.seriesType(
+            'wordcloud',
+            'column',
+            wordCloudOptions,
+            wordCloudSeries,
+            wordCloudPoint
+        );
+
+    }(Highcharts, drawPoint));
+}));
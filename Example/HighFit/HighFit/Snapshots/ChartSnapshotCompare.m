@@ -0,0 +1,244 @@
+//
+//  ChartSnapshotCompare.m
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+//  Draws every options file in References with ChartSnapshotRenderer and compares the picture with
+//  the PNG next to it, which the JavaScript library drew (Tools/chart-reference-render.js).
+//  Not part of the app target, build it on its own, on macOS:
+//
+//    clang -fobjc-arc -DCHART_SNAPSHOT_HEADLESS=1 -I../HighFit ChartSnapshotCompare.m \
+//        ../HighFit/ChartSnapshotRenderer.m -framework Foundation -framework CoreGraphics \
+//        -framework CoreText -framework ImageIO -o compare
+//    ./compare [-t tolerance] [-f fraction] [-d diffs] [references]
+//
+//  A pixel differs when a channel is off by more than the tolerance, 48 by default, from every
+//  reference pixel around it, so anti-aliasing and text placed a pixel apart are not counted.
+//  A chart fails when more than the fraction of its pixels differ, 0.02 by default. The fonts of
+//  the two renderers are not the same, so the text alone keeps the result above zero.
+//  With -d, the pixels that differ are written in red over a faded copy of the reference.
+//  Exits with 1 when a chart fails.
+//
+
+#import <Foundation/Foundation.h>
+#import <CoreGraphics/CoreGraphics.h>
+#import <ImageIO/ImageIO.h>
+
+#import "ChartSnapshotRenderer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct {
+    size_t width;
+    size_t height;
+    uint8_t *pixels;
+} ComparePixels;
+
+// Draws an image into a BGRA buffer with the layout of the renderer's bitmap
+static BOOL CompareReadPixels(CGImageRef image, ComparePixels *pixels)
+{
+    pixels->width = CGImageGetWidth(image);
+    pixels->height = CGImageGetHeight(image);
+    pixels->pixels = calloc(pixels->width * pixels->height, 4);
+    if (!pixels->pixels) {
+        return NO;
+    }
+    CGColorSpaceRef space = CGColorSpaceCreateDeviceRGB();
+    CGContextRef context = CGBitmapContextCreate(pixels->pixels, pixels->width, pixels->height, 8, pixels->width * 4, space, kCGImageAlphaPremultipliedFirst | kCGBitmapByteOrder32Little);
+    CGColorSpaceRelease(space);
+    if (!context) {
+        free(pixels->pixels);
+        pixels->pixels = NULL;
+        return NO;
+    }
+    // The pages have a white background, the renderer leaves it transparent
+    CGContextSetRGBFillColor(context, 1, 1, 1, 1);
+    CGContextFillRect(context, CGRectMake(0, 0, pixels->width, pixels->height));
+    CGContextDrawImage(context, CGRectMake(0, 0, pixels->width, pixels->height), image);
+    CGContextRelease(context);
+    return YES;
+}
+
+static CGImageRef CompareCreateImageAtURL(NSURL *url)
+{
+    CGImageSourceRef source = CGImageSourceCreateWithURL((__bridge CFURLRef)url, NULL);
+    if (!source) {
+        return NULL;
+    }
+    CGImageRef image = CGImageSourceGetCount(source) > 0 ? CGImageSourceCreateImageAtIndex(source, 0, NULL) : NULL;
+    CFRelease(source);
+    return image;
+}
+
+static BOOL CompareWriteImage(CGImageRef image, NSURL *url)
+{
+    CGImageDestinationRef destination = CGImageDestinationCreateWithURL((__bridge CFURLRef)url, CFSTR("public.png"), 1, NULL);
+    if (!destination) {
+        return NO;
+    }
+    CGImageDestinationAddImage(destination, image, NULL);
+    BOOL written = CGImageDestinationFinalize(destination);
+    CFRelease(destination);
+    return written;
+}
+
+static BOOL CompareSamePixel(const uint8_t *a, const uint8_t *b, int tolerance)
+{
+    for (int channel = 0; channel < 4; channel++) {
+        if (abs((int)a[channel] - (int)b[channel]) > tolerance) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
+// Counts the pixels of the snapshot without a matching reference pixel in their 3x3 neighbourhood,
+// and marks them in the diff buffer when there is one
+static size_t CompareCountDifferences(ComparePixels *snapshot, ComparePixels *reference, int tolerance, uint8_t *diff)
+{
+    size_t width = snapshot->width, height = snapshot->height, count = 0;
+    for (size_t y = 0; y < height; y++) {
+        for (size_t x = 0; x < width; x++) {
+            const uint8_t *pixel = snapshot->pixels + (y * width + x) * 4;
+            BOOL matched = NO;
+            for (size_t ny = y ? y - 1 : 0; ny <= y + 1 && ny < height && !matched; ny++) {
+                for (size_t nx = x ? x - 1 : 0; nx <= x + 1 && nx < width && !matched; nx++) {
+                    matched = CompareSamePixel(pixel, reference->pixels + (ny * width + nx) * 4, tolerance);
+                }
+            }
+            if (diff) {
+                uint8_t *out = diff + (y * width + x) * 4;
+                const uint8_t *in = reference->pixels + (y * width + x) * 4;
+                if (matched) {
+                    // Faded reference, BGRA
+                    out[0] = 255 - (255 - in[0]) / 4;
+                    out[1] = 255 - (255 - in[1]) / 4;
+                    out[2] = 255 - (255 - in[2]) / 4;
+                } else {
+                    out[0] = 0;
+                    out[1] = 0;
+                    out[2] = 255;
+                }
+                out[3] = 255;
+            }
+            count += matched ? 0 : 1;
+        }
+    }
+    return count;
+}
+
+static CGImageRef CompareCreateDiffImage(uint8_t *diff, size_t width, size_t height)
+{
+    CGColorSpaceRef space = CGColorSpaceCreateDeviceRGB();
+    CGContextRef context = CGBitmapContextCreate(diff, width, height, 8, width * 4, space, kCGImageAlphaPremultipliedFirst | kCGBitmapByteOrder32Little);
+    CGColorSpaceRelease(space);
+    if (!context) {
+        return NULL;
+    }
+    CGImageRef image = CGBitmapContextCreateImage(context);
+    CGContextRelease(context);
+    return image;
+}
+
+static void CompareUsage(void)
+{
+    fprintf(stderr, "usage: compare [-t tolerance] [-f fraction] [-d diffs] [references]\n");
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    @autoreleasepool {
+        int tolerance = 48;
+        double fraction = 0.02;
+        NSString *diffs = nil;
+        NSString *references = @"References";
+
+        for (int i = 1; i < argc; i++) {
+            if (!strcmp(argv[i], "-t") && i + 1 < argc) {
+                tolerance = atoi(argv[++i]);
+            } else if (!strcmp(argv[i], "-f") && i + 1 < argc) {
+                fraction = atof(argv[++i]);
+            } else if (!strcmp(argv[i], "-d") && i + 1 < argc) {
+                diffs = @(argv[++i]);
+            } else if (argv[i][0] == '-') {
+                CompareUsage();
+            } else {
+                references = @(argv[i]);
+            }
+        }
+
+        NSFileManager *manager = [NSFileManager defaultManager];
+        NSArray<NSString*> *files = [[manager contentsOfDirectoryAtPath:references error:nil] sortedArrayUsingSelector:@selector(compare:)];
+        if (!files) {
+            fprintf(stderr, "cannot read %s\n", references.UTF8String);
+            return 2;
+        }
+        if (diffs) {
+            [manager createDirectoryAtPath:diffs withIntermediateDirectories:YES attributes:nil error:nil];
+        }
+
+        int failed = 0, compared = 0;
+        for (NSString *file in files) {
+            if (![file.pathExtension isEqualToString:@"json"]) {
+                continue;
+            }
+            NSString *name = file.stringByDeletingPathExtension;
+            NSData *json = [NSData dataWithContentsOfFile:[references stringByAppendingPathComponent:file]];
+            NSDictionary *params = json ? [NSJSONSerialization JSONObjectWithData:json options:0 error:nil] : nil;
+            CGImageRef referenceImage = CompareCreateImageAtURL([NSURL fileURLWithPath:[references stringByAppendingPathComponent:[name stringByAppendingPathExtension:@"png"]]]);
+            if (![params isKindOfClass:[NSDictionary class]] || !referenceImage) {
+                printf("%-12s missing options or reference image\n", name.UTF8String);
+                if (referenceImage) {
+                    CGImageRelease(referenceImage);
+                }
+                failed++;
+                continue;
+            }
+
+            // The references are drawn at a device scale of 1
+            CGSize size = CGSizeMake(CGImageGetWidth(referenceImage), CGImageGetHeight(referenceImage));
+            ChartSnapshotRenderer *renderer = [[ChartSnapshotRenderer alloc] initWithParams:params];
+            CGImageRef snapshotImage = [renderer newCGImageWithSize:size scale:1];
+
+            ComparePixels reference = { 0 }, snapshot = { 0 };
+            BOOL read = snapshotImage && CompareReadPixels(referenceImage, &reference) && CompareReadPixels(snapshotImage, &snapshot);
+            if (read) {
+                size_t total = size.width * size.height;
+                uint8_t *diff = diffs ? calloc(total, 4) : NULL;
+                size_t count = CompareCountDifferences(&snapshot, &reference, tolerance, diff);
+                double differing = (double)count / (double)total;
+                BOOL passed = differing <= fraction;
+
+                printf("%-12s %6.2f%% of pixels differ  %s\n", name.UTF8String, differing * 100, passed ? "ok" : "FAILED");
+                failed += passed ? 0 : 1;
+                compared++;
+
+                if (diff) {
+                    CGImageRef diffImage = CompareCreateDiffImage(diff, (size_t)size.width, (size_t)size.height);
+                    if (diffImage) {
+                        CompareWriteImage(diffImage, [NSURL fileURLWithPath:[diffs stringByAppendingPathComponent:[name stringByAppendingString:@"-diff.png"]]]);
+                        CGImageRelease(diffImage);
+                    }
+                    free(diff);
+                }
+            } else {
+                printf("%-12s could not be rendered\n", name.UTF8String);
+                failed++;
+            }
+
+            free(reference.pixels);
+            free(snapshot.pixels);
+            if (snapshotImage) {
+                CGImageRelease(snapshotImage);
+            }
+            CGImageRelease(referenceImage);
+        }
+
+        printf("%d compared, %d failed\n", compared, failed);
+        return failed ? 1 : 0;
+    }
+}
@@ -0,0 +1,664 @@
+//
+//  ChartColumnConvert.c
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+//  Converts CSV and JSON data sources to column files, see ChartColumnFile.h. Build it on its own:
+//
+//    cc -O2 -I../HighFit ChartColumnConvert.c ../HighFit/ChartColumnFile.c ../HighFit/ChartCSV.c ../HighFit/ChartValueParser.c -o chartcolumns -lm
+//
+//  Usage:
+//
+//    chartcolumns [options] input.csv|input.json output.hccols
+//
+//    -t name     table name of CSV input, "data" by default
+//    -d c        CSV item delimiter, guessed by default
+//    -p c        CSV decimal point, guessed by default
+//    -f format   CSV date format of the first column, deduced by default
+//    -n          the first CSV row holds values, not column names
+//
+//  JSON input is an array of rows, or an object of such arrays which become one table each, like
+//  the HighFit data sources. Rows are objects, arrays or single values.
+//
+
+#include "ChartColumnFile.h"
+#include "ChartCSV.h"
+#include "ChartValueParser.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    char itemDelimiter;
+    char decimalPoint;
+    ChartDateFormat dateFormat;
+    int firstRowAsNames;
+    const char *tableName;
+} ConvertOptions;
+
+// Cells of one column, kept as text until the whole column is known
+typedef struct {
+    char *name;
+    char *bytes;
+    size_t length, capacity;
+    size_t *offsets;
+    size_t count, offsetCapacity;
+} ConvertColumn;
+
+typedef struct {
+    ConvertColumn *columns;
+    size_t count;
+    size_t rows;
+} ConvertTable;
+
+static void *ConvertAllocate(void *pointer, size_t size)
+{
+    void *result = realloc(pointer, size ? size : 1);
+    if (!result) {
+        fprintf(stderr, "chartcolumns: out of memory\n");
+        exit(1);
+    }
+    return result;
+}
+
+static ConvertColumn *ConvertTableColumn(ConvertTable *table, size_t index)
+{
+    while (table->count <= index) {
+        table->columns = ConvertAllocate(table->columns, (table->count + 1) * sizeof(ConvertColumn));
+        memset(&table->columns[table->count], 0, sizeof(ConvertColumn));
+        table->count++;
+    }
+    return &table->columns[index];
+}
+
+static void ConvertColumnSet(ConvertColumn *column, size_t row, const char *bytes, size_t length)
+{
+    // Missing cells of short rows are empty
+    while (column->count <= row) {
+        if (column->count + 1 >= column->offsetCapacity) {
+            column->offsetCapacity = column->offsetCapacity ? column->offsetCapacity * 2 : 1024;
+            column->offsets = ConvertAllocate(column->offsets, column->offsetCapacity * 2 * sizeof(size_t));
+        }
+        column->offsets[column->count * 2] = column->length;
+        column->offsets[column->count * 2 + 1] = 0;
+        column->count++;
+    }
+    if (column->length + length > column->capacity) {
+        while (column->length + length > column->capacity) {
+            column->capacity = column->capacity ? column->capacity * 2 : 4096;
+        }
+        column->bytes = ConvertAllocate(column->bytes, column->capacity);
+    }
+    memcpy(column->bytes + column->length, bytes, length);
+    column->offsets[row * 2] = column->length;
+    column->offsets[row * 2 + 1] = length;
+    column->length += length;
+}
+
+static void ConvertTableFree(ConvertTable *table)
+{
+    size_t c;
+    for (c = 0; c < table->count; c++) {
+        free(table->columns[c].name);
+        free(table->columns[c].bytes);
+        free(table->columns[c].offsets);
+    }
+    free(table->columns);
+    memset(table, 0, sizeof(*table));
+}
+
+#pragma mark - Typing
+
+// Writes a column as numbers when every cell is one, as dates when the first column holds dates,
+// and as strings otherwise, like the data module types its columns
+static int ConvertWriteColumn(ChartColumnFileWriter *writer, long table, ConvertColumn *column, size_t rows, int isX, const ConvertOptions *options)
+{
+    const char **cells = ConvertAllocate(NULL, rows * sizeof(char *));
+    size_t *lengths = ConvertAllocate(NULL, rows * sizeof(size_t));
+    double *values = ConvertAllocate(NULL, rows * sizeof(double));
+    size_t filled = 0, parsed, row;
+    int result;
+
+    for (row = 0; row < rows; row++) {
+        int present = row < column->count && column->offsets[row * 2 + 1];
+        cells[row] = present ? column->bytes + column->offsets[row * 2] : "";
+        lengths[row] = present ? column->offsets[row * 2 + 1] : 0;
+        filled += present;
+    }
+
+    parsed = ChartParseNumbers(cells, lengths, rows, options->decimalPoint, values);
+    if (parsed == filled) {
+        ChartColumnFileType type = ChartColumnFileTypeNumber;
+        for (row = 0; isX && row < rows; row++) {
+            if (values[row] > 31536e6) {
+                type = ChartColumnFileTypeDatetime;
+                break;
+            }
+        }
+        result = ChartColumnFileWriterAddValues(writer, table, column->name, type, values);
+    }
+    else {
+        ChartDateFormat format = options->dateFormat;
+        if (isX && format == ChartDateFormatNone) {
+            format = ChartDetectColumnDateFormat(cells, lengths, rows, 256);
+        }
+        if (isX && ChartParseDates(cells, lengths, rows, format, values) == filled) {
+            result = ChartColumnFileWriterAddValues(writer, table, column->name, ChartColumnFileTypeDatetime, values);
+        }
+        else {
+            result = ChartColumnFileWriterAddStrings(writer, table, column->name, cells, lengths);
+        }
+    }
+
+    free(cells);
+    free(lengths);
+    free(values);
+    return result;
+}
+
+static int ConvertWriteTable(ChartColumnFileWriter *writer, const char *name, ConvertTable *table, const ConvertOptions *options)
+{
+    long index = ChartColumnFileWriterAddTable(writer, name, table->rows);
+    size_t c;
+
+    if (index < 0) {
+        return -1;
+    }
+    for (c = 0; c < table->count; c++) {
+        if (ConvertWriteColumn(writer, index, &table->columns[c], table->rows, c == 0, options) != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+#pragma mark - CSV
+
+typedef struct {
+    ConvertTable *table;
+    int firstRowAsNames;
+} ConvertCSVContext;
+
+static void ConvertCSVCell(void *context, size_t row, size_t column, const char *bytes, size_t length)
+{
+    ConvertCSVContext *csv = context;
+    ConvertColumn *target = ConvertTableColumn(csv->table, column);
+
+    while (length && (*bytes == ' ' || *bytes == '\t')) {
+        bytes++;
+        length--;
+    }
+    while (length && (bytes[length - 1] == ' ' || bytes[length - 1] == '\t')) {
+        length--;
+    }
+    if (csv->firstRowAsNames && row == 0) {
+        free(target->name);
+        target->name = ConvertAllocate(NULL, length + 1);
+        memcpy(target->name, bytes, length);
+        target->name[length] = '\0';
+        return;
+    }
+    row -= csv->firstRowAsNames ? 1 : 0;
+    ConvertColumnSet(target, row, bytes, length);
+    if (row + 1 > csv->table->rows) {
+        csv->table->rows = row + 1;
+    }
+}
+
+static int ConvertCSV(FILE *input, ChartColumnFileWriter *writer, ConvertOptions *options)
+{
+    ConvertTable table = { 0 };
+    ConvertCSVContext context = { &table, options->firstRowAsNames };
+    ChartCSVOptions csvOptions;
+    char buffer[64 * 1024];
+    size_t length;
+    int result = -1;
+
+    ChartCSVOptionsInit(&csvOptions);
+    csvOptions.itemDelimiter = options->itemDelimiter;
+    ChartCSVParser *parser = ChartCSVParserCreate(&csvOptions, ConvertCSVCell, &context);
+    if (!parser) {
+        return -1;
+    }
+    while ((length = fread(buffer, 1, sizeof(buffer), input)) > 0) {
+        if (ChartCSVParserFeed(parser, buffer, length) != 0) {
+            goto done;
+        }
+    }
+    if (ferror(input) || ChartCSVParserFinish(parser) != 0) {
+        goto done;
+    }
+    if (!options->decimalPoint) {
+        options->decimalPoint = ChartCSVParserGuessedDecimalPoint(parser) ? ChartCSVParserGuessedDecimalPoint(parser) : '.';
+    }
+    result = ConvertWriteTable(writer, options->tableName, &table, options);
+
+done:
+    ChartCSVParserDestroy(parser);
+    ConvertTableFree(&table);
+    return result;
+}
+
+#pragma mark - JSON
+
+typedef struct {
+    const char *bytes;
+    size_t length;
+    size_t position;
+    char *text;
+    size_t textLength, textCapacity;
+} ConvertJSON;
+
+static void ConvertJSONFail(ConvertJSON *json, const char *message)
+{
+    fprintf(stderr, "chartcolumns: %s at byte %zu\n", message, json->position);
+    exit(1);
+}
+
+static void ConvertJSONSkipSpace(ConvertJSON *json)
+{
+    while (json->position < json->length) {
+        char c = json->bytes[json->position];
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+            break;
+        }
+        json->position++;
+    }
+}
+
+static char ConvertJSONPeek(ConvertJSON *json)
+{
+    ConvertJSONSkipSpace(json);
+    return json->position < json->length ? json->bytes[json->position] : '\0';
+}
+
+static void ConvertJSONExpect(ConvertJSON *json, char c)
+{
+    if (ConvertJSONPeek(json) != c) {
+        char message[32];
+        snprintf(message, sizeof(message), "expected '%c'", c);
+        ConvertJSONFail(json, message);
+    }
+    json->position++;
+}
+
+static void ConvertJSONAppend(ConvertJSON *json, const char *bytes, size_t length)
+{
+    if (json->textLength + length + 1 > json->textCapacity) {
+        json->textCapacity = (json->textLength + length + 1) * 2;
+        json->text = ConvertAllocate(json->text, json->textCapacity);
+    }
+    memcpy(json->text + json->textLength, bytes, length);
+    json->textLength += length;
+    json->text[json->textLength] = '\0';
+}
+
+static void ConvertJSONAppendCodePoint(ConvertJSON *json, unsigned long code)
+{
+    char bytes[4];
+    size_t length;
+
+    if (code < 0x80) {
+        bytes[0] = (char)code;
+        length = 1;
+    }
+    else if (code < 0x800) {
+        bytes[0] = (char)(0xC0 | (code >> 6));
+        bytes[1] = (char)(0x80 | (code & 0x3F));
+        length = 2;
+    }
+    else if (code < 0x10000) {
+        bytes[0] = (char)(0xE0 | (code >> 12));
+        bytes[1] = (char)(0x80 | ((code >> 6) & 0x3F));
+        bytes[2] = (char)(0x80 | (code & 0x3F));
+        length = 3;
+    }
+    else {
+        bytes[0] = (char)(0xF0 | (code >> 18));
+        bytes[1] = (char)(0x80 | ((code >> 12) & 0x3F));
+        bytes[2] = (char)(0x80 | ((code >> 6) & 0x3F));
+        bytes[3] = (char)(0x80 | (code & 0x3F));
+        length = 4;
+    }
+    ConvertJSONAppend(json, bytes, length);
+}
+
+static unsigned long ConvertJSONHex(ConvertJSON *json)
+{
+    unsigned long code = 0;
+    size_t i;
+
+    if (json->position + 4 > json->length) {
+        ConvertJSONFail(json, "short escape");
+    }
+    for (i = 0; i < 4; i++) {
+        char c = json->bytes[json->position++];
+        code <<= 4;
+        if (c >= '0' && c <= '9') {
+            code |= (unsigned long)(c - '0');
+        }
+        else if (c >= 'a' && c <= 'f') {
+            code |= (unsigned long)(c - 'a' + 10);
+        }
+        else if (c >= 'A' && c <= 'F') {
+            code |= (unsigned long)(c - 'A' + 10);
+        }
+        else {
+            ConvertJSONFail(json, "bad escape");
+        }
+    }
+    return code;
+}
+
+// Reads a string into json->text
+static void ConvertJSONString(ConvertJSON *json)
+{
+    ConvertJSONExpect(json, '"');
+    json->textLength = 0;
+    ConvertJSONAppend(json, "", 0);
+
+    while (json->position < json->length) {
+        size_t start = json->position;
+        while (json->position < json->length && json->bytes[json->position] != '"' && json->bytes[json->position] != '\\') {
+            json->position++;
+        }
+        ConvertJSONAppend(json, json->bytes + start, json->position - start);
+        if (json->position >= json->length) {
+            break;
+        }
+        if (json->bytes[json->position++] == '"') {
+            return;
+        }
+        if (json->position >= json->length) {
+            break;
+        }
+        char escape = json->bytes[json->position++];
+        switch (escape) {
+            case 'b': ConvertJSONAppend(json, "\b", 1); break;
+            case 'f': ConvertJSONAppend(json, "\f", 1); break;
+            case 'n': ConvertJSONAppend(json, "\n", 1); break;
+            case 'r': ConvertJSONAppend(json, "\r", 1); break;
+            case 't': ConvertJSONAppend(json, "\t", 1); break;
+            case 'u': {
+                unsigned long code = ConvertJSONHex(json);
+                if (code >= 0xD800 && code < 0xDC00 && json->position + 1 < json->length &&
+                    json->bytes[json->position] == '\\' && json->bytes[json->position + 1] == 'u') {
+                    json->position += 2;
+                    code = 0x10000 + ((code - 0xD800) << 10) + (ConvertJSONHex(json) - 0xDC00);
+                }
+                ConvertJSONAppendCodePoint(json, code);
+                break;
+            }
+            default: ConvertJSONAppend(json, &escape, 1); break;
+        }
+    }
+    ConvertJSONFail(json, "unterminated string");
+}
+
+// Skips any value, for nested objects and arrays that do not fit a column
+static void ConvertJSONSkip(ConvertJSON *json)
+{
+    char c = ConvertJSONPeek(json);
+    if (c == '"') {
+        ConvertJSONString(json);
+    }
+    else if (c == '{' || c == '[') {
+        char close = c == '{' ? '}' : ']';
+        json->position++;
+        if (ConvertJSONPeek(json) == close) {
+            json->position++;
+            return;
+        }
+        while (1) {
+            if (c == '{') {
+                ConvertJSONString(json);
+                ConvertJSONExpect(json, ':');
+            }
+            ConvertJSONSkip(json);
+            if (ConvertJSONPeek(json) == ',') {
+                json->position++;
+                continue;
+            }
+            ConvertJSONExpect(json, close);
+            return;
+        }
+    }
+    else {
+        while (json->position < json->length && strchr(",]} \t\r\n", json->bytes[json->position]) == NULL) {
+            json->position++;
+        }
+    }
+}
+
+// Stores a scalar as its text, typed with the rest of its column later
+static void ConvertJSONCell(ConvertJSON *json, ConvertTable *table, size_t columnIndex, size_t row)
+{
+    ConvertColumn *column = ConvertTableColumn(table, columnIndex);
+    char c = ConvertJSONPeek(json);
+
+    if (c == '"') {
+        ConvertJSONString(json);
+        ConvertColumnSet(column, row, json->text, json->textLength);
+    }
+    else if (c == '{' || c == '[') {
+        // Nested values do not fit in a cell
+        ConvertJSONSkip(json);
+    }
+    else {
+        size_t start = json->position;
+        ConvertJSONSkip(json);
+        size_t length = json->position - start;
+        if (length == 4 && memcmp(json->bytes + start, "null", 4) == 0) {
+            return;
+        }
+        ConvertColumnSet(column, row, json->bytes + start, length);
+    }
+}
+
+static size_t ConvertJSONColumnIndex(ConvertTable *table, const char *name)
+{
+    size_t c;
+    for (c = 0; c < table->count; c++) {
+        if (table->columns[c].name && strcmp(table->columns[c].name, name) == 0) {
+            return c;
+        }
+    }
+    ConvertColumn *column = ConvertTableColumn(table, table->count);
+    column->name = strdup(name);
+    return table->count - 1;
+}
+
+static void ConvertJSONRows(ConvertJSON *json, ConvertTable *table)
+{
+    size_t row = 0;
+
+    ConvertJSONExpect(json, '[');
+    if (ConvertJSONPeek(json) == ']') {
+        json->position++;
+        return;
+    }
+    while (1) {
+        char c = ConvertJSONPeek(json);
+        if (c == '{') {
+            json->position++;
+            if (ConvertJSONPeek(json) != '}') {
+                while (1) {
+                    ConvertJSONString(json);
+                    size_t column = ConvertJSONColumnIndex(table, json->text);
+                    ConvertJSONExpect(json, ':');
+                    ConvertJSONCell(json, table, column, row);
+                    if (ConvertJSONPeek(json) == ',') {
+                        json->position++;
+                        continue;
+                    }
+                    break;
+                }
+            }
+            ConvertJSONExpect(json, '}');
+        }
+        else if (c == '[') {
+            size_t column = 0;
+            json->position++;
+            if (ConvertJSONPeek(json) != ']') {
+                while (1) {
+                    if (column >= table->count) {
+                        char name[24];
+                        snprintf(name, sizeof(name), "%zu", column);
+                        ConvertTableColumn(table, column)->name = strdup(name);
+                    }
+                    ConvertJSONCell(json, table, column++, row);
+                    if (ConvertJSONPeek(json) == ',') {
+                        json->position++;
+                        continue;
+                    }
+                    break;
+                }
+            }
+            ConvertJSONExpect(json, ']');
+        }
+        else {
+            if (table->count == 0) {
+                ConvertTableColumn(table, 0)->name = strdup("value");
+            }
+            ConvertJSONCell(json, table, 0, row);
+        }
+        row++;
+        if (ConvertJSONPeek(json) == ',') {
+            json->position++;
+            continue;
+        }
+        ConvertJSONExpect(json, ']');
+        break;
+    }
+    table->rows = row;
+}
+
+static int ConvertJSONInput(FILE *input, ChartColumnFileWriter *writer, ConvertOptions *options)
+{
+    ConvertJSON json = { 0 };
+    char *bytes = NULL;
+    size_t length = 0, capacity = 0, read;
+    int result = 0;
+
+    do {
+        if (length + 65536 > capacity) {
+            capacity = (length + 65536) * 2;
+            bytes = ConvertAllocate(bytes, capacity);
+        }
+        read = fread(bytes + length, 1, capacity - length, input);
+        length += read;
+    } while (read > 0);
+
+    json.bytes = bytes;
+    json.length = length;
+    if (!options->decimalPoint) {
+        options->decimalPoint = '.';
+    }
+
+    if (ConvertJSONPeek(&json) == '[') {
+        ConvertTable table = { 0 };
+        ConvertJSONRows(&json, &table);
+        result = ConvertWriteTable(writer, options->tableName, &table, options);
+        ConvertTableFree(&table);
+    }
+    else {
+        ConvertJSONExpect(&json, '{');
+        while (result == 0 && ConvertJSONPeek(&json) == '"') {
+            ConvertJSONString(&json);
+            char *name = strdup(json.text);
+            ConvertJSONExpect(&json, ':');
+            // Only arrays become tables, other members are dropped
+            if (ConvertJSONPeek(&json) == '[') {
+                ConvertTable table = { 0 };
+                ConvertJSONRows(&json, &table);
+                result = ConvertWriteTable(writer, name, &table, options);
+                ConvertTableFree(&table);
+            }
+            else {
+                ConvertJSONSkip(&json);
+            }
+            free(name);
+            if (ConvertJSONPeek(&json) == ',') {
+                json.position++;
+            }
+        }
+        ConvertJSONExpect(&json, '}');
+    }
+
+    free(json.text);
+    free(bytes);
+    return result;
+}
+
+#pragma mark - Main
+
+static void ConvertUsage(void)
+{
+    fprintf(stderr, "usage: chartcolumns [-t table] [-d delimiter] [-p decimal point] [-f date format] [-n] input output\n");
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    ConvertOptions options = { 0, 0, ChartDateFormatNone, 1, "data" };
+    ChartColumnFileWriter *writer;
+    FILE *input;
+    const char *extension;
+    int i, result;
+
+    for (i = 1; i < argc && argv[i][0] == '-' && argv[i][1]; i++) {
+        char flag = argv[i][1];
+        if (flag == 'n') {
+            options.firstRowAsNames = 0;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            ConvertUsage();
+        }
+        const char *value = argv[++i];
+        switch (flag) {
+            case 't': options.tableName = value; break;
+            case 'd': options.itemDelimiter = strcmp(value, "\\t") == 0 ? '\t' : value[0]; break;
+            case 'p': options.decimalPoint = value[0]; break;
+            case 'f':
+                options.dateFormat = ChartDateFormatFromString(value);
+                if (options.dateFormat == ChartDateFormatNone) {
+                    fprintf(stderr, "chartcolumns: unknown date format %s\n", value);
+                    return 2;
+                }
+                break;
+            default: ConvertUsage();
+        }
+    }
+    if (argc - i != 2) {
+        ConvertUsage();
+    }
+
+    input = strcmp(argv[i], "-") == 0 ? stdin : fopen(argv[i], "rb");
+    if (!input) {
+        perror(argv[i]);
+        return 1;
+    }
+    writer = ChartColumnFileWriterCreate();
+    extension = strrchr(argv[i], '.');
+    if (extension && strcmp(extension, ".json") == 0) {
+        result = ConvertJSONInput(input, writer, &options);
+    }
+    else {
+        result = ConvertCSV(input, writer, &options);
+    }
+    if (input != stdin) {
+        fclose(input);
+    }
+
+    if (result == 0 && ChartColumnFileWriterWrite(writer, argv[i + 1]) != ChartColumnFileOK) {
+        perror(argv[i + 1]);
+        result = -1;
+    }
+    ChartColumnFileWriterDestroy(writer);
+    return result == 0 ? 0 : 1;
+}
@@ -0,0 +1,198 @@
+//
+//  chart-batch-export.js
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+//  Renders the jobs of a batch manifest, see ChartBatchExporter.h, through a pool of pages of
+//  chart-page-runtime.js in worker threads, and prints throughput like the exporter's metrics.
+//  Core Graphics is not available off the device, so every job is written as SVG: PNG, JPEG and
+//  PDF jobs get the extension of their output replaced with .svg.
+//
+//  Usage:
+//
+//    node chart-batch-export.js [options] manifest.json
+//
+//    -j count    pages rendering at once, 4 by default
+//    -b path     the chart bundle, the one of the development framework by default
+//
+
+'use strict';
+
+var fs = require('fs');
+var path = require('path');
+var threads = require('worker_threads');
+
+var DEFAULT_BUNDLE = path.join(__dirname, '../../../../development/Highcharts.framework/com.highcharts.charts.bundle');
+
+if (!threads.isMainThread) {
+    // A page renders one job at a time for the main thread
+    var page = require('./chart-page-runtime').createPage(threads.workerData.bundle, threads.workerData.plugins);
+    threads.parentPort.on('message', function (job) {
+        var start = process.hrtime();
+        // Series labels and other deferred drawing are in the SVG once the page timers have run
+        page.renderSettled(job.options, job.width, job.height, function (error, svg) {
+            var time = process.hrtime(start);
+            threads.parentPort.postMessage({
+                index: job.index,
+                svg: svg,
+                error: error ? String(error && error.stack || error) : undefined,
+                milliseconds: time[0] * 1e3 + time[1] / 1e6
+            });
+        });
+    });
+    return;
+}
+
+function usage() {
+    process.stderr.write('usage: node chart-batch-export.js [-j count] [-b bundle] manifest.json\n');
+    process.exit(2);
+}
+
+function parseArguments(argv) {
+    var args = { pages: 4, bundle: DEFAULT_BUNDLE },
+        i;
+    for (i = 0; i < argv.length; i++) {
+        if (argv[i] === '-j' && i + 1 < argv.length) {
+            args.pages = Math.max(1, parseInt(argv[++i], 10) || 1);
+        } else if (argv[i] === '-b' && i + 1 < argv.length) {
+            args.bundle = argv[++i];
+        } else if (argv[i].charAt(0) === '-' || args.manifest) {
+            usage();
+        } else {
+            args.manifest = argv[i];
+        }
+    }
+    if (!args.manifest) {
+        usage();
+    }
+    return args;
+}
+
+function percentile(sorted, fraction) {
+    return sorted.length ? sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * fraction))] : 0;
+}
+
+function main() {
+    var args = parseArguments(process.argv.slice(2)),
+        manifest = JSON.parse(fs.readFileSync(args.manifest, 'utf8')),
+        base = path.dirname(path.resolve(args.manifest)),
+        jobs = manifest.jobs || [],
+        next = 0,
+        finished = 0,
+        failed = 0,
+        bytes = 0,
+        times = [],
+        start = Date.now(),
+        pageCount = Math.min(args.pages, Math.max(jobs.length, 1)),
+        workers = [],
+        plugins,
+        i;
+
+    function output(job) {
+        var file = path.resolve(base, job.output);
+        if ((job.format || 'png').toLowerCase() !== 'svg') {
+            file = file.slice(0, file.length - path.extname(file).length) + '.svg';
+        }
+        return file;
+    }
+
+    function report() {
+        var elapsed = (Date.now() - start) / 1000,
+            sorted = times.slice().sort(function (a, b) {
+                return a - b;
+            }),
+            mean = times.reduce(function (sum, time) {
+                return sum + time;
+            }, 0) / (times.length || 1);
+        process.stdout.write(
+            'charts: ' + (finished - failed) + ' exported, ' + failed + ' failed\n' +
+            'pages: ' + pageCount + '\n' +
+            'elapsed: ' + elapsed.toFixed(2) + ' s\n' +
+            'throughput: ' + (elapsed ? (finished - failed) / elapsed : 0).toFixed(1) + ' charts/s\n' +
+            'render: ' + mean.toFixed(1) + ' ms mean, ' + percentile(sorted, 0.95).toFixed(1) + ' ms p95\n' +
+            'output: ' + (bytes / 1024).toFixed(0) + ' KB\n'
+        );
+        workers.forEach(function (worker) {
+            worker.terminate();
+        });
+        process.exitCode = failed ? 1 : 0;
+    }
+
+    function feed(worker) {
+        var job;
+        worker.jobIndex = undefined;
+        if (next >= jobs.length) {
+            return;
+        }
+        job = jobs[next];
+        worker.jobIndex = next;
+        worker.postMessage({
+            index: next++,
+            options: job.options || {},
+            width: job.width || 600,
+            height: job.height || 400
+        });
+    }
+
+    function finish(worker, job, result) {
+        var file;
+        finished++;
+        if (result.error || !result.svg) {
+            failed++;
+            process.stderr.write(job.output + ': ' + (result.error || 'no SVG') + '\n');
+        } else {
+            file = output(job);
+            fs.mkdirSync(path.dirname(file), { recursive: true });
+            fs.writeFileSync(file, result.svg);
+            bytes += Buffer.byteLength(result.svg);
+            times.push(result.milliseconds);
+        }
+        if (finished === jobs.length) {
+            report();
+        } else {
+            feed(worker);
+        }
+    }
+
+    function startWorker() {
+        var worker = new threads.Worker(__filename, {
+            workerData: { bundle: args.bundle, plugins: plugins }
+        });
+        workers.push(worker);
+        worker.on('message', function (result) {
+            finish(worker, jobs[result.index], result);
+        });
+        worker.on('error', function (error) {
+            var index = worker.jobIndex;
+            error = String(error && error.stack || error);
+            // A page that fails to load fails every job, an error while rendering only its job
+            if (index === undefined) {
+                process.stderr.write('page failed to load: ' + error + '\n');
+                process.exit(1);
+            }
+            workers.splice(workers.indexOf(worker), 1);
+            finish(startWorker(), jobs[index], { error: error });
+        });
+        return worker;
+    }
+
+    if (!jobs.length) {
+        report();
+        return;
+    }
+
+    // Like the pages of ChartBatchExporter, which serialize the chart they have just built
+    plugins = (manifest.plugins || []).slice();
+    ['exporting', 'exporting-live'].forEach(function (plugin) {
+        if (plugins.indexOf(plugin) === -1) {
+            plugins.push(plugin);
+        }
+    });
+    for (i = 0; i < pageCount; i++) {
+        feed(startWorker());
+    }
+}
+
+main();
@@ -0,0 +1,454 @@
+//
+//  chart-bundle-build.js
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+//  Writes a copy of Highcharts.framework whose chart bundle only holds what an app uses. The
+//  bundle ships every module, theme, font and sample graphic, the styled mode tree under js/js
+//  and the scripts for old browsers, most of which an app never loads. The copy keeps the core
+//  scripts, the modules of the series types and plugins the app uses with the modules they
+//  require, the themes it sets with their fonts and graphics, and regenerates Charts.plist and
+//  Plugins.plist to list just those modules. Run it as a build phase and embed the copy instead
+//  of the full framework.
+//
+//  Usage:
+//
+//    node chart-bundle-build.js [options] output/Highcharts.framework
+//
+//    -c path     a JSON configuration, see below
+//    -t types    series types, comma separated
+//    -p plugins  plugins, as the plugins of a chart view
+//    -T themes   themes, as the theme of a chart view
+//    -s path     options, or a batch manifest, to read the series types and plugins of
+//    -f path     the framework to trim, the development framework by default
+//    -n          print what would be kept without writing anything
+//
+//  The configuration names the same sets, each one optional:
+//
+//    { "types": ["heatmap", "sankey"], "plugins": ["exporting"], "themes": ["dark-unica"],
+//      "fonts": ["Dosis"], "graphics": ["earth.svg"], "styledMode": false, "scan": ["charts.json"] }
+//
+//  Types of the core scripts, like line, column, pie, arearange or scatter3d, need no module.
+//  The framework is signed again when Xcode embeds it, so the copy has no _CodeSignature.
+//
+
+'use strict';
+
+var fs = require('fs');
+var path = require('path');
+
+var DEFAULT_FRAMEWORK = path.join(__dirname, '../../../../development/Highcharts.framework');
+var BUNDLE = 'com.highcharts.charts.bundle';
+
+// Loaded by the chart page whatever the chart, so never dropped
+var CORE_FILES = [
+    'highcharts.html',
+    'js/highcharts.js',
+    'js/highcharts-more.js',
+    'js/highcharts-3d.js'
+];
+
+// Series types and the modules defining them, types of the core scripts map to no module
+var TYPE_MODULES = {
+    line: [], spline: [], area: [], areaspline: [], column: [], bar: [], scatter: [], pie: [],
+    arearange: [], areasplinerange: [], columnrange: [], gauge: [], boxplot: [], errorbar: [],
+    waterfall: [], polygon: [], bubble: [], scatter3d: [],
+    bellcurve: ['histogram-bellcurve'],
+    bullet: ['bullet'],
+    candlestick: ['stock'],
+    flags: ['stock'],
+    funnel: ['funnel'],
+    heatmap: ['heatmap'],
+    histogram: ['histogram-bellcurve'],
+    item: ['item-series'],
+    ohlc: ['stock'],
+    pareto: ['pareto'],
+    pyramid: ['funnel'],
+    sankey: ['sankey'],
+    solidgauge: ['solid-gauge'],
+    streamgraph: ['streamgraph'],
+    sunburst: ['sunburst'],
+    tilemap: ['tilemap'],
+    treemap: ['treemap'],
+    variablepie: ['variable-pie'],
+    variwide: ['variwide'],
+    vector: ['vector'],
+    windbarb: ['windbarb'],
+    wordcloud: ['wordcloud'],
+    xrange: ['xrange']
+};
+
+// Modules that only work on top of others, loaded after them
+var MODULE_REQUIRES = {
+    'data-incremental': ['data'],
+    'export-data': ['exporting'],
+    'exporting-live': ['exporting'],
+    'offline-exporting': ['exporting'],
+    'offline-exporting-wrap': ['offline-exporting']
+};
+
+// Files modules fetch at run time, relative to the bundle
+var MODULE_FILES = {
+    'offline-exporting': ['js/lib/canvg.js', 'js/lib/jspdf.js', 'js/lib/rgbcolor.js', 'js/lib/svg2pdf.js'],
+    oldie: ['gfx/vml-radial-gradient.png']
+};
+
+// Fonts and graphics of the themes, in place of the ones they link from the web
+var THEME_FILES = {
+    'dark-unica': ['css/Unica-One.css'],
+    'grid-light': ['css/Dosis.css'],
+    'sand-signika': ['css/Signika.css', 'graphics/sand.png'],
+    skies: ['graphics/skies.jpg']
+};
+
+// Option keys that load a module by themselves, as drilldown does in Charts.plist
+var OPTION_MODULES = {
+    data: 'data',
+    drilldown: 'drilldown',
+    exporting: 'exporting',
+    noData: 'no-data-to-display'
+};
+
+function usage() {
+    process.stderr.write('usage: node chart-bundle-build.js [-c config] [-t types] [-p plugins] [-T themes] [-s options] [-f framework] [-n] output\n');
+    process.exit(2);
+}
+
+function fail(message) {
+    process.stderr.write('chart-bundle-build: ' + message + '\n');
+    process.exit(1);
+}
+
+function list(value) {
+    return value.split(',').map(function (item) {
+        return item.trim();
+    }).filter(Boolean);
+}
+
+function parseArguments(argv) {
+    var config = { types: [], plugins: [], themes: [], fonts: [], graphics: [], scan: [] },
+        args = { framework: DEFAULT_FRAMEWORK, config: config },
+        loaded,
+        i;
+
+    function value() {
+        if (i + 1 >= argv.length) {
+            usage();
+        }
+        return argv[++i];
+    }
+
+    for (i = 0; i < argv.length; i++) {
+        switch (argv[i]) {
+            case '-c':
+                loaded = JSON.parse(fs.readFileSync(value(), 'utf8'));
+                Object.keys(config).forEach(function (key) {
+                    config[key] = config[key].concat(loaded[key] || []);
+                });
+                config.styledMode = config.styledMode || !!loaded.styledMode;
+                break;
+            case '-t':
+                config.types = config.types.concat(list(value()));
+                break;
+            case '-p':
+                config.plugins = config.plugins.concat(list(value()));
+                break;
+            case '-T':
+                config.themes = config.themes.concat(list(value()));
+                break;
+            case '-s':
+                config.scan.push(value());
+                break;
+            case '-f':
+                args.framework = value();
+                break;
+            case '-n':
+                args.dryRun = true;
+                break;
+            default:
+                if (argv[i].charAt(0) === '-' || args.output) {
+                    usage();
+                }
+                args.output = argv[i];
+        }
+    }
+    if (!args.output && !args.dryRun) {
+        usage();
+    }
+    return args;
+}
+
+/**
+ * Adds the series types and option modules of chart options to the configuration. A batch
+ * manifest is read job by job, any other JSON as options or an array of them.
+ */
+function scanOptions(options, config) {
+    if (Array.isArray(options)) {
+        options.forEach(function (item) {
+            scanOptions(item, config);
+        });
+        return;
+    }
+    if (!options || typeof options !== 'object') {
+        return;
+    }
+    if (options.jobs) {
+        (options.plugins || []).forEach(function (plugin) {
+            config.plugins.push(plugin);
+        });
+        scanOptions(options.jobs.map(function (job) {
+            return job.options;
+        }), config);
+        return;
+    }
+    if (options.chart && options.chart.type) {
+        config.types.push(options.chart.type);
+    }
+    [].concat(options.series || [], (options.drilldown && options.drilldown.series) || []).forEach(function (series) {
+        if (series && series.type) {
+            config.types.push(series.type);
+        }
+    });
+    Object.keys(OPTION_MODULES).forEach(function (key) {
+        if (options[key] && options[key].enabled !== false) {
+            config.plugins.push(OPTION_MODULES[key]);
+        }
+    });
+}
+
+function unique(items) {
+    return items.filter(function (item, i) {
+        return items.indexOf(item) === i;
+    });
+}
+
+/**
+ * A module after the modules it requires.
+ */
+function withRequirements(module, into) {
+    into = into || [];
+    (MODULE_REQUIRES[module] || []).forEach(function (required) {
+        withRequirements(required, into);
+    });
+    if (into.indexOf(module) === -1) {
+        into.push(module);
+    }
+    return into;
+}
+
+/**
+ * Resolves the configuration to the files of the bundle to keep and the entries of the plists.
+ */
+function plan(bundle, config) {
+    var keep = CORE_FILES.slice(),
+        charts = {},
+        plugins = {},
+        modules = [],
+        css = [];
+
+    function exists(file) {
+        return fs.existsSync(path.join(bundle, file));
+    }
+
+    function addModules(names) {
+        names.forEach(function (name) {
+            if (!exists('js/modules/' + name + '.js')) {
+                fail('no module ' + name + ' in ' + bundle);
+            }
+            if (modules.indexOf(name) === -1) {
+                modules.push(name);
+            }
+        });
+    }
+
+    unique(config.types).forEach(function (type) {
+        var required = [];
+        if (!TYPE_MODULES.hasOwnProperty(type)) {
+            fail('unknown series type ' + type);
+        }
+        TYPE_MODULES[type].forEach(function (module) {
+            withRequirements(module, required);
+        });
+        addModules(required);
+        if (required.length) {
+            charts[type] = required;
+        }
+    });
+    unique(config.plugins).forEach(function (plugin) {
+        var required = withRequirements(plugin);
+        addModules(required);
+        plugins[plugin] = required;
+        // Loaded for the option key without the chart view asking, as the original Charts.plist
+        if (plugin === 'drilldown') {
+            charts.drilldown = required;
+        }
+    });
+
+    modules.forEach(function (module) {
+        keep.push('js/modules/' + module + '.js');
+        keep = keep.concat(MODULE_FILES[module] || []);
+    });
+
+    unique(config.themes).forEach(function (theme) {
+        if (!exists('js/themes/' + theme + '.js')) {
+            fail('no theme ' + theme + ' in ' + bundle);
+        }
+        keep.push('js/themes/' + theme + '.js');
+        keep = keep.concat(THEME_FILES[theme] || []);
+    });
+    unique(config.fonts).forEach(function (font) {
+        var file = 'css/' + font.replace(/ /g, '-') + '.css';
+        if (!exists(file)) {
+            fail('no font ' + font + ' in ' + bundle);
+        }
+        keep.push(file);
+    });
+    unique(config.graphics).forEach(function (graphic) {
+        keep.push('graphics/' + graphic);
+    });
+
+    // Font files come with the style sheets declaring them
+    keep.forEach(function (file) {
+        if (/\.css$/.test(file)) {
+            css.push(file);
+        }
+    });
+    css.forEach(function (file) {
+        var source = fs.readFileSync(path.join(bundle, file), 'utf8'),
+            pattern = /url\(\s*['"]?([^'")]+)['"]?\s*\)/g,
+            match;
+        while ((match = pattern.exec(source))) {
+            if (!/^[a-z]+:/i.test(match[1])) {
+                keep.push(path.posix.normalize(path.posix.join(path.posix.dirname(file), match[1])));
+            }
+        }
+    });
+
+    // Styled mode loads the same scripts from js/js with the style sheet in place of themes.
+    // A module without a styled copy, like canvas-series that draws with the presentational
+    // attributes of the classic build, cannot run there.
+    if (config.styledMode) {
+        keep.forEach(function (file) {
+            if (/^js\/(highcharts[^/]*|modules\/[^/]+|themes\/[^/]+)\.js$/.test(file)) {
+                if (!exists('js/' + file)) {
+                    fail('no styled copy of ' + file + ' in ' + bundle + ', it cannot be used in styled mode');
+                }
+                keep.push('js/' + file);
+            }
+        });
+        keep.push('js/css/highcharts.css');
+    }
+
+    keep = unique(keep);
+    keep.forEach(function (file) {
+        if (!exists(file)) {
+            fail('no file ' + file + ' in ' + bundle);
+        }
+    });
+    return { files: keep.sort(), charts: charts, plugins: plugins };
+}
+
+function escapeXML(text) {
+    return String(text).replace(/&/g, '&amp;').replace(/</g, '&lt;').replace(/>/g, '&gt;');
+}
+
+/**
+ * A property list of string arrays by key, as Charts.plist and Plugins.plist hold.
+ */
+function propertyList(entries) {
+    var lines = [
+        '<?xml version="1.0" encoding="UTF-8"?>',
+        '<!DOCTYPE plist PUBLIC "-//Apple//DTD PLIST 1.0//EN" "http://www.apple.com/DTDs/PropertyList-1.0.dtd">',
+        '<plist version="1.0">',
+        '<dict>'
+    ];
+    Object.keys(entries).sort().forEach(function (key) {
+        lines.push('\t<key>' + escapeXML(key) + '</key>');
+        lines.push('\t<array>');
+        entries[key].forEach(function (value) {
+            lines.push('\t\t<string>' + escapeXML(value) + '</string>');
+        });
+        lines.push('\t</array>');
+    });
+    lines.push('</dict>', '</plist>', '');
+    return lines.join('\n');
+}
+
+function walk(directory, base, into) {
+    into = into || [];
+    fs.readdirSync(directory).forEach(function (name) {
+        var file = path.join(directory, name),
+            relative = base ? base + '/' + name : name;
+        if (fs.statSync(file).isDirectory()) {
+            walk(file, relative, into);
+        } else {
+            into.push(relative);
+        }
+    });
+    return into;
+}
+
+function size(directory, files) {
+    return files.reduce(function (sum, file) {
+        return sum + fs.statSync(path.join(directory, file)).size;
+    }, 0);
+}
+
+function kilobytes(bytes) {
+    return (bytes / 1024).toFixed(0) + ' KB';
+}
+
+function main() {
+    var args = parseArguments(process.argv.slice(2)),
+        config = args.config,
+        bundle = path.join(args.framework, BUNDLE),
+        output = args.output,
+        all,
+        result,
+        before,
+        after;
+
+    if (!fs.existsSync(bundle)) {
+        fail('no ' + BUNDLE + ' in ' + args.framework);
+    }
+    config.scan.forEach(function (file) {
+        scanOptions(JSON.parse(fs.readFileSync(file, 'utf8')), config);
+    });
+    result = plan(bundle, config);
+    all = walk(bundle, '');
+    before = size(bundle, all);
+    after = size(bundle, result.files);
+
+    if (args.dryRun) {
+        process.stdout.write(result.files.join('\n') + '\n');
+    } else {
+        if (path.resolve(output) === path.resolve(args.framework)) {
+            fail('the output would replace the framework');
+        }
+        fs.rmSync(output, { recursive: true, force: true });
+        fs.mkdirSync(output, { recursive: true });
+        fs.readdirSync(args.framework).forEach(function (name) {
+            if (name !== BUNDLE && name !== '_CodeSignature') {
+                fs.cpSync(path.join(args.framework, name), path.join(output, name), { recursive: true });
+            }
+        });
+        result.files.forEach(function (file) {
+            var target = path.join(output, BUNDLE, file);
+            fs.mkdirSync(path.dirname(target), { recursive: true });
+            fs.copyFileSync(path.join(bundle, file), target);
+        });
+        fs.writeFileSync(path.join(output, 'Charts.plist'), propertyList(result.charts));
+        fs.writeFileSync(path.join(output, 'Plugins.plist'), propertyList(result.plugins));
+    }
+
+    process.stdout.write(
+        'Charts.plist: ' + (Object.keys(result.charts).join(', ') || 'empty') + '\n' +
+        'Plugins.plist: ' + (Object.keys(result.plugins).join(', ') || 'empty') + '\n' +
+        'bundle: ' + result.files.length + ' of ' + all.length + ' files, ' +
+            kilobytes(after) + ' of ' + kilobytes(before) + ' (' + (100 - after / before * 100).toFixed(0) + '% smaller)\n'
+    );
+}
+
+main();
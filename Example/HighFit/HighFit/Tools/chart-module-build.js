@@ -0,0 +1,429 @@
+//
+//  chart-module-build.js
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+//  Builds the modules of the chart bundle that were changed from the Highcharts distribution
+//  from their readable sources in Modules. The bundle ships minified scripts like the rest of
+//  Highcharts JS v6.0.2, so the sources stay out of it: Modules/modules holds the classic sources
+//  and Modules/js/modules the styled ones, as <module>.src.js. Each source starts with the license
+//  banner of the distribution, which is kept as it is, and the code after it is minified:
+//  comments and whitespace are dropped and the variables and functions local to a function are
+//  renamed. The result is parsed again and checked against the source, so a build never ships
+//  a script that does something else.
+//
+//  Usage:
+//
+//    node chart-module-build.js [options] [modules]
+//
+//    -f path     the framework to write to, the development framework by default
+//    -n          check the sources without writing anything
+//
+//  Without modules, every source in Modules is built. Needs esprima from npm:
+//
+//    npm install esprima
+//
+//  Copy the development framework to the others afterwards, like any change of the bundle.
+//
+
+'use strict';
+
+var fs = require('fs');
+var path = require('path');
+var esprima;
+
+var DEFAULT_FRAMEWORK = path.join(__dirname, '../../../../development/Highcharts.framework');
+var BUNDLE = 'com.highcharts.charts.bundle';
+var SOURCES = path.join(__dirname, '../Modules');
+
+// Source directories under Modules and where their modules go in the bundle
+var TREES = [
+    { sources: 'modules', bundle: 'js/modules' },
+    { sources: 'js/modules', bundle: 'js/js/modules' }
+];
+
+// Lines are broken after a comma or semicolon past this length, as the distribution does
+var LINE_LENGTH = 500;
+
+var RESERVED = [
+    'break', 'case', 'catch', 'class', 'const', 'continue', 'debugger', 'default', 'delete', 'do',
+    'else', 'enum', 'export', 'extends', 'false', 'finally', 'for', 'function', 'if', 'implements',
+    'import', 'in', 'instanceof', 'interface', 'let', 'new', 'null', 'package', 'private',
+    'protected', 'public', 'return', 'static', 'super', 'switch', 'this', 'throw', 'true', 'try',
+    'typeof', 'var', 'void', 'while', 'with', 'yield', 'await', 'arguments', 'eval', 'undefined',
+    'NaN', 'Infinity'
+];
+
+var FIRST_CHARS = 'abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_$';
+var NEXT_CHARS = FIRST_CHARS + '0123456789';
+
+function usage() {
+    process.stderr.write('usage: node chart-module-build.js [-f framework] [-n] [modules]\n');
+    process.exit(2);
+}
+
+function fail(message) {
+    process.stderr.write('chart-module-build: ' + message + '\n');
+    process.exit(1);
+}
+
+function parseArguments(argv) {
+    var args = { framework: DEFAULT_FRAMEWORK, modules: [] },
+        i;
+    for (i = 0; i < argv.length; i++) {
+        if (argv[i] === '-f' && i + 1 < argv.length) {
+            args.framework = argv[++i];
+        } else if (argv[i] === '-n') {
+            args.dryRun = true;
+        } else if (argv[i].charAt(0) === '-') {
+            usage();
+        } else {
+            args.modules.push(argv[i].replace(/(\.src)?\.js$/, ''));
+        }
+    }
+    return args;
+}
+
+/**
+ * Short names in order, a to $, then aa to $$, skipping reserved words.
+ */
+function nameAt(index) {
+    var name = FIRST_CHARS.charAt(index % FIRST_CHARS.length);
+    index = Math.floor(index / FIRST_CHARS.length);
+    while (index > 0) {
+        index -= 1;
+        name += NEXT_CHARS.charAt(index % NEXT_CHARS.length);
+        index = Math.floor(index / NEXT_CHARS.length);
+    }
+    return name;
+}
+
+function createScope(parent, node, isFunction) {
+    var scope = {
+        parent: parent,
+        node: node,
+        isFunction: isFunction,
+        bindings: Object.create(null),
+        children: [],
+        // Bindings of outer scopes referenced in this scope or below it
+        outer: []
+    };
+    if (parent) {
+        parent.children.push(scope);
+    }
+    return scope;
+}
+
+function functionScope(scope) {
+    while (!scope.isFunction) {
+        scope = scope.parent;
+    }
+    return scope;
+}
+
+function declare(scope, identifier) {
+    var binding = scope.bindings[identifier.name];
+    if (!binding) {
+        binding = scope.bindings[identifier.name] = {
+            name: identifier.name,
+            scope: scope,
+            identifiers: []
+        };
+    }
+    binding.identifiers.push(identifier);
+}
+
+/**
+ * Visits the child nodes of a node, with the fields that hold identifiers which are not
+ * references, like the property of a member expression, left out.
+ */
+function eachChild(node, callback) {
+    Object.keys(node).forEach(function (key) {
+        var value = node[key];
+        if (key === 'range' || key === 'loc') {
+            return;
+        }
+        if (
+            (key === 'property' && node.type === 'MemberExpression' && !node.computed) ||
+            (key === 'key' && node.type === 'Property' && !node.computed) ||
+            (key === 'label' && /^(Labeled|Break|Continue)Statement$/.test(node.type))
+        ) {
+            return;
+        }
+        if (Array.isArray(value)) {
+            value.forEach(function (item) {
+                if (item && typeof item.type === 'string') {
+                    callback(item);
+                }
+            });
+        } else if (value && typeof value.type === 'string') {
+            callback(value);
+        }
+    });
+}
+
+/**
+ * Builds the scopes of a program. Functions and catch clauses open scopes, declarations with var
+ * are hoisted to the function they are in, and every other identifier is a reference resolved
+ * once all scopes are known.
+ */
+function analyze(program) {
+    var global = createScope(null, program, true),
+        references = [];
+
+    function visit(node, scope) {
+        var inner;
+
+        if (node.type === 'FunctionDeclaration' || node.type === 'FunctionExpression') {
+            if (node.type === 'FunctionDeclaration') {
+                declare(functionScope(scope), node.id);
+            }
+            inner = createScope(scope, node, true);
+            if (node.type === 'FunctionExpression' && node.id) {
+                declare(inner, node.id);
+            }
+            node.params.forEach(function (param) {
+                declare(inner, param);
+            });
+            visit(node.body, inner);
+            return;
+        }
+        if (node.type === 'CatchClause') {
+            inner = createScope(scope, node, false);
+            declare(inner, node.param);
+            visit(node.body, inner);
+            return;
+        }
+        if (node.type === 'VariableDeclarator') {
+            declare(functionScope(scope), node.id);
+            if (node.init) {
+                visit(node.init, scope);
+            }
+            return;
+        }
+        if (node.type === 'Identifier') {
+            references.push({ identifier: node, scope: scope });
+            return;
+        }
+        eachChild(node, function (child) {
+            visit(child, scope);
+        });
+    }
+
+    visit(program, global);
+
+    references.forEach(function (reference) {
+        var name = reference.identifier.name,
+            scope = reference.scope,
+            binding = null,
+            current;
+
+        for (current = scope; current; current = current.parent) {
+            if (current.bindings[name]) {
+                binding = current.bindings[name];
+                break;
+            }
+        }
+        if (!binding) {
+            // A global, never renamed, so taken in every scope it is used in
+            binding = { name: name, scope: null, identifiers: [], global: true };
+        } else {
+            binding.identifiers.push(reference.identifier);
+        }
+        for (current = scope; current && current !== binding.scope; current = current.parent) {
+            if (current.outer.indexOf(binding) === -1) {
+                current.outer.push(binding);
+            }
+        }
+    });
+    return global;
+}
+
+/**
+ * Renames the bindings of every function scope below the global one, outer scopes first. A
+ * scope does not take a name that an outer binding it refers to, or a global it uses, has.
+ * Bindings with more references get the shorter names.
+ */
+function rename(scope) {
+    var taken = Object.create(null),
+        bindings = Object.keys(scope.bindings).map(function (name) {
+            return scope.bindings[name];
+        }),
+        index = 0;
+
+    if (scope.parent) {
+        scope.outer.forEach(function (binding) {
+            taken[binding.global ? binding.name : binding.newName] = true;
+        });
+        bindings.sort(function (a, b) {
+            return b.identifiers.length - a.identifiers.length || (a.name < b.name ? -1 : 1);
+        });
+        bindings.forEach(function (binding) {
+            var name;
+            do {
+                name = nameAt(index++);
+            } while (taken[name] || RESERVED.indexOf(name) !== -1);
+            binding.newName = name;
+        });
+    } else {
+        bindings.forEach(function (binding) {
+            binding.newName = binding.name;
+        });
+    }
+    bindings.forEach(function (binding) {
+        binding.identifiers.forEach(function (identifier) {
+            identifier.newName = binding.newName;
+        });
+    });
+    scope.children.forEach(rename);
+}
+
+function isWordChar(char) {
+    return /[A-Za-z0-9_$\\]/.test(char);
+}
+
+/**
+ * Joins the tokens of the program with the new names, with a space or a line break only where
+ * two tokens would otherwise read as one.
+ */
+function generate(tokens, renamed) {
+    var out = [],
+        lineLength = 0,
+        previous = null;
+
+    tokens.forEach(function (token) {
+        var text = token.type === 'Identifier' && renamed[token.range[0]] !== undefined ?
+                renamed[token.range[0]] :
+                token.value,
+            separator = '';
+
+        if (previous) {
+            var last = previous.text.charAt(previous.text.length - 1),
+                first = text.charAt(0);
+            if (
+                (isWordChar(last) && isWordChar(first)) ||
+                (previous.type === 'RegularExpression' && isWordChar(first)) ||
+                (last === '+' && first === '+') ||
+                (last === '-' && first === '-') ||
+                (previous.type === 'Numeric' && first === '.' && /^\d+$/.test(previous.text))
+            ) {
+                separator = ' ';
+            } else if (lineLength >= LINE_LENGTH && (last === ',' || last === ';')) {
+                separator = '\n';
+            }
+        }
+        if (separator === '\n') {
+            lineLength = 0;
+        } else {
+            lineLength += separator.length;
+        }
+        out.push(separator, text);
+        lineLength += text.length;
+        previous = { text: text, type: token.type };
+    });
+    return out.join('');
+}
+
+/**
+ * The tree of a program without positions, with identifiers under their new names, for comparing
+ * the source with what was built from it.
+ */
+function strip(node) {
+    if (Array.isArray(node)) {
+        return node.map(strip);
+    }
+    if (!node || typeof node !== 'object') {
+        return node;
+    }
+    var copy = {};
+    Object.keys(node).forEach(function (key) {
+        if (key === 'range' || key === 'loc' || key === 'newName') {
+            return;
+        }
+        copy[key] = key === 'name' && node.type === 'Identifier' && node.newName !== undefined ?
+            node.newName :
+            strip(node[key]);
+    });
+    return copy;
+}
+
+function minify(source, file) {
+    var banner = /^\/\*[\s\S]*?\*\//.exec(source),
+        program,
+        tokens,
+        renamed = {},
+        code,
+        check;
+
+    if (!banner || !/Highcharts JS v\d/.test(banner[0])) {
+        fail(file + ' does not start with the license banner of the distribution');
+    }
+    try {
+        program = esprima.parseScript(source, { range: true, tokens: true });
+    } catch (e) {
+        fail(file + ': ' + e.message);
+    }
+    tokens = program.tokens;
+    delete program.tokens;
+
+    rename(analyze(program));
+    (function collect(node) {
+        if (node.type === 'Identifier' && node.newName !== undefined) {
+            renamed[node.range[0]] = node.newName;
+        }
+        eachChild(node, collect);
+    }(program));
+
+    code = generate(tokens, renamed);
+    try {
+        check = esprima.parseScript(code);
+    } catch (e) {
+        fail(file + ' does not parse once minified: ' + e.message);
+    }
+    if (JSON.stringify(strip(check)) !== JSON.stringify(strip(program))) {
+        fail(file + ' minifies to a different program');
+    }
+    return banner[0] + '\n' + code + '\n';
+}
+
+function main() {
+    var args = parseArguments(process.argv.slice(2)),
+        bundle = path.join(args.framework, BUNDLE),
+        built = 0;
+
+    try {
+        esprima = require('esprima');
+    } catch (e) {
+        fail('esprima is missing, install it with npm install esprima');
+    }
+    if (!fs.existsSync(bundle)) {
+        fail('no chart bundle in ' + args.framework);
+    }
+
+    TREES.forEach(function (tree) {
+        var directory = path.join(SOURCES, tree.sources);
+        fs.readdirSync(directory).filter(function (file) {
+            return /\.src\.js$/.test(file) &&
+                (!args.modules.length || args.modules.indexOf(file.replace(/\.src\.js$/, '')) !== -1);
+        }).sort().forEach(function (file) {
+            var source = fs.readFileSync(path.join(directory, file), 'utf8'),
+                output = path.join(bundle, tree.bundle, file.replace(/\.src\.js$/, '.js')),
+                minified = minify(source, path.join(tree.sources, file));
+
+            if (!args.dryRun) {
+                fs.writeFileSync(output, minified);
+            }
+            process.stdout.write(path.join(tree.bundle, path.basename(output)) + ': ' +
+                Math.round(source.length / 1024) + ' KB to ' +
+                Math.round(minified.length / 1024) + ' KB\n');
+            built++;
+        });
+    });
+    if (args.modules.length && built === 0) {
+        fail('no sources for ' + args.modules.join(', ') + ' in ' + SOURCES);
+    }
+}
+
+main();
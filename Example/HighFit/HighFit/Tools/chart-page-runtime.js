@@ -0,0 +1,859 @@
+//
+//  chart-page-runtime.js
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+//  A stand-in for the chart page of the framework bundle that runs in Node, so charts can be
+//  rendered to SVG on a build host without a web view. It provides the small part of the DOM the
+//  Highcharts SVG renderer uses: elements with attributes, style and children, computed styles
+//  and sizes of the container, innerHTML and getBBox. Text is measured with the advance widths of
+//  Helvetica, so labels are laid out close to, but not exactly like, the page on a device.
+//
+//  A page loads highcharts.js and the modules of the bundle once and renders any number of charts:
+//
+//    var page = require('./chart-page-runtime').createPage(bundlePath, ['exporting']);
+//    var svg = page.render(options, 600, 400);
+//
+
+'use strict';
+
+var fs = require('fs');
+var path = require('path');
+var vm = require('vm');
+
+var SVG_NS = 'http://www.w3.org/2000/svg';
+
+// Advance widths of Helvetica in thousandths of an em, from space to tilde
+var CHAR_WIDTHS = [
+    278, 278, 355, 556, 556, 889, 667, 191, 333, 333, 389, 584, 278, 333, 278, 278,
+    556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 278, 278, 584, 584, 584, 556,
+    1015, 667, 667, 722, 722, 667, 611, 778, 722, 278, 500, 667, 556, 833, 722, 778,
+    667, 778, 722, 667, 611, 722, 667, 944, 667, 667, 611, 278, 278, 278, 469, 556,
+    333, 556, 556, 500, 556, 556, 278, 556, 556, 222, 222, 500, 222, 833, 556, 556,
+    556, 556, 333, 500, 278, 556, 500, 722, 500, 500, 500, 334, 260, 334, 584
+];
+
+/**
+ * The width of a string in a font size, bold text is about a tenth wider.
+ */
+function measureText(text, fontSize, bold) {
+    var width = 0,
+        i,
+        code;
+    for (i = 0; i < text.length; i++) {
+        code = text.charCodeAt(i);
+        width += code >= 32 && code <= 126 ? CHAR_WIDTHS[code - 32] : 556;
+    }
+    return width / 1000 * fontSize * (bold ? 1.1 : 1);
+}
+
+function hyphenate(name) {
+    return name.replace(/[A-Z]/g, function (match) {
+        return '-' + match.toLowerCase();
+    });
+}
+
+function camelCase(name) {
+    return name.replace(/-([a-z])/g, function (match, letter) {
+        return letter.toUpperCase();
+    });
+}
+
+function escapeXML(text, attribute) {
+    text = String(text).replace(/&/g, '&amp;').replace(/</g, '&lt;').replace(/>/g, '&gt;');
+    return attribute ? text.replace(/"/g, '&quot;') : text;
+}
+
+/**
+ * The style declaration of an element. Properties are set directly, as by Highcharts.css, or
+ * through the style attribute, as by SVGElement.css.
+ */
+function Style() {}
+
+Object.defineProperty(Style.prototype, 'cssText', {
+    get: function () {
+        var style = this;
+        return Object.keys(style).filter(function (key) {
+            return style[key] !== '' && style[key] !== undefined && style[key] !== null;
+        }).map(function (key) {
+            return hyphenate(key) + ':' + style[key];
+        }).join(';');
+    },
+    set: function (text) {
+        var style = this;
+        Object.keys(style).forEach(function (key) {
+            delete style[key];
+        });
+        String(text || '').split(';').forEach(function (declaration) {
+            var colon = declaration.indexOf(':');
+            if (colon > 0) {
+                style[camelCase(declaration.slice(0, colon).trim())] = declaration.slice(colon + 1).trim();
+            }
+        });
+    }
+});
+
+Style.prototype.getPropertyValue = function (name) {
+    var value = this[camelCase(name)];
+    if (value === undefined || value === '') {
+        // Unset paddings, margins and borders are none
+        return /^(padding|margin|border)/.test(name) ? '0px' : '';
+    }
+    return String(value);
+};
+
+Style.prototype.setProperty = function (name, value) {
+    this[camelCase(name)] = value;
+};
+
+Style.prototype.removeProperty = function (name) {
+    delete this[camelCase(name)];
+};
+
+function Node(document, nodeType, nodeName) {
+    this.ownerDocument = document;
+    this.nodeType = nodeType;
+    this.nodeName = nodeName;
+    this.parentNode = null;
+    this.childNodes = [];
+}
+
+Node.prototype = {
+    get firstChild() {
+        return this.childNodes[0] || null;
+    },
+    get lastChild() {
+        return this.childNodes[this.childNodes.length - 1] || null;
+    },
+    get nextSibling() {
+        var siblings = this.parentNode && this.parentNode.childNodes;
+        return siblings ? siblings[siblings.indexOf(this) + 1] || null : null;
+    },
+    get previousSibling() {
+        var siblings = this.parentNode && this.parentNode.childNodes;
+        return siblings ? siblings[siblings.indexOf(this) - 1] || null : null;
+    },
+    get children() {
+        return this.childNodes.filter(function (node) {
+            return node.nodeType === 1;
+        });
+    },
+    get textContent() {
+        return this.nodeType === 3 ? this.data : this.childNodes.map(function (node) {
+            return node.textContent;
+        }).join('');
+    },
+    set textContent(text) {
+        this.childNodes.forEach(function (node) {
+            node.parentNode = null;
+        });
+        this.childNodes = [];
+        if (text !== '' && text !== null && text !== undefined) {
+            this.appendChild(this.ownerDocument.createTextNode(text));
+        }
+    },
+    appendChild: function (node) {
+        return this.insertBefore(node, null);
+    },
+    insertBefore: function (node, reference) {
+        var index;
+        if (node.parentNode) {
+            node.parentNode.removeChild(node);
+        }
+        index = reference ? this.childNodes.indexOf(reference) : -1;
+        if (index === -1) {
+            this.childNodes.push(node);
+        } else {
+            this.childNodes.splice(index, 0, node);
+        }
+        node.parentNode = this;
+        return node;
+    },
+    removeChild: function (node) {
+        var index = this.childNodes.indexOf(node);
+        if (index !== -1) {
+            this.childNodes.splice(index, 1);
+            node.parentNode = null;
+        }
+        return node;
+    },
+    replaceChild: function (node, old) {
+        this.insertBefore(node, old);
+        return this.removeChild(old);
+    },
+    cloneNode: function (deep) {
+        var clone;
+        if (this.nodeType === 3) {
+            return this.ownerDocument.createTextNode(this.data);
+        }
+        clone = this.namespaceURI === SVG_NS ?
+            this.ownerDocument.createElementNS(SVG_NS, this.nodeName) :
+            this.ownerDocument.createElement(this.nodeName);
+        Object.keys(this.attributeMap).forEach(function (name) {
+            clone.setAttribute(name, this.attributeMap[name]);
+        }, this);
+        clone.style.cssText = this.style.cssText;
+        if (deep) {
+            this.childNodes.forEach(function (node) {
+                clone.appendChild(node.cloneNode(true));
+            });
+        }
+        return clone;
+    },
+    addEventListener: function () {},
+    removeEventListener: function () {},
+    dispatchEvent: function () {
+        return true;
+    }
+};
+
+function Element(document, name, namespaceURI) {
+    // SVG names keep their case, HTML names are upper case like in a browser
+    Node.call(this, document, 1, namespaceURI === SVG_NS ? name : name.toUpperCase());
+    this.namespaceURI = namespaceURI;
+    this.attributeMap = {};
+    this.style = new Style();
+}
+
+Element.prototype = Object.create(Node.prototype);
+
+Object.defineProperties(Element.prototype, {
+    tagName: {
+        get: function () {
+            return this.nodeName;
+        }
+    },
+    id: {
+        get: function () {
+            return this.getAttribute('id') || '';
+        },
+        set: function (value) {
+            this.setAttribute('id', value);
+        }
+    },
+    className: {
+        get: function () {
+            return this.getAttribute('class') || '';
+        },
+        set: function (value) {
+            this.setAttribute('class', value);
+        }
+    },
+    ownerSVGElement: {
+        get: function () {
+            var node = this.parentNode;
+            while (node && node.nodeName !== 'svg') {
+                node = node.parentNode;
+            }
+            return node;
+        }
+    },
+    innerHTML: {
+        get: function () {
+            return this.childNodes.map(serialize).join('');
+        },
+        set: function (html) {
+            // Only text is parsed, the renderer builds elements with createElementNS
+            this.textContent = String(html).replace(/<[^>]*>/g, '');
+        }
+    },
+    outerHTML: {
+        get: function () {
+            return serialize(this);
+        }
+    },
+    // Layout sizes of HTML elements come from their style, as nothing is laid out
+    offsetWidth: {
+        get: function () {
+            return parseFloat(this.style.width) || 0;
+        }
+    },
+    offsetHeight: {
+        get: function () {
+            return parseFloat(this.style.height) || 0;
+        }
+    },
+    scrollWidth: {
+        get: function () {
+            return this.offsetWidth;
+        }
+    },
+    scrollHeight: {
+        get: function () {
+            return this.offsetHeight;
+        }
+    },
+    clientWidth: {
+        get: function () {
+            return this.offsetWidth;
+        }
+    },
+    clientHeight: {
+        get: function () {
+            return this.offsetHeight;
+        }
+    }
+});
+
+Element.prototype.setAttribute = function (name, value) {
+    if (name === 'style') {
+        this.style.cssText = value;
+        return;
+    }
+    this.attributeMap[name] = String(value);
+};
+
+Element.prototype.setAttributeNS = function (namespace, name, value) {
+    this.setAttribute(name, value);
+};
+
+Element.prototype.getAttribute = function (name) {
+    if (name === 'style') {
+        return this.style.cssText || null;
+    }
+    return this.attributeMap.hasOwnProperty(name) ? this.attributeMap[name] : null;
+};
+
+Element.prototype.hasAttribute = function (name) {
+    return this.getAttribute(name) !== null;
+};
+
+Element.prototype.removeAttribute = function (name) {
+    if (name === 'style') {
+        this.style.cssText = '';
+    }
+    delete this.attributeMap[name];
+};
+
+Element.prototype.getElementsByTagName = function (name) {
+    var found = [];
+    name = name.toLowerCase();
+    (function walk(node) {
+        node.childNodes.forEach(function (child) {
+            if (child.nodeType === 1) {
+                if (name === '*' || child.nodeName.toLowerCase() === name) {
+                    found.push(child);
+                }
+                walk(child);
+            }
+        });
+    }(this));
+    return found;
+};
+
+Element.prototype.querySelector = function (selector) {
+    return this.getElementsByTagName(selector)[0] || null;
+};
+
+Element.prototype.querySelectorAll = function (selector) {
+    return this.getElementsByTagName(selector);
+};
+
+// Tells the renderer SVG is supported
+Element.prototype.createSVGRect = function () {
+    return { x: 0, y: 0, width: 0, height: 0 };
+};
+
+Element.prototype.getBoundingClientRect = function () {
+    var box = this.namespaceURI === SVG_NS ? this.getBBox() : {
+        x: 0,
+        y: 0,
+        width: this.offsetWidth,
+        height: this.offsetHeight
+    };
+    return {
+        left: box.x,
+        top: box.y,
+        right: box.x + box.width,
+        bottom: box.y + box.height,
+        width: box.width,
+        height: box.height
+    };
+};
+
+Element.prototype.focus = function () {};
+Element.prototype.blur = function () {};
+
+/**
+ * A style property of the element or the closest ancestor that sets it.
+ */
+Element.prototype.inherited = function (name, fallback) {
+    var node = this,
+        value;
+    while (node && node.nodeType === 1) {
+        value = node.style[name] || node.getAttribute(hyphenate(name));
+        if (value) {
+            return value;
+        }
+        node = node.parentNode;
+    }
+    return fallback;
+};
+
+Element.prototype.getComputedTextLength = function () {
+    var bold = /bold|[6-9]00/.test(this.inherited('fontWeight', ''));
+    return measureText(this.textContent, parseFloat(this.inherited('fontSize', '16')) || 16, bold);
+};
+
+Element.prototype.getSubStringLength = function (start, count) {
+    var bold = /bold|[6-9]00/.test(this.inherited('fontWeight', ''));
+    return measureText(this.textContent.substr(start, count), parseFloat(this.inherited('fontSize', '16')) || 16, bold);
+};
+
+function number(value) {
+    return parseFloat(value) || 0;
+}
+
+function pathBox(d) {
+    var tokens = String(d || '').match(/[a-zA-Z]|-?[\d.]+(?:e[-+]?\d+)?/g) || [],
+        xs = [],
+        ys = [],
+        command,
+        i = 0,
+        x = 0,
+        y = 0,
+        values;
+
+    function take(count) {
+        var taken = tokens.slice(i, i + count).map(Number);
+        i += count;
+        return taken;
+    }
+
+    while (i < tokens.length) {
+        if (/[a-zA-Z]/.test(tokens[i])) {
+            command = tokens[i++];
+        }
+        // Highcharts writes absolute commands, only their end points are taken
+        switch (command) {
+        case 'M':
+        case 'L':
+        case 'T':
+            values = take(2);
+            x = values[0];
+            y = values[1];
+            break;
+        case 'H':
+            x = take(1)[0];
+            break;
+        case 'V':
+            y = take(1)[0];
+            break;
+        case 'C':
+            values = take(6);
+            x = values[4];
+            y = values[5];
+            break;
+        case 'S':
+        case 'Q':
+            values = take(4);
+            x = values[2];
+            y = values[3];
+            break;
+        case 'A':
+            values = take(7);
+            xs.push(x - values[0], x + values[0]);
+            ys.push(y - values[1], y + values[1]);
+            x = values[5];
+            y = values[6];
+            break;
+        case 'Z':
+        case 'z':
+            continue;
+        default:
+            i++;
+            continue;
+        }
+        if (!isNaN(x) && !isNaN(y)) {
+            xs.push(x);
+            ys.push(y);
+        }
+    }
+    return box(xs, ys);
+}
+
+function box(xs, ys) {
+    if (!xs.length) {
+        return { x: 0, y: 0, width: 0, height: 0 };
+    }
+    var x = Math.min.apply(Math, xs),
+        y = Math.min.apply(Math, ys);
+    return { x: x, y: y, width: Math.max.apply(Math, xs) - x, height: Math.max.apply(Math, ys) - y };
+}
+
+function translation(element) {
+    var match = /translate\(\s*(-?[\d.]+)[\s,]*(-?[\d.]+)?/.exec(element.getAttribute('transform') || '');
+    return match ? [number(match[1]), number(match[2])] : [0, 0];
+}
+
+/**
+ * Estimates the box of text from its lines, tspans with an x start a new line.
+ */
+function textBox(element) {
+    var fontSize = parseFloat(element.inherited('fontSize', '16')) || 16,
+        bold = /bold|[6-9]00/.test(element.inherited('fontWeight', '')),
+        lines = [''],
+        width = 0,
+        x = number(element.getAttribute('x')),
+        y = number(element.getAttribute('y')),
+        anchor = element.inherited('textAnchor', 'start');
+
+    (function walk(node) {
+        node.childNodes.forEach(function (child) {
+            if (child.nodeType === 3) {
+                lines[lines.length - 1] += child.data;
+            } else if (child.nodeType === 1 && child.nodeName !== 'title') {
+                if (child.getAttribute('x') !== null && lines[lines.length - 1] !== '') {
+                    lines.push('');
+                }
+                walk(child);
+            }
+        });
+    }(element));
+    lines.forEach(function (line) {
+        width = Math.max(width, measureText(line, fontSize, bold));
+    });
+    x -= anchor === 'middle' ? width / 2 : anchor === 'end' ? width : 0;
+    return {
+        x: x,
+        y: y - fontSize * 0.8,
+        width: lines.join('') ? width : 0,
+        height: fontSize * 1.2 * lines.length
+    };
+}
+
+Element.prototype.getBBox = function () {
+    var name = this.nodeName,
+        boxes,
+        xs = [],
+        ys = [],
+        r;
+
+    if (name === 'text') {
+        return textBox(this);
+    }
+    if (name === 'rect' || name === 'image') {
+        return {
+            x: number(this.getAttribute('x')),
+            y: number(this.getAttribute('y')),
+            width: number(this.getAttribute('width')),
+            height: number(this.getAttribute('height'))
+        };
+    }
+    if (name === 'circle') {
+        r = number(this.getAttribute('r'));
+        return { x: number(this.getAttribute('cx')) - r, y: number(this.getAttribute('cy')) - r, width: 2 * r, height: 2 * r };
+    }
+    if (name === 'path') {
+        return pathBox(this.getAttribute('d'));
+    }
+    // Groups are the union of their children, in the space of the group
+    boxes = this.children.filter(function (child) {
+        return child.getAttribute('visibility') !== 'hidden' && child.style.display !== 'none';
+    });
+    boxes.forEach(function (child) {
+        var childBox = child.getBBox(),
+            offset = translation(child);
+        if (childBox.width || childBox.height) {
+            xs.push(childBox.x + offset[0], childBox.x + offset[0] + childBox.width);
+            ys.push(childBox.y + offset[1], childBox.y + offset[1] + childBox.height);
+        }
+    });
+    return box(xs, ys);
+};
+
+function Text(document, data) {
+    Node.call(this, document, 3, '#text');
+    this.data = String(data);
+}
+
+Text.prototype = Object.create(Node.prototype);
+
+Object.defineProperty(Text.prototype, 'nodeValue', {
+    get: function () {
+        return this.data;
+    },
+    set: function (value) {
+        this.data = String(value);
+    }
+});
+
+function serialize(node) {
+    var attributes;
+    if (node.nodeType === 3) {
+        return escapeXML(node.data);
+    }
+    attributes = Object.keys(node.attributeMap).map(function (name) {
+        return ' ' + name + '="' + escapeXML(node.attributeMap[name], true) + '"';
+    });
+    if (node.style.cssText) {
+        attributes.push(' style="' + escapeXML(node.style.cssText, true) + '"');
+    }
+    return '<' + node.nodeName.toLowerCase().replace(/^(\w+)$/, function (name) {
+        // SVG names keep their case
+        return node.namespaceURI === SVG_NS ? node.nodeName : name;
+    }) + attributes.join('') + (node.childNodes.length ?
+        '>' + node.childNodes.map(serialize).join('') + '</' + (node.namespaceURI === SVG_NS ? node.nodeName : node.nodeName.toLowerCase()) + '>' :
+        '/>');
+}
+
+function Document() {
+    Node.call(this, this, 9, '#document');
+    this.documentElement = this.createElement('html');
+    this.head = this.createElement('head');
+    this.body = this.createElement('body');
+    this.documentElement.appendChild(this.head);
+    this.documentElement.appendChild(this.body);
+    this.childNodes = [this.documentElement];
+}
+
+Document.prototype = Object.create(Node.prototype);
+
+Document.prototype.createElement = function (name) {
+    return new Element(this, name, 'http://www.w3.org/1999/xhtml');
+};
+
+Document.prototype.createElementNS = function (namespaceURI, name) {
+    return new Element(this, name, namespaceURI);
+};
+
+Document.prototype.createTextNode = function (data) {
+    return new Text(this, data);
+};
+
+Document.prototype.getElementById = function (id) {
+    var found = null;
+    (function walk(node) {
+        node.childNodes.forEach(function (child) {
+            if (!found && child.nodeType === 1) {
+                if (child.getAttribute('id') === id) {
+                    found = child;
+                } else {
+                    walk(child);
+                }
+            }
+        });
+    }(this));
+    return found;
+};
+
+Document.prototype.getElementsByTagName = function (name) {
+    return Element.prototype.getElementsByTagName.call(this, name);
+};
+
+Document.prototype.querySelector = function (selector) {
+    return this.getElementsByTagName(selector)[0] || null;
+};
+
+/**
+ * Timer functions for a page. Like in a browser, an exception in a timer callback is logged and
+ * does not reach the caller, and it is kept in errors so a render can fail on it. Pending
+ * timeouts are tracked so a render can wait for them or clear them.
+ */
+function createTimers() {
+    var timers = {
+        pending: new Set(),
+        errors: []
+    };
+
+    function run(callback, args) {
+        try {
+            callback.apply(null, args);
+        } catch (e) {
+            timers.errors.push(e);
+            console.error('page timer: ' + (e && e.stack || e));
+        }
+    }
+
+    timers.setTimeout = function (callback, delay) {
+        var args = Array.prototype.slice.call(arguments, 2),
+            id = setTimeout(function () {
+                timers.pending.delete(id);
+                run(callback, args);
+            }, delay);
+        timers.pending.add(id);
+        return id;
+    };
+    timers.clearTimeout = function (id) {
+        timers.pending.delete(id);
+        clearTimeout(id);
+    };
+    timers.setInterval = function (callback, delay) {
+        var args = Array.prototype.slice.call(arguments, 2);
+        return setInterval(function () {
+            run(callback, args);
+        }, delay);
+    };
+    timers.clearInterval = clearInterval;
+
+    // Clears the timeouts left by a chart before it is destroyed
+    timers.clear = function () {
+        timers.pending.forEach(clearTimeout);
+        timers.pending.clear();
+    };
+    return timers;
+}
+
+/**
+ * A window with a document and the globals the library reads, to run scripts in as a context.
+ */
+function createWindow() {
+    var document = new Document(),
+        timers = createTimers(),
+        window = {
+            document: document,
+            navigator: { userAgent: 'Mozilla/5.0 (iPhone; CPU iPhone OS 11_0 like Mac OS X) AppleWebKit/604.1.38 (KHTML, like Gecko)' },
+            location: { href: 'file:///highcharts.html', protocol: 'file:' },
+            devicePixelRatio: 1,
+            innerWidth: 1024,
+            innerHeight: 768,
+            console: console,
+            // Animation is off, but timers are kept for the few deferred calls of the library
+            setTimeout: timers.setTimeout,
+            clearTimeout: timers.clearTimeout,
+            setInterval: timers.setInterval,
+            clearInterval: timers.clearInterval,
+            getComputedStyle: function (element) {
+                return element.style;
+            },
+            addEventListener: function () {},
+            removeEventListener: function () {},
+            XMLSerializer: function () {
+                this.serializeToString = serialize;
+            },
+            Image: function () {}
+        };
+    window.window = window.self = window.top = window;
+    Object.defineProperty(window, 'pageTimers', { value: timers });
+    return window;
+}
+
+/**
+ * Loads highcharts.js and the modules of bundlePath into a new window. Module names are the file
+ * names in js/modules without the extension, like the plugins of a chart view.
+ */
+function createPage(bundlePath, plugins) {
+    var window = createWindow(),
+        context = vm.createContext(window),
+        scripts = ['js/highcharts.js'].concat((plugins || []).map(function (name) {
+            return 'js/modules/' + name + '.js';
+        })),
+        container = window.document.createElement('div'),
+        H;
+
+    scripts.forEach(function (script) {
+        var file = path.join(bundlePath, script);
+        vm.runInContext(fs.readFileSync(file, 'utf8'), context, { filename: file });
+    });
+    H = window.Highcharts;
+    H.setOptions({
+        chart: { animation: false },
+        plotOptions: { series: { animation: false } },
+        credits: { enabled: true }
+    });
+    container.setAttribute('id', 'container');
+    window.document.body.appendChild(container);
+
+    function build(options, width, height) {
+        // Timeouts of the last chart, like the series label timer, would run on a destroyed chart
+        window.pageTimers.clear();
+        window.pageTimers.errors.length = 0;
+        H.each(H.charts.slice(), function (c) {
+            if (c) {
+                c.destroy();
+            }
+        });
+        container.style.width = width + 'px';
+        container.style.height = height + 'px';
+        // Options are parsed in the page so arrays and objects belong to its realm
+        options = vm.runInContext('JSON.parse(' + JSON.stringify(JSON.stringify(options)) + ')', context);
+        return new H.Chart(container, reviveFunctions(context, options));
+    }
+
+    function serialize(chart) {
+        return chart.getSVG ?
+            chart.getSVG(chart.options.exporting && chart.options.exporting.chartOptions) :
+            chart.container.innerHTML;
+    }
+
+    return {
+        window: window,
+        Highcharts: H,
+
+        /**
+         * Renders options at a size and returns the SVG, replacing the chart of the last call.
+         * Functions in options are given as source strings prefixed with "function". The SVG is
+         * taken right after the chart is built, so what the library draws later in a timeout,
+         * like series labels, is missing. Use renderSettled for those.
+         */
+        render: function (options, width, height) {
+            return serialize(build(options, width, height));
+        },
+
+        /**
+         * Renders like render, but waits for the timeouts of the page to run before the SVG is
+         * taken, for at most timeout milliseconds, 10 seconds by default. Calls back with an
+         * error if building the chart or one of its timeouts threw. The page has no Worker, so
+         * the modules that lay out in a worker use their fallback on the page and are done when
+         * the chart is built.
+         */
+        renderSettled: function (options, width, height, callback, timeout) {
+            var deadline = Date.now() + (timeout || 10000),
+                timers = window.pageTimers,
+                chart;
+
+            try {
+                chart = build(options, width, height);
+            } catch (e) {
+                callback(e);
+                return;
+            }
+            (function settle() {
+                var svg;
+                if (timers.pending.size && Date.now() < deadline) {
+                    setTimeout(settle, 5);
+                    return;
+                }
+                if (timers.errors.length) {
+                    callback(timers.errors[0]);
+                    return;
+                }
+                try {
+                    svg = serialize(chart);
+                } catch (e) {
+                    callback(e);
+                    return;
+                }
+                callback(null, svg);
+            }());
+        }
+    };
+}
+
+/**
+ * Evaluates strings that hold function sources, like the page does with HIFunction.
+ */
+function reviveFunctions(context, value) {
+    if (typeof value === 'string' && /^\s*function\s*\(/.test(value)) {
+        return vm.runInContext('(' + value + ')', context);
+    }
+    if (Array.isArray(value)) {
+        return value.map(function (item) {
+            return reviveFunctions(context, item);
+        });
+    }
+    if (value && typeof value === 'object') {
+        Object.keys(value).forEach(function (key) {
+            value[key] = reviveFunctions(context, value[key]);
+        });
+    }
+    return value;
+}
+
+module.exports = {
+    createWindow: createWindow,
+    createPage: createPage,
+    measureText: measureText
+};
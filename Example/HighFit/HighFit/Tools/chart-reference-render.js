@@ -0,0 +1,109 @@
+//
+//  chart-reference-render.js
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+//  Renders the reference images that Snapshots/ChartSnapshotCompare.m checks ChartSnapshotRenderer
+//  against. Every options file in the references directory is drawn by the JavaScript library of
+//  the chart bundle in headless Chrome, and the screenshot is written next to it as a PNG.
+//
+//  Usage:
+//
+//    node chart-reference-render.js [options] [references]
+//
+//    -c path     the Chrome or Chromium binary, $CHROME or google-chrome by default
+//    -b path     the chart bundle, the one of the development framework by default
+//    -s size     the image size in points, 400x300 by default
+//
+//  The references directory is ../Snapshots/References by default.
+//
+
+'use strict';
+
+var fs = require('fs');
+var os = require('os');
+var path = require('path');
+var childProcess = require('child_process');
+
+var DEFAULT_BUNDLE = path.join(__dirname, '../../../../development/Highcharts.framework/com.highcharts.charts.bundle');
+var DEFAULT_REFERENCES = path.join(__dirname, '../Snapshots/References');
+
+function usage() {
+    process.stderr.write('usage: node chart-reference-render.js [-c chrome] [-b bundle] [-s 400x300] [references]\n');
+    process.exit(2);
+}
+
+function parseArguments(argv) {
+    var args = {
+            chrome: process.env.CHROME || 'google-chrome',
+            bundle: DEFAULT_BUNDLE,
+            references: DEFAULT_REFERENCES,
+            width: 400,
+            height: 300
+        },
+        size,
+        i;
+    for (i = 0; i < argv.length; i++) {
+        if (argv[i] === '-c' && i + 1 < argv.length) {
+            args.chrome = argv[++i];
+        } else if (argv[i] === '-b' && i + 1 < argv.length) {
+            args.bundle = argv[++i];
+        } else if (argv[i] === '-s' && i + 1 < argv.length) {
+            size = /^(\d+)x(\d+)$/.exec(argv[++i]);
+            if (!size) {
+                usage();
+            }
+            args.width = parseInt(size[1], 10);
+            args.height = parseInt(size[2], 10);
+        } else if (argv[i].charAt(0) === '-') {
+            usage();
+        } else {
+            args.references = argv[i];
+        }
+    }
+    return args;
+}
+
+// A page like highcharts.html of the bundle, without the exporting setup
+function page(bundle, options, width, height) {
+    return '<!DOCTYPE html><html><head><meta charset="utf-8">' +
+        '<script src="' + path.join(path.resolve(bundle), 'js/highcharts.js') + '"></script></head>' +
+        '<body style="margin:0;overflow:hidden">' +
+        '<div id="container" style="width:' + width + 'px; height:' + height + 'px"></div>' +
+        '<script>new Highcharts.Chart("container", ' + JSON.stringify(options) + ');</script>' +
+        '</body></html>';
+}
+
+function main() {
+    var args = parseArguments(process.argv.slice(2)),
+        temporary = fs.mkdtempSync(path.join(os.tmpdir(), 'chart-reference-')),
+        files = fs.readdirSync(args.references).filter(function (file) {
+            return path.extname(file) === '.json';
+        }).sort();
+
+    files.forEach(function (file) {
+        var name = path.basename(file, '.json'),
+            options = JSON.parse(fs.readFileSync(path.join(args.references, file), 'utf8')),
+            html = path.join(temporary, name + '.html'),
+            png = path.join(args.references, name + '.png');
+
+        fs.writeFileSync(html, page(args.bundle, options, args.width, args.height));
+        childProcess.execFileSync(args.chrome, [
+            '--headless',
+            '--disable-gpu',
+            '--no-sandbox',
+            '--hide-scrollbars',
+            '--allow-file-access-from-files',
+            '--force-device-scale-factor=1',
+            '--window-size=' + args.width + ',' + args.height,
+            '--screenshot=' + png,
+            'file://' + html
+        ], { stdio: 'ignore' });
+        process.stdout.write(png + '\n');
+    });
+    fs.rmSync(temporary, { recursive: true, force: true });
+}
+
+main();
@@ -0,0 +1,317 @@
+//
+//  chart-worker-check.js
+//  HighFit
+//
+//  License: www.highcharts.com/license
+//  Copyright © 2017 Highsoft AS. All rights reserved.
+//
+//  Checks the series-worker module against the regular pipeline. Each case builds a chart of
+//  large series in headless Chrome, where the worker runs, applies its steps, like a setData or
+//  a zoom, and reads the data extremes of the series and the extremes of the y axis once the
+//  worker redraw is done. The same case is run without the module, and any difference is
+//  reported. The page stand-in of chart-page-runtime.js has no Worker, so it cannot run these.
+//
+//  Usage:
+//
+//    node chart-worker-check.js [options]
+//
+//    -c path     the Chrome or Chromium binary, $CHROME or google-chrome by default
+//    -b path     the chart bundle, the one of the development framework by default
+//
+//  Talks to Chrome over the DevTools protocol with the WebSocket of Node 22, or of Node 20 run
+//  with --experimental-websocket. Exits with 1 when a case differs.
+//
+
+'use strict';
+
+var fs = require('fs');
+var os = require('os');
+var path = require('path');
+var http = require('http');
+var childProcess = require('child_process');
+
+var DEFAULT_BUNDLE = path.join(__dirname, '../../../../development/Highcharts.framework/com.highcharts.charts.bundle');
+
+var POINTS = 60000;
+
+// Steps run in the page with chart in scope, one redraw each
+var CASES = [
+    {
+        name: 'line, setData',
+        options: { chart: { type: 'line' } },
+        steps: ['chart.series[0].setData(data(2, 7))']
+    },
+    {
+        name: 'line, zoomed, setData',
+        options: { chart: { type: 'line' } },
+        steps: ['chart.xAxis[0].setExtremes(1000, 2000)', 'chart.series[1].setData(data(3, 11))']
+    },
+    {
+        name: 'stacked area, setData',
+        options: { chart: { type: 'area' }, plotOptions: { area: { stacking: 'normal' } } },
+        steps: ['chart.series[0].setData(data(2, 7))']
+    },
+    {
+        name: 'stacked area, setData of another length',
+        options: { chart: { type: 'area' }, plotOptions: { area: { stacking: 'normal' } } },
+        steps: ['chart.series[0].setData(data(4, 13, ' + (POINTS - 1000) + '))']
+    },
+    {
+        name: 'stacked area, zoomed, setData',
+        options: { chart: { type: 'area' }, plotOptions: { area: { stacking: 'normal' } } },
+        steps: ['chart.xAxis[0].setExtremes(1000, 2000)', 'chart.series[1].setData(data(3, 11))']
+    },
+    {
+        name: 'stacked area, hide a member',
+        options: { chart: { type: 'area' }, plotOptions: { area: { stacking: 'normal' } } },
+        steps: ['chart.series[1].hide()', 'chart.series[1].show()']
+    },
+    {
+        name: 'stacked area, small member, setData',
+        options: { chart: { type: 'area' }, plotOptions: { area: { stacking: 'normal' } } },
+        series: [POINTS, 1000],
+        steps: ['chart.series[0].setData(data(2, 7))', 'chart.xAxis[0].setExtremes(100, 500)']
+    }
+];
+
+function usage() {
+    process.stderr.write('usage: node chart-worker-check.js [-c chrome] [-b bundle]\n');
+    process.exit(2);
+}
+
+function fail(message) {
+    process.stderr.write('chart-worker-check: ' + message + '\n');
+    process.exit(1);
+}
+
+function parseArguments(argv) {
+    var args = {
+            chrome: process.env.CHROME || 'google-chrome',
+            bundle: DEFAULT_BUNDLE
+        },
+        i;
+    for (i = 0; i < argv.length; i++) {
+        if (argv[i] === '-c' && i + 1 < argv.length) {
+            args.chrome = argv[++i];
+        } else if (argv[i] === '-b' && i + 1 < argv.length) {
+            args.bundle = argv[++i];
+        } else {
+            usage();
+        }
+    }
+    return args;
+}
+
+/**
+ * A page running one case. The result is left in window.checkResult once the chart has settled:
+ * no worker redraw in flight and the extremes unchanged for a few frames.
+ */
+function page(bundle, testCase, withWorker) {
+    var scripts = ['js/highcharts.js'].concat(withWorker ? ['js/modules/series-worker.js'] : []),
+        sizes = testCase.series || [POINTS, POINTS],
+        options = JSON.parse(JSON.stringify(testCase.options));
+
+    options.chart.animation = false;
+    options.plotOptions = options.plotOptions || {};
+    options.plotOptions.series = { animation: false, turboThreshold: 0 };
+
+    return '<!DOCTYPE html><html><head><meta charset="utf-8">' +
+        scripts.map(function (script) {
+            return '<script src="' + path.join(path.resolve(bundle), script) + '"></script>';
+        }).join('') +
+        '</head><body style="margin:0">' +
+        '<div id="container" style="width:600px; height:400px"></div>' +
+        '<script>\n' +
+        'function data(scale, period, length) {\n' +
+        '    var values = [], i;\n' +
+        '    for (i = 0; i < (length || ' + POINTS + '); i++) {\n' +
+        '        values.push([i, 1 + scale * (i % period) + (i % 97) / 10]);\n' +
+        '    }\n' +
+        '    return values;\n' +
+        '}\n' +
+        'var options = ' + JSON.stringify(options) + ';\n' +
+        'options.series = ' + JSON.stringify(sizes) + '.map(function (length, i) {\n' +
+        '    return { data: data(1 + i, 5 + 2 * i, length) };\n' +
+        '});\n' +
+        'var chart = new Highcharts.Chart("container", options),\n' +
+        '    steps = ' + JSON.stringify(testCase.steps) + ';\n' +
+        'function state() {\n' +
+        '    var axis = chart.yAxis[0];\n' +
+        '    return {\n' +
+        '        series: chart.series.map(function (series) {\n' +
+        '            return [series.visible, series.dataMin, series.dataMax];\n' +
+        '        }),\n' +
+        '        yAxis: [axis.dataMin, axis.dataMax, axis.min, axis.max]\n' +
+        '    };\n' +
+        '}\n' +
+        'function settle(callback) {\n' +
+        '    var last, same = 0;\n' +
+        '    (function poll() {\n' +
+        '        var now = JSON.stringify(state());\n' +
+        '        same = !chart.workerRedrawing && now === last ? same + 1 : 0;\n' +
+        '        last = now;\n' +
+        '        if (same >= 5) {\n' +
+        '            callback();\n' +
+        '        } else {\n' +
+        '            setTimeout(poll, 50);\n' +
+        '        }\n' +
+        '    }());\n' +
+        '}\n' +
+        '(function next(i) {\n' +
+        '    settle(function () {\n' +
+        '        if (i < steps.length) {\n' +
+        '            try {\n' +
+        '                eval(steps[i]);\n' +
+        '            } catch (e) {\n' +
+        '                window.checkResult = { error: String(e) };\n' +
+        '                return;\n' +
+        '            }\n' +
+        '            next(i + 1);\n' +
+        '        } else {\n' +
+        '            window.checkResult = state();\n' +
+        '        }\n' +
+        '    });\n' +
+        '}(0));\n' +
+        '</script></body></html>';
+}
+
+function getJSON(port, pathname) {
+    return new Promise(function (resolve, reject) {
+        http.get({ host: '127.0.0.1', port: port, path: pathname }, function (response) {
+            var body = '';
+            response.on('data', function (chunk) {
+                body += chunk;
+            });
+            response.on('end', function () {
+                resolve(JSON.parse(body));
+            });
+        }).on('error', reject);
+    });
+}
+
+function delay(ms) {
+    return new Promise(function (resolve) {
+        setTimeout(resolve, ms);
+    });
+}
+
+/**
+ * Starts Chrome with the DevTools protocol on a free port and connects to its page.
+ */
+function launch(chrome) {
+    return new Promise(function (resolve, reject) {
+        var child = childProcess.spawn(chrome, [
+                '--headless',
+                '--disable-gpu',
+                '--no-sandbox',
+                '--allow-file-access-from-files',
+                '--remote-debugging-port=0',
+                'about:blank'
+            ], { stdio: ['ignore', 'ignore', 'pipe'] }),
+            output = '';
+
+        child.on('error', reject);
+        child.stderr.on('data', function (chunk) {
+            var match;
+            output += chunk;
+            match = /DevTools listening on ws:\/\/[^:]+:(\d+)\//.exec(output);
+            if (match) {
+                child.stderr.removeAllListeners('data');
+                child.stderr.resume();
+                getJSON(match[1], '/json/list').then(function (targets) {
+                    var target = targets.filter(function (t) {
+                            return t.type === 'page';
+                        })[0],
+                        socket = new WebSocket(target.webSocketDebuggerUrl),
+                        callbacks = {},
+                        id = 0;
+
+                    socket.onmessage = function (event) {
+                        var message = JSON.parse(event.data);
+                        if (message.id && callbacks[message.id]) {
+                            callbacks[message.id](message);
+                            delete callbacks[message.id];
+                        }
+                    };
+                    socket.onopen = function () {
+                        resolve({
+                            send: function (method, params) {
+                                return new Promise(function (resolveMessage) {
+                                    callbacks[++id] = resolveMessage;
+                                    socket.send(JSON.stringify({ id: id, method: method, params: params || {} }));
+                                });
+                            },
+                            close: function () {
+                                socket.close();
+                                child.kill();
+                            }
+                        });
+                    };
+                }, reject);
+            }
+        });
+    });
+}
+
+async function runPage(browser, file) {
+    var started = Date.now(),
+        response;
+
+    await browser.send('Page.navigate', { url: 'file://' + file });
+    while (Date.now() - started < 60000) {
+        await delay(100);
+        response = await browser.send('Runtime.evaluate', {
+            expression: 'window.checkResult && JSON.stringify(window.checkResult)',
+            returnByValue: true
+        });
+        if (response.result && response.result.result && response.result.result.value) {
+            return JSON.parse(response.result.result.value);
+        }
+    }
+    return { error: 'timed out' };
+}
+
+async function main() {
+    var args = parseArguments(process.argv.slice(2)),
+        temporary = fs.mkdtempSync(path.join(os.tmpdir(), 'chart-worker-check-')),
+        failed = 0,
+        browser,
+        i;
+
+    if (typeof WebSocket === 'undefined') {
+        fail('no WebSocket, run with Node 22 or node --experimental-websocket');
+    }
+    try {
+        browser = await launch(args.chrome);
+    } catch (e) {
+        fail('cannot start ' + args.chrome + ': ' + e.message);
+    }
+
+    for (i = 0; i < CASES.length; i++) {
+        var testCase = CASES[i],
+            regular = path.join(temporary, i + '-regular.html'),
+            worker = path.join(temporary, i + '-worker.html'),
+            expected,
+            actual,
+            same;
+
+        fs.writeFileSync(regular, page(args.bundle, testCase, false));
+        fs.writeFileSync(worker, page(args.bundle, testCase, true));
+        expected = await runPage(browser, regular);
+        actual = await runPage(browser, worker);
+        same = !expected.error && JSON.stringify(expected) === JSON.stringify(actual);
+
+        process.stdout.write((same ? 'ok      ' : 'FAILED  ') + testCase.name + '\n');
+        if (!same) {
+            process.stdout.write('  expected ' + JSON.stringify(expected) + '\n');
+            process.stdout.write('  actual   ' + JSON.stringify(actual) + '\n');
+            failed++;
+        }
+    }
+
+    browser.close();
+    fs.rmSync(temporary, { recursive: true, force: true });
+    process.exit(failed ? 1 : 0);
+}
+
+main();
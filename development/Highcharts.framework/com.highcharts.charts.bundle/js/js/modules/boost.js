@@ -19,7 +19,7 @@ a.bufferData(a.ARRAY_BUFFER,n||h,a.STATIC_DRAW);m=a.getAttribLocation(c.program(
 a.options.xData||a.processedXData,b=(b?a.data:d||a.options.data).length,"treemap"===a.type?b*=12:"heatmap"===a.type?b*=6:N[a.type]&&(b*=2),b):0}function e(){d.clear(d.COLOR_BUFFER_BIT|d.DEPTH_BUFFER_BIT)}function f(a,b){function d(a){a&&(b.colorData.push(a[0]),b.colorData.push(a[1]),b.colorData.push(a[2]),b.colorData.push(a[3]))}function c(a,b,c,e,f){d(f);p.usePreallocated?z.push(a,b,c?1:0,e||1):(E.push(a),E.push(b),E.push(c?1:0),E.push(e||1))}function e(a,b,e,f,t){d(t);c(a+e,b);d(t);c(a,b);d(t);
 c(a,b+f);d(t);c(a,b+f);d(t);c(a+e,b+f);d(t);c(a+e,b)}function f(a){p.useGPUTranslations||(b.skipTranslation=!0,a.x=G.toPixels(a.x,!0),a.y=D.toPixels(a.y,!0));c(a.x,a.y,0,2)}var ja=a.pointArrayMap&&"low,high"===a.pointArrayMap.join(","),h=a.chart,t=a.options,m=!!t.stacking,g=t.data,n=a.xAxis.getExtremes(),k=n.min,n=n.max,q=a.yAxis.getExtremes(),x=q.min,q=q.max,r=a.xData||t.xData||a.processedXData,C=a.yData||t.yData||a.processedYData,w=a.zData||t.zData||a.processedZData,D=a.yAxis,G=a.xAxis,Y=a.chart.plotHeight,
 T=!r||0===r.length,u=a.points||!1,F=!1,I=!1,y,Q,R,g=m?a.data:r||g,r={x:Number.MIN_VALUE,y:0},J={x:Number.MIN_VALUE,y:0},S=0,v,K,A=-1,H=!1,U=!1,M="undefined"===typeof h.index,W=!1,L=!1,V=N[a.type],O=!1,P=!0;if(!(t.boostData&&0<t.boostData.length))if(a.closestPointRangePx=Number.MAX_VALUE,u&&0<u.length)b.skipTranslation=!0,b.drawMode="triangles",u[0].node&&u[0].node.levelDynamic&&u.sort(function(a,b){if(a.node){if(a.node.levelDynamic>b.node.levelDynamic)return 1;if(a.node.levelDynamic<b.node.levelDynamic)return-1}return 0}),
-B(u,function(b){var d=b.plotY,c;"undefined"===typeof d||isNaN(d)||null===b.y||(d=b.shapeArgs,c=b.series.colorAttribs(b),b=c["stroke-width"]||0,Q=l.color(c.fill).rgba,Q[0]/=255,Q[1]/=255,Q[2]/=255,"treemap"===a.type&&(b=b||1,R=l.color(c.stroke).rgba,R[0]/=255,R[1]/=255,R[2]/=255,e(d.x,d.y,d.width,d.height,R),b/=2),"heatmap"===a.type&&h.inverted&&(d.x=G.len-d.x,d.y=D.len-d.y,d.width=-d.width,d.height=-d.height),e(d.x+b,d.y+b,d.width-2*b,d.height-2*b,Q))});else{for(;A<g.length-1;){y=g[++A];if(M)break;
+B(u,function(b){var d=b.plotY,c;"undefined"===typeof d||isNaN(d)||null===b.y||(d=b.shapeArgs,c=b.series.colorAttribs(b),b=c["stroke-width"]||0,Q=a.colorAxis&&a.colorAxis.getRGBA?a.colorAxis.getRGBA(c.fill):(Q=l.color(c.fill).rgba,Q[0]/=255,Q[1]/=255,Q[2]/=255,Q),"treemap"===a.type&&(b=b||1,R=l.color(c.stroke).rgba,R[0]/=255,R[1]/=255,R[2]/=255,e(d.x,d.y,d.width,d.height,R),b/=2),"heatmap"===a.type&&h.inverted&&(d.x=G.len-d.x,d.y=D.len-d.y,d.width=-d.width,d.height=-d.height),e(d.x+b,d.y+b,d.width-2*b,d.height-2*b,Q))});else{for(;A<g.length-1;){y=g[++A];if(M)break;
 T?(u=y[0],v=y[1],g[A+1]&&(U=g[A+1][0]),g[A-1]&&(H=g[A-1][0]),3<=y.length&&(K=y[2],y[2]>b.zMax&&(b.zMax=y[2]),y[2]<b.zMin&&(b.zMin=y[2]))):(u=y,v=C[A],g[A+1]&&(U=g[A+1]),g[A-1]&&(H=g[A-1]),w&&w.length&&(K=w[A],w[A]>b.zMax&&(b.zMax=w[A]),w[A]<b.zMin&&(b.zMin=w[A])));U&&U>=k&&U<=n&&(W=!0);H&&H>=k&&H<=n&&(L=!0);ja?(T&&(v=y.slice(1,3)),v=v[1]):m&&(u=y.x,v=y.stackY);a.requireSorting||(P=v>=x&&v<=q);u>n&&J.x<n&&(J.x=u,J.y=v);u<k&&r.x<k&&(r.x=u,r.y=v);if(0===v||v&&P)if(u>=k&&u<=n&&(O=!0),O||W||L)p.useGPUTranslations||
 (b.skipTranslation=!0,u=G.toPixels(u,!0),v=D.toPixels(v,!0),v>Y&&(v=Y)),V&&(y=0,0>v&&(y=v,v=0),p.useGPUTranslations||(y=D.toPixels(y,!0)),c(u,y,0,0,!1)),b.hasMarkers&&!1!==F&&(a.closestPointRangePx=Math.min(a.closestPointRangePx,Math.abs(u-F))),!p.useGPUTranslations&&!p.usePreallocated&&F&&1>u-F&&I&&1>Math.abs(v-I)?p.debug.showSkipSummary&&++S:(t.step&&c(u,I,0,2,!1),c(u,v,0,"bubble"===a.type?K||1:2,!1),F=u,I=v)}p.debug.showSkipSummary&&console.log("skipped points:",S);F||(f(r),f(J))}}function b(){x=
 [];I.data=E=[];T=[];z&&z.destroy()}function m(a){h&&(h.setUniform("xAxisTrans",a.transA),h.setUniform("xAxisMin",a.min),h.setUniform("xAxisMinPad",a.minPixelPadding),h.setUniform("xAxisPointRange",a.pointRange),h.setUniform("xAxisLen",a.len),h.setUniform("xAxisPos",a.pos),h.setUniform("xAxisCVSCoord",!a.horiz))}function g(a){h&&(h.setUniform("yAxisTrans",a.transA),h.setUniform("yAxisMin",a.min),h.setUniform("yAxisMinPad",a.minPixelPadding),h.setUniform("yAxisPointRange",a.pointRange),h.setUniform("yAxisLen",
@@ -0,0 +1,16 @@
+/*
+ Highcharts JS v6.0.2 (2017-10-20)
+ Incremental data module
+
+ (c) 2009-2017 Highsoft AS
+
+ License: www.highcharts.com/license
+*/
+(function(a){if(typeof module==='object'&&module.exports){module.exports=a;}else{a(Highcharts);}}(function(a){(function(a){var b=a.each,f=a.inArray,i=a.isNumber,e=a.map,j=a.merge,n=a.pick,q=a.splat,c=a.Chart;function g(h){var g=h.valueCount,m=h.columns,l=[],a,d,i,c;function k(c){var a=true;b(c,function(b){if(b.columnIndex===undefined){a=false;}});return a;}function j(c){var a=true;b(c,function(b){if(b.configName!=='x'&&b.configName!=='y'&&b.configName!==undefined){a=false;}});l.push({pointIsArray:a,
+readers:c});}b(g.seriesBuilders,function(a){if(k(a.readers)){j(e(a.readers,function(a){return{columnIndex:a.columnIndex,configName:a.configName};}));}});a=h.getFreeIndexes(m.length,g.seriesBuilders);while(a.length>0){d=[{columnIndex:0,configName:'x'}];i=f(0,a);if(i!==-1){a.splice(i,1);}for(c=0;c<g.global;c++){d.push({columnIndex:a.shift(),configName:g.globalPointArrayMap[c]});}if(k(d)){j(d);}}return l;}function h(a){var i=a.chartOptions,j=a.options.columnTypes||[],k=!!(i&&i.xAxis&&q(i.xAxis)[0].type==='category'),
+d=a.incremental,c,h;if(d){return d;}c=g(a);h=c.length&&c[0].readers.length&&a.columns[c[0].readers[0].columnIndex];d=a.incremental={layouts:c,xAxisType:h&&(h.isDatetime?'datetime':(!h.isNumeric?'category':undefined)),columns:e(a.columns,function(b,c){var d=f(c,a.valueCount.xColumns)!==-1;return{isX:d,type:j[c],isCategory:d&&(k||j[c]==='string'),isDatetime:!!b.isDatetime,isNumeric:!!b.isNumeric,mixed:!!b.mixed};})};if(d.xAxisType==='category'){b(c,function(a){b(a.readers,function(a){if(a.configName==='x'){a.configName='name';
+}});});}return d;}function l(g,a,f,b){var e=g.trim(f),j=g.trim(f,true),c=parseFloat(j),d=false,h=false;if(a.isCategory){b.value=''+e;return true;}if(a.isX&&a.mixed){b.value=e;return false;}if(+j===c){if(c>31536E6&&a.type!=='float'){d=true;}else{h=true;}}else if(a.isX&&a.type!=='float'){c=g.parseDate(f);if(i(c)){d=true;}}if(d||h){b.value=c;return!a.isX||(d?a.isDatetime:a.isNumeric);}b.value=e===''?null:e;return!a.isX||b.value===null||(!a.isDatetime&&!a.isNumeric);}function m(a,j,h,i){var f=a.columns,
+c=a.rawColumns,g=a.firstRowAsNames?1:0,d={},e=true;b(h,function(m,k){var h=i+k;b(f,function(i,b){var f=m[b];if(!l(a,j.columns[b],f,d)){e=false;}i[h]=d.value;if(c[b]&&c[b]!==i){c[b][h+g]=a.trim(f);}});});return e;}function o(a,d,e){var c=a.pointIsArray?[]:{};b(a.readers,function(b){var f=d[b.columnIndex][e];if(a.pointIsArray){c.push(f);}else{c[b.configName]=f;}});return c;}function p(b,g){var c=b.chart,f=e(b.rawColumns,function(a,c){return a===b.columns[c]&&b.firstRowAsNames?[a.name].concat(a):a.slice();
+}),d=j(b.options,{csv:null,rows:null,table:null,googleSpreadsheetKey:null,switchRowsAndColumns:false,dateFormat:b.options.dateFormat||b.dateFormat});d.columns=f;d.afterComplete=function(a){c.update(a,g);};c.data=a.data(d,b.chartOptions);c.data.chart=c;}function k(a,f,c,e){var d=a.data.columns;b(f.layouts,function(l,k){var f=a.series[k],g,b,h,i,j=false;if(!f){return;}g=f.options.data||[];for(b=c;b<c+e;b++){i=o(l,d,b);if(b>=g.length){f.addPoint(i,false,false,false);}else{h=f.data[b];if(h&&h.update){h.update(i,
+false,false);}else{g[b]=i;j=true;}}}if(j){f.setData(g.slice(),false,false,false);}});}function r(b,a,c){if(!!c===!b.options.switchRowsAndColumns){return b.rowsToColumns(a)||[];}return a;}function d(d,i,l,b,c,j){var a=d.data,g,f,e;if(!a||!a.columns||!a.columns.length||!i){return;}g=h(a);f=r(a,i,l);e=a.columns[0].length;b=b===undefined?e:Math.min(b,e);c=n(c,true);if(!m(a,g,f,b)||a.options.sort){p(a,c);return;}k(d,g,b,f.length);if(c){d.redraw(j);}}c.prototype.addDataRows=function(c,b,a){d(this,c,false,
+undefined,b,a);};c.prototype.addDataColumns=function(b,c,a){d(this,b,true,undefined,c,a);};c.prototype.updateDataRows=function(e,c,b,a){d(this,c,false,e,b,a);};c.prototype.updateDataColumns=function(e,b,c,a){d(this,b,true,e,c,a);};}(a));}));
@@ -5,21 +5,37 @@
 
  License: www.highcharts.com/license
 */
-(function(k){"object"===typeof module&&module.exports?module.exports=k:k(Highcharts)})(function(k){(function(b){var g=b.Axis,w=b.Chart,n=b.color,p,h=b.each,t=b.extend,u=b.isNumber,q=b.Legend,l=b.LegendSymbolMixin,e=b.noop,r=b.merge,k=b.pick,v=b.wrap;b.ColorAxis||(p=b.ColorAxis=function(){this.init.apply(this,arguments)},t(p.prototype,g.prototype),t(p.prototype,{defaultColorAxisOptions:{lineWidth:0,minPadding:0,maxPadding:0,gridLineWidth:1,tickPixelInterval:72,startOnTick:!0,endOnTick:!0,offset:0,
-marker:{animation:{duration:50},width:.01},labels:{overflow:"justify",rotation:0},minColor:"#e6ebf5",maxColor:"#003399",tickLength:5,showInLegend:!0},keepProps:["legendGroup","legendItemHeight","legendItemWidth","legendItem","legendSymbol"].concat(g.prototype.keepProps),init:function(a,c){var d="vertical"!==a.options.legend.layout,m;this.coll="colorAxis";m=r(this.defaultColorAxisOptions,{side:d?2:1,reversed:!d},c,{opposite:!d,showEmpty:!1,title:null});g.prototype.init.call(this,a,m);c.dataClasses&&
-this.initDataClasses(c);this.initStops();this.horiz=d;this.zoomEnabled=!1;this.defaultLegendLength=200},initDataClasses:function(a){var c,d=0,m=this.chart.options.chart.colorCount,f=this.options,b=a.dataClasses.length;this.dataClasses=c=[];this.legendItems=[];h(a.dataClasses,function(a,l){a=r(a);c.push(a);"category"===f.dataClassColor?(a.colorIndex=d,d++,d===m&&(d=0)):a.color=n(f.minColor).tweenTo(n(f.maxColor),2>b?.5:l/(b-1))})},setTickPositions:function(){if(!this.dataClasses)return g.prototype.setTickPositions.call(this)},
-initStops:function(){this.stops=this.options.stops||[[0,this.options.minColor],[1,this.options.maxColor]];h(this.stops,function(a){a.color=n(a[1])})},setOptions:function(a){g.prototype.setOptions.call(this,a);this.options.crosshair=this.options.marker},setAxisSize:function(){var a=this.legendSymbol,c=this.chart,d=c.options.legend||{},m,f;a?(this.left=d=a.attr("x"),this.top=m=a.attr("y"),this.width=f=a.attr("width"),this.height=a=a.attr("height"),this.right=c.chartWidth-d-f,this.bottom=c.chartHeight-
-m-a,this.len=this.horiz?f:a,this.pos=this.horiz?d:m):this.len=(this.horiz?d.symbolWidth:d.symbolHeight)||this.defaultLegendLength},normalizedValue:function(a){this.isLog&&(a=this.val2lin(a));return 1-(this.max-a)/(this.max-this.min||1)},toColor:function(a,c){var d=this.stops,m,f,b=this.dataClasses,l,e;if(b)for(e=b.length;e--;){if(l=b[e],m=l.from,d=l.to,(void 0===m||a>=m)&&(void 0===d||a<=d)){c&&(c.dataClass=e,c.colorIndex=l.colorIndex);break}}else{a=this.normalizedValue(a);for(e=d.length;e--&&!(a>
-d[e][0]););m=d[e]||d[e+1];d=d[e+1]||m;a=1-(d[0]-a)/(d[0]-m[0]||1);f=m.color.tweenTo(d.color,a)}return f},getOffset:function(){var a=this.legendGroup,c=this.chart.axisOffset[this.side];a&&(this.axisParent=a,g.prototype.getOffset.call(this),this.added||(this.added=!0,this.labelLeft=0,this.labelRight=this.width),this.chart.axisOffset[this.side]=c)},setLegendColor:function(){var a,c=this.reversed;a=c?1:0;c=c?0:1;a=this.horiz?[a,0,c,0]:[0,c,0,a];this.legendColor={linearGradient:{x1:a[0],y1:a[1],x2:a[2],
-y2:a[3]},stops:this.stops}},drawLegendSymbol:function(a,c){var d=a.padding,b=a.options,f=this.horiz,l=k(b.symbolWidth,f?this.defaultLegendLength:12),e=k(b.symbolHeight,f?12:this.defaultLegendLength),h=k(b.labelPadding,f?16:30),b=k(b.itemDistance,10);this.setLegendColor();c.legendSymbol=this.chart.renderer.rect(0,a.baseline-11,l,e).attr({zIndex:1}).add(c.legendGroup);this.legendItemWidth=l+d+(f?b:h);this.legendItemHeight=e+d+(f?h:0)},setState:e,visible:!0,setVisible:e,getSeriesExtremes:function(){var a=
-this.series,c=a.length;this.dataMin=Infinity;for(this.dataMax=-Infinity;c--;)void 0!==a[c].valueMin&&(this.dataMin=Math.min(this.dataMin,a[c].valueMin),this.dataMax=Math.max(this.dataMax,a[c].valueMax))},drawCrosshair:function(a,c){var d=c&&c.plotX,b=c&&c.plotY,f,l=this.pos,e=this.len;c&&(f=this.toPixels(c[c.series.colorKey]),f<l?f=l-2:f>l+e&&(f=l+e+2),c.plotX=f,c.plotY=this.len-f,g.prototype.drawCrosshair.call(this,a,c),c.plotX=d,c.plotY=b,this.cross&&this.cross.addClass("highcharts-coloraxis-marker").add(this.legendGroup))},
-getPlotLinePath:function(a,c,d,b,f){return u(f)?this.horiz?["M",f-4,this.top-6,"L",f+4,this.top-6,f,this.top,"Z"]:["M",this.left,f,"L",this.left-6,f+6,this.left-6,f-6,"Z"]:g.prototype.getPlotLinePath.call(this,a,c,d,b)},update:function(a,c){var d=this.chart,b=d.legend;h(this.series,function(a){a.isDirtyData=!0});a.dataClasses&&b.allItems&&(h(b.allItems,function(a){a.isDataClass&&a.legendGroup&&a.legendGroup.destroy()}),d.isDirtyLegend=!0);d.options[this.coll]=r(this.userOptions,a);g.prototype.update.call(this,
-a,c);this.legendItem&&(this.setLegendColor(),b.colorizeItem(this,!0))},remove:function(){this.legendItem&&this.chart.legend.destroyItem(this);g.prototype.remove.call(this)},getDataClassLegendSymbols:function(){var a=this,c=this.chart,d=this.legendItems,m=c.options.legend,f=m.valueDecimals,p=m.valueSuffix||"",g;d.length||h(this.dataClasses,function(m,q){var k=!0,r=m.from,n=m.to;g="";void 0===r?g="\x3c ":void 0===n&&(g="\x3e ");void 0!==r&&(g+=b.numberFormat(r,f)+p);void 0!==r&&void 0!==n&&(g+=" - ");
-void 0!==n&&(g+=b.numberFormat(n,f)+p);d.push(t({chart:c,name:g,options:{},drawLegendSymbol:l.drawRectangle,visible:!0,setState:e,isDataClass:!0,setVisible:function(){k=this.visible=!k;h(a.series,function(a){h(a.points,function(a){a.dataClass===q&&a.setVisible(k)})});c.legend.colorizeItem(this,k)}},m))});return d},name:""}),h(["fill","stroke"],function(a){b.Fx.prototype[a+"Setter"]=function(){this.elem.attr(a,n(this.start).tweenTo(n(this.end),this.pos),null,!0)}}),v(w.prototype,"getAxes",function(a){var c=
-this.options.colorAxis;a.call(this);this.colorAxis=[];c&&new p(this,c)}),v(q.prototype,"getAllItems",function(a){var c=[],d=this.chart.colorAxis[0];d&&d.options&&(d.options.showInLegend&&(d.options.dataClasses?c=c.concat(d.getDataClassLegendSymbols()):c.push(d)),h(d.series,function(a){a.options.showInLegend=!1}));return c.concat(a.call(this))}),v(q.prototype,"colorizeItem",function(a,c,d){a.call(this,c,d);d&&c.legendColor&&c.legendSymbol.attr({fill:c.legendColor})}),v(q.prototype,"update",function(a){a.apply(this,
-[].slice.call(arguments,1));this.chart.colorAxis[0]&&this.chart.colorAxis[0].update({},arguments[2])}))})(k);(function(b){var g=b.defined,k=b.each,n=b.noop;b.colorPointMixin={isValid:function(){return null!==this.value},setVisible:function(b){var h=this,g=b?"show":"hide";k(["graphic","dataLabel"],function(b){if(h[b])h[b][g]()})},setState:function(g){b.Point.prototype.setState.call(this,g);this.graphic&&this.graphic.attr({zIndex:"hover"===g?1:0})}};b.colorSeriesMixin={pointArrayMap:["value"],axisTypes:["xAxis",
-"yAxis","colorAxis"],optionalAxis:"colorAxis",trackerGroups:["group","markerGroup","dataLabelsGroup"],getSymbol:n,parallelArrays:["x","y","value"],colorKey:"value",translateColors:function(){var b=this,g=this.options.nullColor,n=this.colorAxis,u=this.colorKey;k(this.data,function(h){var l=h[u];if(l=h.options.color||(h.isNull?g:n&&void 0!==l?n.toColor(l,h):h.color||b.color))h.color=l})},colorAttribs:function(b){var h={};g(b.color)&&(h[this.colorProp||"fill"]=b.color);return h}}})(k);(function(b){var g=
-b.colorPointMixin,k=b.each,n=b.merge,p=b.noop,h=b.pick,t=b.Series,u=b.seriesType,q=b.seriesTypes;u("heatmap","scatter",{animation:!1,borderWidth:0,dataLabels:{formatter:function(){return this.point.value},inside:!0,verticalAlign:"middle",crop:!1,overflow:!1,padding:0},marker:null,pointRange:null,tooltip:{pointFormat:"{point.x}, {point.y}: {point.value}\x3cbr/\x3e"},states:{normal:{animation:!0},hover:{halo:!1,brightness:.2}}},n(b.colorSeriesMixin,{pointArrayMap:["y","value"],hasPointSpecificOptions:!0,
-getExtremesFromAll:!0,directTouch:!0,init:function(){var b;q.scatter.prototype.init.apply(this,arguments);b=this.options;b.pointRange=h(b.pointRange,b.colsize||1);this.yAxis.axisPointRange=b.rowsize||1},translate:function(){var b=this.options,e=this.xAxis,g=this.yAxis,n=b.pointPadding||0,p=function(a,b,d){return Math.min(Math.max(b,a),d)};this.generatePoints();k(this.points,function(a){var c=(b.colsize||1)/2,d=(b.rowsize||1)/2,l=p(Math.round(e.len-e.translate(a.x-c,0,1,0,1)),-e.len,2*e.len),c=p(Math.round(e.len-
-e.translate(a.x+c,0,1,0,1)),-e.len,2*e.len),f=p(Math.round(g.translate(a.y-d,0,1,0,1)),-g.len,2*g.len),d=p(Math.round(g.translate(a.y+d,0,1,0,1)),-g.len,2*g.len),k=h(a.pointPadding,n);a.plotX=a.clientX=(l+c)/2;a.plotY=(f+d)/2;a.shapeType="rect";a.shapeArgs={x:Math.min(l,c)+k,y:Math.min(f,d)+k,width:Math.abs(c-l)-2*k,height:Math.abs(d-f)-2*k}});this.translateColors()},drawPoints:function(){q.column.prototype.drawPoints.call(this);k(this.points,function(b){b.graphic.css(this.colorAttribs(b))},this)},
-animate:p,getBox:p,drawLegendSymbol:b.LegendSymbolMixin.drawRectangle,alignDataLabel:q.column.prototype.alignDataLabel,getExtremes:function(){t.prototype.getExtremes.call(this,this.valueData);this.valueMin=this.dataMin;this.valueMax=this.dataMax;t.prototype.getExtremes.call(this)}}),b.extend({haloPath:function(b){if(!b)return[];var e=this.shapeArgs;return["M",e.x-b,e.y-b,"L",e.x-b,e.y+e.height+b,e.x+e.width+b,e.y+e.height+b,e.x+e.width+b,e.y-b,"Z"]}},g))})(k)});
+(function(a){if(typeof module==='object'&&module.exports){module.exports=a;}else{a(Highcharts);}}(function(a){(function(a){var c=a.Axis,m=a.Chart,d=a.color,e,b=a.each,i=a.extend,j=a.isNumber,h=a.Legend,n=a.LegendSymbolMixin,l=a.noop,k=a.merge,f=a.pick,g=a.wrap;if(!a.ColorAxis){e=a.ColorAxis=function(){this.init.apply(this,arguments);};i(e.prototype,c.prototype);i(e.prototype,{defaultColorAxisOptions:{lineWidth:0,minPadding:0,maxPadding:0,gridLineWidth:1,tickPixelInterval:72,startOnTick:true,endOnTick:true,
+offset:0,marker:{animation:{duration:50},width:0.01},labels:{overflow:'justify',rotation:0},minColor:'#e6ebf5',maxColor:'#003399',tickLength:5,showInLegend:true},colorTableLength:1024,keepProps:['legendGroup','legendItemHeight','legendItemWidth','legendItem','legendSymbol'].concat(c.prototype.keepProps),init:function(d,b){var a=d.options.legend.layout!=='vertical',e;this.coll='colorAxis';e=k(this.defaultColorAxisOptions,{side:a?2:1,reversed:!a},b,{opposite:!a,showEmpty:false,title:null});c.prototype.init.call(this,
+d,e);if(b.dataClasses){this.initDataClasses(b);}this.initStops();this.horiz=a;this.zoomEnabled=false;this.defaultLegendLength=200;},initDataClasses:function(g){var h=this.chart,e,a=0,i=h.options.chart.colorCount,c=this.options,f=g.dataClasses.length;this.dataClasses=e=[];this.legendItems=[];b(g.dataClasses,function(b,g){b=k(b);e.push(b);if(c.dataClassColor==='category'){b.colorIndex=a;a++;if(a===i){a=0;}}else{b.color=d(c.minColor).tweenTo(d(c.maxColor),f<2?0.5:g/(f-1));}});this.initDataClassIndex();
+},initDataClassIndex:function(){var f=this.dataClasses,c=[],k=[],i=true,d,h,g,e;b(f,function(a){b([a.from,a.to],function(a){if(a!==undefined){i=i&&j(a);c.push(a);}});});if(!i){this.dataClassIndex=undefined;return;}c.sort(function(a,b){return a-b;});c=a.grep(c,function(b,a){return b!==c[a-1];});for(d=0;d<=2*c.length;d++){if(d%2){h=g=c[(d-1)/2];}else{h=d?c[d/2-1]:-Infinity;g=d<2*c.length?c[d/2]:Infinity;}e=f.length;while(e--){if((f[e].from===undefined||f[e].from<=h)&&(f[e].to===undefined||f[e].to>=g)){break;
+}}k[d]=e;}this.dataClassIndex={limits:c,classes:k};},getDataClass:function(c){var i=this.dataClasses,h=this.dataClassIndex,f,a=0,d,g,b,e;if(h&&j(c)){f=h.limits;d=f.length;while(a<d){g=(a+d)>>1;if(f[g]<c){a=g+1;}else{d=g;}}return h.classes[f[a]===c?2*a+1:2*a];}e=i.length;while(e--){b=i[e];if((b.from===undefined||c>=b.from)&&(b.to===undefined||c<=b.to)){break;}}return e;},setTickPositions:function(){if(!this.dataClasses){return c.prototype.setTickPositions.call(this);}},initStops:function(){this.stops=this.options.stops||[[0,
+this.options.minColor],[1,this.options.maxColor]];b(this.stops,function(a){a.color=d(a[1]);});this.initColorTable();},initColorTable:function(){var g=this.colorTableLength,e=[],f,h={},c,a,b;this.colorTable=this.colorTableRGBA=undefined;this.rgbaCache=h;if(this.dataClasses){return;}for(a=0;a<this.stops.length;a++){c=this.stops[a].color.rgba;if(!c||!c.length){return;}}f=new Float32Array(g*4);for(a=0;a<g;a++){e[a]=this.getStopColor(a/(g-1));c=d(e[a]).rgba;for(b=0;b<4;b++){f[a*4+b]=b<3?c[b]/255:c[b];
+}if(!h[e[a]]){h[e[a]]=f.subarray(a*4,a*4+4);}}this.colorTable=e;this.colorTableRGBA=f;},getRGBA:function(c){var e=this.rgbaCache,b=e&&e[c],f=this.dataClasses,a;if(!b){b=d(c).rgba;for(a=0;a<3;a++){b[a]/=255;}if(e&&f){a=f.length;while(a--){if(f[a].color===c){e[c]=b;break;}}}}return b;},setOptions:function(a){c.prototype.setOptions.call(this,a);this.options.crosshair=this.options.marker;},setAxisSize:function(){var a=this.legendSymbol,b=this.chart,g=b.options.legend||{},e,f,d,c;if(a){this.left=e=a.attr('x');
+this.top=f=a.attr('y');this.width=d=a.attr('width');this.height=c=a.attr('height');this.right=b.chartWidth-e-d;this.bottom=b.chartHeight-f-c;this.len=this.horiz?d:c;this.pos=this.horiz?e:f;}else{this.len=(this.horiz?g.symbolWidth:g.symbolHeight)||this.defaultLegendLength;}},normalizedValue:function(a){if(this.isLog){a=this.val2lin(a);}return 1-((this.max-a)/((this.max-this.min)||1));},getStopColor:function(d){var b=this.stops,c,e,a=b.length;while(a--){if(d>b[a][0]){break;}}c=b[a]||b[a+1];e=b[a+1]||c;
+d=1-(e[0]-d)/((e[0]-c[0])||1);return c.color.tweenTo(e.color,d);},toColor:function(h,e){var b,d=this.colorTable,c,g=this.dataClasses,f,a;if(g){a=this.getDataClass(h);if(a>-1){f=g[a];if(e){e.dataClass=a;e.colorIndex=f.colorIndex;}}}else{b=this.normalizedValue(h);if(d&&isFinite(b)){c=d[Math.round(Math.min(Math.max(b,0),1)*(d.length-1))];}else{c=this.getStopColor(b);}}return c;},getOffset:function(){var a=this.legendGroup,b=this.chart.axisOffset[this.side];if(a){this.axisParent=a;c.prototype.getOffset.call(this);
+if(!this.added){this.added=true;this.labelLeft=0;this.labelRight=this.width;}this.chart.axisOffset[this.side]=b;}},setLegendColor:function(){var a,c=this.reversed,b=c?1:0,d=c?0:1;a=this.horiz?[b,0,d,0]:[0,d,0,b];this.legendColor={linearGradient:{x1:a[0],y1:a[1],x2:a[2],y2:a[3]},stops:this.stops};},drawLegendSymbol:function(c,e){var h=c.padding,b=c.options,a=this.horiz,i=f(b.symbolWidth,a?this.defaultLegendLength:12),d=f(b.symbolHeight,a?12:this.defaultLegendLength),g=f(b.labelPadding,a?16:30),j=f(b.itemDistance,
+10);this.setLegendColor();e.legendSymbol=this.chart.renderer.rect(0,c.baseline-11,i,d).attr({zIndex:1}).add(e.legendGroup);this.legendItemWidth=i+h+(a?j:g);this.legendItemHeight=d+h+(a?g:0);},setState:l,visible:true,setVisible:l,getSeriesExtremes:function(){var b=this.series,a=b.length;this.dataMin=Infinity;this.dataMax=-Infinity;while(a--){if(b[a].valueMin!==undefined){this.dataMin=Math.min(this.dataMin,b[a].valueMin);this.dataMax=Math.max(this.dataMax,b[a].valueMax);}}},drawCrosshair:function(f,
+a){var g=a&&a.plotX,h=a&&a.plotY,b,d=this.pos,e=this.len;if(a){b=this.toPixels(a[a.series.colorKey]);if(b<d){b=d-2;}else if(b>d+e){b=d+e+2;}a.plotX=b;a.plotY=this.len-b;c.prototype.drawCrosshair.call(this,f,a);a.plotX=g;a.plotY=h;if(this.cross){this.cross.addClass('highcharts-coloraxis-marker').add(this.legendGroup);}}},getPlotLinePath:function(b,d,e,f,a){return j(a)?(this.horiz?['M',a-4,this.top-6,'L',a+4,this.top-6,a,this.top,'Z']:['M',this.left,a,'L',this.left-6,a+6,this.left-6,a-6,'Z']):c.prototype.getPlotLinePath.call(this,
+b,d,e,f);},update:function(e,f){var a=this.chart,d=a.legend;b(this.series,function(a){a.isDirtyData=true;});if(e.dataClasses&&d.allItems){b(d.allItems,function(a){if(a.isDataClass&&a.legendGroup){a.legendGroup.destroy();}});a.isDirtyLegend=true;}a.options[this.coll]=k(this.userOptions,e);c.prototype.update.call(this,e,f);if(this.legendItem){this.setLegendColor();d.colorizeItem(this,true);}},remove:function(){if(this.legendItem){this.chart.legend.destroyItem(this);}c.prototype.remove.call(this);},
+getDataClassLegendSymbols:function(){var j=this,d=this.chart,e=this.legendItems,f=d.options.legend,g=f.valueDecimals,h=f.valueSuffix||'',c;if(!e.length){b(this.dataClasses,function(o,p){var m=true,f=o.from,k=o.to;c='';if(f===undefined){c='< ';}else if(k===undefined){c='> ';}if(f!==undefined){c+=a.numberFormat(f,g)+h;}if(f!==undefined&&k!==undefined){c+=' - ';}if(k!==undefined){c+=a.numberFormat(k,g)+h;}e.push(i({chart:d,name:c,options:{},drawLegendSymbol:n.drawRectangle,visible:true,setState:l,isDataClass:true,
+setVisible:function(){m=this.visible=!m;b(j.series,function(a){b(a.points,function(a){if(a.dataClass===p){a.setVisible(m);}});if(a.rasterLayer){a.drawPoints();}});d.legend.colorizeItem(this,m);}},o));});}return e;},name:''});b(['fill','stroke'],function(b){a.Fx.prototype[b+'Setter']=function(){this.elem.attr(b,d(this.start).tweenTo(d(this.end),this.pos),null,true);};});g(m.prototype,'getAxes',function(c){var b=this.options,a=b.colorAxis;c.call(this);this.colorAxis=[];if(a){new e(this,a);}});g(h.prototype,
+'getAllItems',function(d){var c=[],a=this.chart.colorAxis[0];if(a&&a.options){if(a.options.showInLegend){if(a.options.dataClasses){c=c.concat(a.getDataClassLegendSymbols());}else{c.push(a);}}b(a.series,function(a){a.options.showInLegend=false;});}return c.concat(d.call(this));});g(h.prototype,'colorizeItem',function(c,a,b){c.call(this,a,b);if(b&&a.legendColor){a.legendSymbol.attr({fill:a.legendColor});}});g(h.prototype,'update',function(a){a.apply(this,[].slice.call(arguments,1));if(this.chart.colorAxis[0]){this.chart.colorAxis[0].update({},
+arguments[2]);}});}}(a));(function(a){var c=a.defined,b=a.each,d=a.noop,e=a.seriesTypes;a.colorPointMixin={isValid:function(){return this.value!==null;},setVisible:function(c){var a=this,d=c?'show':'hide';a.visible=c;b(['graphic','dataLabel'],function(b){if(a[b]){a[b][d]();}});},setState:function(d){var b=this,c=b.series;if(c.rasterLayer&&d&&!b.graphic){c.drawRasterState(b);}a.Point.prototype.setState.call(b,d);if(b.graphic){b.graphic.attr({zIndex:d==='hover'?1:0});}if(c.rasterLayer&&!b.state&&!b.selected&&b.graphic){b.graphic=b.graphic.destroy();
+}}};a.colorSeriesMixin={pointArrayMap:['value'],axisTypes:['xAxis','yAxis','colorAxis'],optionalAxis:'colorAxis',trackerGroups:['group','markerGroup','dataLabelsGroup'],getSymbol:d,parallelArrays:['x','y','value'],colorKey:'value',translateColors:function(){var e=this,d=this.options.nullColor,a=this.colorAxis,c=this.colorKey;b(this.data,function(b){var g=b[c],f;f=b.options.color||(b.isNull?d:(a&&g!==undefined)?a.toColor(g,b):b.color||e.color);if(f){b.color=f;}});},colorAttribs:function(a){var b={};
+if(c(a.color)){b[this.colorProp||'fill']=a.color;}return b;}};}(a));(function(a){var k=a.colorPointMixin,b=a.doc,e=a.each,f=a.isNumber,m=a.merge,h=a.noop,g=a.pick,i=a.Pointer,d=a.Series,n=a.seriesType,c=a.seriesTypes,p=a.win,j=!!(b.createElement('canvas').getContext&&b.createElement('canvas').getContext('2d'));function o(d,f){var a=f.shapeArgs,c,e,b=0;if(f.shapeType==='circle'){d.moveTo(a.x+a.r,a.y);d.arc(a.x,a.y,a.r,0,2*Math.PI,false);}else if(f.shapeType==='path'){c=a.d;while(b<c.length){if(typeof c[b]==='string'){e=c[b];
+b++;}if(e==='M'){d.moveTo(c[b],c[b+1]);b+=2;e='L';}else if(e==='L'){d.lineTo(c[b],c[b+1]);b+=2;}else{d.closePath();}}}else{d.rect(a.x,a.y,a.width,a.height);}}function l(e){var b=e.shapeArgs,d,c,f,g,a;if(e.shapeType==='circle'){return{x:b.x-b.r,y:b.y-b.r,width:2*b.r,height:2*b.r};}if(e.shapeType==='path'){d=b.d;a={x:Infinity,y:Infinity,x2:-Infinity,y2:-Infinity};for(c=0;c<d.length;c++){if(typeof d[c]!=='string'){f=d[c];g=d[++c];a.x=Math.min(a.x,f);a.y=Math.min(a.y,g);a.x2=Math.max(a.x2,f);a.y2=Math.max(a.y2,
+g);}}a.width=a.x2-a.x;a.height=a.y2-a.y;return a;}return b;}if(!c.heatmap){a.wrap(i.prototype,'getPointFromEvent',function(d,a){var b=d.call(this,a),c=a.target&&a.target.rasterSeries;if(!b&&c&&c.rasterLayer){b=c.getRasterPointFromEvent(a);}return b;});a.Chart.prototype.callbacks.push(function(b){a.addEvent(b.container,'mousemove',function(a){var d=a.target&&a.target.rasterSeries,c;if(d&&d.rasterLayer){c=d.getRasterPointFromEvent(a);if(c&&c!==b.hoverPoint){c.onMouseOver(a);}}});});}n('heatmap','scatter',
+{animation:false,borderWidth:0,dataLabels:{formatter:function(){return this.point.value;},inside:true,verticalAlign:'middle',crop:false,overflow:false,padding:0},marker:null,pointRange:null,tooltip:{pointFormat:'{point.x}, {point.y}: {point.value}<br/>'},states:{normal:{animation:true},hover:{halo:false,brightness:0.2}},rasterThreshold:1000,interpolation:false},m(a.colorSeriesMixin,{pointArrayMap:['y','value'],hasPointSpecificOptions:true,getExtremesFromAll:true,directTouch:true,init:function(){var a;
+c.scatter.prototype.init.apply(this,arguments);a=this.options;a.pointRange=g(a.pointRange,a.colsize||1);this.yAxis.axisPointRange=a.rowsize||1;},translate:function(){var b=this,f=b.options,a=b.xAxis,c=b.yAxis,h=f.pointPadding||0,d=function(c,a,b){return Math.min(Math.max(a,c),b);};b.generatePoints();e(b.points,function(b){var m=(f.colsize||1)/2,n=(f.rowsize||1)/2,i=d(Math.round(a.len-a.translate(b.x-m,0,1,0,1)),-a.len,2*a.len),j=d(Math.round(a.len-a.translate(b.x+m,0,1,0,1)),-a.len,2*a.len),k=d(Math.round(c.translate(b.y-n,
+0,1,0,1)),-c.len,2*c.len),l=d(Math.round(c.translate(b.y+n,0,1,0,1)),-c.len,2*c.len),e=g(b.pointPadding,h);b.plotX=b.clientX=(i+j)/2;b.plotY=(k+l)/2;b.shapeType='rect';b.shapeArgs={x:Math.min(i,j)+e,y:Math.min(k,l)+e,width:Math.abs(j-i)-e*2,height:Math.abs(l-k)-e*2};});b.translateColors();},drawPoints:function(){var a=this;if(a.isRasterSeries()){a.drawRaster();return;}a.destroyRaster();c.column.prototype.drawPoints.call(a);e(a.points,function(b){if(b.graphic){b.graphic.css(a.colorAttribs(b));}});
+},isRasterSeries:function(){var a=this.options.rasterThreshold;return!!(j&&a&&!this.chart.polar&&this.points&&this.points.length>=a&&this.getRasterGrid());},getRasterGrid:function(){var c=this,j=c.options,t=c.xAxis,u=c.yAxis,k=c.points,i=k.length,o=j.colsize||1,p=j.rowsize||1,e=Infinity,q=-Infinity,g=Infinity,r=-Infinity,s=!!(j.pointPadding||j.borderWidth||t.isLog||u.isLog||t.isBroken||u.isBroken),d,m,n,h,l,a,b;c.rasterGrid=null;for(b=0;b<i;b++){a=k[b];if(typeof a.color!=='string'||!f(a.x)||!f(a.y)||!a.shapeArgs){return null;
+}e=Math.min(e,a.x);q=Math.max(q,a.x);g=Math.min(g,a.y);r=Math.max(r,a.y);if(a.shapeType!=='rect'||a.pointPadding||a.borderWidth){s=true;}}d=Math.round((q-e)/o)+1;m=Math.round((r-g)/p)+1;if(!i||d*m>Math.max(4*i,65536)){return null;}n=new Int32Array(d*m);for(b=0;b<i;b++){h=(k[b].x-e)/o;l=(k[b].y-g)/p;if(Math.abs(h-Math.round(h))>1e-6||Math.abs(l-Math.round(l))>1e-6){return null;}n[Math.round(l)*d+Math.round(h)]=b+1;}c.rasterGrid={xMin:e,yMin:g,colsize:o,rowsize:p,cols:d,rows:m,cells:n,tiled:s};return c.rasterGrid;
+},getRasterLayer:function(){var d=this,e=p.devicePixelRatio||1,h=Math.max(1,Math.ceil(d.xAxis.len)),g=Math.max(1,Math.ceil(d.yAxis.len)),c=d.rasterLayer,a,f;if(!c){a=b.createElement('canvas');c=d.rasterLayer={canvas:a,ctx:a.getContext('2d'),image:d.chart.renderer.image('',0,0,0,0).add(d.group)};c.image.element.rasterSeries=d;}a=c.canvas;f=c.ctx;if(a.width!==h*e){a.width=h*e;}if(a.height!==g*e){a.height=g*e;}f.setTransform(1,0,0,1,0,0);f.clearRect(0,0,a.width,a.height);f.setTransform(e,0,0,e,0,0);
+c.image.attr({width:h,height:g});return c;},destroyRaster:function(){var a=this;if(a.rasterLayer){a.rasterLayer.image.destroy();delete a.rasterLayer;delete a.rasterBitmap;}},drawRaster:function(){var a=this,b=a.getRasterLayer();e(a.points,function(a){var b=a.graphic;if(b){if(a.state||a.selected){b.attr(a.shapeArgs);}else{a.graphic=b.destroy();}}});if(a.rasterGrid.tiled){a.drawRasterTiles(b.ctx);}else{a.drawRasterBitmap(b.ctx);}b.image.attr({href:b.canvas.toDataURL('image/png')});},drawRasterBitmap:function(o){var h=this,
+c=h.rasterGrid,v=h.points,l=h.xAxis,u=h.yAxis,k=h.rasterBitmap||(h.rasterBitmap=b.createElement('canvas')),m,p,j,r={},n=h.colorAxis,q=n?255:1,e,i,d,s=l.len-l.translate(c.xMin-c.colsize/2,0,1,0,1),w=l.len-l.translate(c.xMin+(c.cols-0.5)*c.colsize,0,1,0,1),t=u.translate(c.yMin-c.rowsize/2,0,1,0,1),x=u.translate(c.yMin+(c.rows-0.5)*c.rowsize,0,1,0,1);k.width=c.cols;k.height=c.rows;m=k.getContext('2d');p=m.createImageData(c.cols,c.rows);j=p.data;for(d=0;d<c.cells.length;d++){i=c.cells[d]&&v[c.cells[d]-1];
+if(i&&i.visible!==false){e=r[i.color];if(!e){e=r[i.color]=n?n.getRGBA(i.color):a.color(i.color).rgba;}if(f(e[0])){j[4*d]=e[0]*q;j[4*d+1]=e[1]*q;j[4*d+2]=e[2]*q;j[4*d+3]=Math.round(255*g(e[3],1));}}}m.putImageData(p,0,0);o.imageSmoothingEnabled=!!h.options.interpolation;o.transform((w-s)/c.cols,0,0,(x-t)/c.rows,s,t);o.drawImage(k,0,0);},drawRasterTiles:function(b){var j=this,e=j.options,i=j.points,k=false,g,f,d,a,c,h=function(){if(k){b.fillStyle=g;b.fill();if(d&&f){b.strokeStyle=f;b.lineWidth=d;b.stroke();
+}}};for(c=0;c<i.length;c++){a=i[c];if(a.visible!==false){if(a.color!==g||(a.borderColor||e.borderColor)!==f||(a.borderWidth||e.borderWidth||0)!==d){h();k=true;g=a.color;f=a.borderColor||e.borderColor;d=a.borderWidth||e.borderWidth||0;b.beginPath();}o(b,a);}}h();},drawRasterState:function(a){var b=this;if(a.shapeArgs){a.graphic=b.chart.renderer[a.shapeType||'rect'](a.shapeArgs).addClass(a.getClassName(),true).css(b.colorAttribs(a)).add(b.group);a.graphic.element.point=a;}},getRasterPointFromEvent:function(d){var g=this,
+p=g.chart,b=g.rasterGrid,h=g.xAxis,k=g.yAxis,s=p.inverted,e,f,m,o,i,j,a,c,n,q,r=Infinity;if(!b){return;}d=p.pointer.normalize(d);e=s?h.len-(d.chartY-h.pos):d.chartX-h.pos;f=s?k.len-(d.chartX-k.pos):d.chartY-k.pos;m=Math.round((h.translate(h.len-e,1,1,0,1)-b.xMin)/b.colsize);o=Math.round((k.translate(f,1,1,0,1)-b.yMin)/b.rowsize);for(i=Math.max(m-1,0);i<=Math.min(m+1,b.cols-1);i++){for(j=Math.max(o-1,0);j<=Math.min(o+1,b.rows-1);j++){a=b.cells[j*b.cols+i];a=a&&g.points[a-1];if(a&&a.visible!==false){c=l(a);
+n=Math.pow(a.plotX-e,2)+Math.pow(a.plotY-f,2);if(e>=c.x&&e<=c.x+c.width&&f>=c.y&&f<=c.y+c.height&&n<r){q=a;r=n;}}}}return q;},destroy:function(){this.destroyRaster();d.prototype.destroy.apply(this,arguments);},animate:h,getBox:h,drawLegendSymbol:a.LegendSymbolMixin.drawRectangle,alignDataLabel:c.column.prototype.alignDataLabel,getExtremes:function(){d.prototype.getExtremes.call(this,this.valueData);this.valueMin=this.dataMin;this.valueMax=this.dataMax;d.prototype.getExtremes.call(this);}}),a.extend({haloPath:function(b){if(!b){return[];
+}var a=this.shapeArgs;return['M',a.x-b,a.y-b,'L',a.x-b,a.y+a.height+b,a.x+a.width+b,a.y+a.height+b,a.x+a.width+b,a.y-b,'Z'];}},k));}(a));}));
@@ -6,12 +6,24 @@
 
  License: www.highcharts.com/license
 */
-(function(m){"object"===typeof module&&module.exports?module.exports=m:m(Highcharts)})(function(m){var w=function(){return function(d){var n=this,k=n.graphic,p=d.animate,m=d.attr,q=d.onComplete,z=d.css,r=d.group,v=d.renderer,D=d.shapeArgs;d=d.shapeType;n.shouldDraw()?(k||(n.graphic=k=v[d](D).add(r)),k.css(z).attr(m).animate(p,void 0,q)):k&&k.animate(p,void 0,function(){n.graphic=k=k.destroy();"function"===typeof q&&q()})}}();(function(d,m){var k=d.each,p=d.extend,n=d.isArray,q=d.isNumber,z=d.isObject,
-r=d.Series,v=function(a,b){return!(b.left>a.right||b.right<a.left||b.top>a.bottom||b.bottom<a.top)},D=function(a,b){var c=!1,g=a.rect,f;a.lastCollidedWith&&(f=a.lastCollidedWith.rect,(c=v(g,f))||delete a.lastCollidedWith);c||(c=!!d.find(b,function(b){var c;f=b.rect;if(c=v(g,f))a.lastCollidedWith=b;return c}));return c},B=function(a){var b=Math.ceil((Math.sqrt(a)-1)/2),c=2*b+1,g=Math.pow(c,2),f=!1,c=c-1;1E4>=a&&("boolean"===typeof f&&a>=g-c&&(f={x:b-(g-a),y:-b}),g-=c,"boolean"===typeof f&&a>=g-c&&
-(f={x:-b,y:-b+(g-a)}),g-=c,"boolean"===typeof f&&(f=a>=g-c?{x:-b+(g-a),y:b}:{x:b,y:b-(g-a-c)}),f.x*=5,f.y*=5);return f},w=function(a,b){a/=b;return{width:256*a,height:256,ratio:a}},C=function(a,b,c){return b+(c-b)/(a-1)*Math.floor(Math.random()*a)},G=function(a,b){a=a.getBBox();var c=b.width/2,g=-(b.height/2),f=b.height/2;return!(-(b.width/2)<a.x&&c>a.x+a.width&&g<a.y&&f>a.y+a.height)};d.seriesType("wordcloud","column",{animation:{duration:500},borderWidth:0,clip:!1,colorByPoint:!0,placementStrategy:"center",
-rotation:{from:0,orientations:2,to:90},showInLegend:!1,spiral:"rectangular",style:{fontFamily:"Impact, sans-serif"},tooltip:{followPointer:!0}},{animate:r.prototype.animate,bindAxes:function(){var a={endOnTick:!1,gridLineWidth:0,lineWidth:0,maxPadding:0,startOnTick:!1,title:null,tickPositions:[]};r.prototype.bindAxes.call(this);p(this.yAxis.options,a);p(this.xAxis.options,a)},deriveFontSize:function(a){return Math.floor(25*a)},drawPoints:function(){var a=this,b=a.hasRendered,c=a.xAxis,g=a.yAxis,f=
-a.group,d=a.options,m=d.animation,n=a.chart.renderer,A=n.text().add(f),r=[],v=a.placementStrategy[d.placementStrategy],B=a.spirals[d.spiral],C=d.rotation,H=a.points.map(function(a){return a.weight}),I=Math.max.apply(null,H),t=w(c.len,g.len),E=a.points.sort(function(a,b){return b.weight-a.weight});k(E,function(c){var g=p({fontSize:a.deriveFontSize(1/I*c.weight),fill:c.color},d.style),l=v(c,{data:E,field:t,placed:r,rotation:C}),h={align:"center",x:l.x,y:l.y,text:c.name,rotation:l.rotation},k,x,e;A.css(g).attr(h);
-c.clientRect=e=p({},A.element.getBoundingClientRect());x=A;for(var w=t,F=1,y={x:0,y:0},u=c.rect=p({},e);(D(c,r)||G(x,w))&&!1!==y;)y=B(F,{field:w}),z(y)&&(u.left=e.left+y.x,u.right=u.left+u.width,u.top=e.top+y.y,u.bottom=u.top+u.height),F++;x=y;if(z(x)){h.x+=x.x;h.y+=x.y;p(l,{left:h.x-e.width/2,right:h.x+e.width/2,top:h.y-e.height/2,bottom:h.y+e.height/2});e=t;if(!q(e.left)||e.left>l.left)e.left=l.left;if(!q(e.right)||e.right<l.right)e.right=l.right;if(!q(e.top)||e.top>l.top)e.top=l.top;if(!q(e.bottom)||
-e.bottom<l.bottom)e.bottom=l.bottom;t=e;r.push(c);c.isNull=!1}else c.isNull=!0;m&&(k={x:h.x,y:h.y},b?(delete h.x,delete h.y):(h.x=0,h.y=0));c.draw({animate:k,attr:h,css:g,group:f,renderer:n,shapeArgs:void 0,shapeType:"text"})});A=A.destroy();c=Math.min(1/(2*Math.max(Math.abs(t.left),Math.abs(t.right)))*c.len,1/(2*Math.max(Math.abs(t.top),Math.abs(t.bottom)))*g.len);a.group.attr({scaleX:c,scaleY:c})},hasData:function(){return z(this)&&!0===this.visible&&n(this.points)&&0<this.points.length},placementStrategy:{random:function(a,
-b){a=b.field;b=b.rotation;return{x:Math.round(a.width*(Math.random()+.5)/2)-a.width/2,y:Math.round(a.height*(Math.random()+.5)/2)-a.height/2,rotation:C(b.orientations,b.from,b.to)}},center:function(a,b){a=b.rotation;return{x:0,y:0,rotation:C(a.orientations,a.from,a.to)}}},pointArrayMap:["weight"],spirals:{archimedean:function(a,b){var c=b.field;b=!1;var c=c.width*c.width+c.height*c.height,d=.2*a;1E4>=a&&(b={x:d*Math.cos(d),y:d*Math.sin(d)},Math.min(Math.abs(b.x),Math.abs(b.y))<c||(b=!1));return b},
-rectangular:function(a,b){a=B(a,b);b=b.field;a&&(a.x*=b.ratio);return a},square:B},getPlotBox:function(){var a=this.chart,b=a.inverted,c=this[b?"yAxis":"xAxis"],b=this[b?"xAxis":"yAxis"];return{translateX:(c?c.left:a.plotLeft)+(c?c.len:a.plotWidth)/2,translateY:(b?b.top:a.plotTop)+(b?b.len:a.plotHeight)/2,scaleX:1,scaleY:1}}},{draw:m,shouldDraw:function(){return!this.isNull}})})(m,w)});
+(function(a){if(typeof module==='object'&&module.exports){module.exports=a;}else{a(Highcharts);}}(function(a){var b=(function(){var a=function l(a){var c=this,b=c.graphic,e=a.animate,f=a.attr,d=a.onComplete,g=a.css,h=a.group,i=a.renderer,j=a.shapeArgs,k=a.shapeType;if(c.shouldDraw()){if(!b){c.graphic=b=i[k](j).add(h);}b.css(g).attr(f).animate(e,undefined,d);}else if(b){b.animate(e,undefined,function(){c.graphic=b=b.destroy();if(typeof d==='function'){d();}});}};return a;}());(function(a,r){var e=a.each,
+f=a.extend,v=a.isArray,g=a.isNumber,l=a.isObject,b=a.win,i=a.Series,d,c,m={keys:[],layouts:{}};var o=16;var p=50;function n(){var b=8,a=Math.floor;function c(a,b){return!(b.left>a.right||b.right<a.left||b.top>a.bottom||b.bottom<a.top);}function e(a){var b=a.left+a.right+a.top+a.bottom;return b-b===0;}function f(b){var c=Math.ceil((Math.sqrt(b)-1)/2),e=2*c+1,d=Math.pow(e,2),f=function(a){return typeof a==='boolean';},a=false;e-=1;if(b<=10000){if(f(a)&&b>=d-e){a={x:c-(d-b),y:-c};}d-=e;if(f(a)&&b>=d-e){a={x:-c,
+y:-c+(d-b)};}d-=e;if(f(a)){if(b>=d-e){a={x:-c+(d-b),y:c};}else{a={x:c,y:c-(d-b-e)};}}a.x*=5;a.y*=5;}return a;}var h={archimedean:function(d,f){var b=f.field,a=false,e=(b.width*b.width)+(b.height*b.height),c=d*0.2;if(d<=10000){a={x:c*Math.cos(c),y:c*Math.sin(c)};if(!(Math.min(Math.abs(a.x),Math.abs(a.y))<e)){a=false;}}return a;},rectangular:function(c,b){var a=f(c,b),d=b.field;if(a){a.x*=d.ratio;}return a;},square:f};function d(a){this.cellSize=a;this.cells={};this.blocks={};this.unbounded=[];}d.prototype={insert:function(c){var h=this,
+i=h.cellSize,j=i*b,k,l,m,d,f,g;if(!e(c)){h.unbounded.push(c);return;}k=a(c.right/i);l=a(c.top/i);m=a(c.bottom/i);for(d=a(c.left/i);d<=k;d++){g=h.cells[d]||(h.cells[d]={});for(f=l;f<=m;f++){(g[f]||(g[f]=[])).push(c);}}k=a(c.right/j);l=a(c.top/j);m=a(c.bottom/j);for(d=a(c.left/j);d<=k;d++){g=h.blocks[d]||(h.blocks[d]={});for(f=l;f<=m;f++){g[f]=(g[f]||0)+1;}}},find:function(f,v){var l=this,m=l.cellSize,w=l.unbounded,o,p,r,s,g,x,h,y,z,n,j,q,k,d,t,u,i;for(d=0;d<w.length;d++){if(c(f,w[d])){return w[d];
+}}if(!e(f)){for(d=0;d<v.length;d++){if(c(f,v[d])){return v[d];}}return;}o=a(f.left/m);p=a(f.right/m);r=a(f.top/m);s=a(f.bottom/m);x=a(p/b);y=a(r/b);z=a(s/b);for(g=a(o/b);g<=x;g++){t=l.blocks[g];for(h=y;t&&h<=z;h++){if(!t[h]){continue;}j=g*b+b-1;j=p<j?p:j;k=h*b+b-1;k=s<k?s:k;for(n=o>g*b?o:g*b;n<=j;n++){u=l.cells[n];for(q=r>h*b?r:h*b;u&&q<=k;q++){i=u[q];for(d=0;i&&d<i.length;d++){if(c(f,i[d])){return i[d];}}}}}}}};function g(b,g,h,j){var e=new d(h),f=[],a=[];function i(c){if(!j){return g(c,{field:b});
+}if(a[c]===undefined){a[c]=g(c,{field:b});}return a[c];}return function(b){var a={left:b.left,right:b.right,top:b.top,bottom:b.bottom,width:b.width,height:b.height},h=1,d={x:0,y:0},g;function j(){if(g&&c(a,g)){return true;}g=e.find(a,f);return!!g;}if(b.outside){return{delta:false,rect:a};}while(j()&&d!==false){d=i(h);if(d){a.left=b.left+d.x;a.right=a.left+a.width;a.top=b.top+d.y;a.bottom=a.top+a.height;}h++;}if(d){f.push(a);e.insert(a);}return{delta:d,rect:a};};}return{spirals:h,createPlacer:g};
+}function B(c){var b=c(),a=7;self.onmessage=function(m){var d=m.data,e=d.words,f=e.length/a,l=[],h=0,j,g,i,c;function k(a){self.postMessage({jobId:d.jobId,start:h,deltas:g,done:a===f},[g.buffer]);h=a;}for(c=0;c<f;c++){l.push({left:e[c*a],right:e[c*a+1],top:e[c*a+2],bottom:e[c*a+3],width:e[c*a+4],height:e[c*a+5],outside:e[c*a+6]===1});}j=b.createPlacer(d.field,b.spirals[d.spiral],d.cellSize,true);g=new Float64Array(2*Math.min(d.batchSize,f));for(c=0;c<f;c++){i=j(l[c]).delta;g[2*(c-h)]=i?i.x:NaN;g[2*(c-h)+1]=i?i.y:NaN;
+if(c+1-h===d.batchSize||c+1===f){k(c+1);g=new Float64Array(2*Math.min(d.batchSize,f-h));}}if(!f){k(0);}};}function u(){var a,d;if(c===undefined){c=false;if(b.Worker&&b.Blob&&b.URL&&b.Float64Array){try{a=new b.Blob(['('+B.toString()+')('+n.toString()+');'],{type:'application/javascript'});d=b.URL.createObjectURL(a);c={worker:new b.Worker(d),callbacks:{},jobId:0};c.worker.onmessage=function(a){var b=c.callbacks[a.data.jobId];if(a.data.done){delete c.callbacks[a.data.jobId];}if(b){b(a.data);}};}catch(a){c=false;
+}}}return c;}d=n();function k(c,b){var a;b=String(b);for(a=0;a<b.length;a++){c=Math.imul(c^b.charCodeAt(a),16777619);}return Math.imul(c^0x1f,16777619);}function s(g,f,h,i){var a=g.options,d=[a.placementStrategy,a.spiral,JSON.stringify(a.rotation),JSON.stringify(a.style),h.len,i.len,f.length],b=2166136261,c=84696351;e(f,function(a){d.push(a.point.name,a.css.fontSize);});e(d,function(a){b=k(b,a);c=k(c^0x5bd1e995,a);});return(b>>>0).toString(36)+'-'+(c>>>0).toString(36);}function q(b,c){var a=m;if(!a.layouts[b]){a.keys.push(b);
+if(a.keys.length>o){delete a.layouts[a.keys.shift()];}}a.layouts[b]=c;}var t=function d(c,b){var a=c/b;return{width:256*a,height:256,ratio:a};};var j=function g(b,a,f){var e=f-a,c=e/(b-1),d=Math.floor(Math.random()*b);return a+(d*c);};var w=function e(d,b){var a=d.getBBox(),c={left:-(b.width/2),right:b.width/2,top:-(b.height/2),bottom:b.height/2};return!(c.left<a.x&&c.right>a.x+a.width&&c.top<a.y&&c.bottom>a.y+a.height);};var x=function c(a,b){if(!g(a.left)||a.left>b.left){a.left=b.left;}if(!g(a.right)||a.right<b.right){a.right=b.right;
+}if(!g(a.top)||a.top>b.top){a.top=b.top;}if(!g(a.bottom)||a.bottom<b.bottom){a.bottom=b.bottom;}return a;};var h={random:function e(d,c){var a=c.field,b=c.rotation;return{x:Math.round((a.width*(Math.random()+0.5))/2)-(a.width/2),y:Math.round((a.height*(Math.random()+0.5))/2)-(a.height/2),rotation:j(b.orientations,b.from,b.to)};},center:function c(d,b){var a=b.rotation;return{x:0,y:0,rotation:j(a.orientations,a.from,a.to)};}};var y={animation:{duration:500},borderWidth:0,clip:false,colorByPoint:true,
+placementStrategy:'center',rotation:{from:0,orientations:2,to:90},showInLegend:false,spiral:'rectangular',style:{fontFamily:'Impact, sans-serif'},tooltip:{followPointer:true},workerThreshold:500};var A={animate:i.prototype.animate,bindAxes:function(){var a={endOnTick:false,gridLineWidth:0,lineWidth:0,maxPadding:0,startOnTick:false,title:null,tickPositions:[]};i.prototype.bindAxes.call(this);f(this.yAxis.options,a);f(this.xAxis.options,a);},deriveFontSize:function c(b){var a=25;return Math.floor(a*b);
+},drawPoints:function(){var a=this,x=a.xAxis,y=a.yAxis,b=a.options,v=a.chart.renderer,r=a.placementStrategy[b.placementStrategy],n=a.spirals[b.spiral],A=a.points.map(function(a){return a.weight;}),z=Math.max.apply(null,A),l=a.points.sort(function(a,b){return b.weight-a.weight;}),i=[],k=[],j,c,g,q,o;e(l,function(c){var e=1/z*c.weight,d=f({fontSize:a.deriveFontSize(e),fill:c.color},b.style);i.push({point:c,css:d});k.push(parseFloat(d.fontSize)||0);});k.sort(function(a,b){return a-b;});a.wordcloudJob=undefined;
+c=a.wordcloudLayout={key:s(a,i,x,y),field:t(x.len,y.len),placed:[],words:[],hasRendered:a.hasRendered,cellSize:Math.max(1,k[k.length>>1]||1)};j=m.layouts[c.key];if(j){a.drawWords(i,j.words,0);a.wordcloudLayout=undefined;a.scaleCloud(j.field);return;}function p(d){var h=d.point,e=r(h,{data:l,field:c.field,placed:c.placed,rotation:b.rotation}),a;d.placement=e;d.attr={align:'center',x:e.x,y:e.y,text:h.name,rotation:e.rotation};g.css(f({},d.css)).attr(d.attr);h.clientRect=a=f({},g.element.getBoundingClientRect());
+return{left:a.left,right:a.right,top:a.top,bottom:a.bottom,width:a.width,height:a.height,outside:w(g,c.field)};}g=v.text().add(a.group);o=l.length>b.workerThreshold&&b.workerThreshold>0&&!v.forExport&&r===h[b.placementStrategy]&&n===d.spirals[b.spiral]&&u();if(o){a.postWords(o,i,i.map(p));g.destroy();return;}q=d.createPlacer(c.field,n,c.cellSize,n===d.spirals[b.spiral]);e(i,function(b){var c=q(p(b));b.point.rect=c.rect;a.placeWord(b,c.delta);});g.destroy();a.finishLayout();},postWords:function(h,
+i,g){var c=this,d=c.wordcloudLayout,a=new b.Float64Array(7*g.length),f=++h.jobId;e(g,function(c,b){a[b*7]=c.left;a[b*7+1]=c.right;a[b*7+2]=c.top;a[b*7+3]=c.bottom;a[b*7+4]=c.width;a[b*7+5]=c.height;a[b*7+6]=c.outside?1:0;});c.wordcloudJob=f;h.callbacks[f]=function(h){var j=h.deltas,b,k,a,e;if(c.wordcloudJob!==f||!c.group){return;}for(b=0;2*b<j.length;b++){k=i[h.start+b];a=g[h.start+b];e=isNaN(j[2*b])?false:{x:j[2*b],y:j[2*b+1]};if(e){a.left+=e.x;a.right=a.left+a.width;a.top+=e.y;a.bottom=a.top+a.height;
+}delete a.outside;k.point.rect=a;c.placeWord(k,e);}if(h.done){c.wordcloudJob=undefined;c.finishLayout();}else{c.scaleCloud(d.field);}};h.worker.postMessage({jobId:f,words:a,field:{width:d.field.width,height:d.field.height,ratio:d.field.ratio},spiral:c.options.spiral,cellSize:d.cellSize,batchSize:p},[a.buffer]);},placeWord:function(d,g){var h=this,c=d.point,a=d.attr,e=c.clientRect,b=h.wordcloudLayout;if(l(g)){a.x+=g.x;a.y+=g.y;f(d.placement,{left:a.x-(e.width/2),right:a.x+(e.width/2),top:a.y-(e.height/2),
+bottom:a.y+(e.height/2)});b.field=x(b.field,d.placement);b.placed.push(c);c.isNull=false;}else{c.isNull=true;}b.words.push({x:a.x,y:a.y,rotation:a.rotation,isNull:c.isNull});h.drawWords([d],b.words,b.words.length-1);},drawWords:function(g,d,f){var a=this,b=a.options.animation,c=a.wordcloudLayout.hasRendered;e(g,function(j,k){var h=j.point,g=d[f+k],e={align:'center',x:g.x,y:g.y,text:h.name,rotation:g.rotation},i;h.isNull=g.isNull;if(b){i={x:e.x,y:e.y};if(!c){e.x=0;e.y=0;}else{delete e.x;delete e.y;
+}}h.draw({animate:i,attr:e,css:j.css,group:a.group,renderer:a.chart.renderer,shapeArgs:undefined,shapeType:'text'});});},finishLayout:function(){var b=this,a=b.wordcloudLayout;q(a.key,{words:a.words,field:a.field});b.wordcloudLayout=undefined;b.scaleCloud(a.field);},scaleCloud:function(a){var b=this,f=b.xAxis,g=b.yAxis,d=1/(2*Math.max(Math.abs(a.left),Math.abs(a.right))),e=1/(2*Math.max(Math.abs(a.top),Math.abs(a.bottom))),c=Math.min(d*f.len,e*g.len);b.group.attr({scaleX:c,scaleY:c});},hasData:function(){var a=this;
+return(l(a)&&a.visible===true&&v(a.points)&&a.points.length>0);},placementStrategy:{random:h.random,center:h.center},pointArrayMap:['weight'],spirals:{archimedean:d.spirals.archimedean,rectangular:d.spirals.rectangular,square:d.spirals.square},getPlotBox:function(){var d=this,a=d.chart,e=a.inverted,b=d[(e?'yAxis':'xAxis')],c=d[(e?'xAxis':'yAxis')],g=b?b.len:a.plotWidth,f=c?c.len:a.plotHeight,h=b?b.left:a.plotLeft,i=c?c.top:a.plotTop;return{translateX:h+(g/2),translateY:i+(f/2),scaleX:1,scaleY:1};
+}};var z={draw:r,shouldDraw:function b(){var a=this;return!a.isNull;}};a.seriesType('wordcloud','column',y,A,z);}(a,b));}));
@@ -0,0 +1,26 @@
+/*
+ Highcharts JS v6.0.2 (2017-10-20)
+ Canvas series module
+
+ (c) 2009-2017 Highsoft AS
+
+ License: www.highcharts.com/license
+*/
+(function(a){if(typeof module==='object'&&module.exports){module.exports=a;}else{a(Highcharts);}}(function(a){(function(a){var l=a.win,f=l.document,i=a.each,b=a.pick,r=a.merge,c=a.wrap,q=a.format,j=a.isNumber,h=a.defined,o=a.addEvent,d=a.Series,m=a.Point,n=a.Pointer,s=a.seriesTypes,k=a.SVGRenderer.prototype.symbols,p=!!(f.createElement('canvas').getContext&&f.createElement('canvas').getContext('2d'));a.setOptions({plotOptions:{series:{canvasThreshold:1000}}});function t(d,b){var a=0,c,e=b.length;
+while(a<e){if(typeof b[a]==='string'){c=b[a];a++;}if(c==='M'){d.moveTo(b[a],b[a+1]);a+=2;c='L';}else if(c==='L'){d.lineTo(b[a],b[a+1]);a+=2;}else if(c==='C'){d.bezierCurveTo(b[a],b[a+1],b[a+2],b[a+3],b[a+4],b[a+5]);a+=6;}else if(c==='Z'||c==='z'){d.closePath();}else{a++;}}}function v(b,d,e,f,a,c){if(d==='circle'){b.moveTo(e+a,f+c/2);b.arc(e+a/2,f+c/2,a/2,0,2*Math.PI,false);}else if(k[d]){t(b,k[d](e,f,a,c));}}function u(d,b,c,f,e,a){if(a){a=Math.min(a,f/2,e/2);d.moveTo(b+a,c);d.lineTo(b+f-a,c);d.arcTo(b+f,
+c,b+f,c+a,a);d.lineTo(b+f,c+e-a);d.arcTo(b+f,c+e,b+f-a,c+e,a);d.lineTo(b+a,c+e);d.arcTo(b,c+e,b,c+e-a,a);d.lineTo(b,c+a);d.arcTo(b,c,b+a,c,a);d.closePath();}else{d.rect(b,c,f,e);}}function g(a,b){return typeof a==='string'?a:b;}function e(a){this.ctx=a;this.key=null;}e.prototype={style:function(a,b){var c=g(a.fill,b),f=g(a.stroke,b),e=a['stroke-width']||0,d=c+','+f+','+e;if(d!==this.key){this.flush();this.key=d;this.fill=c;this.stroke=f;this.lineWidth=e;this.ctx.beginPath();}},flush:function(){var a=this.ctx;
+if(this.key!==null){if(this.fill&&this.fill!=='none'){a.fillStyle=this.fill;a.fill();}if(this.lineWidth&&this.stroke&&this.stroke!=='none'){a.strokeStyle=this.stroke;a.lineWidth=this.lineWidth;a.stroke();}}this.key=null;}};a.extend(d.prototype,{isCanvasSeries:function(){var a=this.options.canvasThreshold;return!!(p&&a&&this.isCartesian&&!this.xAxis.isRadial&&!this.isSeriesBoosting&&this.points&&this.points.length>=a);},getCanvasLayer:function(k,j,h,e,d){var g=this,m=g.chart.renderer,c=l.devicePixelRatio||1,
+b=g[k],a,i;if(b&&b.group!==j){g.destroyCanvasLayer(k);b=null;}if(!b){a=f.createElement('canvas');b=g[k]={canvas:a,ctx:a.getContext('2d'),group:j,image:m.image('',0,0,0,0).add(j)};b.image.element.canvasSeries=g;}a=b.canvas;i=b.ctx;h=Math.max(1,Math.ceil(h+2*d));e=Math.max(1,Math.ceil(e+2*d));if(a.width!==h*c){a.width=h*c;}if(a.height!==e*c){a.height=e*c;}i.setTransform(1,0,0,1,0,0);i.clearRect(0,0,a.width,a.height);i.setTransform(c,0,0,c,c*d,c*d);b.image.attr({x:-d,y:-d,width:h,height:e});return b;
+},commitCanvasLayer:function(a){a.image.attr({href:a.canvas.toDataURL('image/png')});},destroyCanvasLayer:function(a){if(this[a]){this[a].image.destroy();delete this[a];}},drawCanvasMarkers:function(){var a=this,q=a.points,g=a.options.marker,p=a[a.specialGroup]||a.markerGroup,r=b(g.enabled,a.closestPointRangePx>=2*g.radius),s=2*(g.radius||0)+(g.lineWidth||0)+1,k,m,i,c,h,o,l,n,d,f;if(g.enabled===false&&!a._hasPointMarkers){a.destroyCanvasLayer('canvasMarkers');return;}k=a.getCanvasLayer('canvasMarkers',
+p,a.xAxis.len,a.yAxis.len,s);m=new e(k.ctx);for(i=0;i<q.length;i++){c=q[i];h=c.marker||{};o=(r&&h.enabled===undefined)||h.enabled;f=c.graphic;if(!o||!j(c.plotY)||c.y===null||!c.isInside){if(f){c.graphic=f.destroy();}continue;}l=b(h.symbol,a.symbol);c.hasImage=l.indexOf('url')===0;n=c.selected&&'select';d=a.markerAttribs(c,n);if(c.hasImage){if(!f){c.graphic=f=a.chart.renderer.symbol(l,d.x,d.y,d.width,d.height,c.marker?h:g).add(p);}f.attr(d);continue;}if(f){c.graphic=f.destroy();}if(d.width>0){m.style(a.pointAttribs(c,
+n),a.color);v(k.ctx,l,d.x,d.y,d.width,d.height);}}m.flush();a.commitCanvasLayer(k);},drawCanvasColumns:function(){var b=this,h=b.options,i=b.points,f=b.getCanvasLayer('canvasPoints',b.group,b.xAxis.len,b.yAxis.len,(h.borderWidth||0)+1),g=new e(f.ctx),d,a,c;for(d=0;d<i.length;d++){a=i[d];if(a.graphic){a.graphic=a.graphic.destroy();}c=a.shapeArgs;if(j(a.plotY)&&a.y!==null&&c){g.style(b.pointAttribs(a,a.selected&&'select'),b.color);u(f.ctx,c.x,c.y,c.width,c.height,h.borderRadius);}}g.flush();b.commitCanvasLayer(f);
+},getCanvasPointFromEvent:function(d){var a=this,k=a.chart,c=a.points||[],m=k.inverted,h,j,f=0,i=c.length-1,g,e,b,n,l,o;d=k.pointer.normalize(d);h=m?a.xAxis.len-(d.chartY-a.xAxis.pos):d.chartX-a.xAxis.pos;j=m?a.yAxis.len-(d.chartX-a.yAxis.pos):d.chartY-a.yAxis.pos;n=a.xAxis.reversed;while(f<i){g=(f+i)>>1;if(n?c[g].plotX>h:c[g].plotX<h){f=g+1;}else{i=g;}}l=Math.max(0,f-2);o=Math.min(c.length-1,f+2);for(e=l;e<=o;e++){b=c[e].shapeArgs;if(b&&c[e].y!==null&&h>=b.x&&h<=b.x+b.width&&j>=b.y&&j<=b.y+b.height){return c[e];
+}}},drawCanvasState:function(c,d){var a=this,b=a.canvasStateGraphic;if(d&&c.shapeArgs){if(!b){b=a.canvasStateGraphic=a.chart.renderer[c.shapeType||'rect'](c.shapeArgs).add(a.group);}b.attr(c.shapeArgs).attr({r:a.options.borderRadius||0}).attr(a.pointAttribs(c,d)).show();}else if(b){b.hide();}},drawCanvasDataLabels:function(){var a=this,g=a.chart,f=g.renderer,d=g.inverted,m=a.options,e=m.dataLabels,n=a.plotGroup('dataLabelsGroup','data-labels','visible',e.zIndex||6),k=d?a.yAxis.len:a.xAxis.len,j=d?a.xAxis.len:a.yAxis.len,
+l=a.getCanvasLayer('canvasLabels',n,k,j,0),c=l.ctx,o=!!a.getColumnMetrics;c.textBaseline='alphabetic';c.textAlign='left';i(a.points,function(i){var z=i.dlOptions||(i.options&&i.options.dataLabels),l=z?r(e,z):e,n,E,D,s,w,v,C,F,x,p,B,G,A,y,t,u;if(i.dataLabel){i.dataLabel=i.dataLabel.destroy();}if(!b(z&&z.enabled,e.enabled)||i.isNull||!g.isInsidePlot(b(i.plotX,-9999),Math.round(b(i.plotY,-9999)),d)){return;}E=i.getLabelConfig();D=l[i.formatPrefix+'Format']||l.format;s=h(D)?q(D,E):(l[i.formatPrefix+'Formatter']||l.formatter).call(E,
+l);if(!h(s)||s===''){return;}s=String(s).replace(/<[^>]+>/g,'');n=l.style||{};w=b(l.color,n.color,a.color,'#000000');if(w==='contrast'){i.contrastColor=f.getContrast(i.color||a.color);w=l.inside||b(i.labelDistance,l.distance)<0||m.stacking?i.contrastColor:'#000000';}v=n.textOutline&&n.textOutline!=='none'?n.textOutline.split(' '):null;C=n.fontSize||'11px';F=f.fontMetrics(C);x=b(l.padding,0);c.font=[n.fontStyle||'',n.fontWeight||'normal',C,n.fontFamily||f.style.fontFamily].join(' ');A=c.measureText(s).width+2*x;
+y=F.h+2*x;if(o&&i.shapeArgs){p=a.getCanvasLabelBox(i,l);B=p.align;G=p.verticalAlign;}else{p={x:d?a.yAxis.len-i.plotY:i.plotX,y:Math.round(d?a.xAxis.len-i.plotX:i.plotY),width:0,height:0};B=l.align;G=l.verticalAlign;}t=p.x+(l.x||0)+({left:0,center:0.5,right:1}[B]||0)*(p.width-A);u=p.y+(l.y||0)+({top:0,middle:0.5,bottom:1}[G]||0)*(p.height-y);if(b(l.overflow,'justify')==='justify'){t=Math.max(0,Math.min(t,k-A));u=Math.max(0,Math.min(u,j-y));}else if(b(l.crop,true)&&(t<0||u<0||t+A>k||u+y>j)){return;
+}t+=x;u+=x+F.b;if(v){c.lineJoin='round';c.lineWidth=2*parseFloat(v[0]);c.strokeStyle=v[v.length-1]==='contrast'?f.getContrast(w):v[v.length-1];c.strokeText(s,t,u);}c.fillStyle=w;c.fillText(s,t,u);});a.commitCanvasLayer(l);},getCanvasLabelBox:function(g,i){var c=this,f=c.chart.inverted,d=b(g.below,g.plotY>b(c.translatedThreshold,c.yAxis.len)),h=b(i.inside,!!c.options.stacking),e=g.dlBox||g.shapeArgs,a={x:e.x,y:e.y,width:e.width,height:e.height},j;if(a.y<0){a.height+=a.y;a.y=0;}j=a.y+a.height-c.yAxis.len;
+if(j>0){a.height-=j;}if(f){a={x:c.yAxis.len-a.y-a.height,y:c.xAxis.len-a.x-a.width,width:a.height,height:a.width};}if(!h){if(f){a.x+=d?0:a.width;a.width=0;}else{a.y+=d?a.height:0;a.height=0;}}a.align=b(i.align,!f||h?'center':d?'right':'left');a.verticalAlign=b(i.verticalAlign,f||h?'middle':d?'top':'bottom');return a;}});c(d.prototype,'drawPoints',function(a){if(this.isCanvasSeries()){this.drawCanvasMarkers();}else{this.destroyCanvasLayer('canvasMarkers');a.call(this);}});c(s.column.prototype,'drawPoints',
+function(a){if(this.isCanvasSeries()){this.drawCanvasColumns();}else{this.destroyCanvasLayer('canvasPoints');if(this.canvasStateGraphic){this.canvasStateGraphic=this.canvasStateGraphic.destroy();}a.call(this);}});c(d.prototype,'drawDataLabels',function(b){var a=this.options.dataLabels;if(this.isCanvasSeries()&&(a.enabled||this._hasPointLabels)&&!a.useHTML&&!a.rotation&&!a.shape&&!a.backgroundColor&&!a.borderWidth&&!this.dlProcessOptions){this.drawCanvasDataLabels();}else{this.destroyCanvasLayer('canvasLabels');
+b.call(this);}});c(d.prototype,'destroy',function(b){var a=this;i(['canvasMarkers','canvasPoints','canvasLabels'],function(b){a.destroyCanvasLayer(b);});if(a.canvasStateGraphic){a.canvasStateGraphic=a.canvasStateGraphic.destroy();}return b.apply(a,Array.prototype.slice.call(arguments,1));});c(m.prototype,'setState',function(b,c){var a=this.series;b.apply(this,Array.prototype.slice.call(arguments,1));if(a.canvasPoints){a.drawCanvasState(this,c||(this.selected&&'select'));}});c(n.prototype,'getPointFromEvent',
+function(d,a){var b=d.call(this,a),c=a.target&&a.target.canvasSeries;if(!b&&c&&c.canvasPoints){b=c.getCanvasPointFromEvent(a);}return b;});a.Chart.prototype.callbacks.push(function(a){o(a.container,'mousemove',function(b){var d=b.target&&b.target.canvasSeries,c;if(d&&d.canvasPoints){c=d.getCanvasPointFromEvent(b);if(c&&c!==a.hoverPoint){c.onMouseOver(b);}}});});}(a));}));
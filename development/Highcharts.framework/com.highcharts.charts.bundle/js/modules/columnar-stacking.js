@@ -0,0 +1,17 @@
+/*
+ Highcharts JS v6.0.2 (2017-10-20)
+ Columnar stacking module
+
+ (c) 2009-2017 Highsoft AS
+
+ License: www.highcharts.com/license
+*/
+(function(a){if(typeof module==='object'&&module.exports){module.exports=a;}else{a(Highcharts);}}(function(a){(function(a){var e=a.each,l=a.pick,c=a.wrap,d=a.correctFloat,g=a.Axis,b=a.Series,h=a.StackItem,f=a.seriesTypes,j=b.prototype.getStackIndicator;a.setOptions({plotOptions:{series:{columnarStackThreshold:1000}}});function i(d){var e=d.processedXData,g=d.processedYData,c=g.length,a=d.stackColumn,h,i,f,b;if(a&&!d.isDirtyData&&a.xData===e&&a.yData===g&&a.length===c){return a;}a=d.stackColumn={xData:e,
+yData:g,length:c,values:new Float64Array(c),hasNulls:false,valid:e.length===c};h=a.values;for(b=0;b<c&&a.valid;b++){i=e[b];f=g[b];if(typeof i!=='number'||(b&&!(i>e[b-1]))){a.valid=false;}else if(f===null){h[b]=NaN;a.hasNulls=true;}else if(typeof f==='number'&&isFinite(f)){h[b]=f;}else{a.valid=false;}}return a;}function k(b){var f=b.series,k=f[0],h=k.options.stacking,g=[],c,e;for(e=0;e<f.length;e++){var d=f[e],j=d.options.columnarStackThreshold,a;if(d.negStacks||d.options.stacking!==h||!j||d.processedYData.length<j){return false;
+}a=i(d);if(!a.valid){return false;}if(!c){c=a;}else if(a.alignedTo!==c){if(a.length!==c.length||!m(a.xData,c.xData)){return false;}a.alignedTo=c;}b.hasNulls=b.hasNulls||a.hasNulls;b.hasGaps=b.hasGaps||!!d.options.gapSize;g.push(a);}b.columns=g;b.xData=c.xData;b.stacking=h;return true;}function m(a,c){var b=a.length;if(a!==c){while(b--){if(a[b]!==c[b]){return false;}}}return true;}g.prototype.setColumnarStacks=function(l){var q=this,z=l.series,r=l.columns,I=l.xData,m=I.length,k=z[0],B=k.options,D=l.stacking,
+o=D==='percent',J=o,G=D==='stream'&&f.streamgraph&&k.streamStacker===f.streamgraph.prototype.streamStacker,C=!o&&!G&&k[D+'Stacker'],K=B.startFromThreshold?B.threshold:0,E=q.stacks[l.key],A=l.oldStacks,L=q.options.stackLabels,H=new Float64Array(m),s=new Float64Array(m),y=[],F=r[0].values,w,p,u,t,c,e,x,n,v,j,i,a,g;if(o){if(k.percentStacker!==b.prototype.percentStacker){C=k.percentStacker;o=false;}q.usePercentage=true;}for(g=0;g<r.length;g++){w=r[g].values;for(a=0;a<m;a++){i=w[a];if(i===i){H[a]+=J?Math.abs(i):i;
+}}}for(a=0;a<m;a++){j=I[a];c=E[j];if(!c){if(A&&A[j]){c=E[j]=A[j];}else{c=E[j]=new h(q,L,false,j,B.stack);}}c.total=d(H[a]);if(F[a]===F[a]){c.base=k.index;}y[a]=c;s[a]=K;}for(g=0;g<z.length;g++){p=z[g];t=p.index;w=r[g].values;u=p.stackedYData=[];for(a=0;a<m;a++){i=w[a];if(i!==i){continue;}c=y[a];c.touched=p.stacksTouched;n=s[a];v=s[a]=n+i;e=c.points[t];if(!e){e=c.points[t]=[];}if(o){x=c.total?100/c.total:0;e[0]=d(n*x);e[1]=u[a]=d(v*x);}else if(G){e[0]=n-c.total/2;e[1]=v-c.total/2;u[a]=t===0?e[1]:e[0];
+}else{e[0]=n;e[1]=u[a]=v;if(C){C.call(p,e,c,a);}}}}for(a=0;a<m;a++){y[a].cum=s[a];}};c(g.prototype,'buildStacks',function(m){var c=this,h=c.series,n=l(c.options.reversedStacks,true),j=h.length,i={},d=[],b,f,g;if(c.isXAxis){return m.call(c);}for(g=j;g--;){b=h[n?g:j-g-1];b.columnarStack=null;if(b.options.stacking&&(b.visible===true||b.chart.options.chart.ignoreHiddenSeries===false)){f=i[b.stackKey];if(!f){f=i[b.stackKey]={key:b.stackKey,series:[]};d.push(f);}f.series.push(b);}}d=a.grep(d,k);e(d,function(a){e(a.series,
+function(b){b.columnarStack=a;});});m.call(c);e(d,function(a){c.setColumnarStacks(a);});});c(b.prototype,'setStackedPoints',function(c){var a=this.columnarStack,b=this.yAxis;if(a){if(!a.oldStacks){a.oldStacks=b.oldStacks[a.key]||{};if(!b.stacks[a.key]){b.stacks[a.key]={};}}b.stacksTouched+=1;this.stacksTouched=b.stacksTouched;b.oldStacks={};}else{c.call(this);}});c(b.prototype,'modifyStacks',function(a){if(!this.columnarStack){a.call(this);}});b.prototype.getStackIndicator=function(a,d,b,c){if(this.columnarStack&&!c){if(!a||a.key!==b){a={key:b,
+index:0};}a.x=d;return a;}return j.apply(this,arguments);};c(f.area.prototype,'getStackPoints',function(d,a){var c=this.columnarStack,b;if(c&&!c.hasNulls&&!c.hasGaps&&(!a||a===this.points)&&this.points.length===c.xData.length){a=this.points;for(b=0;b<a.length;b++){if(a[b].isNull){return d.call(this,a);}}for(b=0;b<a.length;b++){a[b].leftCliff=a[b].rightCliff=0;}return a.slice();}return d.call(this,a);});c(b.prototype,'destroy',function(a){this.stackColumn=this.columnarStack=null;a.call(this);});}(a));
+}));
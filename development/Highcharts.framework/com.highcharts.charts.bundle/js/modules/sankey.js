@@ -6,12 +6,13 @@
 
  License: www.highcharts.com/license
 */
-(function(k){"object"===typeof module&&module.exports?module.exports=k:k(Highcharts)})(function(k){(function(g){var k=g.defined,d=g.each,w=g.extend,x=g.seriesType,r=g.Point;x("sankey","column",{colorByPoint:!0,curveFactor:.33,dataLabels:{enabled:!0,backgroundColor:"none",crop:!1,nodeFormat:void 0,nodeFormatter:function(){return this.point.name},format:void 0,formatter:function(){return""},inside:!0},linkOpacity:.5,nodeWidth:20,nodePadding:10,showInLegend:!1,states:{hover:{linkOpacity:1}},tooltip:{followPointer:!0,
-headerFormat:'\x3cspan style\x3d"font-size: 0.85em"\x3e{series.name}\x3c/span\x3e\x3cbr/\x3e',pointFormat:"{point.fromNode.name} \u2192 {point.toNode.name}: \x3cb\x3e{point.weight}\x3c/b\x3e\x3cbr/\x3e",nodeFormat:"{point.name}: \x3cb\x3e{point.sum}\x3c/b\x3e\x3cbr/\x3e"}},{isCartesian:!1,forceDL:!0,createNode:function(c){function a(a,b){return g.find(a,function(a){return a.id===b})}var b=a(this.nodes,c),e;b||(e=this.options.nodes&&a(this.options.nodes,c),b=(new r).init(this,w({className:"highcharts-node",
-isNode:!0,id:c,y:1},e)),b.linksTo=[],b.linksFrom=[],b.formatPrefix="node",b.name=b.name||b.id,b.getSum=function(){var a=0,c=0;d(b.linksTo,function(c){a+=c.weight});d(b.linksFrom,function(a){c+=a.weight});return Math.max(a,c)},b.offset=function(a,c){for(var f=0,e=0;e<b[c].length;e++){if(b[c][e]===a)return f;f+=b[c][e].weight}},b.hasShape=function(){var a=0;d(b.linksTo,function(c){c.outgoing&&a++});return!b.linksTo.length||a!==b.linksTo.length},this.nodes.push(b));return b},createNodeColumn:function(){var c=
-this.chart,a=[],b=this.options.nodePadding;a.sum=function(){var a=0;d(this,function(c){a+=c.getSum()});return a};a.offset=function(c,f){for(var e=0,d=0;d<a.length;d++){if(a[d]===c)return e;e+=a[d].getSum()*f+b}};a.top=function(e){for(var f=0,d=0;d<a.length;d++)0<d&&(f+=b),f+=a[d].getSum()*e;return(c.plotSizeY-f)/2};return a},createNodeColumns:function(){var c=[];d(this.nodes,function(a){var b=0,d,f;if(0===a.linksTo.length)a.column=0;else{for(d=0;d<a.linksTo.length;d++)f=a.linksTo[0],f.fromNode.column>
-b&&(b=f.fromNode.column);a.column=b+1}c[a.column]||(c[a.column]=this.createNodeColumn());c[a.column].push(a)},this);return c},pointAttribs:function(c,a){var b=this.options.linkOpacity;a&&(b=this.options.states[a].linkOpacity||b);return{fill:c.isNode?c.color:g.color(c.color).setOpacity(b).get()}},generatePoints:function(){var c={};g.Series.prototype.generatePoints.call(this);this.nodes||(this.nodes=[]);this.colorCounter=0;d(this.nodes,function(a){a.linksFrom.length=0;a.linksTo.length=0});d(this.points,
-function(a){k(a.from)&&(c[a.from]||(c[a.from]=this.createNode(a.from)),c[a.from].linksFrom.push(a),a.fromNode=c[a.from],a.color=a.options.color||c[a.from].color);k(a.to)&&(c[a.to]||(c[a.to]=this.createNode(a.to)),c[a.to].linksTo.push(a),a.toNode=c[a.to]);a.name=a.name||a.id},this)},translate:function(){this.processedXData||this.processData();this.generatePoints();this.nodeColumns=this.createNodeColumns();var c=this.chart,a=c.inverted,b=this.options,e=0,f=b.nodeWidth,g=this.nodeColumns,k=(c.plotSizeX-
-f)/(g.length-1),t=(a?-k:k)*b.curveFactor,m=Infinity;d(this.nodeColumns,function(a){m=Math.min(m,(c.plotSizeY-(a.length-1)*b.nodePadding)/a.sum())});d(this.nodeColumns,function(b){d(b,function(l){var r=l.getSum(),u=r*m,v=b.top(m)+b.offset(l,m),n=a?c.plotSizeX-e:e;l.sum=r;l.shapeType="rect";l.shapeArgs=a?{x:n-f,y:c.plotSizeY-v-u,width:f,height:u}:{x:n,y:v,width:f,height:u};l.shapeArgs.display=l.hasShape()?"":"none";l.plotY=1;d(l.linksFrom,function(b){var d=b.weight*m,e=l.offset(b,"linksFrom")*m,e=v+
-e,h=b.toNode,p=g[h.column].top(m)+h.offset(b,"linksTo")*m+g[h.column].offset(h,m),q=f,h=h.column*k,r=b.outgoing;a&&(e=c.plotSizeY-e,p=c.plotSizeY-p,h=c.plotSizeX-h,q=-q,d=-d);b.shapeType="path";b.shapeArgs={d:["M",n+q,e,"C",n+q+t,e,h-t,p,h,p,"L",h+(r?q:0),p+d/2,"L",h,p+d,"C",h-t,p+d,n+q+t,e+d,n+q,e+d,"z"]};b.dlBox={x:n+(h-n+q)/2,y:e+(p-e)/2,height:d,width:0};b.y=b.plotY=1;b.color||(b.color=l.color)})});e+=k},this)},render:function(){var c=this.points;this.points=this.points.concat(this.nodes);g.seriesTypes.column.prototype.render.call(this);
-this.points=c},animate:g.Series.prototype.animate},{getClassName:function(){return"highcharts-link "+r.prototype.getClassName.call(this)},isValid:function(){return this.isNode||"number"===typeof this.weight}})})(k)});
+(function(a){if(typeof module==='object'&&module.exports){module.exports=a;}else{a(Highcharts);}}(function(a){(function(b){var e=b.defined,a=b.each,g=b.extend,h=b.seriesType,d=b.Point;var c=function(c){var b={};a(c||[],function(a){var c='#'+(a&&a.id);if(a&&!b[c]){b[c]=a;}});return b;};var f=function(d,e,c){var a=e['#'+c];if(a&&a.id!==c){a=b.find(d,function(a){return a.id===c;});}return a;};h('sankey','column',{colorByPoint:true,curveFactor:0.33,dataLabels:{enabled:true,backgroundColor:'none',crop:false,
+nodeFormat:undefined,nodeFormatter:function(){return this.point.name;},format:undefined,formatter:function(){return'';},inside:true},linkOpacity:0.5,nodeWidth:20,nodePadding:10,showInLegend:false,states:{hover:{linkOpacity:1}},tooltip:{followPointer:true,headerFormat:'<span style="font-size: 0.85em">{series.name}</span><br/>',pointFormat:'{point.fromNode.name} → {point.toNode.name}: '+'<b>{point.weight}</b><br/>',nodeFormat:'{point.name}: <b>{point.sum}</b><br/>'}},{isCartesian:false,forceDL:true,
+createNode:function(e){var h=this.nodeLookup,b=f(this.nodes,h,e),i;if(!b){i=this.options.nodes&&f(this.options.nodes,this.nodeOptionsLookup||c(this.options.nodes),e);b=(new d()).init(this,g({className:'highcharts-node',isNode:true,id:e,y:1},i));b.linksTo=[];b.linksFrom=[];b.formatPrefix='node';b.name=b.name||b.id;b.getSum=function(){var d=0,c=0;a(b.linksTo,function(a){d+=a.weight;});a(b.linksFrom,function(a){c+=a.weight;});return Math.max(d,c);};b.offset=function(e,c){var d=0,a;for(a=0;a<b[c].length;
+a++){if(b[c][a]===e){return d;}d+=b[c][a].weight;}};b.hasShape=function(){var c=0;a(b.linksTo,function(a){if(a.outgoing){c++;}});return(!b.linksTo.length||c!==b.linksTo.length);};this.nodes.push(b);if(!h['#'+e]){h['#'+e]=b;}}return b;},createNodeColumn:function(){var d=this.chart,b=[],c=this.options.nodePadding;b.sum=function(){var b=0;a(this,function(a){b+=a.getSum();});return b;};b.offset=function(f,e){var d=0,a;for(a=0;a<b.length;a++){if(b[a]===f){return d;}d+=b[a].getSum()*e+c;}};b.top=function(f){var e=0,
+a;for(a=0;a<b.length;a++){if(a>0){e+=c;}e+=b[a].getSum()*f;}return(d.plotSizeY-e)/2;};return b;},createNodeColumns:function(){var b=[];a(this.nodes,function(a){var c=0,d,e;if(a.linksTo.length===0){a.column=0;}else{for(d=0;d<a.linksTo.length;d++){e=a.linksTo[0];if(e.fromNode.column>c){c=e.fromNode.column;}}a.column=c+1;}if(!b[a.column]){b[a.column]=this.createNodeColumn();}b[a.column].push(a);},this);return b;},pointAttribs:function(c,d){var a=this.options.linkOpacity;if(d){a=this.options.states[d].linkOpacity||a;
+}return{fill:c.isNode?c.color:b.color(c.color).setOpacity(a).get()};},generatePoints:function(){var d={};b.Series.prototype.generatePoints.call(this);if(!this.nodes){this.nodes=[];this.nodeLookup={};}if(!this.nodeLookup){this.nodeLookup=c(this.nodes);}this.colorCounter=0;this.nodeOptionsLookup=c(this.options.nodes);a(this.nodes,function(a){a.linksFrom.length=0;a.linksTo.length=0;});a(this.points,function(a){if(e(a.from)){if(!d[a.from]){d[a.from]=this.createNode(a.from);}d[a.from].linksFrom.push(a);
+a.fromNode=d[a.from];a.color=a.options.color||d[a.from].color;}if(e(a.to)){if(!d[a.to]){d[a.to]=this.createNode(a.to);}d[a.to].linksTo.push(a);a.toNode=d[a.to];}a.name=a.name||a.id;},this);},translate:function(){if(!this.processedXData){this.processData();}this.generatePoints();this.nodeColumns=this.createNodeColumns();var b=this.chart,i=b.inverted,f=this.options,j=0,e=f.nodeWidth,d=this.nodeColumns,g=(b.plotSizeX-e)/(d.length-1),h=((i?-g:g)*f.curveFactor),c=Infinity;a(d,function(d){var e=0;a(d,
+function(a){a.sum=a.getSum();e+=a.sum;});c=Math.min(c,(b.plotSizeY-(d.length-1)*f.nodePadding)/e);});a(d,function(d){var e=0,g=0;a(d,function(b,a){if(a>0){e+=f.nodePadding;}e+=b.sum*c;});d.pixelTop=(b.plotSizeY-e)/2;a(d,function(b){var d=0,e=0;b.columnOffset=g;g+=b.sum*c+f.nodePadding;a(b.linksFrom,function(a){a.fromOffset=d;d+=a.weight;});a(b.linksTo,function(a){a.toOffset=e;e+=a.weight;});});});a(d,function(f){a(f,function(k){var n=k.sum*c,m=f.pixelTop+k.columnOffset,l=i?b.plotSizeX-j:j;k.shapeType='rect';
+k.shapeArgs=i?{x:l-e,y:b.plotSizeY-m-n,width:e,height:n}:{x:l,y:m,width:e,height:n};k.shapeArgs.display=k.hasShape()?'':'none';k.plotY=1;a(k.linksFrom,function(a){var j=a.weight*c,r=a.fromOffset*c,f=m+r,q=a.toNode,t=d[q.column],p=t.pixelTop+a.toOffset*c+q.columnOffset,n=e,o=q.column*g,s=a.outgoing;if(i){f=b.plotSizeY-f;p=b.plotSizeY-p;o=b.plotSizeX-o;n=-n;j=-j;}a.shapeType='path';a.shapeArgs={d:['M',l+n,f,'C',l+n+h,f,o-h,p,o,p,'L',o+(s?n:0),p+j/2,'L',o,p+j,'C',o-h,p+j,l+n+h,f+j,l+n,f+j,'z']};a.dlBox={x:l+(o-l+n)/2,
+y:f+(p-f)/2,height:j,width:0};a.y=a.plotY=1;if(!a.color){a.color=k.color;}});});j+=g;},this);},render:function(){var a=this.points;this.points=this.points.concat(this.nodes);b.seriesTypes.column.prototype.render.call(this);this.points=a;},animate:b.Series.prototype.animate},{getClassName:function(){return'highcharts-link '+d.prototype.getClassName.call(this);},isValid:function(){return this.isNode||typeof this.weight==='number';}});}(a));}));
@@ -6,20 +6,32 @@
 
  License: www.highcharts.com/license
 */
-(function(g){"object"===typeof module&&module.exports?module.exports=g:g(Highcharts)})(function(g){(function(d){var g=d.defined,r=d.each,x=d.noop,u=d.seriesTypes;d.colorPointMixin={isValid:function(){return null!==this.value},setVisible:function(d){var f=this,a=d?"show":"hide";r(["graphic","dataLabel"],function(b){if(f[b])f[b][a]()})},setState:function(f){d.Point.prototype.setState.call(this,f);this.graphic&&this.graphic.attr({zIndex:"hover"===f?1:0})}};d.colorSeriesMixin={pointArrayMap:["value"],
-axisTypes:["xAxis","yAxis","colorAxis"],optionalAxis:"colorAxis",trackerGroups:["group","markerGroup","dataLabelsGroup"],getSymbol:x,parallelArrays:["x","y","value"],colorKey:"value",pointAttribs:u.column.prototype.pointAttribs,translateColors:function(){var d=this,v=this.options.nullColor,a=this.colorAxis,b=this.colorKey;r(this.data,function(c){var e=c[b];if(e=c.options.color||(c.isNull?v:a&&void 0!==e?a.toColor(e,c):c.color||d.color))c.color=e})},colorAttribs:function(d){var f={};g(d.color)&&(f[this.colorProp||
-"fill"]=d.color);return f}}})(g);(function(d){var g=d.colorPointMixin,r=d.each,x=d.merge,u=d.noop,f=d.pick,v=d.Series,a=d.seriesType,b=d.seriesTypes;a("heatmap","scatter",{animation:!1,borderWidth:0,nullColor:"#f7f7f7",dataLabels:{formatter:function(){return this.point.value},inside:!0,verticalAlign:"middle",crop:!1,overflow:!1,padding:0},marker:null,pointRange:null,tooltip:{pointFormat:"{point.x}, {point.y}: {point.value}\x3cbr/\x3e"},states:{normal:{animation:!0},hover:{halo:!1,brightness:.2}}},
-x(d.colorSeriesMixin,{pointArrayMap:["y","value"],hasPointSpecificOptions:!0,getExtremesFromAll:!0,directTouch:!0,init:function(){var c;b.scatter.prototype.init.apply(this,arguments);c=this.options;c.pointRange=f(c.pointRange,c.colsize||1);this.yAxis.axisPointRange=c.rowsize||1},translate:function(){var b=this.options,a=this.xAxis,d=this.yAxis,w=b.pointPadding||0,k=function(b,a,c){return Math.min(Math.max(a,b),c)};this.generatePoints();r(this.points,function(c){var h=(b.colsize||1)/2,e=(b.rowsize||
-1)/2,l=k(Math.round(a.len-a.translate(c.x-h,0,1,0,1)),-a.len,2*a.len),h=k(Math.round(a.len-a.translate(c.x+h,0,1,0,1)),-a.len,2*a.len),t=k(Math.round(d.translate(c.y-e,0,1,0,1)),-d.len,2*d.len),e=k(Math.round(d.translate(c.y+e,0,1,0,1)),-d.len,2*d.len),m=f(c.pointPadding,w);c.plotX=c.clientX=(l+h)/2;c.plotY=(t+e)/2;c.shapeType="rect";c.shapeArgs={x:Math.min(l,h)+m,y:Math.min(t,e)+m,width:Math.abs(h-l)-2*m,height:Math.abs(e-t)-2*m}});this.translateColors()},drawPoints:function(){b.column.prototype.drawPoints.call(this);
-r(this.points,function(b){b.graphic.attr(this.colorAttribs(b))},this)},animate:u,getBox:u,drawLegendSymbol:d.LegendSymbolMixin.drawRectangle,alignDataLabel:b.column.prototype.alignDataLabel,getExtremes:function(){v.prototype.getExtremes.call(this,this.valueData);this.valueMin=this.dataMin;this.valueMax=this.dataMax;v.prototype.getExtremes.call(this)}}),d.extend({haloPath:function(b){if(!b)return[];var a=this.shapeArgs;return["M",a.x-b,a.y-b,"L",a.x-b,a.y+a.height+b,a.x+a.width+b,a.y+a.height+b,a.x+
-a.width+b,a.y-b,"Z"]}},g))})(g);(function(d){var g=d.seriesType,r=d.each,x=d.reduce,u=d.pick,f=function(a,b,c){return Math.min(Math.max(b,a),c)},v=function(a,b,c){a=a.options;return{xPad:(a.colsize||1)/-b,yPad:(a.rowsize||1)/-c}};d.tileShapeTypes={hexagon:{alignDataLabel:d.seriesTypes.scatter.prototype.alignDataLabel,getSeriesPadding:function(a){return v(a,3,2)},haloPath:function(a){if(!a)return[];var b=this.tileEdges;return["M",b.x2-a,b.y1+a,"L",b.x3+a,b.y1+a,b.x4+1.5*a,b.y2,b.x3+a,b.y3-a,b.x2-a,
-b.y3-a,b.x1-1.5*a,b.y2,"Z"]},translate:function(){var a=this.options,b=this.xAxis,c=this.yAxis,d=a.pointPadding||0,y=(a.colsize||1)/3,w=(a.rowsize||1)/2,k;this.generatePoints();r(this.points,function(a){var h=f(Math.floor(b.len-b.translate(a.x-2*y,0,1,0,1)),-b.len,2*b.len),e=f(Math.floor(b.len-b.translate(a.x-y,0,1,0,1)),-b.len,2*b.len),l=f(Math.floor(b.len-b.translate(a.x+y,0,1,0,1)),-b.len,2*b.len),t=f(Math.floor(b.len-b.translate(a.x+2*y,0,1,0,1)),-b.len,2*b.len),m=f(Math.floor(c.translate(a.y-
-w,0,1,0,1)),-c.len,2*c.len),n=f(Math.floor(c.translate(a.y,0,1,0,1)),-c.len,2*c.len),p=f(Math.floor(c.translate(a.y+w,0,1,0,1)),-c.len,2*c.len),q=u(a.pointPadding,d),g=q*Math.abs(e-h)/Math.abs(p-n),g=b.reversed?-g:g,r=b.reversed?-q:q,q=c.reversed?-q:q;a.x%2&&(k=k||Math.round(Math.abs(p-m)/2)*(c.reversed?-1:1),m+=k,n+=k,p+=k);a.plotX=a.clientX=(e+l)/2;a.plotY=n;h+=g+r;e+=r;l-=r;t-=g+r;m-=q;p+=q;a.tileEdges={x1:h,x2:e,x3:l,x4:t,y1:m,y2:n,y3:p};a.shapeType="path";a.shapeArgs={d:["M",e,m,"L",l,m,t,n,
-l,p,e,p,h,n,"Z"]}});this.translateColors()}},diamond:{alignDataLabel:d.seriesTypes.scatter.prototype.alignDataLabel,getSeriesPadding:function(a){return v(a,2,2)},haloPath:function(a){if(!a)return[];var b=this.tileEdges;return["M",b.x2,b.y1+a,"L",b.x3+a,b.y2,b.x2,b.y3-a,b.x1-a,b.y2,"Z"]},translate:function(){var a=this.options,b=this.xAxis,c=this.yAxis,d=a.pointPadding||0,g=a.colsize||1,w=(a.rowsize||1)/2,k;this.generatePoints();r(this.points,function(a){var e=f(Math.round(b.len-b.translate(a.x-g,
-0,1,0,0)),-b.len,2*b.len),h=f(Math.round(b.len-b.translate(a.x,0,1,0,0)),-b.len,2*b.len),l=f(Math.round(b.len-b.translate(a.x+g,0,1,0,0)),-b.len,2*b.len),t=f(Math.round(c.translate(a.y-w,0,1,0,0)),-c.len,2*c.len),m=f(Math.round(c.translate(a.y,0,1,0,0)),-c.len,2*c.len),n=f(Math.round(c.translate(a.y+w,0,1,0,0)),-c.len,2*c.len),p=u(a.pointPadding,d),q=p*Math.abs(h-e)/Math.abs(n-m),q=b.reversed?-q:q,p=c.reversed?-p:p;a.x%2&&(k=Math.abs(n-t)/2*(c.reversed?-1:1),t+=k,m+=k,n+=k);a.plotX=a.clientX=h;a.plotY=
-m;e+=q;l-=q;t-=p;n+=p;a.tileEdges={x1:e,x2:h,x3:l,y1:t,y2:m,y3:n};a.shapeType="path";a.shapeArgs={d:["M",h,t,"L",l,m,h,n,e,m,"Z"]}});this.translateColors()}},circle:{alignDataLabel:d.seriesTypes.scatter.prototype.alignDataLabel,getSeriesPadding:function(a){return v(a,2,2)},haloPath:function(a){return d.seriesTypes.scatter.prototype.pointClass.prototype.haloPath.call(this,a+(a&&this.radius))},translate:function(){var a=this.options,b=this.xAxis,c=this.yAxis,d=a.pointPadding||0,g=(a.rowsize||1)/2,w=
-a.colsize||1,k,h,v,u,l=!1;this.generatePoints();r(this.points,function(a){var e=f(Math.round(b.len-b.translate(a.x,0,1,0,0)),-b.len,2*b.len),n=f(Math.round(c.translate(a.y,0,1,0,0)),-c.len,2*c.len),p=d,q=!1;void 0!==a.pointPadding&&(p=a.pointPadding,l=q=!0);if(!u||l)k=Math.abs(f(Math.floor(b.len-b.translate(a.x+w,0,1,0,0)),-b.len,2*b.len)-e),h=Math.abs(f(Math.floor(c.translate(a.y+g,0,1,0,0)),-c.len,2*c.len)-n),v=Math.floor(Math.sqrt(k*k+h*h)/2),u=Math.min(k,v,h)-p,l&&!q&&(l=!1);a.x%2&&(n+=h*(c.reversed?
--1:1));a.plotX=a.clientX=e;a.plotY=n;a.radius=u;a.shapeType="circle";a.shapeArgs={x:e,y:n,r:u}});this.translateColors()}},square:{alignDataLabel:d.seriesTypes.heatmap.prototype.alignDataLabel,translate:d.seriesTypes.heatmap.prototype.translate,getSeriesPadding:function(){},haloPath:d.seriesTypes.heatmap.prototype.pointClass.prototype.haloPath}};d.wrap(d.Axis.prototype,"setAxisTranslation",function(a){a.apply(this,Array.prototype.slice.call(arguments,1));var b=this,c=x(d.map(b.series,function(a){return a.getSeriesPixelPadding&&
-a.getSeriesPixelPadding(b)}),function(a,b){return(a&&a.padding)>(b&&b.padding)?a:b})||{padding:0,axisLengthFactor:1},e=Math.round(c.padding*c.axisLengthFactor);c.padding&&(b.len-=e,a.apply(b,Array.prototype.slice.call(arguments,1)),b.minPixelPadding+=c.padding,b.len+=e)});g("tilemap","heatmap",{states:{hover:{halo:{enabled:!0,size:2,opacity:.5,attributes:{zIndex:3}}}},pointPadding:2,tileShape:"hexagon"},{setOptions:function(){var a=d.seriesTypes.heatmap.prototype.setOptions.apply(this,Array.prototype.slice.call(arguments));
-this.tileShape=d.tileShapeTypes[a.tileShape];return a},alignDataLabel:function(){return this.tileShape.alignDataLabel.apply(this,Array.prototype.slice.call(arguments))},getSeriesPixelPadding:function(a){var b=a.isXAxis,c=this.tileShape.getSeriesPadding(this),d;if(!c)return{padding:0,axisLengthFactor:1};d=Math.round(a.translate(b?2*c.xPad:c.yPad,0,1,0,1));a=Math.round(a.translate(b?c.xPad:0,0,1,0,1));return{padding:Math.abs(d-a)||0,axisLengthFactor:b?2:1.1}},translate:function(){return this.tileShape.translate.apply(this,
-Array.prototype.slice.call(arguments))}},d.extend({haloPath:function(){return this.series.tileShape.haloPath.apply(this,Array.prototype.slice.call(arguments))}},d.colorPointMixin))})(g)});
+(function(a){if(typeof module==='object'&&module.exports){module.exports=a;}else{a(Highcharts);}}(function(a){(function(a){var c=a.defined,b=a.each,d=a.noop,e=a.seriesTypes;a.colorPointMixin={isValid:function(){return this.value!==null;},setVisible:function(c){var a=this,d=c?'show':'hide';a.visible=c;b(['graphic','dataLabel'],function(b){if(a[b]){a[b][d]();}});},setState:function(d){var b=this,c=b.series;if(c.rasterLayer&&d&&!b.graphic){c.drawRasterState(b);}a.Point.prototype.setState.call(b,d);
+if(b.graphic){b.graphic.attr({zIndex:d==='hover'?1:0});}if(c.rasterLayer&&!b.state&&!b.selected&&b.graphic){b.graphic=b.graphic.destroy();}}};a.colorSeriesMixin={pointArrayMap:['value'],axisTypes:['xAxis','yAxis','colorAxis'],optionalAxis:'colorAxis',trackerGroups:['group','markerGroup','dataLabelsGroup'],getSymbol:d,parallelArrays:['x','y','value'],colorKey:'value',pointAttribs:e.column.prototype.pointAttribs,translateColors:function(){var e=this,d=this.options.nullColor,a=this.colorAxis,c=this.colorKey;
+b(this.data,function(b){var g=b[c],f;f=b.options.color||(b.isNull?d:(a&&g!==undefined)?a.toColor(g,b):b.color||e.color);if(f){b.color=f;}});},colorAttribs:function(a){var b={};if(c(a.color)){b[this.colorProp||'fill']=a.color;}return b;}};}(a));(function(a){var k=a.colorPointMixin,b=a.doc,e=a.each,f=a.isNumber,m=a.merge,h=a.noop,g=a.pick,i=a.Pointer,d=a.Series,n=a.seriesType,c=a.seriesTypes,p=a.win,j=!!(b.createElement('canvas').getContext&&b.createElement('canvas').getContext('2d'));function o(d,
+f){var a=f.shapeArgs,c,e,b=0;if(f.shapeType==='circle'){d.moveTo(a.x+a.r,a.y);d.arc(a.x,a.y,a.r,0,2*Math.PI,false);}else if(f.shapeType==='path'){c=a.d;while(b<c.length){if(typeof c[b]==='string'){e=c[b];b++;}if(e==='M'){d.moveTo(c[b],c[b+1]);b+=2;e='L';}else if(e==='L'){d.lineTo(c[b],c[b+1]);b+=2;}else{d.closePath();}}}else{d.rect(a.x,a.y,a.width,a.height);}}function l(e){var b=e.shapeArgs,d,c,f,g,a;if(e.shapeType==='circle'){return{x:b.x-b.r,y:b.y-b.r,width:2*b.r,height:2*b.r};}if(e.shapeType==='path'){d=b.d;
+a={x:Infinity,y:Infinity,x2:-Infinity,y2:-Infinity};for(c=0;c<d.length;c++){if(typeof d[c]!=='string'){f=d[c];g=d[++c];a.x=Math.min(a.x,f);a.y=Math.min(a.y,g);a.x2=Math.max(a.x2,f);a.y2=Math.max(a.y2,g);}}a.width=a.x2-a.x;a.height=a.y2-a.y;return a;}return b;}if(!c.heatmap){a.wrap(i.prototype,'getPointFromEvent',function(d,a){var b=d.call(this,a),c=a.target&&a.target.rasterSeries;if(!b&&c&&c.rasterLayer){b=c.getRasterPointFromEvent(a);}return b;});a.Chart.prototype.callbacks.push(function(b){a.addEvent(b.container,
+'mousemove',function(a){var d=a.target&&a.target.rasterSeries,c;if(d&&d.rasterLayer){c=d.getRasterPointFromEvent(a);if(c&&c!==b.hoverPoint){c.onMouseOver(a);}}});});}n('heatmap','scatter',{animation:false,borderWidth:0,nullColor:'#f7f7f7',dataLabels:{formatter:function(){return this.point.value;},inside:true,verticalAlign:'middle',crop:false,overflow:false,padding:0},marker:null,pointRange:null,tooltip:{pointFormat:'{point.x}, {point.y}: {point.value}<br/>'},states:{normal:{animation:true},hover:{halo:false,
+brightness:0.2}},rasterThreshold:1000,interpolation:false},m(a.colorSeriesMixin,{pointArrayMap:['y','value'],hasPointSpecificOptions:true,getExtremesFromAll:true,directTouch:true,init:function(){var a;c.scatter.prototype.init.apply(this,arguments);a=this.options;a.pointRange=g(a.pointRange,a.colsize||1);this.yAxis.axisPointRange=a.rowsize||1;},translate:function(){var b=this,f=b.options,a=b.xAxis,c=b.yAxis,h=f.pointPadding||0,d=function(c,a,b){return Math.min(Math.max(a,c),b);};b.generatePoints();
+e(b.points,function(b){var m=(f.colsize||1)/2,n=(f.rowsize||1)/2,i=d(Math.round(a.len-a.translate(b.x-m,0,1,0,1)),-a.len,2*a.len),j=d(Math.round(a.len-a.translate(b.x+m,0,1,0,1)),-a.len,2*a.len),k=d(Math.round(c.translate(b.y-n,0,1,0,1)),-c.len,2*c.len),l=d(Math.round(c.translate(b.y+n,0,1,0,1)),-c.len,2*c.len),e=g(b.pointPadding,h);b.plotX=b.clientX=(i+j)/2;b.plotY=(k+l)/2;b.shapeType='rect';b.shapeArgs={x:Math.min(i,j)+e,y:Math.min(k,l)+e,width:Math.abs(j-i)-e*2,height:Math.abs(l-k)-e*2};});b.translateColors();
+},drawPoints:function(){var a=this;if(a.isRasterSeries()){a.drawRaster();return;}a.destroyRaster();c.column.prototype.drawPoints.call(a);e(a.points,function(b){if(b.graphic){b.graphic.attr(a.colorAttribs(b));}});},isRasterSeries:function(){var a=this.options.rasterThreshold;return!!(j&&a&&!this.chart.polar&&this.points&&this.points.length>=a&&this.getRasterGrid());},getRasterGrid:function(){var c=this,j=c.options,t=c.xAxis,u=c.yAxis,k=c.points,i=k.length,o=j.colsize||1,p=j.rowsize||1,e=Infinity,
+q=-Infinity,g=Infinity,r=-Infinity,s=!!(j.pointPadding||j.borderWidth||t.isLog||u.isLog||t.isBroken||u.isBroken),d,m,n,h,l,a,b;c.rasterGrid=null;for(b=0;b<i;b++){a=k[b];if(typeof a.color!=='string'||!f(a.x)||!f(a.y)||!a.shapeArgs){return null;}e=Math.min(e,a.x);q=Math.max(q,a.x);g=Math.min(g,a.y);r=Math.max(r,a.y);if(a.shapeType!=='rect'||a.pointPadding||a.borderWidth){s=true;}}d=Math.round((q-e)/o)+1;m=Math.round((r-g)/p)+1;if(!i||d*m>Math.max(4*i,65536)){return null;}n=new Int32Array(d*m);for(b=0;
+b<i;b++){h=(k[b].x-e)/o;l=(k[b].y-g)/p;if(Math.abs(h-Math.round(h))>1e-6||Math.abs(l-Math.round(l))>1e-6){return null;}n[Math.round(l)*d+Math.round(h)]=b+1;}c.rasterGrid={xMin:e,yMin:g,colsize:o,rowsize:p,cols:d,rows:m,cells:n,tiled:s};return c.rasterGrid;},getRasterLayer:function(){var d=this,e=p.devicePixelRatio||1,h=Math.max(1,Math.ceil(d.xAxis.len)),g=Math.max(1,Math.ceil(d.yAxis.len)),c=d.rasterLayer,a,f;if(!c){a=b.createElement('canvas');c=d.rasterLayer={canvas:a,ctx:a.getContext('2d'),image:d.chart.renderer.image('',
+0,0,0,0).add(d.group)};c.image.element.rasterSeries=d;}a=c.canvas;f=c.ctx;if(a.width!==h*e){a.width=h*e;}if(a.height!==g*e){a.height=g*e;}f.setTransform(1,0,0,1,0,0);f.clearRect(0,0,a.width,a.height);f.setTransform(e,0,0,e,0,0);c.image.attr({width:h,height:g});return c;},destroyRaster:function(){var a=this;if(a.rasterLayer){a.rasterLayer.image.destroy();delete a.rasterLayer;delete a.rasterBitmap;}},drawRaster:function(){var a=this,b=a.getRasterLayer();e(a.points,function(a){var b=a.graphic;if(b){if(a.state||a.selected){b.attr(a.shapeArgs);
+}else{a.graphic=b.destroy();}}});if(a.rasterGrid.tiled){a.drawRasterTiles(b.ctx);}else{a.drawRasterBitmap(b.ctx);}b.image.attr({href:b.canvas.toDataURL('image/png')});},drawRasterBitmap:function(o){var h=this,c=h.rasterGrid,v=h.points,l=h.xAxis,u=h.yAxis,k=h.rasterBitmap||(h.rasterBitmap=b.createElement('canvas')),m,p,j,r={},n=h.colorAxis,q=n?255:1,e,i,d,s=l.len-l.translate(c.xMin-c.colsize/2,0,1,0,1),w=l.len-l.translate(c.xMin+(c.cols-0.5)*c.colsize,0,1,0,1),t=u.translate(c.yMin-c.rowsize/2,0,1,
+0,1),x=u.translate(c.yMin+(c.rows-0.5)*c.rowsize,0,1,0,1);k.width=c.cols;k.height=c.rows;m=k.getContext('2d');p=m.createImageData(c.cols,c.rows);j=p.data;for(d=0;d<c.cells.length;d++){i=c.cells[d]&&v[c.cells[d]-1];if(i&&i.visible!==false){e=r[i.color];if(!e){e=r[i.color]=n?n.getRGBA(i.color):a.color(i.color).rgba;}if(f(e[0])){j[4*d]=e[0]*q;j[4*d+1]=e[1]*q;j[4*d+2]=e[2]*q;j[4*d+3]=Math.round(255*g(e[3],1));}}}m.putImageData(p,0,0);o.imageSmoothingEnabled=!!h.options.interpolation;o.transform((w-s)/c.cols,
+0,0,(x-t)/c.rows,s,t);o.drawImage(k,0,0);},drawRasterTiles:function(b){var j=this,e=j.options,i=j.points,k=false,g,f,d,a,c,h=function(){if(k){b.fillStyle=g;b.fill();if(d&&f){b.strokeStyle=f;b.lineWidth=d;b.stroke();}}};for(c=0;c<i.length;c++){a=i[c];if(a.visible!==false){if(a.color!==g||(a.borderColor||e.borderColor)!==f||(a.borderWidth||e.borderWidth||0)!==d){h();k=true;g=a.color;f=a.borderColor||e.borderColor;d=a.borderWidth||e.borderWidth||0;b.beginPath();}o(b,a);}}h();},drawRasterState:function(a){var b=this;
+if(a.shapeArgs){a.graphic=b.chart.renderer[a.shapeType||'rect'](a.shapeArgs).addClass(a.getClassName(),true).attr(b.pointAttribs(a)).attr(b.colorAttribs(a)).add(b.group);a.graphic.element.point=a;}},getRasterPointFromEvent:function(d){var g=this,p=g.chart,b=g.rasterGrid,h=g.xAxis,k=g.yAxis,s=p.inverted,e,f,m,o,i,j,a,c,n,q,r=Infinity;if(!b){return;}d=p.pointer.normalize(d);e=s?h.len-(d.chartY-h.pos):d.chartX-h.pos;f=s?k.len-(d.chartX-k.pos):d.chartY-k.pos;m=Math.round((h.translate(h.len-e,1,1,0,1)-b.xMin)/b.colsize);
+o=Math.round((k.translate(f,1,1,0,1)-b.yMin)/b.rowsize);for(i=Math.max(m-1,0);i<=Math.min(m+1,b.cols-1);i++){for(j=Math.max(o-1,0);j<=Math.min(o+1,b.rows-1);j++){a=b.cells[j*b.cols+i];a=a&&g.points[a-1];if(a&&a.visible!==false){c=l(a);n=Math.pow(a.plotX-e,2)+Math.pow(a.plotY-f,2);if(e>=c.x&&e<=c.x+c.width&&f>=c.y&&f<=c.y+c.height&&n<r){q=a;r=n;}}}}return q;},destroy:function(){this.destroyRaster();d.prototype.destroy.apply(this,arguments);},animate:h,getBox:h,drawLegendSymbol:a.LegendSymbolMixin.drawRectangle,
+alignDataLabel:c.column.prototype.alignDataLabel,getExtremes:function(){d.prototype.getExtremes.call(this,this.valueData);this.valueMin=this.dataMin;this.valueMax=this.dataMax;d.prototype.getExtremes.call(this);}}),a.extend({haloPath:function(b){if(!b){return[];}var a=this.shapeArgs;return['M',a.x-b,a.y-b,'L',a.x-b,a.y+a.height+b,a.x+a.width+b,a.y+a.height+b,a.x+a.width+b,a.y-b,'Z'];}},k));}(a));(function(a){var g=a.seriesType,c=a.each,f=a.reduce,e=a.pick,b=function(c,a,b){return Math.min(Math.max(a,
+c),b);},d=function(b,c,d){var a=b.options;return{xPad:(a.colsize||1)/-c,yPad:(a.rowsize||1)/-d};};a.tileShapeTypes={hexagon:{alignDataLabel:a.seriesTypes.scatter.prototype.alignDataLabel,getSeriesPadding:function(a){return d(a,3,2);},haloPath:function(b){if(!b){return[];}var a=this.tileEdges;return['M',a.x2-b,a.y1+b,'L',a.x3+b,a.y1+b,a.x4+b*1.5,a.y2,a.x3+b,a.y3-b,a.x2-b,a.y3-b,a.x1-b*1.5,a.y2,'Z'];},translate:function(){var f=this,i=f.options,a=f.xAxis,d=f.yAxis,k=i.pointPadding||0,h=(i.colsize||1)/3,
+j=(i.rowsize||1)/2,g;f.generatePoints();c(f.points,function(c){var p=b(Math.floor(a.len-a.translate(c.x-h*2,0,1,0,1)),-a.len,2*a.len),i=b(Math.floor(a.len-a.translate(c.x-h,0,1,0,1)),-a.len,2*a.len),o=b(Math.floor(a.len-a.translate(c.x+h,0,1,0,1)),-a.len,2*a.len),r=b(Math.floor(a.len-a.translate(c.x+h*2,0,1,0,1)),-a.len,2*a.len),l=b(Math.floor(d.translate(c.y-j,0,1,0,1)),-d.len,2*d.len),m=b(Math.floor(d.translate(c.y,0,1,0,1)),-d.len,2*d.len),f=b(Math.floor(d.translate(c.y+j,0,1,0,1)),-d.len,2*d.len),
+n=e(c.pointPadding,k),s=n*Math.abs(i-p)/Math.abs(f-m),t=a.reversed?-s:s,q=a.reversed?-n:n,u=d.reversed?-n:n;if(c.x%2){g=g||Math.round(Math.abs(f-l)/2)*(d.reversed?-1:1);l+=g;m+=g;f+=g;}c.plotX=c.clientX=(i+o)/2;c.plotY=m;p+=t+q;i+=q;o-=q;r-=t+q;l-=u;f+=u;c.tileEdges={x1:p,x2:i,x3:o,x4:r,y1:l,y2:m,y3:f};c.shapeType='path';c.shapeArgs={d:['M',i,l,'L',o,l,r,m,o,f,i,f,p,m,'Z']};});f.translateColors();}},diamond:{alignDataLabel:a.seriesTypes.scatter.prototype.alignDataLabel,getSeriesPadding:function(a){return d(a,
+2,2);},haloPath:function(b){if(!b){return[];}var a=this.tileEdges;return['M',a.x2,a.y1+b,'L',a.x3+b,a.y2,a.x2,a.y3-b,a.x1-b,a.y2,'Z'];},translate:function(){var f=this,h=f.options,a=f.xAxis,d=f.yAxis,k=h.pointPadding||0,i=(h.colsize||1),j=(h.rowsize||1)/2,g;f.generatePoints();c(f.points,function(c){var n=b(Math.round(a.len-a.translate(c.x-i,0,1,0,0)),-a.len,2*a.len),l=b(Math.round(a.len-a.translate(c.x,0,1,0,0)),-a.len,2*a.len),p=b(Math.round(a.len-a.translate(c.x+i,0,1,0,0)),-a.len,2*a.len),m=b(Math.round(d.translate(c.y-j,
+0,1,0,0)),-d.len,2*d.len),f=b(Math.round(d.translate(c.y,0,1,0,0)),-d.len,2*d.len),h=b(Math.round(d.translate(c.y+j,0,1,0,0)),-d.len,2*d.len),o=e(c.pointPadding,k),q=o*Math.abs(l-n)/Math.abs(h-f),r=a.reversed?-q:q,s=d.reversed?-o:o;if(c.x%2){g=Math.abs(h-m)/2*(d.reversed?-1:1);m+=g;f+=g;h+=g;}c.plotX=c.clientX=l;c.plotY=f;n+=r;p-=r;m-=s;h+=s;c.tileEdges={x1:n,x2:l,x3:p,y1:m,y2:f,y3:h};c.shapeType='path';c.shapeArgs={d:['M',l,m,'L',p,f,l,h,n,f,'Z']};});f.translateColors();}},circle:{alignDataLabel:a.seriesTypes.scatter.prototype.alignDataLabel,
+getSeriesPadding:function(a){return d(a,2,2);},haloPath:function(b){return a.seriesTypes.scatter.prototype.pointClass.prototype.haloPath.call(this,b+(b&&this.radius));},translate:function(){var e=this,j=e.options,a=e.xAxis,d=e.yAxis,m=j.pointPadding||0,n=(j.rowsize||1)/2,l=(j.colsize||1),g,f,k,i,h=false;e.generatePoints();c(e.points,function(c){var j=b(Math.round(a.len-a.translate(c.x,0,1,0,0)),-a.len,2*a.len),e=b(Math.round(d.translate(c.y,0,1,0,0)),-d.len,2*d.len),p=m,o=false;if(c.pointPadding!==undefined){p=c.pointPadding;
+o=true;h=true;}if(!i||h){g=Math.abs(b(Math.floor(a.len-a.translate(c.x+l,0,1,0,0)),-a.len,2*a.len)-j);f=Math.abs(b(Math.floor(d.translate(c.y+n,0,1,0,0)),-d.len,2*d.len)-e);k=Math.floor(Math.sqrt((g*g+f*f))/2);i=Math.min(g,k,f)-p;if(h&&!o){h=false;}}if(c.x%2){e+=f*(d.reversed?-1:1);}c.plotX=c.clientX=j;c.plotY=e;c.radius=i;c.shapeType='circle';c.shapeArgs={x:j,y:e,r:i};});e.translateColors();}},square:{alignDataLabel:a.seriesTypes.heatmap.prototype.alignDataLabel,translate:a.seriesTypes.heatmap.prototype.translate,
+getSeriesPadding:function(){return;},haloPath:a.seriesTypes.heatmap.prototype.pointClass.prototype.haloPath}};a.wrap(a.Axis.prototype,'setAxisTranslation',function(e){e.apply(this,Array.prototype.slice.call(arguments,1));var b=this,c=f(a.map(b.series,function(a){return a.getSeriesPixelPadding&&a.getSeriesPixelPadding(b);}),function(a,b){return(a&&a.padding)>(b&&b.padding)?a:b;})||{padding:0,axisLengthFactor:1},d=Math.round(c.padding*c.axisLengthFactor);if(c.padding){b.len-=d;e.apply(b,Array.prototype.slice.call(arguments,
+1));b.minPixelPadding+=c.padding;b.len+=d;}});g('tilemap','heatmap',{states:{hover:{halo:{enabled:true,size:2,opacity:0.5,attributes:{zIndex:3}}}},pointPadding:2,tileShape:'hexagon'},{setOptions:function(){var b=a.seriesTypes.heatmap.prototype.setOptions.apply(this,Array.prototype.slice.call(arguments));this.tileShape=a.tileShapeTypes[b.tileShape];return b;},alignDataLabel:function(){return this.tileShape.alignDataLabel.apply(this,Array.prototype.slice.call(arguments));},getSeriesPixelPadding:function(b){var c=b.isXAxis,
+a=this.tileShape.getSeriesPadding(this),d,e;if(!a){return{padding:0,axisLengthFactor:1};}d=Math.round(b.translate(c?a.xPad*2:a.yPad,0,1,0,1));e=Math.round(b.translate(c?a.xPad:0,0,1,0,1));return{padding:Math.abs(d-e)||0,axisLengthFactor:c?2:1.1};},translate:function(){return this.tileShape.translate.apply(this,Array.prototype.slice.call(arguments));}},a.extend({haloPath:function(){return this.series.tileShape.haloPath.apply(this,Array.prototype.slice.call(arguments));}},a.colorPointMixin));}(a));
+}));
@@ -7,11 +7,27 @@
 
  License: www.highcharts.com/license
 */
-(function(k){"object"===typeof module&&module.exports?module.exports=k:k(Highcharts)})(function(k){(function(c){function k(b){var a=this.series.chart,d=b.apply(this,Array.prototype.slice.call(arguments,1)),u,g;a.hasParallelCoordinates&&!n(d.formattedValue)&&(g=a.yAxis[this.x],a=g.options,a=(u=v(a.tooltipValueFormat,a.labels.format))?c.format(u,q(this,{value:this.y})):g.isDatetimeAxis?c.dateFormat(a.dateTimeLabelFormats[g.tickPositions.info.unitName],this.y):a.categories?a.categories[this.y]:this.y,
-d.formattedValue=d.point.formattedValue=a);return d}var r=c.Series.prototype,t=c.Chart.prototype,p=c.Axis.prototype,v=c.pick,l=c.each,e=c.wrap,m=c.merge,y=c.erase,w=c.splat,q=c.extend,n=c.defined,z=c.arrayMin,A=c.arrayMax,x={opposite:!0,type:"category"};c.setOptions({chart:{parallelCoordinates:!1,parallelAxes:{title:{text:"",reserveSpace:!1},labels:{x:0,y:4,align:"center",reserveSpace:!1},offset:0}}});e(t,"init",function(b,a){var d=w(a.yAxis||{}),c=d.length,g=[];if(this.hasParallelCoordinates=a.chart&&
-a.chart.parallelCoordinates){for(this.setParallelInfo(a);c<=this.parallelInfo.counter;c++)g.push({});a=m({legend:{enabled:!1}},a,{boost:{seriesThreshold:Number.MAX_SAFE_INTEGER},plotOptions:{series:{boostThreshold:Number.MAX_SAFE_INTEGER}}});a.yAxis=d.concat(g);a.xAxis=m(x,w(a.xAxis||{})[0])}return b.call(this,a)});e(t,"update",function(b,a){a.chart&&(n(a.chart.parallelCoordinates)&&(this.hasParallelCoordinates=a.chart.parallelCoordinates),this.hasParallelCoordinates&&a.chart.parallelAxes&&(this.options.chart.parallelAxes=
-m(this.options.chart.parallelAxes,a.chart.parallelAxes),l(this.yAxis,function(a){a.update({},!1)})));return b.apply(this,Array.prototype.slice.call(arguments,1))});q(t,{setParallelInfo:function(b){var a=this;b=b.series;a.parallelInfo={counter:0};l(b,function(d){d.data&&(a.parallelInfo.counter=Math.max(a.parallelInfo.counter,d.data.length-1))})}});p.keepProps.push("parallelPosition");e(p,"setOptions",function(b,a){var d=this.chart,c=["left","width","height","top"];b.apply(this,Array.prototype.slice.call(arguments,
-1));d.hasParallelCoordinates&&(d.inverted&&(c=c.reverse()),this.isXAxis?this.options=m(this.options,x,a):(this.options=m(this.options,this.chart.options.chart.parallelAxes,a),this.parallelPosition=v(this.parallelPosition,d.yAxis.length),this.setParallelPosition(c,this.options)))});e(p,"getSeriesExtremes",function(b){if(this.chart.hasParallelCoordinates&&!this.isXAxis){var a=this.parallelPosition,d=[];l(this.series,function(b){n(b.yData[a])&&d.push(b.yData[a])});this.dataMin=z(d);this.dataMax=A(d)}else b.apply(this,
-Array.prototype.slice.call(arguments,1))});q(p,{setParallelPosition:function(b,a){a[b[0]]=100*(this.parallelPosition+.5)/(this.chart.parallelInfo.counter+1)+"%";this[b[1]]=a[b[1]]=0;this[b[2]]=a[b[2]]=null;this[b[3]]=a[b[3]]=null}});e(r,"bindAxes",function(b){if(this.chart.hasParallelCoordinates){var a=this;l(this.chart.axes,function(b){a.insert(b.series);b.isDirty=!0});a.xAxis=this.chart.xAxis[0];a.yAxis=this.chart.yAxis[0]}else b.apply(this,Array.prototype.slice.call(arguments,1))});e(r,"translate",
-function(b){b.apply(this,Array.prototype.slice.call(arguments,1));var a=this.chart,d=this.points,c=d&&d.length,g=Number.MAX_VALUE,e,f,h;if(this.chart.hasParallelCoordinates){for(h=0;h<c;h++)f=d[h],n(f.y)?(f.plotX=f.clientX=a.inverted?a.plotHeight-a.yAxis[h].top+a.plotTop:a.yAxis[h].left-a.plotLeft,f.plotY=a.yAxis[h].translate(f.y,!1,!0,null,!0),void 0!==e&&(g=Math.min(g,Math.abs(f.plotX-e))),e=f.plotX,f.isInside=a.isInsidePlot(f.plotX,f.plotY,a.inverted)):f.isNull=!0;this.closestPointRangePx=g}});
-e(r,"destroy",function(b){if(this.chart.hasParallelCoordinates){var a=this;l(this.chart.axes||[],function(b){b&&b.series&&(y(b.series,a),b.isDirty=b.forceRedraw=!0)})}b.apply(this,Array.prototype.slice.call(arguments,1))});l(["line","spline"],function(b){e(c.seriesTypes[b].prototype.pointClass.prototype,"getLabelConfig",k)})})(k)});
+(function(a){if(typeof module==='object'&&module.exports){module.exports=a;}else{a(Highcharts);}}(function(a){(function(a){var h=a.Series.prototype,g=a.Chart.prototype,d=a.Axis.prototype,i=a.addEvent,e=a.doc,w=a.fireEvent,l=a.isNumber,o=a.pick,b=a.each,c=a.wrap,f=a.merge,v=a.erase,p=a.splat,k=a.extend,j=a.defined,s=a.arrayMin,r=a.arrayMax,m=a.win,t=!!(e.createElement('canvas').getContext&&e.createElement('canvas').getContext('2d'));var n={opposite:true,type:'category'};var u={parallelCoordinates:false,
+parallelRasterThreshold:1000,parallelRasterOpacity:0.3,parallelAxes:{title:{text:'',reserveSpace:false},labels:{x:0,y:4,align:'center',reserveSpace:false},offset:0,brush:{enabled:false,width:16,inactiveOpacity:0.1}}};a.setOptions({chart:u});c(g,'init',function(e,a){var b=p(a.yAxis||{}),d=b.length,c=[];this.hasParallelCoordinates=a.chart&&a.chart.parallelCoordinates;if(this.hasParallelCoordinates){this.setParallelInfo(a);for(;d<=this.parallelInfo.counter;d++){c.push({});}a=f({legend:{enabled:false}},
+a,{boost:{seriesThreshold:Number.MAX_SAFE_INTEGER},plotOptions:{series:{boostThreshold:Number.MAX_SAFE_INTEGER}}});a.yAxis=b.concat(c);a.xAxis=f(n,p(a.xAxis||{})[0]);}return e.call(this,a);});c(g,'update',function(c,a){if(a.chart){if(j(a.chart.parallelCoordinates)){this.hasParallelCoordinates=a.chart.parallelCoordinates;}if(this.hasParallelCoordinates&&a.chart.parallelAxes){this.options.chart.parallelAxes=f(this.options.chart.parallelAxes,a.chart.parallelAxes);b(this.yAxis,function(a){a.update({},
+false);});}}return c.apply(this,Array.prototype.slice.call(arguments,1));});g.callbacks.push(function(a){a.renderParallel();i(a,'redraw',function(){a.renderParallel();});});k(g,{setParallelInfo:function(c){var a=this,d=c.series;a.parallelInfo={counter:0};b(d,function(b){if(b.data){a.parallelInfo.counter=Math.max(a.parallelInfo.counter,b.data.length-1);}});},isParallelRaster:function(){var a=this.options.chart.parallelRasterThreshold;return!!(t&&a&&this.series.length>=a);},renderParallel:function(){var a=this,
+b=a.hasParallelCoordinates&&a.isParallelRaster(),c=a.isDirtyParallelRaster;if(!b){a.destroyParallelRaster();}if(a.hasParallelCoordinates&&a.isDirtyParallelBrush){a.updateParallelBrushes();}if(b&&c){a.drawParallelRaster();}a.isDirtyParallelRaster=false;},getParallelLayer:function(n){var c=this,o=c.renderer,h=c.xAxis[0],i=c.yAxis[0],k=c.inverted,f=m.devicePixelRatio||1,l=Math.max(1,Math.ceil(h.len)),j=Math.max(1,Math.ceil(i.len)),b=c.parallelRaster,d,a,g;if(!b){b=c.parallelRaster={group:o.g('parallel-raster').attr({zIndex:0.1}).add(c.seriesGroup),
+layers:[]};}b.group.attr({translateX:(k?i:h).left,translateY:(k?h:i).top});b.group.width=i.len;b.group.height=h.len;b.group.invert(k);d=b.layers[n];if(!d){a=e.createElement('canvas');d=b.layers[n]={canvas:a,ctx:a.getContext('2d'),image:o.image('',0,0,0,0).add(b.group)};}a=d.canvas;g=d.ctx;if(a.width!==l*f){a.width=l*f;}if(a.height!==j*f){a.height=j*f;}g.setTransform(1,0,0,1,0,0);g.clearRect(0,0,a.width,a.height);g.setTransform(f,0,0,f,0,0);d.image.attr({width:l,height:j});return d;},destroyParallelRaster:function(){if(this.parallelRaster){this.parallelRaster.group.destroy();
+delete this.parallelRaster;}},drawParallelRaster:function(){var a=this,b=a.getParallelLayer(0);a.drawParallelRecords(b);a.drawParallelSelection();},drawParallelSelection:function(){var a=this,c=a.parallelBrushed,d=a.options.chart.parallelAxes.brush,b;if(!a.parallelRaster){return;}b=a.getParallelLayer(1);if(c){a.drawParallelRecords(b,a.parallelSelected);}else{b.image.attr({href:''});}a.parallelRaster.layers[0].image.attr({opacity:c?d.inactiveOpacity:1});},drawParallelRecords:function(i,m){var h=this,
+a=i.ctx,g=h.series,o={},n,k,d,j,c,f,b,e;a.globalAlpha=h.options.chart.parallelRasterOpacity;a.lineJoin='round';a.lineCap='round';for(b=0;b<g.length;b++){if(!g[b].visible||(m&&!m[b])){continue;}d=h.getParallelRecordStyle(g[b],o);if(d.color!==n){a.strokeStyle=n=d.color;}if(d.width!==k){a.lineWidth=k=d.width;}j=g[b].points||[];f=false;a.beginPath();for(e=0;e<j.length;e++){c=j[e];if(c.isNull||!l(c.plotY)){f=false;}else if(f){a.lineTo(c.plotX,c.plotY);}else{a.moveTo(c.plotX,c.plotY);f=true;}}a.stroke();
+}i.image.attr({href:i.canvas.toDataURL('image/png')});},getParallelRecordStyle:function(b,e){var c=b.colorIndex+' '+(b.options.className||''),d,a;if(!e[c]){d=this.renderer.path(['M',0,0]).addClass('highcharts-graph highcharts-color-'+b.colorIndex+' '+(b.options.className||'')).add(this.parallelRaster.group);a=m.getComputedStyle&&m.getComputedStyle(d.element);e[c]={color:(a&&a.stroke)||'#000000',width:(a&&parseFloat(a.strokeWidth))||1};d.destroy();}return e[c];},updateParallelBrushes:function(){var a=this,
+f=new Int32Array(a.series.length),e=new Uint8Array(a.series.length),d=0,c;for(c=0;c<e.length;c++){e[c]=1;}a.isDirtyParallelBrush=false;a.parallelHits=f;a.parallelSelected=e;b(a.yAxis,function(a){var e,c,b;delete a.brushSlice;if(a.brush){e=a.getBrushIndex();c=a.brushSlice=a.getBrushSlice();for(b=c.start;b<c.end;b++){f[e.records[b]]++;}d++;}});a.selectParallelRecords(null,!!(d||a.parallelBrushed));a.parallelBrushed=d;},moveParallelBrush:function(a){var b=this,i=b.parallelHits,g,d,c,h=[],e=b.parallelBrushed;
+if(b.isDirtyParallelBrush||!i){b.updateParallelBrushes();return;}g=a.getBrushIndex().records;d=a.brushSlice||{start:0,end:0};c=a.brush?a.getBrushSlice():{start:0,end:0};function f(d,c,b){var a;for(a=d;a<c;a++){i[g[a]]+=b;h.push(g[a]);}}f(d.start,Math.min(d.end,c.start),-1);f(Math.max(d.start,c.end),d.end,-1);f(c.start,Math.min(c.end,d.start),1);f(Math.max(c.start,d.end),c.end,1);if(a.brushSlice&&!a.brush){e--;}else if(!a.brushSlice&&a.brush){e++;}if(a.brush){a.brushSlice=c;}else{delete a.brushSlice;
+}if(e!==b.parallelBrushed){b.parallelBrushed=e;b.selectParallelRecords(null,true);}else{b.selectParallelRecords(h);}},selectParallelRecords:function(e,j){var a=this,g=a.series,m=a.parallelHits,l=a.parallelSelected,h=a.parallelBrushed,k=a.parallelRaster,o=a.options.chart.parallelAxes.brush.inactiveOpacity,i=j,n=e?e.length:g.length,f,c,d;for(d=0;d<n;d++){c=e?e[d]:d;f=!h||m[c]===h?1:0;if(j||f!==l[c]){l[c]=f;i=true;if(!k){b(['group','markerGroup','dataLabelsGroup'],function(a){if(g[c][a]){g[c][a].attr({opacity:f?1:o});
+}});}}}if(k&&i){a.drawParallelSelection();}}});d.keepProps.push('parallelPosition','brush');c(d,'setOptions',function(e,d){var a=this,c=a.chart,b=['left','width','height','top'];e.apply(a,Array.prototype.slice.call(arguments,1));if(c.hasParallelCoordinates){if(c.inverted){b=b.reverse();}if(a.isXAxis){a.options=f(a.options,n,d);}else{a.options=f(a.options,a.chart.options.chart.parallelAxes,d);a.parallelPosition=o(a.parallelPosition,c.yAxis.length);a.setParallelPosition(b,a.options);}}});c(d,'getSeriesExtremes',
+function(d){if(this.chart.hasParallelCoordinates&&!this.isXAxis){var c=this.parallelPosition,a=[];b(this.series,function(b){if(j(b.yData[c])){a.push(b.yData[c]);}});this.dataMin=s(a);this.dataMax=r(a);this.brushIndex=null;this.chart.isDirtyParallelBrush=true;}else{d.apply(this,Array.prototype.slice.call(arguments,1));}});c(d,'render',function(a){a.apply(this,Array.prototype.slice.call(arguments,1));if(this.chart.hasParallelCoordinates&&this.coll==='yAxis'){this.renderBrush();}});c(d,'destroy',function(a){this.destroyBrush();
+return a.apply(this,Array.prototype.slice.call(arguments,1));});k(d,{setParallelPosition:function(a,b){b[a[0]]=100*(this.parallelPosition+0.5)/(this.chart.parallelInfo.counter+1)+'%';this[a[1]]=b[a[1]]=0;this[a[2]]=b[a[2]]=null;this[a[3]]=b[a[3]]=null;},setBrush:function(b,c){var a=this;a.brush=l(b)&&l(c)?{from:Math.min(b,c),to:Math.max(b,c)}:undefined;a.renderBrush();a.chart.moveParallelBrush(a);w(a,'brush',k({},a.brush));},getBrushIndex:function(){var c=this,e=c.chart.series,h=c.parallelPosition,
+b=[],d=[],f,g,a;if(!c.brushIndex){for(a=0;a<e.length;a++){g=e[a].yData&&e[a].yData[h];if(l(g)){b.push(a);}d[a]=g;}b.sort(function(a,b){return d[a]-d[b];});f=new Float64Array(b.length);for(a=0;a<b.length;a++){f[a]=d[b[a]];}c.brushIndex={records:new Int32Array(b),values:f};}return c.brushIndex;},getBrushSlice:function(){var a=this.getBrushIndex().values,b=this.brush;function c(e,f){var c=0,d=a.length,b;while(c<d){b=(c+d)>>1;if(a[b]<e||(f&&a[b]===e)){c=b+1;}else{d=b;}}return c;}return{start:c(b.from),
+end:c(b.to,true)};},renderBrush:function(){var a=this,h=a.chart.renderer,j=a.options.brush,g=a.horiz,c=j.width,f=a.brush,d,e;if(!j.enabled){a.destroyBrush();return;}if(!a.brushGroup){a.brushGroup=h.g('parallel-brush').attr({zIndex:7}).add();a.brushTracker=h.rect().addClass('highcharts-parallel-brush-tracker').css({cursor:g?'ew-resize':'ns-resize'}).add(a.brushGroup);a.brushRect=h.rect().addClass('highcharts-parallel-brush').css({pointerEvents:'none'}).add(a.brushGroup);b(['mousedown','touchstart'],
+function(b){i(a.brushTracker.element,b,function(b){a.onBrushStart(b);});});}a.brushTracker.attr(g?{x:a.left,y:a.top-c/2,width:a.len,height:c}:{x:a.left-c/2,y:a.top,width:c,height:a.len});if(f){d=Math.min(Math.max(a.toPixels(f.from),a.pos),a.pos+a.len);e=Math.min(Math.max(a.toPixels(f.to),a.pos),a.pos+a.len);a.brushRect.attr(g?{x:Math.min(d,e),y:a.top-c/2,width:Math.abs(e-d),height:c}:{x:a.left-c/2,y:Math.min(d,e),width:c,height:Math.abs(e-d)}).show();}else{a.brushRect.hide();}},destroyBrush:function(){if(this.brushGroup){this.brushGroup.destroy();
+delete this.brushGroup;delete this.brushTracker;delete this.brushRect;}},onBrushStart:function(c){var a=this,g=a.chart.pointer,k=a.getBrushValue(g.normalize(c)),f=false,d=[];function j(b){f=true;a.setBrush(k,a.getBrushValue(g.normalize(b)));b.preventDefault();}function h(){b(d,function(a){a();});if(!f){a.setBrush();}}b(['mousemove','touchmove'],function(a){d.push(i(e,a,j));});b(['mouseup','touchend','touchcancel'],function(a){d.push(i(e,a,h));});c.stopPropagation();c.preventDefault();},getBrushValue:function(b){var a=this,
+c=a.horiz?b.chartX:b.chartY;return a.toValue(Math.min(Math.max(c,a.pos),a.pos+a.len));}});c(h,'bindAxes',function(c){if(this.chart.hasParallelCoordinates){var a=this;b(this.chart.axes,function(b){a.insert(b.series);b.isDirty=true;});a.xAxis=this.chart.xAxis[0];a.yAxis=this.chart.yAxis[0];a.chart.isDirtyParallelBrush=true;}else{c.apply(this,Array.prototype.slice.call(arguments,1));}});c(h,'translate',function(i){i.apply(this,Array.prototype.slice.call(arguments,1));var g=this,b=g.chart,f=g.points,
+h=f&&f.length,d=Number.MAX_VALUE,e,a,c;if(this.chart.hasParallelCoordinates){for(c=0;c<h;c++){a=f[c];if(j(a.y)){a.plotX=a.clientX=b.inverted?b.plotHeight-b.yAxis[c].top+b.plotTop:b.yAxis[c].left-b.plotLeft;a.plotY=b.yAxis[c].translate(a.y,false,true,null,true);if(e!==undefined){d=Math.min(d,Math.abs(a.plotX-e));}e=a.plotX;a.isInside=b.isInsidePlot(a.plotX,a.plotY,b.inverted);}else{a.isNull=true;}}this.closestPointRangePx=d;}});c(h,'render',function(d){var a=this,c=a.chart;if(c.hasParallelCoordinates&&c.isParallelRaster()){b(a.points||[],
+function(a){b(['graphic','dataLabel'],function(b){if(a[b]){a[b]=a[b].destroy();}});});b(['graph','tracker','group','markerGroup','dataLabelsGroup'],function(b){if(a[b]){a[b]=a[b].destroy();}});a.isDirty=false;a.hasRendered=true;c.isDirtyParallelRaster=true;}else{d.apply(a,Array.prototype.slice.call(arguments,1));}});c(h,'destroy',function(c){if(this.chart.hasParallelCoordinates){var a=this;b(this.chart.axes||[],function(b){if(b&&b.series){v(b.series,a);b.isDirty=b.forceRedraw=true;}});a.chart.isDirtyParallelBrush=true;
+a.chart.isDirtyParallelRaster=true;}c.apply(this,Array.prototype.slice.call(arguments,1));});function q(h){var g=this.series.chart,d=h.apply(this,Array.prototype.slice.call(arguments,1)),c,b,f,e;if(g.hasParallelCoordinates&&!j(d.formattedValue)){e=g.yAxis[this.x];b=e.options;f=o(b.tooltipValueFormat,b.labels.format);if(f){c=a.format(f,k(this,{value:this.y}));}else if(e.isDatetimeAxis){c=a.dateFormat(b.dateTimeLabelFormats[e.tickPositions.info.unitName],this.y);}else if(b.categories){c=b.categories[this.y];
+}else{c=this.y;}d.formattedValue=d.point.formattedValue=c;}return d;}b(['line','spline'],function(b){c(a.seriesTypes[b].prototype.pointClass.prototype,'getLabelConfig',q);});}(a));}));
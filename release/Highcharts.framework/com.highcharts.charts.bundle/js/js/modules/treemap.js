@@ -6,27 +6,30 @@
 
  License: www.highcharts.com/license
 */
-(function(v){"object"===typeof module&&module.exports?module.exports=v:v(Highcharts)})(function(v){var I=function(d){var v=d.each,x=d.extend,p=d.pick;return{getColor:function(q,m){var E=m.index,h=m.levelMap,l=m.parentColor,v=m.parentColorIndex,w=m.series,r=m.colors,x=m.siblings,f=w.points,t,B,C;if(q){f=f[q.i];q=h[q.levelDynamic]||{};(t=f&&("boolean"===typeof q.colorByPoint?q.colorByPoint:!!w.options.colorByPoint))&&(B=r[f.index%r.length]);r=f&&f.options.color;t=q&&q.color;if(h=l)h=(h=q&&q.colorVariation)&&
-"brightness"===h.key?d.color(l).brighten(E/x*h.to).get():l;t=p(r,t,B,h,w.color);C=p(f&&f.options.colorIndex,q&&q.colorIndex,v,m.colorIndex)}return{color:t,colorIndex:C}},setTreeValues:function m(d,h){var l=h.before,z=h.idRoot,w=h.mapIdToNode[z],r=h.points[d.i],A=r&&r.options||{},f=0,t=[];x(d,{levelDynamic:d.level-(("boolean"===typeof h.levelIsConstant?h.levelIsConstant:1)?0:w.level),name:p(r&&r.name,""),visible:z===d.id||("boolean"===typeof h.visible?h.visible:!1)});"function"===typeof l&&(d=l(d,
-h));v(d.children,function(l,p){var r=x({},h);x(r,{index:p,siblings:d.children.length,visible:d.visible});l=m(l,r);t.push(l);l.visible&&(f+=l.val)});d.visible=0<f||d.visible;l=p(A.value,f);x(d,{children:t,childrenTotal:f,isLeaf:d.visible&&!f,val:l});return d}}}(v);(function(d,v){var x=d.seriesType,p=d.seriesTypes,q=d.map,m=d.merge,E=d.extend,h=d.noop,l=d.each,z=v.getColor,w=d.grep,r=d.isNumber,A=d.isString,f=d.pick,t=d.Series,B=d.stableSort,C=function(a,b,c){c=c||this;d.objectEach(a,function(n,e){b.call(c,
-n,e,a)})},F=d.reduce,D=function(a,b,c){c=c||this;a=b.call(c,a);!1!==a&&D(a,b,c)};x("treemap","scatter",{showInLegend:!1,marker:!1,dataLabels:{enabled:!0,defer:!1,verticalAlign:"middle",formatter:function(){return this.point.name||this.point.id},inside:!0},tooltip:{headerFormat:"",pointFormat:"\x3cb\x3e{point.name}\x3c/b\x3e: {point.value}\x3cbr/\x3e"},ignoreHiddenPoint:!0,layoutAlgorithm:"sliceAndDice",layoutStartingDirection:"vertical",alternateStartingDirection:!1,levelIsConstant:!0,drillUpButton:{position:{align:"right",
-x:-10,y:10}}},{pointArrayMap:["value"],axisTypes:p.heatmap?["xAxis","yAxis","colorAxis"]:["xAxis","yAxis"],directTouch:!0,optionalAxis:"colorAxis",getSymbol:h,parallelArrays:["x","y","value","colorValue"],colorKey:"colorValue",translateColors:p.heatmap&&p.heatmap.prototype.translateColors,colorAttribs:p.heatmap&&p.heatmap.prototype.colorAttribs,trackerGroups:["group","dataLabelsGroup"],getListOfParents:function(a,b){a=F(a||[],function(a,b,e){b=f(b.parent,"");void 0===a[b]&&(a[b]=[]);a[b].push(e);
-return a},{});C(a,function(a,n,e){""!==n&&-1===d.inArray(n,b)&&(l(a,function(a){e[""].push(a)}),delete e[n])});return a},getTree:function(){var a=q(this.data,function(a){return a.id}),a=this.getListOfParents(this.data,a);this.nodeMap=[];return this.buildNode("",-1,0,a,null)},init:function(a,b){t.prototype.init.call(this,a,b);this.options.allowDrillToNode&&d.addEvent(this,"click",this.onClickDrillToNode)},buildNode:function(a,b,c,n,e){var y=this,d=[],g=y.points[b],G=0,H;l(n[a]||[],function(b){H=y.buildNode(y.points[b].id,
-b,c+1,n,a);G=Math.max(H.height+1,G);d.push(H)});b={id:a,i:b,children:d,height:G,level:c,parent:e,visible:!1};y.nodeMap[b.id]=b;g&&(g.node=b);return b},setTreeValues:function(a){var b=this,c=b.options,n=b.nodeMap[b.rootNode],c="boolean"===typeof c.levelIsConstant?c.levelIsConstant:!0,e=0,d=[],k,g=b.points[a.i];l(a.children,function(a){a=b.setTreeValues(a);d.push(a);a.ignore||(e+=a.val)});B(d,function(a,c){return a.sortIndex-c.sortIndex});k=f(g&&g.options.value,e);g&&(g.value=k);E(a,{children:d,childrenTotal:e,
-ignore:!(f(g&&g.visible,!0)&&0<k),isLeaf:a.visible&&!e,levelDynamic:a.level-(c?0:n.level),name:f(g&&g.name,""),sortIndex:f(g&&g.sortIndex,-k),val:k});return a},calculateChildrenAreas:function(a,b){var c=this,n=c.options,e=this.levelMap[a.levelDynamic+1],d=f(c[e&&e.layoutAlgorithm]&&e.layoutAlgorithm,n.layoutAlgorithm),k=n.alternateStartingDirection,g=[];a=w(a.children,function(a){return!a.ignore});e&&e.layoutStartingDirection&&(b.direction="vertical"===e.layoutStartingDirection?0:1);g=c[d](b,a);l(a,
-function(a,e){e=g[e];a.values=m(e,{val:a.childrenTotal,direction:k?1-b.direction:b.direction});a.pointValues=m(e,{x:e.x/c.axisRatio,width:e.width/c.axisRatio});a.children.length&&c.calculateChildrenAreas(a,a.values)})},setPointValues:function(){var a=this.xAxis,b=this.yAxis;l(this.points,function(c){var d=c.node,e=d.pointValues,y,k;e&&d.visible?(d=Math.round(a.translate(e.x,0,0,0,1))-0,y=Math.round(a.translate(e.x+e.width,0,0,0,1))-0,k=Math.round(b.translate(e.y,0,0,0,1))-0,e=Math.round(b.translate(e.y+
-e.height,0,0,0,1))-0,c.shapeType="rect",c.shapeArgs={x:Math.min(d,y),y:Math.min(k,e),width:Math.abs(y-d),height:Math.abs(e-k)},c.plotX=c.shapeArgs.x+c.shapeArgs.width/2,c.plotY=c.shapeArgs.y+c.shapeArgs.height/2):(delete c.plotX,delete c.plotY)})},setColorRecursive:function(a,b,c,d,e){var n=this,k=n&&n.chart,k=k&&k.options&&k.options.colors,g;if(a){g=z(a,{colors:k,index:d,levelMap:n.levelMap,parentColor:b,parentColorIndex:c,series:n,siblings:e});if(b=n.points[a.i])b.color=g.color,b.colorIndex=g.colorIndex;
-l(a.children||[],function(c,b){n.setColorRecursive(c,g.color,g.colorIndex,b,a.children.length)})}},algorithmGroup:function(a,b,c,d){this.height=a;this.width=b;this.plot=d;this.startDirection=this.direction=c;this.lH=this.nH=this.lW=this.nW=this.total=0;this.elArr=[];this.lP={total:0,lH:0,nH:0,lW:0,nW:0,nR:0,lR:0,aspectRatio:function(a,c){return Math.max(a/c,c/a)}};this.addElement=function(a){this.lP.total=this.elArr[this.elArr.length-1];this.total+=a;0===this.direction?(this.lW=this.nW,this.lP.lH=
-this.lP.total/this.lW,this.lP.lR=this.lP.aspectRatio(this.lW,this.lP.lH),this.nW=this.total/this.height,this.lP.nH=this.lP.total/this.nW,this.lP.nR=this.lP.aspectRatio(this.nW,this.lP.nH)):(this.lH=this.nH,this.lP.lW=this.lP.total/this.lH,this.lP.lR=this.lP.aspectRatio(this.lP.lW,this.lH),this.nH=this.total/this.width,this.lP.nW=this.lP.total/this.nH,this.lP.nR=this.lP.aspectRatio(this.lP.nW,this.nH));this.elArr.push(a)};this.reset=function(){this.lW=this.nW=0;this.elArr=[];this.total=0}},algorithmCalcPoints:function(a,
-b,c,d){var e,n,k,g,f=c.lW,h=c.lH,u=c.plot,m,p=0,t=c.elArr.length-1;b?(f=c.nW,h=c.nH):m=c.elArr[c.elArr.length-1];l(c.elArr,function(a){if(b||p<t)0===c.direction?(e=u.x,n=u.y,k=f,g=a/k):(e=u.x,n=u.y,g=h,k=a/g),d.push({x:e,y:n,width:k,height:g}),0===c.direction?u.y+=g:u.x+=k;p+=1});c.reset();0===c.direction?c.width-=f:c.height-=h;u.y=u.parent.y+(u.parent.height-c.height);u.x=u.parent.x+(u.parent.width-c.width);a&&(c.direction=1-c.direction);b||c.addElement(m)},algorithmLowAspectRatio:function(a,b,c){var d=
-[],e=this,f,k={x:b.x,y:b.y,parent:b},g=0,h=c.length-1,m=new this.algorithmGroup(b.height,b.width,b.direction,k);l(c,function(c){f=c.val/b.val*b.height*b.width;m.addElement(f);m.lP.nR>m.lP.lR&&e.algorithmCalcPoints(a,!1,m,d,k);g===h&&e.algorithmCalcPoints(a,!0,m,d,k);g+=1});return d},algorithmFill:function(a,b,c){var d=[],e,f=b.direction,k=b.x,g=b.y,h=b.width,m=b.height,p,t,q,r;l(c,function(c){e=c.val/b.val*b.height*b.width;p=k;t=g;0===f?(r=m,q=e/r,h-=q,k+=q):(q=h,r=e/q,m-=r,g+=r);d.push({x:p,y:t,
-width:q,height:r});a&&(f=1-f)});return d},strip:function(a,b){return this.algorithmLowAspectRatio(!1,a,b)},squarified:function(a,b){return this.algorithmLowAspectRatio(!0,a,b)},sliceAndDice:function(a,b){return this.algorithmFill(!0,a,b)},stripes:function(a,b){return this.algorithmFill(!1,a,b)},translate:function(){var a=this,b=a.rootNode=f(a.rootNode,a.options.rootId,""),c,d;t.prototype.translate.call(a);a.levelMap=F(a.options.levels||[],function(a,c){a[c.level]=c;return a},{});d=a.tree=a.getTree();
-c=a.nodeMap[b];""===b||c&&c.children.length||(a.drillToNode("",!1),b=a.rootNode,c=a.nodeMap[b]);D(a.nodeMap[a.rootNode],function(c){var b=!1,d=c.parent;c.visible=!0;if(d||""===d)b=a.nodeMap[d];return b});D(a.nodeMap[a.rootNode].children,function(a){var c=!1;l(a,function(a){a.visible=!0;a.children.length&&(c=(c||[]).concat(a.children))});return c});a.setTreeValues(d);a.axisRatio=a.xAxis.len/a.yAxis.len;a.nodeMap[""].pointValues=b={x:0,y:0,width:100,height:100};a.nodeMap[""].values=b=m(b,{width:b.width*
-a.axisRatio,direction:"vertical"===a.options.layoutStartingDirection?0:1,val:d.val});a.calculateChildrenAreas(d,b);a.colorAxis?a.translateColors():a.options.colorByPoint||a.setColorRecursive(a.tree);a.options.allowDrillToNode&&(c=c.pointValues,a.xAxis.setExtremes(c.x,c.x+c.width,!1),a.yAxis.setExtremes(c.y,c.y+c.height,!1),a.xAxis.setScale(),a.yAxis.setScale());a.setPointValues()},drawDataLabels:function(){var a=this,b=w(a.points,function(a){return a.node.visible}),c,d;l(b,function(b){d=a.levelMap[b.node.levelDynamic];
-c={style:{}};b.node.isLeaf||(c.enabled=!1);d&&d.dataLabels&&(c=m(c,d.dataLabels),a._hasPointLabels=!0);b.shapeArgs&&(c.style.width=b.shapeArgs.width,b.dataLabel&&b.dataLabel.css({width:b.shapeArgs.width+"px"}));b.dlOptions=m(c,b.options.dataLabels)});t.prototype.drawDataLabels.call(this)},alignDataLabel:function(a){p.column.prototype.alignDataLabel.apply(this,arguments);a.dataLabel&&a.dataLabel.attr({zIndex:(a.node.zIndex||0)+1})},drawPoints:function(){var a=this,b=w(a.points,function(a){return a.node.visible});
-l(b,function(c){var b="level-group-"+c.node.levelDynamic;a[b]||(a[b]=a.chart.renderer.g(b).attr({zIndex:1E3-c.node.levelDynamic}).add(a.group));c.group=a[b]});p.column.prototype.drawPoints.call(this);this.colorAttribs&&l(this.points,function(a){a.graphic.css(this.colorAttribs(a))},this);a.options.allowDrillToNode&&l(b,function(b){b.graphic&&(b.drillId=a.options.interactByLeaf?a.drillToByLeaf(b):a.drillToByGroup(b))})},onClickDrillToNode:function(a){var b=(a=a.point)&&a.drillId;A(b)&&(a.setState(""),
-this.drillToNode(b))},drillToByGroup:function(a){var b=!1;1!==a.node.level-this.nodeMap[this.rootNode].level||a.node.isLeaf||(b=a.id);return b},drillToByLeaf:function(a){var b=!1;if(a.node.parent!==this.rootNode&&a.node.isLeaf)for(a=a.node;!b;)a=this.nodeMap[a.parent],a.parent===this.rootNode&&(b=a.id);return b},drillUp:function(){var a=this.nodeMap[this.rootNode];a&&A(a.parent)&&this.drillToNode(a.parent)},drillToNode:function(a,b){var c=this.nodeMap[a];this.idPreviousRoot=this.rootNode;this.rootNode=
-a;""===a?this.drillUpButton=this.drillUpButton.destroy():this.showDrillUpButton(c&&c.name||a);this.isDirty=!0;f(b,!0)&&this.chart.redraw()},showDrillUpButton:function(a){var b=this;a=a||"\x3c Back";var c=b.options.drillUpButton,d,e;c.text&&(a=c.text);this.drillUpButton?this.drillUpButton.attr({text:a}).align():(e=(d=c.theme)&&d.states,this.drillUpButton=this.chart.renderer.button(a,null,null,function(){b.drillUp()},d,e&&e.hover,e&&e.select).attr({align:c.position.align,zIndex:7}).add().align(c.position,
-!1,c.relativeTo||"plotBox"))},buildKDTree:h,drawLegendSymbol:d.LegendSymbolMixin.drawRectangle,getExtremes:function(){t.prototype.getExtremes.call(this,this.colorValueData);this.valueMin=this.dataMin;this.valueMax=this.dataMax;t.prototype.getExtremes.call(this)},getExtremesFromAll:!0,bindAxes:function(){var a={endOnTick:!1,gridLineWidth:0,lineWidth:0,min:0,dataMin:0,minPadding:0,max:100,dataMax:100,maxPadding:0,startOnTick:!1,title:null,tickPositions:[]};t.prototype.bindAxes.call(this);d.extend(this.yAxis.options,
-a);d.extend(this.xAxis.options,a)},utils:{recursive:D,reduce:F}},{getClassName:function(){var a=d.Point.prototype.getClassName.call(this),b=this.series,c=b.options;this.node.level<=b.nodeMap[b.rootNode].level?a+=" highcharts-above-level":this.node.isLeaf||f(c.interactByLeaf,!c.allowDrillToNode)?this.node.isLeaf||(a+=" highcharts-internal-node"):a+=" highcharts-internal-node-interactive";return a},isValid:function(){return this.id||r(this.value)},setState:function(a){d.Point.prototype.setState.call(this,
-a);this.graphic&&this.graphic.attr({zIndex:"hover"===a?1:0})},setVisible:p.pie.prototype.pointClass.prototype.setVisible})})(v,I)});
+(function(a){if(typeof module==='object'&&module.exports){module.exports=a;}else{a(Highcharts);}}(function(a){var b=(function(a){var e=a.each,b=a.extend,d=function(a){return typeof a==='boolean';},g=function(a){return typeof a==='function';},c=a.pick;var f=function u(g,e){var o=e.index,p=e.levelMap,n=e.parentColor,q=e.parentColorIndex,h=e.series,l=e.colors,s=e.siblings,r=h.points,m,f,b,j,i,k;var t=function(d){var c=b&&b.colorVariation;if(c&&c.key==='brightness'){return a.color(d).brighten(o/s*c.to).get();
+}return d;};if(g){f=r[g.i];b=p[g.levelDynamic]||{};m=f&&(d(b.colorByPoint)?b.colorByPoint:!!h.options.colorByPoint);if(m){j=l[f.index%l.length];}i=c(f&&f.options.color,b&&b.color,j,n&&t(n),h.color);k=c(f&&f.options.colorIndex,b&&b.colorIndex,q,e.colorIndex);}return{color:i,colorIndex:k};};var h=function s(a,f){var j=f.before,l=f.idRoot,o=f.mapIdToNode,p=o[l],n=(d(f.levelIsConstant)?f.levelIsConstant:true),r=f.points,i=r[a.i],q=(i&&i.options)||{},h=0,k=[],m;b(a,{levelDynamic:a.level-(n?0:p.level),
+name:c(i&&i.name,''),visible:(l===a.id||(d(f.visible)?f.visible:false))});if(g(j)){a=j(a,f);}e(a.children,function(c,e){var d=b({},f);b(d,{index:e,siblings:a.children.length,visible:a.visible});c=s(c,d);k.push(c);if(c.visible){h+=c.val;}});a.visible=h>0||a.visible;m=c(q.value,h);b(a,{children:k,childrenTotal:h,isLeaf:a.visible&&!h,val:m});return a;};return{getColor:f,setTreeValues:h};}(a));(function(a,s){var t=a.seriesType,d=a.seriesTypes,m=a.map,f=a.merge,h=a.extend,n=a.noop,b=a.each,p=s.getColor,
+i=a.grep,q=a.isNumber,j=a.isString,c=a.pick,e=a.Series,u=a.stableSort,o=function(c,d,b){b=b||this;a.objectEach(c,function(e,a){d.call(b,e,a,c);});},l=a.reduce,g=function(d,c,a){var b;a=a||this;b=c.call(a,d);if(b!==false){g(b,c,a);}},k;function r(a,b){if(a===b){return a!==0||1/a===1/b;}return a!==a&&b!==b;}t('treemap','scatter',{showInLegend:false,marker:false,dataLabels:{enabled:true,defer:false,verticalAlign:'middle',formatter:function(){return this.point.name||this.point.id;},inside:true},tooltip:{headerFormat:'',
+pointFormat:'<b>{point.name}</b>: {point.value}<br/>'},ignoreHiddenPoint:true,layoutAlgorithm:'sliceAndDice',layoutStartingDirection:'vertical',alternateStartingDirection:false,levelIsConstant:true,drillUpButton:{position:{align:'right',x:-10,y:10}}},{pointArrayMap:['value'],axisTypes:d.heatmap?['xAxis','yAxis','colorAxis']:['xAxis','yAxis'],directTouch:true,optionalAxis:'colorAxis',getSymbol:n,parallelArrays:['x','y','value','colorValue'],colorKey:'colorValue',translateColors:(d.heatmap&&d.heatmap.prototype.translateColors),
+colorAttribs:(d.heatmap&&d.heatmap.prototype.colorAttribs),trackerGroups:['group','dataLabelsGroup'],getListOfParents:function(e,f){var d=l(e||[],function(a,d,e){var b=c(d.parent,'');if(a[b]===undefined){a[b]=[];}a[b].push(e);return a;},{}),a={};b(f,function(b){if(j(b)){a['#'+b]=true;}});o(d,function(e,c,d){if(c!==''&&!a['#'+c]){b(e,function(a){d[''].push(a);});delete d[c];}});return d;},getTree:function(){var c=this,a=c.data,d=c.treeIndex,f=d&&d.ids.length===a.length,e,b;for(b=0;f&&b<a.length;b++){f=(a[b].id===d.ids[b]&&a[b].parent===d.parents[b]);
+}if(!f){e=m(a,function(a){return a.id;});d=c.treeIndex={ids:e,parents:m(a,function(a){return a.parent;}),listOfParents:c.getListOfParents(a,e)};c.childrenAreas={};}c.nodeMap=[];return c.buildNode('',-1,0,d.listOfParents,null);},init:function(c,d){var b=this;e.prototype.init.call(b,c,d);if(b.options.allowDrillToNode){a.addEvent(b,'click',b.onClickDrillToNode);}},buildNode:function(f,h,i,j,l){var c=this,g=[],k=c.points[h],e=0,a,d;b((j[f]||[]),function(a){d=c.buildNode(c.points[a].id,a,(i+1),j,f);e=Math.max(d.height+1,
+e);g.push(d);});a={id:f,i:h,children:g,height:e,level:i,parent:l,visible:false};c.nodeMap[a.id]=a;if(k){k.node=a;}return a;},setTreeValues:function(d){var e=this,j=e.options,k=e.rootNode,m=e.nodeMap,n=m[k],l=(typeof j.levelIsConstant==='boolean'?j.levelIsConstant:true),g=0,i=[],f,a=e.points[d.i];b(d.children,function(a){a=e.setTreeValues(a);i.push(a);if(!a.ignore){g+=a.val;}});u(i,function(a,b){return a.sortIndex-b.sortIndex;});f=c(a&&a.options.value,g);if(a){a.value=f;}h(d,{children:i,childrenTotal:g,
+ignore:!(c(a&&a.visible,true)&&(f>0)),isLeaf:d.visible&&!g,levelDynamic:(d.level-(l?0:n.level)),name:c(a&&a.name,''),sortIndex:c(a&&a.sortIndex,-f),val:f});return d;},calculateChildrenAreas:function(o,d){var e=this,t=e.options,j=this.levelMap[o.levelDynamic+1],n=c((e[j&&j.layoutAlgorithm]&&j.layoutAlgorithm),t.layoutAlgorithm),p=t.alternateStartingDirection,q=e.childrenAreas||(e.childrenAreas={}),a=q[o.i],s=[],l,g,m;l=i(o.children,function(a){return!a.ignore;});if(j&&j.layoutStartingDirection){d.direction=(j.layoutStartingDirection==='vertical'?0:1);
+}g=[n,p,e.axisRatio,d.x,d.y,d.width,d.height,d.direction,d.val];b(l,function(a){g.push(a.i,a.val,a.childrenTotal);});if(a&&a.inputs.length!==g.length){a=false;}for(m=0;a&&m<g.length;m++){if(!r(a.inputs[m],g[m])){a=false;}}if(!a){a={inputs:g,values:[],pointValues:[]};s=e[n](d,l);b(l,function(c,g){var b=s[g];a.values.push(f(b,{val:c.childrenTotal,direction:(p?1-d.direction:d.direction)}));a.pointValues.push(f(b,{x:(b.x/e.axisRatio),width:(b.width/e.axisRatio)}));});if(e[n]===k[n]){q[o.i]=a;}}b(l,function(b,
+c){b.values=h({},a.values[c]);b.pointValues=h({},a.pointValues[c]);if(b.children.length&&b.visible){e.calculateChildrenAreas(b,b.values);}});},setPointValues:function(){var a=this,c=a.xAxis,d=a.yAxis;b(a.points,function(a){var j=a.node,b=j.pointValues,f,g,h,i,e=0;if(b&&j.visible){f=Math.round(c.translate(b.x,0,0,0,1))-e;g=Math.round(c.translate(b.x+b.width,0,0,0,1))-e;h=Math.round(d.translate(b.y,0,0,0,1))-e;i=Math.round(d.translate(b.y+b.height,0,0,0,1))-e;a.shapeType='rect';a.shapeArgs={x:Math.min(f,
+g),y:Math.min(h,i),width:Math.abs(g-f),height:Math.abs(i-h)};a.plotX=(a.shapeArgs.x+(a.shapeArgs.width/2));a.plotY=(a.shapeArgs.y+(a.shapeArgs.height/2));}else{delete a.plotX;delete a.plotY;}});},setColorRecursive:function(d,j,g,i,k){var a=this,f=a&&a.chart,h=f&&f.options&&f.options.colors,c,e;if(d){c=p(d,{colors:h,index:i,levelMap:a.levelMap,parentColor:j,parentColorIndex:g,series:a,siblings:k});e=a.points[d.i];if(e){e.color=c.color;e.colorIndex=c.colorIndex;}b(d.children||[],function(b,e){a.setColorRecursive(b,
+c.color,c.colorIndex,e,d.children.length);});}},algorithmGroup:function(b,d,a,c){this.height=b;this.width=d;this.plot=c;this.direction=a;this.startDirection=a;this.total=0;this.nW=0;this.lW=0;this.nH=0;this.lH=0;this.elArr=[];this.lP={total:0,lH:0,nH:0,lW:0,nW:0,nR:0,lR:0,aspectRatio:function(b,a){return Math.max((b/a),(a/b));}};this.addElement=function(a){this.lP.total=this.elArr[this.elArr.length-1];this.total=this.total+a;if(this.direction===0){this.lW=this.nW;this.lP.lH=this.lP.total/this.lW;
+this.lP.lR=this.lP.aspectRatio(this.lW,this.lP.lH);this.nW=this.total/this.height;this.lP.nH=this.lP.total/this.nW;this.lP.nR=this.lP.aspectRatio(this.nW,this.lP.nH);}else{this.lH=this.nH;this.lP.lW=this.lP.total/this.lH;this.lP.lR=this.lP.aspectRatio(this.lP.lW,this.lH);this.nH=this.total/this.width;this.lP.nW=this.lP.total/this.nH;this.lP.nR=this.lP.aspectRatio(this.lP.nW,this.nH);}this.elArr.push(a);};this.reset=function(){this.nW=0;this.lW=0;this.elArr=[];this.total=0;};},algorithmCalcPoints:function(n,
+i,a,m){var j,k,e,d,g=a.lW,f=a.lH,c=a.plot,l,h=0,o=a.elArr.length-1;if(i){g=a.nW;f=a.nH;}else{l=a.elArr[a.elArr.length-1];}b(a.elArr,function(b){if(i||(h<o)){if(a.direction===0){j=c.x;k=c.y;e=g;d=b/e;}else{j=c.x;k=c.y;d=f;e=b/d;}m.push({x:j,y:k,width:e,height:d});if(a.direction===0){c.y=c.y+d;}else{c.x=c.x+e;}}h=h+1;});a.reset();if(a.direction===0){a.width=a.width-g;}else{a.height=a.height-f;}c.y=c.parent.y+(c.parent.height-a.height);c.x=c.parent.x+(c.parent.width-a.width);if(n){a.direction=1-a.direction;
+}if(!i){a.addElement(l);}},algorithmLowAspectRatio:function(h,a,g){var d=[],j=this,i,f={x:a.x,y:a.y,parent:a},k=a.direction,e=0,l=g.length-1,c=new this.algorithmGroup(a.height,a.width,k,f);b(g,function(b){i=b.val/a.val*a.height*a.width;c.addElement(i);if(c.lP.nR>c.lP.lR){j.algorithmCalcPoints(h,false,c,d,f);}if(e===l){j.algorithmCalcPoints(h,true,c,d,f);}e=e+1;});return d;},algorithmFill:function(o,a,n){var k=[],g,e=a.direction,i=a.x,j=a.y,h=a.width,f=a.height,l,m,d,c;b(n,function(b){g=b.val/a.val*a.height*a.width;
+l=i;m=j;if(e===0){c=f;d=g/c;h=h-d;i=i+d;}else{d=h;c=g/d;f=f-c;j=j+c;}k.push({x:l,y:m,width:d,height:c});if(o){e=1-e;}});return k;},strip:function(b,a){return this.algorithmLowAspectRatio(false,b,a);},squarified:function(b,a){return this.algorithmLowAspectRatio(true,b,a);},sliceAndDice:function(b,a){return this.algorithmFill(true,b,a);},stripes:function(b,a){return this.algorithmFill(false,b,a);},translate:function(){var a=this,i=a.rootNode=c(a.rootNode,a.options.rootId,''),h,k,m,j,d;e.prototype.translate.call(a);
+a.levelMap=l(a.options.levels||[],function(a,b){a[b.level]=b;return a;},{});j=a.tree=a.getTree();h=a.nodeMap[i];if(i!==''&&(!h||!h.children.length)){a.drillToNode('',false);i=a.rootNode;h=a.nodeMap[i];}g(a.nodeMap[a.rootNode],function(d){var c=false,b=d.parent;d.visible=true;if(b||b===''){c=a.nodeMap[b];}return c;});g(a.nodeMap[a.rootNode].children,function(c){var a=false;b(c,function(b){var c;b.visible=true;if(b.children.length){a=a||[];for(c=0;c<b.children.length;c++){a.push(b.children[c]);}}});
+return a;});a.setTreeValues(j);a.axisRatio=(a.xAxis.len/a.yAxis.len);a.nodeMap[''].pointValues=k={x:0,y:0,width:100,height:100};a.nodeMap[''].values=m=f(k,{width:(k.width*a.axisRatio),direction:(a.options.layoutStartingDirection==='vertical'?0:1),val:j.val});a.calculateChildrenAreas(j,m);if(a.colorAxis){a.translateColors();}else if(!a.options.colorByPoint){a.setColorRecursive(a.tree);}if(a.options.allowDrillToNode){d=h.pointValues;a.xAxis.setExtremes(d.x,d.x+d.width,false);a.yAxis.setExtremes(d.y,
+d.y+d.height,false);a.xAxis.setScale();a.yAxis.setScale();}a.setPointValues();},drawDataLabels:function(){var d=this,g=i(d.points,function(a){return a.node.visible;}),a,c;b(g,function(b){c=d.levelMap[b.node.levelDynamic];a={style:{}};if(!b.node.isLeaf){a.enabled=false;}if(c&&c.dataLabels){a=f(a,c.dataLabels);d._hasPointLabels=true;}if(b.shapeArgs){a.style.width=b.shapeArgs.width;if(b.dataLabel){b.dataLabel.css({width:b.shapeArgs.width+'px'});}}b.dlOptions=f(a,b.options.dataLabels);});e.prototype.drawDataLabels.call(this);
+},alignDataLabel:function(a){d.column.prototype.alignDataLabel.apply(this,arguments);if(a.dataLabel){a.dataLabel.attr({zIndex:(a.node.zIndex||0)+1});}},drawPoints:function(){var a=this,c=i(a.points,function(a){return a.node.visible;});b(c,function(c){var b='level-group-'+c.node.levelDynamic;if(!a[b]){a[b]=a.chart.renderer.g(b).attr({zIndex:1000-c.node.levelDynamic}).add(a.group);}c.group=a[b];});d.column.prototype.drawPoints.call(this);if(this.colorAttribs){b(this.points,function(a){a.graphic.css(this.colorAttribs(a));
+},this);}if(a.options.allowDrillToNode){b(c,function(b){if(b.graphic){b.drillId=a.options.interactByLeaf?a.drillToByLeaf(b):a.drillToByGroup(b);}});}},onClickDrillToNode:function(c){var d=this,a=c.point,b=a&&a.drillId;if(j(b)){a.setState('');d.drillToNode(b);}},drillToByGroup:function(a){var c=this,b=false;if((a.node.level-c.nodeMap[c.rootNode].level)===1&&!a.node.isLeaf){b=a.id;}return b;},drillToByLeaf:function(c){var d=this,b=false,a;if((c.node.parent!==d.rootNode)&&c.node.isLeaf){a=c.node;while(!b){a=d.nodeMap[a.parent];
+if(a.parent===d.rootNode){b=a.id;}}}return b;},drillUp:function(){var b=this,a=b.nodeMap[b.rootNode];if(a&&j(a.parent)){b.drillToNode(a.parent);}},drillToNode:function(b,f){var a=this,e=a.nodeMap,d=e[b];a.idPreviousRoot=a.rootNode;a.rootNode=b;if(b===''){a.drillUpButton=a.drillUpButton.destroy();}else{a.showDrillUpButton((d&&d.name||b));}this.isDirty=true;if(c(f,true)){this.chart.redraw();}},showDrillUpButton:function(f){var e=this,d=(f||'< Back'),a=e.options.drillUpButton,c,b;if(a.text){d=a.text;
+}if(!this.drillUpButton){c=a.theme;b=c&&c.states;this.drillUpButton=this.chart.renderer.button(d,null,null,function(){e.drillUp();},c,b&&b.hover,b&&b.select).attr({align:a.position.align,zIndex:7}).add().align(a.position,false,a.relativeTo||'plotBox');}else{this.drillUpButton.attr({text:d}).align();}},buildKDTree:n,drawLegendSymbol:a.LegendSymbolMixin.drawRectangle,getExtremes:function(){e.prototype.getExtremes.call(this,this.colorValueData);this.valueMin=this.dataMin;this.valueMax=this.dataMax;
+e.prototype.getExtremes.call(this);},getExtremesFromAll:true,bindAxes:function(){var b={endOnTick:false,gridLineWidth:0,lineWidth:0,min:0,dataMin:0,minPadding:0,max:100,dataMax:100,maxPadding:0,startOnTick:false,title:null,tickPositions:[]};e.prototype.bindAxes.call(this);a.extend(this.yAxis.options,b);a.extend(this.xAxis.options,b);},utils:{recursive:g,reduce:l}},{getClassName:function(){var b=a.Point.prototype.getClassName.call(this),d=this.series,e=d.options;if(this.node.level<=d.nodeMap[d.rootNode].level){b+=' highcharts-above-level';
+}else if(!this.node.isLeaf&&!c(e.interactByLeaf,!e.allowDrillToNode)){b+=' highcharts-internal-node-interactive';}else if(!this.node.isLeaf){b+=' highcharts-internal-node';}return b;},isValid:function(){return this.id||q(this.value);},setState:function(b){a.Point.prototype.setState.call(this,b);if(this.graphic){this.graphic.attr({zIndex:b==='hover'?1:0});}},setVisible:d.pie.prototype.pointClass.prototype.setVisible});k={};b(['sliceAndDice','stripes','squarified','strip'],function(a){k[a]=d.treemap.prototype[a];
+});}(a,b));}));